@@ -135,6 +135,19 @@ def merge_values(mergeables_out: Iterable, mergeables_in: Iterable) -> Iterable:
     return mergeables_out
 
 
+def get_reduction_fanin() -> int:
+    """
+    Retrieve the maximum number of partial results that are merged together by
+    each task of the tree-shaped reduction performed on the workers. It is set
+    by the user through ROOT.RDF.Experimental.Distributed.reduction_fanin.
+    """
+    fanin = ROOT.RDF.Experimental.Distributed.reduction_fanin
+    if not isinstance(fanin, int) or fanin < 2:
+        raise ValueError("ROOT.RDF.Experimental.Distributed.reduction_fanin must be an integer greater than one, "
+                         f"got {fanin!r}.")
+    return fanin
+
+
 def distrdf_reducer(results_inout: TaskResult,
                     results_in: TaskResult) -> TaskResult:
     """
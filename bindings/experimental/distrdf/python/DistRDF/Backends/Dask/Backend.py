@@ -10,7 +10,7 @@
 # For the list of contributors see $ROOTSYS/README/CREDITS.                    #
 ################################################################################
 import os
-from functools import singledispatch
+from functools import reduce, singledispatch
 from typing import Any, Dict, Optional
 
 from DistRDF import DataFrame
@@ -154,14 +154,24 @@ class DaskBackend(Base.BaseBackend):
 
             return mapper(current_range)
 
+        def dask_reducer(*results):
+            """
+            Merges a group of partial results into the first one.
+            """
+            return reduce(reducer, results)
+
         dmapper = dask.delayed(dask_mapper)
-        dreducer = dask.delayed(reducer)
+        dreducer = dask.delayed(dask_reducer)
 
         mergeables_lists = [dmapper(range) for range in ranges]
 
+        # Tree-shaped reduction on the workers: each task merges at most
+        # `fanin` partial results, only the final result reaches the client.
+        fanin = Base.get_reduction_fanin()
         while len(mergeables_lists) > 1:
-            mergeables_lists.append(
-                dreducer(mergeables_lists.pop(0), mergeables_lists.pop(0)))
+            group = mergeables_lists[:fanin]
+            del mergeables_lists[:fanin]
+            mergeables_lists.append(dreducer(*group))
 
         # Here we start the progressbar for the current RDF computation graph
         # running on the Dask client. This expects a future object, so we need
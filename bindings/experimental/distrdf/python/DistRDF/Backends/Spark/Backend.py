@@ -11,6 +11,7 @@
 ################################################################################
 
 import ntpath  # Filename from path (should be platform-independent)
+from math import ceil, log
 
 from DistRDF import DataFrame
 from DistRDF import HeadNode
@@ -130,8 +131,13 @@ class SparkBackend(Base.BaseBackend):
         # Build parallel collection
         parallel_collection = self.sc.parallelize(ranges, len(ranges))
 
-        # Map-Reduce using Spark
-        return parallel_collection.map(spark_mapper).treeReduce(reducer)
+        # Map-Reduce using Spark. The tree-shaped reduction happens on the
+        # executors, with a depth such that each level merges about `fanin`
+        # partial results. Spark needs a depth of at least 2 to merge on
+        # the executors rather than on the driver.
+        fanin = Base.get_reduction_fanin()
+        depth = max(2, ceil(log(max(len(ranges), 1)) / log(fanin)))
+        return parallel_collection.map(spark_mapper).treeReduce(reducer, depth)
 
     def distribute_unique_paths(self, paths):
         """
@@ -1,7 +1,9 @@
 import logging
+import os
 
 from bisect import bisect_left
 from dataclasses import dataclass, field
+from functools import lru_cache
 from itertools import accumulate
 from math import floor
 
@@ -155,9 +157,26 @@ class TaskTreeEntries:
     trees_with_entries: Dict[str, int] = field(default_factory=dict)
 
 
-def get_clusters_and_entries(treename: str, filename: str) -> Tuple[List[int], int]:
+def get_file_fingerprint(filename: str) -> Optional[Tuple[int, int]]:
     """
-    Retrieve cluster boundaries and number of entries of a TTree.
+    Retrieve the modification time and the size of a local file, or None if
+    the file is remote or cannot be found. Used to tell whether a file was
+    rewritten after its cluster boundaries were cached.
+    """
+    try:
+        stat = os.stat(filename)
+    except OSError:
+        return None
+    return stat.st_mtime_ns, stat.st_size
+
+
+@lru_cache(maxsize=4096)
+def _get_clusters_and_entries_cached(treename: str, filename: str,
+                                     fingerprint: Optional[Tuple[int, int]]) -> Tuple[List[int], int]:
+    """
+    Cached version of get_clusters_and_entries. The fingerprint of the file is
+    part of the key of the cache, so that rewritten local files are opened
+    again.
     """
 
     with ROOT.TFile.Open(filename, "READ_WITHOUT_GLOBALREGISTRATION") as tfile:
@@ -176,6 +195,26 @@ def get_clusters_and_entries(treename: str, filename: str) -> Tuple[List[int], i
     return clusters, entries
 
 
+def get_clusters_and_entries(treename: str, filename: str) -> Tuple[List[int], int]:
+    """
+    Retrieve cluster boundaries and number of entries of a TTree.
+
+    The result is cached in the worker process, so that subsequent tasks do not
+    open the same file again. This matters especially when friend trees are
+    present, since then every task needs the number of entries of all the trees
+    in the dataset. The cache can be emptied with clear_clusters_cache.
+    """
+    return _get_clusters_and_entries_cached(treename, filename, get_file_fingerprint(filename))
+
+
+def clear_clusters_cache() -> None:
+    """
+    Forget the cluster boundaries and number of entries of the trees that were
+    retrieved so far in this process.
+    """
+    _get_clusters_and_entries_cached.cache_clear()
+
+
 def get_percentage_ranges(treenames: List[str], filenames: List[str], npartitions: int,
                           friendinfo: Optional[ROOT.Internal.TreeUtils.RFriendInfo]) -> List[TreeRangePerc]:
     """
@@ -152,4 +152,7 @@ def create_distributed_module(parentmodule):
     # Set non-optimized default mode
     distributed.optimized = False
 
+    # Number of partial results merged by each task of the reduction
+    distributed.reduction_fanin = 2
+
     return distributed
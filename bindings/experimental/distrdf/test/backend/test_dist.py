@@ -30,6 +30,32 @@ class BaseBackendInitTest(unittest.TestCase):
             TestBackend()
 
 
+class ReductionFaninTest(unittest.TestCase):
+    """The fan-in of the reduction of the results is validated."""
+
+    def tearDown(self):
+        import ROOT
+        ROOT.RDF.Experimental.Distributed.reduction_fanin = 2
+
+    def test_default_fanin(self):
+        """By default, partial results are merged in pairs."""
+        self.assertEqual(Base.get_reduction_fanin(), 2)
+
+    def test_custom_fanin(self):
+        """The user can merge more results per task."""
+        import ROOT
+        ROOT.RDF.Experimental.Distributed.reduction_fanin = 16
+        self.assertEqual(Base.get_reduction_fanin(), 16)
+
+    def test_invalid_fanin(self):
+        """A fan-in smaller than two is an error."""
+        import ROOT
+        for fanin in (1, 0, 2.5, "4"):
+            ROOT.RDF.Experimental.Distributed.reduction_fanin = fanin
+            with self.assertRaises(ValueError):
+                Base.get_reduction_fanin()
+
+
 class DistRDataFrameInvariants(unittest.TestCase):
     """
     The result of distributed execution should not depend on the number of
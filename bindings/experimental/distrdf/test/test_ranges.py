@@ -518,3 +518,32 @@ class TreeRanges(unittest.TestCase):
         ]
 
         self.assertListEqual(ranges, ranges_reqd)
+
+    def test_clusters_and_entries_are_cached(self):
+        """
+        Cluster boundaries are retrieved once per file, unless the file is
+        rewritten.
+        """
+        treename = "tree_cache"
+        filename = "distrdf_unittests_file_cache.root"
+        opts = ROOT.RDF.RSnapshotOptions()
+        opts.fAutoFlush = 10
+        ROOT.RDataFrame(100).Define("x", "1").Snapshot(treename, filename, ["x"], opts)
+
+        Ranges.clear_clusters_cache()
+        clusters, entries = Ranges.get_clusters_and_entries(treename, filename)
+        self.assertEqual(entries, 100)
+        self.assertListEqual(clusters, list(range(0, 101, 10)))
+
+        # The second call does not open the file
+        hits = Ranges._get_clusters_and_entries_cached.cache_info().hits
+        self.assertEqual(Ranges.get_clusters_and_entries(treename, filename), (clusters, entries))
+        self.assertEqual(Ranges._get_clusters_and_entries_cached.cache_info().hits, hits + 1)
+
+        # A rewritten file is opened again
+        ROOT.RDataFrame(50).Define("x", "1").Snapshot(treename, filename, ["x"], opts)
+        clusters, entries = Ranges.get_clusters_and_entries(treename, filename)
+        self.assertEqual(entries, 50)
+        self.assertListEqual(clusters, list(range(0, 51, 10)))
+
+        os.remove(filename)
@@ -1,7 +1,7 @@
 from cppyy import gbl as gbl_namespace
 
 
-def _NumbaDeclareDecorator(input_types, return_type, name=None):
+def _NumbaDeclareDecorator(input_types, return_type, name=None, vectorize=False):
     '''
     Decorator for making Python callables accessible in C++ by just-in-time compilation
     with numba and cling
@@ -22,6 +22,13 @@ def _NumbaDeclareDecorator(input_types, return_type, name=None):
     Note that the callable is fully compiled without side-effects. The numba jitting uses the nopython
     option which does not allow interaction with the Python interpreter. This means that you can use
     the resulting function also safely in multi-threaded environments.
+
+    If vectorize is True and all input and return types are fundamental types, an additional overload
+    of the C++ function is jitted which takes an RVec for each input and returns an RVec with the results
+    for all elements. The loop over the elements runs in a single compiled numba kernel, which inlines the
+    Python callable and can thus be vectorized by the compiler, so that the cost of a call through the
+    wrapper is paid once per array instead of once per element. The kernel code is accessible by the
+    attribute __py_vectorized_wrapper__ and the C++ overload by the attribute __cpp_vectorized_wrapper__.
     '''
     # Make required imports
     try:
@@ -134,7 +141,7 @@ def _NumbaDeclareDecorator(input_types, return_type, name=None):
             nb_return_type = get_numba_type(return_type)
         return nb_return_type, nb_input_types
 
-    def inner(func, input_types=input_types, return_type=return_type, name=name):
+    def inner(func, input_types=input_types, return_type=return_type, name=name, vectorize=vectorize):
         '''
         Inner decorator without arguments, see outer decorator for documentation
         '''
@@ -324,6 +331,122 @@ namespace Numba {{
             raise Exception('Failed to jit C++ wrapper code with cling:\n{}'.format(cppwrappercode))
         func.__cpp_wrapper__ = cppwrappercode
 
+        if vectorize:
+            declare_vectorized(func, nbjit, glob, input_types, return_type, name)
+
         return func
 
+    def declare_vectorized(func, nbjit, glob, input_types, return_type, name):
+        '''
+        Jit a numba kernel looping over arrays of inputs and a C++ overload taking RVecs, which calls it
+        '''
+        if not input_types:
+            raise Exception('Vectorization of Python callable {} requires at least one input'.format(func))
+        for t in input_types + [return_type]:
+            if 'RVec' in t:
+                raise Exception(
+                        'Vectorization of Python callable {} is only supported for fundamental types, got {}'
+                        .format(func, t))
+
+        # Build kernel code, which calls the jitted Python callable for all elements of the arrays.
+        # The Python callable is jitted with inline='always', so that the loop compiles to native code
+        # without a function call per element.
+        pykernelcode = '''\
+def pykernel(n, {SIGNATURE}, ptr_r):
+    """
+    Kernel calling the jitted Python callable for all elements of the input arrays
+    """
+    {ARGS_DEF}
+    r = nb.carray(ptr_r, (n,))
+    for i in range(n):
+        r[i] = nbjit({ARGS})
+        '''.format(
+                SIGNATURE=', '.join('ptr_{}'.format(i) for i in range(len(input_types))),
+                ARGS_DEF='\n    '.join(
+                    'x_{0} = nb.carray(ptr_{0}, (n,))'.format(i) for i in range(len(input_types))),
+                ARGS=', '.join('x_{}[i]'.format(i) for i in range(len(input_types))))
+
+        kernel_locals = {}
+        if sys.version_info[0] >= 3:
+            exec(pykernelcode, glob, kernel_locals)
+        else:
+            exec(pykernelcode) in glob, kernel_locals
+
+        if not 'pykernel' in kernel_locals:
+            raise Exception('Failed to create Python kernel function:\n{}'.format(pykernelcode))
+
+        # Jit the kernel
+        c_input_types = [nb.int64] + [nb.types.CPointer(get_numba_type(t)) for t in input_types + [return_type]]
+        try:
+            nbkernel = nb.cfunc(nb.void(*c_input_types), nopython=True)(kernel_locals['pykernel'])
+        except:
+            raise Exception('Failed to jit Python kernel with numba.cfunc')
+        func.__py_vectorized_wrapper__ = pykernelcode
+        func.__numba_vectorized_cfunc__ = nbkernel
+
+        # Build C++ overload for jitting with cling. As for the scalar wrapper, bools are passed
+        # to the kernel as chars to match the numpy memory layout.
+        def c_type(t):
+            return 'char' if t == 'bool' else t
+
+        input_signature = ', '.join(
+                'const ROOT::RVec<{}> &x_{}'.format(t, i) for i, t in enumerate(input_types))
+        func_ptr_type = 'void(*)(long, {})'.format(
+                ', '.join('{}*'.format(c_type(t)) for t in input_types + [return_type]))
+        size_checks = []
+        vecbool_conversion = []
+        func_args = ['size']
+        for i, t in enumerate(input_types):
+            if i > 0:
+                size_checks.append(
+                        'if (x_{}.size() != size) throw std::runtime_error("Numba::{}: input RVecs have different sizes");'
+                        .format(i, name))
+            if t == 'bool':
+                vecbool_conversion.append('ROOT::RVec<char> xb_{0}(x_{0}.begin(), x_{0}.end());'.format(i))
+                func_args.append('xb_{}.data()'.format(i))
+            else:
+                func_args.append('const_cast<{}*>(x_{}.data())'.format(t, i))
+        func_args.append('x_r.data()')
+
+        if return_type == 'bool':
+            return_op = 'return ROOT::RVec<bool>(x_r.begin(), x_r.end());'
+        else:
+            return_op = 'return x_r;'
+
+        cppkernelcode = """\
+namespace Numba {{
+/*
+ * C++ overload of the wrapper function calling the jitted Python callable for all elements of the RVecs
+ */
+ROOT::RVec<{RETURN_TYPE}> {FUNC_NAME}({INPUT_SIGNATURE}) {{
+    // Create a function pointer from the jitted Python kernel
+    const auto funcptr = reinterpret_cast<{FUNC_PTR_TYPE}>({FUNC_PTR});
+    // All inputs need to have the same number of elements
+    const auto size = x_0.size();
+    {SIZE_CHECKS}
+    // Perform conversion of RVec<bool>
+    {VECBOOL_CONVERSION}
+    // Compute the results for all elements in a single call
+    ROOT::RVec<{C_RETURN_TYPE}> x_r(size);
+    funcptr({FUNC_ARGS});
+    {RETURN_OP}
+}}
+}}""".format(
+                RETURN_TYPE=return_type,
+                C_RETURN_TYPE=c_type(return_type),
+                FUNC_NAME=name,
+                INPUT_SIGNATURE=input_signature,
+                FUNC_PTR_TYPE=func_ptr_type,
+                FUNC_PTR=nbkernel.address,
+                SIZE_CHECKS='\n    '.join(size_checks),
+                VECBOOL_CONVERSION='\n    '.join(vecbool_conversion),
+                FUNC_ARGS=', '.join(func_args),
+                RETURN_OP=return_op)
+
+        # Jit C++ overload
+        err = gbl_namespace.gInterpreter.Declare(cppkernelcode)
+        if not err:
+            raise Exception('Failed to jit C++ vectorized wrapper code with cling:\n{}'.format(cppkernelcode))
+        func.__cpp_vectorized_wrapper__ = cppkernelcode
+
     return inner
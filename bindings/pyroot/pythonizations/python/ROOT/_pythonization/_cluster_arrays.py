@@ -0,0 +1,251 @@
+################################################################################
+# Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.                      #
+# All rights reserved.                                                         #
+#                                                                              #
+# For the licensing terms see $ROOTSYS/LICENSE.                                #
+# For the list of contributors see $ROOTSYS/README/CREDITS.                    #
+################################################################################
+
+'''
+Helpers to read columns of TTrees and RNTuples as NumPy arrays, one cluster at
+a time. The values of a column in a cluster are read by a JIT-compiled C++
+loop into an RVec, which NumPy adopts without copying.
+'''
+
+import cppyy
+
+
+# C++ type used to read a column and C++ type used to store it, for each of
+# the supported TTree leaf types and RNTuple field types. The storage types
+# must be supported by the array interface of RVec. Booleans are stored as
+# unsigned char and viewed as numpy.bool_.
+_tree_types = {
+    "Bool_t": ("Bool_t", "unsigned char"),
+    "Char_t": ("Char_t", "Char_t"),
+    "UChar_t": ("UChar_t", "UChar_t"),
+    "Short_t": ("Short_t", "Short_t"),
+    "UShort_t": ("UShort_t", "UShort_t"),
+    "Int_t": ("Int_t", "Int_t"),
+    "UInt_t": ("UInt_t", "UInt_t"),
+    "Long_t": ("Long_t", "Long_t"),
+    "ULong_t": ("ULong_t", "ULong_t"),
+    "Long64_t": ("Long64_t", "Long64_t"),
+    "ULong64_t": ("ULong64_t", "ULong64_t"),
+    "Float_t": ("Float_t", "Float_t"),
+    "Double_t": ("Double_t", "Double_t"),
+}
+
+_ntuple_types = {
+    "bool": ("bool", "unsigned char"),
+    "char": ("char", "char"),
+    "std::int8_t": ("std::int8_t", "std::int8_t"),
+    "std::uint8_t": ("std::uint8_t", "std::uint8_t"),
+    "std::int16_t": ("std::int16_t", "std::int16_t"),
+    "std::uint16_t": ("std::uint16_t", "std::uint16_t"),
+    "std::int32_t": ("std::int32_t", "std::int32_t"),
+    "std::uint32_t": ("std::uint32_t", "std::uint32_t"),
+    "std::int64_t": ("std::int64_t", "std::int64_t"),
+    "std::uint64_t": ("std::uint64_t", "std::uint64_t"),
+    "float": ("float", "float"),
+    "double": ("double", "double"),
+}
+
+_tree_code = '''
+#include "TChain.h"
+#include "TTree.h"
+#include "TTreeReader.h"
+#include "TTreeReaderValue.h"
+#include "ROOT/RVec.hxx"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace PyROOT {
+
+/// First entries of the clusters of the tree, followed by its number of entries.
+/// For a chain, the clusters of all its trees are returned, in chain entry numbers.
+inline std::vector<Long64_t> GetTreeClusterBoundaries(TTree &tree)
+{
+   std::vector<Long64_t> bounds;
+   auto addClusters = [&bounds](TTree &t, Long64_t offset) {
+      auto clusters = t.GetClusterIterator(0);
+      Long64_t start;
+      while ((start = clusters()) < t.GetEntries())
+         bounds.push_back(offset + start);
+   };
+   if (auto chain = dynamic_cast<TChain *>(&tree)) {
+      chain->GetEntries(); // fills the tree offsets
+      const Long64_t *offsets = chain->GetTreeOffset();
+      for (Int_t i = 0; i < chain->GetNtrees(); ++i) {
+         if (offsets[i + 1] == offsets[i])
+            continue;
+         if (chain->LoadTree(offsets[i]) < 0)
+            throw std::runtime_error("cannot load tree " + std::to_string(i) + " of the chain");
+         addClusters(*chain->GetTree(), offsets[i]);
+      }
+   } else {
+      addClusters(tree, 0);
+   }
+   bounds.push_back(tree.GetEntries());
+   return bounds;
+}
+
+/// Values of the entries [begin, end) of a scalar branch, read as T and stored as S.
+template <typename T, typename S = T>
+ROOT::RVec<S> ReadTreeColumn(TTree &tree, const std::string &column, Long64_t begin, Long64_t end)
+{
+   ROOT::RVec<S> values;
+   values.reserve(end - begin);
+   TTreeReader reader(&tree);
+   TTreeReaderValue<T> value(reader, column.c_str());
+   reader.SetEntriesRange(begin, end);
+   while (reader.Next()) {
+      const T *ptr = value.Get();
+      if (!ptr)
+         break;
+      values.push_back(*ptr);
+   }
+   if (static_cast<Long64_t>(values.size()) != end - begin)
+      throw std::runtime_error("cannot read entries of column " + column);
+   return values;
+}
+
+} // namespace PyROOT
+} // namespace Internal
+} // namespace ROOT
+'''
+
+_ntuple_code = '''
+#include "ROOT/RNTuple.hxx"
+#include "ROOT/RVec.hxx"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace PyROOT {
+
+/// First entries of the clusters of the ntuple, followed by its number of entries.
+inline std::vector<std::uint64_t> GetNTupleClusterBoundaries(ROOT::Experimental::RNTupleReader &reader)
+{
+   std::vector<std::uint64_t> bounds;
+   for (const auto &cluster : reader.GetDescriptor()->GetClusterIterable())
+      bounds.push_back(cluster.GetFirstEntryIndex());
+   std::sort(bounds.begin(), bounds.end());
+   bounds.push_back(reader.GetNEntries());
+   return bounds;
+}
+
+/// Values of the entries [begin, end) of a field, read as T and stored as S.
+template <typename T, typename S = T>
+ROOT::RVec<S> ReadNTupleColumn(ROOT::Experimental::RNTupleReader &reader, const std::string &field,
+                               std::uint64_t begin, std::uint64_t end)
+{
+   auto view = reader.GetView<T>(field);
+   ROOT::RVec<S> values(end - begin);
+   for (auto i = begin; i < end; ++i)
+      values[i - begin] = view(i);
+   return values;
+}
+
+} // namespace PyROOT
+} // namespace Internal
+} // namespace ROOT
+'''
+
+_declared = set()
+
+
+def _declare(name, code):
+    if name not in _declared:
+        if not cppyy.gbl.gInterpreter.Declare(code):
+            raise RuntimeError("Failed to compile the readers of the {} columns.".format(name))
+        _declared.add(name)
+    return cppyy.gbl.ROOT.Internal.PyROOT
+
+
+def _to_numpy(rvec, is_bool):
+    import numpy
+    # The array keeps a reference to the RVec, which owns the memory
+    array = numpy.asarray(rvec)
+    return array.view(numpy.bool_) if is_bool else array
+
+
+def iterate_tree_clusters(tree, columns):
+    '''
+    Generator of the clusters of a TTree or TChain, as dictionaries of
+    the column names to 1D NumPy arrays.
+    '''
+    helpers = _declare("TTree", _tree_code)
+
+    readers = []
+    for column in columns:
+        branch = tree.GetBranch(column)
+        leaf = branch.GetListOfLeaves().At(0) if branch and branch.GetListOfLeaves().GetEntries() == 1 else None
+        if not leaf or leaf.GetLeafCount() or leaf.GetLenStatic() != 1:
+            raise TypeError("Column {} is not a branch holding one value per entry.".format(column))
+        types = _tree_types.get(leaf.GetTypeName())
+        if types is None:
+            raise TypeError("Column {} has type {}, which cannot be read by clusters; use RDataFrame.AsNumpy "
+                            "instead.".format(column, leaf.GetTypeName()))
+        readers.append((column, helpers.ReadTreeColumn[types], types[0] == "Bool_t"))
+
+    bounds = helpers.GetTreeClusterBoundaries(tree)
+    for i in range(bounds.size() - 1):
+        begin, end = bounds[i], bounds[i + 1]
+        yield {column: _to_numpy(read(tree, column, begin, end), is_bool) for column, read, is_bool in readers}
+
+
+def default_tree_columns(tree):
+    '''
+    Names of the branches of the tree holding one value of a supported type per entry.
+    '''
+    columns = []
+    for branch in tree.GetListOfBranches():
+        leaves = branch.GetListOfLeaves()
+        if leaves.GetEntries() != 1 or branch.GetListOfBranches().GetEntries() != 0:
+            continue
+        leaf = leaves.At(0)
+        if leaf.GetTypeName() in _tree_types and not leaf.GetLeafCount() and leaf.GetLenStatic() == 1:
+            columns.append(branch.GetName())
+    return columns
+
+
+def iterate_ntuple_clusters(reader, columns):
+    '''
+    Generator of the clusters of an RNTuple, as dictionaries of the field names
+    to 1D NumPy arrays.
+    '''
+    helpers = _declare("RNTuple", _ntuple_code)
+
+    desc = reader.GetDescriptor()
+    readers = []
+    for column in columns:
+        field_id = desc.FindFieldId(column)
+        if field_id == cppyy.gbl.ROOT.Experimental.kInvalidDescriptorId:
+            raise TypeError("Field {} does not exist.".format(column))
+        type_name = str(desc.GetFieldDescriptor(field_id).GetTypeName())
+        types = _ntuple_types.get(type_name)
+        if types is None:
+            raise TypeError("Field {} has type {}, which cannot be read by clusters.".format(column, type_name))
+        readers.append((column, helpers.ReadNTupleColumn[types], types[0] == "bool"))
+
+    bounds = helpers.GetNTupleClusterBoundaries(reader)
+    for i in range(bounds.size() - 1):
+        begin, end = bounds[i], bounds[i + 1]
+        yield {column: _to_numpy(read(reader, column, begin, end), is_bool) for column, read, is_bool in readers}
+
+
+def default_ntuple_columns(reader):
+    '''
+    Names of the top-level fields of the ntuple of a supported type.
+    '''
+    desc = reader.GetDescriptor()
+    return [str(field.GetFieldName()) for field in desc.GetFieldIterable(desc.GetFieldZeroId())
+            if str(field.GetTypeName()) in _ntuple_types]
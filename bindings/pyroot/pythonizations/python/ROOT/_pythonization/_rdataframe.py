@@ -95,6 +95,19 @@ df.Define('array', 'ROOT::RVecF{1.,2.,3.}')\
   .Define('arraySquared', 'Numba::pypowarray(array, 2)')
 ~~~
 
+Functions of fundamental types can also be declared with `vectorize=True`. In addition to the function above, this
+declares an overload taking an `RVec` for each parameter, which computes the results for all elements with a single
+call of a compiled loop instead of one call per element:
+
+~~~{.py}
+@ROOT.Numba.Declare(['float', 'float'], 'float', vectorize=True)
+def pyhypot(x, y):
+    return (x**2 + y**2)**0.5
+
+df.Define('r', 'Numba::pyhypot(px, py)')\
+  .Define('jet_r', 'Numba::pyhypot(jet_px, jet_py)') # jet_px and jet_py are RVec<float> columns
+~~~
+
 Note that this functionality requires the Python packages `numba` and `cffi` to be installed.
 
 ### Interoperability with NumPy
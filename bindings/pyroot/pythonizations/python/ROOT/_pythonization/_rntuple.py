@@ -0,0 +1,59 @@
+################################################################################
+# Copyright (C) 1995-2026, Rene Brun and Fons Rademakers.                      #
+# All rights reserved.                                                         #
+#                                                                              #
+# For the licensing terms see $ROOTSYS/LICENSE.                                #
+# For the list of contributors see $ROOTSYS/README/CREDITS.                    #
+################################################################################
+
+r'''
+/**
+\class ROOT::Experimental::RNTupleReader
+\brief \parblock \endparblock
+\htmlonly
+<div class="pyrootbox">
+\endhtmlonly
+## PyROOT
+
+The `IterateClusters` method reads the values of the fields of an RNTuple one
+cluster at a time with a compiled loop, and returns them as NumPy arrays, one
+per field, which adopt the memory of the values without copying them:
+\code{.py}
+reader = ROOT.Experimental.RNTupleReader.Open("ntpl", "data.root")
+for arrays in reader.IterateClusters(["pt", "eta"]):
+    total += numpy.sum(arrays["pt"])
+\endcode
+The fields must be of a fundamental type; by default, all such top-level
+fields are read.
+
+\htmlonly
+</div>
+\endhtmlonly
+*/
+'''
+
+from . import pythonization
+
+
+def _RNTupleReaderIterateClusters(self, columns=None):
+    """
+    Generator of the clusters of entries of the ntuple, each one as a
+    dictionary of field names to 1D NumPy arrays.
+
+    Args:
+        columns (iterable[str], optional): names of the fields to read. By
+            default, all the top-level fields of a fundamental type are read.
+    """
+    from ._cluster_arrays import default_ntuple_columns, iterate_ntuple_clusters
+
+    if columns is None:
+        columns = default_ntuple_columns(self)
+    return iterate_ntuple_clusters(self, list(columns))
+
+
+@pythonization("RNTupleReader", ns="ROOT::Experimental")
+def pythonize_rntuple_reader(klass):
+    # Parameters:
+    # klass: class to be pythonized
+
+    klass.IterateClusters = _RNTupleReaderIterateClusters
@@ -78,6 +78,11 @@ _array_interface_dtype_map = {
     "unsigned int": "u",
     "unsigned long": "u",
     "ULong64_t": "u",
+    "short": "i",
+    "unsigned short": "u",
+    "char": "i",
+    "signed char": "i",
+    "unsigned char": "u",
 }
 
 
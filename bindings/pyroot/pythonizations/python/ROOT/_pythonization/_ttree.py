@@ -38,6 +38,16 @@ a tree as described above if performance is not an issue or when dealing with
 a small dataset. To read and process the entries of a tree in a much faster
 way, please use ROOT::RDataFrame.
 
+Alternatively, the `IterateClusters` method reads the values of a cluster of
+entries at a time with a compiled loop, and returns them as NumPy arrays, one
+per branch, which adopt the memory of the values without copying them:
+\code{.py}
+for arrays in t.IterateClusters(["x", "y"]):
+    total += numpy.sum(arrays["x"] * arrays["y"])
+\endcode
+The branches must hold one value of a fundamental type per entry; by default,
+all such branches are read.
+
 Second, a couple of TTree methods have been modified to facilitate their use
 from Python: TTree::Branch and TTree::SetBranchAddress.
 
@@ -145,6 +155,22 @@ def _TTree__iter__(self):
     if bytes_read == -1:
         raise RuntimeError("TTree I/O error")
 
+def _TTreeIterateClusters(self, columns=None):
+    """
+    Generator of the clusters of entries of the tree, each one as a
+    dictionary of branch names to 1D NumPy arrays.
+
+    Args:
+        columns (iterable[str], optional): names of the branches to read. By
+            default, all the branches holding one value of a fundamental type
+            per entry are read.
+    """
+    from ._cluster_arrays import default_tree_columns, iterate_tree_clusters
+
+    if columns is None:
+        columns = default_tree_columns(self)
+    return iterate_tree_clusters(self, list(columns))
+
 def _SetBranchAddress(self, *args):
     # Modify the behaviour if args is (const char*, void*)
     res = SetBranchAddressPyz(self, *args)
@@ -185,6 +211,9 @@ def pythonize_ttree(klass, name):
     # tree.branch syntax
     AddBranchAttrSyntax(klass)
 
+    # Reading of clusters as NumPy arrays
+    klass.IterateClusters = _TTreeIterateClusters
+
     # SetBranchAddress
     klass._OriginalSetBranchAddress = klass.SetBranchAddress
     klass.SetBranchAddress = _SetBranchAddress
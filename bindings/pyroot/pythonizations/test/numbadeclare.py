@@ -557,5 +557,77 @@ class NumbaDeclareArray(unittest.TestCase):
             self.assertEqual(x1[1], bool(x2[1]))
 
 
+
+class NumbaDeclareVectorized(unittest.TestCase):
+    """
+    Test decorator to create C++ wrapper for Python callables using numba with vectorized overloads
+    """
+
+    @unittest.skipIf(skip, skip_reason)
+    def test_wrapper_vectorized_ff(self):
+        """
+        Test vectorized overload with two inputs
+        """
+        @ROOT.Numba.Declare(["float", "float"], "float", vectorize=True)
+        def v1ff(x, y):
+            return x * y + 1.0
+
+        self.assertTrue(hasattr(v1ff, "__cpp_vectorized_wrapper__"))
+        self.assertTrue(hasattr(v1ff, "__py_vectorized_wrapper__"))
+        self.assertEqual(ROOT.Numba.v1ff(2.0, 3.0), 7.0)
+        x = ROOT.Numba.v1ff(ROOT.VecOps.RVec('float')([1.0, 2.0, 3.0]), ROOT.VecOps.RVec('float')([0.0, 1.0, 2.0]))
+        self.assertEqual(list(x), [1.0, 3.0, 7.0])
+
+    @unittest.skipIf(skip, skip_reason)
+    def test_wrapper_vectorized_b(self):
+        """
+        Test vectorized overload with bool input and output
+        """
+        @ROOT.Numba.Declare(["bool", "int"], "bool", vectorize=True)
+        def v2bi(x, y):
+            return x and y > 0
+
+        x = ROOT.Numba.v2bi(ROOT.VecOps.RVec('bool')([True, True, False]), ROOT.VecOps.RVec('int')([1, 0, 1]))
+        self.assertEqual([bool(e) for e in x], [True, False, False])
+
+    @unittest.skipIf(skip, skip_reason)
+    def test_wrapper_vectorized_size_mismatch(self):
+        """
+        Test vectorized overload with inputs of different sizes
+        """
+        @ROOT.Numba.Declare(["double", "double"], "double", vectorize=True)
+        def v3dd(x, y):
+            return x + y
+
+        with self.assertRaises(Exception):
+            ROOT.Numba.v3dd(ROOT.VecOps.RVec('double')([1.0, 2.0]), ROOT.VecOps.RVec('double')([1.0]))
+
+    @unittest.skipIf(skip, skip_reason)
+    def test_wrapper_vectorized_rvec(self):
+        """
+        Test that vectorization of callables taking RVecs is rejected
+        """
+        with self.assertRaises(Exception):
+            @ROOT.Numba.Declare(["RVec<float>"], "float", vectorize=True)
+            def v4vf(x):
+                return x.sum()
+
+    @unittest.skipIf(skip, skip_reason)
+    def test_rdataframe_vectorized(self):
+        """
+        Test scalar and vectorized overloads as part of RDataFrame
+        """
+        @ROOT.Numba.Declare(["double"], "double", vectorize=True)
+        def v5d(x):
+            return 2.0 * x
+
+        df = ROOT.RDataFrame(4).Define("x", "double(rdfentry_)") \
+                               .Define("v", "ROOT::RVecD{x, x + 1.0}") \
+                               .Define("y", "Numba::v5d(x)") \
+                               .Define("w", "Numba::v5d(v)")
+        self.assertEqual(df.Mean("y").GetValue(), 3.0)
+        self.assertEqual(df.Sum("w").GetValue(), 32.0)
+
+
 if __name__ == '__main__':
     unittest.main()
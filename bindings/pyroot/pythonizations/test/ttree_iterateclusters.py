@@ -0,0 +1,93 @@
+import os
+import unittest
+
+import numpy as np
+
+import ROOT
+
+
+class TTreeIterateClusters(unittest.TestCase):
+    """
+    Test for the IterateClusters pythonization of TTree, which returns the
+    values of the branches as NumPy arrays, one cluster at a time.
+    """
+
+    filename = 'ttreeiterateclusters.root'
+    treename = 'mytree'
+    nentries = 35
+    clustersize = 10
+
+    @classmethod
+    def setUpClass(cls):
+        ROOT.gInterpreter.Declare('''
+        void CreateClusteredTree(const char *filename, const char *treename, int nentries, int clustersize)
+        {
+           TFile f(filename, "RECREATE");
+           TTree t(treename, "Test tree");
+           t.SetAutoFlush(clustersize);
+           float x;
+           int i;
+           bool b;
+           std::vector<double> v;
+           t.Branch("x", &x);
+           t.Branch("i", &i);
+           t.Branch("b", &b);
+           t.Branch("v", &v);
+           for (i = 0; i < nentries; ++i) {
+              x = 0.5 * i;
+              b = i % 2;
+              v.assign(i % 3, i);
+              t.Fill();
+           }
+           f.Write();
+        }
+        ''')
+        ROOT.CreateClusteredTree(cls.filename, cls.treename, cls.nentries, cls.clustersize)
+
+    @classmethod
+    def tearDownClass(cls):
+        os.remove(cls.filename)
+
+    def check_arrays(self, chunks, nentries):
+        self.assertEqual([len(c["x"]) for c in chunks[:3]], [self.clustersize] * 3)
+        x = np.concatenate([c["x"] for c in chunks])
+        i = np.concatenate([c["i"] for c in chunks])
+        b = np.concatenate([c["b"] for c in chunks])
+        expected = np.arange(nentries) % self.nentries
+        self.assertEqual(x.dtype, np.float32)
+        self.assertEqual(i.dtype, np.int32)
+        self.assertEqual(b.dtype, np.bool_)
+        np.testing.assert_array_equal(i, expected)
+        np.testing.assert_array_equal(x, 0.5 * expected)
+        np.testing.assert_array_equal(b, expected % 2 == 1)
+
+    def test_tree(self):
+        f = ROOT.TFile(self.filename)
+        t = f.Get(self.treename)
+        chunks = list(t.IterateClusters(["x", "i", "b"]))
+        self.assertEqual(len(chunks), 4)
+        self.check_arrays(chunks, self.nentries)
+
+    def test_default_columns(self):
+        f = ROOT.TFile(self.filename)
+        t = f.Get(self.treename)
+        chunk = next(t.IterateClusters())
+        self.assertEqual(sorted(chunk.keys()), ["b", "i", "x"])
+
+    def test_chain(self):
+        c = ROOT.TChain(self.treename)
+        c.Add(self.filename)
+        c.Add(self.filename)
+        chunks = list(c.IterateClusters(["x", "i", "b"]))
+        self.assertEqual(len(chunks), 8)
+        self.check_arrays(chunks, 2 * self.nentries)
+
+    def test_unsupported_column(self):
+        f = ROOT.TFile(self.filename)
+        t = f.Get(self.treename)
+        with self.assertRaises(TypeError):
+            next(t.IterateClusters(["v"]))
+
+
+if __name__ == '__main__':
+    unittest.main()
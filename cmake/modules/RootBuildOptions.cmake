@@ -143,6 +143,7 @@ ROOT_BUILD_OPTION(jemalloc OFF "Use jemalloc memory allocator")
 ROOT_BUILD_OPTION(libcxx OFF "Build using libc++")
 ROOT_BUILD_OPTION(macos_native OFF "Disable looking for libraries, includes and binaries in locations other than a native installation (MacOS only)")
 ROOT_BUILD_OPTION(mathmore ON "Build libMathMore extended math library (requires GSL)")
+ROOT_BUILD_OPTION(matrix-blas ON "Use BLAS/LAPACK for the large dense products, inversions and decompositions of libMatrix")
 ROOT_BUILD_OPTION(memory_termination OFF "Free internal ROOT memory before process termination (experimental, used for leak checking)")
 ROOT_BUILD_OPTION(mlp ON "Enable support for TMultilayerPerceptron classes' federation")
 ROOT_BUILD_OPTION(minuit2 ON "Build Minuit2 minimization library")
@@ -245,6 +246,7 @@ if(all)
  set(fcgi_defvalue ON)
  set(imt_defvalue ON)
  set(mathmore_defvalue ON)
+ set(matrix-blas_defvalue ON)
  set(minuit2_defvalue ON)
  set(mlp_defvalue ON)
  set(monalisa_defvalue ON)
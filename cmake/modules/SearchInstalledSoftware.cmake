@@ -819,6 +819,21 @@ if(builtin_fftw3 AND NO_CONNECTION)
   endif()
 endif()
 
+#---Check for BLAS and LAPACK for the Matrix library---------------------------------
+if(matrix-blas)
+  message(STATUS "Looking for BLAS and LAPACK for the Matrix library")
+  find_package(BLAS)
+  find_package(LAPACK)
+  if(NOT BLAS_FOUND OR NOT LAPACK_FOUND)
+    if(fail-on-missing)
+      message(FATAL_ERROR "BLAS or LAPACK libraries not found and they are required (matrix-blas option enabled)")
+    else()
+      message(STATUS "BLAS or LAPACK not found. Switching OFF 'matrix-blas' option, the Matrix library will use its own routines")
+      set(matrix-blas OFF CACHE BOOL "Disabled because BLAS or LAPACK not found (${matrix-blas_description})" FORCE)
+    endif()
+  endif()
+endif()
+
 #---Check for FFTW3-------------------------------------------------------------------
 if(fftw3)
   if(NOT builtin_fftw3)
@@ -0,0 +1,72 @@
+// @(#)root/base:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RTracing
+#define ROOT_RTracing
+
+#include "DllImport.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace ROOT {
+
+/// Start recording trace events (tasks, lock waits, I/O requests) of all threads. The events are written
+/// to `fileName` in the Chrome trace event JSON format, which can be opened with chrome://tracing or
+/// https://ui.perfetto.dev, when DisableTracing() is called or at the end of the process.
+/// Tracing can also be enabled by setting the environment variable `ROOT_TRACE_FILE` to the output file name.
+void EnableTracing(const char *fileName);
+/// Stop recording trace events and write the recorded events to the file passed to EnableTracing().
+void DisableTracing();
+/// Returns true if trace events are being recorded.
+bool IsTracingEnabled();
+
+namespace Internal {
+
+/// Flag checked inline by RTraceScope, so that disabled tracing costs a single relaxed load.
+R__EXTERN std::atomic<bool> gTracingEnabled;
+
+/// Record a complete event, with begin and end in nanoseconds as returned by GetTraceTime().
+void RecordTraceEvent(const char *name, const char *category, std::uint64_t begin, std::uint64_t end);
+/// Nanoseconds elapsed since tracing was enabled.
+std::uint64_t GetTraceTime();
+
+/// \brief Record the lifetime of the scope as a trace event of the calling thread.
+///
+/// Nothing is done if tracing is disabled when the scope is entered. The name and category are stored as
+/// pointers and must therefore be string literals, or have static storage duration otherwise.
+/// The events of each thread are kept in a fixed-size ring buffer, hence the oldest events of a thread are
+/// overwritten if it records more than the buffer capacity.
+class RTraceScope {
+   const char *fName;
+   const char *fCategory;
+   std::uint64_t fBegin = 0;
+   bool fActive;
+
+public:
+   RTraceScope(const char *name, const char *category)
+      : fName(name), fCategory(category), fActive(gTracingEnabled.load(std::memory_order_relaxed))
+   {
+      if (fActive)
+         fBegin = GetTraceTime();
+   }
+   ~RTraceScope()
+   {
+      if (fActive)
+         RecordTraceEvent(fName, fCategory, fBegin, GetTraceTime());
+   }
+   RTraceScope(const RTraceScope &) = delete;
+   RTraceScope &operator=(const RTraceScope &) = delete;
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
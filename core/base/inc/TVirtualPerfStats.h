@@ -72,6 +72,11 @@ public:
    virtual void RateEvent(Double_t proctime, Double_t deltatime,
                           Long64_t eventsprocessed, Long64_t bytesRead) = 0;
 
+   // Per-branch events, only sent to the perfStats attached to a TTree.
+   virtual void BasketReadEvent(TBranch * /*branch*/, Int_t /*nbytes*/, Int_t /*objlen*/, Bool_t /*fromCache*/,
+                                Double_t /*unzipTime*/) {}
+   virtual void DeserializeEvent(TBranch * /*branch*/, Int_t /*nbytes*/, Double_t /*start*/) {}
+
    virtual void SetBytesRead(Long64_t num) = 0;
    virtual Long64_t GetBytesRead() const = 0;
    virtual void SetNumEvents(Long64_t num) = 0;
@@ -0,0 +1,247 @@
+// @(#)root/base:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+/** \class ROOT::Internal::RTraceScope
+\ingroup Base
+
+Opt-in recorder of trace events, enabled with ROOT::EnableTracing() or the
+`ROOT_TRACE_FILE` environment variable.
+
+Every thread records its events in its own fixed-size ring buffer, guarded by
+a mutex that is only contended while the trace is written; the buffers are
+owned by a global registry, so that events of threads that already ended are
+not lost. The trace is written in the Chrome trace event format ("complete"
+events with microsecond time stamps), understood by chrome://tracing and
+Perfetto.
+*/
+
+#include "ROOT/RTracing.hxx"
+#include "TError.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+std::atomic<bool> ROOT::Internal::gTracingEnabled{false};
+
+namespace {
+
+/// Maximum number of events kept per thread.
+constexpr std::size_t kTraceBufferCapacity = 1 << 16;
+
+struct RTraceEvent {
+   const char *fName;
+   const char *fCategory;
+   std::uint64_t fBegin;
+   std::uint64_t fEnd;
+};
+
+struct RThreadTraceBuffer {
+   std::mutex fMutex;
+   unsigned int fThreadId = 0;
+   std::vector<RTraceEvent> fEvents; ///< Ring buffer, allocated on the first event
+   std::size_t fNext = 0;            ///< Position of the next event in fEvents
+   bool fWrapped = false;            ///< Whether the oldest events were overwritten
+
+   void Clear()
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      fEvents.clear();
+      fNext = 0;
+      fWrapped = false;
+   }
+};
+
+struct RTraceRegistry {
+   std::mutex fMutex;
+   std::vector<std::shared_ptr<RThreadTraceBuffer>> fBuffers;
+   std::string fFileName;
+   unsigned int fNextThreadId = 1;
+};
+
+RTraceRegistry &GetTraceRegistry()
+{
+   static RTraceRegistry registry;
+   return registry;
+}
+
+std::atomic<std::int64_t> gTraceStart{0};
+
+std::int64_t SteadyClockNanoseconds()
+{
+   return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+RThreadTraceBuffer &GetThreadTraceBuffer()
+{
+   thread_local std::shared_ptr<RThreadTraceBuffer> buffer = [] {
+      auto b = std::make_shared<RThreadTraceBuffer>();
+      auto &registry = GetTraceRegistry();
+      std::lock_guard<std::mutex> lock(registry.fMutex);
+      b->fThreadId = registry.fNextThreadId++;
+      registry.fBuffers.emplace_back(b);
+      return b;
+   }();
+   return *buffer;
+}
+
+void WriteJSONString(FILE *f, const char *str)
+{
+   fputc('"', f);
+   for (; *str; ++str) {
+      if (*str == '"' || *str == '\\')
+         fputc('\\', f);
+      fputc(*str, f);
+   }
+   fputc('"', f);
+}
+
+using RThreadTraceEvents_t = std::vector<std::pair<unsigned int, std::vector<RTraceEvent>>>;
+
+/// Write the events of all the threads, already removed from the buffers, to the trace file.
+void WriteTrace(const std::string &fileName, const RThreadTraceEvents_t &events)
+{
+   FILE *f = fopen(fileName.c_str(), "w");
+   if (!f) {
+      ::Error("ROOT::DisableTracing", "cannot open trace file %s", fileName.c_str());
+      return;
+   }
+   fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", f);
+   bool first = true;
+   for (const auto &threadEvents : events) {
+      for (const auto &e : threadEvents.second) {
+         fputs(first ? "\n" : ",\n", f);
+         first = false;
+         fputs("{\"name\":", f);
+         WriteJSONString(f, e.fName);
+         fputs(",\"cat\":", f);
+         WriteJSONString(f, e.fCategory);
+         fprintf(f, ",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f}", threadEvents.first,
+                 e.fBegin * 1e-3, (e.fEnd - e.fBegin) * 1e-3);
+      }
+   }
+   fputs("\n]}\n", f);
+   fclose(f);
+}
+
+/// Enables tracing if `ROOT_TRACE_FILE` is set, and writes the trace at the end of the process.
+struct RTraceFromEnv {
+   RTraceFromEnv()
+   {
+      const char *fileName = std::getenv("ROOT_TRACE_FILE");
+      if (fileName && *fileName)
+         ROOT::EnableTracing(fileName);
+   }
+   ~RTraceFromEnv()
+   {
+      if (ROOT::IsTracingEnabled())
+         ROOT::DisableTracing();
+   }
+};
+
+RTraceFromEnv gTraceFromEnv;
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Start recording trace events into a new trace, discarding previously
+/// recorded events. The trace is written to `fileName` by DisableTracing(),
+/// or at the end of the process.
+
+void ROOT::EnableTracing(const char *fileName)
+{
+   auto &registry = GetTraceRegistry();
+   std::lock_guard<std::mutex> lock(registry.fMutex);
+   Internal::gTracingEnabled = false;
+   registry.fFileName = fileName ? fileName : "";
+   for (auto &buffer : registry.fBuffers)
+      buffer->Clear();
+   gTraceStart = SteadyClockNanoseconds();
+   Internal::gTracingEnabled = true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Stop recording trace events and write the trace file. Events of scopes
+/// that are still open are dropped.
+
+void ROOT::DisableTracing()
+{
+   RThreadTraceEvents_t events;
+   std::string fileName;
+   {
+      auto &registry = GetTraceRegistry();
+      std::lock_guard<std::mutex> lock(registry.fMutex);
+      if (!Internal::gTracingEnabled)
+         return;
+      Internal::gTracingEnabled = false;
+      fileName = registry.fFileName;
+      for (auto &buffer : registry.fBuffers) {
+         std::lock_guard<std::mutex> bufferLock(buffer->fMutex);
+         if (buffer->fEvents.empty())
+            continue;
+         std::vector<RTraceEvent> threadEvents;
+         threadEvents.reserve(buffer->fEvents.size());
+         // Oldest events first
+         if (buffer->fWrapped)
+            threadEvents.insert(threadEvents.end(), buffer->fEvents.begin() + buffer->fNext, buffer->fEvents.end());
+         threadEvents.insert(threadEvents.end(), buffer->fEvents.begin(), buffer->fEvents.begin() + buffer->fNext);
+         events.emplace_back(buffer->fThreadId, std::move(threadEvents));
+         buffer->fEvents.clear();
+         buffer->fNext = 0;
+         buffer->fWrapped = false;
+      }
+   }
+   if (!fileName.empty())
+      WriteTrace(fileName, events);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool ROOT::IsTracingEnabled()
+{
+   return Internal::gTracingEnabled;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+std::uint64_t ROOT::Internal::GetTraceTime()
+{
+   return SteadyClockNanoseconds() - gTraceStart.load(std::memory_order_relaxed);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Append an event to the ring buffer of the calling thread, overwriting the
+/// oldest event if the buffer is full.
+
+void ROOT::Internal::RecordTraceEvent(const char *name, const char *category, std::uint64_t begin,
+                                      std::uint64_t end)
+{
+   auto &buffer = GetThreadTraceBuffer();
+   std::lock_guard<std::mutex> lock(buffer.fMutex);
+   // Tracing could have been disabled, and the buffer emptied, since the scope began
+   if (!gTracingEnabled.load(std::memory_order_relaxed))
+      return;
+   if (buffer.fEvents.capacity() < kTraceBufferCapacity)
+      buffer.fEvents.reserve(kTraceBufferCapacity);
+   if (buffer.fEvents.size() < kTraceBufferCapacity) {
+      buffer.fEvents.push_back({name, category, begin, end});
+      buffer.fNext = buffer.fEvents.size() % kTraceBufferCapacity;
+      if (buffer.fNext == 0)
+         buffer.fWrapped = true;
+   } else {
+      buffer.fEvents[buffer.fNext] = {name, category, begin, end};
+      buffer.fNext = (buffer.fNext + 1) % kTraceBufferCapacity;
+   }
+}
@@ -74,7 +74,9 @@ of a main program creating an interactive version is shown below:
 #include "RGitCommit.h"
 #include <string>
 #include <map>
+#include <chrono>
 #include <cstdlib>
+#include <vector>
 #ifdef WIN32
 #include <io.h>
 #include "Windows4Root.h"
@@ -282,6 +284,54 @@ namespace {
    }
 }
 
+namespace {
+   ////////////////////////////////////////////////////////////////////////////////
+   /// Timing of the phases of the initialization of ROOT, printed to stderr once
+   /// the interpreter is initialized if the environment variable
+   /// ROOT_STARTUP_TIMING is set. It shows which subsystems dominate the startup
+   /// time of short jobs.
+
+   class TStartupTimer {
+      using Clock_t = std::chrono::steady_clock;
+      bool fEnabled;
+      Clock_t::time_point fStart;
+      Clock_t::time_point fLast;
+      std::vector<std::pair<const char *, double>> fPhases; // name and duration in ms
+
+   public:
+      TStartupTimer() : fEnabled(std::getenv("ROOT_STARTUP_TIMING") != nullptr), fStart(Clock_t::now()), fLast(fStart) {}
+
+      /// Record the end of the phase `name`, started at the end of the previous one.
+      void Mark(const char *name)
+      {
+         if (!fEnabled)
+            return;
+         const auto now = Clock_t::now();
+         fPhases.emplace_back(name, std::chrono::duration<double, std::milli>(now - fLast).count());
+         fLast = now;
+      }
+
+      void Report()
+      {
+         if (!fEnabled)
+            return;
+         fprintf(stderr, "Info in <TROOT>: startup timing\n");
+         for (auto &phase : fPhases)
+            fprintf(stderr, "   %-40s %10.2f ms\n", phase.first, phase.second);
+         fprintf(stderr, "   %-40s %10.2f ms\n", "total",
+                 std::chrono::duration<double, std::milli>(fLast - fStart).count());
+         fPhases.clear();
+         fEnabled = false;
+      }
+   };
+
+   TStartupTimer &GetStartupTimer()
+   {
+      static TStartupTimer startupTimer;
+      return startupTimer;
+   }
+}
+
 Int_t  TROOT::fgDirLevel = 0;
 Bool_t TROOT::fgRootInit = kFALSE;
 
@@ -521,6 +571,8 @@ namespace Internal {
    /// a hint for ROOT: it will try to satisfy the request if the execution
    /// scenario allows it. For example, if ROOT is configured to use an external
    /// scheduler, setting a value for 'numthreads' might not have any effect.
+   /// On machines with several NUMA nodes, the thread pool can be constrained to the cores
+   /// of one node by setting the environment variable `ROOT_TBB_NUMA_NODE` to its index.
    ///
    /// \note Use `DisableImplicitMT()` to disable multi-threading (some locks will remain in place as
    /// described in EnableThreadSafety()). `EnableImplicitMT(1)` creates a thread-pool of size 1.
@@ -645,6 +697,8 @@ TROOT::TROOT(const char *name, const char *title, VoidFuncPtr_t *initfunc)
 
    R__LOCKGUARD(gROOTMutex);
 
+   GetStartupTimer();
+
    ROOT::Internal::gROOTLocal = this;
    gDirectory = nullptr;
 
@@ -678,6 +732,7 @@ TROOT::TROOT(const char *name, const char *title, VoidFuncPtr_t *initfunc)
    gRootDir = GetRootSys().Data();
 
    TDirectory::BuildDirectory(nullptr, nullptr);
+   GetStartupTimer().Mark("system and directories");
 
    // Initialize interface to CINT C++ interpreter
    fVersionInt      = 0;  // check in TROOT dtor in case TCling fails
@@ -707,6 +762,7 @@ TROOT::TROOT(const char *name, const char *title, VoidFuncPtr_t *initfunc)
       // initialize plugin manager early
       fPluginManager->LoadHandlersFromEnv(gEnv);
    }
+   GetStartupTimer().Mark("plugin manager");
 
    TSystemDirectory *workdir = new TSystemDirectory("workdir", gSystem->WorkingDirectory());
 
@@ -801,6 +857,7 @@ TROOT::TROOT(const char *name, const char *title, VoidFuncPtr_t *initfunc)
 
    // Create a default MessageHandler
    new TMessageHandler((TClass*)nullptr);
+   GetStartupTimer().Mark("collections and folders");
 
    // Create some styles
    gStyle = nullptr;
@@ -824,12 +881,15 @@ TROOT::TROOT(const char *name, const char *title, VoidFuncPtr_t *initfunc)
       fBatch = kTRUE;
 #endif
 
+   GetStartupTimer().Mark("styles and batch graphics");
+
    int i = 0;
    while (initfunc && initfunc[i]) {
       (initfunc[i])();
       fBatch = kFALSE;  // put system in graphics mode (backward compatible)
       i++;
    }
+   GetStartupTimer().Mark("initialization functions");
 
    // Set initial/default list of browsable objects
    fBrowsables->Add(fRootFolder, "root");
@@ -2029,6 +2089,7 @@ void TROOT::InitInterpreter()
    } else {
       gInterpreterLib = RTLD_DEFAULT;
    }
+   GetStartupTimer().Mark("loading libRIO and libCling");
    CreateInterpreter_t *CreateInterpreter = (CreateInterpreter_t*) dlsym(gInterpreterLib, "CreateInterpreter");
    if (!CreateInterpreter) {
       TString err = dlerror();
@@ -2064,6 +2125,7 @@ void TROOT::InitInterpreter()
       nullptr};
 
    fInterpreter = CreateInterpreter(gInterpreterLib, interpArgs);
+   GetStartupTimer().Mark("creating the interpreter");
 
    fCleanups->Add(fInterpreter);
    fInterpreter->SetBit(kMustCleanup);
@@ -2091,8 +2153,11 @@ void TROOT::InitInterpreter()
                                    li->fHasCxxModule);
    }
    GetModuleHeaderInfoBuffer().clear();
+   GetStartupTimer().Mark("registering the dictionaries");
 
    fInterpreter->Initialize();
+   GetStartupTimer().Mark("initializing the interpreter");
+   GetStartupTimer().Report();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,52 @@
+#include "ROOT/RTracing.hxx"
+
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace {
+
+std::string ReadFile(const char *fileName)
+{
+   std::ifstream f(fileName);
+   std::stringstream content;
+   content << f.rdbuf();
+   return content.str();
+}
+
+} // anonymous namespace
+
+TEST(RTracing, ChromeTraceOutput)
+{
+   const char *fileName = "RTracing_ChromeTraceOutput.json";
+
+   {
+      ROOT::Internal::RTraceScope scope("not recorded", "test");
+   }
+
+   ROOT::EnableTracing(fileName);
+   EXPECT_TRUE(ROOT::IsTracingEnabled());
+   {
+      ROOT::Internal::RTraceScope scope("main \"thread\"", "test");
+   }
+   std::thread t([] { ROOT::Internal::RTraceScope scope("worker thread", "test"); });
+   t.join();
+   ROOT::DisableTracing();
+   EXPECT_FALSE(ROOT::IsTracingEnabled());
+
+   {
+      ROOT::Internal::RTraceScope scope("not recorded", "test");
+   }
+
+   const auto trace = ReadFile(fileName);
+   std::remove(fileName);
+
+   EXPECT_EQ(trace.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["), 0u);
+   EXPECT_NE(trace.find("\"name\":\"main \\\"thread\\\"\",\"cat\":\"test\",\"ph\":\"X\""), std::string::npos);
+   EXPECT_NE(trace.find("\"name\":\"worker thread\""), std::string::npos);
+   EXPECT_EQ(trace.find("not recorded"), std::string::npos);
+}
@@ -26,11 +26,21 @@
 
 class TClass;
 
+namespace ROOT {
+namespace Internal {
+class TClonesArrayArena;
+}
+}
+
 class TClonesArray : public TObjArray {
 
 protected:
    TClass       *fClass;       //!Pointer to the class of the elements
    TObjArray    *fKeep;        //!Saved copies of pointers to objects
+   ROOT::Internal::TClonesArrayArena *fArena = nullptr; //!Memory blocks of the objects constructed in bulk
+
+   void             ConstructObjects(Int_t n);
+   void             ReleaseMemory(TObject *obj);
 
 public:
    enum EStatusBits {
@@ -121,6 +121,14 @@ When investigating misuse of TClonesArray, please make sure of the following:
      TClonesArrays are not destroyed and created on every event. They
      must only be constructed/destructed at the beginning/end of the
      run.
+
+### NOTE 3
+
+When several objects are created at once (ExpandCreate(), ExpandCreateFast()
+and the reading of a TClonesArray, e.g. from a TTree branch) the memory of
+the new objects is allocated as one contiguous block instead of one
+allocation per object. Such objects are owned by the TClonesArray like all
+others and must never be deleted with operator delete.
 */
 
 #include "TClonesArray.h"
@@ -133,10 +141,71 @@ When investigating misuse of TClonesArray, please make sure of the following:
 #include "TObjectTable.h"
 #include "snprintf.h"
 
+#include <cstddef>
 #include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
 
 ClassImp(TClonesArray);
 
+namespace ROOT {
+namespace Internal {
+
+/// Memory blocks in which a TClonesArray constructed objects in bulk.
+/// The blocks are shared with the arrays that absorbed some of these objects,
+/// see TClonesArray::AbsorbObjects(), and freed when the last one is deleted.
+class TClonesArrayArena {
+   struct Block {
+      std::shared_ptr<char> fMemory;
+      size_t fSize;
+   };
+   std::vector<Block> fBlocks;
+
+   const Block *Find(const void *obj) const
+   {
+      auto addr = static_cast<const char *>(obj);
+      for (auto &block : fBlocks)
+         if (addr >= block.fMemory.get() && addr < block.fMemory.get() + block.fSize)
+            return &block;
+      return nullptr;
+   }
+
+public:
+   /// Return the size of the objects of class cl in the arena.
+   static size_t Stride(const TClass *cl)
+   {
+      constexpr size_t align = alignof(std::max_align_t);
+      return (cl->Size() + align - 1) / align * align;
+   }
+
+   /// Return a new zero-initialized block for n objects of class cl.
+   char *Allocate(const TClass *cl, Int_t n)
+   {
+      size_t size = Stride(cl) * n;
+      std::shared_ptr<char> mem(static_cast<char *>(::operator new(size)), [](char *p) { ::operator delete(p); });
+      // Avoid that TObject's constructor mistakes leftovers for a TStorage::ObjectAlloc pattern.
+      memset(mem.get(), 0, size);
+      fBlocks.push_back({mem, size});
+      return mem.get();
+   }
+
+   /// Return true if obj lives in one of the blocks.
+   Bool_t Contains(const TObject *obj) const { return obj && Find(obj); }
+
+   /// Share the block containing obj, which is part of the arena other.
+   void ShareBlockOf(const TClonesArrayArena &other, const TObject *obj)
+   {
+      if (Find(obj))
+         return;
+      if (auto block = other.Find(obj))
+         fBlocks.push_back(*block);
+   }
+};
+
+} // namespace Internal
+} // namespace ROOT
+
 // To allow backward compatibility of TClonesArray of v5 TF1 objects
 // that were stored member-wise.
 using Updater_t = void (*)(Int_t nobjects, TObject **from, TObject **to);
@@ -154,9 +223,13 @@ bool R__SetClonesArrayTFormulaUpdater(Updater_t func) {
 }
 
 /// Internal Utility routine to correctly release the memory for an object
-static inline void R__ReleaseMemory(TClass *cl, TObject *obj)
+static inline void R__ReleaseMemory(TClass *cl, TObject *obj, Bool_t inArena = kFALSE)
 {
-   if (obj && obj->TestBit(TObject::kNotDeleted)) {
+   if (inArena) {
+      // -- The memory belongs to the arena, only destruct.
+      if (obj->TestBit(TObject::kNotDeleted))
+         cl->Destructor(obj, kTRUE);
+   } else if (obj && obj->TestBit(TObject::kNotDeleted)) {
       // -- The TObject destructor has not been called.
       cl->Destructor(obj);
    } else {
@@ -247,7 +320,7 @@ TClonesArray& TClonesArray::operator=(const TClonesArray& tc)
 
    for (i = 0; i < fSize; i++)
       if (fKeep->fCont[i]) {
-         R__ReleaseMemory(fClass,fKeep->fCont[i]);
+         ReleaseMemory(fKeep->fCont[i]);
          fKeep->fCont[i] = nullptr;
          fCont[i] = nullptr;
       }
@@ -271,16 +344,61 @@ TClonesArray::~TClonesArray()
 {
    if (fKeep) {
       for (Int_t i = 0; i < fKeep->fSize; i++) {
-         R__ReleaseMemory(fClass,fKeep->fCont[i]);
+         ReleaseMemory(fKeep->fCont[i]);
          fKeep->fCont[i] = nullptr;
       }
    }
    SafeDelete(fKeep);
+   delete fArena;
 
    // Protect against erroneously setting of owner bit
    SetOwner(kFALSE);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Release the memory of obj, one of the objects owned by this array.
+
+void TClonesArray::ReleaseMemory(TObject *obj)
+{
+   R__ReleaseMemory(fClass, obj, fArena && fArena->Contains(obj));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Make sure the first n slots hold constructed objects.
+/// The memory of the objects that never had any is allocated as one block.
+
+void TClonesArray::ConstructObjects(Int_t n)
+{
+   Int_t nmissing = 0;
+   for (Int_t i = 0; i < n; i++)
+      if (!fKeep->fCont[i])
+         nmissing++;
+
+   char *mem = nullptr;
+   size_t stride = 0;
+   if (nmissing > 1) {
+      if (!fArena)
+         fArena = new ROOT::Internal::TClonesArrayArena;
+      mem = fArena->Allocate(fClass, nmissing);
+      stride = ROOT::Internal::TClonesArrayArena::Stride(fClass);
+   }
+
+   for (Int_t i = 0; i < n; i++) {
+      if (!fKeep->fCont[i]) {
+         if (mem) {
+            fKeep->fCont[i] = (TObject*)fClass->New(mem);
+            mem += stride;
+         } else {
+            fKeep->fCont[i] = (TObject*)fClass->New();
+         }
+      } else if (!fKeep->fCont[i]->TestBit(kNotDeleted)) {
+         // The object has been deleted (or never initialized)
+         fClass->New(fKeep->fCont[i]);
+      }
+      fCont[i] = fKeep->fCont[i];
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// When the kBypassStreamer bit is set, the automatically
 /// generated Streamer can call directly TClass::WriteBuffer.
@@ -482,7 +600,7 @@ void TClonesArray::Expand(Int_t newSize)
       // Expand() will shrink correctly
       for (int i = newSize; i < fSize; i++)
          if (fKeep->fCont[i]) {
-            R__ReleaseMemory(fClass,fKeep->fCont[i]);
+            ReleaseMemory(fKeep->fCont[i]);
             fKeep->fCont[i] = nullptr;
          }
    }
@@ -512,20 +630,11 @@ void TClonesArray::ExpandCreate(Int_t n)
    if (n > fSize)
       Expand(TMath::Max(n, GrowBy(fSize)));
 
-   Int_t i;
-   for (i = 0; i < n; i++) {
-      if (!fKeep->fCont[i]) {
-         fKeep->fCont[i] = (TObject*)fClass->New();
-      } else if (!fKeep->fCont[i]->TestBit(kNotDeleted)) {
-         // The object has been deleted (or never initialized)
-         fClass->New(fKeep->fCont[i]);
-      }
-      fCont[i] = fKeep->fCont[i];
-   }
+   ConstructObjects(n);
 
-   for (i = n; i < fSize; i++)
+   for (Int_t i = n; i < fSize; i++)
       if (fKeep->fCont[i]) {
-         R__ReleaseMemory(fClass,fKeep->fCont[i]);
+         ReleaseMemory(fKeep->fCont[i]);
          fKeep->fCont[i] = nullptr;
          fCont[i] = nullptr;
       }
@@ -545,20 +654,10 @@ void TClonesArray::ExpandCreate(Int_t n)
 
 void TClonesArray::ExpandCreateFast(Int_t n)
 {
-   Int_t oldSize = fKeep->GetSize();
    if (n > fSize)
       Expand(TMath::Max(n, GrowBy(fSize)));
 
-   Int_t i;
-   for (i = 0; i < n; i++) {
-      if (i >= oldSize || !fKeep->fCont[i]) {
-         fKeep->fCont[i] = (TObject*)fClass->New();
-      } else if (!fKeep->fCont[i]->TestBit(kNotDeleted)) {
-         // The object has been deleted (or never initialized)
-         fClass->New(fKeep->fCont[i]);
-      }
-      fCont[i] = fKeep->fCont[i];
-   }
+   ConstructObjects(n);
    if (fLast >= n) {
       memset(fCont + n, 0, (fLast - n + 1) * sizeof(TObject*));
    }
@@ -798,16 +897,7 @@ void TClonesArray::Streamer(TBuffer &b)
 
       //TStreamerInfo *sinfo = fClass->GetStreamerInfo(clv);
       if (CanBypassStreamer() && !b.TestBit(TBuffer::kCannotHandleMemberWiseStreaming)) {
-         for (Int_t i = 0; i < nobjects; i++) {
-            if (!fKeep->fCont[i]) {
-               fKeep->fCont[i] = (TObject*)fClass->New();
-            } else if (!fKeep->fCont[i]->TestBit(kNotDeleted)) {
-               // The object has been deleted (or never initialized)
-               fClass->New(fKeep->fCont[i]);
-            }
-
-            fCont[i] = fKeep->fCont[i];
-         }
+         ConstructObjects(nobjects);
          if (clv < 8 && classv == "TF1") {
             // To allow backward compatibility of TClonesArray of v5 TF1 objects
             // that were stored member-wise.
@@ -1022,8 +1112,14 @@ void TClonesArray::AbsorbObjects(TClonesArray *tc, Int_t idx1, Int_t idx2)
    for (Int_t i = idx1; i <= idx2; i++) {
       Int_t newindex = oldSize+i -idx1;
       fCont[newindex] = tc->fCont[i];
-      R__ReleaseMemory(fClass,fKeep->fCont[newindex]);
+      ReleaseMemory(fKeep->fCont[newindex]);
       (*fKeep)[newindex] = (*(tc->fKeep))[i];
+      if (tc->fArena && tc->fArena->Contains(tc->fKeep->fCont[i])) {
+         // Keep the memory of the absorbed object alive as long as we need it.
+         if (!fArena)
+            fArena = new ROOT::Internal::TClonesArrayArena;
+         fArena->ShareBlockOf(*tc->fArena, tc->fKeep->fCont[i]);
+      }
       tc->fCont[i] = 0;
       (*(tc->fKeep))[i] = 0;
    }
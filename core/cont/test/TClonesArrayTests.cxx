@@ -0,0 +1,40 @@
+#include "TClonesArray.h"
+#include "TNamed.h"
+
+#include "gtest/gtest.h"
+
+TEST(TClonesArray, BulkConstruction)
+{
+   TClonesArray arr("TNamed", 4);
+   arr.ExpandCreate(100);
+   ASSERT_EQ(100, arr.GetEntriesFast());
+   for (Int_t i = 0; i < 100; ++i) {
+      auto obj = static_cast<TNamed *>(arr.UncheckedAt(i));
+      ASSERT_NE(nullptr, obj);
+      EXPECT_TRUE(obj->TestBit(TObject::kNotDeleted));
+      obj->SetName(TString::Format("obj%d", i));
+   }
+
+   // Shrink, grow again (reusing and adding objects), then clear.
+   arr.ExpandCreateFast(10);
+   arr.ExpandCreateFast(300);
+   EXPECT_STREQ("obj7", arr.At(7)->GetName());
+   arr.Delete();
+   arr.ExpandCreate(50);
+   EXPECT_STREQ("", arr.At(7)->GetName());
+   arr.Clear("C");
+}
+
+TEST(TClonesArray, AbsorbBulkConstructed)
+{
+   TClonesArray to("TNamed");
+   {
+      TClonesArray from("TNamed");
+      from.ExpandCreate(20);
+      static_cast<TNamed *>(from.At(15))->SetName("fifteen");
+      to.AbsorbObjects(&from, 10, 19);
+      EXPECT_EQ(10, from.GetEntriesFast());
+   }
+   ASSERT_EQ(10, to.GetEntriesFast());
+   EXPECT_STREQ("fifteen", to.At(5)->GetName());
+}
@@ -80,6 +80,7 @@
 #include "llvm/ADT/StringRef.h"
 
 #include "llvm/Support/CommandLine.h"
+#include "llvm/Support/MemoryBuffer.h"
 #include "llvm/Support/Path.h"
 #include "llvm/Support/PrettyStackTrace.h"
 #include "llvm/Support/Signals.h"
@@ -2868,6 +2869,12 @@ void GenerateNecessaryIncludes(std::ostream &dictStream,
 ////////////////////////////////////////////////////////////////////////////////
 /// Little helper class to bookkeep the files names which we want to make
 /// temporary.
+///
+/// The outputs are written to the temporary files and renamed to their final
+/// name on commit. An existing output whose content did not change is left
+/// untouched, together with its modification time, such that an incremental
+/// build does not recompile an unchanged dictionary or rebuild what depends
+/// on the rootmap.
 
 class tempFileNamesCatalog {
 public:
@@ -2894,10 +2901,13 @@ public:
       m_tempNames.push_back(tmpNameStr);
       ROOT::TMetaUtils::Info(nullptr, "File %s added to the tmp catalog.\n", name);
 
-      // This is to allow update of existing files
-      if (0 == std::rename(name , tmpName)) {
+      // This is to allow update of existing files. The original is kept to
+      // compare it to the new content on commit.
+      const bool existing = llvm::sys::fs::exists(nameStr) && !llvm::sys::fs::copy_file(name, tmpName);
+      if (existing) {
          ROOT::TMetaUtils::Info(nullptr, "File %s existing. Preserved as %s.\n", name, tmpName);
       }
+      m_existing.push_back(existing);
 
       // To change the name to its tmp version
       nameStr = tmpNameStr;
@@ -2925,10 +2935,26 @@ public:
             ROOT::TMetaUtils::Error(nullptr, "Removing %s!\n", tmpName);
             retval++;
          }
+         // Do not leave an outdated output behind either
+         if (m_existing[i])
+            std::remove(m_names[i].c_str());
       }
       return retval;
    }
 
+   /////////////////////////////////////////////////////////////////////////////
+   /// Whether the temp file has the same content as the preserved original.
+
+   bool isUnchanged(unsigned int i) const {
+      if (!m_existing[i])
+         return false;
+      auto original = llvm::MemoryBuffer::getFile(m_names[i]);
+      auto updated = llvm::MemoryBuffer::getFile(m_tempNames[i]);
+      if (!original || !updated)
+         return false;
+      return (*original)->getBuffer() == (*updated)->getBuffer();
+   }
+
    /////////////////////////////////////////////////////////////////////////////
 
    int commit() {
@@ -2945,6 +2971,14 @@ public:
          // accessing it from a Linux VM via a shared folder
          if (ifile.is_open())
             ifile.close();
+         if (isUnchanged(i)) {
+            ROOT::TMetaUtils::Info(nullptr, "File %s unchanged, not updated.\n", name);
+            if (0 != std::remove(tmpName)) {
+               ROOT::TMetaUtils::Error(nullptr, "Removing %s!\n", tmpName);
+               retval++;
+            }
+            continue;
+         }
 #ifdef WIN32
          // Sometimes files cannot be renamed on Windows if they don't have
          // been released by the system. So just copy them and try to delete
@@ -2987,6 +3021,7 @@ private:
    const std::string m_emptyString;
    std::vector<std::string> m_names;
    std::vector<std::string> m_tempNames;
+   std::vector<bool> m_existing; ///< Whether the output existed before and was copied to its temp file
 };
 
 ////////////////////////////////////////////////////////////////////////////////
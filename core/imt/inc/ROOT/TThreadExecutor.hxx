@@ -130,6 +130,8 @@ namespace ROOT {
       void   ParallelFor(unsigned start, unsigned end, unsigned step, const std::function<void(unsigned int i)> &f);
       double ParallelReduce(const std::vector<double> &objs, const std::function<double(double a, double b)> &redfunc);
       float  ParallelReduce(const std::vector<float> &objs, const std::function<float(float a, float b)> &redfunc);
+      template<class T, class BINARYOP>
+      T ParallelTreeReduce(const std::vector<T> &objs, BINARYOP redfunc);
       template<class T, class R>
       auto SeqReduce(const std::vector<T> &objs, R redfunc) -> decltype(redfunc(objs));
 
@@ -585,7 +587,47 @@ namespace ROOT {
    {
       // check we can apply reduce to objs
       static_assert(std::is_same<decltype(redfunc(objs.front(), objs.front())), T>::value, "redfunc does not have the correct signature");
-      return ParallelReduce(objs, redfunc);
+      if constexpr (std::is_same<T, double>::value || std::is_same<T, float>::value)
+         return ParallelReduce(objs, redfunc);
+      else
+         return ParallelTreeReduce(objs, redfunc);
+   }
+
+   //////////////////////////////////////////////////////////////////////////
+   /// \brief "Reduce" an std::vector into a single object with a parallel reduction tree
+   ///
+   /// The elements are combined pairwise in parallel, then the partial results are combined
+   /// pairwise again, until a single object is left. The combinations of each level of the
+   /// tree run in parallel, hence the heavy reductions of large objects such as histograms are
+   /// not serialized. The order of the operands is kept, only the association changes.
+   ///
+   /// \param objs A vector of elements to combine.
+   /// \param redfunc Binary reduction function to combine the elements of the vector `objs`.
+   /// \return A value result of combining the vector elements into a single object of the same type.
+   template<class T, class BINARYOP>
+   T TThreadExecutor::ParallelTreeReduce(const std::vector<T> &objs, BINARYOP redfunc)
+   {
+      if (objs.empty())
+         return T{};
+      const unsigned n = objs.size();
+      if (n == 1)
+         return objs.front();
+
+      // First level of the tree, from the input elements
+      const unsigned nPartials = (n + 1) / 2;
+      std::vector<T> partials(nPartials);
+      ParallelFor(0U, nPartials, 1, [&objs, &redfunc, &partials, n](unsigned i) {
+         partials[i] = 2 * i + 1 < n ? redfunc(objs[2 * i], objs[2 * i + 1]) : objs[2 * i];
+      });
+
+      // Next levels, in place: at each level the partial result i is combined with i + stride
+      for (unsigned stride = 1; stride < nPartials; stride *= 2) {
+         ParallelFor(0U, nPartials, 2 * stride, [&partials, &redfunc, stride, nPartials](unsigned i) {
+            if (i + stride < nPartials)
+               partials[i] = redfunc(partials[i], partials[i + stride]);
+         });
+      }
+      return std::move(partials.front());
    }
 
    //////////////////////////////////////////////////////////////////////////
@@ -5,13 +5,18 @@
 #include "ROpaqueTaskArena.hxx"
 #include "TError.h"
 #include "TROOT.h"
+#include "TSystem.h"
 #include "TThread.h"
+#include <cstdlib>
 #include <fstream>
 #include <mutex>
 #include <thread>
 #include "tbb/task_arena.h"
 #define TBB_PREVIEW_GLOBAL_CONTROL 1 // required for TBB versions preceding 2019_U4
 #include "tbb/global_control.h"
+#if TBB_INTERFACE_VERSION >= 12010
+#include "tbb/info.h"
+#endif
 
 //////////////////////////////////////////////////////////////////////////
 ///
@@ -38,6 +43,15 @@
 /// root[] gTA->Access().max_concurrency() // call to tbb::task_arena::max_concurrency()
 /// ~~~
 ///
+/// #### NUMA nodes:
+/// On machines with several NUMA nodes, e.g. multi-socket nodes, the threads of the arena
+/// can migrate across the nodes and access remote memory. If the environment variable
+/// `ROOT_TBB_NUMA_NODE` is set to the index of a NUMA node, the arena is constrained to the
+/// cores of that node and its default number of threads is the number of cores of the node.
+/// This allows to run one process per NUMA node, each with its input files, instead of one
+/// process spread over all the nodes. It requires oneTBB built with the TBBBind library
+/// (hwloc), otherwise TBB does not report the NUMA topology and the variable has no effect.
+///
 //////////////////////////////////////////////////////////////////////////
 
 namespace ROOT {
@@ -65,6 +79,27 @@ int LogicalCPUBandwithControl()
    return std::thread::hardware_concurrency();
 }
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the index of the NUMA node set in the environment variable
+/// ROOT_TBB_NUMA_NODE, or -1 if it is not set or invalid.
+int NumaNodeFromEnv()
+{
+   const char *env = gSystem->Getenv("ROOT_TBB_NUMA_NODE");
+   if (!env || !env[0])
+      return -1;
+   char *end = nullptr;
+   const long node = std::strtol(env, &end, 10);
+   if (*end != '\0' || node < 0) {
+      Warning("RTaskArenaWrapper", "Ignoring invalid value \"%s\" of ROOT_TBB_NUMA_NODE", env);
+      return -1;
+   }
+   return static_cast<int>(node);
+}
+
+} // namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Initializes the tbb::task_arena within RTaskArenaWrapper.
 ///
@@ -72,10 +107,30 @@ int LogicalCPUBandwithControl()
 /// * Checks for CPU bandwidth control and avoids oversubscribing
 /// * If no BC in place and maxConcurrency<1, defaults to the default tbb number of threads,
 /// which is CPU affinity aware
+/// * If ROOT_TBB_NUMA_NODE is set, constrains the arena to the given NUMA node
 ////////////////////////////////////////////////////////////////////////////////
 RTaskArenaWrapper::RTaskArenaWrapper(unsigned maxConcurrency) : fTBBArena(new ROpaqueTaskArena{})
 {
-   const unsigned tbbDefaultNumberThreads = fTBBArena->max_concurrency(); // not initialized, automatic state
+   unsigned tbbDefaultNumberThreads = fTBBArena->max_concurrency(); // not initialized, automatic state
+
+#if TBB_INTERFACE_VERSION >= 12010
+   tbb::task_arena::constraints numaConstraints;
+   const int numaNode = NumaNodeFromEnv();
+   if (numaNode >= 0) {
+      const auto numaNodes = tbb::info::numa_nodes();
+      if (static_cast<std::size_t>(numaNode) < numaNodes.size()) {
+         numaConstraints.set_numa_id(numaNodes[numaNode]);
+         tbbDefaultNumberThreads = tbb::info::default_concurrency(numaConstraints);
+      } else {
+         Warning("RTaskArenaWrapper", "NUMA node %d requested but only %zu NUMA nodes are available, ignoring it",
+                 numaNode, numaNodes.size());
+      }
+   }
+#else
+   if (NumaNodeFromEnv() >= 0)
+      Warning("RTaskArenaWrapper", "ROOT_TBB_NUMA_NODE requires oneTBB 2021 or later, ignoring it");
+#endif
+
    maxConcurrency = maxConcurrency > 0 ? std::min(maxConcurrency, tbbDefaultNumberThreads) : tbbDefaultNumberThreads;
    const unsigned bcCpus = LogicalCPUBandwithControl();
    if (maxConcurrency > bcCpus) {
@@ -86,7 +141,12 @@ RTaskArenaWrapper::RTaskArenaWrapper(unsigned maxConcurrency) : fTBBArena(new RO
       Warning("RTaskArenaWrapper", "tbb::global_control is active, limiting the number of parallel workers"
                                    "from this task arena available for execution.");
    }
+#if TBB_INTERFACE_VERSION >= 12010
+   numaConstraints.set_max_concurrency(maxConcurrency);
+   fTBBArena->initialize(numaConstraints);
+#else
    fTBBArena->initialize(maxConcurrency);
+#endif
    fNWorkers = maxConcurrency;
    ROOT::EnableThreadSafety();
 }
@@ -12,6 +12,7 @@
 #include "RConfigure.h"
 
 #include "ROOT/TTaskGroup.hxx"
+#include "ROOT/RTracing.hxx"
 
 #ifdef R__USE_IMT
 #include "TROOT.h"
@@ -111,6 +112,13 @@ void TTaskGroup::Run(const std::function<void(void)> &closure)
    while (!fCanRun)
       /* empty */;
 
+   if (ROOT::IsTracingEnabled()) {
+      CastToTG(fTaskContainer)->run([closure] {
+         ROOT::Internal::RTraceScope traceScope("TTaskGroup task", "imt");
+         closure();
+      });
+      return;
+   }
    CastToTG(fTaskContainer)->run(closure);
 #else
    closure();
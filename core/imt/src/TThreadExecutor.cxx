@@ -3,6 +3,7 @@
 
 #include "ROOT/TThreadExecutor.hxx"
 #include "ROpaqueTaskArena.hxx"
+#include "ROOT/RTracing.hxx"
 #if !defined(_MSC_VER)
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wshadow"
@@ -167,6 +168,17 @@ void TThreadExecutor::ParallelFor(unsigned int start, unsigned int end, unsigned
               " Proceeding with %zu threads this time",
               tbb::global_control::active_value(tbb::global_control::max_allowed_parallelism));
    }
+   if (ROOT::IsTracingEnabled()) {
+      fTaskArenaW->Access().execute([&] {
+         tbb::this_task_arena::isolate([&] {
+            tbb::parallel_for(start, end, step, [&f](unsigned int i) {
+               ROOT::Internal::RTraceScope traceScope("TThreadExecutor task", "imt");
+               f(i);
+            });
+         });
+      });
+      return;
+   }
    fTaskArenaW->Access().execute([&] {
       tbb::this_task_arena::isolate([&] {
          tbb::parallel_for(start, end, step, f);
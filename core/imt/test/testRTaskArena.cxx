@@ -6,6 +6,7 @@
 #include "ROOT/TestSupport.hxx"
 
 #include <fstream>
+#include <string>
 #include <random>
 #include <thread>
 #include <chrono>
@@ -299,3 +300,21 @@ TEST(TThreadExecutor, TSeqActions)
 }
 
 #endif
+
+TEST(TThreadExecutor, BinaryReduceTree)
+{
+   ROOT::TThreadExecutor ttex;
+   // Non-commutative binary operation on a type without a dedicated parallel reduction:
+   // the tree reduction must keep the order of the operands.
+   auto concat = [](const std::string &a, const std::string &b) { return a + b; };
+   for (unsigned n : {1u, 2u, 3u, 7u, 8u, 33u}) {
+      std::vector<std::string> objs;
+      std::string expected;
+      for (unsigned i = 0; i < n; i++) {
+         objs.emplace_back(std::to_string(i) + ",");
+         expected += objs.back();
+      }
+      EXPECT_EQ(ttex.Reduce(objs, concat), expected);
+      EXPECT_EQ(ttex.MapReduce([](unsigned i) { return std::to_string(i) + ","; }, ROOT::TSeqU(n), concat, 3), expected);
+   }
+}
@@ -95,6 +95,7 @@ In order to access the name of a class within the ROOT type system, the method T
 #include <string>
 #include <map>
 #include <typeinfo>
+#include <unordered_map>
 #include <cmath>
 #include <cassert>
 #include <vector>
@@ -488,6 +489,73 @@ DeclIdMap_t *TClass::GetDeclIdMap() {
 #endif
 }
 
+namespace {
+
+/// Generation of the TClass::GetClass lookup caches: it is incremented whenever a TClass is
+/// removed from the list of classes, unloaded or deleted, which invalidates the caches of all
+/// the threads.
+std::atomic<ULong64_t> gGetClassCacheGeneration{0};
+
+////////////////////////////////////////////////////////////////////////////////
+/// Per-thread cache of the loaded TClass found by TClass::GetClass for a given key.
+/// Since each thread has its own cache, hits do not need to take any lock and the
+/// threads do not serialize on the global lock for the names that are not normalized,
+/// e.g. with a `std::` prefix or typedefs, nor for the type_info lookups.
+
+template <typename Key_t>
+class TGetClassCache {
+   std::unordered_map<Key_t, TClass *> fMap;
+   ULong64_t fGeneration = 0;
+
+   /// Bound the memory used by the cache when many different names are requested.
+   static constexpr std::size_t kMaxSize = 4096;
+
+public:
+   TClass *Find(const Key_t &key)
+   {
+      const auto generation = gGetClassCacheGeneration.load(std::memory_order_acquire);
+      if (generation != fGeneration) {
+         fMap.clear();
+         fGeneration = generation;
+         return nullptr;
+      }
+      auto res = fMap.find(key);
+      return res == fMap.end() ? nullptr : res->second;
+   }
+
+   /// Cache `cl` if it is loaded and no class was removed since the last call to Find.
+   /// The classes being unloaded must not be passed.
+   TClass *Insert(const Key_t &key, TClass *cl)
+   {
+      if (cl && cl->IsLoaded() &&
+          fGeneration == gGetClassCacheGeneration.load(std::memory_order_acquire)) {
+         if (fMap.size() >= kMaxSize)
+            fMap.clear();
+         fMap[key] = cl;
+      }
+      return cl;
+   }
+};
+
+TGetClassCache<std::string> &GetClassNameCache()
+{
+   thread_local TGetClassCache<std::string> cache;
+   return cache;
+}
+
+TGetClassCache<const char *> &GetClassTypeInfoCache()
+{
+   thread_local TGetClassCache<const char *> cache;
+   return cache;
+}
+
+void InvalidateGetClassCaches()
+{
+   gGetClassCacheGeneration.fetch_add(1, std::memory_order_acq_rel);
+}
+
+} // namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// static: Add a class to the list and map of classes.
 
@@ -522,6 +590,7 @@ void TClass::RemoveClass(TClass *oldcl)
    if (!oldcl) return;
 
    R__LOCKGUARD(gInterpreterMutex);
+   InvalidateGetClassCaches();
    gROOT->GetListOfClasses()->Remove(oldcl);
    if (oldcl->GetTypeInfo()) {
       GetIdMap()->Remove(oldcl->GetTypeInfo()->name());
@@ -1660,6 +1729,7 @@ void TClass::Init(const char *name, Version_t cversion,
 TClass::~TClass()
 {
    R__LOCKGUARD(gInterpreterMutex);
+   InvalidateGetClassCaches();
 
    // Remove from the typedef hashtables.
    if (fgClassTypedefHash && TestBit (kHasNameMapNode)) {
@@ -2990,6 +3060,14 @@ TClass *TClass::GetClass(const char *name, Bool_t load, Bool_t silent, size_t hi
    // long-ish normalization.
    if (cl && (cl->IsLoaded() || cl->TestBit(kUnloading))) return cl;
 
+   // The name is not the name of a loaded class, e.g. it is not normalized:
+   // check whether this thread already resolved it, without taking the lock.
+   auto &nameCache = GetClassNameCache();
+   if (!cl) {
+      if (TClass *cached = nameCache.Find(name))
+         return cached;
+   }
+
    R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
 
    // Now that we got the write lock, another thread may have constructed the
@@ -3039,7 +3117,7 @@ TClass *TClass::GetClass(const char *name, Bool_t load, Bool_t silent, size_t hi
       TClass *loadedcl = (dict)();
       if (loadedcl) {
          loadedcl->PostLoadCheck();
-         return loadedcl;
+         return nameCache.Insert(name, loadedcl);
       }
 
       // We should really not fall through to here, but if we do, let's just
@@ -3059,7 +3137,8 @@ TClass *TClass::GetClass(const char *name, Bool_t load, Bool_t silent, size_t hi
          cl = (TClass*)gROOT->GetListOfClasses()->FindObject(normalizedName.c_str());
 
          if (cl) {
-            if (cl->IsLoaded() || cl->TestBit(kUnloading)) return cl;
+            if (cl->TestBit(kUnloading)) return cl;
+            if (cl->IsLoaded()) return nameCache.Insert(name, cl);
 
             //we may pass here in case of a dummy class created by TVirtualStreamerInfo
             load = kTRUE;
@@ -3121,11 +3200,11 @@ TClass *TClass::GetClass(const char *name, Bool_t load, Bool_t silent, size_t hi
          }
       }
    }
-   if (loadedcl) return loadedcl;
+   if (loadedcl) return nameCache.Insert(name, loadedcl);
 
    // See if the TClassGenerator can produce the TClass we need.
    loadedcl = LoadClassCustom(normalizedName.c_str(),silent);
-   if (loadedcl) return loadedcl;
+   if (loadedcl) return nameCache.Insert(name, loadedcl);
 
    // We have not been able to find a loaded TClass, return the Emulated
    // TClass if we have one.
@@ -3245,12 +3324,17 @@ TClass *TClass::GetClass(const std::type_info& typeinfo, Bool_t load, Bool_t /*
    if (!gROOT->GetListOfClasses())
       return nullptr;
 
+   // Check whether this thread already found the class, without taking the lock.
+   auto &typeInfoCache = GetClassTypeInfoCache();
+   if (TClass *cached = typeInfoCache.Find(typeinfo.name()))
+      return cached;
+
    //protect access to TROOT::GetIdMap
    R__READ_LOCKGUARD(ROOT::gCoreMutex);
 
    TClass* cl = GetIdMap()->Find(typeinfo.name());
 
-   if (cl && cl->IsLoaded()) return cl;
+   if (cl && cl->IsLoaded()) return typeInfoCache.Insert(typeinfo.name(), cl);
 
    R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
 
@@ -3282,7 +3366,7 @@ TClass *TClass::GetClass(const std::type_info& typeinfo, Bool_t load, Bool_t /*
    if (dict) {
       cl = (dict)();
       if (cl) cl->PostLoadCheck();
-      return cl;
+      return typeInfoCache.Insert(typeinfo.name(), cl);
    }
    if (cl) return cl;
 
@@ -6302,6 +6386,7 @@ void TClass::SetUnloaded()
       return;
    }
    SetBit(kUnloading);
+   InvalidateGetClassCaches();
 
    //R__ASSERT(fState == kLoaded);
    if (fState != kLoaded) {
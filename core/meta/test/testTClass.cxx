@@ -4,6 +4,9 @@
 
 #include "gtest/gtest.h"
 
+#include <thread>
+#include <vector>
+
 TEST(TClass, DictCheck)
 {
    gInterpreter->ProcessLine(".L stlDictCheck.h+");
@@ -22,3 +25,25 @@ TEST(TClass, DictCheck)
 
    EXPECT_STREQ(errMsg.c_str(), "Missing dictionary for C, ") << errMsg;
 }
+
+TEST(TClass, GetClassCachedLookup)
+{
+   auto cl = TClass::GetClass("vector<int>");
+   ASSERT_NE(cl, nullptr);
+
+   // The names that are not normalized and the type_info lookups are cached per thread:
+   // repeated and concurrent lookups have to return the same TClass.
+   auto check = [cl]() {
+      for (int i = 0; i < 10; i++) {
+         EXPECT_EQ(TClass::GetClass("std::vector<int>"), cl);
+         EXPECT_EQ(TClass::GetClass("vector<int,allocator<int> >"), cl);
+         EXPECT_EQ(TClass::GetClass(typeid(std::vector<int>)), cl);
+      }
+   };
+   check();
+   std::vector<std::thread> threads;
+   for (int i = 0; i < 4; i++)
+      threads.emplace_back(check);
+   for (auto &t : threads)
+      t.join();
+}
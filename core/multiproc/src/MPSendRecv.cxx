@@ -38,6 +38,31 @@ int MPSend(TSocket *s, unsigned code)
 }
 
 
+//////////////////////////////////////////////////////////////////////////
+/// Send a message with the specified code and an already serialized object.
+/// The header with the code and the size is sent first, followed by the
+/// buffer itself, so that large objects such as histograms or trees are not
+/// copied once more into the message buffer. The message can be retrieved
+/// with MPRecv() like the ones sent by MPSend().
+/// \param s a pointer to a valid TSocket. No validity checks are performed\n
+/// \param code the code to be sent
+/// \param buf the serialized object, can be null if len is 0
+/// \param len the size of the serialized object
+/// \return the number of bytes sent, as per TSocket::SendRaw, or a negative value in case of error
+int MPSendBuffer(TSocket *s, unsigned code, const char *buf, ULong_t len)
+{
+   TBufferFile wBuf(TBuffer::kWrite);
+   wBuf.WriteUInt(code);
+   wBuf.WriteULong(len);
+   int nBytes = s->SendRaw(wBuf.Buffer(), wBuf.Length());
+   if (nBytes < 0 || len == 0)
+      return nBytes;
+   int nObjBytes = s->SendRaw(buf, len);
+   if (nObjBytes < 0)
+      return nObjBytes;
+   return nBytes + nObjBytes;
+}
+
 //////////////////////////////////////////////////////////////////////////
 /// Receive message from a socket.
 /// This standalone function can be used to read a message that
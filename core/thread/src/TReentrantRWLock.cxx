@@ -32,6 +32,7 @@ thus preventing starvation.
 */
 
 #include "TReentrantRWLock.hxx"
+#include "ROOT/RTracing.hxx"
 #include "ROOT/TSpinMutex.hxx"
 #include "TMutex.h"
 #include "TError.h"
@@ -69,8 +70,6 @@ Internal::UniqueLockRecurseCount::UniqueLockRecurseCount()
 template <typename MutexT, typename RecurseCountsT>
 TVirtualRWMutex::Hint_t *TReentrantRWLock<MutexT, RecurseCountsT>::ReadLock()
 {
-   ++fReaderReservation;
-
    // if (fReaders == std::numeric_limits<decltype(fReaders)>::max()) {
    //    ::Fatal("TRWSpinLock::WriteLock", "Too many recursions in TRWSpinLock!");
    // }
@@ -79,30 +78,35 @@ TVirtualRWMutex::Hint_t *TReentrantRWLock<MutexT, RecurseCountsT>::ReadLock()
 
    TVirtualRWMutex::Hint_t *hint = nullptr;
 
+   // Optimistically register as a reader: a single atomic increment on the
+   // fast path. A writer sets fWriter before waiting for fReaders to drop to
+   // zero, so (both being sequentially consistent) either it sees this reader
+   // or this reader sees fWriter and backs off below.
+   ++fReaders;
+
    if (!fWriter) {
       // There is no writer, go freely to the critical section
-      ++fReaders;
-      --fReaderReservation;
-
       hint = fRecurseCounts.IncrementReadCount(local, fMutex);
 
    } else if (fRecurseCounts.IsCurrentWriter(local)) {
 
-      --fReaderReservation;
       // This can run concurrently with another thread trying to get
       // the read lock and ending up in the next section ("Wait for writers, if any")
       // which need to also get the local readers count and thus can
       // modify the map.
       hint = fRecurseCounts.IncrementReadCount(local, fMutex);
-      ++fReaders;
 
    } else {
       // A writer claimed the RW lock, we will need to wait on the
       // internal lock
-      --fReaderReservation;
-
+      ROOT::Internal::RTraceScope traceScope("TReentrantRWLock::ReadLock wait", "lock");
       std::unique_lock<MutexT> lock(fMutex);
 
+      // Withdraw the optimistic registration and wake up the writer in case
+      // it is waiting for the readers to go away.
+      --fReaders;
+      fCond.notify_all();
+
       // Wait for writers, if any
       if (fWriter && fRecurseCounts.IsNotCurrentWriter(local)) {
          auto readerCount = fRecurseCounts.GetLocalReadersCount(local);
@@ -168,6 +172,8 @@ void TReentrantRWLock<MutexT, RecurseCountsT>::ReadUnLock(TVirtualRWMutex::Hint_
 template <typename MutexT, typename RecurseCountsT>
 TVirtualRWMutex::Hint_t *TReentrantRWLock<MutexT, RecurseCountsT>::WriteLock()
 {
+   ROOT::Internal::RTraceScope traceScope("TReentrantRWLock::WriteLock", "lock");
+
    ++fWriterReservation;
 
    std::unique_lock<MutexT> lock(fMutex);
@@ -194,11 +200,8 @@ TVirtualRWMutex::Hint_t *TReentrantRWLock<MutexT, RecurseCountsT>::WriteLock()
    fWriter = true;
    fRecurseCounts.SetIsWriter(local);
 
-   // Wait until all reader reservations finish
-   while (fReaderReservation) {
-   };
-
-   // Wait for remaining readers
+   // Wait for remaining readers; readers that registered optimistically
+   // after fWriter was set back off and notify us in ReadLock.
    fCond.wait(lock, [this] { return fReaders == 0; });
 
    // Restore this thread's reader lock(s)
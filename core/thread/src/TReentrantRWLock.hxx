@@ -280,7 +280,6 @@ class TReentrantRWLock {
 private:
 
    std::atomic<int> fReaders;           ///<! Number of readers
-   std::atomic<int> fReaderReservation; ///<! A reader wants access
    std::atomic<int> fWriterReservation; ///<! A writer wants access
    std::atomic<bool> fWriter;           ///<! Is there a writer?
    MutexT fMutex;                       ///<! RWlock internal mutex
@@ -301,7 +300,7 @@ public:
 
    ////////////////////////////////////////////////////////////////////////
    /// Regular constructor.
-   TReentrantRWLock() : fReaders(0), fReaderReservation(0), fWriterReservation(0), fWriter(false) {}
+   TReentrantRWLock() : fReaders(0), fWriterReservation(0), fWriter(false) {}
 
    TVirtualRWMutex::Hint_t *ReadLock();
    void ReadUnLock(TVirtualRWMutex::Hint_t *);
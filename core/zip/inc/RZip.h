@@ -23,6 +23,30 @@ extern "C" unsigned long R__memcompress(char *tgt, unsigned long tgtsize, char *
 
 extern "C" void R__zipMultipleAlgorithm(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep, ROOT::RCompressionSetting::EAlgorithm::EValues);
 
+/**
+ * Same as R__zipMultipleAlgorithm, but the ZSTD algorithm uses the dictionary registered with the id `zstddictid`
+ * (see R__ZSTDRegisterDictionary).  The other algorithms, and a null id, ignore the dictionary.
+ */
+extern "C" void R__zipMultipleAlgorithmDict(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep, ROOT::RCompressionSetting::EAlgorithm::EValues, unsigned int zstddictid);
+
+/**
+ * Register a ZSTD dictionary for the process and return its id, 0 on error.  Buffers compressed with a dictionary
+ * record its id and R__unzip decompresses them as long as the dictionary is registered.  Registered dictionaries
+ * are kept until the end of the process.
+ */
+extern "C" unsigned int R__ZSTDRegisterDictionary(const char *dict, int dictsize);
+
+/**
+ * Return the content of a registered ZSTD dictionary, nullptr if no dictionary with this id is registered.
+ */
+extern "C" const char *R__ZSTDGetDictionary(unsigned int dictid, int *dictsize);
+
+/**
+ * Train a ZSTD dictionary of at most `dictcapacity` bytes from `nsamples` samples stored one after the other in
+ * `samples`.  Return the size of the dictionary, 0 on error.
+ */
+extern "C" int R__ZSTDTrainDictionary(char *dict, int dictcapacity, const char *samples, const int *samplesizes, int nsamples);
+
 /**
  * This is a historical definition, prior to ROOT supporting multiple algorithms in a single file.  Use
  * R__zipMultipleAlgorithm instead.
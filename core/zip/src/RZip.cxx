@@ -77,6 +77,12 @@ unsigned long R__crc32(unsigned long crc, const unsigned char* buf, unsigned int
 /*                      2 = lzma */
 /*                      3 = old */
 void R__zipMultipleAlgorithm(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep, ROOT::RCompressionSetting::EAlgorithm::EValues compressionAlgorithm)
+{
+  R__zipMultipleAlgorithmDict(cxlevel, srcsize, src, tgtsize, tgt, irep, compressionAlgorithm, 0);
+}
+
+/* zstddictid: id of the dictionary used by the ZSTD algorithm, 0 for none */
+void R__zipMultipleAlgorithmDict(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep, ROOT::RCompressionSetting::EAlgorithm::EValues compressionAlgorithm, unsigned int zstddictid)
 {
 
   if (*srcsize < 1 + HDRSIZE + 1) {
@@ -99,7 +105,7 @@ void R__zipMultipleAlgorithm(int cxlevel, int *srcsize, char *src, int *tgtsize,
   } else if (compressionAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kLZ4) {
      R__zipLZ4(cxlevel, srcsize, src, tgtsize, tgt, irep);
   } else if (compressionAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kZSTD) {
-     R__zipZSTD(cxlevel, srcsize, src, tgtsize, tgt, irep);
+     R__zipZSTDDict(cxlevel, srcsize, src, tgtsize, tgt, irep, zstddictid);
   } else if (compressionAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kOldCompressionAlgo || compressionAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kUseGlobal) {
      R__zipOld(cxlevel, srcsize, src, tgtsize, tgt, irep);
   } else {
@@ -16,7 +16,12 @@
 extern "C" {
 #endif
 void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep);
+void R__zipZSTDDict(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep, unsigned int dictid);
 void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char *tgt, int *irep);
+// Dictionary support, see RZip.h.
+unsigned int R__ZSTDRegisterDictionary(const char *dict, int dictsize);
+const char *R__ZSTDGetDictionary(unsigned int dictid, int *dictsize);
+int R__ZSTDTrainDictionary(char *dict, int dictcapacity, const char *samples, const int *samplesizes, int nsamples);
 #ifdef __cplusplus
 }
 #endif
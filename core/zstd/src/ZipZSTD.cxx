@@ -14,7 +14,13 @@
 
 #include "zdict.h"
 #include <zstd.h>
+#include <cstring>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <iostream>
 
@@ -22,17 +28,95 @@ static const int kHeaderSize = 9;
 
 static const size_t errorCodeSmallBuffer = (size_t)-70;
 
+namespace {
+
+/// A dictionary registered with R__ZSTDRegisterDictionary, with its digested forms.
+/// Registered dictionaries are kept until the end of the process: any buffer
+/// compressed with them can be read as long as the dictionary id is known.
+struct ZSTDDictionary {
+   std::string fBuffer;                  ///< Content of the dictionary
+   ZSTD_DDict *fDDict = nullptr;         ///< Digested dictionary for decompression
+   std::map<int, ZSTD_CDict *> fCDicts; ///< Digested dictionaries for compression, by compression level
+
+   ~ZSTDDictionary()
+   {
+      ZSTD_freeDDict(fDDict);
+      for (auto &cdict : fCDicts)
+         ZSTD_freeCDict(cdict.second);
+   }
+};
+
+struct ZSTDDictionaryRegistry {
+   std::mutex fMutex;
+   std::unordered_map<unsigned int, std::unique_ptr<ZSTDDictionary>> fDictionaries;
+};
+
+ZSTDDictionaryRegistry &GetDictionaryRegistry()
+{
+   static ZSTDDictionaryRegistry registry;
+   return registry;
+}
+
+ZSTDDictionary *FindDictionary(ZSTDDictionaryRegistry &registry, unsigned int dictid)
+{
+   auto iter = registry.fDictionaries.find(dictid);
+   return iter == registry.fDictionaries.end() ? nullptr : iter->second.get();
+}
+
+/// Return the dictionary `dictid` digested for compression level `level`, nullptr if it is not registered.
+const ZSTD_CDict *GetCDict(unsigned int dictid, int level)
+{
+   auto &registry = GetDictionaryRegistry();
+   std::lock_guard<std::mutex> lock(registry.fMutex);
+   auto dict = FindDictionary(registry, dictid);
+   if (!dict)
+      return nullptr;
+   auto &cdict = dict->fCDicts[level];
+   if (!cdict)
+      cdict = ZSTD_createCDict(dict->fBuffer.data(), dict->fBuffer.size(), level);
+   return cdict;
+}
+
+/// Return the dictionary `dictid` digested for decompression, nullptr if it is not registered.
+const ZSTD_DDict *GetDDict(unsigned int dictid)
+{
+   auto &registry = GetDictionaryRegistry();
+   std::lock_guard<std::mutex> lock(registry.fMutex);
+   auto dict = FindDictionary(registry, dictid);
+   return dict ? dict->fDDict : nullptr;
+}
+
+} // anonymous namespace
+
 void R__zipZSTD(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep)
+{
+   R__zipZSTDDict(cxlevel, srcsize, src, tgtsize, tgt, irep, 0);
+}
+
+void R__zipZSTDDict(int cxlevel, int *srcsize, char *src, int *tgtsize, char *tgt, int *irep, unsigned int dictid)
 {
     using Ctx_ptr = std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)>;
     Ctx_ptr fCtx{ZSTD_createCCtx(), &ZSTD_freeCCtx};
 
     *irep = 0;
 
-    size_t retval = ZSTD_compressCCtx(fCtx.get(),
-                                        &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
-                                        src, static_cast<size_t>(*srcsize),
-                                        2*cxlevel);
+    const ZSTD_CDict *cdict = nullptr;
+    if (dictid) {
+       cdict = GetCDict(dictid, 2*cxlevel);
+       if (R__unlikely(!cdict)) {
+          std::cerr << "Error in zip ZSTD. Dictionary " << dictid << " is not registered." << std::endl;
+          return;
+       }
+    }
+
+    size_t retval = cdict ? ZSTD_compress_usingCDict(fCtx.get(),
+                                                     &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
+                                                     src, static_cast<size_t>(*srcsize),
+                                                     cdict)
+                          : ZSTD_compressCCtx(fCtx.get(),
+                                              &tgt[kHeaderSize], static_cast<size_t>(*tgtsize - kHeaderSize),
+                                              src, static_cast<size_t>(*srcsize),
+                                              2*cxlevel);
 
     if (R__unlikely(ZSTD_isError(retval))) {
         if (R__unlikely(retval != errorCodeSmallBuffer)) {
@@ -77,9 +161,25 @@ void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char
       return;
     }
 
-    size_t retval = ZSTD_decompressDCtx(fCtx.get(),
-                                        (char *)tgt, static_cast<size_t>(*tgtsize),
-                                        (char *)&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize));
+    // Frames compressed with a dictionary record its id.
+    const ZSTD_DDict *ddict = nullptr;
+    unsigned int dictid = ZSTD_getDictID_fromFrame(&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize));
+    if (dictid) {
+       ddict = GetDDict(dictid);
+       if (R__unlikely(!ddict)) {
+          std::cerr << "R__unzipZSTD: the buffer was compressed with the dictionary " << dictid <<
+          " which is not registered." << std::endl;
+          return;
+       }
+    }
+
+    size_t retval = ddict ? ZSTD_decompress_usingDDict(fCtx.get(),
+                                                       (char *)tgt, static_cast<size_t>(*tgtsize),
+                                                       (char *)&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize),
+                                                       ddict)
+                          : ZSTD_decompressDCtx(fCtx.get(),
+                                                (char *)tgt, static_cast<size_t>(*tgtsize),
+                                                (char *)&src[kHeaderSize], static_cast<size_t>(*srcsize - kHeaderSize));
 
     /* The error code 18446744073709551546 arises when the tgt buffer is too small
      * However this error is already handled outside of the compression algorithm
@@ -95,3 +195,57 @@ void R__unzipZSTD(int *srcsize, unsigned char *src, int *tgtsize, unsigned char
         *irep = retval;
     }
 }
+
+unsigned int R__ZSTDRegisterDictionary(const char *dict, int dictsize)
+{
+   if (!dict || dictsize <= 0)
+      return 0;
+   unsigned int dictid = ZDICT_getDictID(dict, static_cast<size_t>(dictsize));
+   if (!dictid) {
+      std::cerr << "R__ZSTDRegisterDictionary: only dictionaries in the zstd format, which carry an id, are supported."
+                << std::endl;
+      return 0;
+   }
+
+   auto &registry = GetDictionaryRegistry();
+   std::lock_guard<std::mutex> lock(registry.fMutex);
+   if (auto known = FindDictionary(registry, dictid)) {
+      if (known->fBuffer.size() == static_cast<size_t>(dictsize) && !memcmp(known->fBuffer.data(), dict, dictsize))
+         return dictid;
+      std::cerr << "R__ZSTDRegisterDictionary: a different dictionary with id " << dictid << " is already registered."
+                << std::endl;
+      return 0;
+   }
+   auto entry = std::make_unique<ZSTDDictionary>();
+   entry->fBuffer.assign(dict, dictsize);
+   entry->fDDict = ZSTD_createDDict(entry->fBuffer.data(), entry->fBuffer.size());
+   if (!entry->fDDict) {
+      std::cerr << "R__ZSTDRegisterDictionary: invalid dictionary " << dictid << "." << std::endl;
+      return 0;
+   }
+   registry.fDictionaries[dictid] = std::move(entry);
+   return dictid;
+}
+
+const char *R__ZSTDGetDictionary(unsigned int dictid, int *dictsize)
+{
+   auto &registry = GetDictionaryRegistry();
+   std::lock_guard<std::mutex> lock(registry.fMutex);
+   auto dict = FindDictionary(registry, dictid);
+   *dictsize = dict ? static_cast<int>(dict->fBuffer.size()) : 0;
+   return dict ? dict->fBuffer.data() : nullptr;
+}
+
+int R__ZSTDTrainDictionary(char *dict, int dictcapacity, const char *samples, const int *samplesizes, int nsamples)
+{
+   if (nsamples <= 0)
+      return 0;
+   std::vector<size_t> sizes(samplesizes, samplesizes + nsamples);
+   size_t retval = ZDICT_trainFromBuffer(dict, static_cast<size_t>(dictcapacity), samples, sizes.data(),
+                                         static_cast<unsigned>(nsamples));
+   if (ZDICT_isError(retval)) {
+      std::cerr << "R__ZSTDTrainDictionary: " << ZDICT_getErrorName(retval) << std::endl;
+      return 0;
+   }
+   return static_cast<int>(retval);
+}
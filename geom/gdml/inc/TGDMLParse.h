@@ -19,6 +19,7 @@
 #include "TGeoElement.h"
 
 #include <map>
+#include <memory>
 #include <iostream>
 
 class TGDMLMatrix;
@@ -220,6 +221,7 @@ private:
    FileMap ffilemap;              //!Map containing files parsed during entire parsing, with their world volume name
    ConstMap fconsts;              //!Map containing values of constants declared in the file
    MatrixMap fmatrices;           //!Map containing matrices defined in the GDML file
+   mutable std::map<std::string, std::unique_ptr<TFormula>> fformulas; //!Formulas of the expressions evaluated by Value()
 
    ClassDef(TGDMLParse, 0)    //imports GDML using DOM and binds it to ROOT
 };
@@ -766,6 +766,24 @@ Double_t TGDMLParse::Value(const char *svalue) const
    if (*end == 0)
       return val;
 
+   // A plain reference to a constant, no need for a formula.
+   {
+      const char *b = svalue;
+      while (isspace(*b))
+         ++b;
+      const char *e = b;
+      while (*e != 0 && (isalnum(*e) || *e == '_'))
+         ++e;
+      const char *t = e;
+      while (*t != 0 && isspace(*t))
+         ++t;
+      if (*t == 0 && e > b && (isalpha(*b) || *b == '_')) {
+         auto it = fconsts.find(std::string(b, e));
+         if (it != fconsts.end())
+            return it->second;
+      }
+   }
+
    // Otherwise we'll use TFormula to evaluate the string, having first found
    // all the GDML variable names in it and marked them with [] so that
    // TFormula will recognize them as parameters.
@@ -813,13 +831,19 @@ Double_t TGDMLParse::Value(const char *svalue) const
       }
    } // end loop over svalue
 
-   TFormula f("TFormula", expanded.c_str());
+   // Large geometries repeat the same expressions many times: keep the
+   // formulas, only their parameters change with the constants.
+   auto &f = fformulas[expanded];
+   if (!f)
+      f = std::make_unique<TFormula>("TFormula", expanded.c_str(), false, false);
 
-   // Tell the TFormula about every parameter we know about
-   for (auto &it : fconsts)
-      f.SetParameter(it.first.c_str(), it.second);
+   // Tell the TFormula about the value of each of its parameters
+   for (Int_t i = 0; i < f->GetNpar(); ++i) {
+      auto it = fconsts.find(f->GetParName(i));
+      f->SetParameter(i, it != fconsts.end() ? it->second : 0.);
+   }
 
-   val = f.Eval(0);
+   val = f->Eval(0);
 
    if (std::isnan(val) || std::isinf(val)) {
       Fatal("Value", "Got bad value %lf from string '%s'", val, svalue);
@@ -0,0 +1,62 @@
+// @(#)root/geom:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TGeoBVHVoxelFinder
+#define ROOT_TGeoBVHVoxelFinder
+
+#include "TGeoVoxelFinder.h"
+
+#include <vector>
+
+class TGeoBVHVoxelFinder : public TGeoVoxelFinder
+{
+public:
+   /// Node of the flattened hierarchy. The first child of an inner node follows it in the
+   /// node array, so that a depth-first traversal reads the array mostly sequentially.
+   struct Node_t {
+      Float_t  fMin[3];   // Lower corner of the node bounding box, rounded outwards
+      Float_t  fMax[3];   // Upper corner of the node bounding box, rounded outwards
+      Int_t    fFirst;    // Index of the second child for inner nodes, of the first entry in fIndices for leaves
+      Int_t    fCount;    // Number of daughters for leaves, 0 for inner nodes
+   };
+
+private:
+   TGeoBVHVoxelFinder(const TGeoBVHVoxelFinder&) = delete;
+   TGeoBVHVoxelFinder& operator=(const TGeoBVHVoxelFinder&) = delete;
+
+protected:
+   std::vector<Node_t> fNodes;     //! Flattened bounding volume hierarchy over the daughter boxes
+   std::vector<Int_t>  fIndices;   //! Daughter indices ordered by the hierarchy leaves
+   Int_t               fDepth;     //! Depth of the hierarchy
+
+   void                BuildHierarchy();
+   Int_t               BuildNode(Int_t first, Int_t count, Int_t depth);
+   void                CheckHierarchy() const;
+   Bool_t              InsideBox(Int_t inode, const Double_t *point) const;
+
+public :
+   TGeoBVHVoxelFinder();
+   TGeoBVHVoxelFinder(TGeoVolume *vol);
+   virtual ~TGeoBVHVoxelFinder();
+
+   virtual Double_t    Efficiency();
+   virtual Int_t      *GetCheckList(const Double_t *point, Int_t &nelem, TGeoStateInfo &td);
+   virtual Int_t      *GetNextCandidates(const Double_t *point, Int_t &ncheck, TGeoStateInfo &td);
+   Int_t               GetNnodes() const {return fNodes.size();}
+   const Node_t       *GetNodes() const {return fNodes.data();}
+   virtual Int_t      *GetNextVoxel(const Double_t *point, const Double_t *dir, Int_t &ncheck, TGeoStateInfo &td);
+   virtual void        Print(Option_t *option="") const;
+   virtual void        SortCrossedVoxels(const Double_t *point, const Double_t *dir, TGeoStateInfo &td);
+   virtual void        Voxelize(Option_t *option="");
+
+   ClassDef(TGeoBVHVoxelFinder, 1)             // voxel finder using a bounding volume hierarchy
+};
+
+#endif
@@ -116,9 +116,28 @@ private:
    std::vector<Vertex_t> fVertices; // List of vertices
    std::vector<TGeoFacet> fFacets;  // List of facets
 
+   /// Node of the bounding volume hierarchy over the facets
+   struct BVHNode_t {
+      double fMin[3]; // Lower corner of the node bounding box
+      double fMax[3]; // Upper corner of the node bounding box
+      int fFirst;     // Index of the second child node (the first one follows the node), or of the first facet in fBVHFacets for leaves
+      int fCount;     // Number of facets for leaves, 0 for inner nodes
+   };
+
+   std::vector<Vertex_t> fNormals;  //! Outward normals of the facets, used for navigation
+   std::vector<BVHNode_t> fBVH;     //! Bounding volume hierarchy over the facets, built for closed bodies
+   std::vector<int> fBVHFacets;     //! Facet indices ordered by the BVH leaves
+
    TGeoTessellated(const TGeoTessellated&) = delete;
    TGeoTessellated& operator=(const TGeoTessellated&) = delete;
 
+   void BuildBVH();
+   int BuildBVHNode(int first, int count, const std::vector<double> &fbox);
+   bool IntersectFacet(int ifacet, const double *point, const double *dir, double &dist) const;
+   double FacetSafety2(int ifacet, const double *point) const;
+   int FindNextFacet(const double *point, const double *dir, int sense, double stepmax, double &dist) const;
+   int FindNearestFacet(const double *point, double &safety) const;
+
 public:
    // constructors
    TGeoTessellated() {}
@@ -145,6 +164,13 @@ public:
    const Vertex_t &GetVertex(int i) { return fVertices[i]; }
 
    virtual void AfterStreamer();
+   virtual void ComputeNormal(const double *point, const double *dir, double *norm);
+   virtual Bool_t Contains(const double *point) const;
+   virtual double DistFromInside(const double *point, const double *dir, int iact = 1,
+                                 double step = TGeoShape::Big(), double *safe = nullptr) const;
+   virtual double DistFromOutside(const double *point, const double *dir, int iact = 1,
+                                  double step = TGeoShape::Big(), double *safe = nullptr) const;
+   virtual double Safety(const double *point, Bool_t in = kTRUE) const;
    virtual int DistancetoPrimitive(int, int) { return 99999; }
    virtual const TBuffer3D &GetBuffer3D(int reqSections, Bool_t localFrame) const;
    virtual void GetMeshNumbers(int &nvert, int &nsegs, int &npols) const;
@@ -212,6 +212,7 @@ public:
    void            SetReplicated() {TObject::SetBit(kVolumeReplicated);}
    void            SetCurrentPoint(Double_t x, Double_t y, Double_t z);
    void            SetCylVoxels(Bool_t flag=kTRUE) {TObject::SetBit(kVoxelsCyl, flag); TObject::SetBit(kVoxelsXYZ, !flag);}
+   void            SetBVHVoxels(Bool_t flag=kTRUE);
    void            SetNodes(TObjArray *nodes) {fNodes = nodes; TObject::SetBit(kVolumeImportNodes);}
    void            SetOverlappingCandidate(Bool_t flag) {TObject::SetBit(kVolumeOC,flag);}
    void            SetShape(const TGeoShape *shape);
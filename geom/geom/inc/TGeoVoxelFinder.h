@@ -104,6 +104,7 @@ public :
    Bool_t              IsInvalid() const {return TObject::TestBit(kGeoInvalidVoxels);}
    Bool_t              NeedRebuild() const {return TObject::TestBit(kGeoRebuildVoxels);}
    Double_t           *GetBoxes() const {return fBoxes;}
+   Double_t            GetMeanCandidates() const;
    Bool_t              IsSafeVoxel(const Double_t *point, Int_t inode, Double_t minsafe) const;
    virtual void        Print(Option_t *option="") const;
    void                PrintVoxelLimits(const Double_t *point) const;
@@ -0,0 +1,485 @@
+// @(#)root/geom:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+/** \class TGeoBVHVoxelFinder
+\ingroup Geometry_classes
+
+Voxel finder partitioning the daughters of a volume with a bounding volume
+hierarchy (BVH) over their bounding boxes, as an alternative to the regular
+slices of TGeoVoxelFinder.
+
+The slices of TGeoVoxelFinder work well for daughters aligned along the axes,
+but for thousands of irregularly placed daughters, as detector modules tilted
+around a barrel, the candidate lists of the voxels stay long. The hierarchy is
+built top-down by splitting the daughters with the surface area heuristic
+(SAH), so that the number of candidates checked for a point or a ray is close
+to the number of boxes it actually touches.
+
+The nodes are stored in a flat array in depth-first order, the first child of
+an inner node following its parent, with single precision bounding boxes
+rounded outwards (32 bytes per node). Only the leaves refer to the daughter
+boxes of TGeoVoxelFinder, which are kept in double precision.
+
+The navigation interface is the one of TGeoVoxelFinder: GetCheckList() returns
+the daughters whose box contains the point, SortCrossedVoxels() collects the
+daughters whose box is crossed by the ray, nearest nodes first, and the first
+call to GetNextVoxel() returns them all. The hierarchy is not streamed: it is
+rebuilt when first used after reading the geometry.
+
+The finder is selected for a volume with TGeoVolume::SetBVHVoxels(), with the
+option "bvh" of TGeoVolume::Voxelize(), or automatically for the volumes whose
+regular voxels would keep on average more candidates than the threshold set
+with TGeoManager::SetBVHVoxelsThreshold().
+*/
+
+#include "TGeoBVHVoxelFinder.h"
+
+#include "TMath.h"
+#include "TGeoShape.h"
+#include "TGeoNode.h"
+#include "TGeoVolume.h"
+#include "TGeoStateInfo.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+
+constexpr Int_t kBVHBins = 16;      // Number of bins used to evaluate the SAH splits on each axis
+constexpr Int_t kBVHMaxDepth = 62;  // Maximum depth of the hierarchy
+constexpr Int_t kBVHStackSize = 64; // Traversal stack size, larger than the maximum depth
+
+////////////////////////////////////////////////////////////////////////////////
+/// Largest float not above val
+
+Float_t RoundDown(Double_t val)
+{
+   Float_t f = (Float_t)val;
+   if (f > val) f = std::nextafter(f, -std::numeric_limits<Float_t>::infinity());
+   return f;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Smallest float not below val
+
+Float_t RoundUp(Double_t val)
+{
+   Float_t f = (Float_t)val;
+   if (f < val) f = std::nextafter(f, std::numeric_limits<Float_t>::infinity());
+   return f;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Half of the surface area of the box given by its corners
+
+Double_t HalfArea(const Double_t *bmin, const Double_t *bmax)
+{
+   Double_t dx = bmax[0]-bmin[0];
+   Double_t dy = bmax[1]-bmin[1];
+   Double_t dz = bmax[2]-bmin[2];
+   if (dx<0 || dy<0 || dz<0) return 0;
+   return dx*dy + dy*dz + dz*dx;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Distance along the ray to the entry in the box, or -1 if the box is missed.
+/// `invdir` holds the inverse direction components.
+
+template <typename T>
+Double_t RayBoxEntry(const T *bmin, const T *bmax, const Double_t *point, const Double_t *invdir)
+{
+   Double_t tmin = 0;
+   Double_t tmax = TGeoShape::Big();
+   for (Int_t i=0; i<3; i++) {
+      Double_t t1 = (bmin[i]-point[i])*invdir[i];
+      Double_t t2 = (bmax[i]-point[i])*invdir[i];
+      if (t1 > t2) std::swap(t1, t2);
+      // comparisons with NaN (point on the slab of a parallel ray) are false and keep the box
+      if (t1 > tmin) tmin = t1;
+      if (t2 < tmax) tmax = t2;
+      if (tmin > tmax) return -1;
+   }
+   return tmin;
+}
+
+} // anonymous namespace
+
+ClassImp(TGeoBVHVoxelFinder);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Default constructor
+
+TGeoBVHVoxelFinder::TGeoBVHVoxelFinder() : TGeoVoxelFinder(), fDepth(0)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Constructor for the daughters of a given volume
+
+TGeoBVHVoxelFinder::TGeoBVHVoxelFinder(TGeoVolume *vol) : TGeoVoxelFinder(vol), fDepth(0)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Destructor
+
+TGeoBVHVoxelFinder::~TGeoBVHVoxelFinder()
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Build the hierarchy over the daughter boxes computed by BuildVoxelLimits()
+
+void TGeoBVHVoxelFinder::BuildHierarchy()
+{
+   fNodes.clear();
+   fIndices.clear();
+   fDepth = 0;
+   Int_t nd = fVolume->GetNdaughters();
+   if (!nd || !fBoxes) return;
+   fIndices.resize(nd);
+   for (Int_t id=0; id<nd; id++) fIndices[id] = id;
+   fNodes.reserve(2*nd);
+   BuildNode(0, nd, 1);
+   fNodes.shrink_to_fit();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Build the node holding the daughters fIndices[first, first+count), choosing the
+/// split of the daughter box centers which minimizes the surface area heuristic.
+/// Returns the node index.
+
+Int_t TGeoBVHVoxelFinder::BuildNode(Int_t first, Int_t count, Int_t depth)
+{
+   const Double_t tolerance = TGeoShape::Tolerance();
+   const Int_t inode = fNodes.size();
+   fNodes.emplace_back();
+   if (depth > fDepth) fDepth = depth;
+
+   Double_t bmin[3], bmax[3], cmin[3], cmax[3];
+   Int_t i, k;
+   for (k=0; k<3; k++) {
+      bmin[k] = cmin[k] = TGeoShape::Big();
+      bmax[k] = cmax[k] = -TGeoShape::Big();
+   }
+   for (i=first; i<first+count; i++) {
+      const Double_t *box = &fBoxes[6*fIndices[i]];
+      for (k=0; k<3; k++) {
+         bmin[k] = TMath::Min(bmin[k], box[k+3]-box[k]);
+         bmax[k] = TMath::Max(bmax[k], box[k+3]+box[k]);
+         cmin[k] = TMath::Min(cmin[k], box[k+3]);
+         cmax[k] = TMath::Max(cmax[k], box[k+3]);
+      }
+   }
+   Node_t node;
+   for (k=0; k<3; k++) {
+      node.fMin[k] = RoundDown(bmin[k]-tolerance);
+      node.fMax[k] = RoundUp(bmax[k]+tolerance);
+   }
+
+   // Find the best SAH split among the bin boundaries of the three axes
+   Int_t bestAxis = -1;
+   Int_t bestBin = 0;
+   Double_t bestCost = count; // cost of making a leaf, relative to the node area
+   Double_t area = HalfArea(bmin, bmax);
+   if (count > 2 && depth < kBVHMaxDepth && area > 0) {
+      for (k=0; k<3; k++) {
+         Double_t extent = cmax[k]-cmin[k];
+         if (extent <= 0) continue;
+         Int_t    nbin[kBVHBins] = {0};
+         Double_t lo[kBVHBins][3], hi[kBVHBins][3];
+         for (Int_t ib=0; ib<kBVHBins; ib++) {
+            for (Int_t j=0; j<3; j++) {
+               lo[ib][j] = TGeoShape::Big();
+               hi[ib][j] = -TGeoShape::Big();
+            }
+         }
+         for (i=first; i<first+count; i++) {
+            const Double_t *box = &fBoxes[6*fIndices[i]];
+            Int_t ib = TMath::Min(Int_t(kBVHBins*(box[k+3]-cmin[k])/extent), kBVHBins-1);
+            nbin[ib]++;
+            for (Int_t j=0; j<3; j++) {
+               lo[ib][j] = TMath::Min(lo[ib][j], box[j+3]-box[j]);
+               hi[ib][j] = TMath::Max(hi[ib][j], box[j+3]+box[j]);
+            }
+         }
+         // Areas and counts on the right side of each bin boundary
+         Double_t rarea[kBVHBins];
+         Int_t    rcount[kBVHBins];
+         Double_t rlo[3], rhi[3];
+         Int_t nright = 0;
+         for (Int_t j=0; j<3; j++) {
+            rlo[j] = TGeoShape::Big();
+            rhi[j] = -TGeoShape::Big();
+         }
+         for (Int_t ib=kBVHBins-1; ib>0; ib--) {
+            nright += nbin[ib];
+            for (Int_t j=0; j<3; j++) {
+               rlo[j] = TMath::Min(rlo[j], lo[ib][j]);
+               rhi[j] = TMath::Max(rhi[j], hi[ib][j]);
+            }
+            rarea[ib] = HalfArea(rlo, rhi);
+            rcount[ib] = nright;
+         }
+         Double_t llo[3], lhi[3];
+         Int_t nleft = 0;
+         for (Int_t j=0; j<3; j++) {
+            llo[j] = TGeoShape::Big();
+            lhi[j] = -TGeoShape::Big();
+         }
+         for (Int_t ib=0; ib<kBVHBins-1; ib++) {
+            nleft += nbin[ib];
+            for (Int_t j=0; j<3; j++) {
+               llo[j] = TMath::Min(llo[j], lo[ib][j]);
+               lhi[j] = TMath::Max(lhi[j], hi[ib][j]);
+            }
+            if (!nleft || !rcount[ib+1]) continue;
+            // one traversal step plus the expected number of daughters to check
+            Double_t cost = 1. + (HalfArea(llo, lhi)*nleft + rarea[ib+1]*rcount[ib+1])/area;
+            if (cost < bestCost) {
+               bestCost = cost;
+               bestAxis = k;
+               bestBin = ib;
+            }
+         }
+      }
+   }
+
+   if (bestAxis < 0) {
+      node.fFirst = first;
+      node.fCount = count;
+      fNodes[inode] = node;
+      return inode;
+   }
+
+   const Double_t extent = cmax[bestAxis]-cmin[bestAxis];
+   const Double_t start = cmin[bestAxis];
+   auto begin = fIndices.begin();
+   auto mid = std::partition(begin+first, begin+first+count, [&](Int_t id) {
+      Int_t ib = TMath::Min(Int_t(kBVHBins*(fBoxes[6*id+bestAxis+3]-start)/extent), kBVHBins-1);
+      return ib <= bestBin;
+   });
+   Int_t nleft = mid-(begin+first);
+
+   node.fCount = 0;
+   fNodes[inode] = node;
+   BuildNode(first, nleft, depth+1);
+   Int_t second = BuildNode(first+nleft, count-nleft, depth+1);
+   fNodes[inode].fFirst = second;
+   return inode;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Build the hierarchy if needed, e.g. after reading the geometry from a file.
+
+void TGeoBVHVoxelFinder::CheckHierarchy() const
+{
+   if (NeedRebuild() || fNodes.empty()) {
+      TGeoBVHVoxelFinder *vox = (TGeoBVHVoxelFinder*)this;
+      vox->Voxelize();
+      fVolume->FindOverlaps();
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Check if the point is inside the bounding box of daughter INODE
+
+Bool_t TGeoBVHVoxelFinder::InsideBox(Int_t inode, const Double_t *point) const
+{
+   const Double_t *box = &fBoxes[6*inode];
+   for (Int_t i=0; i<3; i++) {
+      if (TMath::Abs(point[i]-box[i+3]) > box[i]) return kFALSE;
+   }
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Print the statistics of the hierarchy and return the inverse of the mean number
+/// of daughters per leaf.
+
+Double_t TGeoBVHVoxelFinder::Efficiency()
+{
+   printf("Voxelization efficiency for %s\n", fVolume->GetName());
+   CheckHierarchy();
+   Int_t nleaves = 0;
+   for (const auto &node : fNodes) {
+      if (node.fCount) nleaves++;
+   }
+   Double_t eff = (nleaves && !fIndices.empty()) ? Double_t(nleaves)/fIndices.size() : 0.;
+   printf("BVH nodes : %d  leaves : %d  depth : %d\n", GetNnodes(), nleaves, fDepth);
+   printf("Total efficiency : %g\n", eff);
+   return eff;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Get the list of daughter indices for which point is inside their bbox
+
+Int_t *TGeoBVHVoxelFinder::GetCheckList(const Double_t *point, Int_t &nelem, TGeoStateInfo &td)
+{
+   CheckHierarchy();
+   nelem = 0;
+   td.fVoxNcandidates = 0;
+   if (fNodes.empty()) return 0;
+   Int_t stack[kBVHStackSize];
+   Int_t nstack = 0;
+   stack[nstack++] = 0;
+   while (nstack > 0) {
+      const Int_t inode = stack[--nstack];
+      const Node_t &node = fNodes[inode];
+      if (point[0] < node.fMin[0] || point[0] > node.fMax[0] ||
+          point[1] < node.fMin[1] || point[1] > node.fMax[1] ||
+          point[2] < node.fMin[2] || point[2] > node.fMax[2]) continue;
+      if (node.fCount) {
+         for (Int_t i=node.fFirst; i<node.fFirst+node.fCount; i++) {
+            if (InsideBox(fIndices[i], point)) td.fVoxCheckList[nelem++] = fIndices[i];
+         }
+         continue;
+      }
+      stack[nstack++] = node.fFirst;
+      stack[nstack++] = inode+1;
+   }
+   td.fVoxNcandidates = nelem;
+   if (!nelem) return 0;
+   return td.fVoxCheckList;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// All crossed candidates are returned at once by GetNextVoxel(), so there is no
+/// next voxel to look at.
+
+Int_t *TGeoBVHVoxelFinder::GetNextCandidates(const Double_t * /*point*/, Int_t &ncheck, TGeoStateInfo & /*td*/)
+{
+   ncheck = 0;
+   return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the candidates crossed by the ray, as found by SortCrossedVoxels(), on the
+/// first call, and nothing afterwards.
+
+Int_t *TGeoBVHVoxelFinder::GetNextVoxel(const Double_t * /*point*/, const Double_t * /*dir*/, Int_t &ncheck, TGeoStateInfo &td)
+{
+   if (td.fVoxCurrent==0) {
+      td.fVoxCurrent++;
+      ncheck = td.fVoxNcandidates;
+      if (!ncheck) return 0;
+      return td.fVoxCheckList;
+   }
+   ncheck = 0;
+   return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Print the hierarchy.
+
+void TGeoBVHVoxelFinder::Print(Option_t *) const
+{
+   CheckHierarchy();
+   printf("BVH voxels for volume %s (nd=%i, nodes=%i, depth=%i)\n", fVolume->GetName(),
+          fVolume->GetNdaughters(), GetNnodes(), fDepth);
+   Int_t stack[kBVHStackSize], level[kBVHStackSize];
+   Int_t nstack = 0;
+   stack[nstack] = 0;
+   level[nstack++] = 0;
+   while (nstack > 0) {
+      nstack--;
+      Int_t inode = stack[nstack];
+      Int_t ilevel = level[nstack];
+      const Node_t &node = fNodes[inode];
+      printf("%*snode %i : (%g, %g, %g) - (%g, %g, %g)", 2*ilevel, "", inode,
+             node.fMin[0], node.fMin[1], node.fMin[2], node.fMax[0], node.fMax[1], node.fMax[2]);
+      if (node.fCount) {
+         printf(" :");
+         for (Int_t i=node.fFirst; i<node.fFirst+node.fCount; i++) printf(" %i", fIndices[i]);
+         printf("\n");
+         continue;
+      }
+      printf("\n");
+      stack[nstack] = node.fFirst;
+      level[nstack++] = ilevel+1;
+      stack[nstack] = inode+1;
+      level[nstack++] = ilevel+1;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Collect in the state the daughters whose bounding box is crossed by the ray
+/// starting at POINT along DIR. The nearer child of each node is visited first,
+/// so that the candidates come roughly ordered by distance.
+
+void TGeoBVHVoxelFinder::SortCrossedVoxels(const Double_t *point, const Double_t *dir, TGeoStateInfo &td)
+{
+   CheckHierarchy();
+   td.fVoxCurrent = 0;
+   td.fVoxNcandidates = 0;
+   if (fNodes.empty()) return;
+   const Double_t tolerance = TGeoShape::Tolerance();
+   Double_t invdir[3];
+   for (Int_t i=0; i<3; i++) invdir[i] = 1./dir[i];
+   Int_t stack[kBVHStackSize];
+   Int_t nstack = 0;
+   if (RayBoxEntry(fNodes[0].fMin, fNodes[0].fMax, point, invdir) < 0) return;
+   stack[nstack++] = 0;
+   Int_t ncand = 0;
+   while (nstack > 0) {
+      const Int_t inode = stack[--nstack];
+      const Node_t &node = fNodes[inode];
+      if (node.fCount) {
+         for (Int_t i=node.fFirst; i<node.fFirst+node.fCount; i++) {
+            const Double_t *box = &fBoxes[6*fIndices[i]];
+            Double_t bmin[3], bmax[3];
+            for (Int_t j=0; j<3; j++) {
+               bmin[j] = box[j+3]-box[j]-tolerance;
+               bmax[j] = box[j+3]+box[j]+tolerance;
+            }
+            if (RayBoxEntry(bmin, bmax, point, invdir) >= 0) td.fVoxCheckList[ncand++] = fIndices[i];
+         }
+         continue;
+      }
+      // Push the farther child first, so that the nearer one is processed next
+      const Int_t left = inode+1;
+      const Int_t right = node.fFirst;
+      Double_t tleft = RayBoxEntry(fNodes[left].fMin, fNodes[left].fMax, point, invdir);
+      Double_t tright = RayBoxEntry(fNodes[right].fMin, fNodes[right].fMax, point, invdir);
+      if (tleft >= 0 && tright >= 0) {
+         if (tleft <= tright) {
+            stack[nstack++] = right;
+            stack[nstack++] = left;
+         } else {
+            stack[nstack++] = left;
+            stack[nstack++] = right;
+         }
+      } else if (tleft >= 0) {
+         stack[nstack++] = left;
+      } else if (tright >= 0) {
+         stack[nstack++] = right;
+      }
+   }
+   td.fVoxNcandidates = ncand;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Voxelize attached volume. The option is ignored.
+/// If the volume is an assembly, make sure the bbox is computed.
+
+void TGeoBVHVoxelFinder::Voxelize(Option_t * /*option*/)
+{
+   if (fVolume->IsAssembly()) fVolume->GetShape()->ComputeBBox();
+   Int_t nd = fVolume->GetNdaughters();
+   TGeoVolume *vd;
+   for (Int_t i=0; i<nd; i++) {
+      vd = fVolume->GetNode(i)->GetVolume();
+      if (vd->IsAssembly()) vd->GetShape()->ComputeBBox();
+   }
+   BuildVoxelLimits();
+   BuildHierarchy();
+   SetNeedRebuild(kFALSE);
+}
@@ -234,6 +234,7 @@ in order to enhance rays.
 \image html geom_random2.jpg
 */
 
+#include <atomic>
 #include <cstdlib>
 #include <iostream>
 #include <fstream>
@@ -299,10 +300,29 @@ Int_t  TGeoManager::fgMaxDaughters    = 1;
 Int_t  TGeoManager::fgMaxXtruVert     = 1;
 Int_t  TGeoManager::fgNumThreads      = 0;
 UInt_t TGeoManager::fgExportPrecision = 17;
+Int_t  TGeoManager::fgBVHVoxelsThreshold = 0;
 TGeoManager::EDefaultUnits TGeoManager::fgDefaultUnits = TGeoManager::kRootUnits;
 TGeoManager::ThreadsMap_t *TGeoManager::fgThreadId = 0;
 static Bool_t gGeometryLocked = kTRUE;
 
+namespace {
+
+/// Incremented, under TGeoManager::fgMutex, whenever a navigator is added, removed or
+/// switched, which invalidates the navigator cached by each thread in GetCurrentNavigator().
+std::atomic<UInt_t> gNavigatorsGeneration{1};
+/// Incremented, under TGeoManager::fgMutex, when the thread ordinals are reset by
+/// ClearThreadsMap(), which invalidates the ordinal cached by each thread in ThreadId().
+std::atomic<UInt_t> gThreadsGeneration{1};
+
+/// Navigator of the calling thread, as cached by TGeoManager::GetCurrentNavigator().
+struct TGeoNavigatorCache_t {
+   const TGeoManager *fManager = nullptr;  // geometry manager owning the navigator
+   UInt_t             fGeneration = 0;     // value of gNavigatorsGeneration when cached
+   TGeoNavigator     *fNavigator = nullptr;
+};
+
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Default constructor.
 
@@ -728,25 +748,33 @@ TGeoNavigator *TGeoManager::AddNavigator()
    }
    TGeoNavigator *nav = array->AddNavigator();
    if (fClosed) nav->GetCache()->BuildInfoBranch();
+   gNavigatorsGeneration++;
    if (fMultiThread) fgMutex.unlock();
    return nav;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Returns current navigator for the calling thread.
+///
+/// In multi-threaded mode the navigator is cached in a thread-local variable,
+/// so that the lookup costs a single atomic load of the navigators generation,
+/// without locking, as long as no navigator is added, removed or switched.
 
 TGeoNavigator *TGeoManager::GetCurrentNavigator() const
 {
-   TTHREAD_TLS(TGeoNavigator*) tnav = 0;
    if (!fMultiThread) return fCurrentNavigator;
-   TGeoNavigator *nav = tnav; // TTHREAD_TLS_GET(TGeoNavigator*,tnav);
-   if (nav) return nav;
-   std::thread::id threadId = std::this_thread::get_id();
-   NavigatorsMap_t::const_iterator it = fNavigators.find(threadId);
-   if (it == fNavigators.end()) return 0;
-   TGeoNavigatorArray *array = it->second;
-   nav = array->GetCurrentNavigator();
-   tnav = nav; // TTHREAD_TLS_SET(TGeoNavigator*,tnav,nav);
+   TTHREAD_TLS(TGeoNavigatorCache_t) tcache;
+   UInt_t generation = gNavigatorsGeneration.load(std::memory_order_acquire);
+   if (tcache.fManager == this && tcache.fGeneration == generation) return tcache.fNavigator;
+   TGeoNavigator *nav = 0;
+   fgMutex.lock();
+   generation = gNavigatorsGeneration.load(std::memory_order_relaxed);
+   NavigatorsMap_t::const_iterator it = fNavigators.find(std::this_thread::get_id());
+   if (it != fNavigators.end()) nav = it->second->GetCurrentNavigator();
+   fgMutex.unlock();
+   tcache.fManager = this;
+   tcache.fGeneration = generation;
+   tcache.fNavigator = nav;
    return nav;
 }
 
@@ -756,9 +784,11 @@ TGeoNavigator *TGeoManager::GetCurrentNavigator() const
 TGeoNavigatorArray *TGeoManager::GetListOfNavigators() const
 {
    std::thread::id threadId = std::this_thread::get_id();
+   TGeoNavigatorArray *array = 0;
+   if (fMultiThread) fgMutex.lock();
    NavigatorsMap_t::const_iterator it = fNavigators.find(threadId);
-   if (it == fNavigators.end()) return 0;
-   TGeoNavigatorArray *array = it->second;
+   if (it != fNavigators.end()) array = it->second;
+   if (fMultiThread) fgMutex.unlock();
    return array;
 }
 
@@ -768,14 +798,16 @@ TGeoNavigatorArray *TGeoManager::GetListOfNavigators() const
 Bool_t TGeoManager::SetCurrentNavigator(Int_t index)
 {
    std::thread::id threadId = std::this_thread::get_id();
-   NavigatorsMap_t::const_iterator it = fNavigators.find(threadId);
-   if (it == fNavigators.end()) {
+   TGeoNavigatorArray *array = GetListOfNavigators();
+   if (!array) {
       Error("SetCurrentNavigator", "No navigator defined for this thread\n");
       std::cout << "  thread id: " << threadId << std::endl;
       return kFALSE;
    }
-   TGeoNavigatorArray *array = it->second;
+   if (fMultiThread) fgMutex.lock();
    TGeoNavigator *nav = array->SetCurrentNavigator(index);
+   gNavigatorsGeneration++;
+   if (fMultiThread) fgMutex.unlock();
    if (!nav) {
       Error("SetCurrentNavigator", "Navigator %d not existing for this thread\n", index);
       std::cout << "  thread id: " << threadId << std::endl;
@@ -806,6 +838,7 @@ void TGeoManager::ClearNavigators()
       if (arr) delete arr;
    }
    fNavigators.clear();
+   gNavigatorsGeneration++;
    if (fMultiThread) fgMutex.unlock();
 }
 
@@ -821,6 +854,7 @@ void TGeoManager::RemoveNavigator(const TGeoNavigator *nav)
          if ((TGeoNavigator*)arr->Remove((TObject*)nav)) {
             delete nav;
             if (!arr->GetEntries()) fNavigators.erase(it);
+            gNavigatorsGeneration++;
             if (fMultiThread) fgMutex.unlock();
             return;
          }
@@ -895,28 +929,37 @@ void TGeoManager::ClearThreadsMap()
    fgMutex.lock();
    if (!fgThreadId->empty()) fgThreadId->clear();
    fgNumThreads = 0;
+   gThreadsGeneration++;
    fgMutex.unlock();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Translates the current thread id to an ordinal number. This can be used to
 /// manage data which is specific for a given thread.
+/// The ordinal is cached in a thread-local variable, invalidated by ClearThreadsMap(),
+/// so that the map of threads is only looked up, under lock, on the first call.
 
 Int_t TGeoManager::ThreadId()
 {
    TTHREAD_TLS(Int_t) tid = -1;
-   Int_t ttid = tid; // TTHREAD_TLS_GET(Int_t,tid);
-   if (ttid > -1) return ttid;
+   TTHREAD_TLS(UInt_t) tgeneration = 0;
+   if (tid > -1 && tgeneration == gThreadsGeneration.load(std::memory_order_acquire)) return tid;
    if (gGeoManager && !gGeoManager->IsMultiThread()) return 0;
    std::thread::id threadId = std::this_thread::get_id();
-   TGeoManager::ThreadsMapIt_t it = fgThreadId->find(threadId);
-   if (it != fgThreadId->end()) return it->second;
-   // Map needs to be updated.
    fgMutex.lock();
-   (*fgThreadId)[threadId] = fgNumThreads;
-   tid = fgNumThreads; // TTHREAD_TLS_SET(Int_t,tid,fgNumThreads);
-   ttid = fgNumThreads++;
+   UInt_t generation = gThreadsGeneration.load(std::memory_order_relaxed);
+   Int_t ttid;
+   TGeoManager::ThreadsMapIt_t it = fgThreadId->find(threadId);
+   if (it != fgThreadId->end()) {
+      ttid = it->second;
+   } else {
+      // Map needs to be updated.
+      (*fgThreadId)[threadId] = fgNumThreads;
+      ttid = fgNumThreads++;
+   }
    fgMutex.unlock();
+   tid = ttid;
+   tgeneration = generation;
    return ttid;
 }
 
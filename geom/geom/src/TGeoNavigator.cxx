@@ -43,6 +43,8 @@ gGeoManager->SetCurrentNavigator(0);
 #include "TGeoParallelWorld.h"
 #include "TGeoPhysicalNode.h"
 
+#include <vector>
+
 static Double_t gTolerance = TGeoShape::Tolerance();
 const char *kGeoOutsidePath = " ";
 const Int_t kN3 = 3*sizeof(Double_t);
@@ -1114,6 +1116,70 @@ TGeoNode *TGeoNavigator::FindNextDaughterBoundary(Double_t *point, Double_t *dir
    return nodefound;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Basket version of FindNextBoundary() for NTRACKS tracks located in the
+/// current volume. POINTS and DIRS hold the 3*NTRACKS coordinates and director
+/// cosines of the tracks in the master reference frame, STEPMAX the maximum step
+/// of each track. On output, STEPS contains for each track the distance to the
+/// next boundary (or a big number if no boundary is crossed within its STEPMAX),
+/// and IDAUGHTERS the index of the daughter of the current volume the track will
+/// enter, or -1 if it will exit the current volume.
+///
+/// The distances are computed one shape at a time for the whole basket through the
+/// vectorized TGeoShape::DistFromInside_v()/DistFromOutside_v() interfaces, each
+/// daughter being checked only against the distance already found for every track.
+/// The lanes share the current node and matrix, but the state of the navigator
+/// (current point, fStep, next node) is not modified, so that the tracks can be
+/// propagated further independently. Daughters of assemblies are not resolved:
+/// the index of the assembly node itself is returned.
+
+void TGeoNavigator::FindNextBoundary_v(Int_t ntracks, const Double_t *points, const Double_t *dirs,
+                                       const Double_t *stepmax, Double_t *steps, Int_t *idaughters)
+{
+   if (ntracks <= 0) return;
+   TGeoVolume *vol = fCurrentNode->GetVolume();
+   std::vector<Double_t> lpoints(3*ntracks), ldirs(3*ntracks);
+   std::vector<Double_t> dpoints(3*ntracks), ddirs(3*ntracks), dists(ntracks);
+   Int_t i;
+   for (i=0; i<ntracks; i++) {
+      fCache->MasterToLocal(&points[3*i], &lpoints[3*i]);
+      fCache->MasterToLocalVect(&dirs[3*i], &ldirs[3*i]);
+      idaughters[i] = -1;
+   }
+   // Distance to exit the current volume
+   memcpy(steps, stepmax, ntracks*sizeof(Double_t));
+   vol->GetShape()->DistFromInside_v(lpoints.data(), ldirs.data(), dists.data(), ntracks, steps);
+   for (i=0; i<ntracks; i++) {
+      if (dists[i] < steps[i]) steps[i] = dists[i];
+      else                     steps[i] = TGeoShape::Big();
+   }
+   Int_t nd = vol->GetNdaughters();
+   if (!nd) return;
+   if (fGeometry->IsActivityEnabled() && !vol->IsActiveDaughters()) return;
+   // Distances to enter the daughters, limited by the best distance per lane
+   std::vector<Double_t> limits(ntracks);
+   for (Int_t id=0; id<nd; id++) {
+      TGeoNode *current = vol->GetNode(id);
+      if (fGeometry->IsActivityEnabled() && !current->GetVolume()->IsActive()) continue;
+      TGeoShape *shape = current->GetVolume()->GetShape();
+      for (i=0; i<ntracks; i++) {
+         current->MasterToLocal(&lpoints[3*i], &dpoints[3*i]);
+         current->MasterToLocalVect(&ldirs[3*i], &ddirs[3*i]);
+         limits[i] = TMath::Min(steps[i], stepmax[i]);
+      }
+      shape->DistFromOutside_v(dpoints.data(), ddirs.data(), dists.data(), ntracks, limits.data());
+      Bool_t overlapping = current->IsOverlapping();
+      for (i=0; i<ntracks; i++) {
+         if (dists[i] >= limits[i]-gTolerance) continue;
+         // As in the scalar case, ignore overlapping daughters containing the point
+         if (overlapping && shape->Contains(&dpoints[3*i]) &&
+             shape->Safety(&dpoints[3*i], kTRUE) > gTolerance) continue;
+         steps[i] = dists[i];
+         idaughters[i] = id;
+      }
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Compute distance to next boundary within STEPMAX. If no boundary is found,
 /// propagate current point along current direction with fStep=STEPMAX. Otherwise
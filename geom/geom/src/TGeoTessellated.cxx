@@ -14,8 +14,12 @@
 \ingroup Geometry_classes
 
 Tessellated solid class. It is composed by a set of planar faces having triangular or
-quadrilateral shape. The class does not provide navigation functionality, it just wraps the data
-for the composing faces.
+quadrilateral shape.
+
+Navigation (Contains(), DistFromInside(), DistFromOutside(), Safety() and ComputeNormal()) is
+provided for closed bodies, as found by CheckClosure(). The queries use a bounding volume hierarchy
+built over the facet bounding boxes, so their cost grows only logarithmically with the number of
+facets. Shapes that are not closed behave as their bounding box.
 */
 
 #include <iostream>
@@ -30,6 +34,7 @@ for the composing faces.
 #include "TBuffer3DTypes.h"
 #include "TMath.h"
 
+#include <algorithm>
 #include <array>
 #include <vector>
 
@@ -37,6 +42,95 @@ ClassImp(TGeoTessellated)
 
    using Vertex_t = Tessellated::Vertex_t;
 
+namespace {
+
+constexpr int kBVHLeafSize = 4;   // Maximum number of facets in a leaf of the bounding volume hierarchy
+constexpr int kBVHStackSize = 64; // Traversal stack size, the hierarchy depth is about log2(nfacets / kBVHLeafSize)
+
+////////////////////////////////////////////////////////////////////////////////
+/// Distance along the ray to the entry in the box, or -1 if the box is missed before tmax.
+/// `invdir` holds the inverse direction components.
+
+double RayBoxEntry(const double *bmin, const double *bmax, const double *point, const double *invdir, double tmax)
+{
+   double tmin = 0;
+   for (int i = 0; i < 3; ++i) {
+      double t1 = (bmin[i] - point[i]) * invdir[i];
+      double t2 = (bmax[i] - point[i]) * invdir[i];
+      if (t1 > t2)
+         std::swap(t1, t2);
+      // comparisons with NaN (point on the slab of a parallel ray) are false and keep the box
+      if (t1 > tmin)
+         tmin = t1;
+      if (t2 < tmax)
+         tmax = t2;
+      if (tmin > tmax)
+         return -1;
+   }
+   return tmin;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Squared distance from point to the box, 0 if the point is inside
+
+double BoxSafety2(const double *bmin, const double *bmax, const double *point)
+{
+   double safe2 = 0;
+   for (int i = 0; i < 3; ++i) {
+      double d = 0;
+      if (point[i] < bmin[i])
+         d = bmin[i] - point[i];
+      else if (point[i] > bmax[i])
+         d = point[i] - bmax[i];
+      safe2 += d * d;
+   }
+   return safe2;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Squared distance from point p to the triangle (a, b, c), following the closest point
+/// computation by Voronoi regions of C. Ericson, Real-Time Collision Detection, 5.1.5
+
+double TriangleSafety2(const Vertex_t &p, const Vertex_t &a, const Vertex_t &b, const Vertex_t &c)
+{
+   const Vertex_t ab = b - a;
+   const Vertex_t ac = c - a;
+   const Vertex_t ap = p - a;
+   const double d1 = ab.Dot(ap);
+   const double d2 = ac.Dot(ap);
+   if (d1 <= 0 && d2 <= 0)
+      return ap.Mag2();
+
+   const Vertex_t bp = p - b;
+   const double d3 = ab.Dot(bp);
+   const double d4 = ac.Dot(bp);
+   if (d3 >= 0 && d4 <= d3)
+      return bp.Mag2();
+
+   const double vc = d1 * d4 - d3 * d2;
+   if (vc <= 0 && d1 >= 0 && d3 <= 0)
+      return (ap - (d1 / (d1 - d3)) * ab).Mag2();
+
+   const Vertex_t cp = p - c;
+   const double d5 = ab.Dot(cp);
+   const double d6 = ac.Dot(cp);
+   if (d6 >= 0 && d5 <= d6)
+      return cp.Mag2();
+
+   const double vb = d5 * d2 - d1 * d6;
+   if (vb <= 0 && d2 >= 0 && d6 <= 0)
+      return (ap - (d2 / (d2 - d6)) * ac).Mag2();
+
+   const double va = d3 * d6 - d5 * d4;
+   if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0)
+      return (bp - ((d4 - d3) / ((d4 - d3) + (d5 - d6))) * (c - b)).Mag2();
+
+   const double denom = 1. / (va + vb + vc);
+   return (ap - (vb * denom) * ab - (vc * denom) * ac).Mag2();
+}
+
+} // anonymous namespace
+
 std::ostream &operator<<(std::ostream &os, TGeoFacet const &facet)
 {
    os << "{";
@@ -208,9 +302,11 @@ TGeoTessellated::TGeoTessellated(const char *name, const std::vector<Vertex_t> &
 void TGeoTessellated::AfterStreamer()
 {
    // The pointer to the array of vertices is not streamed so update it to facets
-   for (auto facet : fFacets)
-      facet.SetVertices(&fVertices);
+   for (auto &facet : fFacets)
+      facet.SetVertices(&fVertices, facet.GetNvert(), facet.GetVertexIndex(0), facet.GetVertexIndex(1),
+                        facet.GetVertexIndex(2), facet.GetVertexIndex(3));
    fDefined = true;
+   BuildBVH();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -485,9 +581,347 @@ bool TGeoTessellated::CheckClosure(bool fixFlipped, bool verbose)
    delete[] nn;
    delete[] flipped;
 
+   BuildBVH();
    return !hasorphans;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the outward facet normals and build the bounding volume hierarchy used
+/// for navigation. Nothing is built if the shape is not a closed body.
+
+void TGeoTessellated::BuildBVH()
+{
+   fNormals.clear();
+   fBVH.clear();
+   fBVHFacets.clear();
+   if (!fClosedBody || fFacets.empty())
+      return;
+
+   // The facet normals follow the vertex ordering, made consistent by CheckClosure. They are
+   // oriented outwards using the sign of the enclosed volume.
+   const int nfacets = fFacets.size();
+   fNormals.resize(nfacets);
+   std::vector<double> fbox(6 * nfacets);
+   double volume = 0;
+   for (int i = 0; i < nfacets; ++i) {
+      const auto &facet = fFacets[i];
+      bool degenerated = false;
+      fNormals[i] = facet.ComputeNormal(degenerated);
+      const Vertex_t &v0 = facet.GetVertex(0);
+      for (int j = 1; j < facet.GetNvert() - 1; ++j)
+         volume += v0.Dot(Vertex_t::Cross(facet.GetVertex(j) - v0, facet.GetVertex(j + 1) - v0));
+      for (int k = 0; k < 3; ++k) {
+         fbox[6 * i + k] = TGeoShape::Big();
+         fbox[6 * i + 3 + k] = -TGeoShape::Big();
+      }
+      for (int j = 0; j < facet.GetNvert(); ++j) {
+         for (int k = 0; k < 3; ++k) {
+            fbox[6 * i + k] = TMath::Min(fbox[6 * i + k], facet.GetVertex(j)[k]);
+            fbox[6 * i + 3 + k] = TMath::Max(fbox[6 * i + 3 + k], facet.GetVertex(j)[k]);
+         }
+      }
+   }
+   if (volume < 0) {
+      for (auto &normal : fNormals)
+         normal *= -1.;
+   }
+
+   fBVHFacets.resize(nfacets);
+   for (int i = 0; i < nfacets; ++i)
+      fBVHFacets[i] = i;
+   fBVH.reserve(2 * nfacets / kBVHLeafSize + 1);
+   BuildBVHNode(0, nfacets, fbox);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Build the BVH node holding the facets fBVHFacets[first, first + count), splitting them
+/// at the median of their centers along the largest extent. Returns the node index.
+
+int TGeoTessellated::BuildBVHNode(int first, int count, const std::vector<double> &fbox)
+{
+   const double tolerance = TGeoShape::Tolerance();
+   const int inode = fBVH.size();
+   fBVH.emplace_back();
+
+   BVHNode_t node;
+   double cmin[3], cmax[3];
+   for (int k = 0; k < 3; ++k) {
+      node.fMin[k] = cmin[k] = TGeoShape::Big();
+      node.fMax[k] = cmax[k] = -TGeoShape::Big();
+   }
+   for (int i = first; i < first + count; ++i) {
+      const double *box = &fbox[6 * fBVHFacets[i]];
+      for (int k = 0; k < 3; ++k) {
+         node.fMin[k] = TMath::Min(node.fMin[k], box[k] - tolerance);
+         node.fMax[k] = TMath::Max(node.fMax[k], box[3 + k] + tolerance);
+         const double center = 0.5 * (box[k] + box[3 + k]);
+         cmin[k] = TMath::Min(cmin[k], center);
+         cmax[k] = TMath::Max(cmax[k], center);
+      }
+   }
+
+   int axis = 0;
+   for (int k = 1; k < 3; ++k) {
+      if (cmax[k] - cmin[k] > cmax[axis] - cmin[axis])
+         axis = k;
+   }
+
+   // Leaf if small enough, or if the facet centers cannot be separated
+   if (count <= kBVHLeafSize || cmax[axis] - cmin[axis] <= 0) {
+      node.fFirst = first;
+      node.fCount = count;
+      fBVH[inode] = node;
+      return inode;
+   }
+
+   const int mid = first + count / 2;
+   auto begin = fBVHFacets.begin();
+   std::nth_element(begin + first, begin + mid, begin + first + count, [&fbox, axis](int a, int b) {
+      return fbox[6 * a + axis] + fbox[6 * a + 3 + axis] < fbox[6 * b + axis] + fbox[6 * b + 3 + axis];
+   });
+
+   node.fCount = 0;
+   fBVH[inode] = node;
+   BuildBVHNode(first, mid - first, fbox);
+   fBVH[inode].fFirst = BuildBVHNode(mid, first + count - mid, fbox);
+   return inode;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Intersect the ray with a facet. Returns true if the ray crosses the facet at a
+/// distance dist, which can be slightly negative within the tolerance.
+
+bool TGeoTessellated::IntersectFacet(int ifacet, const double *point, const double *dir, double &dist) const
+{
+   const double tolerance = TGeoShape::Tolerance();
+   const auto &facet = fFacets[ifacet];
+   const auto &normal = fNormals[ifacet];
+   const Vertex_t pt(point[0], point[1], point[2]);
+   const Vertex_t dv(dir[0], dir[1], dir[2]);
+   const double ndotd = normal.Dot(dv);
+   if (TMath::Abs(ndotd) < 1.e-20)
+      return false;
+   dist = normal.Dot(facet.GetVertex(0) - pt) / ndotd;
+   if (dist < -tolerance)
+      return false;
+
+   // The facets are convex: the crossing point has to be on the same side of all edges
+   const Vertex_t crossing = pt + dist * dv;
+   const int nvert = facet.GetNvert();
+   bool positive = false, negative = false;
+   for (int i = 0; i < nvert; ++i) {
+      const Vertex_t &v = facet.GetVertex(i);
+      const Vertex_t edge = facet.GetVertex((i + 1) % nvert) - v;
+      // signed distance to the edge line, times the edge length
+      const double side = Vertex_t::Cross(edge, crossing - v).Dot(normal);
+      const double edgeTolerance = tolerance * edge.Mag();
+      if (side > edgeTolerance)
+         positive = true;
+      else if (side < -edgeTolerance)
+         negative = true;
+      if (positive && negative)
+         return false;
+   }
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Squared distance from point to a facet
+
+double TGeoTessellated::FacetSafety2(int ifacet, const double *point) const
+{
+   const auto &facet = fFacets[ifacet];
+   const Vertex_t pt(point[0], point[1], point[2]);
+   double safe2 = TriangleSafety2(pt, facet.GetVertex(0), facet.GetVertex(1), facet.GetVertex(2));
+   if (facet.GetNvert() == 4)
+      safe2 = TMath::Min(safe2, TriangleSafety2(pt, facet.GetVertex(0), facet.GetVertex(2), facet.GetVertex(3)));
+   return safe2;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Find the closest facet crossed by the ray within stepmax. With sense > 0 only facets
+/// exited by the ray are considered, with sense < 0 only entered ones, otherwise all.
+/// Returns the facet index, or -1 if none is crossed, and the distance to it in dist.
+
+int TGeoTessellated::FindNextFacet(const double *point, const double *dir, int sense, double stepmax,
+                                   double &dist) const
+{
+   double invdir[3];
+   for (int k = 0; k < 3; ++k)
+      invdir[k] = 1. / dir[k];
+
+   int stack[kBVHStackSize];
+   int nstack = 0;
+   stack[nstack++] = 0;
+   int found = -1;
+   dist = stepmax;
+   while (nstack > 0) {
+      const int inode = stack[--nstack];
+      const auto &node = fBVH[inode];
+      if (RayBoxEntry(node.fMin, node.fMax, point, invdir, dist) < 0)
+         continue;
+      if (node.fCount > 0) {
+         for (int i = node.fFirst; i < node.fFirst + node.fCount; ++i) {
+            const int ifacet = fBVHFacets[i];
+            const auto &normal = fNormals[ifacet];
+            const double ndotd = normal[0] * dir[0] + normal[1] * dir[1] + normal[2] * dir[2];
+            if ((sense > 0 && ndotd <= 0) || (sense < 0 && ndotd >= 0))
+               continue;
+            double d = 0;
+            if (IntersectFacet(ifacet, point, dir, d) && d < dist) {
+               dist = d;
+               found = ifacet;
+            }
+         }
+         continue;
+      }
+      // Visit the nearer child first
+      const int left = inode + 1, right = node.fFirst;
+      const double tleft = RayBoxEntry(fBVH[left].fMin, fBVH[left].fMax, point, invdir, dist);
+      const double tright = RayBoxEntry(fBVH[right].fMin, fBVH[right].fMax, point, invdir, dist);
+      if (tleft >= 0 && tright >= 0) {
+         stack[nstack++] = tleft < tright ? right : left;
+         stack[nstack++] = tleft < tright ? left : right;
+      } else if (tleft >= 0) {
+         stack[nstack++] = left;
+      } else if (tright >= 0) {
+         stack[nstack++] = right;
+      }
+   }
+   return found;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Find the facet closest to the point. Returns its index and the distance to it in safety.
+
+int TGeoTessellated::FindNearestFacet(const double *point, double &safety) const
+{
+   int stack[kBVHStackSize];
+   int nstack = 0;
+   stack[nstack++] = 0;
+   int found = -1;
+   double best2 = TGeoShape::Big();
+   while (nstack > 0) {
+      const int inode = stack[--nstack];
+      const auto &node = fBVH[inode];
+      if (BoxSafety2(node.fMin, node.fMax, point) >= best2)
+         continue;
+      if (node.fCount > 0) {
+         for (int i = node.fFirst; i < node.fFirst + node.fCount; ++i) {
+            const double safe2 = FacetSafety2(fBVHFacets[i], point);
+            if (safe2 < best2) {
+               best2 = safe2;
+               found = fBVHFacets[i];
+            }
+         }
+         continue;
+      }
+      // Visit the nearer child first
+      const int left = inode + 1, right = node.fFirst;
+      const double sleft = BoxSafety2(fBVH[left].fMin, fBVH[left].fMax, point);
+      const double sright = BoxSafety2(fBVH[right].fMin, fBVH[right].fMax, point);
+      stack[nstack++] = sleft < sright ? right : left;
+      stack[nstack++] = sleft < sright ? left : right;
+   }
+   safety = TMath::Sqrt(best2);
+   return found;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Test if point is inside the shape: the closest facet crossed by a ray starting
+/// from the point has to be exited by the ray.
+
+Bool_t TGeoTessellated::Contains(const double *point) const
+{
+   if (!TGeoBBox::Contains(point))
+      return kFALSE;
+   if (fBVH.empty())
+      return kTRUE;
+   // Direction not aligned with the axes, unlikely to graze the edges of CAD facets
+   static const double dir[3] = {0.4753232149, 0.5862036290, 0.6560225633};
+   double dist = 0;
+   const int ifacet = FindNextFacet(point, dir, 0, TGeoShape::Big(), dist);
+   if (ifacet < 0)
+      return kFALSE;
+   const auto &normal = fNormals[ifacet];
+   return (normal[0] * dir[0] + normal[1] * dir[1] + normal[2] * dir[2]) > 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute distance from inside point to the surface of the shape
+
+double TGeoTessellated::DistFromInside(const double *point, const double *dir, int iact, double step,
+                                       double *safe) const
+{
+   if (fBVH.empty())
+      return TGeoBBox::DistFromInside(point, dir, iact, step, safe);
+   if (iact < 3 && safe) {
+      *safe = Safety(point, kTRUE);
+      if (iact == 0)
+         return TGeoShape::Big();
+      if (iact == 1 && step < *safe)
+         return TGeoShape::Big();
+   }
+   double dist = 0;
+   if (FindNextFacet(point, dir, 1, TGeoShape::Big(), dist) < 0)
+      return 0.;
+   return TMath::Max(dist, 0.);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute distance from outside point to the surface of the shape
+
+double TGeoTessellated::DistFromOutside(const double *point, const double *dir, int iact, double step,
+                                        double *safe) const
+{
+   if (fBVH.empty())
+      return TGeoBBox::DistFromOutside(point, dir, iact, step, safe);
+   if (iact < 3 && safe) {
+      *safe = Safety(point, kFALSE);
+      if (iact == 0)
+         return TGeoShape::Big();
+      if (iact == 1 && step < *safe)
+         return TGeoShape::Big();
+   }
+   // Fast rejection of rays missing the bounding box
+   if (TGeoBBox::DistFromOutside(point, dir, fDX, fDY, fDZ, fOrigin) >= TGeoShape::Big())
+      return TGeoShape::Big();
+   double dist = 0;
+   if (FindNextFacet(point, dir, -1, TGeoShape::Big(), dist) < 0)
+      return TGeoShape::Big();
+   return TMath::Max(dist, 0.);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Computes the closest distance from given point to the surface of the shape
+
+double TGeoTessellated::Safety(const double *point, Bool_t in) const
+{
+   if (fBVH.empty())
+      return TGeoBBox::Safety(point, in);
+   double safety = 0;
+   FindNearestFacet(point, safety);
+   return safety;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Computes the normal of the facet closest to the point, oriented along the direction
+
+void TGeoTessellated::ComputeNormal(const double *point, const double *dir, double *norm)
+{
+   if (fBVH.empty()) {
+      TGeoBBox::ComputeNormal(point, dir, norm);
+      return;
+   }
+   double safety = 0;
+   const int ifacet = FindNearestFacet(point, safety);
+   fNormals[ifacet].CopyTo(norm);
+   if (norm[0] * dir[0] + norm[1] * dir[1] + norm[2] * dir[2] < 0) {
+      for (int k = 0; k < 3; ++k)
+         norm[k] = -norm[k];
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Compute bounding box
 
@@ -622,6 +1056,7 @@ void TGeoTessellated::ResizeCenter(double maxsize)
    fDX *= scale;
    fDY *= scale;
    fDZ *= scale;
+   BuildBVH();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
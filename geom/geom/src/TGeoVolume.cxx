@@ -400,6 +400,7 @@ volumes (or volume assemblies) as content.
 #include "TGeoScaledShape.h"
 #include "TGeoCompositeShape.h"
 #include "TGeoVoxelFinder.h"
+#include "TGeoBVHVoxelFinder.h"
 #include "TGeoExtension.h"
 
 ClassImp(TGeoVolume);
@@ -1744,7 +1745,8 @@ TGeoVolume *TGeoVolume::CloneVolume() const
    // copy voxels
    TGeoVoxelFinder *voxels = 0;
    if (fVoxels) {
-      voxels = new TGeoVoxelFinder(vol);
+      if (fVoxels->InheritsFrom(TGeoBVHVoxelFinder::Class())) voxels = new TGeoBVHVoxelFinder(vol);
+      else                                                    voxels = new TGeoVoxelFinder(vol);
       vol->SetVoxelFinder(voxels);
    }
    // copy option, uid
@@ -2299,6 +2301,12 @@ void TGeoVolume::VisibleDaughters(Bool_t vis)
 
 ////////////////////////////////////////////////////////////////////////////////
 /// build the voxels for this volume
+///
+/// The daughters are partitioned with a bounding volume hierarchy (TGeoBVHVoxelFinder)
+/// if the option contains "bvh", if the volume was already using one, e.g. after
+/// SetBVHVoxels(), or if the regular slices would keep on average more candidates
+/// per voxel than TGeoManager::GetBVHVoxelsThreshold(). The option "slices" forces
+/// the regular voxels of TGeoVoxelFinder.
 
 void TGeoVolume::Voxelize(Option_t *option)
 {
@@ -2313,20 +2321,46 @@ void TGeoVolume::Voxelize(Option_t *option)
    if (!nd) return;
    // If this is an assembly, re-compute bounding box
    if (IsAssembly()) fShape->ComputeBBox();
+   TString opt(option);
+   opt.ToLower();
+   Bool_t bvh = opt.Contains("bvh") ||
+                (!opt.Contains("slices") && fVoxels && fVoxels->InheritsFrom(TGeoBVHVoxelFinder::Class()));
    // delete old voxelization if any
    if (fVoxels) {
       if (!TObject::TestBit(kVolumeClone)) delete fVoxels;
       fVoxels = 0;
    }
    // Create the voxels structure
-   fVoxels = new TGeoVoxelFinder(this);
+   if (bvh) fVoxels = new TGeoBVHVoxelFinder(this);
+   else     fVoxels = new TGeoVoxelFinder(this);
    fVoxels->Voxelize(option);
-   if (fVoxels) {
-      if (fVoxels->IsInvalid()) {
-         delete fVoxels;
-         fVoxels = 0;
-      }
+   if (fVoxels->IsInvalid()) {
+      delete fVoxels;
+      fVoxels = 0;
    }
+   // Switch to the hierarchy if the slices are not selective enough
+   Int_t threshold = TGeoManager::GetBVHVoxelsThreshold();
+   if (fVoxels && !bvh && !opt.Contains("slices") && threshold > 0 && fVoxels->GetMeanCandidates() > threshold) {
+      delete fVoxels;
+      fVoxels = new TGeoBVHVoxelFinder(this);
+      fVoxels->Voxelize(option);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Select the voxelization of the daughters with a bounding volume hierarchy
+/// (TGeoBVHVoxelFinder) instead of the regular slices of TGeoVoxelFinder,
+/// or back to the slices for flag=kFALSE. The voxels are rebuilt when the
+/// geometry is closed, or on first use if it is already closed.
+
+void TGeoVolume::SetBVHVoxels(Bool_t flag)
+{
+   if (fVoxels && fVoxels->InheritsFrom(TGeoBVHVoxelFinder::Class()) == flag) return;
+   if (fVoxels && !TObject::TestBit(kVolumeClone)) delete fVoxels;
+   fVoxels = 0;
+   if (fFinder || !GetNdaughters()) return;
+   if (flag) fVoxels = new TGeoBVHVoxelFinder(this);
+   else      fVoxels = new TGeoVoxelFinder(this);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2849,7 +2883,8 @@ TGeoVolume *TGeoVolumeAssembly::CloneVolume() const
    // copy voxels
    TGeoVoxelFinder *voxels = 0;
    if (fVoxels) {
-      voxels = new TGeoVoxelFinder(vol);
+      if (fVoxels->InheritsFrom(TGeoBVHVoxelFinder::Class())) voxels = new TGeoBVHVoxelFinder(vol);
+      else                                                    voxels = new TGeoVoxelFinder(vol);
       vol->SetVoxelFinder(voxels);
    }
    // copy option, uid
@@ -2934,7 +2969,8 @@ TGeoVolumeAssembly *TGeoVolumeAssembly::MakeAssemblyFromVolume(TGeoVolume *volor
    // copy voxels
    TGeoVoxelFinder *voxels = 0;
    if (volorig->GetVoxels()) {
-      voxels = new TGeoVoxelFinder(vol);
+      if (volorig->GetVoxels()->InheritsFrom(TGeoBVHVoxelFinder::Class())) voxels = new TGeoBVHVoxelFinder(vol);
+      else                                                                 voxels = new TGeoVoxelFinder(vol);
       vol->SetVoxelFinder(voxels);
    }
    // copy option, uid
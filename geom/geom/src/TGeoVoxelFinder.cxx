@@ -290,6 +290,28 @@ Double_t TGeoVoxelFinder::Efficiency()
    printf("Total efficiency : %g\n", eff);
    return eff;
 }
+////////////////////////////////////////////////////////////////////////////////
+/// Estimate the mean number of candidates in a voxel, as the smallest mean number
+/// of daughters per slice, weighted by the slice widths, among the sliced axes.
+
+Double_t TGeoVoxelFinder::GetMeanCandidates() const
+{
+   Double_t ncand = fVolume->GetNdaughters();
+   const Int_t nb[3] = {fIbx, fIby, fIbz};
+   const Double_t *bounds[3] = {fXb, fYb, fZb};
+   const Int_t *nslice[3] = {fNsliceX, fNsliceY, fNsliceZ};
+   for (Int_t i=0; i<3; i++) {
+      if (fPriority[i]!=2 || !bounds[i] || !nslice[i]) continue;
+      Double_t width = bounds[i][nb[i]-1] - bounds[i][0];
+      if (width <= 0) continue;
+      Double_t mean = 0;
+      for (Int_t id=0; id<nb[i]-1; id++) mean += nslice[i][id]*(bounds[i][id+1]-bounds[i][id]);
+      mean /= width;
+      if (mean < ncand) ncand = mean;
+   }
+   return ncand;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// create the list of nodes for which the bboxes overlap with inode's bbox
 
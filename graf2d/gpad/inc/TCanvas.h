@@ -16,6 +16,9 @@
 
 #include "TAttCanvas.h"
 
+#include <string>
+#include <vector>
+
 class TCanvasImp;
 class TContextMenu;
 class TControlBar;
@@ -227,6 +230,8 @@ public:
 
    static TCanvas   *MakeDefCanvas();
    static Bool_t     SupportAlpha();
+   static Bool_t     SaveAsParallel(const std::vector<TPad *> &pads, const std::vector<std::string> &filenames,
+                                    Int_t nworkers = 0, Option_t *option = "");
 
    ClassDefOverride(TCanvas,8)  //Graphics canvas
 };
@@ -48,6 +48,15 @@
 #include "snprintf.h"
 
 #include "TVirtualMutex.h"
+#include "TSystem.h"
+
+#ifndef R__WIN32
+#include <cerrno>
+#include <cstdio>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 class TCanvasInit {
 public:
@@ -1521,6 +1530,110 @@ TCanvas *TCanvas::MakeDefCanvas()
    return c;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Static function to save each pad of `pads` in the file with the same index
+/// in `filenames`, using `nworkers` processes (by default one per core).
+///
+/// The painters and the graphics backends rely on global state (the current
+/// PostScript or image output, the histogram painting options, the TrueType
+/// fonts...), so that pads cannot be painted by several threads at the same
+/// time. Instead, the calling process is forked: each worker has its own copy
+/// of the pads and of the graphics state, saves its share of the pads with
+/// TPad::SaveAs(), to which `option` is passed, and exits.
+///
+/// The files are written in parallel only in batch mode and not on Windows;
+/// otherwise the pads are saved one after the other by the calling process.
+/// Because the pads are painted in the workers, the side effects of painting
+/// (for instance the axis histograms created for graphs) are not visible in
+/// the calling process. No other thread of the calling process should paint
+/// or write files while this function runs.
+///
+/// Returns kFALSE if the arguments are inconsistent or if some files could
+/// not be written.
+///
+/// ~~~ {.cpp}
+///    gROOT->SetBatch(kTRUE);
+///    std::vector<TPad *> pads;
+///    std::vector<std::string> names;
+///    for (Int_t i = 0; i < 1000; i++) {
+///       auto c = new TCanvas(Form("c%d", i), "", 800, 600);
+///       hists[i]->Draw();
+///       pads.push_back(c);
+///       names.push_back(Form("plot%d.png", i));
+///    }
+///    TCanvas::SaveAsParallel(pads, names);
+/// ~~~
+
+Bool_t TCanvas::SaveAsParallel(const std::vector<TPad *> &pads, const std::vector<std::string> &filenames,
+                               Int_t nworkers, Option_t *option)
+{
+   if (pads.size() != filenames.size()) {
+      ::Error("TCanvas::SaveAsParallel", "%d pads but %d file names", (Int_t)pads.size(), (Int_t)filenames.size());
+      return kFALSE;
+   }
+   const Int_t npads = pads.size();
+
+   auto saveShare = [&](Int_t first, Int_t step) {
+      for (Int_t i = first; i < npads; i += step)
+         if (pads[i])
+            pads[i]->SaveAs(filenames[i].c_str(), option);
+   };
+
+   auto allSaved = [&]() {
+      Bool_t ok = kTRUE;
+      for (Int_t i = 0; i < npads; i++) {
+         if (!pads[i] || gSystem->AccessPathName(filenames[i].c_str())) {
+            ::Error("TCanvas::SaveAsParallel", "file %s was not written", filenames[i].c_str());
+            ok = kFALSE;
+         }
+      }
+      return ok;
+   };
+
+   if (nworkers <= 0) {
+      SysInfo_t info;
+      nworkers = (gSystem->GetSysInfo(&info) == 0) ? info.fCpus : 1;
+   }
+   nworkers = TMath::Min(nworkers, npads);
+
+#ifndef R__WIN32
+   if (nworkers > 1 && gROOT->IsBatch()) {
+      // do not duplicate pending output in the workers
+      std::cout.flush();
+      std::cerr.flush();
+      fflush(nullptr);
+
+      std::vector<pid_t> workers;
+      for (Int_t w = 0; w < nworkers; w++) {
+         pid_t pid = fork();
+         if (pid == 0) {
+            saveShare(w, nworkers);
+            std::cout.flush();
+            std::cerr.flush();
+            fflush(nullptr);
+            // leave without running the exit handlers of the parent's objects
+            _exit(0);
+         }
+         if (pid < 0) {
+            ::SysError("TCanvas::SaveAsParallel", "cannot fork worker, saving the remaining pads sequentially");
+            break;
+         }
+         workers.push_back(pid);
+      }
+      for (auto pid : workers) {
+         int status;
+         while (waitpid(pid, &status, 0) < 0 && errno == EINTR) {}
+      }
+      for (Int_t w = workers.size(); w < nworkers; w++)
+         saveShare(w, nworkers);
+      return allSaved();
+   }
+#endif
+
+   saveShare(0, 1);
+   return allSaved();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set option to move objects/pads in a canvas.
 ///
@@ -77,6 +77,7 @@ protected:
    std::string fOutputJson;               ///<!
    std::vector<char> fOutputBinary;       ///<!
    Int_t fTotalBinarySize;                ///<!
+   Bool_t fOutputIsFullStream{kFALSE};    ///<! fOutputJson and fOutputBinary hold an up-to-date StreamElements() output
 
    std::vector<SceneCommand> fCommands;   ///<!
 
@@ -102,6 +103,7 @@ public:
    void ProcessChanges();
 
    void StreamElements();
+   void StreamElementsIfNeeded();
    void StreamJsonRecurse(REveElement *el, nlohmann::json &jobj);
 
    // void   Repaint(Bool_t dropLogicals=kFALSE);
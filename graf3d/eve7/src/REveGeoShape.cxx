@@ -37,6 +37,10 @@
 #include "TGeoMatrix.h"
 #include "TVirtualGeoPainter.h"
 
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
 
 namespace
 {
@@ -59,6 +63,17 @@ namespace
    }
 
   TGeoHMatrix localGeoHMatrixIdentity;
+
+   // Tessellations of the wrapped (non-composite) shapes, per number of
+   // segments. The entry lives as long as some REveGeoShape wraps the shape,
+   // shapes taken from a TGeoManager may get deleted behind our back after that.
+   struct TessEntry {
+      int fUsers{0};
+      std::map<Int_t, std::unique_ptr<ROOT::Experimental::REveGeoPolyShape>> fPolys;
+   };
+
+   std::mutex gTessMutex;
+   std::unordered_map<const TGeoShape *, TessEntry> gTessCache;
 }
 
 using namespace ROOT::Experimental;
@@ -146,25 +161,34 @@ void REveGeoShape::BuildRenderData()
 {
    if (!fShape) return;
 
-   REveGeoPolyShape *egps = nullptr;
-   std::unique_ptr<REveGeoPolyShape> tmp_egps;
-
-   if (fCompositeShape) {
-
-      egps = dynamic_cast<REveGeoPolyShape *>(fShape);
-
-   } else {
+   fRenderData = std::make_unique<REveRenderData>("makeEveGeoShape");
 
-      tmp_egps = std::make_unique<REveGeoPolyShape>();
+   REveElement::BuildRenderData();
 
-      tmp_egps->BuildFromShape(fShape, fNSegments);
+   if (fCompositeShape) {
+      dynamic_cast<REveGeoPolyShape *>(fShape)->FillRenderData(*fRenderData);
+      return;
+   }
 
-      egps = tmp_egps.get();
+   // Tessellate each shape only once, the same shape is typically used by
+   // many elements and the render data is rebuilt for every full stream.
+   std::lock_guard<std::mutex> lock(gTessMutex);
+
+   auto it = gTessCache.find(fShape);
+   if (it == gTessCache.end()) {
+      // Shape was not passed through SetShape(), nothing to share.
+      REveGeoPolyShape tmp_egps;
+      tmp_egps.BuildFromShape(fShape, fNSegments);
+      tmp_egps.FillRenderData(*fRenderData);
+      return;
    }
 
-   fRenderData = std::make_unique<REveRenderData>("makeEveGeoShape");
+   auto &egps = it->second.fPolys[fNSegments];
+   if (!egps) {
+      egps = std::make_unique<REveGeoPolyShape>();
+      egps->BuildFromShape(fShape, fNSegments);
+   }
 
-   REveElement::BuildRenderData();
    egps->FillRenderData(*fRenderData);
 }
 
@@ -200,6 +224,12 @@ void REveGeoShape::SetShape(TGeoShape *s)
    }
 
    if (fShape) {
+      if (!fCompositeShape) {
+         std::lock_guard<std::mutex> lock(gTessMutex);
+         auto it = gTessCache.find(fShape);
+         if (it != gTessCache.end() && --it->second.fUsers <= 0)
+            gTessCache.erase(it);
+      }
       fShape->SetUniqueID(fShape->GetUniqueID() - 1);
       if (fShape->GetUniqueID() == 0) {
          delete fShape;
@@ -207,12 +237,16 @@ void REveGeoShape::SetShape(TGeoShape *s)
    }
 
    fShape = s;
+   fCompositeShape = nullptr;
 
    if (fShape) {
       fShape->SetUniqueID(fShape->GetUniqueID() + 1);
       fCompositeShape = dynamic_cast<TGeoCompositeShape *>(fShape);
       if (fCompositeShape) {
          fShape = MakePolyShape();
+      } else {
+         std::lock_guard<std::mutex> lock(gTessMutex);
+         ++gTessCache[fShape].fUsers;
       }
    }
 }
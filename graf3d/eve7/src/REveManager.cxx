@@ -727,8 +727,8 @@ void REveManager::WindowConnect(unsigned connid)
       scene->AddSubscriber(std::make_unique<REveClient>(connid, fWebWindow));
       printf("\nEVEMNG ............. streaming scene %s [%s]\n", scene->GetCTitle(), scene->GetCName());
 
-      // This prepares core and render data buffers.
-      scene->StreamElements();
+      // This prepares core and render data buffers (unless they are up-to-date from a previous connection).
+      scene->StreamElementsIfNeeded();
 
       printf("   sending json, len = %d\n", (int)scene->fOutputJson.size());
       Send(connid, scene->fOutputJson);
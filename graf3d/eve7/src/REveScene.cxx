@@ -65,7 +65,7 @@ void REveScene::AddSubscriber(std::unique_ptr<REveClient> &&sub)
 
    // XXX Here should send out the package to the new subscriber,
    // In principle can expect a new one in short time?
-   // Keep streamed data until next begin change, maybe.
+   // The streamed data is kept until the next change, see StreamElementsIfNeeded().
 }
 
 void REveScene::RemoveSubscriber(unsigned id)
@@ -77,6 +77,10 @@ void REveScene::RemoveSubscriber(unsigned id)
    };
 
    fSubscribers.erase(std::remove_if(fSubscribers.begin(), fSubscribers.end(), pred), fSubscribers.end());
+
+   // Without subscribers changes are not recorded, the streamed data can get stale.
+   if (fSubscribers.empty())
+      fOutputIsFullStream = kFALSE;
 }
 
 // Add Button in client gui with this command
@@ -86,6 +90,7 @@ void REveScene::AddCommand(const std::string &name, const std::string &icon, con
    if (element->GetElementId() && element->IsA())
    {
       fCommands.emplace_back(name, icon, element, action);
+      fOutputIsFullStream = kFALSE;
    }
    else
    {
@@ -110,11 +115,13 @@ void REveScene::SceneElementChanged(REveElement* element)
    assert(fAcceptingChanges);
 
    fChangedElements.push_back(element);
+   fOutputIsFullStream = kFALSE;
 }
 
 void REveScene::SceneElementRemoved(ElementId_t id)
 {
    fRemovedElements.push_back(id);
+   fOutputIsFullStream = kFALSE;
 }
 
 void REveScene::EndAcceptingChanges()
@@ -181,6 +188,22 @@ void REveScene::StreamElements()
    jarr.front()["fTotalBinarySize"] = fTotalBinarySize;
 
    fOutputJson = jarr.dump();
+   fOutputIsFullStream = HasSubscribers();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Prepare the data for a new subscriber, unless the output of the last
+/// StreamElements() call can be sent again.
+///
+/// The output is reused while the scene keeps subscribers and no element is
+/// changed, added or removed in between, so that clients connecting one after
+/// the other do not trigger the streaming of the whole scene, and the
+/// rebuilding of the render data, again.
+
+void REveScene::StreamElementsIfNeeded()
+{
+   if (!fOutputIsFullStream)
+      StreamElements();
 }
 
 void REveScene::StreamJsonRecurse(REveElement *el, nlohmann::json &jarr)
@@ -235,6 +258,7 @@ void REveScene::StreamJsonRecurse(REveElement *el, nlohmann::json &jarr)
 
 void REveScene::StreamRepresentationChanges()
 {
+   fOutputIsFullStream = kFALSE;
    fOutputJson.clear();
    fOutputBinary.clear();
 
@@ -22,6 +22,7 @@
 #include <vector>
 #include <string>
 #include <queue>
+#include <map>
 #include <functional>
 
 class TPad;
@@ -54,6 +55,9 @@ protected:
       Long64_t fSendVersion{0};        ///<! canvas version send to the client
       Long64_t fDrawVersion{0};        ///<! canvas version drawn (confirmed) by client
       std::queue<std::string> fSend;   ///<! send queue, processed after sending draw data
+      Bool_t fUnchanged{kFALSE};       ///<! client can reuse the primitives sent without data
+      Int_t fCompression{0};           ///<! compression settings of the snapshots, negotiated with client
+      std::map<std::string, std::size_t> fSentHashes; ///<! hashes of primitives JSON sent with last snapshot
       WebConn(unsigned id) : fConnId(id) {}
    };
 
@@ -70,6 +74,7 @@ protected:
    Int_t fPaletteDelivery{1};      ///<! colors palette delivery 0:never, 1:once, 2:always, 3:per subpad
    Int_t fPrimitivesMerge{100};    ///<! number of PS primitives, which will be merged together
    Int_t fJsonComp{0};             ///<! compression factor for messages send to the client
+   Int_t fCompression{0};          ///<! ROOT compression settings offered to the clients for the snapshots
    std::string fCustomScripts;     ///<! custom JavaScript code or URL on JavaScript files to load before start drawing
    std::vector<std::string> fCustomClasses;  ///<! list of custom classes, which can be delivered as is to client
    Bool_t fCanCreateObjects{kTRUE}; ///<! indicates if canvas allowed to create extra objects for interactive painting
@@ -97,6 +102,9 @@ protected:
 
    Bool_t CheckPadModified(TPad *pad, Int_t inc_version = 1);
 
+   void ReduceUnchangedPrimitives(TPadWebSnapshot &snap, const std::map<std::string, std::size_t> &sent,
+                                  std::map<std::string, std::size_t> &hashes);
+
    Bool_t AddToSendQueue(unsigned connid, const std::string &msg);
 
    void CheckDataToSend(unsigned connid = 0);
@@ -186,6 +194,9 @@ public:
    void SetPrimitivesMerge(Int_t cnt) { fPrimitivesMerge = cnt; }
    Int_t GetPrimitivesMerge() const { return fPrimitivesMerge; }
 
+   void SetCompression(Int_t settings) { fCompression = settings; }
+   Int_t GetCompression() const { return fCompression; }
+
    void SetLongerPolling(Bool_t on) { fLongerPolling = on; }
    Bool_t GetLongerPolling() const { return fLongerPolling; }
 
@@ -79,6 +79,8 @@ public:
 
    TWebSnapshot &NewSpecials();
 
+   std::vector<std::unique_ptr<TWebSnapshot>> &GetPrimitives() { return fPrimitives; }
+
    ClassDef(TPadWebSnapshot, 1) // Pad painting snapshot, used for JSROOT
 };
 
@@ -36,6 +36,7 @@
 #include "TBase64.h"
 #include "TAtt3D.h"
 #include "TView.h"
+#include "RZip.h"
 
 #include <cstdio>
 #include <cstring>
@@ -43,6 +44,7 @@
 #include <iostream>
 #include <memory>
 #include <sstream>
+#include <functional>
 
 /** \class TWebCanvas
 \ingroup webgui6
@@ -55,6 +57,65 @@ Major interactive features implemented in TWebCanvasFull class.
 
 using namespace std::string_literals;
 
+namespace {
+
+/// Minimal length of the snapshots which are compressed
+constexpr std::size_t kMinCompressLength = 1024;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compress text message with ROOT compression settings `compression`.
+/// Produced binary message starts with "ZMSG6:<length of text>:", followed by the compressed
+/// blocks in the format used by ROOT files, so that JSROOT can decode it with R__unzip.
+/// Returns false if the message cannot be compressed.
+
+bool CompressMessage(const std::string &msg, Int_t compression, std::string &res)
+{
+   Int_t algorithm = compression / 100, level = compression % 100;
+   if ((level <= 0) || (msg.length() > (std::size_t) kMaxInt))
+      return false;
+
+   Int_t msglen = msg.length();
+   Int_t nbuffers = 1 + (msglen - 1) / kMAXZIPBUF;
+
+   std::string hdr = "ZMSG6:"s + std::to_string(msglen) + ":"s;
+   res.resize(hdr.length() + msglen + 9 * nbuffers);
+   std::copy(hdr.begin(), hdr.end(), res.begin());
+
+   char *src = const_cast<char *>(msg.data());
+   char *tgt = &res[hdr.length()];
+   Int_t nzip = 0, total = 0;
+   for (Int_t i = 0; i < nbuffers; ++i) {
+      Int_t srcsize = (i == nbuffers - 1) ? msglen - nzip : kMAXZIPBUF;
+      Int_t tgtsize = res.length() - hdr.length() - total;
+      Int_t nout = 0;
+      R__zipMultipleAlgorithm(level, &srcsize, src, &tgtsize, tgt, &nout,
+                              static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(algorithm));
+      if ((nout == 0) || (total + nout >= msglen))
+         return false;
+      src += srcsize;
+      tgt += nout;
+      nzip += srcsize;
+      total += nout;
+   }
+   res.resize(hdr.length() + total);
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns identifier of ROOT compression algorithm, used in the header of compressed blocks
+
+const char *CompressionAlgorithmId(Int_t compression)
+{
+   switch (compression / 100) {
+   case ROOT::RCompressionSetting::EAlgorithm::kZLIB: return "ZL";
+   case ROOT::RCompressionSetting::EAlgorithm::kLZ4: return "L4";
+   case ROOT::RCompressionSetting::EAlgorithm::kZSTD: return "ZS";
+   default: return "";
+   }
+}
+
+} // namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Constructor
 
@@ -66,6 +127,7 @@ TWebCanvas::TWebCanvas(TCanvas *c, const char *name, Int_t x, Int_t y, UInt_t wi
    fPaletteDelivery = gEnv->GetValue("WebGui.PaletteDelivery", 1);
    fPrimitivesMerge = gEnv->GetValue("WebGui.PrimitivesMerge", 100);
    fJsonComp = gEnv->GetValue("WebGui.JsonComp", TBufferJSON::kSameSuppression + TBufferJSON::kNoSpaces);
+   fCompression = gEnv->GetValue("WebGui.CanvasCompression", 101);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -274,6 +336,39 @@ void TWebCanvas::AddColorsPalette(TPadWebSnapshot &master)
    master.NewSpecials().SetSnapshot(TWebSnapshot::kColors, listofcols, kTRUE);
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////////////
+/// Remove data of the primitives, which are exactly the same as in the previous snapshot sent to the client.
+/// Primitive is identified by pad, object id and order of appearance in the pad, its content by the hash of its JSON.
+/// Client keeps and redraws existing painters for the primitives sent without data.
+/// Hashes of all primitives of the snapshot are collected in `hashes`
+
+void TWebCanvas::ReduceUnchangedPrimitives(TPadWebSnapshot &snap, const std::map<std::string, std::size_t> &sent,
+                                           std::map<std::string, std::size_t> &hashes)
+{
+   std::map<std::string, Int_t> counts;
+
+   for (auto &prim : snap.GetPrimitives()) {
+      if (prim->GetKind() == TWebSnapshot::kSubPad) {
+         ReduceUnchangedPrimitives(static_cast<TPadWebSnapshot &>(*prim), sent, hashes);
+         continue;
+      }
+
+      if (((prim->GetKind() != TWebSnapshot::kObject) && (prim->GetKind() != TWebSnapshot::kSVG)) ||
+          !prim->GetSnapshot() || !*prim->GetObjectID())
+         continue;
+
+      std::string key = snap.GetObjectID() + "/"s + prim->GetObjectID() + "/"s +
+                        std::to_string(counts[prim->GetObjectID()]++);
+
+      auto hash = std::hash<std::string>{}(TBufferJSON::ConvertToJSON(prim->GetSnapshot(), fJsonComp).Data());
+      hashes[key] = hash;
+
+      auto iter = sent.find(key);
+      if ((iter != sent.end()) && (iter->second == hash))
+         prim->SetSnapshot(prim->GetKind(), nullptr);
+   }
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////////////
 /// Create snapshot for pad and all primitives
 /// Callback function is used to create JSON in the middle of data processing -
@@ -569,12 +664,23 @@ void TWebCanvas::CheckDataToSend(unsigned connid)
 
          holder.SetHighlightConnect(Canvas()->HasConnection("Highlighted(TVirtualPad*,TObject*,Int_t,Int_t)"));
 
-         CreatePadSnapshot(holder, Canvas(), conn.fSendVersion, [&buf,this](TPadWebSnapshot *snap) {
+         CreatePadSnapshot(holder, Canvas(), conn.fSendVersion, [&buf,&conn,this](TPadWebSnapshot *snap) {
+            if (conn.fUnchanged) {
+               std::map<std::string, std::size_t> hashes;
+               ReduceUnchangedPrimitives(*snap, conn.fSentHashes, hashes);
+               std::swap(conn.fSentHashes, hashes);
+            }
             buf.append(TBufferJSON::ToJSON(snap, fJsonComp).Data());
          });
 
          conn.fSendVersion = fCanvVersion;
 
+         std::string zbuf;
+         if (conn.fCompression && (buf.length() >= kMinCompressLength) && CompressMessage(buf, conn.fCompression, zbuf)) {
+            fWindow->SendBinary(conn.fConnId, std::move(zbuf));
+            continue;
+         }
+
       } else if (!conn.fSend.empty()) {
 
          std::swap(buf, conn.fSend.front());
@@ -887,6 +993,22 @@ Bool_t TWebCanvas::ProcessData(unsigned connid, const std::string &arg)
 
       // trigger reload of canvas data
       fWebConn[indx].fSendVersion = fWebConn[indx].fDrawVersion = 0;
+      fWebConn[indx].fSentHashes.clear();
+
+   } else if (arg.compare(0, 6, "CAPS6:") == 0) {
+
+      // client capabilities, comma-separated: "unchanged" when primitives without data can be reused,
+      // identifiers of the compression algorithms which can be decoded
+      std::stringstream caps(arg.substr(6));
+      std::string cap;
+      fWebConn[indx].fUnchanged = kFALSE;
+      fWebConn[indx].fCompression = 0;
+      while (std::getline(caps, cap, ',')) {
+         if (cap == "unchanged")
+            fWebConn[indx].fUnchanged = kTRUE;
+         else if ((fCompression > 0) && (cap == CompressionAlgorithmId(fCompression)))
+            fWebConn[indx].fCompression = fCompression;
+      }
 
    } else if (arg.compare(0, 5, "SAVE:") == 0) {
 
@@ -18,6 +18,7 @@
 
 #include "TF1.h"
 #include <string>
+#include <type_traits>
 #include <vector>
 
 namespace ROOT {
@@ -148,6 +149,30 @@ namespace ROOT {
             return fFunc->EvalPar(x, p);
          }
 
+         /// evaluate function on a batch of points, using TF1::EvalParBatch
+         void DoEvalParBatch(unsigned int n, const T *const *x, const double *p, T *result) const override
+         {
+            if constexpr (std::is_same<T, double>::value) {
+               if (fDim == 1) {
+                  // a single component is already stored point after point
+                  fFunc->EvalParBatch(x[0], n, result, p);
+                  return;
+               }
+               std::vector<double> points(std::size_t(n) * fDim);
+               for (unsigned int i = 0; i < n; ++i)
+                  for (unsigned int j = 0; j < fDim; ++j)
+                     points[std::size_t(i) * fDim + j] = x[j][i];
+               fFunc->EvalParBatch(points.data(), n, result, p);
+            } else {
+               std::vector<T> point(fDim);
+               for (unsigned int i = 0; i < n; ++i) {
+                  for (unsigned int j = 0; j < fDim; ++j)
+                     point[j] = x[j][i];
+                  result[i] = DoEvalPar(point.data(), p);
+               }
+            }
+         }
+
          /// evaluate function using the cached parameter values (of TF1)
          /// re-implement for better efficiency
          T DoEvalVec(const T *x) const
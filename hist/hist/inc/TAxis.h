@@ -25,6 +25,8 @@
 #include "TAttAxis.h"
 #include "TArrayD.h"
 
+#include <vector>
+
 class THashList;
 
 class TAxis : public TNamed, public TAttAxis {
@@ -42,6 +44,8 @@ private:
    TObject     *fParent;        ///<! Object owning this axis
    THashList   *fLabels;        ///<  List of labels
    TList       *fModLabs;       ///<  List of modified labels
+   std::vector<Int_t> fBinLookup;   ///<! For variable bins, number of edges below the start of each lookup cell
+   Double_t     fBinLookupScale = 0; ///<! Number of lookup cells per unit of x
 
    /// TAxis extra status bits (stored in fBits2)
    enum {
@@ -51,6 +55,8 @@ private:
    };
 
    Bool_t       HasBinWithoutLabel() const;
+   void         BuildBinLookup();
+   Int_t        FindVariableBin(Double_t x) const;
 
 public:
    /// TAxis status bits
@@ -104,6 +110,7 @@ public:
    virtual Int_t      FindBin(const char *label);
    virtual Int_t      FindFixBin(Double_t x) const;
    virtual Int_t      FindFixBin(const char *label) const;
+           void       FindFixBins(Int_t n, const Double_t *x, Int_t *bins) const;
    virtual Double_t   GetBinCenter(Int_t bin) const;
    virtual Double_t   GetBinCenterLog(Int_t bin) const;
    const char        *GetBinLabel(Int_t bin) const;
@@ -34,6 +34,7 @@
 #include "TF1AbsComposition.h"
 #include "TMath.h"
 #include "Math/Types.h"
+#include "Math/CdfTableSampler.h"
 #include "Math/ParamFunctor.h"
 
 class TF1;
@@ -256,9 +257,7 @@ protected:
    std::vector<Double_t>    fParMax;                ///<  Array of upper limits of the fNpar parameters
    std::vector<Double_t>    fSave;                  ///<  Array of fNsave function values
    std::vector<Double_t>    fIntegral;              ///<! Integral of function binned on fNpx bins
-   std::vector<Double_t>    fAlpha;                 ///<! Array alpha. for each bin in x the deconvolution r of fIntegral
-   std::vector<Double_t>    fBeta;                  ///<! Array beta.  is approximated by x = alpha +beta*r *gamma*r**2
-   std::vector<Double_t>    fGamma;                 ///<! Array gamma.
+   std::unique_ptr<ROOT::Math::CdfTableSampler> fCdfSampler; ///<! Tabulated cumulative function used by GetRandom
    TObject     *fParent{nullptr};                   ///<! Parent object hooking this function (if one)
    TH1         *fHistogram{nullptr};                ///<! Pointer to histogram used for visualisation
    std::unique_ptr<TMethodCall> fMethodCall;        ///<! Pointer to MethodCall in case of interpreted function
@@ -438,6 +437,7 @@ public:
    //template <class T> T Eval(T x, T y = 0, T z = 0, T t = 0) const;
    virtual Double_t EvalPar(const Double_t *x, const Double_t *params = 0);
    template <class T> T EvalPar(const T *x, const Double_t *params = 0);
+   virtual void     EvalParBatch(const Double_t *x, std::size_t n, Double_t *out, const Double_t *params = nullptr);
    virtual Double_t operator()(Double_t x, Double_t y = 0, Double_t z = 0, Double_t t = 0) const;
    template <class T> T operator()(const T *x, const Double_t *params = nullptr);
    void     ExecuteEvent(Int_t event, Int_t px, Int_t py) override;
@@ -549,6 +549,7 @@ public:
    virtual Int_t    GetQuantiles(Int_t nprobSum, Double_t *q, const Double_t *probSum);
    virtual Double_t GetRandom(TRandom * rng = nullptr, Option_t * opt = nullptr);
    virtual Double_t GetRandom(Double_t xmin, Double_t xmax, TRandom * rng = nullptr, Option_t * opt = nullptr);
+   ROOT::Math::CdfTableSampler MakeSampler(Option_t *opt = nullptr);
    virtual void     GetRange(Double_t &xmin, Double_t &xmax) const;
    virtual void     GetRange(Double_t &xmin, Double_t &ymin, Double_t &xmax, Double_t &ymax) const;
    virtual void     GetRange(Double_t &xmin, Double_t &ymin, Double_t &zmin, Double_t &xmax, Double_t &ymax, Double_t &zmax) const;
@@ -105,6 +105,8 @@ private:
    CallFuncSignature fFuncPtr = nullptr;           ///<! Function pointer, owned by the JIT.
    CallFuncSignature fGradFuncPtr = nullptr;       ///<! Function pointer, owned by the JIT.
    CallFuncSignature fHessFuncPtr = nullptr;       ///<! Function pointer, owned by the JIT.
+   std::atomic<CallFuncSignature> fBatchFuncPtr{nullptr}; ///<! Pointer to the batch evaluation loop, owned by the JIT.
+   std::atomic<Bool_t> fBatchGenerationFailed{false}; ///<! Whether the batch evaluation loop could not be compiled
    void *   fLambdaPtr = nullptr;                  ///<! Pointer to the lambda function
    static bool       fIsCladRuntimeIncluded;
 
@@ -131,6 +133,11 @@ private:
       assert(fClingName.Length() && "TFormula is not initialized yet!");
       return std::string(fClingName.Data()) + "_hessian_1";
    }
+   std::string GetBatchFuncName() const {
+      assert(fClingName.Length() && "TFormula is not initialized yet!");
+      return std::string(fClingName.Data()) + "_batch";
+   }
+   bool GenerateBatchEval();
    bool HasGradientGenerationFailed() const {
       return !fGradFuncPtr && !fGradGenerationInput.empty();
    }
@@ -202,6 +209,7 @@ public:
    Double_t       Eval(Double_t x, Double_t y , Double_t z) const;
    Double_t       Eval(Double_t x, Double_t y , Double_t z , Double_t t ) const;
    Double_t       EvalPar(const Double_t *x, const Double_t *params=0) const;
+   void           EvalBatch(const Double_t *x, std::size_t n, Double_t *out, const Double_t *params = nullptr) const;
 
    /// Generate gradient computation routine with respect to the parameters.
    /// \returns true if a gradient was generated and GradientPar can be called.
@@ -106,6 +106,8 @@ public:
    virtual void          DrawGraph(Int_t n, const Double_t *x=nullptr, const Double_t *y=nullptr, Option_t *option="");
    virtual void          DrawPanel(); // *MENU*
    virtual Double_t      Eval(Double_t x, TSpline *spline=nullptr, Option_t *option="") const;
+   Double_t              Eval(Double_t x, Int_t &hint) const;
+   void                  Eval(Int_t n, const Double_t *x, Double_t *y) const;
    void          ExecuteEvent(Int_t event, Int_t px, Int_t py) override;
    virtual void          Expand(Int_t newsize);
    virtual void          Expand(Int_t newsize, Int_t step);
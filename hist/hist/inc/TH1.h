@@ -41,6 +41,8 @@
 
 #include "TFitResultPtr.h"
 
+#include "Math/CdfTableSampler.h"
+
 #include <cfloat>
 #include <string>
 
@@ -133,6 +135,7 @@ protected:
 
    Int_t            AxisChoice(Option_t *axis) const;
    virtual Int_t    BufferFill(Double_t x, Double_t w);
+   Int_t            DoConcurrentFill(Double_t x, Double_t w);
    virtual Bool_t   FindNewAxisLimits(const TAxis* axis, const Double_t point, Double_t& newMin, Double_t &newMax);
    virtual void     SavePrimitiveHelp(std::ostream &out, const char *hname, Option_t *option = "");
    static Bool_t    RecomputeAxisLimits(TAxis& destAxis, const TAxis& anAxis);
@@ -148,6 +151,7 @@ protected:
                                Option_t * opt, Bool_t doerr = kFALSE) const;
 
    virtual void     DoFillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stride=1);
+           void     DoFillRandom(const ROOT::Math::CdfTableSampler &sampler, Int_t ntimes, TRandom *rng);
    Bool_t    GetStatOverflowsBehaviour() const { return EStatOverflows::kNeutral == fStatOverflows ? fgStatOverflows : EStatOverflows::kConsider == fStatOverflows; }
 
    static bool CheckAxisLimits(const TAxis* a1, const TAxis* a2);
@@ -170,7 +174,8 @@ public:
       kIsNotW      = BIT(19),  ///< Histogram is forced to be not weighted even when the histogram is filled with weighted
                                /// different than 1.
       kAutoBinPTwo = BIT(20),  ///< Use Power(2)-based algorithm for autobinning
-      kIsHighlight = BIT(21)   ///< bit set if histo is highlight
+      kIsHighlight = BIT(21),  ///< bit set if histo is highlight
+      kConcurrentFill = BIT(22) ///< Fill can be called concurrently from several threads, see SetConcurrentFill()
    };
    /// Size of statistics data (size of  array used in GetStats()/ PutStats )
    ///  - s[0]  = sumw       s[1]  = sumw2
@@ -304,6 +309,7 @@ public:
 
    virtual Int_t    GetQuantiles(Int_t nprobSum, Double_t *q, const Double_t *probSum=0);
    virtual Double_t GetRandom(TRandom * rng = nullptr) const;
+   ROOT::Math::CdfTableSampler MakeSampler() const;
    virtual void     GetStats(Double_t *stats) const;
    virtual Double_t GetStdDev(Int_t axis=1) const;
    virtual Double_t GetStdDevError(Int_t axis=1) const;
@@ -331,6 +337,7 @@ public:
            Bool_t   IsBinOverflow(Int_t bin, Int_t axis = 0) const;
            Bool_t   IsBinUnderflow(Int_t bin, Int_t axis = 0) const;
    virtual Bool_t   IsHighlight() const { return TestBit(kIsHighlight); }
+           Bool_t   IsConcurrentFill() const { return TestBit(kConcurrentFill); }
    virtual Double_t AndersonDarlingTest(const TH1 *h2, Option_t *option="") const;
    virtual Double_t AndersonDarlingTest(const TH1 *h2, Double_t &advalue) const;
    virtual Double_t KolmogorovTest(const TH1 *h2, Option_t *option="") const;
@@ -375,6 +382,7 @@ public:
    virtual void     SetBinErrorOption(EBinErrorOpt type) { fBinStatErrOpt = type; }
    virtual void     SetBuffer(Int_t buffersize, Option_t *option="");
    virtual UInt_t   SetCanExtend(UInt_t extendBitMask);
+           void     SetConcurrentFill(Bool_t enable = kTRUE);
    virtual void     SetContent(const Double_t *content);
    virtual void     SetContour(Int_t nlevels, const Double_t *levels=0);
    virtual void     SetContourLevel(Int_t level, Double_t value);
@@ -440,6 +448,8 @@ protected:
    virtual Double_t RetrieveBinContent(Int_t bin) const;
    virtual void     UpdateBinContent(Int_t bin, Double_t content);
    virtual Double_t GetBinErrorSqUnchecked(Int_t bin) const { return fSumw2.fN ? fSumw2.fArray[bin] : RetrieveBinContent(bin); }
+   /// Bin contents that concurrent fills add to atomically, null if the histogram does not support them.
+   virtual Double_t *GetConcurrentFillArray() { return nullptr; }
 };
 
 namespace cling {
@@ -645,6 +655,7 @@ public:
 protected:
    Double_t RetrieveBinContent(Int_t bin) const override { return fArray[bin]; }
    void     UpdateBinContent(Int_t bin, Double_t content) override { fArray[bin] = content; }
+   Double_t *GetConcurrentFillArray() override { return fArray; }
 };
 
 TH1D operator*(Double_t c1, const TH1D &h1);
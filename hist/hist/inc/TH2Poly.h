@@ -22,6 +22,8 @@
 
 #include "TH2.h"
 
+#include <vector>
+
 class TH2PolyBin: public TObject{
 
 public:
@@ -166,7 +168,24 @@ protected:
    Bool_t   fBinContentChanged;    ///<!For the 3D Painter
    TList   *fBins;                 ///< List of bins. The list owns the contained objects
 
+   /// A bin referenced by a leaf of the quadtree, with its bounding box.
+   struct QuadTreeBin_t {
+      Double_t    fXmin, fXmax, fYmin, fYmax;
+      TH2PolyBin *fBin;
+   };
+   /// A node of the quadtree; the children of an inner node split it at (fXmid, fYmid).
+   struct QuadTreeNode_t {
+      Double_t fXmid, fYmid;
+      Int_t    fChildren;          ///< Index of the first of the four children, -1 for a leaf
+      Int_t    fFirst, fCount;     ///< Range of the leaf's bins in fQuadTreeBins
+   };
+   std::vector<QuadTreeNode_t> fQuadTreeNodes; ///<!Quadtree of the bin bounding boxes, built when first needed
+   std::vector<QuadTreeBin_t>  fQuadTreeBins;  ///<!Bins of the quadtree leaves, in bin order
+
    void   AddBinToPartition(TH2PolyBin *bin);  // Adds the input bin into the partition matrix
+   void   BuildQuadTree();
+   void   BuildQuadTreeNode(Int_t inode, std::vector<QuadTreeBin_t> &bins, Double_t xlow, Double_t xup, Double_t ylow, Double_t yup, Int_t depth);
+   TH2PolyBin *FindBinInQuadTree(Double_t x, Double_t y);
    void   Initialize(Double_t xlow, Double_t xup, Double_t ylow, Double_t yup, Int_t n, Int_t m);
    Bool_t IsIntersecting(TH2PolyBin *bin, Double_t xclipl, Double_t xclipr, Double_t yclipb, Double_t yclipt);
    Bool_t IsIntersectingPolygon(Int_t bn, Double_t *x, Double_t *y, Double_t xclipl, Double_t xclipr, Double_t yclipb, Double_t yclipt);
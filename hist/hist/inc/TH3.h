@@ -50,6 +50,7 @@ protected:
                                          ,Int_t nbinsy,const Double_t *ybins
                                          ,Int_t nbinsz,const Double_t *zbins);
    virtual Int_t    BufferFill(Double_t x, Double_t y, Double_t z, Double_t w);
+           Int_t    DoConcurrentFill(Double_t x, Double_t y, Double_t z, Double_t w);
 
    void DoFillProfileProjection(TProfile2D * p2, const TAxis & a1, const TAxis & a2, const TAxis & a3, Int_t bin1, Int_t bin2, Int_t bin3, Int_t inBin, Bool_t useWeights) const;
 
@@ -342,6 +343,7 @@ public:
 protected:
            Double_t RetrieveBinContent(Int_t bin) const override { return fArray[bin]; }
            void     UpdateBinContent(Int_t bin, Double_t content) override { fArray[bin] = content; }
+           Double_t *GetConcurrentFillArray() override { return fArray; }
 
    ClassDefOverride(TH3D,4)  //3-Dim histograms (one double per channel)
 };
@@ -21,7 +21,6 @@
 
 
 #include "THnBase.h"
-#include "TExMap.h"
 #include "THnSparse_Internal.h"
 
 // needed only for template instantiations of THnSparseT:
@@ -38,8 +37,7 @@ class THnSparse: public THnBase {
    Int_t      fChunkSize;                   ///<  Number of entries for each chunk
    Long64_t   fFilledBins;                  ///<  Number of filled bins
    TObjArray  fBinContent;                  ///<  Array of THnSparseArrayChunk
-   TExMap     fBins;                        ///<! Filled bins
-   TExMap     fBinsContinued;               ///<! Filled bins for non-unique hashes, containing pairs of (bin index 0, bin index 1)
+   THnSparseBinIndex fBins;                 ///<! Index of the filled bins
    THnSparseCompactBinCoord *fCompactCoord; ///<! Compact coordinate
 
    THnSparse(const THnSparse&) = delete;
@@ -23,6 +23,8 @@
 
 #include "TObject.h"
 
+#include <vector>
+
 class TBrowser;
 class TH1;
 class THnSparse;
@@ -66,5 +68,53 @@ class THnSparseArrayChunk: public TObject {
 
    ClassDefOverride(THnSparseArrayChunk, 1); // chunks of linearized bins
 };
+
+/// Index from the hashes of the compact bin coordinates to the linear bin indexes of a THnSparse.
+/// It is an open-addressing hash table with linear probing: the slots are a single contiguous array, and each slot
+/// keeps the full hash next to the bin index, so that looking up a bin usually touches a single cache line and only
+/// compares the coordinates of bins whose hash is equal. The table is kept at most half full.
+class THnSparseBinIndex {
+   struct Slot_t {
+      ULong64_t fHash; ///< Hash of the bin coordinates
+      Long64_t fBin;   ///< Linear bin index, -1 for an empty slot
+   };
+   std::vector<Slot_t> fSlots; ///< The slots, whose number is a power of two or zero
+   Long64_t fSize = 0;         ///< Number of bins in the index
+
+   /// Spread the hash over all bits: small hashes are the compact coordinates themselves, whose low bits only depend
+   /// on the first axis.
+   static ULong64_t Mix(ULong64_t hash)
+   {
+      hash ^= hash >> 33;
+      hash *= 0xff51afd7ed558ccdULL;
+      hash ^= hash >> 33;
+      hash *= 0xc4ceb9fe1a85ec53ULL;
+      return hash ^ (hash >> 33);
+   }
+   void Rehash(std::size_t nSlots);
+
+public:
+   /// Return the index of the bin with the given hash for which `matches(bin)` is true, -1 if there is none.
+   template <typename Matches_t>
+   Long64_t Find(ULong64_t hash, Matches_t &&matches) const
+   {
+      if (fSlots.empty())
+         return -1;
+      const std::size_t mask = fSlots.size() - 1;
+      for (std::size_t i = Mix(hash) & mask;; i = (i + 1) & mask) {
+         const Slot_t &slot = fSlots[i];
+         if (slot.fBin < 0)
+            return -1;
+         if (slot.fHash == hash && matches(slot.fBin))
+            return slot.fBin;
+      }
+   }
+   void Insert(ULong64_t hash, Long64_t bin);
+   void Reserve(Long64_t nbins);
+   void Clear();
+   Long64_t GetSize() const { return fSize; }
+   /// Return the memory used by the slots, in bytes.
+   std::size_t GetMemorySize() const { return fSlots.size() * sizeof(Slot_t); }
+};
 #endif // ROOT_THnSparse_Internal
 
@@ -123,6 +123,7 @@ public:
    void SetUseBinsNEvents(UInt_t nEvents);
    void SetTuneFactor(Double_t rho);
    void SetRange(Double_t xMin, Double_t xMax); ///< By default computed from the data
+   void SetNGridPoints(UInt_t npoints);
 
    void Draw(const Option_t* option = "") override;
 
@@ -164,10 +165,16 @@ public:
       TKDE *fKDE;
       UInt_t fNWeights;               ///< Number of kernel weights (bandwidth as vectorized for binning)
       std::vector<Double_t> fWeights; ///< Kernel weights (bandwidth)
+      std::vector<Double_t> fGrid;    ///< Estimate tabulated at equidistant points of the range, for interpolation
+      Double_t fGridMin;              ///< Position of the first grid point
+      Double_t fGridStep;             ///< Distance between grid points
    public:
       TKernel(Double_t weight, TKDE *kde);
       void ComputeAdaptiveWeights();
+      void ComputeGrid(UInt_t npoints);
       Double_t operator()(Double_t x) const;
+      Bool_t HasGrid() const { return !fGrid.empty(); }
+      Double_t InterpolateGrid(Double_t x) const;
       Double_t GetWeight(Double_t x) const;
       Double_t GetFixedWeight() const;
       const std::vector<Double_t> &GetAdaptiveWeights() const;
@@ -211,6 +218,7 @@ private:
    UInt_t fNEvents;                    ///< Data's number of events
    Double_t fSumOfCounts;              ///< Data sum of weights
    UInt_t fUseBinsNEvents;             ///< If the algorithm is allowed to use automatic (relaxed) binning this is the minimum number of events to do so
+   UInt_t fNGridPoints;                ///< Number of grid points for interpolated evaluations, 0 for exact evaluations
 
    Double_t fMean;                     ///< Data mean
    Double_t fSigma;                    ///< Data std deviation
@@ -298,7 +306,7 @@ private:
    TF1* GetPDFUpperConfidenceInterval(Double_t confidenceLevel = 0.95, UInt_t npx = 100, Double_t xMin = 1.0, Double_t xMax = 0.0);
    TF1* GetPDFLowerConfidenceInterval(Double_t confidenceLevel = 0.95, UInt_t npx = 100, Double_t xMin = 1.0, Double_t xMax = 0.0);
 
-   ClassDefOverride(TKDE, 3) // One dimensional semi-parametric Kernel Density Estimation
+   ClassDefOverride(TKDE, 4) // One dimensional semi-parametric Kernel Density Estimation
 
 };
 
@@ -57,6 +57,7 @@ protected:
    Double_t RetrieveBinContent(Int_t bin) const override { return (fBinEntries.fArray[bin] > 0) ? fArray[bin]/fBinEntries.fArray[bin] : 0; }
    //virtual void     UpdateBinContent(Int_t bin, Double_t content);
    Double_t GetBinErrorSqUnchecked(Int_t bin) const override { Double_t err = GetBinError(bin); return err*err; }
+   Double_t *GetConcurrentFillArray() override { return nullptr; } // profiles cannot be filled concurrently
 
 private:
    Int_t Fill(Double_t) override { MayNotUse("Fill(Double_t)"); return -1;}
@@ -235,6 +235,8 @@ public:
    TSpline3& operator=(const TSpline3&);
    Int_t    FindX(Double_t x) const;
    Double_t Eval(Double_t x) const override;
+   Double_t Eval(Double_t x, Int_t &hint) const;
+   void     Eval(Int_t n, const Double_t *x, Double_t *y) const;
    Double_t Derivative(Double_t x) const;
    ~TSpline3() override {if (fPoly) delete [] fPoly;}
    void GetCoeff(Int_t i, Double_t &x, Double_t &y, Double_t &b,
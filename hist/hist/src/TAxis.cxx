@@ -26,9 +26,11 @@
 #include "strlcpy.h"
 #include "snprintf.h"
 
+#include <algorithm>
 #include <iostream>
 #include <ctime>
 #include <cassert>
+#include <cmath>
 
 ClassImp(TAxis);
 
@@ -220,6 +222,8 @@ void TAxis::Copy(TObject &obj) const
    axis.fLast   = fLast;
    axis.fBits2  = fBits2;
    fXbins.Copy(axis.fXbins);
+   axis.fBinLookup = fBinLookup;
+   axis.fBinLookupScale = fBinLookupScale;
    axis.fTimeFormat   = fTimeFormat;
    axis.fTimeDisplay  = fTimeDisplay;
    axis.fParent       = fParent;
@@ -308,8 +312,7 @@ Int_t TAxis::FindBin(Double_t x)
       if (!fXbins.fN) {        //*-* fix bins
          bin = 1 + int (fNbins*(x-fXmin)/(fXmax-fXmin) );
       } else {                  //*-* variable bin sizes
-         //for (bin =1; x >= fXbins.fArray[bin]; bin++);
-         bin = 1 + TMath::BinarySearch(fXbins.fN,fXbins.fArray,x);
+         bin = FindVariableBin(x);
       }
    }
    return bin;
@@ -422,13 +425,81 @@ Int_t TAxis::FindFixBin(Double_t x) const
       if (!fXbins.fN) {        //*-* fix bins
          bin = 1 + int (fNbins*(x-fXmin)/(fXmax-fXmin) );
       } else {                  //*-* variable bin sizes
-//         for (bin =1; x >= fXbins.fArray[bin]; bin++);
-         bin = 1 + TMath::BinarySearch(fXbins.fN,fXbins.fArray,x);
+         bin = FindVariableBin(x);
       }
    }
    return bin;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Find the bin numbers corresponding to the `n` abscissas `x`, as FindFixBin(Double_t) does, and store them in
+/// `bins`. This avoids a virtual call per value.
+
+void TAxis::FindFixBins(Int_t n, const Double_t *x, Int_t *bins) const
+{
+   const Bool_t variable = fXbins.fN;
+   for (Int_t i = 0; i < n; ++i) {
+      if (x[i] < fXmin)
+         bins[i] = 0;
+      else if (!(x[i] < fXmax))
+         bins[i] = fNbins + 1;
+      else if (variable)
+         bins[i] = FindVariableBin(x[i]);
+      else
+         bins[i] = 1 + int(fNbins * (x[i] - fXmin) / (fXmax - fXmin));
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Build the lookup table that speeds up the search of the bins of variable bin axes.
+///
+/// The range of the bin edges is split in equal-width cells, twice as many as the bins, and the table stores the
+/// number of edges that are below the start of each cell. The bin of a value is then searched among the edges within
+/// its cell only, which are usually just one or two.
+
+void TAxis::BuildBinLookup()
+{
+   fBinLookup.clear();
+   fBinLookupScale = 0;
+   const Int_t n = fXbins.fN;
+   if (n < 2)
+      return;
+   const Double_t *edges = fXbins.fArray;
+   const Double_t range = edges[n - 1] - edges[0];
+   if (!(range > 0) || !std::isfinite(range))
+      return;
+   const Int_t nCells = 2 * (n - 1);
+   fBinLookupScale = nCells / range;
+   fBinLookup.resize(nCells + 1);
+   for (Int_t k = 0; k <= nCells; ++k)
+      fBinLookup[k] = std::lower_bound(edges, edges + n, edges[0] + k / fBinLookupScale) - edges;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the bin of `x` for variable bins, i.e. `1 + TMath::BinarySearch(fXbins.fN, fXbins.fArray, x)`, using the
+/// lookup table built by BuildBinLookup().
+
+Int_t TAxis::FindVariableBin(Double_t x) const
+{
+   const Int_t n = fXbins.fN;
+   const Double_t *edges = fXbins.fArray;
+   const Double_t cell = (x - edges[0]) * fBinLookupScale;
+   if (fBinLookup.empty() || !(cell >= 0) || !(cell < fBinLookup.size() - 1))
+      return 1 + TMath::BinarySearch(n, edges, x);
+
+   const Int_t k = Int_t(cell);
+   // the bounds only need to be moved if rounding put x in a neighbouring cell
+   Int_t lo = fBinLookup[k];
+   while (lo > 0 && !(edges[lo - 1] < x))
+      --lo;
+   Int_t hi = fBinLookup[k + 1];
+   while (hi < n && edges[hi] < x)
+      ++hi;
+   const Int_t nBelow = std::lower_bound(edges + lo, edges + hi, x) - edges;
+   // like TMath::BinarySearch, return the first of the edges equal to x if any, else the last edge below x
+   return (nBelow < n && edges[nBelow] == x) ? 1 + nBelow : nBelow;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return label for bin
 
@@ -758,6 +829,7 @@ void TAxis::Set(Int_t nbins, Double_t xlow, Double_t xup)
    fXmax    = xup;
    if (!fParent) SetDefaults();
    if (fXbins.fN > 0) fXbins.Set(0);
+   BuildBinLookup();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -776,6 +848,7 @@ void TAxis::Set(Int_t nbins, const Float_t *xbins)
    fXmin      = fXbins.fArray[0];
    fXmax      = fXbins.fArray[fNbins];
    if (!fParent) SetDefaults();
+   BuildBinLookup();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -794,6 +867,7 @@ void TAxis::Set(Int_t nbins, const Double_t *xbins)
    fXmin      = fXbins.fArray[0];
    fXmax      = fXbins.fArray[fNbins];
    if (!fParent) SetDefaults();
+   BuildBinLookup();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1110,6 +1184,7 @@ void TAxis::Streamer(TBuffer &R__b)
       Version_t R__v = R__b.ReadVersion(&R__s, &R__c);
       if (R__v > 5) {
          R__b.ReadClassBuffer(TAxis::Class(), this, R__v, R__s, R__c);
+         BuildBinLookup();
          return;
       }
       //====process old versions before automatic schema evolution
@@ -1146,6 +1221,7 @@ void TAxis::Streamer(TBuffer &R__b)
          SetTimeFormat();
       }
       R__b.CheckByteCount(R__s, R__c, TAxis::IsA());
+      BuildBinLookup();
       //====end of old versions
 
    } else {
@@ -1548,6 +1548,35 @@ Double_t TF1::EvalPar(const Double_t *x, const Double_t *params)
    return result;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the function at n points with the given parameters.
+///
+/// \param[in] x - The coordinates of the points, stored point after point,
+///                i.e. x[i * GetNdim() + j] is the coordinate j of point i.
+/// \param[in] n - The number of points.
+/// \param[out] out - Buffer of size n receiving the function values.
+/// \param[in] params - The parameter values, if nullptr the internal values are used.
+///
+/// Functions defined by a formula are evaluated with TFormula::EvalBatch, the
+/// others point by point with EvalPar.
+
+void TF1::EvalParBatch(const Double_t *x, std::size_t n, Double_t *out, const Double_t *params)
+{
+   if (fType == EFType::kFormula) {
+      assert(fFormula);
+      fFormula->EvalBatch(x, n, out, params);
+      if (fNormalized && fNormIntegral != 0) {
+         for (std::size_t i = 0; i < n; ++i)
+            out[i] /= fNormIntegral;
+      }
+      return;
+   }
+
+   const Int_t ndim = GetNdim();
+   for (std::size_t i = 0; i < n; ++i)
+      out[i] = EvalPar(x + i * ndim, params);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Execute action corresponding to one event.
 ///
@@ -2098,13 +2127,42 @@ Int_t TF1::GetQuantiles(Int_t nprobSum, Double_t *q, const Double_t *probSum)
 ///  Option can be used to force a log scale (option = "log"), linear (option = "lin") or automatic if empty.
 Bool_t TF1::ComputeCdfTable(Option_t * option) {
 
-   fIntegral.resize(fNpx + 1);
-   fAlpha.resize(fNpx + 1);
-   fBeta.resize(fNpx);
-   fGamma.resize(fNpx);
-   fIntegral[0] = 0;
-   fAlpha[fNpx] = 0;
-   Double_t integ;
+   ROOT::Math::CdfTableSampler sampler = MakeSampler(option);
+   if (!sampler.IsValid()) {
+      fCdfSampler.reset();
+      return kFALSE;
+   }
+   fCdfSampler = std::make_unique<ROOT::Math::CdfTableSampler>(std::move(sampler));
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return a sampler of this function shape, which tabulates the cumulative
+/// function at fNpx points between fXmin and fXmax, as used by GetRandom.
+///
+/// @param option Option string which controls the binning used to compute the integral, see GetRandom:
+///               -  "LOG" to force usage of log scale for tabulating the integral
+///               -  "LIN" to force usage of linear scale when tabulating the integral
+///
+/// The returned object does not depend on this function anymore and is
+/// immutable: unlike GetRandom, which builds its table on the first call, it
+/// can be used concurrently by several threads, each with its own random
+/// number generator, and it can generate many random numbers in one call:
+///
+/// ~~~ {.cpp}
+/// TF1 f1("f1", "gaus", -5, 5);
+/// f1.SetParameters(1, 0, 1);
+/// const auto sampler = f1.MakeSampler();
+/// TRandom3 rng(1);
+/// std::vector<double> x(1000000);
+/// sampler.Sample(rng, x.size(), x.data());
+/// ~~~
+///
+/// The sampler is invalid (see ROOT::Math::CdfTableSampler::IsValid) if the
+/// integral of the function is zero.
+
+ROOT::Math::CdfTableSampler TF1::MakeSampler(Option_t * option)
+{
    Int_t intNegative = 0;
    Int_t i;
    Bool_t logbin = kFALSE;
@@ -2117,11 +2175,10 @@ Bool_t TF1::ComputeCdfTable(Option_t * option) {
    // and the user explicitly does not specify a Linear binning option
    if (opt.Contains("LOG") || ((xmin > 0 && xmax / xmin > fNpx) && !opt.Contains("LIN"))) {
       logbin = kTRUE;
-      fAlpha[fNpx] = 1;
       xmin = TMath::Log10(fXmin);
       xmax = TMath::Log10(fXmax);
       if (gDebug)
-         Info("GetRandom", "Use log scale for tabulating the integral in [%f,%f] with %d points", fXmin, fXmax, fNpx);
+         Info("MakeSampler", "Use log scale for tabulating the integral in [%f,%f] with %d points", fXmin, fXmax, fNpx);
    }
    dx = (xmax - xmin) / fNpx;
 
@@ -2130,50 +2187,33 @@ Bool_t TF1::ComputeCdfTable(Option_t * option) {
       xx[i] = xmin + i * dx;
    }
    xx[fNpx] = xmax;
+   // integral of each bin and of its first half, used to approximate the
+   // the cumulative function by a parabola in each bin
+   std::vector<Double_t> integ(fNpx), halfInteg(fNpx);
    for (i = 0; i < fNpx; i++) {
       if (logbin) {
-         integ = Integral(TMath::Power(10, xx[i]), TMath::Power(10, xx[i + 1]), 0.0);
+         integ[i] = Integral(TMath::Power(10, xx[i]), TMath::Power(10, xx[i + 1]), 0.0);
       } else {
-         integ = Integral(xx[i], xx[i + 1], 0.0);
+         integ[i] = Integral(xx[i], xx[i + 1], 0.0);
       }
-      if (integ < 0) {
+      if (integ[i] < 0) {
          intNegative++;
-         integ = -integ;
+         integ[i] = -integ[i];
       }
-      fIntegral[i + 1] = fIntegral[i] + integ;
    }
    if (intNegative > 0) {
-      Warning("GetRandom", "function:%s has %d negative values: abs assumed", GetName(), intNegative);
-   }
-   if (fIntegral[fNpx] == 0) {
-      Error("GetRandom", "Integral of function is zero");
-      return kFALSE;
-   }
-   Double_t total = fIntegral[fNpx];
-   for (i = 1; i <= fNpx; i++) { // normalize integral to 1
-      fIntegral[i] /= total;
+      Warning("MakeSampler", "function:%s has %d negative values: abs assumed", GetName(), intNegative);
    }
-   // the integral r for each bin is approximated by a parabola
-   //  x = alpha + beta*r +gamma*r**2
-   // compute the coefficients alpha, beta, gamma for each bin
-   Double_t x0, r1, r2, r3;
    for (i = 0; i < fNpx; i++) {
-      x0 = xx[i];
-      r2 = fIntegral[i + 1] - fIntegral[i];
       if (logbin)
-         r1 = Integral(TMath::Power(10, x0), TMath::Power(10, x0 + 0.5 * dx), 0.0) / total;
-      else
-         r1 = Integral(x0, x0 + 0.5 * dx, 0.0) / total;
-      r3 = 2 * r2 - 4 * r1;
-      if (TMath::Abs(r3) > 1e-8)
-         fGamma[i] = r3 / (dx * dx);
+         halfInteg[i] = Integral(TMath::Power(10, xx[i]), TMath::Power(10, xx[i] + 0.5 * dx), 0.0);
       else
-         fGamma[i] = 0;
-      fBeta[i] = r2 / dx - fGamma[i] * dx;
-      fAlpha[i] = x0;
-      fGamma[i] *= 2;
+         halfInteg[i] = Integral(xx[i], xx[i] + 0.5 * dx, 0.0);
    }
-   return kTRUE;
+   ROOT::Math::CdfTableSampler sampler(fNpx, xmin, xmax, integ, halfInteg, logbin);
+   if (!sampler.IsValid())
+      Error("MakeSampler", "Integral of function is zero");
+   return sampler;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -2210,25 +2250,13 @@ Bool_t TF1::ComputeCdfTable(Option_t * option) {
 Double_t TF1::GetRandom(TRandom * rng, Option_t * option)
 {
    //  Check if integral array must be built
-   if (fIntegral.size() == 0) {
+   if (!fCdfSampler) {
       Bool_t ret = ComputeCdfTable(option);
       if (!ret) return TMath::QuietNaN();
    }
 
-
    // return random number
-   Double_t r  = (rng) ? rng->Rndm() : gRandom->Rndm();
-   Int_t bin  = TMath::BinarySearch(fNpx, fIntegral.data(), r);
-   Double_t rr = r - fIntegral[bin];
-
-   Double_t yy;
-   if (fGamma[bin] != 0)
-      yy = (-fBeta[bin] + TMath::Sqrt(fBeta[bin] * fBeta[bin] + 2 * fGamma[bin] * rr)) / fGamma[bin];
-   else
-      yy = rr / fBeta[bin];
-   Double_t x = fAlpha[bin] + yy;
-   if (fAlpha[fNpx] > 0) return TMath::Power(10, x);
-   return x;
+   return fCdfSampler->Sample(rng ? *rng : *gRandom);
 }
 
 
@@ -2263,7 +2291,7 @@ Double_t TF1::GetRandom(TRandom * rng, Option_t * option)
 Double_t TF1::GetRandom(Double_t xmin, Double_t xmax, TRandom * rng, Option_t * option)
 {
    //  Check if integral array must be built
-   if (fIntegral.size() == 0) {
+   if (!fCdfSampler) {
       Bool_t ret = ComputeCdfTable(option);
       if (!ret) return TMath::QuietNaN();
    }
@@ -2274,21 +2302,13 @@ Double_t TF1::GetRandom(Double_t xmin, Double_t xmax, TRandom * rng, Option_t *
    Int_t nbinmax = (Int_t)((xmax - fXmin) / dx) + 2;
    if (nbinmax > fNpx) nbinmax = fNpx;
 
-   Double_t pmin = fIntegral[nbinmin];
-   Double_t pmax = fIntegral[nbinmax];
+   Double_t pmin = fCdfSampler->Cdf(nbinmin);
+   Double_t pmax = fCdfSampler->Cdf(nbinmax);
 
-   Double_t r, x, xx, rr;
+   Double_t r, x;
    do {
       r  = (rng) ? rng->Uniform(pmin, pmax) : gRandom->Uniform(pmin, pmax);
-
-      Int_t bin  = TMath::BinarySearch(fNpx, fIntegral.data(), r);
-      rr = r - fIntegral[bin];
-
-      if (fGamma[bin] != 0)
-         xx = (-fBeta[bin] + TMath::Sqrt(fBeta[bin] * fBeta[bin] + 2 * fGamma[bin] * rr)) / fGamma[bin];
-      else
-         xx = rr / fBeta[bin];
-      x = fAlpha[bin] + xx;
+      x = fCdfSampler->Quantile(r);
    } while (x < xmin || x > xmax);
    return x;
 }
@@ -3664,10 +3684,8 @@ void TF1::Update()
    fHistogram = 0;
    if (!fIntegral.empty()) {
       fIntegral.clear();
-      fAlpha.clear();
-      fBeta.clear();
-      fGamma.clear();
    }
+   fCdfSampler.reset();
    if (fNormalized) {
       // need to compute the integral of the not-normalized function
       fNormalized = false;
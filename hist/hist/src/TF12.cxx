@@ -168,6 +168,16 @@ Double_t TF12::EvalPar(const Double_t *x, const Double_t *params)
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate this function at the n points x[0], ..., x[n-1]
+
+void TF12::EvalParBatch(const Double_t *x, std::size_t n, Double_t *out, const Double_t *params)
+{
+   for (std::size_t i = 0; i < n; ++i)
+      out[i] = EvalPar(x + i, params);
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Save primitive as a C++ statement(s) on output stream out
 
@@ -760,6 +760,8 @@ void TFormula::Copy(TObject &obj) const
    fnew.fHessGenerationInput = fHessGenerationInput;
    fnew.fGradFuncPtr = fGradFuncPtr;
    fnew.fHessFuncPtr = fHessFuncPtr;
+   fnew.fBatchFuncPtr = fBatchFuncPtr.load();
+   fnew.fBatchGenerationFailed = fBatchGenerationFailed.load();
 
 }
 
@@ -2332,6 +2334,9 @@ void TFormula::ProcessFormula(TString &formula)
          // set the cling name using hash of the static formulae map
          auto hasher = gClingFunctions.hash_function();
          fClingName = TString::Format("%s__id%zu", gNamePrefix.Data(), hasher(inputFormulaVecFlag));
+         // a batch evaluation loop compiled for a previous expression is not valid anymore
+         fBatchFuncPtr = nullptr;
+         fBatchGenerationFailed = false;
 
          fClingInput = TString::Format("%s %s(%s){ return %s ; }", argType.Data(), fClingName.Data(),
                                        argumentsPrototype.Data(), inputFormula.c_str());
@@ -3373,6 +3378,105 @@ void TFormula::HessianPar(const Double_t *x, Double_t *result) {
    CallCladFunction(fHessFuncPtr, vars, pars, result, fNpar * fNpar);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Compile with Cling a function evaluating the formula in a loop over many points.
+/// The formula expression is inlined in the loop body, such that the compiler
+/// can optimize and vectorize the loop as a whole.
+/// Returns true on success.
+
+bool TFormula::GenerateBatchEval()
+{
+   if (fBatchFuncPtr)
+      return true;
+   if (fBatchGenerationFailed)
+      return false;
+
+   R__LOCKGUARD(gROOTMutex);
+   // check again in case another thread has generated the function
+   if (fBatchFuncPtr)
+      return true;
+
+   // Formulas with the same expression share the same Cling name, so the loop
+   // may have been compiled already for another TFormula.
+   if (!functionExists(GetBatchFuncName())) {
+      TString expression = GetExpFormula("CLING");
+      TString batchInput = TString::Format("#pragma cling optimize(2)\n"
+                                           "void %s(Double_t *xs, Long64_t n, Double_t *__restrict out, Double_t *p) {\n"
+                                           "   for (Long64_t i = 0; i < n; ++i) {\n"
+                                           "      Double_t *x = xs + i * %d;\n"
+                                           "      out[i] = %s;\n"
+                                           "   }\n"
+                                           "}",
+                                           GetBatchFuncName().c_str(), fNdim, expression.Data());
+      if (!gInterpreter->Declare(batchInput)) {
+         Error("GenerateBatchEval", "Could not compile the batch evaluation of the formula %s", fClingName.Data());
+         fBatchGenerationFailed = true;
+         return false;
+      }
+   }
+
+   TMethodCall method;
+   method.InitWithPrototype(GetBatchFuncName().c_str(), "Double_t*,Long64_t,Double_t*,Double_t*");
+   CallFuncSignature funcPtr = method.IsValid() ? prepareFuncPtr(&method) : nullptr;
+   if (!funcPtr) {
+      fBatchGenerationFailed = true;
+      return false;
+   }
+   fBatchFuncPtr = funcPtr;
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the formula at n points in a single call.
+///
+/// \param[in] x - The variables of the points, stored contiguously point after
+///                point, i.e. x[i * GetNdim() + j] is the variable j of point i.
+///                If nullptr, the stored variables are used for all points.
+/// \param[in] n - The number of points.
+/// \param[out] out - Buffer of size n receiving the function values.
+/// \param[in] params - The parameter values, if nullptr the stored parameters are used.
+///
+/// The formula is evaluated by a loop compiled by Cling together with the formula
+/// expression. This avoids a call through the interpreter for each point and lets the
+/// compiler vectorize the loop, without requiring VecCore.
+/// Formulas built from lambda expressions as well as vectorized formulas are evaluated
+/// point by point with EvalPar.
+
+void TFormula::EvalBatch(const Double_t *x, std::size_t n, Double_t *out, const Double_t *params) const
+{
+   if (n == 0)
+      return;
+
+   const std::size_t stride = (x) ? fNdim : 0;
+   const Double_t *vars = (x) ? x : fClingVariables.data();
+
+   // The first point is evaluated with EvalPar, which takes care of the lazy initialization
+   // and of reporting invalid formulas.
+   out[0] = EvalPar(vars, params);
+   if (n == 1)
+      return;
+
+   if (fClingInitialized && !fVectorized && !TestBit(TFormula::kLambda) &&
+       const_cast<TFormula *>(this)->GenerateBatchEval()) {
+      void *args[4];
+      Double_t *xs = const_cast<Double_t *>(vars + stride);
+      Long64_t npoints = n - 1;
+      Double_t *res = out + 1;
+      Double_t *pars = (fNpar <= 0) ? nullptr
+                                    : ((params) ? const_cast<Double_t *>(params)
+                                                : const_cast<Double_t *>(fClingParameters.data()));
+      args[0] = &xs;
+      args[1] = &npoints;
+      args[2] = &res;
+      args[3] = &pars;
+      (*fBatchFuncPtr)(0, 4, args, /*ret*/ nullptr);
+      return;
+   }
+
+   for (std::size_t i = 1; i < n; ++i)
+      out[i] = EvalPar(vars + i * stride, params);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 #ifdef R__HAS_VECCORE
 // ROOT::Double_v TFormula::Eval(ROOT::Double_v x, ROOT::Double_v y, ROOT::Double_v z, ROOT::Double_v t) const
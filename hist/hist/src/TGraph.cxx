@@ -1013,6 +1013,88 @@ Double_t TGraph::Eval(Double_t x, TSpline *spline, Option_t *option) const
    return yn;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Linear interpolation at x between the points low and low+1 of a graph
+/// sorted in X, giving the same result as TGraph::Eval.
+
+static Double_t InterpolateSorted(const Double_t *xp, const Double_t *yp, Int_t low, Double_t x)
+{
+   if (xp[low] == x) return yp[low];
+   if (xp[low + 1] == x) return yp[low + 1];
+   if (xp[low] == xp[low + 1]) return yp[low];
+   return yp[low + 1] + (x - xp[low + 1]) * (yp[low] - yp[low + 1]) / (xp[low] - xp[low + 1]);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Linear interpolation at x, starting the search of the points around x from `hint`.
+///
+/// This requires the points to be sorted in X, which must be signalled by setting
+/// the bit TGraph::kIsSortedX. `hint` is the index of the lower point found by the
+/// previous call: the interval starting there is checked first, followed by the next
+/// one, before falling back to a binary search. On return it holds the index of the
+/// lower point around x. This is much faster than Eval(x) when x varies slowly between
+/// calls. Since the hint is owned by the caller, the graph is not modified and several
+/// threads can evaluate it concurrently, each with its own hint. Any value, e.g. 0, can
+/// be used as initial hint.
+///
+/// If the graph is not sorted, this is the same as Eval(x).
+
+Double_t TGraph::Eval(Double_t x, Int_t &hint) const
+{
+   if (fNpoints < 2 || !TestBit(TGraph::kIsSortedX))
+      return Eval(x);
+
+   const Int_t last = fNpoints - 2;
+   Int_t low = hint;
+   auto contains = [&](Int_t i) {
+      return (i == 0 || fX[i] <= x) && (i == last || x < fX[i + 1]);
+   };
+   if (low < 0 || low > last || !contains(low)) {
+      if (low >= 0 && low < last && contains(low + 1)) {
+         ++low;
+      } else {
+         low = TMath::BinarySearch(fNpoints, fX, x);
+         if (low < 0) low = 0;
+         if (low > last) low = last;
+      }
+   }
+   hint = low;
+   return InterpolateSorted(fX, fY, low, x);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Linear interpolation at the n points x, storing the results in y.
+///
+/// For graphs sorted in X (see TGraph::kIsSortedX) and points x sorted in increasing
+/// order, the points of the graph are walked linearly along with x. Points which are
+/// not in order are located with a binary search. The results are the same as the
+/// ones of Eval(x), which is used for graphs not sorted in X.
+
+void TGraph::Eval(Int_t n, const Double_t *x, Double_t *y) const
+{
+   if (fNpoints < 2 || !TestBit(TGraph::kIsSortedX)) {
+      for (Int_t i = 0; i < n; ++i)
+         y[i] = Eval(x[i]);
+      return;
+   }
+
+   const Int_t last = fNpoints - 2;
+   Int_t low = 0;
+   for (Int_t i = 0; i < n; ++i) {
+      const Double_t xi = x[i];
+      if (low > 0 && !(fX[low] <= xi)) {
+         // going backward
+         low = TMath::BinarySearch(fNpoints, fX, xi);
+         if (low < 0) low = 0;
+         if (low > last) low = last;
+      } else {
+         while (low < last && xi >= fX[low + 1])
+            ++low;
+      }
+      y[i] = InterpolateSorted(fX, fY, low, xi);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Execute action corresponding to one event.
 ///
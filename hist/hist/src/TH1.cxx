@@ -17,6 +17,7 @@
 #include <sstream>
 #include <cmath>
 #include <iostream>
+#include <vector>
 
 #include "TROOT.h"
 #include "TBuffer.h"
@@ -47,10 +48,12 @@
 #include "HFitInterface.h"
 #include "Fit/DataRange.h"
 #include "Fit/BinData.h"
+#include "Math/CdfTableSampler.h"
 #include "Math/GoFTest.h"
 #include "Math/MinimizerOptions.h"
 #include "Math/QuantFuncMathCore.h"
 
+#include "TH1Atomic.h"
 #include "TH1Merger.h"
 
 /** \addtogroup Histograms
@@ -3350,6 +3353,7 @@ TH1* TH1::FFT(TH1* h_output, Option_t *option)
 Int_t TH1::Fill(Double_t x)
 {
    if (fBuffer)  return BufferFill(x,1);
+   if (TestBit(kConcurrentFill)) return DoConcurrentFill(x, 1.);
 
    Int_t bin;
    fEntries++;
@@ -3383,6 +3387,7 @@ Int_t TH1::Fill(Double_t x, Double_t w)
 {
 
    if (fBuffer) return BufferFill(x,w);
+   if (TestBit(kConcurrentFill)) return DoConcurrentFill(x, w);
 
    Int_t bin;
    fEntries++;
@@ -3402,6 +3407,28 @@ Int_t TH1::Fill(Double_t x, Double_t w)
    return bin;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Increment bin with abscissa X with a weight w using atomic additions, see SetConcurrentFill().
+
+Int_t TH1::DoConcurrentFill(Double_t x, Double_t w)
+{
+   using ROOT::Internal::AtomicAdd;
+
+   AtomicAdd(fEntries, 1.);
+   const Int_t bin = fXaxis.FindBin(x);
+   if (bin < 0) return -1;
+   AtomicAdd(GetConcurrentFillArray()[bin], w);
+   if (fSumw2.fN) AtomicAdd(fSumw2.fArray[bin], w*w);
+   if (bin == 0 || bin > fXaxis.GetNbins()) {
+      if (!GetStatOverflowsBehaviour()) return -1;
+   }
+   AtomicAdd(fTsumw, w);
+   AtomicAdd(fTsumw2, w*w);
+   AtomicAdd(fTsumwx, w*x);
+   AtomicAdd(fTsumwx2, w*x*x);
+   return bin;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Increment bin with namex with a weight w
 ///
@@ -3524,13 +3551,12 @@ void TH1::DoFillN(Int_t ntimes, const Double_t *x, const Double_t *w, Int_t stri
 
 void TH1::FillRandom(const char *fname, Int_t ntimes, TRandom * rng)
 {
-   Int_t bin, binx, ibin, loop;
-   Double_t r1, x;
+   Int_t binx;
    //   - Search for fname in the list of ROOT defined functions
    TF1 *f1 = (TF1*)gROOT->GetFunction(fname);
    if (!f1) { Error("FillRandom", "Unknown function: %s",fname); return; }
 
-   //   - Allocate temporary space to store the integral and compute integral
+   //   - Compute the integral of the function in each bin
 
    TAxis * xAxis = &fXaxis;
 
@@ -3546,31 +3572,22 @@ void TH1::FillRandom(const char *fname, Int_t ntimes, TRandom * rng)
    Int_t last   = xAxis->GetLast();
    Int_t nbinsx = last-first+1;
 
-   Double_t *integral = new Double_t[nbinsx+1];
-   integral[0] = 0;
+   std::vector<Double_t> edges(nbinsx+1);
+   std::vector<Double_t> integral(nbinsx);
    for (binx=1;binx<=nbinsx;binx++) {
-      Double_t fint = f1->Integral(xAxis->GetBinLowEdge(binx+first-1),xAxis->GetBinUpEdge(binx+first-1), 0.);
-      integral[binx] = integral[binx-1] + fint;
+      edges[binx-1] = xAxis->GetBinLowEdge(binx+first-1);
+      integral[binx-1] = f1->Integral(xAxis->GetBinLowEdge(binx+first-1),xAxis->GetBinUpEdge(binx+first-1), 0.);
    }
+   edges[nbinsx] = xAxis->GetBinUpEdge(last);
 
    //   - Normalize integral to 1
-   if (integral[nbinsx] == 0 ) {
-      delete [] integral;
-      Error("FillRandom", "Integral = zero"); return;
+   const ROOT::Math::CdfTableSampler sampler(edges, integral);
+   if (!sampler.IsValid()) {
+      Error("FillRandom", "Integral = zero or negative"); return;
    }
-   for (bin=1;bin<=nbinsx;bin++)  integral[bin] /= integral[nbinsx];
 
    //   --------------Start main loop ntimes
-   for (loop=0;loop<ntimes;loop++) {
-      r1 = (rng) ? rng->Rndm() : gRandom->Rndm();
-      ibin = TMath::BinarySearch(nbinsx,&integral[0],r1);
-      //binx = 1 + ibin;
-      //x    = xAxis->GetBinCenter(binx); //this is not OK when SetBuffer is used
-      x    = xAxis->GetBinLowEdge(ibin+first)
-             +xAxis->GetBinWidth(ibin+first)*(r1-integral[ibin])/(integral[ibin+1] - integral[ibin]);
-      Fill(x);
-   }
-   delete [] integral;
+   DoFillRandom(sampler, ntimes, rng);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3657,12 +3674,26 @@ void TH1::FillRandom(TH1 *h, Int_t ntimes, TRandom * rng)
    }
    // case of different axis and not too large ntimes
 
-   if (h->ComputeIntegral() ==0) return;
-   Int_t loop;
-   Double_t x;
-   for (loop=0;loop<ntimes;loop++) {
-      x = h->GetRandom();
-      Fill(x);
+   const ROOT::Math::CdfTableSampler sampler = h->MakeSampler();
+   if (!sampler.IsValid()) return;
+   DoFillRandom(sampler, ntimes, rng);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Internal method filling the histogram with ntimes random numbers
+/// generated by sampler, using rng or gRandom if it is null.
+
+void TH1::DoFillRandom(const ROOT::Math::CdfTableSampler &sampler, Int_t ntimes, TRandom *rng)
+{
+   // the random numbers are generated in blocks
+   const Int_t kBlock = 1024;
+   TRandom &r = rng ? *rng : *gRandom;
+   std::vector<Double_t> x(TMath::Min(ntimes, kBlock));
+   for (Int_t loop = 0; loop < ntimes; loop += kBlock) {
+      const Int_t n = TMath::Min(kBlock, ntimes - loop);
+      sampler.Sample(r, n, x.data());
+      for (Int_t i = 0; i < n; ++i)
+         Fill(x[i]);
    }
 }
 
@@ -5010,6 +5041,36 @@ Double_t TH1::GetRandom(TRandom * rng) const
    return x;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return a sampler of the distribution of the bin contents, as used by
+/// GetRandom and FillRandom.
+///
+/// Unlike GetRandom, which caches the integral of the bins on its first call,
+/// this method does not modify the histogram, and the returned object is
+/// immutable: it can be shared by several threads, each with its own random
+/// number generator, and it can generate many random numbers in one call.
+/// It does not follow later changes of the histogram.
+/// NB Only valid for 1-d histograms. The sampler is invalid (see
+/// ROOT::Math::CdfTableSampler::IsValid) if a bin has negative content or if
+/// the histogram is empty.
+
+ROOT::Math::CdfTableSampler TH1::MakeSampler() const
+{
+   if (fDimension > 1) {
+      Error("MakeSampler","Function only valid for 1-d histograms");
+      return ROOT::Math::CdfTableSampler();
+   }
+   Int_t nbinsx = GetNbinsX();
+   std::vector<Double_t> edges(nbinsx+1);
+   std::vector<Double_t> contents(nbinsx);
+   for (Int_t bin = 1; bin <= nbinsx; ++bin) {
+      edges[bin-1] = GetBinLowEdge(bin);
+      contents[bin-1] = RetrieveBinContent(bin);
+   }
+   edges[nbinsx] = GetBinLowEdge(nbinsx+1);
+   return ROOT::Math::CdfTableSampler(edges, contents);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return content of bin number bin.
 ///
@@ -6663,6 +6724,38 @@ UInt_t TH1::SetCanExtend(UInt_t extendBitMask)
    return oldExtendBitMask;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Allow or forbid filling the histogram concurrently from several threads.
+///
+/// In concurrent fill mode, Fill(x) and Fill(x, w), as well as Fill(x, y[, w]) for TH2D and Fill(x, y, z[, w]) for
+/// TH3D, update the bin contents, the sums of squares of weights and the statistics with atomic additions. All
+/// threads can then fill the same histogram, instead of filling one copy each (e.g. with TThreadedObject) and
+/// merging the copies at the end. This saves memory for big histograms, and is fast when concurrent fills seldom
+/// hit the same bins.
+///
+/// Only TH1D, TH2D and TH3D support this mode. Enabling it empties and deletes the buffer, if any, makes the axes
+/// not extendable and, unless the kIsNotW bit is set, creates the structure storing the sum of squares of weights
+/// (see Sumw2()), as concurrent fills cannot do that on the fly.
+///
+/// While the histogram is filled concurrently, no other method may be called on it, including the other Fill
+/// overloads, FillN and the methods that read the bin contents or the statistics.
+
+void TH1::SetConcurrentFill(Bool_t enable)
+{
+   if (!enable) {
+      ResetBit(kConcurrentFill);
+      return;
+   }
+   if (!GetConcurrentFillArray()) {
+      Error("SetConcurrentFill", "concurrent fills are only supported by TH1D, TH2D and TH3D");
+      return;
+   }
+   if (fBuffer) BufferEmpty(1);
+   SetCanExtend(kNoAxis);
+   if (!fSumw2.fN && !TestBit(kIsNotW)) Sumw2();
+   SetBit(kConcurrentFill);
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// Internal function used in TH1::Fill to see which axis is full alphanumeric
 /// i.e. can be extended and is alphanumeric
@@ -0,0 +1,40 @@
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+// Atomic accumulation into the bins and statistics of histograms filled concurrently, see TH1::SetConcurrentFill()
+
+#ifndef ROOT_TH1Atomic
+#define ROOT_TH1Atomic
+
+#include "RtypesCore.h"
+
+#include <atomic>
+
+namespace ROOT {
+namespace Internal {
+
+/// Add `value` to `target` atomically. Concurrent calls for the same target never lose an addition, and concurrent
+/// non-atomic accesses to it are not allowed.
+inline void AtomicAdd(Double_t &target, Double_t value)
+{
+#ifdef __cpp_lib_atomic_ref
+   std::atomic_ref<Double_t>(target).fetch_add(value, std::memory_order_relaxed);
+#else
+   static_assert(sizeof(std::atomic<Double_t>) == sizeof(Double_t) && std::atomic<Double_t>::is_always_lock_free,
+                 "std::atomic<Double_t> must have the same layout as a Double_t");
+   auto &atomicTarget = reinterpret_cast<std::atomic<Double_t> &>(target);
+   Double_t expected = atomicTarget.load(std::memory_order_relaxed);
+   while (!atomicTarget.compare_exchange_weak(expected, expected + value, std::memory_order_relaxed))
+      ; // expected now holds the current value, try again
+#endif
+}
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
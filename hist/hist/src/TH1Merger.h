@@ -17,6 +17,8 @@
 #include "TProfile3D.h"
 #include "TList.h"
 
+#include <vector>
+
 class TH1Merger {
 
 public:
@@ -115,6 +117,9 @@ private:
 
    Bool_t SameAxesMerge();
 
+   template <class TArrayType>
+   Bool_t SameAxesArrayMerge(const std::vector<const TH1 *> &inputs);
+
    Bool_t DifferentAxesMerge();
 
    Bool_t LabelMerge();
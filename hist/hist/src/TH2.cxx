@@ -27,6 +27,7 @@
 #include "TObjArray.h"
 #include "TVirtualHistPainter.h"
 #include "snprintf.h"
+#include "TH1Atomic.h"
 
 ClassImp(TH2);
 
@@ -380,6 +381,7 @@ Int_t TH2::Fill(Double_t )
 Int_t TH2::Fill(Double_t x,Double_t y)
 {
    if (fBuffer) return BufferFill(x,y,1);
+   if (TestBit(kConcurrentFill)) return DoConcurrentFill(x, y, 1.);
 
    Int_t binx, biny, bin;
    fEntries++;
@@ -424,6 +426,7 @@ Int_t TH2::Fill(Double_t x,Double_t y)
 Int_t TH2::Fill(Double_t x, Double_t y, Double_t w)
 {
    if (fBuffer) return BufferFill(x,y,w);
+   if (TestBit(kConcurrentFill)) return DoConcurrentFill(x, y, w);
 
    Int_t binx, biny, bin;
    fEntries++;
@@ -452,6 +455,37 @@ Int_t TH2::Fill(Double_t x, Double_t y, Double_t w)
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Increment cell defined by x,y by a weight w using atomic additions, see TH1::SetConcurrentFill().
+
+Int_t TH2::DoConcurrentFill(Double_t x, Double_t y, Double_t w)
+{
+   using ROOT::Internal::AtomicAdd;
+
+   AtomicAdd(fEntries, 1.);
+   const Int_t binx = fXaxis.FindBin(x);
+   const Int_t biny = fYaxis.FindBin(y);
+   if (binx <0 || biny <0) return -1;
+   const Int_t bin  = biny*(fXaxis.GetNbins()+2) + binx;
+   AtomicAdd(GetConcurrentFillArray()[bin], w);
+   if (fSumw2.fN) AtomicAdd(fSumw2.fArray[bin], w*w);
+   if (binx == 0 || binx > fXaxis.GetNbins()) {
+      if (!GetStatOverflowsBehaviour()) return -1;
+   }
+   if (biny == 0 || biny > fYaxis.GetNbins()) {
+      if (!GetStatOverflowsBehaviour()) return -1;
+   }
+   AtomicAdd(fTsumw, w);
+   AtomicAdd(fTsumw2, w*w);
+   AtomicAdd(fTsumwx, w*x);
+   AtomicAdd(fTsumwx2, w*x*x);
+   AtomicAdd(fTsumwy, w*y);
+   AtomicAdd(fTsumwy2, w*y*y);
+   AtomicAdd(fTsumwxy, w*x*y);
+   return bin;
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Increment cell defined by namex,namey by a weight w
 ///
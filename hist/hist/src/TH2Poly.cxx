@@ -17,6 +17,7 @@
 #include "TList.h"
 #include "TMath.h"
 #include <cassert>
+#include <utility>
 
 ClassImp(TH2Poly);
 
@@ -118,6 +119,11 @@ only on that bins. This reduces considerably the number of bins on which `IsInsi
 is called and therefore speed up by a huge factor the filling compare to the brute force
 approach where `IsInside()` is called for all bins.
 
+`FindBin()` and `Fill()` do not use the cells but a quadtree built from the
+bounding boxes of the bins, which adapts to layouts with very uneven bin density:
+the histogram range is recursively split in four until each region overlaps
+at most a few bins. It is built at the first call after bins were added.
+
 The addition of bins to the appropriate cells is done when the bin is added
 to the histogram. To do this, `AddBin()` calls the
 `AddBinToPartition()` method.
@@ -255,6 +261,8 @@ Int_t TH2Poly::AddBin(TObject *poly)
 
    // Adds the bin to the partition matrix
    AddBinToPartition(bin);
+   // the quadtree is rebuilt when needed
+   fQuadTreeNodes.clear();
 
    return ibin;
 }
@@ -470,6 +478,98 @@ void TH2Poly::ChangePartition(Int_t n, Int_t m)
    while((obj = next())){   // Loop over bins and add them to the partition
       AddBinToPartition((TH2PolyBin*) obj);
    }
+   fQuadTreeNodes.clear();
+}
+
+namespace {
+/// Maximum number of bins overlapping a leaf of the quadtree, unless the leaf is at the maximal depth
+constexpr std::size_t kQuadTreeLeafSize = 8;
+constexpr Int_t kQuadTreeMaxDepth = 20;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Builds the quadtree of the bin bounding boxes, used by FindBin() and Fill().
+
+void TH2Poly::BuildQuadTree()
+{
+   fQuadTreeNodes.clear();
+   fQuadTreeBins.clear();
+   std::vector<QuadTreeBin_t> bins;
+   if (fBins) {
+      bins.reserve(fBins->GetSize());
+      TIter next(fBins);
+      TObject *obj;
+      while ((obj = next())) {
+         TH2PolyBin *bin = (TH2PolyBin*) obj;
+         bins.push_back({bin->GetXMin(), bin->GetXMax(), bin->GetYMin(), bin->GetYMax(), bin});
+      }
+   }
+   fQuadTreeNodes.emplace_back();
+   BuildQuadTreeNode(0, bins, fXaxis.GetXmin(), fXaxis.GetXmax(), fYaxis.GetXmin(), fYaxis.GetXmax(), 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Sets up the node inode covering [xlow, xup] x [ylow, yup], overlapped by the
+/// bounding boxes of bins. The node is split in four if it overlaps too many
+/// bins and if that separates them.
+
+void TH2Poly::BuildQuadTreeNode(Int_t inode, std::vector<QuadTreeBin_t> &bins, Double_t xlow, Double_t xup,
+                                Double_t ylow, Double_t yup, Int_t depth)
+{
+   const Double_t xmid = 0.5 * (xlow + xup);
+   const Double_t ymid = 0.5 * (ylow + yup);
+   fQuadTreeNodes[inode] = {xmid, ymid, -1, 0, 0};
+
+   if (bins.size() > kQuadTreeLeafSize && depth < kQuadTreeMaxDepth) {
+      // quadrant q is on the upper side of x if q & 1, on the upper side of y if q & 2
+      std::vector<QuadTreeBin_t> quadrants[4];
+      std::size_t nSplit = 0;
+      for (Int_t q = 0; q < 4; ++q) {
+         const Double_t qxlow = (q & 1) ? xmid : xlow, qxup = (q & 1) ? xup : xmid;
+         const Double_t qylow = (q & 2) ? ymid : ylow, qyup = (q & 2) ? yup : ymid;
+         for (const auto &bin : bins) {
+            if (bin.fXmax >= qxlow && bin.fXmin <= qxup && bin.fYmax >= qylow && bin.fYmin <= qyup)
+               quadrants[q].push_back(bin);
+         }
+         nSplit += quadrants[q].size();
+      }
+      // splitting is useless if all bins overlap all quadrants
+      if (nSplit < 4 * bins.size()) {
+         const Int_t children = fQuadTreeNodes.size();
+         fQuadTreeNodes[inode].fChildren = children;
+         fQuadTreeNodes.resize(children + 4);
+         for (Int_t q = 0; q < 4; ++q) {
+            BuildQuadTreeNode(children + q, quadrants[q], (q & 1) ? xmid : xlow, (q & 1) ? xup : xmid,
+                              (q & 2) ? ymid : ylow, (q & 2) ? yup : ymid, depth + 1);
+            std::vector<QuadTreeBin_t>().swap(quadrants[q]);
+         }
+         return;
+      }
+   }
+
+   fQuadTreeNodes[inode].fFirst = fQuadTreeBins.size();
+   fQuadTreeNodes[inode].fCount = bins.size();
+   fQuadTreeBins.insert(fQuadTreeBins.end(), bins.begin(), bins.end());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the first bin containing (x,y), which must be within the histogram
+/// range, or nullptr if there is none.
+
+TH2PolyBin *TH2Poly::FindBinInQuadTree(Double_t x, Double_t y)
+{
+   if (fQuadTreeNodes.empty()) BuildQuadTree();
+
+   const QuadTreeNode_t *node = &fQuadTreeNodes[0];
+   while (node->fChildren >= 0)
+      node = &fQuadTreeNodes[node->fChildren + (x >= node->fXmid) + 2 * (y >= node->fYmid)];
+
+   const QuadTreeBin_t *bin = fQuadTreeBins.data() + node->fFirst;
+   for (const QuadTreeBin_t *end = bin + node->fCount; bin != end; ++bin) {
+      if (x >= bin->fXmin && x <= bin->fXmax && y >= bin->fYmin && y <= bin->fYmax && bin->fBin->IsInside(x, y))
+         return bin->fBin;
+   }
+   return nullptr;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -555,28 +655,9 @@ Int_t TH2Poly::FindBin(Double_t x, Double_t y, Double_t)
    else if (x > fXaxis.GetXmin()) overflow += -1;
    if (overflow != -5) return overflow;
 
-   // Finds the cell (x,y) coordinates belong to
-   Int_t n = (Int_t)(floor((x-fXaxis.GetXmin())/fStepX));
-   Int_t m = (Int_t)(floor((y-fYaxis.GetXmin())/fStepY));
-
-   // Make sure the array indices are correct.
-   if (n>=fCellX) n = fCellX-1;
-   if (m>=fCellY) m = fCellY-1;
-   if (n<0)       n = 0;
-   if (m<0)       m = 0;
-
-   if (fIsEmpty[n+fCellX*m]) return -5;
-
-   TH2PolyBin *bin;
-
-   TIter next(&fCells[n+fCellX*m]);
-   TObject *obj;
-
-   // Search for the bin in the cell
-   while ((obj=next())) {
-      bin  = (TH2PolyBin*)obj;
-      if (bin->IsInside(x,y)) return bin->GetBinNumber();
-   }
+   // Search for the bin in the quadtree
+   TH2PolyBin *bin = FindBinInQuadTree(x, y);
+   if (bin) return bin->GetBinNumber();
 
    // If the search has not returned a bin, the point must be on "the sea"
    return -5;
@@ -621,52 +702,28 @@ Int_t TH2Poly::Fill(Double_t x, Double_t y, Double_t w)
       return overflow;
    }
 
-   // Finds the cell (x,y) coordinates belong to
-   Int_t n = (Int_t)(floor((x-fXaxis.GetXmin())/fStepX));
-   Int_t m = (Int_t)(floor((y-fYaxis.GetXmin())/fStepY));
-
-   // Make sure the array indices are correct.
-   if (n>=fCellX) n = fCellX-1;
-   if (m>=fCellY) m = fCellY-1;
-   if (n<0)       n = 0;
-   if (m<0)       m = 0;
-
-   if (fIsEmpty[n+fCellX*m]) {
-      fOverflow[4]+= w;
-      if (fSumw2.fN) fSumw2.fArray[4] += w*w;
-      return -5;
-   }
-
-   TH2PolyBin *bin;
-   Int_t bi;
-
-   TIter next(&fCells[n+fCellX*m]);
-   TObject *obj;
-
-   while ((obj=next())) {
-      bin  = (TH2PolyBin*)obj;
+   TH2PolyBin *bin = FindBinInQuadTree(x, y);
+   if (bin) {
       // needs to account offset in array for overflow bins
-      bi = bin->GetBinNumber()-1+kNOverflow;
-      if (bin->IsInside(x,y)) {
-         bin->Fill(w);
-
-         // Statistics
-         fTsumw   = fTsumw + w;
-         fTsumw2  = fTsumw2 + w*w;
-         fTsumwx  = fTsumwx + w*x;
-         fTsumwx2 = fTsumwx2 + w*x*x;
-         fTsumwy  = fTsumwy + w*y;
-         fTsumwy2 = fTsumwy2 + w*y*y;
-         if (fSumw2.fN) {
-            assert(bi < fSumw2.fN);
-            fSumw2.fArray[bi] += w*w;
-         }
-         fEntries++;
+      Int_t bi = bin->GetBinNumber()-1+kNOverflow;
+      bin->Fill(w);
+
+      // Statistics
+      fTsumw   = fTsumw + w;
+      fTsumw2  = fTsumw2 + w*w;
+      fTsumwx  = fTsumwx + w*x;
+      fTsumwx2 = fTsumwx2 + w*x*x;
+      fTsumwy  = fTsumwy + w*y;
+      fTsumwy2 = fTsumwy2 + w*y*y;
+      if (fSumw2.fN) {
+         assert(bi < fSumw2.fN);
+         fSumw2.fArray[bi] += w*w;
+      }
+      fEntries++;
 
-         SetBinContentChanged(kTRUE);
+      SetBinContentChanged(kTRUE);
 
-         return bin->GetBinNumber();
-      }
+      return bin->GetBinNumber();
    }
 
    fOverflow[4]+= w;
@@ -705,14 +762,15 @@ Int_t TH2Poly::Fill(const char* name, Double_t w)
 ///                      (array size must be ntimes*stride)
 /// \param [in] x:       array of x values to be histogrammed
 /// \param [in] y:       array of y values to be histogrammed
-/// \param [in] w:       array of weights
+/// \param [in] w:       array of weights, or nullptr for unit weights
 /// \param [in] stride:  step size through arrays x, y and w
 
 void TH2Poly::FillN(Int_t ntimes, const Double_t* x, const Double_t* y,
                                const Double_t* w, Int_t stride)
 {
+   ntimes *= stride;
    for (int i = 0; i < ntimes; i += stride) {
-      Fill(x[i], y[i], w[i]);
+      Fill(x[i], y[i], w ? w[i] : 1.);
    }
 }
 
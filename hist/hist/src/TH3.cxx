@@ -24,6 +24,7 @@
 #include "TError.h"
 #include "TMath.h"
 #include "TObjString.h"
+#include "TH1Atomic.h"
 
 ClassImp(TH3);
 
@@ -350,6 +351,7 @@ Int_t TH3::Fill(Double_t )
 Int_t TH3::Fill(Double_t x, Double_t y, Double_t z)
 {
    if (fBuffer) return BufferFill(x,y,z,1);
+   if (TestBit(kConcurrentFill)) return DoConcurrentFill(x, y, z, 1.);
 
    Int_t binx, biny, binz, bin;
    fEntries++;
@@ -398,6 +400,7 @@ Int_t TH3::Fill(Double_t x, Double_t y, Double_t z)
 Int_t TH3::Fill(Double_t x, Double_t y, Double_t z, Double_t w)
 {
    if (fBuffer) return BufferFill(x,y,z,w);
+   if (TestBit(kConcurrentFill)) return DoConcurrentFill(x, y, z, w);
 
    Int_t binx, biny, binz, bin;
    fEntries++;
@@ -433,6 +436,45 @@ Int_t TH3::Fill(Double_t x, Double_t y, Double_t z, Double_t w)
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Increment cell defined by x,y,z by a weight w using atomic additions, see TH1::SetConcurrentFill().
+
+Int_t TH3::DoConcurrentFill(Double_t x, Double_t y, Double_t z, Double_t w)
+{
+   using ROOT::Internal::AtomicAdd;
+
+   AtomicAdd(fEntries, 1.);
+   const Int_t binx = fXaxis.FindBin(x);
+   const Int_t biny = fYaxis.FindBin(y);
+   const Int_t binz = fZaxis.FindBin(z);
+   if (binx <0 || biny <0 || binz<0) return -1;
+   const Int_t bin  =  binx + (fXaxis.GetNbins()+2)*(biny + (fYaxis.GetNbins()+2)*binz);
+   AtomicAdd(GetConcurrentFillArray()[bin], w);
+   if (fSumw2.fN) AtomicAdd(fSumw2.fArray[bin], w*w);
+   if (binx == 0 || binx > fXaxis.GetNbins()) {
+      if (!GetStatOverflowsBehaviour()) return -1;
+   }
+   if (biny == 0 || biny > fYaxis.GetNbins()) {
+      if (!GetStatOverflowsBehaviour()) return -1;
+   }
+   if (binz == 0 || binz > fZaxis.GetNbins()) {
+      if (!GetStatOverflowsBehaviour()) return -1;
+   }
+   AtomicAdd(fTsumw, w);
+   AtomicAdd(fTsumw2, w*w);
+   AtomicAdd(fTsumwx, w*x);
+   AtomicAdd(fTsumwx2, w*x*x);
+   AtomicAdd(fTsumwy, w*y);
+   AtomicAdd(fTsumwy2, w*y*y);
+   AtomicAdd(fTsumwxy, w*x*y);
+   AtomicAdd(fTsumwz, w*z);
+   AtomicAdd(fTsumwz2, w*z*z);
+   AtomicAdd(fTsumwxz, w*x*z);
+   AtomicAdd(fTsumwyz, w*y*z);
+   return bin;
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Increment cell defined by namex,namey,namez by a weight w
 ///
@@ -270,9 +270,9 @@ ULong64_t THnSparseCoordCompression::GetHashFromCoords(const Int_t* coord) const
 {
    // Bins are addressed in two different modes, depending
    // on whether the compact bin index fits into a Long64_t or not.
-   // If it does, we can use it as a "perfect hash" for the TExMap.
+   // If it does, we can use it as a "perfect hash" for the bin index.
    // If not we build a hash from the compact bin index, and use that
-   // as the TExMap's hash.
+   // as the bin index's hash.
 
    if (fCoordBufferSize <= 8) {
       // fits into a Long64_t
@@ -318,9 +318,9 @@ ULong64_t THnSparseCoordCompression::GetHashFromBuffer(const Char_t* buf) const
 {
    // Bins are addressed in two different modes, depending
    // on whether the compact bin index fits into a Long64_t or not.
-   // If it does, we can use it as a "perfect hash" for the TExMap.
+   // If it does, we can use it as a "perfect hash" for the bin index.
    // If not we build a hash from the compact bin index, and use that
-   // as the TExMap's hash.
+   // as the bin index's hash.
 
    if (fCoordBufferSize <= 8) {
       // fits into a Long64_t
@@ -488,6 +488,61 @@ void THnSparseArrayChunk::Sumw2()
 
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Move the bins to a table of nSlots slots, a power of two; the stored hashes
+/// are reused.
+
+void THnSparseBinIndex::Rehash(std::size_t nSlots)
+{
+   std::vector<Slot_t> slots(nSlots, Slot_t{0, -1});
+   const std::size_t mask = nSlots - 1;
+   for (const Slot_t &slot : fSlots) {
+      if (slot.fBin < 0)
+         continue;
+      std::size_t i = Mix(slot.fHash) & mask;
+      while (slots[i].fBin >= 0)
+         i = (i + 1) & mask;
+      slots[i] = slot;
+   }
+   fSlots.swap(slots);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add a bin with the given hash; the bin must not be in the index yet.
+
+void THnSparseBinIndex::Insert(ULong64_t hash, Long64_t bin)
+{
+   if (2 * std::size_t(fSize + 1) > fSlots.size())
+      Rehash(fSlots.empty() ? 16 : 2 * fSlots.size());
+   const std::size_t mask = fSlots.size() - 1;
+   std::size_t i = Mix(hash) & mask;
+   while (fSlots[i].fBin >= 0)
+      i = (i + 1) & mask;
+   fSlots[i] = Slot_t{hash, bin};
+   ++fSize;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Make room for nbins bins without rehashing.
+
+void THnSparseBinIndex::Reserve(Long64_t nbins)
+{
+   std::size_t nSlots = 16;
+   while (nSlots < 2 * std::size_t(nbins))
+      nSlots *= 2;
+   if (nSlots > fSlots.size())
+      Rehash(nSlots);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove all bins and release the slots.
+
+void THnSparseBinIndex::Clear()
+{
+   std::vector<Slot_t>().swap(fSlots);
+   fSize = 0;
+}
+
 
 /** \class THnSparse
     \ingroup Hist
@@ -570,14 +625,13 @@ Translation from an n-dimensional bin coordinate to the linear index within
 the chunks is done by GetBin(). It creates a hash from the compacted bin
 coordinates (the hash of a bin coordinate is the compacted coordinate itself
 if it takes less than 8 bytes, the size of a Long64_t.
-This hash is used to lookup the linear index in the TExMap member fBins;
-the coordinates of the entry fBins points to is compared to the coordinates
-passed to GetBin(). If they do not match, these two coordinates have the same
-hash - which is extremely unlikely but (for the case where the compact bin
-coordinates are larger than 4 bytes) possible. In this case, fBinsContinued
-contains a chain of linear indexes with the same hash. Iterating through this
-chain and comparing each bin coordinates with the one passed to GetBin() will
-retrieve the matching bin.
+This hash is used to lookup the linear index in the open-addressing hash
+table fBins (see THnSparseBinIndex); for each entry with the same hash, the
+coordinates of the bin it points to are compared to the coordinates passed to
+GetBin(). If they do not match, these two coordinates have the same hash -
+which is extremely unlikely but (for the case where the compact bin coordinates
+are larger than 8 bytes) possible - and the lookup continues with the next
+entry with that hash.
 */
 
 
@@ -658,28 +712,14 @@ void THnSparse::FillExMap()
    THnSparseArrayChunk* chunk = 0;
    THnSparseCoordCompression compactCoord(*GetCompactCoord());
    Long64_t idx = 0;
-   if (2 * GetNbins() > fBins.Capacity())
-      fBins.Expand(3 * GetNbins());
+   fBins.Reserve(GetNbins());
    while ((chunk = (THnSparseArrayChunk*) iChunk())) {
       const Int_t chunkSize = chunk->GetEntries();
       Char_t* buf = chunk->fCoordinates;
       const Int_t singleCoordSize = chunk->fSingleCoordinateSize;
       const Char_t* endbuf = buf + singleCoordSize * chunkSize;
-      for (; buf < endbuf; buf += singleCoordSize, ++idx) {
-         Long64_t hash = compactCoord.GetHashFromBuffer(buf);
-         Long64_t linidx = fBins.GetValue(hash);
-         if (linidx) {
-            Long64_t nextidx = linidx;
-            while (nextidx) {
-               // must be a collision, so go to fBinsContinued.
-               linidx = nextidx;
-               nextidx = fBinsContinued.GetValue(linidx);
-            }
-            fBinsContinued.Add(linidx, idx + 1);
-         } else {
-            fBins.Add(hash, idx + 1);
-         }
-      }
+      for (; buf < endbuf; buf += singleCoordSize, ++idx)
+         fBins.Insert(compactCoord.GetHashFromBuffer(buf), idx);
    }
 }
 
@@ -690,9 +730,7 @@ void THnSparse::Reserve(Long64_t nbins) {
    if (!fBins.GetSize() && fBinContent.GetSize()) {
       FillExMap();
    }
-   if (2 * nbins > fBins.Capacity()) {
-      fBins.Expand(3 * nbins);
-   }
+   fBins.Reserve(nbins);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -792,19 +830,10 @@ Long64_t THnSparse::GetBinIndexForCurrentBin(Bool_t allocate)
    ULong64_t hash = cc->GetHash();
    if (fBinContent.GetSize() && !fBins.GetSize())
       FillExMap();
-   Long64_t linidx = (Long64_t) fBins.GetValue(hash);
-   while (linidx) {
-      // fBins stores index + 1!
-      THnSparseArrayChunk* chunk = GetChunk((linidx - 1)/ fChunkSize);
-      if (chunk->Matches((linidx - 1) % fChunkSize, cc->GetBuffer()))
-         return linidx - 1; // we store idx+1, 0 is "TExMap: not found"
-
-      Long64_t nextlinidx = fBinsContinued.GetValue(linidx);
-      if (!nextlinidx) break;
-
-      linidx = nextlinidx;
-   }
-   if (!allocate) return -1;
+   const Long64_t linidx = fBins.Find(hash, [this, cc](Long64_t bin) {
+      return GetChunk(bin / fChunkSize)->Matches(bin % fChunkSize, cc->GetBuffer());
+   });
+   if (linidx >= 0 || !allocate) return linidx;
 
    ++fFilledBins;
 
@@ -819,16 +848,7 @@ Long64_t THnSparse::GetBinIndexForCurrentBin(Bool_t allocate)
 
    // store translation between hash and bin
    newidx += (fBinContent.GetEntriesFast() - 1) * fChunkSize;
-   if (!linidx) {
-      // fBins didn't find it
-      if (2 * GetNbins() > fBins.Capacity())
-         fBins.Expand(3 * GetNbins());
-      fBins.Add(hash, newidx + 1);
-   } else {
-      // fBins contains one, but it's the wrong one;
-      // add entry to fBinsContinued.
-      fBinsContinued.Add(linidx, newidx + 1);
-   }
+   fBins.Insert(hash, newidx);
    return newidx;
 }
 
@@ -880,7 +900,7 @@ Double_t THnSparse::GetSparseFractionMem() const {
 
    Double_t size = 0.;
    size += fBinContent.GetEntries() * (GetChunkSize() * sizePerChunkElement + sizeof(THnSparseArrayChunk));
-   size += + 3 * sizeof(Long64_t) * fBins.GetSize() /* TExMap */;
+   size += fBins.GetMemorySize();
 
    Double_t nbinsTotal = 1.;
    for (Int_t d = 0; d < fNdimensions; ++d)
@@ -962,8 +982,7 @@ void THnSparse::Sumw2()
 void THnSparse::Reset(Option_t *option /*= ""*/)
 {
    fFilledBins = 0;
-   fBins.Delete();
-   fBinsContinued.Clear();
+   fBins.Clear();
    fBinContent.Delete();
    ResetBase(option);
 }
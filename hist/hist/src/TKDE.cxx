@@ -42,8 +42,13 @@
 #include "TF1.h"
 #include "TH1.h"
 #include "TVirtualPad.h"
+#include "TROOT.h"
 #include "TKDE.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
 ClassImp(TKDE);
 
 
@@ -68,7 +73,7 @@ TKDE::TKDE() :
    fGraph(nullptr),
    fUseMirroring(false), fMirrorLeft(false), fMirrorRight(false), fAsymLeft(false), fAsymRight(false),
    fUseBins(false), fNewData(false), fUseMinMaxFromData(false),
-   fNBins(0), fNEvents(0), fSumOfCounts(0), fUseBinsNEvents(0),
+   fNBins(0), fNEvents(0), fSumOfCounts(0), fUseBinsNEvents(0), fNGridPoints(0),
    fMean(0.),fSigma(0.), fSigmaRob(0.), fXMin(0.), fXMax(0.),
    fRho(0.), fAdaptiveBandwidthFactor(0.), fWeightSize(0)
 {
@@ -102,6 +107,7 @@ void TKDE::Instantiate(KernelFunction_Ptr kernfunc, UInt_t events, const Double_
    fNBins = events < 10000 ? 1000 : std::min(10000, int(events / 100)*10);
    fNEvents = events;
    fUseBinsNEvents = 10000;
+   fNGridPoints = 0;
    fMean = 0.0;
    fSigma = 0.0;
    fXMin = xMin;
@@ -389,6 +395,20 @@ void TKDE::SetRange(Double_t xMin, Double_t xMax) {
    fKernel.reset();
 }
 
+void TKDE::SetNGridPoints(UInt_t npoints) {
+   // Sets the number of equidistant points of the range at which the estimate is tabulated, 0 (default) to disable.
+   // Once it is tabulated, the estimate at points in the range is linearly interpolated between the two neighbouring
+   // grid points instead of summing the kernels of all data points, which makes the evaluations (e.g. of the
+   // function returned by GetFunction()) independent of the data size. Tabulating is fast for the built-in kernels,
+   // whose support is bounded: each data point only contributes to the grid points near it.
+   if (npoints == 1) {
+      Error("SetNGridPoints", "At least two grid points are needed for interpolating - keep the present value.");
+      return;
+   }
+   fNGridPoints = npoints;
+   fKernel.reset();
+}
+
 // private methods
 
 void TKDE::SetUseBins() {
@@ -608,6 +628,9 @@ void TKDE::SetKernel() {
    if (fIteration == kAdaptive) {
       fKernel->ComputeAdaptiveWeights();
    }
+   if (fNGridPoints > 1) {
+      fKernel->ComputeGrid(fNGridPoints);
+   }
    if (gDebug) {
       if (fIteration != kAdaptive)
          Info("SetKernel",
@@ -745,6 +768,9 @@ Double_t TKDE::operator()(Double_t x) const {
       // in case of failed re-initialization
       if (!fKernel) return TMath::QuietNaN();
    }
+   if (fKernel->HasGrid() && x >= fXMin && x <= fXMax) {
+      return fKernel->InterpolateGrid(x);
+   }
    return (*fKernel)(x);
 }
 
@@ -770,7 +796,9 @@ TKDE::TKernel::TKernel(Double_t weight, TKDE* kde) :
 // Internal class constructor
 fKDE(kde),
 fNWeights(kde->fData.size()),
-fWeights(1, weight)
+fWeights(1, weight),
+fGridMin(0.),
+fGridStep(0.)
 {}
 
 void TKDE::TKernel::ComputeAdaptiveWeights() {
@@ -780,6 +808,23 @@ void TKDE::TKernel::ComputeAdaptiveWeights() {
    // we will store computed adaptive weights in weights
    std::vector<Double_t> weights(n, fWeights[0]);
    bool useDataWeights = (fKDE->fBinCount.size() == n);
+   // the pilot estimate at each data point is the expensive part: compute it in parallel if possible.
+   // User defined kernels might not be thread safe.
+   std::vector<Double_t> pilot(n, 0.);
+   auto computePilot = [&](unsigned int i) {
+      if (!useDataWeights || fKDE->fBinCount[i] > 0)
+         pilot[i] = (*fKDE->fKernel)(fKDE->fData[i]);
+   };
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && fKDE->fKernelType != kUserDefined && n > 0) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(computePilot, ROOT::TSeq<unsigned int>(0, n), 8 * pool.GetPoolSize());
+   } else
+#endif
+   {
+      for (unsigned int i = 0; i < n; ++i)
+         computePilot(i);
+   }
    Double_t f = 0.0;
    for (unsigned int i = 0; i < n; ++i) {
       // for negative or null bin contents use the fixed weight value (fWeights[0])
@@ -787,7 +832,7 @@ void TKDE::TKernel::ComputeAdaptiveWeights() {
          weights[i] = fWeights[0];
          continue; // skip negative or null weights
       }
-      f = (*fKDE->fKernel)(fKDE->fData[i]);
+      f = pilot[i];
       if (f <= 0) {
          // this can happen when data are outside range and fAsymLeft or fAsymRight is on
          fKDE->Warning("ComputeAdativeWeights","function value is zero or negative for x = %f w = %f - set their bandwidth to zero",
@@ -811,6 +856,84 @@ void TKDE::TKernel::ComputeAdaptiveWeights() {
    //printf("adaptive bandwidth factor % f weight 0 %f , %f \n",fKDE->fAdaptiveBandwidthFactor, weights[0],fWeights[0] );
 }
 
+void TKDE::TKernel::ComputeGrid(UInt_t npoints) {
+   // Tabulates the estimate at npoints equidistant points between the range edges, for InterpolateGrid().
+   // Each data point is only added to the grid points within the support of its kernel, known for the built-in
+   // kernels; this is much faster than evaluating the estimate at each grid point. In multi-threaded mode the data
+   // points are split among tasks, each filling its own grid.
+   const Double_t xMin = fKDE->fXMin;
+   const Double_t xMax = fKDE->fXMax;
+   fGridMin = xMin;
+   fGridStep = (xMax - xMin) / (npoints - 1);
+   // half width of the kernel support, in units of the bandwidth (see e.g. GaussianKernel())
+   Double_t support = std::numeric_limits<Double_t>::infinity();
+   switch (fKDE->fKernelType) {
+      case kGaussian: support = 9.; break;
+      case kEpanechnikov:
+      case kBiweight:
+      case kCosineArch: support = 1.; break;
+      default: break;
+   }
+   const UInt_t n = fKDE->fData.size();
+   const Bool_t useCount = (fKDE->fBinCount.size() == n);
+   const Bool_t hasAdaptiveWeights = (fWeights.size() == n);
+   const Double_t lastPoint = npoints - 1;
+
+   auto fillGrid = [&](UInt_t first, UInt_t last) {
+      std::vector<Double_t> grid(npoints, 0.);
+      auto addKernel = [&](Double_t binCount, Double_t weight, Double_t xi) {
+         const Double_t invWeight = 1. / weight;
+         const Double_t lo = std::max(0., std::ceil((xi - support * weight - fGridMin) / fGridStep));
+         const Double_t hi = std::min(lastPoint, std::floor((xi + support * weight - fGridMin) / fGridStep));
+         for (Long64_t j = (Long64_t)lo; j <= (Long64_t)hi; ++j)
+            grid[j] += binCount * invWeight * (*fKDE->fKernelFunction)((fGridMin + j * fGridStep - xi) * invWeight);
+      };
+      for (UInt_t i = first; i < last; ++i) {
+         const Double_t weight = (hasAdaptiveWeights) ? fWeights[i] : fWeights[0];
+         // skip data points that have 0 bandwidth, as in operator()
+         if (weight == 0) continue;
+         const Double_t binCount = (useCount) ? fKDE->fBinCount[i] : 1.0;
+         addKernel(binCount, weight, fKDE->fData[i]);
+         if (fKDE->fAsymLeft)
+            addKernel(binCount, weight, 2. * xMin - fKDE->fData[i]);
+         if (fKDE->fAsymRight)
+            addKernel(binCount, weight, 2. * xMax - fKDE->fData[i]);
+      }
+      return grid;
+   };
+
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && fKDE->fKernelType != kUserDefined) {
+      ROOT::TThreadExecutor pool;
+      const UInt_t nChunks = std::min<UInt_t>(pool.GetPoolSize(), n / 1000 + 1);
+      const UInt_t chunkSize = (n + nChunks - 1) / nChunks;
+      auto fillChunk = [&](UInt_t chunk) {
+         return fillGrid(chunk * chunkSize, std::min(n, (chunk + 1) * chunkSize));
+      };
+      auto sumGrids = [](const std::vector<std::vector<Double_t>> &grids) {
+         std::vector<Double_t> sum(grids[0]);
+         for (std::size_t k = 1; k < grids.size(); ++k)
+            std::transform(sum.begin(), sum.end(), grids[k].begin(), sum.begin(), std::plus<Double_t>());
+         return sum;
+      };
+      fGrid = pool.MapReduce(fillChunk, ROOT::TSeq<UInt_t>(0, nChunks), sumGrids, nChunks);
+   } else
+#endif
+   {
+      fGrid = fillGrid(0, n);
+   }
+   for (auto &value : fGrid)
+      value /= fKDE->fSumOfCounts;
+}
+
+Double_t TKDE::TKernel::InterpolateGrid(Double_t x) const {
+   // Returns the estimate at x in the grid range, linearly interpolated between the tabulated values
+   const Double_t t = (x - fGridMin) / fGridStep;
+   const UInt_t j = std::min<UInt_t>(UInt_t(std::max(0., t)), fGrid.size() - 2);
+   const Double_t frac = t - j;
+   return (1. - frac) * fGrid[j] + frac * fGrid[j + 1];
+}
+
 Double_t TKDE::TKernel::GetWeight(Double_t x) const {
    // Returns the bandwidth
    return fWeights[fKDE->Index(x)];
@@ -790,6 +790,69 @@ Double_t TSpline3::Eval(Double_t x) const
    return fPoly[klow].Eval(x);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Eval this spline at x, starting the search of the knot interval from `hint`.
+///
+/// `hint` is the interval found by the previous call: it is checked first,
+/// followed by the next one, before falling back to FindX. On return it holds
+/// the interval containing x. This is much faster than Eval(x) when x varies
+/// slowly between calls. Since the hint is owned by the caller, the spline is
+/// not modified and several threads can evaluate it concurrently, each with
+/// its own hint. Any value, e.g. 0, can be used as initial hint.
+
+Double_t TSpline3::Eval(Double_t x, Int_t &hint) const
+{
+   if (fNp < 2)
+      return Eval(x);
+
+   const Int_t klast = fNp - 2;
+   Int_t k = hint;
+   auto contains = [&](Int_t i) {
+      return (i == 0 || fPoly[i].X() < x) && (i == klast || x <= fPoly[i + 1].X());
+   };
+   if (k < 0 || k > klast || !contains(k)) {
+      if (k >= 0 && k < klast && contains(k + 1)) {
+         ++k;
+      } else {
+         k = FindX(x);
+         if (k > klast) k = klast;
+      }
+   }
+   hint = k;
+   return fPoly[k].Eval(x);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Eval this spline at the n points x, storing the results in y.
+///
+/// If x is sorted in increasing order, the knots are walked linearly along with
+/// the points. Points which are not in order are located with FindX, so that the
+/// results are always the same as the ones of Eval(x).
+
+void TSpline3::Eval(Int_t n, const Double_t *x, Double_t *y) const
+{
+   if (fNp < 2) {
+      for (Int_t i = 0; i < n; ++i)
+         y[i] = Eval(x[i]);
+      return;
+   }
+
+   const Int_t klast = fNp - 2;
+   Int_t k = 0;
+   for (Int_t i = 0; i < n; ++i) {
+      const Double_t xi = x[i];
+      if (k > 0 && !(fPoly[k].X() < xi)) {
+         // going backward
+         k = FindX(xi);
+         if (k > klast) k = klast;
+      } else {
+         while (k < klast && xi > fPoly[k + 1].X())
+            ++k;
+      }
+      y[i] = fPoly[k].Eval(xi);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Derivative.
 
@@ -1,9 +1,12 @@
 #include "gtest/gtest.h"
 
 #include "THn.h"
+#include "THnSparse.h"
 #include "TH1.h"
 #include "TH2.h"
 
+#include <memory>
+
 // Filling THn
 TEST(THn, Fill) {
    Int_t bins[2] = {2, 3};
@@ -111,3 +114,54 @@ TEST(THn, Projection) {
    }
 
 }
+
+// Looking up many bins of a THnSparse, with compact coordinates larger than 8 bytes
+TEST(THnSparse, BinLookup) {
+   const Int_t ndim = 10;
+   Int_t bins[ndim];
+   Double_t xmin[ndim];
+   Double_t xmax[ndim];
+   for (Int_t d = 0; d < ndim; ++d) {
+      bins[d] = 100;
+      xmin[d] = 0.;
+      xmax[d] = 100.;
+   }
+   THnSparseD hs("hs", "hs", ndim, bins, xmin, xmax);
+
+   auto coords = [&](Int_t i, Int_t *idx) {
+      for (Int_t d = 0; d < ndim; ++d)
+         idx[d] = 1 + (i * (d + 7) + d * d) % 100;
+   };
+
+   const Int_t nfill = 20000;
+   Int_t idx[ndim];
+   for (Int_t i = 0; i < nfill; ++i) {
+      coords(i, idx);
+      hs.SetBinContent(idx, i + 1.);
+   }
+   EXPECT_EQ(nfill, hs.GetNbins());
+
+   auto check = [&](THnSparse &h) {
+      for (Int_t i = 0; i < nfill; ++i) {
+         coords(i, idx);
+         const Long64_t bin = h.GetBin(idx, kFALSE);
+         ASSERT_GE(bin, 0);
+         EXPECT_DOUBLE_EQ(i + 1., h.GetBinContent(bin));
+      }
+      idx[0] = 1;
+      for (Int_t d = 1; d < ndim; ++d)
+         idx[d] = 100;
+      EXPECT_EQ(-1, h.GetBin(idx, kFALSE));
+   };
+   check(hs);
+
+   // The clone is streamed and rebuilds the index from the chunks.
+   std::unique_ptr<THnSparse> clone(static_cast<THnSparse *>(hs.Clone()));
+   EXPECT_EQ(nfill, clone->GetNbins());
+   check(*clone);
+
+   hs.Reset();
+   EXPECT_EQ(0, hs.GetNbins());
+   coords(0, idx);
+   EXPECT_EQ(-1, hs.GetBin(idx, kFALSE));
+}
@@ -0,0 +1,84 @@
+#include "TF1.h"
+#include "TF2.h"
+#include "Fit/FitUtil.h"
+#include "Fit/UnBinData.h"
+#include "Math/Util.h"
+#include "Math/WrappedMultiTF1.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <vector>
+
+TEST(TF1, EvalParBatchFormula)
+{
+   TF1 f("f_batch_formula", "gaus", -5, 5);
+   f.SetParameters(2., 0.5, 1.2);
+   std::vector<double> x = {-3., -1., 0., 0.5, 1.7, 4.};
+   std::vector<double> out(x.size());
+   f.EvalParBatch(x.data(), x.size(), out.data());
+   for (std::size_t i = 0; i < x.size(); ++i)
+      EXPECT_DOUBLE_EQ(out[i], f.EvalPar(&x[i]));
+
+   const double p[] = {1., -0.5, 0.8};
+   f.EvalParBatch(x.data(), x.size(), out.data(), p);
+   for (std::size_t i = 0; i < x.size(); ++i)
+      EXPECT_DOUBLE_EQ(out[i], f.EvalPar(&x[i], p));
+
+   f.SetNormalized(true);
+   f.EvalParBatch(x.data(), x.size(), out.data());
+   for (std::size_t i = 0; i < x.size(); ++i)
+      EXPECT_DOUBLE_EQ(out[i], f.EvalPar(&x[i]));
+}
+
+TEST(TF1, EvalParBatchFunctor)
+{
+   TF1 f("f_batch_functor", [](double *x, double *p) { return p[0] * x[0] * x[0]; }, 0, 1, 1);
+   f.SetParameter(0, 3.);
+   std::vector<double> x = {0.1, 0.2, 0.7};
+   std::vector<double> out(x.size());
+   f.EvalParBatch(x.data(), x.size(), out.data());
+   for (std::size_t i = 0; i < x.size(); ++i)
+      EXPECT_DOUBLE_EQ(out[i], 3. * x[i] * x[i]);
+}
+
+TEST(WrappedMultiTF1, EvalBatch)
+{
+   TF2 f("f_batch_2d", "[0]*x + [1]*y*y", 0, 1, 0, 1);
+   f.SetParameters(2., -1.);
+   ROOT::Math::WrappedMultiTF1 wf(f, 2);
+
+   std::vector<double> x = {0.1, 0.4, 0.9};
+   std::vector<double> y = {0.3, 0.6, 0.2};
+   const double *coords[] = {x.data(), y.data()};
+   std::vector<double> out(x.size());
+   const double p[] = {1.5, 0.5};
+   wf.EvalBatch(x.size(), coords, p, out.data());
+   for (std::size_t i = 0; i < x.size(); ++i) {
+      const double point[] = {x[i], y[i]};
+      EXPECT_DOUBLE_EQ(out[i], wf(point, p));
+   }
+}
+
+TEST(FitUtil, EvaluateLogLBatch)
+{
+   TF1 f("f_batch_logl", "[0]*exp(-0.5*((x-[1])/[2])^2)", -5, 5);
+   f.SetParameters(1., 0.2, 1.3);
+   ROOT::Math::WrappedMultiTF1 wf(f, 1);
+
+   // more points than a single batch, and not a multiple of its size
+   const unsigned int n = 1000;
+   ROOT::Fit::UnBinData data(n);
+   for (unsigned int i = 0; i < n; ++i)
+      data.Add(-4. + 8. * i / n);
+
+   const double *p = f.GetParameters();
+   double expected = 0;
+   for (unsigned int i = 0; i < n; ++i)
+      expected -= ROOT::Math::Util::EvalLog(f.EvalPar(data.GetCoordComponent(i, 0), p));
+
+   unsigned int nPoints = 0;
+   double logl = ROOT::Fit::FitUtil::EvaluateLogL(wf, data, p, 0, false, nPoints, ROOT::EExecutionPolicy::kSequential);
+   EXPECT_EQ(nPoints, n);
+   EXPECT_NEAR(logl, expected, 1e-9 * std::abs(expected));
+}
@@ -2,8 +2,42 @@
 
 #include "TFormula.h"
 
+#include <vector>
+
 // Test that autoloading works (ROOT-9840)
 TEST(TFormula, Interp)
 {
   TFormula f("func", "TGeoBBox::DeclFileLine()");
 }
+
+// Test that EvalBatch gives the same results as EvalPar
+TEST(TFormula, EvalBatch)
+{
+   TFormula f("fbatch", "[0]*exp(-0.5*((x-[1])/[2])^2) + [3]*y");
+   const double params[] = {2., 0.5, 1.5, 0.25};
+   f.SetParameters(params);
+
+   constexpr std::size_t n = 1000;
+   std::vector<double> x(2 * n);
+   for (std::size_t i = 0; i < n; ++i) {
+      x[2 * i] = -5. + 10. * i / n;
+      x[2 * i + 1] = 0.01 * i;
+   }
+
+   std::vector<double> out(n);
+   f.EvalBatch(x.data(), n, out.data());
+   for (std::size_t i = 0; i < n; ++i)
+      EXPECT_DOUBLE_EQ(out[i], f.EvalPar(&x[2 * i]));
+
+   // explicit parameters
+   const double otherParams[] = {1., -1., 0.5, 2.};
+   f.EvalBatch(x.data(), n, out.data(), otherParams);
+   for (std::size_t i = 0; i < n; ++i)
+      EXPECT_DOUBLE_EQ(out[i], f.EvalPar(&x[2 * i], otherParams));
+
+   // copies share the compiled loop
+   TFormula g(f);
+   std::vector<double> outCopy(n);
+   g.EvalBatch(x.data(), n, outCopy.data(), otherParams);
+   EXPECT_EQ(out, outCopy);
+}
@@ -0,0 +1,79 @@
+#include "TGraph.h"
+#include "TSpline.h"
+#include "TMath.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+namespace {
+
+// Non equidistant knots and evaluation points covering the extrapolation regions, the knots themselves
+// and a step backward.
+std::vector<double> MakeKnots()
+{
+   std::vector<double> x;
+   for (int i = 0; i < 50; ++i)
+      x.push_back(0.1 * i * i);
+   return x;
+}
+
+std::vector<double> MakePoints(const std::vector<double> &knots)
+{
+   std::vector<double> x;
+   for (int i = 0; i < 1000; ++i)
+      x.push_back(-10. + 0.27 * i);
+   x.push_back(knots[3]);
+   x.push_back(knots.back());
+   x.push_back(50.);
+   x.push_back(50.001);
+   return x;
+}
+
+} // namespace
+
+TEST(TGraph, EvalHint)
+{
+   auto knots = MakeKnots();
+   std::vector<double> yknots;
+   for (auto x : knots)
+      yknots.push_back(TMath::Sin(0.3 * x));
+   TGraph g(knots.size(), knots.data(), yknots.data());
+   g.SetBit(TGraph::kIsSortedX);
+
+   auto points = MakePoints(knots);
+   std::vector<double> batch(points.size());
+   g.Eval(points.size(), points.data(), batch.data());
+
+   Int_t hint = 0;
+   for (std::size_t i = 0; i < points.size(); ++i) {
+      const double expected = g.Eval(points[i]);
+      EXPECT_NEAR(g.Eval(points[i], hint), expected, 1e-12) << "x = " << points[i];
+      EXPECT_NEAR(batch[i], expected, 1e-12) << "x = " << points[i];
+   }
+
+   // unsorted graphs use the regular evaluation
+   g.ResetBit(TGraph::kIsSortedX);
+   hint = 0;
+   EXPECT_EQ(g.Eval(points[10], hint), g.Eval(points[10]));
+}
+
+TEST(TSpline3, EvalHint)
+{
+   auto knots = MakeKnots();
+   std::vector<double> yknots;
+   for (auto x : knots)
+      yknots.push_back(TMath::Sin(0.3 * x));
+   TSpline3 s("s", knots.data(), yknots.data(), knots.size());
+
+   auto points = MakePoints(knots);
+   std::vector<double> batch(points.size());
+   s.Eval(points.size(), points.data(), batch.data());
+
+   Int_t hint = 0;
+   for (std::size_t i = 0; i < points.size(); ++i) {
+      const double expected = s.Eval(points[i]);
+      EXPECT_NEAR(s.Eval(points[i], hint), expected, 1e-9) << "x = " << points[i];
+      EXPECT_NEAR(batch[i], expected, 1e-9) << "x = " << points[i];
+   }
+}
@@ -1,8 +1,22 @@
 #include "gtest/gtest.h"
 
+#include "ROOT/TestSupport.hxx"
+
+#include "TAxis.h"
 #include "TH1.h"
+#include "TH1D.h"
 #include "TH1F.h"
+#include "TH2F.h"
+#include "TH3D.h"
 #include "THLimitsFinder.h"
+#include "TMath.h"
+#include "TRandom3.h"
+#include "TROOT.h"
+
+#include <cmath>
+#include <functional>
+#include <thread>
+#include <vector>
 
 // StatOverflows TH1
 TEST(TH1, StatOverflows)
@@ -46,3 +60,142 @@ TEST(THLimitsFinder, Degenerate)
    EXPECT_LE(xmin, centralValue - 5.);
    EXPECT_GE(xmax, centralValue + 5.);
 }
+
+// Concurrent fills of a TH1D and a TH3D shared by several threads
+TEST(TH1, ConcurrentFill)
+{
+   TH1D h1("h1", "h1", 10, 0, 10);
+   TH1D ref1("ref1", "ref1", 10, 0, 10);
+   TH3D h3("h3", "h3", 4, 0, 4, 4, 0, 4, 4, 0, 4);
+   TH3D ref3("ref3", "ref3", 4, 0, 4, 4, 0, 4, 4, 0, 4);
+   h1.SetConcurrentFill();
+   h3.SetConcurrentFill();
+   EXPECT_TRUE(h1.IsConcurrentFill());
+   EXPECT_FALSE(h1.CanExtendAllAxes());
+
+   // exactly representable values, so that the sums do not depend on the order of the additions
+   auto fill = [](TH1D &h, TH3D &h3d, int thread) {
+      for (int i = 0; i < 10000; ++i) {
+         h.Fill((i + thread) % 12 - 1, thread % 2 ? 0.5 : 2.);
+         h3d.Fill(i % 4, (i / 4) % 4, thread % 4);
+      }
+   };
+   std::vector<std::thread> threads;
+   for (int t = 0; t < 8; ++t)
+      threads.emplace_back(fill, std::ref(h1), std::ref(h3), t);
+   for (auto &t : threads)
+      t.join();
+   for (int t = 0; t < 8; ++t)
+      fill(ref1, ref3, t);
+
+   h1.SetConcurrentFill(kFALSE);
+   EXPECT_FALSE(h1.IsConcurrentFill());
+   EXPECT_EQ(ref1.GetEntries(), h1.GetEntries());
+   EXPECT_EQ(ref1.GetMean(), h1.GetMean());
+   EXPECT_EQ(ref1.GetStdDev(), h1.GetStdDev());
+   for (int bin = 0; bin <= 11; ++bin) {
+      EXPECT_EQ(ref1.GetBinContent(bin), h1.GetBinContent(bin));
+      EXPECT_EQ(ref1.GetBinError(bin), h1.GetBinError(bin));
+   }
+   EXPECT_EQ(ref3.GetEntries(), h3.GetEntries());
+   EXPECT_EQ(ref3.GetMean(3), h3.GetMean(3));
+   EXPECT_EQ(ref3.GetCovariance(1, 2), h3.GetCovariance(1, 2));
+   for (int bin = 0; bin < 6 * 6 * 6; ++bin)
+      EXPECT_EQ(ref3.GetBinContent(bin), h3.GetBinContent(bin));
+
+   // histograms with other types of bin contents do not support concurrent fills
+   TH1F h1f("h1f", "h1f", 10, 0, 10);
+   ROOT_EXPECT_ERROR(h1f.SetConcurrentFill(), "TH1F::SetConcurrentFill",
+                     "concurrent fills are only supported by TH1D, TH2D and TH3D");
+   EXPECT_FALSE(h1f.IsConcurrentFill());
+}
+
+// The bins of variable bin axes are the ones found by a binary search of the edges
+TEST(TAxis, FindBinVariable)
+{
+   // very uneven bins, including an empty one
+   std::vector<Double_t> edges{-5., -4.5, -1., 0., 1e-3, 1e-3, 0.1, 0.2, 7., 7.25, 100.};
+   for (int i = 1; i < 50; ++i)
+      edges.push_back(100. + i * i);
+   TAxis axis(edges.size() - 1, edges.data());
+
+   TRandom3 rng(1);
+   std::vector<Double_t> values(edges);
+   for (int i = 0; i < 10000; ++i)
+      values.push_back(rng.Uniform(-10., 2500.));
+   values.push_back(std::nextafter(100., 0.));
+   values.push_back(std::nextafter(7., 10.));
+
+   std::vector<Int_t> bins(values.size());
+   axis.FindFixBins(values.size(), values.data(), bins.data());
+   for (std::size_t i = 0; i < values.size(); ++i) {
+      const Double_t x = values[i];
+      Int_t expected;
+      if (x < edges.front())
+         expected = 0;
+      else if (!(x < edges.back()))
+         expected = edges.size();
+      else
+         expected = 1 + TMath::BinarySearch(edges.size(), edges.data(), x);
+      EXPECT_EQ(expected, axis.FindFixBin(x)) << x;
+      EXPECT_EQ(expected, axis.FindBin(x)) << x;
+      EXPECT_EQ(expected, bins[i]) << x;
+   }
+
+   // copies and axes set again use their own edges
+   TAxis copy(axis);
+   EXPECT_EQ(axis.FindFixBin(50.), copy.FindFixBin(50.));
+   copy.Set(4, 0., 8.);
+   EXPECT_EQ(2, copy.FindFixBin(3.));
+   const Double_t newEdges[] = {0., 1., 10.};
+   copy.Set(2, newEdges);
+   EXPECT_EQ(2, copy.FindFixBin(5.));
+}
+
+// Merging histograms with the same axes sums their content and error arrays
+TEST(TH1, MergeSameAxes)
+{
+   auto check = [](Bool_t imt) {
+#ifdef R__USE_IMT
+      if (imt)
+         ROOT::EnableImplicitMT(4);
+#else
+      if (imt)
+         return;
+#endif
+      TRandom3 r(7);
+      TH2F h0("h0", "h0", 300, 0., 1., 300, 0., 1.);
+      h0.Sumw2();
+      TList inputs;
+      inputs.SetOwner();
+      std::vector<Double_t> content(h0.GetNcells()), sumw2(h0.GetNcells());
+      for (Int_t i = 0; i < 5; ++i) {
+         auto h = new TH2F(TString::Format("h%d", i + 1), "h", 300, 0., 1., 300, 0., 1.);
+         // the odd ones have no Sumw2: their errors squared are the contents
+         if (i % 2 == 0)
+            h->Sumw2();
+         for (Int_t j = 0; j < 20000; ++j)
+            h->Fill(r.Rndm(), r.Rndm(), (i % 2 == 0) ? r.Rndm() : 1.);
+         for (Int_t bin = 0; bin < h0.GetNcells(); ++bin) {
+            content[bin] += h->GetBinContent(bin);
+            sumw2[bin] += std::pow(h->GetBinError(bin), 2);
+         }
+         inputs.Add(h);
+      }
+      // an empty histogram is skipped
+      inputs.Add(new TH2F("empty", "h", 300, 0., 1., 300, 0., 1.));
+
+      h0.Merge(&inputs);
+      EXPECT_DOUBLE_EQ(5 * 20000, h0.GetEntries());
+      for (Int_t bin = 0; bin < h0.GetNcells(); ++bin) {
+         EXPECT_NEAR(content[bin], h0.GetBinContent(bin), 1.E-5 * (1. + content[bin]));
+         EXPECT_NEAR(sumw2[bin], std::pow(h0.GetBinError(bin), 2), 1.E-9 * (1. + sumw2[bin]));
+      }
+#ifdef R__USE_IMT
+      if (imt)
+         ROOT::DisableImplicitMT();
+#endif
+   };
+   check(kFALSE);
+   check(kTRUE);
+}
@@ -0,0 +1,72 @@
+// test TH2Poly::FindBin and Fill on a layout with very uneven bin density
+
+#include "gtest/gtest.h"
+
+#include "TH2Poly.h"
+#include "TList.h"
+#include "TRandom3.h"
+
+#include <vector>
+
+// Returns the first bin containing (x,y) by looping over all bins, -5 if there is none.
+static Int_t FindBinBruteForce(TH2Poly &h2p, Double_t x, Double_t y)
+{
+   TIter next(h2p.GetBins());
+   while (auto bin = static_cast<TH2PolyBin *>(next())) {
+      if (bin->IsInside(x, y))
+         return bin->GetBinNumber();
+   }
+   return -5;
+}
+
+TEST(TH2Poly, FindBinUnevenDensity)
+{
+   TH2Poly h2p("h2p", "uneven", 0., 100., 0., 100.);
+   // fine rectangular "pixels" in a corner
+   for (int i = 0; i < 100; ++i)
+      for (int j = 0; j < 100; ++j)
+         h2p.AddBin(i * 0.1, j * 0.1, (i + 1) * 0.1, (j + 1) * 0.1);
+   // coarse "towers" elsewhere, leaving a gap next to the pixels
+   for (int i = 1; i < 10; ++i)
+      h2p.AddBin(i * 10., 20., (i + 1) * 10., 100.);
+   // a triangle overlapping some towers
+   Double_t xt[] = {30., 70., 50., 30.};
+   Double_t yt[] = {10., 10., 60., 10.};
+   h2p.AddBin(4, xt, yt);
+
+   TRandom3 r(42);
+   for (int k = 0; k < 20000; ++k) {
+      // half of the points in the dense corner
+      const Double_t x = (k % 2) ? r.Uniform(0., 10.) : r.Uniform(0., 100.);
+      const Double_t y = (k % 2) ? r.Uniform(0., 10.) : r.Uniform(0., 100.);
+      ASSERT_EQ(FindBinBruteForce(h2p, x, y), h2p.FindBin(x, y)) << "x = " << x << " y = " << y;
+   }
+
+   // bins added after a lookup are found as well
+   const Int_t last = h2p.AddBin(10., 10., 20., 20.);
+   EXPECT_EQ(last, h2p.FindBin(15., 15.));
+   EXPECT_EQ(last, h2p.Fill(15., 15., 2.));
+   EXPECT_DOUBLE_EQ(2., h2p.GetBinContent(last));
+}
+
+TEST(TH2Poly, FillN)
+{
+   TH2Poly h2p("h2p", "fill", 0., 4., 0., 4.);
+   h2p.AddBin(0., 0., 2., 2.);
+   h2p.AddBin(2., 2., 4., 4.);
+
+   std::vector<Double_t> x{1., 100., 3., 0., 1., 0., 3.5, 0.};
+   std::vector<Double_t> y{1., 1., 3., 0., 1.5, 0., 3.5, 0.};
+   std::vector<Double_t> w{1., 0., 2., 0., 3., 0., 4., 0.};
+
+   // every second entry, with weights
+   h2p.FillN(4, x.data(), y.data(), w.data(), 2);
+   EXPECT_DOUBLE_EQ(4., h2p.GetBinContent(1));
+   EXPECT_DOUBLE_EQ(6., h2p.GetBinContent(2));
+
+   // without weights
+   h2p.FillN(3, x.data(), y.data(), nullptr);
+   EXPECT_DOUBLE_EQ(5., h2p.GetBinContent(1));
+   EXPECT_DOUBLE_EQ(1., h2p.GetBinContent(-6)); // x overflow
+   EXPECT_DOUBLE_EQ(7., h2p.GetBinContent(2));
+}
@@ -496,4 +496,27 @@ TEST(TKDE, tkde_io_mirror)
    for (size_t i = 0; i < t.xtest.size(); ++i) {
       EXPECT_NEAR(t.values1[i], t.values2[i], delta);
    }
-}
\ No newline at end of file
+}
+/// Interpolated evaluations from the tabulated estimate must be close to the exact ones
+TEST(TKDE, tkde_grid)
+{
+   TRandom3 r(1234);
+   const int n = 20000;
+   std::vector<double> data(n);
+   for (auto &x : data)
+      x = r.Gaus(10, 3);
+
+   for (const char *opt : {"KernelType:Gaussian;Iteration:Fixed;Binning:Unbinned",
+                           "KernelType:Epanechnikov;Iteration:Adaptive;Binning:ForcedBinning",
+                           "KernelType:Gaussian;Iteration:Fixed;Mirror:MirrorAsymBoth;Binning:Unbinned"}) {
+      TKDE exact(n, data.data(), 0., 20., opt, 1);
+      TKDE grid(n, data.data(), 0., 20., opt, 1);
+      grid.SetNGridPoints(4001);
+      for (int i = 0; i <= 200; ++i) {
+         const double x = 0.1 * i + 0.0123;
+         EXPECT_NEAR(exact(x), grid(x), 1.E-5) << opt << " x = " << x;
+      }
+      // outside the range the exact estimate is used
+      EXPECT_DOUBLE_EQ(exact(-1.), grid(-1.)) << opt;
+   }
+}
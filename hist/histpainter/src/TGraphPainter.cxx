@@ -36,7 +36,10 @@
 #include "TRegexp.h"
 #include "strlcpy.h"
 #include "snprintf.h"
+#include "TEnv.h"
+#include "TVirtualPS.h"
 #include <memory>
+#include <vector>
 
 Int_t TGraphPainter::fgMaxPointsPerLine = 50;
 
@@ -46,6 +49,93 @@ static std::unique_ptr<TMarker> gHighlightMarker;    // highlight marker
 
 ClassImp(TGraphPainter);
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return kTRUE if the points of the graphs should be reduced to the pad
+/// resolution before being painted (see \ref GrP9).
+
+static Bool_t IsDecimationEnabled()
+{
+   if (!gEnv->GetValue("Graph.Decimation", 1)) return kFALSE;
+   if (gVirtualPS && !gEnv->GetValue("Graph.Decimation.Print", 1)) return kFALSE;
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the width in pixels of the current pad.
+
+static Int_t PadPixelWidth()
+{
+   return TMath::Abs(gPad->UtoAbsPixel(1) - gPad->UtoAbsPixel(0));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Reduce in place the polyline (x,y), given in pad coordinates, to the
+/// points visible at the pad resolution and return the new number of points.
+///
+/// Each run of consecutive points falling in the same pixel column is
+/// replaced by its first, lowest, highest and last points, in their original
+/// order, so that the polyline lights the same pixels as the full one.
+
+static Int_t DecimatePolyLine(Int_t n, Double_t *x, Double_t *y)
+{
+   if (n <= 4*PadPixelWidth() || !IsDecimationEnabled()) return n;
+
+   Int_t nout  = 0;
+   Int_t first = 0;
+   while (first < n) {
+      Int_t column = gPad->XtoAbsPixel(x[first]);
+      Int_t last   = first;
+      Int_t imin   = first;
+      Int_t imax   = first;
+      while (last+1 < n && gPad->XtoAbsPixel(x[last+1]) == column) {
+         last++;
+         if (y[last] < y[imin]) imin = last;
+         if (y[last] > y[imax]) imax = last;
+      }
+      Int_t keep[4] = {first, TMath::Min(imin,imax), TMath::Max(imin,imax), last};
+      for (Int_t k=0; k<4; k++) {
+         if (k && keep[k] == keep[k-1]) continue;
+         x[nout] = x[keep[k]];
+         y[nout] = y[keep[k]];
+         nout++;
+      }
+      first = last+1;
+   }
+   return nout;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Reduce in place the polymarker (x,y), given in pad coordinates, by
+/// removing the points falling in a pixel of the pad where a previous point
+/// is already drawn, and return the new number of points. Points outside the
+/// pad are kept.
+
+static Int_t DecimatePolyMarker(Int_t n, Double_t *x, Double_t *y)
+{
+   if (n <= 4*PadPixelWidth() || !IsDecimationEnabled()) return n;
+
+   Int_t px0 = TMath::Min(gPad->UtoAbsPixel(0), gPad->UtoAbsPixel(1));
+   Int_t py0 = TMath::Min(gPad->VtoAbsPixel(0), gPad->VtoAbsPixel(1));
+   Int_t nx  = PadPixelWidth() + 1;
+   Int_t ny  = TMath::Abs(gPad->VtoAbsPixel(1) - gPad->VtoAbsPixel(0)) + 1;
+   std::vector<bool> drawn(Long64_t(nx)*ny, false);
+
+   Int_t nout = 0;
+   for (Int_t i=0; i<n; i++) {
+      Int_t ix = gPad->XtoAbsPixel(x[i]) - px0;
+      Int_t iy = gPad->YtoAbsPixel(y[i]) - py0;
+      if (ix >= 0 && ix < nx && iy >= 0 && iy < ny) {
+         Long64_t pixel = Long64_t(iy)*nx + ix;
+         if (drawn[pixel]) continue;
+         drawn[pixel] = true;
+      }
+      x[nout] = x[i];
+      y[nout] = y[i];
+      nout++;
+   }
+   return nout;
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -66,6 +156,7 @@ ClassImp(TGraphPainter);
 - [Reverse graphs' axis](\ref GrP6)
 - [Graphs in logarithmic scale](\ref GrP7)
 - [Highlight mode for graph](\ref GrP8)
+- [Drawing graphs with many points](\ref GrP9)
 
 
 \anchor GrP0
@@ -650,6 +741,28 @@ NOTE all parameters of user function are taken from
 
 For more complex demo please see for example `$ROOTSYS/tutorials/math/hlquantiles.C` file.
 
+\anchor GrP9
+### Drawing graphs with many points
+
+When a graph has many more points than the pad has pixels, most of them
+cannot be distinguished on the screen and drawing them only slows down the
+graphics backend and inflates the output files. Before being sent to the pad,
+the points of the options `L`, `P` and `*` are therefore reduced to what can
+actually be seen at the current pad resolution:
+
+  - A polyline keeps, for each run of consecutive points falling in the same
+    pixel column, the first, the lowest, the highest and the last point. The
+    drawn line covers exactly the same pixels as the full one.
+  - A polymarker keeps only the first point drawn in each pixel.
+
+The reduction is computed each time the pad is painted, so zooming on the
+graph shows all the points of the zoomed range. It is applied only when the
+graph has at least four times more points than the pad pixel width, and not
+to the fill area, smooth curve and bar chart options.
+The reduction can be disabled with the resource `Graph.Decimation: 0`; the
+resource `Graph.Decimation.Print: 0` keeps all the points when the pad is
+printed to a PostScript, PDF, SVG or TeX file only.
+
 */
 
 
@@ -1476,7 +1589,8 @@ void TGraphPainter::PaintGraph(TGraph *theGraph, Int_t npoints, const Double_t *
                }
                if (optionLine) {
                   if (TMath::Abs(theGraph->GetLineWidth())>99) PaintPolyLineHatches(theGraph, npt, gyworkl.data(), gxworkl.data());
-                  gPad->PaintPolyLine(npt,gyworkl.data(),gxworkl.data());
+                  Int_t nline = DecimatePolyLine(npt,gyworkl.data(),gxworkl.data());
+                  gPad->PaintPolyLine(nline,gyworkl.data(),gxworkl.data());
                }
             } else {
                if (optionFill) {
@@ -1485,7 +1599,8 @@ void TGraphPainter::PaintGraph(TGraph *theGraph, Int_t npoints, const Double_t *
                }
                if (optionLine) {
                   if (TMath::Abs(theGraph->GetLineWidth())>99) PaintPolyLineHatches(theGraph, npt, gxworkl.data(), gyworkl.data());
-                  gPad->PaintPolyLine(npt,gxworkl.data(),gyworkl.data());
+                  Int_t nline = DecimatePolyLine(npt,gxworkl.data(),gyworkl.data());
+                  gPad->PaintPolyLine(nline,gxworkl.data(),gyworkl.data());
                }
             }
             gxwork[0] = gxwork[npt-1];  gywork[0] = gywork[npt-1];
@@ -1569,6 +1684,8 @@ void TGraphPainter::PaintGraph(TGraph *theGraph, Int_t npoints, const Double_t *
          npt++;
          if (i == npoints) {
             ComputeLogs(npt, optionZ);
+            if (optionR)  npt = DecimatePolyMarker(npt,gyworkl.data(),gxworkl.data());
+            else          npt = DecimatePolyMarker(npt,gxworkl.data(),gyworkl.data());
             if (optionR)  gPad->PaintPolyMarker(npt,gyworkl.data(),gxworkl.data());
             else          gPad->PaintPolyMarker(npt,gxworkl.data(),gyworkl.data());
             npt = 0;
@@ -1584,6 +1701,8 @@ void TGraphPainter::PaintGraph(TGraph *theGraph, Int_t npoints, const Double_t *
          npt++;
          if (i == npoints) {
             ComputeLogs(npt, optionZ);
+            if (optionR) npt = DecimatePolyMarker(npt,gyworkl.data(),gxworkl.data());
+            else         npt = DecimatePolyMarker(npt,gxworkl.data(),gyworkl.data());
             if (optionR) gPad->PaintPolyMarker(npt,gyworkl.data(),gxworkl.data());
             else         gPad->PaintPolyMarker(npt,gxworkl.data(),gyworkl.data());
             npt = 0;
@@ -1047,6 +1047,11 @@ All the non-empty bins are painted. Empty bins are not painted unless
 some bins have a negative content because in that case the null bins
 might be not empty.
 
+In cartesian coordinates, the consecutive bins of a row having the same color
+are painted as a single box. This does not change the picture, but it reduces
+the size of the vector graphics files and the drawing time of histograms with
+a fine binning.
+
 `TProfile2D` histograms are handled differently because, for this type of 2D
 histograms, it is possible to know if an empty bin has been filled or not. So even
 if all the bins' contents are positive some empty bins might be painted. And vice versa,
@@ -5809,7 +5814,20 @@ void THistPainter::PaintColorLevels(Option_t*)
    if (!fH->TestBit(TH1::kUserContour)) fH->SetContour(ndiv);
    Double_t scale = (dz ? ndivz / dz : 1.0);
 
+   // In cartesian coordinates, the consecutive bins of a row having the same
+   // color are painted as a single box. This does not change the picture but
+   // strongly reduces the number of boxes sent to the pad for fine binnings.
    Int_t color;
+   Int_t runColor = -1;
+   Double_t runXlow = 0, runXup = 0, runYlow = 0, runYup = 0;
+   Double_t tolerance = 1e-9*TMath::Abs(gPad->GetUxmax() - gPad->GetUxmin());
+   auto paintRun = [&]() {
+      if (runColor < 0) return;
+      fH->SetFillColor(gStyle->GetColorPalette(runColor));
+      fH->TAttFill::Modify();
+      gPad->PaintBox(runXlow, runYlow, runXup, runYup);
+      runColor = -1;
+   };
    TProfile2D* prof2d = dynamic_cast<TProfile2D*>(fH);
    for (Int_t j=Hparam.yfirst; j<=Hparam.ylast;j++) {
       yk    = fYaxis->GetBinLowEdge(j);
@@ -5885,16 +5903,27 @@ void THistPainter::PaintColorLevels(Option_t*)
 
          Int_t theColor = Int_t((color+0.99)*Float_t(ncolors)/Float_t(ndivz));
          if (theColor > ncolors-1) theColor = ncolors-1;
-         fH->SetFillColor(gStyle->GetColorPalette(theColor));
-         fH->TAttFill::Modify();
          if (Hoption.System != kPOLAR) {
-            gPad->PaintBox(xlow, ylow, xup, yup);
+            if (theColor == runColor && ylow == runYlow && yup == runYup &&
+                TMath::Abs(xlow - runXup) <= tolerance) {
+               runXup = xup;
+               continue;
+            }
+            paintRun();
+            runColor = theColor;
+            runXlow  = xlow;
+            runXup   = xup;
+            runYlow  = ylow;
+            runYup   = yup;
          } else  {
+            fH->SetFillColor(gStyle->GetColorPalette(theColor));
+            fH->TAttFill::Modify();
             TCrown crown(0,0,ylow,yup,xlow*TMath::RadToDeg(),xup*TMath::RadToDeg());
             crown.SetFillColor(gStyle->GetColorPalette(theColor));
             crown.Paint();
          }
       }
+      paintRun();
    }
 
    if (Hoption.Zscale) PaintPalette();
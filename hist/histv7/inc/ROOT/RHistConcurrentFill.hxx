@@ -17,9 +17,12 @@
 #define ROOT7_RHistConcurrentFill
 
 #include "ROOT/RSpan.hxx"
+#include "ROOT/RHist.hxx"
 #include "ROOT/RHistBufferedFill.hxx"
 
+#include <memory>
 #include <mutex>
+#include <vector>
 
 namespace ROOT {
 namespace Experimental {
@@ -106,6 +109,114 @@ public:
    }
 };
 
+/**
+ \class RHistShardedFiller
+ Buffers a thread's Fill calls and submits them to the thread's own shard of the
+ histogram, handed out by a RHistShardedFillManager. Enables multi-threaded
+ filling without locking.
+ **/
+
+template <class HIST, int SIZE>
+class RHistShardedFiller: public Internal::RHistBufferedFillBase<RHistShardedFiller<HIST, SIZE>, HIST, SIZE> {
+   HIST &fShard;
+
+public:
+   using CoordArray_t = typename HIST::CoordArray_t;
+   using Weight_t = typename HIST::Weight_t;
+
+   RHistShardedFiller(HIST &shard): fShard(shard) {}
+
+   /// Thread-specific HIST::Fill().
+   using Internal::RHistBufferedFillBase<RHistShardedFiller<HIST, SIZE>, HIST, SIZE>::Fill;
+
+   /// Thread-specific HIST::FillN().
+   void FillN(const std::span<const CoordArray_t> xN, const std::span<const Weight_t> weightN)
+   {
+      fShard.FillN(xN, weightN);
+   }
+
+   /// Thread-specific HIST::FillN().
+   void FillN(const std::span<const CoordArray_t> xN) { fShard.FillN(xN); }
+
+   static constexpr int GetNDim() { return HIST::GetNDim(); }
+
+private:
+   friend class Internal::RHistBufferedFillBase<RHistShardedFiller<HIST, SIZE>, HIST, SIZE>;
+   void FlushImpl() { fShard.FillN(this->GetCoords(), this->GetWeights()); }
+};
+
+/**
+ \class RHistShardedFillManager
+ Hands out fillers that fill private shards of a histogram.
+
+ The HIST template must be a RHist instance. Contrary to
+ RHistConcurrentFillManager, whose fillers serialize their flushes through a
+ mutex, each RHistShardedFiller fills its own, empty copy of the histogram;
+ fills from different threads thus never contend. The shards are added to the
+ histogram lazily, when it is read through GetHist() and when the manager is
+ destructed.
+
+ As each shard has the size of the whole histogram, this suits histograms that
+ are small compared to the amount of data filled into them. Growing axes are
+ not supported: all shards must keep the binning of the histogram.
+ **/
+
+template <class HIST, int SIZE = 1024>
+class RHistShardedFillManager {
+public:
+   using Hist_t = HIST;
+   using CoordArray_t = typename HIST::CoordArray_t;
+   using Weight_t = typename HIST::Weight_t;
+
+private:
+   HIST &fHist;
+   std::mutex fShardMutex; ///< Protects fShards
+   std::vector<std::unique_ptr<HIST>> fShards;
+
+   /// Add the content of all shards to the histogram, and empty them.
+   void ReduceShards()
+   {
+      for (auto &shard : fShards) {
+         Add(fHist, *shard);
+         ResetShard(*shard);
+      }
+   }
+
+   static void ResetShard(HIST &shard)
+   {
+      auto &impl = *shard.GetImpl();
+      using Stat_t = typename std::remove_reference_t<decltype(impl)>::Stat_t;
+      impl.GetStat() = Stat_t(impl.GetNBinsNoOver(), impl.GetNOverflowBins());
+   }
+
+public:
+   RHistShardedFillManager(HIST &hist): fHist(hist) {}
+   RHistShardedFillManager(const RHistShardedFillManager &) = delete;
+   RHistShardedFillManager &operator=(const RHistShardedFillManager &) = delete;
+   ~RHistShardedFillManager() { ReduceShards(); }
+
+   /// Create a filler with its own shard. A filler must only be used by one
+   /// thread at a time, and must not outlive the manager.
+   RHistShardedFiller<HIST, SIZE> MakeFiller()
+   {
+      std::lock_guard<std::mutex> lockGuard(fShardMutex);
+      auto shard = std::make_unique<HIST>(fHist);
+      ResetShard(*shard);
+      fShards.emplace_back(std::move(shard));
+      return RHistShardedFiller<HIST, SIZE>{*fShards.back()};
+   }
+
+   /// Add the shards to the histogram and return it. The fillers must have been
+   /// flushed (e.g. destructed), and must not fill concurrently to this call;
+   /// they can keep filling afterwards.
+   HIST &GetHist()
+   {
+      std::lock_guard<std::mutex> lockGuard(fShardMutex);
+      ReduceShards();
+      return fHist;
+   }
+};
+
 } // namespace Experimental
 } // namespace ROOT
 
@@ -120,6 +120,10 @@ public:
    /// calls to Fill().
    int64_t GetEntries() const { return fEntries; }
 
+   /// Add `nentries` to the number of entries, for fills that update the bin
+   /// contents directly instead of calling Fill().
+   void AddEntries(int64_t nentries) { fEntries += nentries; }
+
    /// Get the number of bins exluding under- and overflow.
    size_t sizeNoOver() const noexcept { return fBinContent.size(); }
 
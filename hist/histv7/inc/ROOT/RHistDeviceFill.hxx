@@ -0,0 +1,164 @@
+/// \file ROOT/RHistDeviceFill.hxx
+/// \ingroup HistV7
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RHistDeviceFill
+#define ROOT7_RHistDeviceFill
+
+#include "ROOT/RAxis.hxx"
+#include "ROOT/RHist.hxx"
+#include "ROOT/RHistDeviceGrid.hxx"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+namespace Internal {
+
+/// Which statistics of `HIST` can be updated by a RHistDeviceFiller.
+template <class HIST>
+struct RHistDeviceFillTraits {
+   static constexpr bool kSupported = false;
+};
+
+template <int DIMENSIONS, class PRECISION, template <int D_, class P_> class... STAT>
+struct RHistDeviceFillTraits<RHist<DIMENSIONS, PRECISION, STAT...>> {
+   static constexpr bool kSupported =
+      DIMENSIONS <= RHistDeviceGrid::kMaxNDim &&
+      ((std::is_same<STAT<DIMENSIONS, PRECISION>, RHistStatContent<DIMENSIONS, PRECISION>>::value ||
+        std::is_same<STAT<DIMENSIONS, PRECISION>, RHistStatUncertainty<DIMENSIONS, PRECISION>>::value) &&
+       ...);
+   static constexpr bool kHasContent =
+      (std::is_same<STAT<DIMENSIONS, PRECISION>, RHistStatContent<DIMENSIONS, PRECISION>>::value || ...);
+   static constexpr bool kHasUncertainty =
+      (std::is_same<STAT<DIMENSIONS, PRECISION>, RHistStatUncertainty<DIMENSIONS, PRECISION>>::value || ...);
+};
+
+} // namespace Internal
+
+/**
+ \class RHistDeviceFiller
+ Fills a histogram from coordinates and weights residing in the memory of a
+ CUDA device, e.g. the output of a GPU inference or an analysis batch.
+
+ The bin contents are accumulated on the device with atomic updates; they are
+ copied back once and added to the histogram by Flush(), which is also called by
+ the destructor. The histogram must not be filled or read concurrently to
+ Flush().
+
+ Only histograms with up to three equidistant, non-growing axes (RAxisEquidistant)
+ recording RHistStatContent and optionally RHistStatUncertainty are supported,
+ e.g. RH1D, RH2F or RH3D. NaN coordinates are counted in the overflow bin.
+
+ Requires libROOTHistCUDA, which is only built with `-Dcuda=ON`, and a device of
+ compute capability 6.0 or higher.
+ **/
+
+template <class HIST>
+class RHistDeviceFiller {
+public:
+   using Hist_t = HIST;
+   using Weight_t = typename HIST::Weight_t;
+   static constexpr int GetNDim() { return HIST::GetNDim(); }
+
+private:
+   using Traits_t = Internal::RHistDeviceFillTraits<HIST>;
+   static_assert(Traits_t::kSupported && Traits_t::kHasContent,
+                 "RHistDeviceFiller only supports histograms with up to 3 dimensions recording RHistStatContent and "
+                 "optionally RHistStatUncertainty");
+
+   HIST &fHist;
+   Internal::RHistDeviceGrid fGrid;
+   std::int64_t fEntries = 0; ///< Number of entries filled on the device since the last Flush()
+
+   static std::array<Internal::RHistDeviceGrid::RAxisParams, GetNDim()> GetAxisParams(const HIST &hist)
+   {
+      std::array<Internal::RHistDeviceGrid::RAxisParams, GetNDim()> params;
+      for (int i = 0; i < GetNDim(); ++i) {
+         auto axis = dynamic_cast<const RAxisEquidistant *>(&hist.GetImpl()->GetAxis(i));
+         if (!axis || axis->CanGrow())
+            throw std::runtime_error("RHistDeviceFiller only supports equidistant, non-growing axes");
+         params[i].fNBins = axis->GetNBinsNoOver();
+         params[i].fLow = axis->GetMinimum();
+         params[i].fInvBinWidth = axis->GetInverseBinWidth();
+      }
+      return params;
+   }
+
+public:
+   /// Fill `hist` on the device, enqueuing the kernels on the CUDA `stream`
+   /// (a `cudaStream_t`), or on the default stream if nullptr.
+   explicit RHistDeviceFiller(HIST &hist, void *stream = nullptr)
+      : fHist(hist), fGrid(GetNDim(), GetAxisParams(hist).data(), Traits_t::kHasUncertainty, stream)
+   {
+   }
+   RHistDeviceFiller(const RHistDeviceFiller &) = delete;
+   RHistDeviceFiller &operator=(const RHistDeviceFiller &) = delete;
+   ~RHistDeviceFiller() { Flush(); }
+
+   /// Fill `n` entries. `x` holds, for each axis, a device array of `n`
+   /// coordinates; `weights` is a device array of `n` weights, or nullptr for
+   /// unit weights. The device arrays must stay valid until the kernel has run
+   /// on the stream.
+   void FillN(const std::array<const double *, GetNDim()> &x, std::size_t n, const double *weights = nullptr)
+   {
+      if (n == 0)
+         return;
+      fGrid.Fill(x.data(), weights, n);
+      fEntries += n;
+   }
+
+   /// Copy the sums accumulated on the device back and add them to the histogram.
+   void Flush()
+   {
+      if (fEntries == 0)
+         return;
+
+      std::vector<double> content;
+      std::vector<double> sumw2;
+      fGrid.Collect(content, sumw2);
+
+      auto &impl = *fHist.GetImpl();
+      auto &stat = impl.GetStat();
+      using BinArray_t = typename std::remove_reference_t<decltype(impl)>::BinArray_t;
+      BinArray_t localBins;
+      for (std::size_t cell = 0; cell < content.size(); ++cell) {
+         if (content[cell] == 0. && (sumw2.empty() || sumw2[cell] == 0.))
+            continue;
+         // Convert the cell into the local bins of the axes: -1 for underflow, -2
+         // for overflow, 1 to nbins for regular bins.
+         std::size_t rest = cell;
+         for (int i = 0; i < GetNDim(); ++i) {
+            const int nbins = fGrid.GetAxis(i).fNBins;
+            const int c = rest % (nbins + 2);
+            rest /= nbins + 2;
+            localBins[i] = (c == 0) ? RAxisBase::kUnderflowBin : (c == nbins + 1) ? RAxisBase::kOverflowBin : c;
+         }
+         const int binidx = impl.GetBinIndexFromLocalBins(localBins);
+         stat.GetBinContent(binidx) += static_cast<Weight_t>(content[cell]);
+         if constexpr (Traits_t::kHasUncertainty)
+            stat.GetSumOfSquaredWeights(binidx) += sumw2[cell];
+      }
+      stat.AddEntries(fEntries);
+      fEntries = 0;
+   }
+};
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
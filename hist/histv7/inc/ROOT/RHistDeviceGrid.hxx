@@ -0,0 +1,77 @@
+/// \file ROOT/RHistDeviceGrid.hxx
+/// \ingroup HistV7
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RHistDeviceGrid
+#define ROOT7_RHistDeviceGrid
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace ROOT {
+namespace Experimental {
+namespace Internal {
+
+/**
+ \class RHistDeviceGrid
+ Bin contents of a histogram with up to three equidistant axes, kept in the
+ memory of a CUDA device.
+
+ The grid has `nbins + 2` cells along each axis: cell 0 is the underflow, cells
+ 1 to nbins the regular bins and cell nbins + 1 the overflow; the first axis
+ runs fastest. Implemented in libROOTHistCUDA, which is only built with
+ `-Dcuda=ON`.
+ **/
+
+class RHistDeviceGrid {
+public:
+   static constexpr int kMaxNDim = 3;
+
+   /// Binning of an equidistant axis.
+   struct RAxisParams {
+      int fNBins = 0;            ///< Number of regular bins
+      double fLow = 0.;          ///< Lower edge of the first regular bin
+      double fInvBinWidth = 1.;  ///< Inverse of the bin width
+   };
+
+private:
+   int fNDim;                                ///< Number of axes
+   std::array<RAxisParams, kMaxNDim> fAxes;  ///< Binning of the axes
+   std::size_t fNCells = 1;                  ///< Number of cells, including under- and overflow
+   void *fStream;                            ///< CUDA stream (cudaStream_t), or nullptr for the default stream
+   double *fContent = nullptr;               ///< Device array of the sums of weights, one per cell
+   double *fSumW2 = nullptr;                 ///< Device array of the sums of squared weights, or nullptr
+
+public:
+   RHistDeviceGrid(int ndim, const RAxisParams *axes, bool withSumW2, void *stream);
+   RHistDeviceGrid(const RHistDeviceGrid &) = delete;
+   RHistDeviceGrid &operator=(const RHistDeviceGrid &) = delete;
+   ~RHistDeviceGrid();
+
+   std::size_t GetNCells() const { return fNCells; }
+   const RAxisParams &GetAxis(int iAxis) const { return fAxes[iAxis]; }
+
+   /// Enqueue the fill of `n` entries. `x` holds one device array of coordinates
+   /// per axis, `weights` is a device array or nullptr for unit weights.
+   void Fill(const double *const *x, const double *weights, std::size_t n);
+
+   /// Copy the accumulated sums to the host and reset them on the device.
+   /// `sumw2` is left untouched if the grid does not record squared weights.
+   void Collect(std::vector<double> &content, std::vector<double> &sumw2);
+};
+
+} // namespace Internal
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
@@ -0,0 +1,183 @@
+/// \file RHistDeviceGrid.cu
+/// \ingroup HistV7
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "ROOT/RHistDeviceGrid.hxx"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+using RAxisParams = ROOT::Experimental::Internal::RHistDeviceGrid::RAxisParams;
+constexpr int kMaxNDim = ROOT::Experimental::Internal::RHistDeviceGrid::kMaxNDim;
+
+void CheckCudaError(cudaError_t error, const char *where)
+{
+   if (error != cudaSuccess)
+      throw std::runtime_error(std::string("RHistDeviceGrid::") + where + ": " + cudaGetErrorString(error));
+}
+
+/// Kernel arguments, passed by value.
+struct RFillArgs {
+   int fNDim;
+   RAxisParams fAxes[kMaxNDim];
+   const double *fX[kMaxNDim];
+   const double *fWeights;
+   std::size_t fN;
+   std::size_t fNCells;
+   double *fContent;
+   double *fSumW2;
+};
+
+/// Number of threads per block of the fill kernels.
+constexpr int kBlockSize = 256;
+
+/// Largest number of cells for which the blocks accumulate in shared memory.
+constexpr std::size_t kMaxSharedCells = 2048;
+
+/// Same binning as RAxisEquidistant::FindBin(), with NaN going to the overflow.
+__device__ std::size_t FindCell(const RFillArgs &args, std::size_t i)
+{
+   std::size_t cell = 0;
+   std::size_t stride = 1;
+   for (int d = 0; d < args.fNDim; ++d) {
+      const RAxisParams &axis = args.fAxes[d];
+      const double rawbin = (args.fX[d][i] - axis.fLow) * axis.fInvBinWidth;
+      int c;
+      if (rawbin < 0.)
+         c = 0;
+      else if (rawbin < axis.fNBins)
+         c = static_cast<int>(rawbin) + 1;
+      else
+         c = axis.fNBins + 1;
+      cell += c * stride;
+      stride *= axis.fNBins + 2;
+   }
+   return cell;
+}
+
+/// Fill global memory directly, for grids too large for shared memory.
+__global__ void FillGlobal(RFillArgs args)
+{
+   for (std::size_t i = blockIdx.x * blockDim.x + threadIdx.x; i < args.fN; i += blockDim.x * gridDim.x) {
+      const std::size_t cell = FindCell(args, i);
+      const double w = args.fWeights ? args.fWeights[i] : 1.;
+      atomicAdd(&args.fContent[cell], w);
+      if (args.fSumW2)
+         atomicAdd(&args.fSumW2[cell], w * w);
+   }
+}
+
+/// Accumulate each block's entries in shared memory, and add them to global
+/// memory once per block: this reduces the contention on the global atomics.
+__global__ void FillShared(RFillArgs args)
+{
+   extern __shared__ double shared[];
+   double *content = shared;
+   double *sumw2 = args.fSumW2 ? shared + args.fNCells : nullptr;
+   const std::size_t nShared = args.fSumW2 ? 2 * args.fNCells : args.fNCells;
+   for (std::size_t c = threadIdx.x; c < nShared; c += blockDim.x)
+      shared[c] = 0.;
+   __syncthreads();
+
+   for (std::size_t i = blockIdx.x * blockDim.x + threadIdx.x; i < args.fN; i += blockDim.x * gridDim.x) {
+      const std::size_t cell = FindCell(args, i);
+      const double w = args.fWeights ? args.fWeights[i] : 1.;
+      atomicAdd(&content[cell], w);
+      if (sumw2)
+         atomicAdd(&sumw2[cell], w * w);
+   }
+   __syncthreads();
+
+   for (std::size_t c = threadIdx.x; c < args.fNCells; c += blockDim.x) {
+      if (content[c] != 0.)
+         atomicAdd(&args.fContent[c], content[c]);
+      if (sumw2 && sumw2[c] != 0.)
+         atomicAdd(&args.fSumW2[c], sumw2[c]);
+   }
+}
+
+} // anonymous namespace
+
+ROOT::Experimental::Internal::RHistDeviceGrid::RHistDeviceGrid(int ndim, const RAxisParams *axes, bool withSumW2,
+                                                               void *stream)
+   : fNDim(ndim), fStream(stream)
+{
+   if (ndim < 1 || ndim > kMaxNDim)
+      throw std::invalid_argument("RHistDeviceGrid supports 1 to 3 dimensions");
+   for (int d = 0; d < ndim; ++d) {
+      fAxes[d] = axes[d];
+      fNCells *= axes[d].fNBins + 2;
+   }
+   try {
+      CheckCudaError(cudaMalloc(&fContent, fNCells * sizeof(double)), "RHistDeviceGrid");
+      CheckCudaError(cudaMemset(fContent, 0, fNCells * sizeof(double)), "RHistDeviceGrid");
+      if (withSumW2) {
+         CheckCudaError(cudaMalloc(&fSumW2, fNCells * sizeof(double)), "RHistDeviceGrid");
+         CheckCudaError(cudaMemset(fSumW2, 0, fNCells * sizeof(double)), "RHistDeviceGrid");
+      }
+   } catch (...) {
+      cudaFree(fContent);
+      cudaFree(fSumW2);
+      throw;
+   }
+}
+
+ROOT::Experimental::Internal::RHistDeviceGrid::~RHistDeviceGrid()
+{
+   // Do not throw from the destructor.
+   cudaFree(fContent);
+   cudaFree(fSumW2);
+}
+
+void ROOT::Experimental::Internal::RHistDeviceGrid::Fill(const double *const *x, const double *weights, std::size_t n)
+{
+   RFillArgs args;
+   args.fNDim = fNDim;
+   for (int d = 0; d < fNDim; ++d) {
+      args.fAxes[d] = fAxes[d];
+      args.fX[d] = x[d];
+   }
+   args.fWeights = weights;
+   args.fN = n;
+   args.fNCells = fNCells;
+   args.fContent = fContent;
+   args.fSumW2 = fSumW2;
+
+   auto stream = static_cast<cudaStream_t>(fStream);
+   const unsigned int nBlocks = std::min<std::size_t>((n + kBlockSize - 1) / kBlockSize, 1024);
+   if (fNCells <= kMaxSharedCells) {
+      const std::size_t sharedBytes = (fSumW2 ? 2 : 1) * fNCells * sizeof(double);
+      FillShared<<<nBlocks, kBlockSize, sharedBytes, stream>>>(args);
+   } else {
+      FillGlobal<<<nBlocks, kBlockSize, 0, stream>>>(args);
+   }
+   CheckCudaError(cudaGetLastError(), "Fill");
+}
+
+void ROOT::Experimental::Internal::RHistDeviceGrid::Collect(std::vector<double> &content, std::vector<double> &sumw2)
+{
+   auto stream = static_cast<cudaStream_t>(fStream);
+   content.resize(fNCells);
+   CheckCudaError(cudaMemcpyAsync(content.data(), fContent, fNCells * sizeof(double), cudaMemcpyDeviceToHost, stream),
+                  "Collect");
+   CheckCudaError(cudaMemsetAsync(fContent, 0, fNCells * sizeof(double), stream), "Collect");
+   if (fSumW2) {
+      sumw2.resize(fNCells);
+      CheckCudaError(cudaMemcpyAsync(sumw2.data(), fSumW2, fNCells * sizeof(double), cudaMemcpyDeviceToHost, stream),
+                     "Collect");
+      CheckCudaError(cudaMemsetAsync(fSumW2, 0, fNCells * sizeof(double), stream), "Collect");
+   }
+   CheckCudaError(cudaStreamSynchronize(stream), "Collect");
+}
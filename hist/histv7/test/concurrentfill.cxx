@@ -143,3 +143,46 @@ TEST(ConcurrentFillTest, FillFlush)
    EXPECT_EQ(0, (int)Filler_1.GetCoords().size());
    EXPECT_EQ(0, (int)Filler_2.GetCoords().size());
 }
+
+using ShardedFiller_t = Experimental::RHistShardedFiller<Experimental::RH2D, 1024>;
+
+void fillShardWithWeights(ShardedFiller_t filler)
+{
+   for (int i = 0; i < 3000; ++i) {
+      filler.Fill({(double)i / 100, (double)i / 10}, (float)i);
+   }
+}
+
+// Test consistency of the hist after filling shards, and the lazy reduction
+TEST(ShardedFillTest, HistConsistency)
+{
+   Experimental::RH2D hist{{100, 0., 1.}, {{0., 1., 2., 3., 10.}}};
+   hist.Fill({0.425, 4.25}, 7.f);
+
+   Experimental::RHistShardedFillManager<Experimental::RH2D> fillMgr(hist);
+
+   std::array<std::thread, 4> threads;
+   for (auto &thr : threads)
+      thr = std::thread(fillShardWithWeights, fillMgr.MakeFiller());
+   for (auto &thr : threads)
+      thr.join();
+
+   // Nothing is added before the histogram is read through the manager.
+   EXPECT_EQ(1, hist.GetEntries());
+
+   auto &reduced = fillMgr.GetHist();
+   EXPECT_EQ(&hist, &reduced);
+   EXPECT_EQ(1 + 4 * 3000, hist.GetEntries());
+   EXPECT_FLOAT_EQ(7.f + 4 * 42.f, hist.GetBinContent({(double)42 / 100, (double)42 / 10}));
+
+   // Reading again does not add the shards twice.
+   fillMgr.GetHist();
+   EXPECT_EQ(1 + 4 * 3000, hist.GetEntries());
+
+   {
+      ShardedFiller_t filler = fillMgr.MakeFiller();
+      filler.Fill({0.425, 4.25}, 2.f);
+   }
+   EXPECT_EQ(1 + 4 * 3000 + 1, fillMgr.GetHist().GetEntries());
+   EXPECT_FLOAT_EQ(7.f + 4 * 42.f + 2.f, hist.GetBinContent({0.425, 4.25}));
+}
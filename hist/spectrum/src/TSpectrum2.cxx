@@ -46,6 +46,12 @@
 #include "TList.h"
 #include "TH1.h"
 #include "TMath.h"
+#include "TROOT.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
 #define PEAK_WINDOW 1024
 
 Int_t TSpectrum2::fgIterations    = 3;
@@ -1176,8 +1182,8 @@ Int_t TSpectrum2::SearchHighRes(Double_t **source, Double_t **dest, Int_t ssizex
    }
    if(backgroundRemove == true){
       for(i = 1; i <= number_of_iterations; i++){
-         for(y = i; y < ssizey_ext - i; y++){
-            for(x = i; x < ssizex_ext - i; x++){
+         for(x = i; x < ssizex_ext - i; x++){
+            for(y = i; y < ssizey_ext - i; y++){
                a = working_space[x][y + ssizey_ext];
                p1 = working_space[x - i][y + ssizey_ext - i];
                p2 = working_space[x - i][y + ssizey_ext + i];
@@ -1209,8 +1215,8 @@ Int_t TSpectrum2::SearchHighRes(Double_t **source, Double_t **dest, Int_t ssizex
                working_space[x][y] = a;
             }
          }
-         for(y = i;y < ssizey_ext - i; y++){
-            for(x = i; x < ssizex_ext - i; x++){
+         for(x = i; x < ssizex_ext - i; x++){
+            for(y = i;y < ssizey_ext - i; y++){
                working_space[x][y + ssizey_ext] = working_space[x][y];
             }
          }
@@ -1566,8 +1572,8 @@ Int_t TSpectrum2::SearchHighRes(Double_t **source, Double_t **dest, Int_t ssizex
    }
    //START OF ITERATIONS
    for(lindex = 0; lindex < deconIterations; lindex++){
-      for(i2 = 0; i2 < ssizey_ext; i2++){
-         for(i1 = 0; i1 < ssizex_ext; i1++){
+      for(i1 = 0; i1 < ssizex_ext; i1++){
+         for(i2 = 0; i2 < ssizey_ext; i2++){
             lda = working_space[i1][i2 + ssizey_ext];
             ldc = working_space[i1][i2 + 14 * ssizey_ext];
             if(lda > 0.000001 && ldc > 0.000001){
@@ -1590,12 +1596,13 @@ Int_t TSpectrum2::SearchHighRes(Double_t **source, Double_t **dest, Int_t ssizex
                if(j1max > lhx - 1)
                   j1max = lhx - 1;
 
-               for(j2 = j2min; j2 <= j2max; j2++){
-                  for(j1 = j1min; j1 <= j1max; j1++){
-                     k = (j1 + ssizex_ext) / ssizex_ext;
-                     ldc = working_space[(j1 + ssizex_ext) % ssizex_ext][j2 + ssizey_ext + 10 * ssizey_ext + k * 2 * ssizey_ext];
-                     lda = working_space[i1 + j1][i2 + j2 + ssizey_ext];
-                     ldb = ldb + lda * ldc;
+               // the innermost loop runs over contiguous memory
+               for(j1 = j1min; j1 <= j1max; j1++){
+                  k = (j1 + ssizex_ext) / ssizex_ext;
+                  const Double_t *resp = working_space[(j1 + ssizex_ext) % ssizex_ext] + ssizey_ext + 10 * ssizey_ext + k * 2 * ssizey_ext;
+                  const Double_t *spec = working_space[i1 + j1] + i2 + ssizey_ext;
+                  for(j2 = j2min; j2 <= j2max; j2++){
+                     ldb = ldb + spec[j2] * resp[j2];
                   }
                }
                lda = working_space[i1][i2 + ssizey_ext];
@@ -1610,8 +1617,8 @@ Int_t TSpectrum2::SearchHighRes(Double_t **source, Double_t **dest, Int_t ssizex
             }
          }
       }
-      for(i2 = 0; i2 < ssizey_ext; i2++){
-         for(i1 = 0; i1 < ssizex_ext; i1++)
+      for(i1 = 0; i1 < ssizex_ext; i1++){
+         for(i2 = 0; i2 < ssizey_ext; i2++)
             working_space[i1][i2 + ssizey_ext] = working_space[i1][i2 + 2 * ssizey_ext];
       }
    }
@@ -1706,6 +1713,43 @@ Int_t TSpectrum2::SearchHighRes(Double_t **source, Double_t **dest, Int_t ssizex
    return fNPeaks;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Static function: search for peaks in many spectra of the same size
+/// by calling SearchHighRes() for each of them.
+///
+/// \param[in] nspectra number of spectra
+/// \param[in] spectra array of nspectra finders, the peaks found in the spectrum
+///                    sources[i] are stored in spectra[i]
+/// \param[in] sources array of nspectra source spectra
+/// \param[out] dests array of nspectra resulting deconvolved spectra
+/// \param[out] npeaks if not null, array receiving the number of peaks found in each spectrum
+///
+/// The other parameters are those of SearchHighRes() and are the same for all
+/// the spectra. If implicit multi-threading is enabled (ROOT::EnableImplicitMT()),
+/// the spectra are processed concurrently.
+
+void TSpectrum2::SearchHighResBatch(Int_t nspectra, TSpectrum2 **spectra, Double_t ***sources, Double_t ***dests,
+                                    Int_t ssizex, Int_t ssizey, Double_t sigma, Double_t threshold,
+                                    Bool_t backgroundRemove, Int_t deconIterations, Bool_t markov,
+                                    Int_t averWindow, Int_t *npeaks)
+{
+   auto search = [&](Int_t i) {
+      Int_t n = spectra[i]->SearchHighRes(sources[i], dests[i], ssizex, ssizey, sigma, threshold,
+                                          backgroundRemove, deconIterations, markov, averWindow);
+      if (npeaks)
+         npeaks[i] = n;
+   };
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && nspectra > 1) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(search, ROOT::TSeqI(nspectra));
+      return;
+   }
+#endif
+   for (Int_t i = 0; i < nspectra; i++)
+      search(i);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// static function (called by TH1), interface to TSpectrum2::Search
 
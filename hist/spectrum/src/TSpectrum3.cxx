@@ -1736,9 +1736,9 @@ const char *TSpectrum3::Deconvolution(Double_t***source, const Double_t***resp,
          }
       }
       for (lindex = 0; lindex < numberIterations; lindex++) {
-         for (i3 = 0; i3 < ssizez; i3++) {
+         for (i1 = 0; i1 < ssizex; i1++) {
             for (i2 = 0; i2 < ssizey; i2++) {
-               for (i1 = 0; i1 < ssizex; i1++) {
+               for (i3 = 0; i3 < ssizez; i3++) {
                   ldb = 0;
                   j3min = i3;
                   if (j3min > lhz - 1)
@@ -1761,12 +1761,13 @@ const char *TSpectrum3::Deconvolution(Double_t***source, const Double_t***resp,
                   j1max = ssizex - i1 - 1;
                   if (j1max > lhx - 1)
                      j1max = lhx - 1;
-                  for (j3 = j3min; j3 <= j3max; j3++) {
+                  // the innermost loop runs over contiguous memory
+                  for (j1 = j1min; j1 <= j1max; j1++) {
                      for (j2 = j2min; j2 <= j2max; j2++) {
-                        for (j1 = j1min; j1 <= j1max; j1++) {
-                           ldc =  working_space[j1 - i1min][j2 - i2min][j3 - i3min + 2 * ssizez];
-                           lda = working_space[i1 + j1][i2 + j2][i3 + j3 + 3 * ssizez];
-                           ldb = ldb + lda * ldc;
+                        const Double_t *resp = working_space[j1 - i1min][j2 - i2min];
+                        const Double_t *spec = working_space[i1 + j1][i2 + j2];
+                        for (j3 = j3min; j3 <= j3max; j3++) {
+                           ldb = ldb + spec[i3 + j3 + 3 * ssizez] * resp[j3 - i3min + 2 * ssizez];
                         }
                      }
                   }
@@ -3028,9 +3029,9 @@ Int_t TSpectrum3::SearchHighRes(const Double_t***source,Double_t***dest, Int_t s
 
 //START OF ITERATIONS
    for (lindex=0;lindex<deconIterations;lindex++){
-      for (i3 = 0; i3 < sizez_ext; i3++) {
+      for (i1 = 0; i1 < sizex_ext; i1++) {
          for (i2 = 0; i2 < sizey_ext; i2++) {
-            for (i1 = 0; i1 < sizex_ext; i1++) {
+            for (i3 = 0; i3 < sizez_ext; i3++) {
                if (TMath::Abs(working_space[i1][i2][i3 + 3 * sizez_ext])>1e-6 && TMath::Abs(working_space[i1][i2][i3 + 1 * sizez_ext])>1e-6){
                   ldb = 0;
                   j3min = i3;
@@ -3060,12 +3061,13 @@ Int_t TSpectrum3::SearchHighRes(const Double_t***source,Double_t***dest, Int_t s
                   if (j1max > lhx - 1)
                      j1max = lhx - 1;
 
-                  for (j3 = j3min; j3 <= j3max; j3++) {
+                  // the innermost loop runs over contiguous memory
+                  for (j1 = j1min; j1 <= j1max; j1++) {
                      for (j2 = j2min; j2 <= j2max; j2++) {
-                        for (j1 = j1min; j1 <= j1max; j1++) {
-                           ldc =  working_space[j1 - i1min][j2 - i2min][j3 - i3min + 2 * sizez_ext];
-                           lda = working_space[i1 + j1][i2 + j2][i3 + j3 + 3 * sizez_ext];
-                           ldb = ldb + lda * ldc;
+                        const Double_t *resp = working_space[j1 - i1min][j2 - i2min];
+                        const Double_t *spec = working_space[i1 + j1][i2 + j2];
+                        for (j3 = j3min; j3 <= j3max; j3++) {
+                           ldb = ldb + spec[i3 + j3 + 3 * sizez_ext] * resp[j3 - i3min + 2 * sizez_ext];
                         }
                      }
                   }
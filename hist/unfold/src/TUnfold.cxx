@@ -140,6 +140,9 @@ TUnfold::~TUnfold(void)
    DeleteMatrix(&fY);
    DeleteMatrix(&fX0);
    DeleteMatrix(&fVyyInv);
+   DeleteMatrix(&fAtVyyInv);
+   DeleteMatrix(&fAtVyyInvA);
+   DeleteMatrix(&fLsquared);
 
    ClearResults();
 }
@@ -181,6 +184,9 @@ void TUnfold::InitTUnfold(void)
    fDXDY = 0;
    fEinv = 0;
    fE = 0;
+   fAtVyyInv = 0;
+   fAtVyyInvA = 0;
+   fLsquared = 0;
    fEpsMatrix=1.E-13;
    fIgnoredBins=0;
 }
@@ -304,14 +310,23 @@ Double_t TUnfold::DoUnfold(void)
    //              T
    //            fA fV  = mAt_V
    //
-   TMatrixDSparse *AtVyyinv=MultiplyMSparseTranspMSparse(fA,fVyyInv);
+   // The products which do not depend on tau are kept between calls,
+   // such that a scan of tau only repeats the inversion of fEinv
+   //
+   if(!fAtVyyInv) {
+      fAtVyyInv=MultiplyMSparseTranspMSparse(fA,fVyyInv);
+   }
+   const TMatrixDSparse *AtVyyinv=fAtVyyInv;
    //
    // get
    //       T
    //     fA fVyyinv fY + fTauSquared fBiasScale Lsquared fX0 = rhs
    //
    TMatrixDSparse *rhs=MultiplyMSparseM(AtVyyinv,fY);
-   TMatrixDSparse *lSquared=MultiplyMSparseTranspMSparse(fL,fL);
+   if(!fLsquared) {
+      fLsquared=MultiplyMSparseTranspMSparse(fL,fL);
+   }
+   const TMatrixDSparse *lSquared=fLsquared;
    if (fBiasScale != 0.0) {
      TMatrixDSparse *rhs2=MultiplyMSparseM(lSquared,fX0);
       AddMSparse(rhs, fTauSquared * fBiasScale ,rhs2);
@@ -322,7 +337,10 @@ Double_t TUnfold::DoUnfold(void)
    // get matrix
    //              T
    //           (fA fV)fA + fTauSquared*fLsquared  = fEinv
-   fEinv=MultiplyMSparseMSparse(AtVyyinv,fA);
+   if(!fAtVyyInvA) {
+      fAtVyyInvA=MultiplyMSparseMSparse(AtVyyinv,fA);
+   }
+   fEinv=new TMatrixDSparse(*fAtVyyInvA);
    AddMSparse(fEinv,fTauSquared,lSquared);
 
    //
@@ -428,7 +446,6 @@ Double_t TUnfold::DoUnfold(void)
       DeleteMatrix(&corr);
    }
 
-   DeleteMatrix(&AtVyyinv);
 
    //
    // get error matrix on x
@@ -492,7 +509,6 @@ Double_t TUnfold::DoUnfold(void)
    DeleteMatrix(&epsilon);
 
    DeleteMatrix(&LsquaredDx);
-   DeleteMatrix(&lSquared);
 
    // calculate/store matrices defining the derivatives dx/dA
    fDXDAM[0]=new TMatrixDSparse(*fE);
@@ -2016,6 +2032,7 @@ Bool_t TUnfold::AddRegularisationCondition
    // replace the old matrix fL
    if(r) {
       DeleteMatrix(&fL);
+      DeleteMatrix(&fLsquared);
       fL=CreateSparseMatrix(rowMax+1,GetNx(),nF,l_row,l_col,l_data);
    }
    delete [] l_row;
@@ -2303,6 +2320,8 @@ Int_t TUnfold::SetInput(const TH1 *input, Double_t scaleBias,
                         const TH2 *hist_vyy_inv)
 {
   DeleteMatrix(&fVyyInv);
+  DeleteMatrix(&fAtVyyInv);
+  DeleteMatrix(&fAtVyyInvA);
   fNdf=0;
 
   fBiasScale = scaleBias;
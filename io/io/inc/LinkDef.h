@@ -26,6 +26,7 @@
 #pragma link C++ class TFree;
 #pragma link C++ class TKey-;
 #pragma link C++ class TKeyMapFile;
+#pragma link C++ class TMapArrayFile;
 #pragma link C++ class TMapFile;
 #pragma link C++ class TMapRec;
 #pragma link C++ class TMemFile;
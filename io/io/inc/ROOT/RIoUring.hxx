@@ -9,10 +9,12 @@
 #ifndef ROOT_RIoUring
 #define ROOT_RIoUring
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include <liburing.h>
 #include <liburing/io_uring.h>
@@ -23,21 +25,80 @@ namespace ROOT {
 namespace Internal {
 
 class RIoUring {
+public:
+   /// Options for setting up the ring
+   struct RSetupOptions {
+      /// Let a kernel thread poll the submission queue (IORING_SETUP_SQPOLL). This saves the io_uring_enter()
+      /// system call for submitting requests at the cost of a kernel thread spinning while requests flow. If the
+      /// kernel refuses the polling thread, e.g. for lack of privileges on kernels before 5.11, the ring is set up
+      /// without it.
+      bool fSqPoll = false;
+      /// Time in milliseconds without submissions after which the polling kernel thread goes to sleep
+      std::uint32_t fSqThreadIdle = 1000;
+   };
+
 private:
+   /// A memory region registered with the kernel for READ_FIXED requests
+   struct RRegisteredBuffer {
+      const unsigned char *fBegin;
+      const unsigned char *fEnd;
+      int fIndex;
+   };
+
    struct io_uring fRing;
    std::uint32_t fDepth = 0;
+   /// The registered file descriptors; the position in the vector is the index in the fixed file table
+   std::vector<int> fRegisteredFiles;
+   /// The registered buffers, sorted by address
+   std::vector<RRegisteredBuffer> fRegisteredBuffers;
+
+   /// Set up the ring with the given queue depth; returns the negative errno on failure
+   int Setup(std::uint32_t entries, const RSetupOptions &options) {
+      struct io_uring_params params = {}; /* zero initialize param struct */
+      if (options.fSqPoll) {
+         params.flags |= IORING_SETUP_SQPOLL;
+         params.sq_thread_idle = options.fSqThreadIdle;
+      }
+      int ret = io_uring_queue_init_params(entries, &fRing, &params);
+      if (ret == -EPERM && options.fSqPoll) {
+         params = {};
+         ret = io_uring_queue_init_params(entries, &fRing, &params);
+      }
+      if (ret == 0)
+         fDepth = params.sq_entries;
+      return ret;
+   }
+
+   /// Returns the index of fd in the fixed file table or -1
+   int FindRegisteredFile(int fd) const {
+      auto itr = std::find(fRegisteredFiles.begin(), fRegisteredFiles.end(), fd);
+      return (itr == fRegisteredFiles.end()) ? -1 : static_cast<int>(itr - fRegisteredFiles.begin());
+   }
+
+   /// Returns the index of the registered buffer that contains the given range or -1
+   int FindRegisteredBuffer(const void *buffer, std::size_t size) const {
+      auto begin = static_cast<const unsigned char *>(buffer);
+      auto itr = std::upper_bound(fRegisteredBuffers.begin(), fRegisteredBuffers.end(), begin,
+                                  [](const unsigned char *b, const RRegisteredBuffer &r) { return b < r.fBegin; });
+      if (itr == fRegisteredBuffers.begin())
+         return -1;
+      --itr;
+      return (begin + size <= itr->fEnd) ? itr->fIndex : -1;
+   }
 
 public:
    // Create an io_uring instance. The ring selects an appropriate queue depth. which can be queried
    // afterwards using GetQueueDepth(). The depth is typically 1024 or lower. Throws an exception if
    // ring setup fails.
-   RIoUring() {
+   RIoUring() : RIoUring(RSetupOptions()) {}
+
+   // As above, with the given setup options
+   explicit RIoUring(const RSetupOptions &options) {
       std::uint32_t queueDepth = 1024;
       int ret;
       while (true) {
-         ret = io_uring_queue_init(queueDepth, &fRing, 0 /* no flags */);
+         ret = Setup(queueDepth, options);
          if (ret == 0) {
-            fDepth = queueDepth;
             break; // ring setup succeeded
          }
          if (ret != -ENOMEM) {
@@ -54,13 +115,14 @@ public:
 
    // Create a io_uring instance that can hold at least `entriesHint` submission entries. The actual
    // queue depth is rounded up to the next power of 2. Throws an exception if ring setup fails.
-   explicit RIoUring(std::uint32_t entriesHint) {
-      struct io_uring_params params = {}; /* zero initialize param struct, no flags */
-      int ret = io_uring_queue_init_params(entriesHint, &fRing, &params);
+   explicit RIoUring(std::uint32_t entriesHint) : RIoUring(entriesHint, RSetupOptions()) {}
+
+   // As above, with the given setup options
+   RIoUring(std::uint32_t entriesHint, const RSetupOptions &options) {
+      int ret = Setup(entriesHint, options);
       if (ret != 0) {
          throw std::runtime_error("Error initializing io_uring: " + std::string(std::strerror(-ret)));
       }
-      fDepth = params.sq_entries;
    }
 
    RIoUring(const RIoUring&) = delete;
@@ -80,6 +142,52 @@ public:
       return &fRing;
    }
 
+   /// Whether a kernel thread polls the submission queue, i.e. the ring was set up with fSqPoll and the kernel
+   /// accepted it
+   bool IsSqPoll() const {
+      return fRing.flags & IORING_SETUP_SQPOLL;
+   }
+
+   /// Register file descriptors with the ring, replacing previously registered ones. Read events on these files
+   /// use the fixed file table, which spares the kernel from looking up and referencing the file for every
+   /// request. Returns false, leaving no files registered, if the kernel refuses the registration.
+   bool RegisterFiles(const int *fds, unsigned int nFiles) {
+      if (!fRegisteredFiles.empty()) {
+         io_uring_unregister_files(&fRing);
+         fRegisteredFiles.clear();
+      }
+      if (io_uring_register_files(&fRing, fds, nFiles) != 0)
+         return false;
+      fRegisteredFiles.assign(fds, fds + nFiles);
+      return true;
+   }
+
+   /// Register memory regions with the ring, replacing previously registered ones. Read events whose buffer lies
+   /// within one of the regions are submitted as READ_FIXED requests, for which the kernel does not need to map
+   /// and pin the user pages on every request. The regions count against the locked memory limit and must stay
+   /// allocated while they are registered. Returns false, leaving no buffers registered, if the kernel refuses
+   /// the registration.
+   bool RegisterBuffers(const struct iovec *buffers, unsigned int nBuffers) {
+      UnregisterBuffers();
+      if (io_uring_register_buffers(&fRing, buffers, nBuffers) != 0)
+         return false;
+      for (unsigned int i = 0; i < nBuffers; ++i) {
+         auto begin = static_cast<const unsigned char *>(buffers[i].iov_base);
+         fRegisteredBuffers.push_back({begin, begin + buffers[i].iov_len, static_cast<int>(i)});
+      }
+      std::sort(fRegisteredBuffers.begin(), fRegisteredBuffers.end(),
+                [](const RRegisteredBuffer &a, const RRegisteredBuffer &b) { return a.fBegin < b.fBegin; });
+      return true;
+   }
+
+   /// Unregister the memory regions registered by RegisterBuffers(), e.g. before freeing them
+   void UnregisterBuffers() {
+      if (fRegisteredBuffers.empty())
+         return;
+      io_uring_unregister_buffers(&fRing);
+      fRegisteredBuffers.clear();
+   }
+
    /// Basic read event composed of IO data and a target file descriptor.
    struct RReadEvent {
       /// The destination for reading
@@ -122,13 +230,28 @@ public:
                throw std::runtime_error("batch " + std::to_string(batch) + ": "
                   + "null read buffer for read request '" + std::to_string(i) + "'");
             }
-            io_uring_prep_read(sqe,
-               readEvents[i].fFileDes,
-               readEvents[i].fBuffer,
-               readEvents[i].fSize,
-               readEvents[i].fOffset
-            );
+            const int fileIndex = FindRegisteredFile(readEvents[i].fFileDes);
+            const int fd = (fileIndex >= 0) ? fileIndex : readEvents[i].fFileDes;
+            const int bufferIndex = FindRegisteredBuffer(readEvents[i].fBuffer, readEvents[i].fSize);
+            if (bufferIndex >= 0) {
+               io_uring_prep_read_fixed(sqe,
+                  fd,
+                  readEvents[i].fBuffer,
+                  readEvents[i].fSize,
+                  readEvents[i].fOffset,
+                  bufferIndex
+               );
+            } else {
+               io_uring_prep_read(sqe,
+                  fd,
+                  readEvents[i].fBuffer,
+                  readEvents[i].fSize,
+                  readEvents[i].fOffset
+               );
+            }
             sqe->flags |= IOSQE_ASYNC; // maximize read event throughput
+            if (fileIndex >= 0)
+               sqe->flags |= IOSQE_FIXED_FILE;
             sqe->user_data = i;
          }
 
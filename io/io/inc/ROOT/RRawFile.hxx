@@ -63,7 +63,24 @@ public:
        * that the protocol-dependent default block size should be used.
        */
       int fBlockSize;
-      ROptions() : fLineBreak(ELineBreaks::kAuto), fBlockSize(-1) {}
+      /// If available, vector reads are submitted as a single batch to the kernel through io_uring (local files only).
+      /// The io_uring instance is set up on the first ReadV() call and reused for further reads.
+      bool fUseIoUring;
+      /// With io_uring, let a kernel thread poll the submission queue. This saves the system call for submitting
+      /// the requests of a vector read at the cost of a kernel thread that spins while reads are flowing.
+      bool fIoUringSqPoll;
+      /**
+       * If larger than zero, sequential reads through the block buffers trigger the asynchronous prefetch of the
+       * following blocks. A background thread reads the blocks through a clone of the file. The number of blocks in
+       * flight starts at one and doubles with every sequential block refill up to fReadaheadBlocks. Non-sequential
+       * access discards the prefetched blocks and shrinks the window again. Requires I/O buffering (fBlockSize > 0).
+       */
+      unsigned int fReadaheadBlocks;
+      ROptions()
+         : fLineBreak(ELineBreaks::kAuto), fBlockSize(-1), fUseIoUring(true), fIoUringSqPoll(false),
+           fReadaheadBlocks(0)
+      {
+      }
    };
 
    /// Used for vector reads from multiple offsets into multiple buffers. This is unlike readv(), which scatters a
@@ -108,6 +125,10 @@ private:
    std::uint64_t fFileSize;
    /// Files are opened lazily and only when required; the open state is kept by this flag
    bool fIsOpen;
+   /// Asynchronous prefetch of the blocks following a sequential block refill, see ROptions::fReadaheadBlocks
+   struct RReadahead;
+   /// Created on the first block refill if fOptions.fReadaheadBlocks > 0
+   std::unique_ptr<RReadahead> fReadahead;
 
 protected:
    std::string fUrl;
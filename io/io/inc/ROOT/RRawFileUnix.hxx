@@ -17,10 +17,13 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 
 namespace ROOT {
 namespace Internal {
 
+class RIoUring;
+
 /**
  * \class RRawFileUnix RRawFileUnix.hxx
  * \ingroup IO
@@ -31,6 +34,9 @@ namespace Internal {
 class RRawFileUnix : public RRawFile {
 private:
    int fFileDes;
+   /// Lazily created on the first vector read if fOptions.fUseIoUring is set and io_uring is available.
+   /// Reusing the ring avoids setting up and tearing down the kernel queues for every ReadV() call.
+   std::unique_ptr<RIoUring> fIoUring;
 
 protected:
    void OpenImpl() final;
@@ -15,10 +15,11 @@
 #include "TFileMerger.h"
 #include "TMemFile.h"
 
+#include <atomic>
 #include <functional>
 #include <memory>
 #include <mutex>
-#include <queue>
+#include <vector>
 
 namespace ROOT {
 
@@ -82,6 +83,18 @@ public:
    /** Returns the current merge options. */
    const char* GetMergeOptions();
 
+   /** Returns the limit of buffered bytes above which writers are blocked (default = 0, no limit). */
+   size_t GetMaxBuffered() const
+   {
+      return fMaxBuffered;
+   }
+
+   /** Returns the number of threads used to pre-merge the queue (default = 0, no pre-merging). */
+   unsigned int GetPreMergeWorkers() const
+   {
+      return fPreMergeWorkers;
+   }
+
    /** By default, TBufferMerger will call TFileMerger::PartialMerge() for each
     *  buffer pushed onto its merge queue. This function lets the user change
     *  this behaviour by telling TBufferMerger to accumulate at least size
@@ -92,6 +105,28 @@ public:
     */
    void SetAutoSave(size_t size);
 
+   /** Limits the memory used by the merge queue. A TBufferMergerFile::Write()
+    *  that makes the queue exceed size bytes blocks until the ongoing merge
+    *  has finished and then merges the queue in the calling thread. Writers
+    *  thus cannot outpace the output thread. A value of 0 removes the limit.
+    */
+   void SetMaxBuffered(size_t size)
+   {
+      fMaxBuffered = size;
+   }
+
+   /** Lets the merging thread pre-merge the buffers of the queue in parallel
+    *  before the final merge into the output file. The queue is split into up
+    *  to nworkers consecutive groups, each merged by its own thread into an
+    *  intermediate in-memory file, and only these are merged into the output.
+    *  This helps when many writers push buffers faster than a single thread
+    *  can merge them. A value of 0 or 1 turns pre-merging off.
+    */
+   void SetPreMergeWorkers(unsigned int nworkers)
+   {
+      fPreMergeWorkers = nworkers;
+   }
+
    /** Sets the merge options. SetMergeOptions("fast") will disable
     * recompression of input data into the output if they have different
     * compression settings.
@@ -151,7 +186,15 @@ private:
 
    void Init(std::unique_ptr<TFile>);
 
+   /** Node of the lock-free queue of buffers */
+   struct QueueNode {
+      TBufferFile *fBuffer;
+      QueueNode *fNext;
+   };
+
    void MergeImpl();
+   std::vector<TBufferFile *> PopAll();
+   void PreMerge(std::vector<TBufferFile *> &buffers);
 
    void Merge();
    void Push(TBufferFile *buffer);
@@ -159,11 +202,13 @@ private:
 
    bool fCompressTemporaryKeys{false};                           //< Enable compression of the TKeys in the TMemFile (save memory at the expense of time, end result is unchanged)
    size_t fAutoSave{0};                                          //< AutoSave only every fAutoSave bytes
+   size_t fMaxBuffered{0};                                       //< Writers block above fMaxBuffered bytes, 0 for no limit
+   unsigned int fPreMergeWorkers{0};                             //< Number of threads pre-merging the queue
    std::atomic<size_t> fBuffered{0};                             //< Number of bytes currently buffered
    TFileMerger fMerger{false, false};                            //< TFileMerger used to merge all buffers
    std::mutex fMergeMutex;                                       //< Mutex used to lock fMerger
-   mutable std::mutex fQueueMutex;                               //< Mutex used to lock fQueue
-   std::queue<TBufferFile *> fQueue;                             //< Queue to which data is pushed and merged
+   std::atomic<QueueNode *> fQueue{nullptr};                     //< Lock-free stack to which data is pushed, most recent first
+   std::atomic<size_t> fQueueSize{0};                            //< Number of buffers in fQueue
    std::vector<std::weak_ptr<TBufferMergerFile>> fAttachedFiles; //< Attached files
 };
 
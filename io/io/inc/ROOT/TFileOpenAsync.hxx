@@ -0,0 +1,67 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TFileOpenAsync
+#define ROOT_TFileOpenAsync
+
+#include "RConfigure.h"
+
+#include "TFile.h"
+
+#include <memory>
+#include <string>
+
+// exclude in case ROOT does not have IMT support
+#ifndef R__USE_IMT
+// No need to error out for dictionaries.
+#if !defined(__ROOTCLING__) && !defined(G__DICTIONARY)
+#error "Cannot use ROOT::Experimental::OpenAsync without defining R__USE_IMT."
+#endif
+#else
+
+#include "ROOT/TFuture.hxx"
+
+namespace ROOT {
+namespace Experimental {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Open a file asynchronously with TFile::Open() in a task of the ROOT thread pool
+/// and return a TFuture that holds the file, or nullptr if it could not be opened.
+/// This works alike for local and remote (XRootD, HTTP, ...) files, so that the
+/// opening of many files can overlap, e.g.
+/// ~~~{.cpp}
+/// ROOT::EnableImplicitMT();
+/// std::vector<ROOT::Experimental::TFuture<std::unique_ptr<TFile>>> futures;
+/// for (auto &name : names)
+///    futures.emplace_back(ROOT::Experimental::OpenAsync(name));
+/// for (auto &future : futures)
+///    auto file = future.get();
+/// ~~~
+/// The file is opened in another thread, which requires ROOT::EnableThreadSafety().
+/// To also read the keys list and the StreamerInfo of each file with a single
+/// request, see TFile::SetMetadataPrefetchSize().
+/// Unlike TFile::AsyncOpen(), the file is not attached to the current directory
+/// of the calling thread and is owned by the returned std::unique_ptr.
+
+inline TFuture<std::unique_ptr<TFile>>
+OpenAsync(std::string_view name, std::string_view option = "", std::string_view title = "",
+          Int_t compress = ROOT::RCompressionSetting::EDefaults::kUseCompiledDefault)
+{
+   return Async([name = std::string(name), option = std::string(option), title = std::string(title), compress]() {
+      return std::unique_ptr<TFile>(TFile::Open(name.c_str(), option.c_str(), title.c_str(), compress));
+   });
+}
+
+} // namespace Experimental
+} // namespace ROOT
+
+#endif // R__USE_IMT
+
+#endif
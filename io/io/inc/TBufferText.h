@@ -135,6 +135,8 @@ public:
 protected:
    static const char *fgFloatFmt;  ///<!  printf argument for floats, either "%f" or "%e" or "%10f" and so on
    static const char *fgDoubleFmt; ///<!  printf argument for doubles, either "%f" or "%e" or "%10f" and so on
+   static Int_t fgFloatPrec;       ///<!  precision N if fgFloatFmt is "%.Ne", -1 otherwise
+   static Int_t fgDoublePrec;      ///<!  precision N if fgDoubleFmt is "%.Ne", -1 otherwise
 
    ClassDefOverride(TBufferText, 0); // a TBuffer subclass for all text-based streamers
 };
@@ -28,6 +28,7 @@
 
 class TKey;
 class TFile;
+class THashList;
 
 class TDirectoryFile : public TDirectory {
 
@@ -44,15 +45,27 @@ protected:
    Long64_t    fSeekKeys{0};             ///< Location of Keys record on file
    TFile      *fFile{nullptr};           ///< Pointer to current file in memory
    TList      *fKeys{nullptr};           ///< Pointer to keys list in memory
+   mutable Int_t fKeysIndexOffset{0};    ///<! Offset of the keys index in the keys record while fKeys is not read, 0 otherwise
+   mutable Int_t fKeysIndexLen{0};       ///<! Size of fKeysIndex
+   mutable char *fKeysIndex{nullptr};    ///<! Keys index, read from the keys record at the first lookup
+
+   static Int_t fgKeysIndexThreshold;    ///< Minimum number of keys of a directory for its keys index to be written (0: never)
 
    void        CleanTargets();
    void        InitDirectoryFile(TClass *cl = nullptr);
    void        BuildDirectoryFile(TFile* motherFile, TDirectory* motherDir);
+   Int_t       GetNkeysOfClass(const char *classname) const;
 
 private:
    TDirectoryFile(const TDirectoryFile &directory) = delete;  //Directories cannot be copied
    void operator=(const TDirectoryFile &) = delete; //Directories cannot be copied
 
+   void        DropKeysIndex() const;
+   TKey       *GetKeyFromIndex(const char *name, Short_t cycle, Bool_t exactCycle) const;
+   Bool_t      LoadKeysIndex() const;
+   Int_t       ReadKeysRecord(THashList *known) const;
+   void        ReadPendingKeys() const;
+
 public:
    // TDirectory status bits
    enum EStatusBits { kCloseDirectory = BIT(7) }; // Unused in ROOT, never set. Maybe only in external code.
@@ -90,10 +103,10 @@ public:
    const TDatime      &GetCreationDate() const { return fDatimeC; }
            TFile      *GetFile() const override { return fFile; }
            TKey       *GetKey(const char *name, Short_t cycle=9999) const override;
-           TList      *GetListOfKeys() const override { return fKeys; }
+           TList      *GetListOfKeys() const override { if (R__unlikely(fKeysIndexOffset)) ReadPendingKeys(); return fKeys; }
    const TDatime      &GetModificationDate() const { return fDatimeM; }
            Int_t       GetNbytesKeys() const override { return fNbytesKeys; }
-           Int_t       GetNkeys() const override { return fKeys->GetSize(); }
+           Int_t       GetNkeys() const override;
            Long64_t    GetSeekDir() const override { return fSeekDir; }
            Long64_t    GetSeekParent() const override { return fSeekParent; }
            Long64_t    GetSeekKeys() const override { return fSeekKeys; }
@@ -127,6 +140,9 @@ public:
            void        WriteDirHeader() override;
            void        WriteKeys() override;
 
+   static  Int_t       GetKeysIndexThreshold();
+   static  void        SetKeysIndexThreshold(Int_t nkeys = 10000);
+
    ClassDefOverride(TDirectoryFile,5)  //Describe directory structure in a ROOT file
 };
 
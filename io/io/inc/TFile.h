@@ -23,6 +23,7 @@
 
 #include <atomic>
 #include <string>
+#include <vector>
 
 #include "Compression.h"
 #include "TDirectoryFile.h"
@@ -88,6 +89,7 @@ protected:
    Int_t            fWritten{0};              ///<Number of objects written so far
    Int_t            fNProcessIDs{0};          ///<Number of TProcessID written to this file
    Int_t            fReadCalls{0};            ///<Number of read calls ( not counting the cache calls )
+   UInt_t           fZstdDictionaryId{0};     ///<!Id of the ZSTD dictionary of this file, 0 if none
    TString          fRealName;                ///<Effective real file name (not original url)
    TString          fOption;                  ///<File options
    Char_t           fUnits{0};                ///<Number of bytes for file pointers
@@ -115,10 +117,13 @@ protected:
 
    bool             fGlobalRegistration = true; ///<! if true, bypass use of global lists
 
+   std::vector<char> fMetadataBuffer;         ///<!Keys list and StreamerInfo records prefetched by Init()
+   Long64_t         fMetadataSeek{0};         ///<!Position of fMetadataBuffer in the file
+
 #ifdef R__USE_IMT
    std::mutex                                 fWriteMutex;  ///<!Lock for writing baskets / keys into the file.
-   static ROOT::Internal::RConcurrentHashColl fgTsSIHashes; ///<!TS Set of hashes built from read streamer infos
 #endif
+   static ROOT::Internal::RConcurrentHashColl fgTsSIHashes; ///<!TS Set of hashes built from read streamer infos
 
    static TList    *fgAsyncOpenRequests; //List of handles for pending open requests
 
@@ -134,10 +139,12 @@ protected:
    static std::atomic<Int_t>     fgReadCalls;             ///<Number of bytes read from all TFile objects
    static Int_t     fgReadaheadSize;         ///<Readahead buffer size
    static Bool_t    fgReadInfo;              ///<if true (default) ReadStreamerInfo is called when opening a file
+   static std::atomic<Int_t> fgMetadataPrefetchSize; ///<Maximum size of the keys list and StreamerInfo read in one request when opening a file
 
    virtual EAsyncOpenStatus GetAsyncOpenStatus() { return fAsyncOpenStatus; }
    virtual void        Init(Bool_t create);
            Bool_t      FlushWriteCache();
+           void        PrefetchMetadata();
            Int_t       ReadBufferViaCache(char *buf, Int_t len);
            Int_t       WriteBufferViaCache(const char *buf, Int_t len);
 
@@ -236,6 +243,7 @@ public:
    virtual Long64_t    GetBytesReadExtra() const { return fBytesReadExtra; }
    virtual Long64_t    GetBytesWritten() const;
    virtual Int_t       GetReadCalls() const { return fReadCalls; }
+           UInt_t      GetZstdDictionaryId() const { return fZstdDictionaryId; }
            Int_t       GetVersion() const { return fVersion; }
            Int_t       GetRecordHeader(char *buf, Long64_t first, Int_t maxbytes,
                                        Int_t &nbytes, Int_t &objlen, Int_t &keylen);
@@ -282,9 +290,11 @@ public:
    virtual void        SetOffset(Long64_t offset, ERelativeTo pos = kBeg);
    virtual void        SetOption(Option_t *option=">") { fOption = option; }
    virtual void        SetReadCalls(Int_t readcalls = 0) { fReadCalls = readcalls; }
+           Bool_t      SetZstdDictionary(const char *dict, Int_t size);
    virtual void        ShowStreamerInfo();
            Int_t       Sizeof() const override;
            void        SumBuffer(Int_t bufsize);
+           Bool_t      TrainZstdDictionary(const TCollection *samples, Int_t maxsize = 112640);
    virtual Bool_t      WriteBuffer(const char *buf, Int_t len);
            Int_t       Write(const char *name=nullptr, Int_t opt=0, Int_t bufsiz=0) override;
            Int_t       Write(const char *name=nullptr, Int_t opt=0, Int_t bufsiz=0) const override;
@@ -312,11 +322,13 @@ public:
    static Long64_t     GetFileBytesWritten();
    static Int_t        GetFileReadCalls();
    static Int_t        GetReadaheadSize();
+   static Int_t        GetMetadataPrefetchSize();
 
    static void         SetFileBytesRead(Long64_t bytes = 0);
    static void         SetFileBytesWritten(Long64_t bytes = 0);
    static void         SetFileReadCalls(Int_t readcalls = 0);
    static void         SetReadaheadSize(Int_t bufsize = 256000);
+   static void         SetMetadataPrefetchSize(Int_t bytes = 0);
    static void         SetReadStreamerInfo(Bool_t readinfo=kTRUE);
    static Bool_t       GetReadStreamerInfo();
 
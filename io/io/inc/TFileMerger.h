@@ -54,8 +54,11 @@ protected:
    TString        fObjectNames;               ///< List of object names to be either merged exclusively or skipped
    TList          fMergeList;                 ///< list of TObjString containing the name of the files need to be merged
    TList          fExcessFiles;               ///<! List of TObjString containing the name of the files not yet added to fFileList due to user or system limitation on the max number of files opened.
+   Int_t          fReductionFanIn{0};         ///< Number of inputs merged into each temporary file of the tree-reduction (0 to merge all inputs at once)
+   Long64_t       fMaxMergeMemory{0};         ///< Maximum size in bytes of the input objects merged in one go (0 for no limit)
 
    Bool_t         OpenExcessFiles();
+   Bool_t         ReduceInputs(Int_t type, TList &temporaries);
    virtual Bool_t AddFile(TFile *source, Bool_t own, Bool_t cpProgress);
    virtual Bool_t MergeRecursive(TDirectory *target, TList *sourcelist, Int_t type = kRegular | kAll);
 
@@ -92,6 +95,10 @@ public:
    TFile      *GetOutputFile() const { return fOutputFile; }
    Int_t       GetMaxOpenedFiles() const { return fMaxOpenedFiles; }
    void        SetMaxOpenedFiles(Int_t newmax);
+   Int_t       GetReductionFanIn() const { return fReductionFanIn; }
+   void        SetReductionFanIn(Int_t fanin) { fReductionFanIn = fanin; }
+   Long64_t    GetMaxMergeMemory() const { return fMaxMergeMemory; }
+   void        SetMaxMergeMemory(Long64_t bytes) { fMaxMergeMemory = bytes; }
    const char *GetMsgPrefix() const { return fMsgPrefix; }
    void        SetMsgPrefix(const char *prefix);
    const char *GetMergeOptions() { return fMergeOptions; }
@@ -124,7 +131,7 @@ public:
    virtual void   SetNotrees(Bool_t notrees=kFALSE) {fNoTrees = notrees;}
            void   RecursiveRemove(TObject *obj) override;
 
-   ClassDefOverride(TFileMerger, 6)  // File copying and merging services
+   ClassDefOverride(TFileMerger, 7)  // File copying and merging services
 };
 
 #endif
@@ -68,6 +68,7 @@ public:
    Int_t     ThreadStart();
 
    Bool_t    SetCache(const char*);
+   TString   GetBlockCachePath(TFPBlock*);
    Bool_t    CheckBlockInCache(char*&, TFPBlock*);
    char     *GetBlockFromCache(const char*, Int_t);
    void      SaveBlockInCache(TFPBlock*);
@@ -0,0 +1,60 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TMapArrayFile
+#define ROOT_TMapArrayFile
+
+#include "TObject.h"
+#include "TString.h"
+
+class TMapArrayFile : public TObject {
+
+private:
+   TString     fName;           ///< Name of mapped file
+   char       *fBase;           ///< Start of the mapped region
+   Long64_t    fSize;           ///< Size of the mapped region in bytes
+   Bool_t      fWritable;       ///< TRUE if the file is mapped read-write (producer)
+
+   TMapArrayFile(const char *name, Option_t *option, Long64_t size, Int_t maxArrays);
+   TMapArrayFile(const TMapArrayFile &) = delete;
+   TMapArrayFile &operator=(const TMapArrayFile &) = delete;
+
+public:
+   enum {
+      kDefaultMapSize   = 0x800000,  ///< default size of the mapped region is 8 MB
+      kDefaultMaxArrays = 256,       ///< default maximum number of arrays
+      kMaxNameLength    = 63         ///< maximum length of the array names
+   };
+
+   virtual ~TMapArrayFile();
+
+   void            Close();
+   const char     *GetName() const override { return fName; }
+   Bool_t          IsWritable() const { return fWritable; }
+   Bool_t          IsOpen() const { return fBase != nullptr; }
+   void            Print(Option_t *option = "") const override;
+
+   Int_t           Add(const char *name, Long64_t n);
+   Int_t           FindArray(const char *name) const;
+   const Double_t *GetArray(Int_t index) const;
+   const char     *GetArrayName(Int_t index) const;
+   Long64_t        GetArraySize(Int_t index) const;
+   Int_t           GetNarrays() const;
+   ULong64_t       GetVersion(Int_t index) const;
+   Bool_t          Read(Int_t index, Double_t *dest, ULong64_t *version = nullptr) const;
+   Bool_t          Update(Int_t index, const Double_t *src);
+
+   static TMapArrayFile *Create(const char *name, Option_t *option = "READ", Long64_t size = kDefaultMapSize,
+                                Int_t maxArrays = kDefaultMaxArrays);
+
+   ClassDefOverride(TMapArrayFile,0)  // Memory mapped file of named, versioned arrays
+};
+
+#endif
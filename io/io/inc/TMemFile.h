@@ -13,6 +13,7 @@
 #define ROOT_TMemFile
 
 #include "TFile.h"
+#include <functional>
 #include <vector>
 #include <memory>
 
@@ -25,6 +26,8 @@ public:
       const size_t fSize;
       explicit ZeroCopyView_t(const char * start, const size_t size) : fStart(start), fSize(size) {}
    };
+   /// Called with the start and size of an adopted memory range once no TMemFile uses it anymore.
+   using ExternalDeleter_t = std::function<void(const char *start, size_t size)>;
 
 protected:
    struct TMemBlock {
@@ -46,6 +49,7 @@ protected:
    };
    TMemBlock    fBlockList;               ///< Collection of memory blocks of size fgDefaultBlockSize
    ExternalDataPtr_t fExternalData;       ///< shared file data / content
+   std::shared_ptr<const char> fExternalBuffer; ///< adopted memory range, released through its deleter
    Bool_t       fIsOwnedByROOT{kFALSE};   ///< if this is a C-style memory region
    Long64_t     fSize{0};                 ///< Total file size (sum of the size of the chunks)
    Long64_t     fSysOffset{0};            ///< Seek offset in file
@@ -93,6 +97,7 @@ public:
             Int_t compress = ROOT::RCompressionSetting::EDefaults::kUseCompiledDefault, Long64_t defBlockSize = 0LL);
    TMemFile(const char *name, ExternalDataPtr_t data);
    TMemFile(const char *name, const ZeroCopyView_t &datarange);
+   TMemFile(const char *name, const ZeroCopyView_t &datarange, ExternalDeleter_t deleter);
    TMemFile(const char *name, std::unique_ptr<TBufferFile> buffer);
    TMemFile(const TMemFile &orig);
    virtual ~TMemFile();
@@ -11,6 +11,7 @@
 
 #include <ROOT/RConfig.h>
 #include <ROOT/RRawFile.hxx>
+#include <ROOT/RTracing.hxx>
 #ifdef _WIN32
 #include <ROOT/RRawFileWin.hxx>
 #else
@@ -24,11 +25,16 @@
 #include <algorithm>
 #include <cctype> // for towlower
 #include <cerrno>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
+#include <deque>
+#include <mutex>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace {
 const char *kTransportSeparator = "://";
@@ -58,6 +64,155 @@ size_t ROOT::Internal::RRawFile::RBlockBuffer::CopyTo(void *buffer, size_t nbyte
    return copiedBytes;
 }
 
+/// The readahead blocks are read by a single worker thread through a clone of the file, such that the derived classes
+/// do not need to support concurrent ReadAtImpl() calls. The worker submits all pending blocks as one vector read,
+/// which the remote protocols serve in parallel.
+struct ROOT::Internal::RRawFile::RReadahead {
+   struct RBlock {
+      std::uint64_t fOffset = 0;
+      std::unique_ptr<unsigned char[]> fBuffer;
+      size_t fSize = 0;
+      bool fIsReady = false;
+      bool fIsFailed = false;
+   };
+
+   /// The clone used by the worker thread, unbuffered and without readahead
+   std::unique_ptr<RRawFile> fFile;
+   size_t fBlockSize;
+   unsigned int fMaxWindow;
+   std::uint64_t fFileSize = kUnknownFileSize;
+   /// The number of blocks to keep in flight, zero as long as no sequential access is detected
+   unsigned int fWindow = 0;
+   /// A block refill at this offset continues sequential access
+   std::uint64_t fNextOffset = kUnknownFileSize;
+
+   std::mutex fLock;
+   std::condition_variable fCvWork;
+   std::condition_variable fCvReady;
+   /// Requested blocks in file order, pending, in flight, or ready; shared with the worker
+   std::deque<std::shared_ptr<RBlock>> fBlocks;
+   /// The subset of fBlocks not yet picked up by the worker
+   std::deque<std::shared_ptr<RBlock>> fQueue;
+   bool fIsStopped = false;
+   std::thread fWorker;
+
+   RReadahead(RRawFile &file)
+      : fFile(file.Clone()), fBlockSize(file.fOptions.fBlockSize), fMaxWindow(file.fOptions.fReadaheadBlocks)
+   {
+      fFile->fOptions.fBlockSize = 0;
+      fFile->fOptions.fReadaheadBlocks = 0;
+      if (file.GetFeatures() & kFeatureHasSize)
+         fFileSize = file.GetSize();
+      fWorker = std::thread([this] { Work(); });
+   }
+   RReadahead(const RReadahead &) = delete;
+   RReadahead &operator=(const RReadahead &) = delete;
+   ~RReadahead()
+   {
+      {
+         std::lock_guard<std::mutex> guard(fLock);
+         fIsStopped = true;
+      }
+      fCvWork.notify_one();
+      fWorker.join();
+   }
+
+   void Work()
+   {
+      std::vector<std::shared_ptr<RBlock>> batch;
+      std::vector<RIOVec> ioVec;
+      while (true) {
+         {
+            std::unique_lock<std::mutex> lock(fLock);
+            fCvWork.wait(lock, [this] { return fIsStopped || !fQueue.empty(); });
+            if (fIsStopped)
+               return;
+            batch.assign(fQueue.begin(), fQueue.end());
+            fQueue.clear();
+         }
+
+         ioVec.resize(batch.size());
+         for (std::size_t i = 0; i < batch.size(); ++i) {
+            ioVec[i].fBuffer = batch[i]->fBuffer.get();
+            ioVec[i].fOffset = batch[i]->fOffset;
+            ioVec[i].fSize = fBlockSize;
+            ioVec[i].fOutBytes = 0;
+         }
+         bool isFailed = false;
+         try {
+            fFile->ReadV(ioVec.data(), ioVec.size());
+         } catch (const std::exception &) {
+            // The blocks are read again synchronously, which reports the error to the caller
+            isFailed = true;
+         }
+
+         {
+            std::lock_guard<std::mutex> guard(fLock);
+            for (std::size_t i = 0; i < batch.size(); ++i) {
+               batch[i]->fSize = ioVec[i].fOutBytes;
+               batch[i]->fIsFailed = isFailed;
+               batch[i]->fIsReady = true;
+            }
+         }
+         fCvReady.notify_all();
+         batch.clear();
+      }
+   }
+
+   /// If the block starting at offset was requested, wait for it and copy it into buffer. Returns false if the block
+   /// needs to be read synchronously.
+   bool Take(std::uint64_t offset, unsigned char *buffer, size_t &nbytes)
+   {
+      std::unique_lock<std::mutex> lock(fLock);
+      auto itr = std::find_if(fBlocks.begin(), fBlocks.end(),
+                              [offset](const std::shared_ptr<RBlock> &b) { return b->fOffset == offset; });
+      if (itr == fBlocks.end())
+         return false;
+      auto block = *itr;
+      fCvReady.wait(lock, [&block] { return block->fIsReady; });
+      // Blocks before the requested one were skipped and are of no further use
+      fBlocks.erase(fBlocks.begin(), std::find(fBlocks.begin(), fBlocks.end(), block) + 1);
+      if (block->fIsFailed)
+         return false;
+      memcpy(buffer, block->fBuffer.get(), block->fSize);
+      nbytes = block->fSize;
+      return true;
+   }
+
+   /// Called after the block buffer was refilled with nbytes from offset; adjusts the window and requests the
+   /// following blocks.
+   void Schedule(std::uint64_t offset, size_t nbytes)
+   {
+      {
+         std::lock_guard<std::mutex> guard(fLock);
+         const bool isSequential = (offset == fNextOffset);
+         fNextOffset = offset + fBlockSize;
+         if (!isSequential) {
+            fBlocks.clear();
+            fQueue.clear();
+            fWindow = 0;
+            return;
+         }
+         fWindow = (fWindow == 0) ? 1 : std::min(2 * fWindow, fMaxWindow);
+         if (nbytes < fBlockSize)
+            return; // end of file
+
+         std::uint64_t nextOffset = fBlocks.empty() ? fNextOffset : fBlocks.back()->fOffset + fBlockSize;
+         while (fBlocks.size() < fWindow && nextOffset < fFileSize) {
+            auto block = std::make_shared<RBlock>();
+            block->fOffset = nextOffset;
+            block->fBuffer.reset(new unsigned char[fBlockSize]);
+            fBlocks.push_back(block);
+            fQueue.push_back(block);
+            nextOffset += fBlockSize;
+         }
+         if (fQueue.empty())
+            return;
+      }
+      fCvWork.notify_one();
+   }
+};
+
 ROOT::Internal::RRawFile::RRawFile(std::string_view url, ROptions options)
    : fBlockBufferIdx(0), fBufferSpace(nullptr), fFileSize(kUnknownFileSize), fIsOpen(false), fUrl(url),
      fOptions(options), fFilePos(0)
@@ -66,6 +221,7 @@ ROOT::Internal::RRawFile::RRawFile(std::string_view url, ROptions options)
 
 ROOT::Internal::RRawFile::~RRawFile()
 {
+   fReadahead.reset();
    delete[] fBufferSpace;
 }
 
@@ -81,8 +237,9 @@ ROOT::Internal::RRawFile::Create(std::string_view url, ROptions options)
 #endif
    }
    if (transport == "http" || transport == "https" ||
+       transport == "s3" || transport == "s3s" ||
        transport == "root" || transport == "roots" ) {
-      std::string plgclass = transport.compare( 0, 4, "http" ) == 0 ?
+      std::string plgclass = transport.compare( 0, 4, "root" ) != 0 ?
                              "RRawFileDavix" : "RRawFileNetXNG";
       if (TPluginHandler *h = gROOT->GetPluginManager()->
           FindHandler("ROOT::Internal::RRawFile", std::string(url).c_str())) {
@@ -199,7 +356,13 @@ size_t ROOT::Internal::RRawFile::ReadAt(void *buffer, size_t nbytes, std::uint64
 
    /// The remaining bytes populate the newly promoted main buffer
    RBlockBuffer *thisBuffer = &fBlockBuffers[fBlockBufferIdx % kNumBlockBuffers];
-   size_t res = ReadAtImpl(thisBuffer->fBuffer, fOptions.fBlockSize, offset);
+   if (fOptions.fReadaheadBlocks > 0 && fOptions.fBlockSize > 0 && !fReadahead)
+      fReadahead = std::make_unique<RReadahead>(*this);
+   size_t res = 0;
+   if (!fReadahead || !fReadahead->Take(offset, thisBuffer->fBuffer, res))
+      res = ReadAtImpl(thisBuffer->fBuffer, fOptions.fBlockSize, offset);
+   if (fReadahead)
+      fReadahead->Schedule(offset, res);
    thisBuffer->fBufferOffset = offset;
    thisBuffer->fBufferSize = res;
    size_t remainingBytes = std::min(res, nbytes);
@@ -210,6 +373,7 @@ size_t ROOT::Internal::RRawFile::ReadAt(void *buffer, size_t nbytes, std::uint64
 
 void ROOT::Internal::RRawFile::ReadV(RIOVec *ioVec, unsigned int nReq)
 {
+   RTraceScope traceScope("RRawFile::ReadV", "io");
    if (!fIsOpen)
       OpenImpl();
    fIsOpen = true;
@@ -14,6 +14,13 @@
 
 #ifdef R__HAS_URING
   #include "ROOT/RIoUring.hxx"
+#else
+namespace ROOT {
+namespace Internal {
+/// Without io_uring support, RRawFileUnix::fIoUring stays empty but still needs a complete type
+class RIoUring {};
+} // namespace Internal
+} // namespace ROOT
 #endif
 
 #include "TError.h"
@@ -116,9 +123,15 @@ void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
 {
 #ifdef R__HAS_URING
    thread_local bool uring_failed = false;
-   if (!uring_failed) {
+   if (fOptions.fUseIoUring && !uring_failed) {
       try {
-         RIoUring ring; // throws std::runtime_error
+         if (!fIoUring) {
+            RIoUring::RSetupOptions setupOptions;
+            setupOptions.fSqPoll = fOptions.fIoUringSqPoll;
+            fIoUring = std::make_unique<RIoUring>(setupOptions); // throws std::runtime_error
+            // Not required but spares the kernel the file lookup for every request
+            fIoUring->RegisterFiles(&fFileDes, 1);
+         }
          std::vector<RIoUring::RReadEvent> reads;
          reads.reserve(nReq);
          for (std::size_t i = 0; i < nReq; ++i) {
@@ -129,7 +142,7 @@ void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
             ev.fFileDes = fFileDes;
             reads.push_back(ev);
          }
-         ring.SubmitReadsAndWait(reads.data(), nReq);
+         fIoUring->SubmitReadsAndWait(reads.data(), nReq);
          for (std::size_t i = 0; i < nReq; ++i) {
             ioVec[i].fOutBytes = reads.at(i).fOutBytes;
          }
@@ -139,6 +152,7 @@ void ROOT::Internal::RRawFileUnix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
          Warning("RIoUring", "io_uring is unexpectedly not available because:\n%s", e.what());
          Warning("RRawFileUnix",
               "io_uring setup failed, falling back to blocking I/O in ReadV");
+         fIoUring.reset();
          uring_failed = true;
       }
    }
@@ -18,7 +18,9 @@ The concrete implementation of TBuffer for writing/reading to/from a ROOT file o
 */
 
 #include <string.h>
+#include <algorithm>
 #include <typeinfo>
+#include <type_traits>
 #include <string>
 
 #include "TFile.h"
@@ -53,6 +55,172 @@ const Version_t kByteCountVMask = 0x4000;      // OR the version byte count with
 const Version_t kMaxVersion     = 0x3FFF;      // highest possible version number
 const Int_t  kMapOffset         = 2;   // first 2 map entries are taken by null obj and self obj
 
+#if defined(R__BYTESWAP) && (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && !defined(__CLING__)
+#define R__BYTESWAP_X86
+#include <immintrin.h>
+#elif defined(R__BYTESWAP) && defined(__aarch64__) && defined(__ARM_NEON)
+#define R__BYTESWAP_NEON
+#include <arm_neon.h>
+#endif
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy n values of kSize bytes from `from` to `to`, reversing the bytes of
+/// each value.
+
+template <int kSize>
+void ByteSwapScalar(char *to, const char *from, Long64_t n)
+{
+   for (Long64_t i = 0; i < n; ++i, to += kSize, from += kSize)
+      for (int b = 0; b < kSize; ++b)
+         to[b] = from[kSize - 1 - b];
+}
+
+#ifdef R__BYTESWAP_X86
+/// Shuffle mask reversing the bytes of each value of kSize bytes in 16 bytes.
+template <int kSize>
+struct ByteSwapMask {
+   alignas(32) char fMask[32];
+   ByteSwapMask()
+   {
+      for (int j = 0; j < 32; ++j)
+         fMask[j] = (j % 16) / kSize * kSize + kSize - 1 - j % kSize;
+   }
+};
+
+template <int kSize>
+__attribute__((target("ssse3"))) void ByteSwapSSSE3(char *to, const char *from, Long64_t n)
+{
+   static const ByteSwapMask<kSize> mask;
+   const __m128i shuffle = _mm_load_si128((const __m128i *)mask.fMask);
+   const Long64_t nbytes = n * kSize;
+   Long64_t i = 0;
+   for (; i + 16 <= nbytes; i += 16) {
+      __m128i v = _mm_loadu_si128((const __m128i *)(from + i));
+      _mm_storeu_si128((__m128i *)(to + i), _mm_shuffle_epi8(v, shuffle));
+   }
+   ByteSwapScalar<kSize>(to + i, from + i, (nbytes - i) / kSize);
+}
+
+template <int kSize>
+__attribute__((target("avx2"))) void ByteSwapAVX2(char *to, const char *from, Long64_t n)
+{
+   static const ByteSwapMask<kSize> mask;
+   const __m256i shuffle = _mm256_load_si256((const __m256i *)mask.fMask);
+   const Long64_t nbytes = n * kSize;
+   Long64_t i = 0;
+   for (; i + 32 <= nbytes; i += 32) {
+      __m256i v = _mm256_loadu_si256((const __m256i *)(from + i));
+      _mm256_storeu_si256((__m256i *)(to + i), _mm256_shuffle_epi8(v, shuffle));
+   }
+   ByteSwapScalar<kSize>(to + i, from + i, (nbytes - i) / kSize);
+}
+#endif
+
+#ifdef R__BYTESWAP_NEON
+inline uint8x16_t ByteSwapNEON(uint8x16_t v, std::integral_constant<int, 2>) { return vrev16q_u8(v); }
+inline uint8x16_t ByteSwapNEON(uint8x16_t v, std::integral_constant<int, 4>) { return vrev32q_u8(v); }
+inline uint8x16_t ByteSwapNEON(uint8x16_t v, std::integral_constant<int, 8>) { return vrev64q_u8(v); }
+
+template <int kSize>
+void ByteSwapNEON(char *to, const char *from, Long64_t n)
+{
+   const Long64_t nbytes = n * kSize;
+   Long64_t i = 0;
+   for (; i + 16 <= nbytes; i += 16) {
+      uint8x16_t v = vld1q_u8((const uint8_t *)(from + i));
+      vst1q_u8((uint8_t *)(to + i), ByteSwapNEON(v, std::integral_constant<int, kSize>()));
+   }
+   ByteSwapScalar<kSize>(to + i, from + i, (nbytes - i) / kSize);
+}
+#endif
+
+using ByteSwapKernel_t = void (*)(char *, const char *, Long64_t);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Select the fastest byte swapping routine supported by the CPU.
+
+template <int kSize>
+ByteSwapKernel_t SelectByteSwapKernel()
+{
+#if defined(R__BYTESWAP_X86)
+   __builtin_cpu_init();
+   if (__builtin_cpu_supports("avx2"))
+      return ByteSwapAVX2<kSize>;
+   if (__builtin_cpu_supports("ssse3"))
+      return ByteSwapSSSE3<kSize>;
+#elif defined(R__BYTESWAP_NEON)
+   return ByteSwapNEON<kSize>;
+#endif
+   return ByteSwapScalar<kSize>;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read n values of type T in network byte order from `buf` and advance `buf`.
+/// Equivalent to calling frombuf() for each value.
+
+template <typename T>
+inline void ReadSwappedArray(char *&buf, T *x, Int_t n)
+{
+#ifdef R__BYTESWAP
+   static const ByteSwapKernel_t kernel = SelectByteSwapKernel<sizeof(T)>();
+   kernel((char *)x, buf, n);
+#else
+   memcpy(x, buf, sizeof(T) * n);
+#endif
+   buf += sizeof(T) * n;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write n values of type T in network byte order into `buf` and advance `buf`.
+/// Equivalent to calling tobuf() for each value.
+
+template <typename T>
+inline void WriteSwappedArray(char *&buf, const T *x, Int_t n)
+{
+#ifdef R__BYTESWAP
+   static const ByteSwapKernel_t kernel = SelectByteSwapKernel<sizeof(T)>();
+   kernel(buf, (const char *)x, n);
+#else
+   memcpy(buf, x, sizeof(T) * n);
+#endif
+   buf += sizeof(T) * n;
+}
+
+/// Number of values converted at once between Double_t and their Float_t representation on file.
+constexpr Int_t kDouble32Chunk = 256;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read n doubles stored as floats from `buf` and advance `buf`.
+
+inline void ReadFloatsAsDoubles(char *&buf, Double_t *d, Int_t n)
+{
+   Float_t afloat[kDouble32Chunk];
+   for (Int_t i = 0; i < n; i += kDouble32Chunk) {
+      Int_t m = std::min(kDouble32Chunk, n - i);
+      ReadSwappedArray(buf, afloat, m);
+      for (Int_t j = 0; j < m; ++j)
+         d[i + j] = (Double_t)afloat[j];
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write n doubles as floats into `buf` and advance `buf`.
+
+inline void WriteDoublesAsFloats(char *&buf, const Double_t *d, Int_t n)
+{
+   Float_t afloat[kDouble32Chunk];
+   for (Int_t i = 0; i < n; i += kDouble32Chunk) {
+      Int_t m = std::min(kDouble32Chunk, n - i);
+      for (Int_t j = 0; j < m; ++j)
+         afloat[j] = (Float_t)d[i + j];
+      WriteSwappedArray(buf, afloat, m);
+   }
+}
+
+} // anonymous namespace
+
 
 ClassImp(TBufferFile);
 
@@ -765,8 +933,7 @@ Int_t TBufferFile::ReadArray(Short_t *&h)
    bswapcpy16(h, fBufCur, n);
    fBufCur += l;
 # else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &h[i]);
+   ReadSwappedArray(fBufCur, h, n);
 # endif
 #else
    memcpy(h, fBufCur, l);
@@ -798,8 +965,7 @@ Int_t TBufferFile::ReadArray(Int_t *&ii)
    bswapcpy32(ii, fBufCur, n);
    fBufCur += l;
 # else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ii[i]);
+   ReadSwappedArray(fBufCur, ii, n);
 # endif
 #else
    memcpy(ii, fBufCur, l);
@@ -853,8 +1019,7 @@ Int_t TBufferFile::ReadArray(Long64_t *&ll)
    if (!ll) ll = new Long64_t[n];
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ll[i]);
+   ReadSwappedArray(fBufCur, ll, n);
 #else
    memcpy(ll, fBufCur, l);
    fBufCur += l;
@@ -885,8 +1050,7 @@ Int_t TBufferFile::ReadArray(Float_t *&f)
    bswapcpy32(f, fBufCur, n);
    fBufCur += l;
 # else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &f[i]);
+   ReadSwappedArray(fBufCur, f, n);
 # endif
 #else
    memcpy(f, fBufCur, l);
@@ -914,8 +1078,7 @@ Int_t TBufferFile::ReadArray(Double_t *&d)
    if (!d) d = new Double_t[n];
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &d[i]);
+   ReadSwappedArray(fBufCur, d, n);
 #else
    memcpy(d, fBufCur, l);
    fBufCur += l;
@@ -1038,8 +1201,7 @@ Int_t TBufferFile::ReadStaticArray(Short_t *h)
    bswapcpy16(h, fBufCur, n);
    fBufCur += l;
 # else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &h[i]);
+   ReadSwappedArray(fBufCur, h, n);
 # endif
 #else
    memcpy(h, fBufCur, l);
@@ -1070,8 +1232,7 @@ Int_t TBufferFile::ReadStaticArray(Int_t *ii)
    bswapcpy32(ii, fBufCur, n);
    fBufCur += sizeof(Int_t)*n;
 # else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ii[i]);
+   ReadSwappedArray(fBufCur, ii, n);
 # endif
 #else
    memcpy(ii, fBufCur, l);
@@ -1123,8 +1284,7 @@ Int_t TBufferFile::ReadStaticArray(Long64_t *ll)
    if (!ll) return 0;
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ll[i]);
+   ReadSwappedArray(fBufCur, ll, n);
 #else
    memcpy(ll, fBufCur, l);
    fBufCur += l;
@@ -1154,8 +1314,7 @@ Int_t TBufferFile::ReadStaticArray(Float_t *f)
    bswapcpy32(f, fBufCur, n);
    fBufCur += sizeof(Float_t)*n;
 # else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &f[i]);
+   ReadSwappedArray(fBufCur, f, n);
 # endif
 #else
    memcpy(f, fBufCur, l);
@@ -1182,8 +1341,7 @@ Int_t TBufferFile::ReadStaticArray(Double_t *d)
    if (!d) return 0;
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &d[i]);
+   ReadSwappedArray(fBufCur, d, n);
 #else
    memcpy(d, fBufCur, l);
    fBufCur += l;
@@ -1304,8 +1462,7 @@ void TBufferFile::ReadFastArray(Short_t *h, Int_t n)
    bswapcpy16(h, fBufCur, n);
    fBufCur += sizeof(Short_t)*n;
 # else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &h[i]);
+   ReadSwappedArray(fBufCur, h, n);
 # endif
 #else
    memcpy(h, fBufCur, l);
@@ -1326,8 +1483,7 @@ void TBufferFile::ReadFastArray(Int_t *ii, Int_t n)
    bswapcpy32(ii, fBufCur, n);
    fBufCur += sizeof(Int_t)*n;
 # else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ii[i]);
+   ReadSwappedArray(fBufCur, ii, n);
 # endif
 #else
    memcpy(ii, fBufCur, l);
@@ -1360,8 +1516,7 @@ void TBufferFile::ReadFastArray(Long64_t *ll, Int_t n)
    if (l <= 0 || l > fBufSize) return;
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &ll[i]);
+   ReadSwappedArray(fBufCur, ll, n);
 #else
    memcpy(ll, fBufCur, l);
    fBufCur += l;
@@ -1381,8 +1536,7 @@ void TBufferFile::ReadFastArray(Float_t *f, Int_t n)
    bswapcpy32(f, fBufCur, n);
    fBufCur += sizeof(Float_t)*n;
 # else
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &f[i]);
+   ReadSwappedArray(fBufCur, f, n);
 # endif
 #else
    memcpy(f, fBufCur, l);
@@ -1399,8 +1553,7 @@ void TBufferFile::ReadFastArray(Double_t *d, Int_t n)
    if (l <= 0 || l > fBufSize) return;
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      frombuf(fBufCur, &d[i]);
+   ReadSwappedArray(fBufCur, d, n);
 #else
    memcpy(d, fBufCur, l);
    fBufCur += l;
@@ -1420,7 +1573,7 @@ void TBufferFile::ReadFastArrayFloat16(Float_t *f, Int_t n, TStreamerElement *el
       Double_t xmin = ele->GetXmin();
       Double_t factor = ele->GetFactor();
       for (int j=0;j < n; j++) {
-         UInt_t aint; *this >> aint; f[j] = (Float_t)(aint/factor + xmin);
+         UInt_t aint; frombuf(fBufCur, &aint); f[j] = (Float_t)(aint/factor + xmin);
       }
    } else {
       Int_t i;
@@ -1436,8 +1589,8 @@ void TBufferFile::ReadFastArrayFloat16(Float_t *f, Int_t n, TStreamerElement *el
       UChar_t  theExp;
       UShort_t theMan;
       for (i = 0; i < n; i++) {
-         *this >> theExp;
-         *this >> theMan;
+         frombuf(fBufCur, &theExp);
+         frombuf(fBufCur, &theMan);
          fIntValue = theExp;
          fIntValue <<= 23;
          fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
@@ -1457,7 +1610,7 @@ void TBufferFile::ReadFastArrayWithFactor(Float_t *ptr, Int_t n, Double_t factor
 
    //a range was specified. We read an integer and convert it back to a float
    for (int j=0;j < n; j++) {
-      UInt_t aint; *this >> aint; ptr[j] = (Float_t)(aint/factor + minvalue);
+      UInt_t aint; frombuf(fBufCur, &aint); ptr[j] = (Float_t)(aint/factor + minvalue);
    }
 }
 
@@ -1479,8 +1632,8 @@ void TBufferFile::ReadFastArrayWithNbits(Float_t *ptr, Int_t n, Int_t nbits)
    UChar_t  theExp;
    UShort_t theMan;
    for (Int_t i = 0; i < n; i++) {
-      *this >> theExp;
-      *this >> theMan;
+      frombuf(fBufCur, &theExp);
+      frombuf(fBufCur, &theMan);
       fIntValue = theExp;
       fIntValue <<= 23;
       fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
@@ -1502,7 +1655,7 @@ void TBufferFile::ReadFastArrayDouble32(Double_t *d, Int_t n, TStreamerElement *
       Double_t xmin = ele->GetXmin();
       Double_t factor = ele->GetFactor();
       for (int j=0;j < n; j++) {
-         UInt_t aint; *this >> aint; d[j] = (Double_t)(aint/factor + xmin);
+         UInt_t aint; frombuf(fBufCur, &aint); d[j] = (Double_t)(aint/factor + xmin);
       }
    } else {
       Int_t i;
@@ -1510,11 +1663,7 @@ void TBufferFile::ReadFastArrayDouble32(Double_t *d, Int_t n, TStreamerElement *
       if (ele) nbits = (Int_t)ele->GetXmin();
       if (!nbits) {
          //we read a float and convert it to double
-         Float_t afloat;
-         for (i = 0; i < n; i++) {
-            *this >> afloat;
-            d[i] = (Double_t)afloat;
-         }
+         ReadFloatsAsDoubles(fBufCur, d, n);
       } else {
          //we read the exponent and the truncated mantissa of the float
          //and rebuild the double.
@@ -1525,8 +1674,8 @@ void TBufferFile::ReadFastArrayDouble32(Double_t *d, Int_t n, TStreamerElement *
          UChar_t  theExp;
          UShort_t theMan;
          for (i = 0; i < n; i++) {
-            *this >> theExp;
-            *this >> theMan;
+            frombuf(fBufCur, &theExp);
+            frombuf(fBufCur, &theMan);
             fIntValue = theExp;
             fIntValue <<= 23;
             fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
@@ -1547,7 +1696,7 @@ void TBufferFile::ReadFastArrayWithFactor(Double_t *d, Int_t n, Double_t factor,
 
    //a range was specified. We read an integer and convert it back to a double.
    for (int j=0;j < n; j++) {
-      UInt_t aint; *this >> aint; d[j] = (Double_t)(aint/factor + minvalue);
+      UInt_t aint; frombuf(fBufCur, &aint); d[j] = (Double_t)(aint/factor + minvalue);
    }
 }
 
@@ -1561,11 +1710,7 @@ void TBufferFile::ReadFastArrayWithNbits(Double_t *d, Int_t n, Int_t nbits)
 
    if (!nbits) {
       //we read a float and convert it to double
-      Float_t afloat;
-      for (Int_t i = 0; i < n; i++) {
-         *this >> afloat;
-         d[i] = (Double_t)afloat;
-      }
+      ReadFloatsAsDoubles(fBufCur, d, n);
    } else {
       //we read the exponent and the truncated mantissa of the float
       //and rebuild the double.
@@ -1576,8 +1721,8 @@ void TBufferFile::ReadFastArrayWithNbits(Double_t *d, Int_t n, Int_t nbits)
       UChar_t  theExp;
       UShort_t theMan;
       for (Int_t i = 0; i < n; i++) {
-         *this >> theExp;
-         *this >> theMan;
+         frombuf(fBufCur, &theExp);
+         frombuf(fBufCur, &theMan);
          fIntValue = theExp;
          fIntValue <<= 23;
          fIntValue |= (theMan & ((1<<(nbits+1))-1)) <<(23-nbits);
@@ -1737,8 +1882,7 @@ void TBufferFile::WriteArray(const Short_t *h, Int_t n)
    bswapcpy16(fBufCur, h, n);
    fBufCur += l;
 # else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, h[i]);
+   WriteSwappedArray(fBufCur, h, n);
 # endif
 #else
    memcpy(fBufCur, h, l);
@@ -1767,8 +1911,7 @@ void TBufferFile::WriteArray(const Int_t *ii, Int_t n)
    bswapcpy32(fBufCur, ii, n);
    fBufCur += l;
 # else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, ii[i]);
+   WriteSwappedArray(fBufCur, ii, n);
 # endif
 #else
    memcpy(fBufCur, ii, l);
@@ -1831,8 +1974,7 @@ void TBufferFile::WriteArray(const Long64_t *ll, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, ll[i]);
+   WriteSwappedArray(fBufCur, ll, n);
 #else
    memcpy(fBufCur, ll, l);
    fBufCur += l;
@@ -1860,8 +2002,7 @@ void TBufferFile::WriteArray(const Float_t *f, Int_t n)
    bswapcpy32(fBufCur, f, n);
    fBufCur += l;
 # else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, f[i]);
+   WriteSwappedArray(fBufCur, f, n);
 # endif
 #else
    memcpy(fBufCur, f, l);
@@ -1886,8 +2027,7 @@ void TBufferFile::WriteArray(const Double_t *d, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, d[i]);
+   WriteSwappedArray(fBufCur, d, n);
 #else
    memcpy(fBufCur, d, l);
    fBufCur += l;
@@ -2003,8 +2143,7 @@ void TBufferFile::WriteFastArray(const Short_t *h, Int_t n)
    bswapcpy16(fBufCur, h, n);
    fBufCur += l;
 # else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, h[i]);
+   WriteSwappedArray(fBufCur, h, n);
 # endif
 #else
    memcpy(fBufCur, h, l);
@@ -2027,8 +2166,7 @@ void TBufferFile::WriteFastArray(const Int_t *ii, Int_t n)
    bswapcpy32(fBufCur, ii, n);
    fBufCur += l;
 # else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, ii[i]);
+   WriteSwappedArray(fBufCur, ii, n);
 # endif
 #else
    memcpy(fBufCur, ii, l);
@@ -2075,8 +2213,7 @@ void TBufferFile::WriteFastArray(const Long64_t *ll, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, ll[i]);
+   WriteSwappedArray(fBufCur, ll, n);
 #else
    memcpy(fBufCur, ll, l);
    fBufCur += l;
@@ -2098,8 +2235,7 @@ void TBufferFile::WriteFastArray(const Float_t *f, Int_t n)
    bswapcpy32(fBufCur, f, n);
    fBufCur += l;
 # else
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, f[i]);
+   WriteSwappedArray(fBufCur, f, n);
 # endif
 #else
    memcpy(fBufCur, f, l);
@@ -2118,8 +2254,7 @@ void TBufferFile::WriteFastArray(const Double_t *d, Int_t n)
    if (fBufCur + l > fBufMax) AutoExpand(fBufSize+l);
 
 #ifdef R__BYTESWAP
-   for (int i = 0; i < n; i++)
-      tobuf(fBufCur, d[i]);
+   WriteSwappedArray(fBufCur, d, n);
 #else
    memcpy(fBufCur, d, l);
    fBufCur += l;
@@ -2148,7 +2283,7 @@ void TBufferFile::WriteFastArrayFloat16(const Float_t *f, Int_t n, TStreamerElem
          Float_t x = f[j];
          if (x < xmin) x = xmin;
          if (x > xmax) x = xmax;
-         UInt_t aint = UInt_t(0.5+factor*(x-xmin)); *this << aint;
+         UInt_t aint = UInt_t(0.5+factor*(x-xmin)); tobuf(fBufCur, aint);
       }
    } else {
       Int_t nbits = 0;
@@ -2171,8 +2306,8 @@ void TBufferFile::WriteFastArrayFloat16(const Float_t *f, Int_t n, TStreamerElem
          theMan = theMan>>1;
          if (theMan&1<<nbits) theMan = (1<<nbits) - 1;
          if (fFloatValue < 0) theMan |= 1<<(nbits+1);
-         *this << theExp;
-         *this << theMan;
+         tobuf(fBufCur, theExp);
+         tobuf(fBufCur, theMan);
       }
    }
 }
@@ -2199,7 +2334,7 @@ void TBufferFile::WriteFastArrayDouble32(const Double_t *d, Int_t n, TStreamerEl
          Double_t x = d[j];
          if (x < xmin) x = xmin;
          if (x > xmax) x = xmax;
-         UInt_t aint = UInt_t(0.5+factor*(x-xmin)); *this << aint;
+         UInt_t aint = UInt_t(0.5+factor*(x-xmin)); tobuf(fBufCur, aint);
       }
    } else {
       Int_t nbits = 0;
@@ -2208,10 +2343,7 @@ void TBufferFile::WriteFastArrayDouble32(const Double_t *d, Int_t n, TStreamerEl
       Int_t i;
       if (!nbits) {
          //if no range and no bits specified, we convert from double to float
-         for (i = 0; i < n; i++) {
-            Float_t afloat = (Float_t)d[i];
-            *this << afloat;
-         }
+         WriteDoublesAsFloats(fBufCur, d, n);
       } else {
          //a range is not specified, but nbits is.
          //In this case we truncate the mantissa to nbits and we stream
@@ -2228,8 +2360,8 @@ void TBufferFile::WriteFastArrayDouble32(const Double_t *d, Int_t n, TStreamerEl
             theMan = theMan>>1;
             if(theMan&1<<nbits) theMan = (1<<nbits) - 1;
             if (fFloatValue < 0) theMan |= 1<<(nbits+1);
-            *this << theExp;
-            *this << theMan;
+            tobuf(fBufCur, theExp);
+            tobuf(fBufCur, theMan);
          }
       }
    }
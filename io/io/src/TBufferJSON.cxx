@@ -94,6 +94,7 @@ class Container {
 
 #include <typeinfo>
 #include <string>
+#include <charconv>
 #include <cstring>
 #include <locale.h>
 #include <cmath>
@@ -131,6 +132,19 @@ class Container {
 
 ClassImp(TBufferJSON);
 
+namespace {
+
+/// Append the decimal representation of an integer to the json value buffer, without snprintf or temporaries
+template <typename T>
+void AppendInteger(TString &out, T value)
+{
+   char buf[24];
+   auto res = std::to_chars(buf, buf + sizeof(buf), value);
+   out.Append(buf, res.ptr - buf);
+}
+
+} // anonymous namespace
+
 enum { json_TArray = 100, json_TCollection = -130, json_TString = 110, json_stdstring = 120 };
 
 ///////////////////////////////////////////////////////////////
@@ -3039,7 +3053,7 @@ R__ALWAYS_INLINE void TBufferJSON::JsonWriteArrayCompress(const T *vname, Int_t
       fValue.Append("[");
       for (Int_t indx = 0; indx < arrsize; indx++) {
          if (indx > 0)
-            fValue.Append(fArraySepar.Data());
+            fValue.Append(fArraySepar);
          JsonWriteBasic(vname[indx]);
       }
       fValue.Append("]");
@@ -3120,7 +3134,7 @@ R__ALWAYS_INLINE void TBufferJSON::JsonWriteArrayCompress(const T *vname, Int_t
                fValue.Append("[");
                for (Int_t indx = p0; indx < pp; indx++) {
                   if (indx > p0)
-                     fValue.Append(fArraySepar.Data());
+                     fValue.Append(fArraySepar);
                   JsonWriteBasic(vname[indx]);
                }
                fValue.Append("]");
@@ -3880,9 +3894,7 @@ void TBufferJSON::WriteCharStar(char *s)
 
 void TBufferJSON::JsonWriteBasic(Char_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%d", value);
-   fValue.Append(buf);
+   AppendInteger(fValue, (Int_t)value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3890,9 +3902,7 @@ void TBufferJSON::JsonWriteBasic(Char_t value)
 
 void TBufferJSON::JsonWriteBasic(Short_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%hd", value);
-   fValue.Append(buf);
+   AppendInteger(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3900,9 +3910,7 @@ void TBufferJSON::JsonWriteBasic(Short_t value)
 
 void TBufferJSON::JsonWriteBasic(Int_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%d", value);
-   fValue.Append(buf);
+   AppendInteger(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3910,9 +3918,7 @@ void TBufferJSON::JsonWriteBasic(Int_t value)
 
 void TBufferJSON::JsonWriteBasic(Long_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%ld", value);
-   fValue.Append(buf);
+   AppendInteger(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3920,7 +3926,7 @@ void TBufferJSON::JsonWriteBasic(Long_t value)
 
 void TBufferJSON::JsonWriteBasic(Long64_t value)
 {
-   fValue.Append(std::to_string(value).c_str());
+   AppendInteger(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3968,9 +3974,7 @@ void TBufferJSON::JsonWriteBasic(Bool_t value)
 
 void TBufferJSON::JsonWriteBasic(UChar_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%u", value);
-   fValue.Append(buf);
+   AppendInteger(fValue, (UInt_t)value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3978,9 +3982,7 @@ void TBufferJSON::JsonWriteBasic(UChar_t value)
 
 void TBufferJSON::JsonWriteBasic(UShort_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%hu", value);
-   fValue.Append(buf);
+   AppendInteger(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3988,9 +3990,7 @@ void TBufferJSON::JsonWriteBasic(UShort_t value)
 
 void TBufferJSON::JsonWriteBasic(UInt_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%u", value);
-   fValue.Append(buf);
+   AppendInteger(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -3998,9 +3998,7 @@ void TBufferJSON::JsonWriteBasic(UInt_t value)
 
 void TBufferJSON::JsonWriteBasic(ULong_t value)
 {
-   char buf[50];
-   snprintf(buf, sizeof(buf), "%lu", value);
-   fValue.Append(buf);
+   AppendInteger(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -4008,7 +4006,7 @@ void TBufferJSON::JsonWriteBasic(ULong_t value)
 
 void TBufferJSON::JsonWriteBasic(ULong64_t value)
 {
-   fValue.Append(std::to_string(value).c_str());
+   AppendInteger(fValue, value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
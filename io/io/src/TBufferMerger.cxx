@@ -16,6 +16,8 @@
 #include "TROOT.h"
 #include "TVirtualMutex.h"
 
+#include <algorithm>
+#include <thread>
 #include <utility>
 
 namespace ROOT {
@@ -46,7 +48,7 @@ TBufferMerger::~TBufferMerger()
    for (const auto &f : fAttachedFiles)
       if (!f.expired()) Fatal("TBufferMerger", " TBufferMergerFiles must be destroyed before the server");
 
-   if (!fQueue.empty())
+   if (fQueue.load())
       Merge();
 
    // Since we support purely incremental merging, Merge does not write the target objects
@@ -67,20 +69,103 @@ std::shared_ptr<TBufferMergerFile> TBufferMerger::GetFile()
 
 size_t TBufferMerger::GetQueueSize() const
 {
-   std::lock_guard<std::mutex> lock(fQueueMutex);
-   return fQueue.size();
+   return fQueueSize;
 }
 
 void TBufferMerger::Push(TBufferFile *buffer)
 {
-   {
-      std::lock_guard<std::mutex> lock(fQueueMutex);
-      fBuffered += buffer->BufferSize();
-      fQueue.push(buffer);
+   // The counters are increased before the buffer becomes visible to PopAll(), which decreases them
+   fBuffered += buffer->BufferSize();
+   ++fQueueSize;
+   auto node = new QueueNode{buffer, fQueue.load(std::memory_order_relaxed)};
+   while (!fQueue.compare_exchange_weak(node->fNext, node, std::memory_order_release, std::memory_order_relaxed))
+      ;
+
+   if (fMaxBuffered > 0 && fBuffered > fMaxBuffered) {
+      // Backpressure: wait for the ongoing merge instead of queuing more data, then merge in this thread
+      std::lock_guard<std::mutex> lock(fMergeMutex);
+      if (fBuffered > fAutoSave)
+         MergeImpl();
+   } else if (fBuffered > fAutoSave) {
+      Merge();
    }
+}
 
-   if (fBuffered > fAutoSave)
-      Merge();
+std::vector<TBufferFile *> TBufferMerger::PopAll()
+{
+   std::vector<TBufferFile *> buffers;
+   size_t nbytes = 0;
+   QueueNode *node = fQueue.exchange(nullptr, std::memory_order_acquire);
+   while (node) {
+      buffers.push_back(node->fBuffer);
+      nbytes += node->fBuffer->BufferSize();
+      QueueNode *next = node->fNext;
+      delete node;
+      node = next;
+   }
+   // Merge in the order of the pushes
+   std::reverse(buffers.begin(), buffers.end());
+   fQueueSize -= buffers.size();
+   fBuffered -= nbytes;
+   return buffers;
+}
+
+void TBufferMerger::PreMerge(std::vector<TBufferFile *> &buffers)
+{
+   const size_t ngroups = std::min<size_t>(fPreMergeWorkers, buffers.size() / 2);
+   TFile *output = fMerger.GetOutputFile();
+   if (ngroups < 2 || !output)
+      return;
+
+   const TString name = fMerger.GetOutputFileName();
+   const TString options = fMerger.GetMergeOptions();
+   const Int_t compress = output->GetCompressionSettings();
+   const Bool_t notrees = fMerger.GetNotrees();
+
+   // Each group of consecutive buffers is merged into a TMemFile, which replaces the group in the queue
+   std::vector<TBufferFile *> merged(ngroups, nullptr);
+   auto mergeGroup = [&](size_t igroup) {
+      TDirectory::TContext ctxt;
+      TFileMerger merger{false, false};
+      merger.SetMergeOptions(options);
+      merger.SetNotrees(notrees);
+
+      TMemFile *target;
+      {
+         R__LOCKGUARD(gROOTMutex);
+         target = new TMemFile(name, "RECREATE", "", compress);
+         gROOT->GetListOfFiles()->Remove(target);
+      }
+      merger.OutputFile(std::unique_ptr<TFile>(target));
+
+      const size_t begin = igroup * buffers.size() / ngroups;
+      const size_t end = (igroup + 1) * buffers.size() / ngroups;
+      for (size_t i = begin; i < end; ++i)
+         merger.AddAdoptFile(new TMemFile(name, std::unique_ptr<TBufferFile>(buffers[i])));
+
+      if (!merger.PartialMerge(TFileMerger::kAll | TFileMerger::kIncremental | TFileMerger::kKeepCompression))
+         return;
+
+      TBufferFile *buffer = new TBufferFile(TBuffer::kWrite, target->GetSize());
+      target->CopyTo(*buffer);
+      buffer->SetReadMode();
+      merged[igroup] = buffer;
+   };
+
+   std::vector<std::thread> workers;
+   for (size_t igroup = 1; igroup < ngroups; ++igroup)
+      workers.emplace_back(mergeGroup, igroup);
+   mergeGroup(0);
+   for (auto &worker : workers)
+      worker.join();
+
+   buffers.clear();
+   for (auto buffer : merged) {
+      if (buffer)
+         buffers.push_back(buffer);
+      else
+         Error("TBufferMerger", "failed to pre-merge buffers, data is lost");
+   }
 }
 
 size_t TBufferMerger::GetAutoSave() const
@@ -114,18 +199,12 @@ void TBufferMerger::Merge()
 
 void TBufferMerger::MergeImpl()
 {
-   std::queue<TBufferFile *> queue;
-   {
-      std::lock_guard<std::mutex> q(fQueueMutex);
-      std::swap(queue, fQueue);
-      fBuffered = 0;
-   }
+   std::vector<TBufferFile *> buffers = PopAll();
+   if (fPreMergeWorkers > 1)
+      PreMerge(buffers);
 
-   while (!queue.empty()) {
-      std::unique_ptr<TBufferFile> buffer{queue.front()};
-      fMerger.AddAdoptFile(new TMemFile(fMerger.GetOutputFileName(), std::move(buffer)));
-      queue.pop();
-   }
+   for (auto buffer : buffers)
+      fMerger.AddAdoptFile(new TMemFile(fMerger.GetOutputFileName(), std::unique_ptr<TBufferFile>(buffer)));
 
    fMerger.PartialMerge(TFileMerger::kAll | TFileMerger::kIncremental | TFileMerger::kDelayWrite |
                         TFileMerger::kKeepCompression);
@@ -32,10 +32,55 @@ actions list for both are the same.
 #include "TError.h"
 #include "snprintf.h"
 
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+
 ClassImp(TBufferText);
 
 const char *TBufferText::fgFloatFmt = "%e";
 const char *TBufferText::fgDoubleFmt = "%.14e";
+Int_t TBufferText::fgFloatPrec = 6;
+Int_t TBufferText::fgDoublePrec = 14;
+
+namespace {
+
+/// Return the precision of a "%e" or "%.<N>e" printf format, -1 for any other format.
+Int_t ScientificPrecision(const char *fmt)
+{
+   if (!strcmp(fmt, "%e"))
+      return 6;
+   if (strncmp(fmt, "%.", 2) || (fmt[2] < '0') || (fmt[2] > '9'))
+      return -1;
+   char *end = nullptr;
+   long prec = strtol(fmt + 2, &end, 10);
+   return ((end[0] == 'e') && !end[1] && (prec < 100)) ? prec : -1;
+}
+
+/// Print value like printf with "%.<prec>e", or "%1.0f" for negative prec, but without
+/// parsing the format nor looking at the locale. Return false if it cannot be done.
+template <typename T>
+Bool_t ToChars(T value, char *buf, unsigned len, Int_t prec)
+{
+#ifdef __cpp_lib_to_chars
+   if (len > 0) {
+      auto res = (prec < 0) ? std::to_chars(buf, buf + len - 1, value, std::chars_format::fixed, 0)
+                            : std::to_chars(buf, buf + len - 1, value, std::chars_format::scientific, prec);
+      if (res.ec == std::errc()) {
+         *res.ptr = 0;
+         return kTRUE;
+      }
+   }
+#else
+   (void)value;
+   (void)buf;
+   (void)len;
+   (void)prec;
+#endif
+   return kFALSE;
+}
+
+} // anonymous namespace
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Default constructor
@@ -801,6 +846,7 @@ void TBufferText::SetFloatFormat(const char *fmt)
       fmt = "%e";
    fgFloatFmt = fmt;
    fgDoubleFmt = fmt;
+   fgFloatPrec = fgDoublePrec = ScientificPrecision(fmt);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -820,6 +866,7 @@ void TBufferText::SetDoubleFormat(const char *fmt)
    if (!fmt)
       fmt = "%.14e";
    fgDoubleFmt = fmt;
+   fgDoublePrec = ScientificPrecision(fmt);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -832,15 +879,19 @@ const char *TBufferText::GetDoubleFormat()
 
 ////////////////////////////////////////////////////////////////////////////////
 /// convert float to string with configured format
+/// Integral values and the "%.Ne" formats are printed with std::to_chars,
+/// which gives the same result as snprintf much faster
 
 const char *TBufferText::ConvertFloat(Float_t value, char *buf, unsigned len, Bool_t not_optimize)
 {
    if (not_optimize) {
       snprintf(buf, len, fgFloatFmt, value);
    } else if ((value == std::nearbyint(value)) && (std::abs(value) < 1e15)) {
-      snprintf(buf, len, "%1.0f", value);
+      if (!ToChars(value, buf, len, -1))
+         snprintf(buf, len, "%1.0f", value);
    } else {
-      snprintf(buf, len, fgFloatFmt, value);
+      if ((fgFloatPrec < 0) || !ToChars(value, buf, len, fgFloatPrec))
+         snprintf(buf, len, fgFloatFmt, value);
       CompactFloatString(buf, len);
    }
    return buf;
@@ -848,15 +899,19 @@ const char *TBufferText::ConvertFloat(Float_t value, char *buf, unsigned len, Bo
 
 ////////////////////////////////////////////////////////////////////////////////
 /// convert float to string with configured format
+/// Integral values and the "%.Ne" formats are printed with std::to_chars,
+/// which gives the same result as snprintf much faster
 
 const char *TBufferText::ConvertDouble(Double_t value, char *buf, unsigned len, Bool_t not_optimize)
 {
    if (not_optimize) {
       snprintf(buf, len, fgFloatFmt, value);
    } else if ((value == std::nearbyint(value)) && (std::abs(value) < 1e25)) {
-      snprintf(buf, len, "%1.0f", value);
+      if (!ToChars(value, buf, len, -1))
+         snprintf(buf, len, "%1.0f", value);
    } else {
-      snprintf(buf, len, fgDoubleFmt, value);
+      if ((fgDoublePrec < 0) || !ToChars(value, buf, len, fgDoublePrec))
+         snprintf(buf, len, fgDoubleFmt, value);
       CompactFloatString(buf, len);
    }
    return buf;
@@ -49,9 +49,56 @@ End_Macro
 #include "TVirtualMutex.h"
 #include "TEmulatedCollectionProxy.h"
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
 const UInt_t kIsBigFile = BIT(16);
 const Int_t  kMaxLen = 2048;
 
+namespace {
+
+// Layout of the keys index written at the end of the keys record, see TDirectoryFile::WriteKeys.
+const Int_t     kKeysIndexMagic     = 0x4b494458; // "KIDX", last word of the record
+const Version_t kKeysIndexVersion   = 1;
+const Int_t     kKeysIndexHeaderLen = 10;  // version, number of keys, number of class names
+const Int_t     kKeysIndexEntryLen  = 22;  // name offset and length, class, key offset and length, cycle
+const Int_t     kKeysIndexClassLen  = 8;   // class name offset and length
+const Int_t     kKeysIndexFooterLen = 8;   // offset of the index in the record, magic
+
+struct KeysIndexEntry {
+   Int_t   fNameOffset; ///< Offset of the name in the name pool
+   Int_t   fNameLen;    ///< Length of the name
+   Int_t   fClass;      ///< Index of the class name
+   Int_t   fKeyOffset;  ///< Offset of the key header in the keys record
+   Int_t   fKeyLen;     ///< Length of the key header
+   Short_t fCycle;      ///< Cycle of the key
+};
+
+KeysIndexEntry ReadKeysIndexEntry(const char *index, Int_t i)
+{
+   KeysIndexEntry entry;
+   char *buffer = const_cast<char *>(index) + kKeysIndexHeaderLen + i * kKeysIndexEntryLen;
+   frombuf(buffer, &entry.fNameOffset);
+   frombuf(buffer, &entry.fNameLen);
+   frombuf(buffer, &entry.fClass);
+   frombuf(buffer, &entry.fKeyOffset);
+   frombuf(buffer, &entry.fKeyLen);
+   frombuf(buffer, &entry.fCycle);
+   return entry;
+}
+
+/// Compare the name of the entry, stored in `pool`, with `name` of length `len`, as std::string::compare.
+Int_t CompareKeysIndexName(const char *pool, const KeysIndexEntry &entry, const char *name, Int_t len)
+{
+   Int_t cmp = memcmp(pool + entry.fNameOffset, name, std::min(entry.fNameLen, len));
+   return cmp ? cmp : entry.fNameLen - len;
+}
+
+} // anonymous namespace
+
+Int_t TDirectoryFile::fgKeysIndexThreshold = 0;
+
 ClassImp(TDirectoryFile);
 
 
@@ -177,6 +224,7 @@ void TDirectoryFile::InitDirectoryFile(TClass *cl)
 
 TDirectoryFile::~TDirectoryFile()
 {
+   DropKeysIndex();
    if (fKeys) {
       fKeys->Delete("slow");
       SafeDelete(fKeys);
@@ -266,7 +314,7 @@ void TDirectoryFile::Browse(TBrowser *b)
       TObject *obj = nullptr;
       TIter nextin(fList);
       TKey *key = nullptr, *keyo = nullptr;
-      TIter next(fKeys);
+      TIter next(GetListOfKeys());
 
       cd();
 
@@ -575,6 +623,7 @@ void TDirectoryFile::Close(Option_t *option)
    }
 
    // Delete keys from key list (but don't delete the list header)
+   DropKeysIndex();
    if (fKeys) {
       fKeys->Delete("slow");
    }
@@ -961,6 +1010,13 @@ TObject *TDirectoryFile::Get(const char *namecycle)
 
 //*-*---------------------Case of Key---------------------
 //                        ===========
+   if (fKeysIndexOffset && LoadKeysIndex()) {
+      TKey *key = GetKeyFromIndex(namobj, cycle, kTRUE);
+      if (!key) return nullptr;
+      TDirectory::TContext ctxt(this);
+      return key->ReadObj();
+   }
+
    auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
    if (!listOfKeys) {
       Error("Get", "Unexpected type of TDirectoryFile::fKeys!");
@@ -1084,6 +1140,13 @@ void *TDirectoryFile::GetObjectChecked(const char *namecycle, const TClass* expe
 
 //*-*---------------------Case of Key---------------------
 //                        ===========
+   if (fKeysIndexOffset && LoadKeysIndex()) {
+      TKey *key = GetKeyFromIndex(namobj, cycle, kTRUE);
+      if (!key) return nullptr;
+      TDirectory::TContext ctxt(this);
+      return key->ReadObjectAny(expectedClass);
+   }
+
    auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
    if (!listOfKeys) {
       Error("GetObjectChecked", "Unexpected type of TDirectoryFile::fKeys!");
@@ -1125,6 +1188,9 @@ TKey *TDirectoryFile::GetKey(const char *name, Short_t cycle) const
 {
    if (!fKeys) return nullptr;
 
+   if (fKeysIndexOffset && LoadKeysIndex())
+      return GetKeyFromIndex(name, cycle, kFALSE);
+
    auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
    if (!listOfKeys) {
       Error("GetKey", "Unexpected type of TDirectoryFile::fKeys!");
@@ -1190,7 +1256,7 @@ void TDirectoryFile::ls(Option_t *option) const
       }
    }
 
-   if (diskobj && fKeys) {
+   if (diskobj && GetListOfKeys()) {
       //*-* Loop on all the keys
       TObjLink *lnk = fKeys->FirstLink();
       while (lnk) {
@@ -1360,6 +1426,11 @@ void TDirectoryFile::ReadAll(Option_t* opt)
 /// This is an efficient way (without opening/closing files) to view
 /// the latest updates of a file being modified by another process
 /// as it is typically the case in a data acquisition system.
+///
+/// If forceRead is false, the directory is not writable and its keys record
+/// holds a keys index (see TDirectoryFile::SetKeysIndexThreshold), the keys
+/// are not read: name lookups (Get, GetKey, ...) use the index and only read
+/// the key they find; the keys are all read when the list of keys is needed.
 
 Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
 {
@@ -1372,6 +1443,7 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
 
    char *buffer;
    if (forceRead) {
+      DropKeysIndex();
       fKeys->Delete();
       //In case directory was updated by another process, read new
       //position for the keys
@@ -1404,10 +1476,37 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
       delete [] header;
    }
 
+   if (fSeekKeys > 0 && !forceRead && !fFile->IsWritable() && fKeys->IsEmpty() && !fKeysIndexOffset &&
+       fNbytesKeys > kKeysIndexFooterLen) {
+      char footer[kKeysIndexFooterLen];
+      if (!fFile->ReadBuffer(footer, fSeekKeys + fNbytesKeys - kKeysIndexFooterLen, kKeysIndexFooterLen)) {
+         buffer = footer;
+         Int_t offset, magic;
+         frombuf(buffer, &offset);
+         frombuf(buffer, &magic);
+         if (magic == kKeysIndexMagic && offset > 0 && offset <= fNbytesKeys - kKeysIndexFooterLen - kKeysIndexHeaderLen) {
+            fKeysIndexOffset = offset;
+            return GetNkeys();
+         }
+      }
+   }
+
+   return ReadKeysRecord(nullptr);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read the keys record into fKeys. If `known` is given, a key found in
+/// `known` (same name, cycle and location) is moved from `known` instead of
+/// being created again.
+
+Int_t TDirectoryFile::ReadKeysRecord(THashList *known) const
+{
+   char *buffer;
    Int_t nkeys = 0;
    Long64_t fsize = fFile->GetSize();
+   TDirectoryFile *self = const_cast<TDirectoryFile *>(this);
    if ( fSeekKeys >  0) {
-      TKey *headerkey    = new TKey(fSeekKeys, fNbytesKeys, this);
+      TKey *headerkey    = new TKey(fSeekKeys, fNbytesKeys, self);
       headerkey->ReadFile();
       buffer = headerkey->GetBuffer();
       headerkey->ReadKeyBuffer(buffer);
@@ -1415,7 +1514,7 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
       TKey *key;
       frombuf(buffer, &nkeys);
       for (Int_t i = 0; i < nkeys; i++) {
-         key = new TKey(this);
+         key = new TKey(self);
          key->ReadKeyBuffer(buffer);
          if (key->GetSeekKey() < 64 || key->GetSeekKey() > fsize) {
             Error("ReadKeys","reading illegal key, exiting after %d keys",i);
@@ -1429,6 +1528,17 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
             nkeys = i;
             break;
          }
+         if (const TList *keyList = known ? known->GetListForObject(key->GetName()) : nullptr) {
+            for (auto knownKey : TRangeDynCast<TKey>(*keyList)) {
+               if (knownKey && knownKey->GetCycle() == key->GetCycle() && knownKey->GetSeekKey() == key->GetSeekKey()
+                   && !strcmp(knownKey->GetName(), key->GetName())) {
+                  delete key;
+                  key = knownKey;
+                  known->Remove(knownKey);
+                  break;
+               }
+            }
+         }
          fKeys->Add(key);
       }
       delete headerkey;
@@ -1437,6 +1547,176 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
    return nkeys;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Forget the keys index: the keys are either all read or about to be deleted.
+
+void TDirectoryFile::DropKeysIndex() const
+{
+   delete [] fKeysIndex;
+   fKeysIndex = nullptr;
+   fKeysIndexLen = 0;
+   fKeysIndexOffset = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read the keys index found by ReadKeys, if not yet done. In case of error,
+/// read all the keys instead and return false.
+
+Bool_t TDirectoryFile::LoadKeysIndex() const
+{
+   if (fKeysIndex) return kTRUE;
+
+   Int_t len = fNbytesKeys - kKeysIndexFooterLen - fKeysIndexOffset;
+   char *index = new char[len];
+   Bool_t ok = !fFile->ReadBuffer(index, fSeekKeys + fKeysIndexOffset, len);
+   if (ok) {
+      char *buffer = index;
+      Version_t version;
+      Int_t nentries, nclasses;
+      frombuf(buffer, &version);
+      frombuf(buffer, &nentries);
+      frombuf(buffer, &nclasses);
+      ok = version == kKeysIndexVersion && nentries >= 0 && nclasses >= 0 &&
+           kKeysIndexHeaderLen + Long64_t(nentries) * kKeysIndexEntryLen + Long64_t(nclasses) * kKeysIndexClassLen <= len;
+   }
+   if (!ok) {
+      delete [] index;
+      Error("LoadKeysIndex", "cannot read the keys index of %s, reading all the keys", GetName());
+      ReadPendingKeys();
+      return kFALSE;
+   }
+   fKeysIndex = index;
+   fKeysIndexLen = len;
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Find the key `name` in the keys index, with the given cycle (9999 for the
+/// highest one) or, if `exactCycle` is false, with the highest cycle not above
+/// it. Only the header of this key is read, and added to the list of keys.
+
+TKey *TDirectoryFile::GetKeyFromIndex(const char *name, Short_t cycle, Bool_t exactCycle) const
+{
+   char *buffer = fKeysIndex + sizeof(Version_t);
+   Int_t nentries, nclasses;
+   frombuf(buffer, &nentries);
+   frombuf(buffer, &nclasses);
+   const char *pool = fKeysIndex + kKeysIndexHeaderLen + nentries * kKeysIndexEntryLen + nclasses * kKeysIndexClassLen;
+   const Int_t len = strlen(name);
+
+   // The entries are sorted by name, then by decreasing cycle.
+   Int_t lo = 0, hi = nentries;
+   while (lo < hi) {
+      Int_t mid = lo + (hi - lo) / 2;
+      if (CompareKeysIndexName(pool, ReadKeysIndexEntry(fKeysIndex, mid), name, len) < 0)
+         lo = mid + 1;
+      else
+         hi = mid;
+   }
+   for (Int_t i = lo; i < nentries; ++i) {
+      KeysIndexEntry entry = ReadKeysIndexEntry(fKeysIndex, i);
+      if (CompareKeysIndexName(pool, entry, name, len) != 0)
+         return nullptr;
+      if (cycle != 9999 && (exactCycle ? cycle != entry.fCycle : cycle < entry.fCycle))
+         continue;
+
+      // The key may have been read already.
+      if (const TList *keyList = static_cast<THashList *>(fKeys)->GetListForObject(name)) {
+         for (auto key : TRangeDynCast<TKey>(*keyList)) {
+            if (key && key->GetCycle() == entry.fCycle && !strcmp(key->GetName(), name))
+               return key;
+         }
+      }
+
+      std::vector<char> header(entry.fKeyLen);
+      if (fFile->ReadBuffer(header.data(), fSeekKeys + entry.fKeyOffset, entry.fKeyLen)) {
+         Error("GetKey", "cannot read the key %s;%d", name, entry.fCycle);
+         return nullptr;
+      }
+      TKey *key = new TKey(const_cast<TDirectoryFile *>(this));
+      buffer = header.data();
+      key->ReadKeyBuffer(buffer);
+      if (key->GetSeekKey() < 64 || key->GetSeekKey() > fFile->GetSize() || strcmp(key->GetName(), name)) {
+         Error("GetKey", "reading illegal key %s;%d", name, entry.fCycle);
+         key->SetMotherDir(nullptr); // Not in the list of keys
+         delete key;
+         return nullptr;
+      }
+      fKeys->Add(key);
+      return key;
+   }
+   return nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read all the keys of a directory read with a keys index. The keys already
+/// read through the index are kept, so that pointers to them stay valid.
+
+void TDirectoryFile::ReadPendingKeys() const
+{
+   THashList known;
+   known.AddAll(fKeys);
+   fKeys->Clear("nodelete");
+   DropKeysIndex();
+   TDirectory::TContext ctxt(const_cast<TDirectoryFile *>(this));
+   ReadKeysRecord(&known);
+   // Keys not found again (which should not happen) keep belonging to this directory.
+   fKeys->AddAll(&known);
+   known.Clear("nodelete");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of keys of this directory.
+
+Int_t TDirectoryFile::GetNkeys() const
+{
+   if (fKeysIndexOffset && LoadKeysIndex()) {
+      char *buffer = fKeysIndex + sizeof(Version_t);
+      Int_t nentries;
+      frombuf(buffer, &nentries);
+      return nentries;
+   }
+   return fKeys->GetSize();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of keys of this directory whose class is `classname`.
+
+Int_t TDirectoryFile::GetNkeysOfClass(const char *classname) const
+{
+   if (fKeysIndexOffset && LoadKeysIndex()) {
+      char *buffer = fKeysIndex + sizeof(Version_t);
+      Int_t nentries, nclasses;
+      frombuf(buffer, &nentries);
+      frombuf(buffer, &nclasses);
+      const char *classes = fKeysIndex + kKeysIndexHeaderLen + nentries * kKeysIndexEntryLen;
+      const char *pool = classes + nclasses * kKeysIndexClassLen;
+      Int_t classIndex = -1;
+      for (Int_t i = 0; i < nclasses && classIndex < 0; ++i) {
+         buffer = const_cast<char *>(classes) + i * kKeysIndexClassLen;
+         Int_t offset, len;
+         frombuf(buffer, &offset);
+         frombuf(buffer, &len);
+         if (len == (Int_t)strlen(classname) && !memcmp(pool + offset, classname, len))
+            classIndex = i;
+      }
+      Int_t n = 0;
+      for (Int_t i = 0; classIndex >= 0 && i < nentries; ++i) {
+         if (ReadKeysIndexEntry(fKeysIndex, i).fClass == classIndex)
+            ++n;
+      }
+      return n;
+   }
+
+   Int_t n = 0;
+   TIter next(fKeys);
+   while (TKey *key = (TKey *)next()) {
+      if (!strcmp(key->GetClassName(), classname))
+         ++n;
+   }
+   return n;
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Read object with keyname from the current directory
@@ -1450,6 +1730,12 @@ Int_t TDirectoryFile::ReadKeys(Bool_t forceRead)
 Int_t TDirectoryFile::ReadTObject(TObject *obj, const char *keyname)
 {
    if (!fFile) { Error("ReadTObject","No file open"); return 0; }
+   if (fKeysIndexOffset && LoadKeysIndex()) {
+      if (TKey *key = GetKeyFromIndex(keyname, 9999, kFALSE))
+         return key->Read(obj);
+      Error("ReadTObject","Key not found");
+      return 0;
+   }
    auto listOfKeys = dynamic_cast<THashList *>(GetListOfKeys());
    if (!listOfKeys) {
       Error("ReadTObject", "Unexpected type of TDirectoryFile::fKeys!");
@@ -1667,6 +1953,10 @@ void TDirectoryFile::SetWritable(Bool_t writable)
 {
    TDirectory::TContext ctxt(this);
 
+   // A writable directory needs the complete list of keys.
+   if (writable && fKeysIndexOffset)
+      ReadPendingKeys();
+
    fWritable = writable;
 
    // recursively set all sub-directories
@@ -1763,7 +2053,7 @@ void TDirectoryFile::Streamer(TBuffer &b)
       fList->UseRWLock();
       R__LOCKGUARD(gROOTMutex);
       gROOT->GetUUIDs()->AddUUID(fUUID,this);
-      if (fSeekKeys) ReadKeys();
+      if (fSeekKeys) ReadKeys(kFALSE);
    } else {
       if (fFile && !fFile->IsBinary()) {
          b.WriteVersion(TDirectoryFile::Class());
@@ -2117,6 +2407,32 @@ Int_t TDirectoryFile::WriteObjectAny(const void *obj, const TClass *cl, const ch
    return nbytes;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the minimum number of keys of a directory for its keys index to be
+/// written, 0 if the index is never written. See SetKeysIndexThreshold.
+
+Int_t TDirectoryFile::GetKeysIndexThreshold()
+{
+   return fgKeysIndexThreshold;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write an index of the keys, sorted by name, in the keys record of the
+/// directories with at least `nkeys` keys written from now on; 0 (the
+/// default) disables the index.
+///
+/// When such a directory is opened read-only, its keys are not read: Get and
+/// GetKey find the key in the index and only read this key, which makes the
+/// opening of directories with millions of keys cheap. The keys are all read
+/// at the first call to GetListOfKeys, e.g. by ls() or when iterating on the
+/// keys. The index is stored after the keys, so that the files stay readable
+/// by older versions of ROOT.
+
+void TDirectoryFile::SetKeysIndexThreshold(Int_t nkeys)
+{
+   fgKeysIndexThreshold = nkeys;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Overwrite the Directory header record.
 
@@ -2148,6 +2464,11 @@ void TDirectoryFile::WriteDirHeader()
 /// Write Keys linked list on the file.
 ///
 ///  The linked list of keys (fKeys) is written as a single data record
+///
+/// For directories with at least GetKeysIndexThreshold() keys, the record
+/// ends with an index of the keys sorted by name, which allows to look up a
+/// key without reading all of them (see ReadKeys). The index is ignored by
+/// the versions of ROOT not knowing about it.
 
 void TDirectoryFile::WriteKeys()
 {
@@ -2172,18 +2493,91 @@ void TDirectoryFile::WriteKeys()
    while ((key = (TKey*)next())) {
       nbytes += key->Sizeof();
    }
+
+   // Sorted index: fixed size entries, then the class names, then a pool of the names.
+   struct IndexEntry {
+      TKey *fKey;
+      Int_t fOrder;
+      Int_t fClass;
+      Int_t fKeyOffset;
+   };
+   std::vector<IndexEntry> index;
+   std::vector<std::string> classes;
+   Int_t poolLen = 0;
+   if (fgKeysIndexThreshold > 0 && nkeys >= fgKeysIndexThreshold) {
+      index.reserve(nkeys);
+      next.Reset();
+      while ((key = (TKey*)next())) {
+         auto cl = std::find(classes.begin(), classes.end(), key->GetClassName());
+         if (cl == classes.end()) {
+            classes.emplace_back(key->GetClassName());
+            poolLen += classes.back().size();
+            cl = classes.end() - 1;
+         }
+         index.push_back({key, (Int_t)index.size(), (Int_t)(cl - classes.begin()), 0});
+         poolLen += strlen(key->GetName());
+      }
+      nbytes += kKeysIndexHeaderLen + nkeys * kKeysIndexEntryLen + classes.size() * kKeysIndexClassLen + poolLen +
+                kKeysIndexFooterLen;
+   }
+
    TKey *headerkey  = new TKey(fName,fTitle,IsA(),nbytes,this);
    if (headerkey->GetSeekKey() == 0) {
       delete headerkey;
       return;
    }
    char *buffer = headerkey->GetBuffer();
+   char *record = buffer - headerkey->GetKeylen();
    next.Reset();
    tobuf(buffer, nkeys);
-   while ((key = (TKey*)next())) {
+   for (Int_t i = 0; (key = (TKey*)next()); ++i) {
+      if (!index.empty())
+         index[i].fKeyOffset = buffer - record;
       key->FillBuffer(buffer);
    }
 
+   if (!index.empty()) {
+      const Int_t indexOffset = buffer - record;
+      std::sort(index.begin(), index.end(), [](const IndexEntry &a, const IndexEntry &b) {
+         int cmp = strcmp(a.fKey->GetName(), b.fKey->GetName());
+         if (cmp != 0) return cmp < 0;
+         if (a.fKey->GetCycle() != b.fKey->GetCycle()) return a.fKey->GetCycle() > b.fKey->GetCycle();
+         return a.fOrder < b.fOrder;
+      });
+      tobuf(buffer, kKeysIndexVersion);
+      tobuf(buffer, (Int_t)index.size());
+      tobuf(buffer, (Int_t)classes.size());
+      Int_t poolOffset = 0;
+      for (const auto &entry : index) {
+         const Int_t len = strlen(entry.fKey->GetName());
+         tobuf(buffer, poolOffset);
+         tobuf(buffer, len);
+         tobuf(buffer, entry.fClass);
+         tobuf(buffer, entry.fKeyOffset);
+         tobuf(buffer, entry.fKey->Sizeof());
+         tobuf(buffer, entry.fKey->GetCycle());
+         poolOffset += len;
+      }
+      for (const auto &cl : classes) {
+         tobuf(buffer, poolOffset);
+         tobuf(buffer, (Int_t)cl.size());
+         poolOffset += cl.size();
+      }
+      for (const auto &entry : index) {
+         const Int_t len = strlen(entry.fKey->GetName());
+         memcpy(buffer, entry.fKey->GetName(), len);
+         buffer += len;
+      }
+      for (const auto &cl : classes) {
+         memcpy(buffer, cl.data(), cl.size());
+         buffer += cl.size();
+      }
+      // The footer is at the very end of the record, after the slack left for big files.
+      buffer = record + headerkey->GetNbytes() - kKeysIndexFooterLen;
+      tobuf(buffer, indexOffset);
+      tobuf(buffer, kKeysIndexMagic);
+   }
+
    fSeekKeys     = headerkey->GetSeekKey();
    fNbytesKeys   = headerkey->GetNbytes();
    headerkey->WriteFile();
@@ -89,8 +89,10 @@ The structure of a directory is shown in TDirectoryFile::TDirectoryFile
 #include "Strlen.h"
 #include "strlcpy.h"
 #include "snprintf.h"
+#include "RZip.h"
 #include "TArrayC.h"
 #include "TBuffer.h"
+#include "TBufferFile.h"
 #include "TClass.h"
 #include "TClassEdit.h"
 #include "TClassTable.h"
@@ -122,14 +124,21 @@ The structure of a directory is shown in TDirectoryFile::TDirectoryFile
 #include "TObjString.h"
 #include "TStopwatch.h"
 #include "compiledata.h"
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <iostream>
+#include <map>
+#include <mutex>
 #include <set>
+#include <string>
+#include <vector>
 #include "TSchemaRule.h"
 #include "TSchemaRuleSet.h"
 #include "TThreadSlots.h"
 #include "TGlobal.h"
 #include "ROOT/RConcurrentHashColl.hxx"
+#include "ROOT/RTracing.hxx"
 #include <memory>
 
 using std::sqrt;
@@ -140,18 +149,36 @@ std::atomic<Long64_t> TFile::fgFileCounter{0};
 std::atomic<Int_t>    TFile::fgReadCalls{0};
 Int_t    TFile::fgReadaheadSize = 256000;
 Bool_t   TFile::fgReadInfo = kTRUE;
+std::atomic<Int_t> TFile::fgMetadataPrefetchSize{0};
 TList   *TFile::fgAsyncOpenRequests = nullptr;
 TString  TFile::fgCacheFileDir;
 Bool_t   TFile::fgCacheFileForce = kFALSE;
 Bool_t   TFile::fgCacheFileDisconnected = kTRUE;
 UInt_t   TFile::fgOpenTimeout = TFile::kEternalTimeout;
 Bool_t   TFile::fgOnlyStaged = kFALSE;
-#ifdef R__USE_IMT
 ROOT::Internal::RConcurrentHashColl TFile::fgTsSIHashes;
-#endif
+
+namespace {
+/// The class index entries set by each StreamerInfo record already read, keyed
+/// by the hash of the record. A file whose record was already read gets its
+/// class index from here instead of reading and checking the StreamerInfos again.
+struct RSIClassIndexRegistry {
+   std::mutex fMutex;
+   std::map<ROOT::Internal::RConcurrentHashColl::HashValue, std::vector<Int_t>> fUids;
+};
+
+RSIClassIndexRegistry &GetSIClassIndexRegistry()
+{
+   static RSIClassIndexRegistry registry;
+   return registry;
+}
+} // anonymous namespace
 
 const Int_t kBEGIN = 100;
 
+/// Name of the key holding the ZSTD dictionary of a file, see TFile::SetZstdDictionary.
+static const char *kZstdDictionaryName = "ZstdDictionary";
+
 ClassImp(TFile);
 
 //*-*x17 macros/layout_file
@@ -201,9 +228,18 @@ TFile::TFile() : TDirectoryFile(), fCompress(ROOT::RCompressionSetting::EAlgorit
 /// READ                              | Open an existing file for reading (default).
 /// NET                               | Used by derived remote file access classes, not a user callable option.
 /// WEB                               | Used by derived remote http access class, not a user callable option.
-/// READ_WITHOUT_GLOBALREGISTRATION   | Used by TTreeProcessorMT, not a user callable option.
+/// READ_WITHOUT_GLOBALREGISTRATION   | Open an existing file for reading without registering it in the global lists (see below).
+/// CREATE_WITHOUT_GLOBALREGISTRATION, RECREATE_WITHOUT_GLOBALREGISTRATION, UPDATE_WITHOUT_GLOBALREGISTRATION | As CREATE, RECREATE and UPDATE, without registering the file in the global lists.
 ///
 /// If option = "" (default), READ is assumed.
+///
+/// The files opened with one of the `_WITHOUT_GLOBALREGISTRATION` options are not added
+/// to gROOT->GetListOfFiles() and the other global lists, so opening and closing them does
+/// not take the global ROOT lock. This is meant for files used by a single thread, e.g. by
+/// TTreeProcessorMT or by the workers of a merge service. Such files are not closed
+/// automatically at the end of the process, are not found by gROOT->GetFile() and are not
+/// informed by RecursiveRemove of the deletion of other objects, hence the user must
+/// close and delete them.
 /// The file can be specified as a URL of the form:
 ///
 ///     file:///user/rdm/bla.root or file:/user/rdm/bla.root
@@ -350,6 +386,14 @@ TFile::TFile(const char *fname1, Option_t *option, const char *ftitle, Int_t com
 
    fOption.ToUpper();
 
+   if (fOption.EndsWith("_WITHOUT_GLOBALREGISTRATION")) {
+      fOption.Remove(fOption.Length() - strlen("_WITHOUT_GLOBALREGISTRATION"));
+      fGlobalRegistration = false;
+      if (fList) {
+         fList->UseRWLock(false);
+      }
+   }
+
    if (fIsRootFile && !fIsPcmFile && fOption != "NEW" && fOption != "CREATE"
        && fOption != "RECREATE") {
       // If !gPluginMgr then we are at startup and cannot handle plugins
@@ -376,14 +420,6 @@ TFile::TFile(const char *fname1, Option_t *option, const char *ftitle, Int_t com
    if (fOption == "NEW")
       fOption = "CREATE";
 
-   if (fOption == "READ_WITHOUT_GLOBALREGISTRATION") {
-      fOption = "READ";
-      fGlobalRegistration = false;
-      if (fList) {
-         fList->UseRWLock(false);
-      }
-   }
-
    Bool_t create   = (fOption == "CREATE") ? kTRUE : kFALSE;
    Bool_t recreate = (fOption == "RECREATE") ? kTRUE : kFALSE;
    Bool_t update   = (fOption == "UPDATE") ? kTRUE : kFALSE;
@@ -777,6 +813,10 @@ void TFile::Init(Bool_t create)
       //*-* -------------attempt recovering the file
       Bool_t tryrecover = (gEnv->GetValue("TFile.Recover", 1) == 1) ? kTRUE : kFALSE;
 
+      //*-* -------------Read keys list and StreamerInfo records in one go if requested
+      if (fEND <= size && !fWritable)
+         PrefetchMetadata();
+
       //*-* -------------Read keys of the top directory
       if (fSeekKeys > fBEGIN && fEND <= size) {
          //normal case. Recover only if file has no keys
@@ -830,6 +870,16 @@ void TFile::Init(Bool_t create)
       gROOT->GetUUIDs()->AddUUID(fUUID, this);
    }
 
+   // Register the ZSTD dictionary of this file before reading anything that
+   // might be compressed with it, starting with the StreamerInfo record.
+   if (TKey *dictKey = GetKey(kZstdDictionaryName)) {
+      std::unique_ptr<TObjString> dict(dictKey->ReadObject<TObjString>());
+      if (dict)
+         fZstdDictionaryId = R__ZSTDRegisterDictionary(dict->String().Data(), dict->String().Length());
+      if (!fZstdDictionaryId)
+         Error("Init", "cannot register the ZSTD dictionary of %s, objects compressed with it cannot be read", GetName());
+   }
+
    // Create StreamerInfo index
    {
       Int_t lenIndex = gROOT->GetListOfStreamerInfo()->GetSize()+1;
@@ -845,7 +895,7 @@ void TFile::Init(Bool_t create)
             }
          } else if (fVersion != gROOT->GetVersionInt() && fVersion > 30000) {
             // Don't complain about missing streamer info for empty files.
-            if (fKeys->GetSize()) {
+            if (GetNkeys()) {
                Warning("Init","no StreamerInfo found in %s therefore preventing schema evolution when reading this file."
                               " The file was produced with version %d.%02d/%02d of ROOT.",
                               GetName(),  fVersion / 10000, (fVersion / 100) % (100), fVersion  % 100);
@@ -854,19 +904,19 @@ void TFile::Init(Bool_t create)
       }
    }
 
+   // The prefetched metadata have been consumed
+   std::vector<char>().swap(fMetadataBuffer);
+
    // Count number of TProcessIDs in this file
    {
-      TIter next(fKeys);
-      TKey *key;
-      while ((key = (TKey*)next())) {
-         if (!strcmp(key->GetClassName(),"TProcessID")) fNProcessIDs++;
-      }
+      fNProcessIDs += GetNkeysOfClass("TProcessID");
       fProcessIDs = new TObjArray(fNProcessIDs+1);
    }
 
    return;
 
 zombie:
+   std::vector<char>().swap(fMetadataBuffer);
    if (fGlobalRegistration) {
       R__LOCKGUARD(gROOTMutex);
       gROOT->GetListOfClosedObjects()->Add(this);
@@ -1326,7 +1376,6 @@ TFile::InfoListRet TFile::GetStreamerInfoListImpl(bool lookupSICache)
          return {nullptr, 1, hash};
       }
 
-#ifdef R__USE_IMT
       if (lookupSICache) {
          // key data must be excluded from the hash, otherwise the timestamp will
          // always lead to unique hashes for each file
@@ -1336,9 +1385,6 @@ TFile::InfoListRet TFile::GetStreamerInfoListImpl(bool lookupSICache)
             return {nullptr, 0, hash};
          }
       }
-#else
-      (void) lookupSICache;
-#endif
       key->ReadKeyBuffer(buf);
       list = dynamic_cast<TList*>(key->ReadObjWithBuffer(buffer.data()));
       if (list) list->SetOwner();
@@ -1753,6 +1799,8 @@ Bool_t TFile::ReadBuffer(char *buf, Int_t len)
 
 Bool_t TFile::ReadBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
 {
+   ROOT::Internal::RTraceScope traceScope("TFile::ReadBuffers", "io");
+
    // called with buf=0, from TFileCacheRead to pass list of readahead buffers
    if (!buf) {
       for (Int_t j = 0; j < nbuf; j++) {
@@ -1822,6 +1870,12 @@ Bool_t TFile::ReadBuffers(char *buf, Long64_t *pos, Int_t *len, Int_t nbuf)
 Int_t TFile::ReadBufferViaCache(char *buf, Int_t len)
 {
    Long64_t off = GetRelOffset();
+   if (buf && !fMetadataBuffer.empty() && off >= fMetadataSeek &&
+       off + len <= fMetadataSeek + (Long64_t)fMetadataBuffer.size()) {
+      memcpy(buf, fMetadataBuffer.data() + (off - fMetadataSeek), len);
+      SetOffset(off + len);
+      return 1;
+   }
    if (fCacheRead) {
       Int_t st = fCacheRead->ReadBuffer(buf, off, len);
       if (st < 0)
@@ -1848,6 +1902,37 @@ Int_t TFile::ReadBufferViaCache(char *buf, Int_t len)
    return 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Read the keys list of the top directory and the StreamerInfo record with a
+/// single request, if both together are not larger than GetMetadataPrefetchSize().
+///
+/// With a remote file this saves a round trip while opening it; the two records
+/// are normally next to each other at the end of the file. The subsequent reads
+/// of these records are served from the prefetched buffer until Init() is done.
+
+void TFile::PrefetchMetadata()
+{
+   const Int_t maxBytes = fgMetadataPrefetchSize;
+   if (maxBytes <= 0 || fSeekKeys <= fBEGIN || fNbytesKeys <= 0)
+      return;
+
+   Long64_t first = fSeekKeys;
+   Long64_t last = fSeekKeys + fNbytesKeys;
+   if (fgReadInfo && fSeekInfo > fBEGIN && fNbytesInfo > 0) {
+      first = std::min(first, fSeekInfo);
+      last = std::max(last, fSeekInfo + fNbytesInfo);
+   }
+   if (last > fEND || last - first > maxBytes)
+      return;
+
+   std::vector<char> buffer(last - first);
+   // On failure, the regular reads of the records report the error.
+   if (ReadBuffer(buffer.data(), first, buffer.size()))
+      return;
+   fMetadataBuffer = std::move(buffer);
+   fMetadataSeek = first;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Read the FREE linked list.
 ///
@@ -2273,6 +2358,83 @@ void TFile::SetCompressionSettings(Int_t settings)
    fCompress = settings;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Use the ZSTD dictionary `dict` of `size` bytes for the ZSTD compression of
+/// the objects and baskets written from now on to this file.
+///
+/// Small buffers, like the ones of small objects or small baskets, compress
+/// much better with a dictionary trained on similar data (see
+/// TrainZstdDictionary); the dictionary must be in the zstd format, as produced
+/// by `zstd --train` or ZDICT_trainFromBuffer. It is stored in the file under the
+/// key "ZstdDictionary" and is registered for the process when the file is opened,
+/// so that the buffers compressed with it can be read back. Older ROOT versions
+/// cannot read these buffers.
+///
+/// A file has at most one dictionary; return kFALSE if the file already has
+/// one, is not writable or if the dictionary is invalid.
+
+Bool_t TFile::SetZstdDictionary(const char *dict, Int_t size)
+{
+   if (!IsWritable()) {
+      Error("SetZstdDictionary", "file %s is not writable", GetName());
+      return kFALSE;
+   }
+   if (fZstdDictionaryId) {
+      Error("SetZstdDictionary", "file %s already has a ZSTD dictionary", GetName());
+      return kFALSE;
+   }
+   UInt_t dictId = R__ZSTDRegisterDictionary(dict, size);
+   if (!dictId) {
+      Error("SetZstdDictionary", "invalid ZSTD dictionary for file %s", GetName());
+      return kFALSE;
+   }
+
+   // The dictionary itself is written before enabling it.
+   TObjString content;
+   content.String() = TString(dict, size);
+   if (WriteTObject(&content, kZstdDictionaryName) <= 0) {
+      Error("SetZstdDictionary", "cannot write the ZSTD dictionary to file %s", GetName());
+      return kFALSE;
+   }
+   fZstdDictionaryId = dictId;
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Train a ZSTD dictionary of at most `maxsize` bytes on the objects of
+/// `samples` and use it for this file, see SetZstdDictionary.
+///
+/// The samples should be representative of the objects that will be written,
+/// e.g. the first few hundred of the histograms of a calibration file. Return
+/// kFALSE if the training fails, typically because there are too few samples.
+
+Bool_t TFile::TrainZstdDictionary(const TCollection *samples, Int_t maxsize)
+{
+   if (!samples || maxsize <= 0)
+      return kFALSE;
+
+   std::string content;
+   std::vector<Int_t> sizes;
+   TBufferFile buffer(TBuffer::kWrite);
+   buffer.SetParent(this);
+   for (TObject *obj : *samples) {
+      buffer.SetBufferOffset(0);
+      buffer.ResetMap();
+      buffer.MapObject(obj);
+      obj->Streamer(buffer);
+      content.append(buffer.Buffer(), buffer.Length());
+      sizes.push_back(buffer.Length());
+   }
+
+   std::vector<char> dict(maxsize);
+   Int_t size = sizes.empty() ? 0 : R__ZSTDTrainDictionary(dict.data(), maxsize, content.data(), sizes.data(), sizes.size());
+   if (!size) {
+      Error("TrainZstdDictionary", "cannot train a ZSTD dictionary on %d objects", (Int_t)sizes.size());
+      return kFALSE;
+   }
+   return SetZstdDictionary(dict.data(), size);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set a pointer to the read cache.
 ///
@@ -3541,7 +3703,22 @@ void TFile::ReadStreamerInfo()
    TList *list = listRetcode.fList;
    auto retcode = listRetcode.fReturnCode;
    if (!list) {
-      if (retcode) MakeZombie();
+      if (retcode) {
+         MakeZombie();
+      } else if (fClassIndex) {
+         // The same record was already read: its StreamerInfos are known and checked,
+         // only the class index of this file remains to be set.
+         auto &registry = GetSIClassIndexRegistry();
+         std::lock_guard<std::mutex> lock(registry.fMutex);
+         auto it = registry.fUids.find(listRetcode.fHash);
+         if (it != registry.fUids.end()) {
+            for (auto uid : it->second) {
+               if (uid >= fClassIndex->GetSize())
+                  fClassIndex->Set(std::max(2 * fClassIndex->GetSize(), uid + 1));
+               fClassIndex->fArray[uid] = 1;
+            }
+         }
+      }
       return;
    }
 
@@ -3642,11 +3819,21 @@ void TFile::ReadStreamerInfo()
    list->Clear();  //this will delete all TStreamerInfo objects with kCanDelete bit set
    delete list;
 
-#ifdef R__USE_IMT
+   // Remember the class index entries set by this record, for the next files having the same one.
+   std::vector<Int_t> uids;
+   for (Int_t uid = 1; uid < fClassIndex->GetSize(); ++uid) {
+      if (fClassIndex->fArray[uid])
+         uids.push_back(uid);
+   }
+   {
+      auto &registry = GetSIClassIndexRegistry();
+      std::lock_guard<std::mutex> lock(registry.fMutex);
+      registry.fUids.emplace(listRetcode.fHash, std::move(uids));
+   }
+
    // We are done processing the record, let future calls and other threads that it
    // has been done.
    fgTsSIHashes.Insert(listRetcode.fHash);
-#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -4517,6 +4704,26 @@ Int_t TFile::GetReadaheadSize()
 //______________________________________________________________________________
 void TFile::SetReadaheadSize(Int_t bytes) { fgReadaheadSize = bytes; }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Static function returning the maximum size of the keys list and StreamerInfo
+/// records read with a single request when opening a file, 0 if disabled.
+
+Int_t TFile::GetMetadataPrefetchSize()
+{
+   return fgMetadataPrefetchSize;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static function to read the keys list of the top directory and the StreamerInfo
+/// record of the files opened from now on with a single request, if both together
+/// are not larger than `bytes`. This is especially useful when opening many remote
+/// files. By default (`bytes` = 0) the two records are read separately.
+
+void TFile::SetMetadataPrefetchSize(Int_t bytes)
+{
+   fgMetadataPrefetchSize = bytes;
+}
+
 //______________________________________________________________________________
 void TFile::SetFileBytesRead(Long64_t bytes) { fgBytesRead = bytes; }
 
@@ -4777,7 +4984,8 @@ TFile::EFileType TFile::GetType(const char *name, Option_t *option, TString *pre
             // If option "READ" test existence and access
             TString opt = option;
             Bool_t read = (opt.IsNull() ||
-                          !opt.CompareTo("READ", TString::kIgnoreCase)) ? kTRUE : kFALSE;
+                          !opt.CompareTo("READ", TString::kIgnoreCase) ||
+                          !opt.CompareTo("READ_WITHOUT_GLOBALREGISTRATION", TString::kIgnoreCase)) ? kTRUE : kFALSE;
             if (read) {
                char *fn;
                if ((fn = gSystem->ExpandPathName(TUrl(lfname).GetFile()))) {
@@ -49,7 +49,9 @@ to be merged, like the standalone hadd program.
 #include <sys/resource.h>
 #endif
 
+#include <algorithm>
 #include <cstring>
+#include <vector>
 
 ClassImp(TFileMerger);
 
@@ -617,6 +619,8 @@ Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
       TList inputs;
       TList todelete;
       Bool_t oneGo = fHistoOneGo && cl->InheritsFrom(R__TH1_Class);
+      // Uncompressed size of the objects in todelete, bounded by fMaxMergeMemory
+      Long64_t inputBytes = 0;
 
       // Loop over all source files and merge same-name object
       TFile *nextsource = current_file ? (TFile*)sourcelist->After( current_file ) : (TFile*)sourcelist->First();
@@ -646,6 +650,7 @@ Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
                               return kTRUE;
                      }
                      todelete.Add(hobj);
+                     inputBytes += key2->GetObjlen();
                   }
                }
                if (hobj) {
@@ -655,7 +660,8 @@ Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
                   }
                   hobj->ResetBit(kMustCleanup);
                   inputs.Add(hobj);
-                  if (!oneGo) {
+                  // In one go mode, merge what was read so far once it exceeds the memory limit
+                  if (!oneGo || (fMaxMergeMemory > 0 && inputBytes > fMaxMergeMemory)) {
                      ROOT::MergeFunc_t func = cl->GetMerge();
                      Long64_t result = func(obj, &inputs, &info);
                      info.fIsFirst = kFALSE;
@@ -665,13 +671,14 @@ Bool_t TFileMerger::MergeOne(TDirectory *target, TList *sourcelist, Int_t type,
                      }
                      inputs.Clear();
                      todelete.Delete();
+                     inputBytes = 0;
                   }
                }
             }
             nextsource = (TFile*)sourcelist->After( nextsource );
          } while (nextsource);
          // Merge the list, if still to be done
-         if (oneGo || info.fIsFirst) {
+         if ((oneGo && !inputs.IsEmpty()) || info.fIsFirst) {
             ROOT::MergeFunc_t func = cl->GetMerge();
             func(obj, &inputs, &info);
             info.fIsFirst = kFALSE;
@@ -900,6 +907,134 @@ Bool_t TFileMerger::MergeRecursive(TDirectory *target, TList *sourcelist, Int_t
    return status;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Merge the inputs level by level in a tree of temporary files, until at most
+/// fReductionFanIn inputs are left. On each level, groups of fReductionFanIn
+/// consecutive inputs are merged object-by-object into a temporary file on disk,
+/// such that no more than fReductionFanIn input files are open at once and no
+/// intermediate result is kept in memory. The merged inputs are closed and the
+/// temporary files of the last level replace them in fFileList; their names are
+/// added to temporaries so that the caller removes them after the final merge.
+/// Returns false in case of error.
+
+Bool_t TFileMerger::ReduceInputs(Int_t type, TList &temporaries)
+{
+   struct RInput {
+      TFile *fFile;    ///< An input of fFileList, or nullptr
+      TString fUrl;    ///< The name of the input file if fFile is nullptr
+      Bool_t fIsOwned; ///< Whether fFile is owned by the merger or fUrl is a temporary file
+   };
+
+   const Int_t fanin = std::min(fReductionFanIn, fMaxOpenedFiles - 1);
+   if (fanin < 2)
+      return kTRUE;
+
+   std::vector<RInput> inputs;
+   TIter nextfile(&fFileList);
+   while (TFile *file = (TFile *)nextfile())
+      inputs.push_back({file, file->GetName(), file->TestBit(kCanDelete)});
+   TIter nextexcess(&fExcessFiles);
+   while (TObjString *url = (TObjString *)nextexcess())
+      inputs.push_back({nullptr, url->GetString(), kFALSE});
+   fFileList.Clear();
+   fExcessFiles.Clear();
+
+   // Close or remove an input that is of no further use
+   auto release = [this](RInput &input) {
+      if (input.fFile) {
+         if (input.fIsOwned) {
+            TString path(input.fFile->GetPath());
+            const Bool_t isLocalCopy = fLocal && !input.fFile->InheritsFrom(TMemFile::Class());
+            input.fFile->Close();
+            delete input.fFile;
+            if (isLocalCopy) {
+               path = path(0, path.Index(':', 0));
+               gSystem->Unlink(path);
+            }
+         }
+         input.fFile = nullptr;
+      } else if (input.fIsOwned) {
+         gSystem->Unlink(input.fUrl);
+      }
+   };
+
+   const Int_t compress = fOutputFile->GetCompressionSettings();
+   const Int_t subtype = type & ~(kIncremental | kDelayWrite);
+   Int_t level = 0;
+   while (inputs.size() > static_cast<std::size_t>(fanin)) {
+      ++level;
+      std::vector<RInput> next;
+      for (std::size_t begin = 0; begin < inputs.size(); begin += fanin) {
+         const std::size_t end = std::min(begin + fanin, inputs.size());
+         if (end - begin == 1) {
+            next.push_back(inputs[begin]);
+            continue;
+         }
+
+         TUUID uuid;
+         TString name = TString::Format("%s/ROOTMERGE-level%d-%s.root", gSystem->TempDirectory(), level, uuid.AsString());
+         if (fPrintLevel > 0)
+            Printf("%s Merging inputs %zu to %zu of level %d into %s", fMsgPrefix.Data(), begin + 1, end, level,
+                   name.Data());
+
+         TFileMerger merger(kFALSE, fHistoOneGo);
+         merger.SetMsgPrefix(fMsgPrefix);
+         merger.SetPrintLevel(fPrintLevel - 1);
+         merger.SetMaxOpenedFiles(fMaxOpenedFiles);
+         merger.SetMaxMergeMemory(fMaxMergeMemory);
+         merger.SetFastMethod(fFastMethod);
+         merger.SetNotrees(fNoTrees);
+         merger.SetMergeOptions(fMergeOptions);
+         merger.fObjectNames = fObjectNames;
+         if (fIOFeatures)
+            merger.SetIOFeatures(*fIOFeatures);
+
+         Bool_t status = merger.OutputFile(name, "RECREATE", compress);
+         for (std::size_t i = begin; status && i < end; ++i) {
+            if (inputs[i].fFile)
+               status = merger.AddFile(inputs[i].fFile, kFALSE);
+            else
+               status = merger.AddFile(inputs[i].fUrl, kFALSE);
+         }
+         if (status)
+            status = merger.PartialMerge(subtype);
+         for (std::size_t i = begin; i < end; ++i)
+            release(inputs[i]);
+         next.push_back({nullptr, name, kTRUE});
+
+         if (!status) {
+            Error("ReduceInputs", "error while merging level %d of the inputs into %s", level, name.Data());
+            for (auto &input : inputs)
+               release(input);
+            for (auto &input : next)
+               release(input);
+            return kFALSE;
+         }
+      }
+      inputs.swap(next);
+   }
+
+   // We want gDirectory untouched by anything going on here
+   TDirectory::TContext ctxt;
+   for (auto &input : inputs) {
+      if (input.fFile) {
+         fFileList.Add(input.fFile);
+         continue;
+      }
+      if (input.fIsOwned)
+         temporaries.Add(new TObjString(input.fUrl));
+      TFile *file = TFile::Open(input.fUrl, "READ");
+      if (!file || file->IsZombie()) {
+         Error("ReduceInputs", "cannot open file %s", input.fUrl.Data());
+         delete file;
+         return kFALSE;
+      }
+      file->SetBit(kCanDelete);
+      fFileList.Add(file);
+   }
+   return kTRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Merge the files. If no output file was specified it will write into
 /// the file "FileMerger.root" in the working directory. Returns true
@@ -958,6 +1093,27 @@ Bool_t TFileMerger::PartialMerge(Int_t in_type)
       return result;
    }
 
+   // Temporary files of the tree-reduction, removed at the end
+   TList temporaries;
+   temporaries.SetOwner(kTRUE);
+   auto removeTemporaries = [&temporaries]() {
+      TIter next(&temporaries);
+      while (TObjString *name = (TObjString *)next())
+         gSystem->Unlink(name->GetString());
+   };
+   if (fReductionFanIn > 1 && fFileList.GetEntries() + fExcessFiles.GetEntries() > fReductionFanIn) {
+      if (!ReduceInputs(in_type, temporaries)) {
+         TIter next(&fFileList);
+         while (TFile *file = (TFile *)next()) {
+            if (file->TestBit(kCanDelete))
+               file->Close();
+         }
+         fFileList.Clear();
+         removeTemporaries();
+         return kFALSE;
+      }
+   }
+
    fOutputFile->SetBit(kMustCleanup);
 
    TDirectory::TContext ctxt;
@@ -1022,6 +1178,7 @@ Bool_t TFileMerger::PartialMerge(Int_t in_type)
       fOutputFile->ResetBit(kMustCleanup);
       SafeDelete(fOutputFile);
    }
+   removeTemporaries();
    return result;
 }
 
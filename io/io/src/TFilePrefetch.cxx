@@ -392,49 +392,55 @@ Int_t TFilePrefetch::SumHex(const char *hex)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Test if the block is in cache.
+/// Return the path of the block in the cache directory.
+///
+/// The file name is the MD5 digest of the name and size of the file and of the
+/// positions and lengths of the block elements, hence the same cache directory
+/// can be used for several files; the sub-directory is the digest modulo 16.
 
-Bool_t TFilePrefetch::CheckBlockInCache(char*& path, TFPBlock* block)
+TString TFilePrefetch::GetBlockCachePath(TFPBlock* block)
 {
-   if (fPathCache == "")
-      return false;
-
-   Bool_t found = false;
-   TString fullPath(fPathCache); // path of the cached files.
-
-   Int_t value = 0;
-
-   if (!gSystem->OpenDirectory(fullPath))
-      gSystem->mkdir(fullPath);
-
-   //dir is SHA1 value modulo 16; filename is the value of the SHA1(offset+len)
-   TMD5* md = new TMD5();
+   TMD5 md;
 
    TString concatStr;
+   concatStr.Form("%s:%lld", fFile->GetName(), fFile->GetEND());
+   md.Update((UChar_t*)concatStr.Data(), concatStr.Length());
    for (Int_t i=0; i < block->GetNoElem(); i++){
-      concatStr.Form("%lld", block->GetPos(i));
-      md->Update((UChar_t*)concatStr.Data(), concatStr.Length());
+      concatStr.Form(":%lld,%d", block->GetPos(i), block->GetLen(i));
+      md.Update((UChar_t*)concatStr.Data(), concatStr.Length());
    }
+   md.Final();
 
-   md->Final();
-   TString fileName( md->AsString() );
-   value = SumHex(fileName);
+   TString fileName( md.AsString() );
+   Int_t value = SumHex(fileName);
    value = value % 16;
    TString dirName;
    dirName.Form("%i", value);
 
-   fullPath += "/" + dirName + "/" + fileName;
+   return fPathCache + "/" + dirName + "/" + fileName;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Test if the block is in cache.
 
+Bool_t TFilePrefetch::CheckBlockInCache(char*& path, TFPBlock* block)
+{
+   if (fPathCache == "")
+      return false;
+
+   if (!gSystem->OpenDirectory(fPathCache))
+      gSystem->mkdir(fPathCache);
+
+   TString fullPath = GetBlockCachePath(block);
+
+   // A block of a different size cannot be the requested one
    FileStat_t stat;
-   if (gSystem->GetPathInfo(fullPath, stat) == 0) {
-      path = new char[fullPath.Length() + 1];
-      strlcpy(path, fullPath,fullPath.Length() + 1);
-      found = true;
-   } else
-      found = false;
-
-   delete md;
-   return found;
+   if (gSystem->GetPathInfo(fullPath, stat) != 0 || stat.fSize != block->GetDataSize())
+      return false;
+
+   path = new char[fullPath.Length() + 1];
+   strlcpy(path, fullPath,fullPath.Length() + 1);
+   return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -472,53 +478,33 @@ char* TFilePrefetch::GetBlockFromCache(const char* path, Int_t length)
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Save the block content in cache.
+///
+/// The block is written to a temporary file which is then renamed, so that
+/// other readers of the cache directory, possibly in other processes, never
+/// see a partially written block.
 
 void TFilePrefetch::SaveBlockInCache(TFPBlock* block)
 {
    if (fPathCache == "")
       return;
 
-   //dir is SHA1 value modulo 16; filename is the value of the SHA1
-   TMD5* md = new TMD5();
-
-   TString concatStr;
-   for(Int_t i=0; i< block->GetNoElem(); i++){
-      concatStr.Form("%lld", block->GetPos(i));
-      md->Update((UChar_t*)concatStr.Data(), concatStr.Length());
-   }
-   md->Final();
-
-   TString fileName( md->AsString() );
-   Int_t value = SumHex(fileName);
-   value = value % 16;
+   TString fullPath = GetBlockCachePath(block);
 
-   TString fullPath( fPathCache );
-   TString dirName;
-   dirName.Form("%i", value);
-   fullPath += ("/" + dirName);
-
-   if (!gSystem->OpenDirectory(fullPath))
-      gSystem->mkdir(fullPath);
+   TString dirName = gSystem->GetDirName(fullPath);
+   if (!gSystem->OpenDirectory(dirName))
+      gSystem->mkdir(dirName);
 
-   TFile* file = 0;
-   fullPath += ("/" + fileName);
-   FileStat_t stat;
-   if (gSystem->GetPathInfo(fullPath, stat) == 0) {
-      fullPath += "?filetype=raw";
-      file = TFile::Open(fullPath, "update");
-   } else{
-      fullPath += "?filetype=raw";
-      file = TFile::Open(fullPath, "new");
-   }
+   TString tmpPath;
+   tmpPath.Form("%s.%d_%zx.tmp", fullPath.Data(), gSystem->GetPid(), (size_t)this);
 
+   TFile* file = TFile::Open(tmpPath + "?filetype=raw", "recreate");
    if (file) {
-      // coverity[unchecked_value] We do not print error message, have not error
-      // return code and close the file anyway, not need to check the return value.
-      file->WriteBuffer(block->GetBuffer(), block->GetDataSize());
+      Bool_t failed = file->WriteBuffer(block->GetBuffer(), block->GetDataSize());
       file->Close();
       delete file;
+      if (failed || gSystem->Rename(tmpPath, fullPath) != 0)
+         gSystem->Unlink(tmpPath);
    }
-   delete md;
 }
 
 
@@ -47,8 +47,14 @@
  See also TTree.
 */
 
+#include <algorithm>
 #include <atomic>
+#include <cstring>
+#include <functional>
 #include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
 
 #include "TROOT.h"
 #include "TClass.h"
@@ -84,6 +90,121 @@ std::atomic<UInt_t> keyAbsNumber{0};
 
 ClassImp(TKey);
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Call `func(i)` for `n` independent blocks, in parallel when implicit
+/// multithreading is enabled. The number of threads is bounded by the size of
+/// the implicit multithreading pool.
+
+void ProcessBlocks(Int_t n, const std::function<void(Int_t)> &func)
+{
+   Int_t nthreads = (n > 1 && ROOT::IsImplicitMTEnabled()) ? std::min<Int_t>(n, ROOT::GetThreadPoolSize()) : 1;
+   if (nthreads <= 1) {
+      for (Int_t i = 0; i < n; ++i)
+         func(i);
+      return;
+   }
+   std::atomic<Int_t> next{0};
+   auto work = [&]() {
+      for (Int_t i = next++; i < n; i = next++)
+         func(i);
+   };
+   std::vector<std::thread> threads;
+   for (Int_t t = 1; t < nthreads; ++t)
+      threads.emplace_back(work);
+   work();
+   for (auto &thread : threads)
+      thread.join();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compress the `srcsize` bytes of `src` into `tgt` as consecutive,
+/// independently compressed blocks of at most kMAXZIPBUF bytes.
+/// Return the total compressed size, 0 if one of the blocks cannot be compressed.
+
+Int_t ZipBlocks(Int_t cxlevel, ROOT::RCompressionSetting::EAlgorithm::EValues cxAlgorithm, UInt_t zstdDictId,
+                char *src, Int_t srcsize, char *tgt)
+{
+   const Int_t nbuffers = 1 + (srcsize - 1) / kMAXZIPBUF;
+   auto zip = [&](Int_t i, char *bufcur) {
+      Int_t bufmax = (i == nbuffers - 1) ? srcsize - i * kMAXZIPBUF : kMAXZIPBUF;
+      Int_t nout = 0;
+      R__zipMultipleAlgorithmDict(cxlevel, &bufmax, src + i * kMAXZIPBUF, &bufmax, bufcur, &nout, cxAlgorithm, zstdDictId);
+      if (nout >= srcsize) //this happens when the buffer cannot be compressed
+         nout = 0;
+      return nout;
+   };
+
+   if (nbuffers == 1 || !ROOT::IsImplicitMTEnabled()) {
+      Int_t noutot = 0;
+      for (Int_t i = 0; i < nbuffers; ++i) {
+         Int_t nout = zip(i, tgt + noutot);
+         if (!nout)
+            return 0;
+         noutot += nout;
+      }
+      return noutot;
+   }
+
+   // Each block is compressed in its own buffer, then the blocks are concatenated.
+   std::vector<std::unique_ptr<char[]>> zipped(nbuffers);
+   std::vector<Int_t> nouts(nbuffers);
+   ProcessBlocks(nbuffers, [&](Int_t i) {
+      zipped[i].reset(new char[kMAXZIPBUF]);
+      nouts[i] = zip(i, zipped[i].get());
+   });
+   Int_t noutot = 0;
+   for (Int_t i = 0; i < nbuffers; ++i) {
+      if (!nouts[i])
+         return 0;
+      memcpy(tgt + noutot, zipped[i].get(), nouts[i]);
+      noutot += nouts[i];
+   }
+   return noutot;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Decompress the consecutive compressed blocks of `src` into `tgt`, which has
+/// room for `objlen` bytes.
+/// Return the decompressed size of the last block, 0 in case of error.
+
+Int_t UnzipBlocks(UChar_t *src, char *tgt, Int_t objlen)
+{
+   struct Block {
+      UChar_t *fSrc;
+      char *fTgt;
+      Int_t fNin;
+      Int_t fNbuf;
+   };
+
+   // The headers give the position of each block.
+   std::vector<Block> blocks;
+   Int_t nin, nbuf;
+   Int_t noutot = 0;
+   while (noutot < objlen) {
+      if (R__unzip_header(&nin, src, &nbuf) != 0)
+         break;
+      if (nbuf > objlen - noutot)
+         return 0;
+      blocks.push_back({src, tgt + noutot, nin, nbuf});
+      noutot += nbuf;
+      src += nin;
+   }
+
+   std::vector<Int_t> nouts(blocks.size());
+   ProcessBlocks(blocks.size(), [&](Int_t i) {
+      R__unzip(&blocks[i].fNin, blocks[i].fSrc, &blocks[i].fNbuf, (unsigned char *)blocks[i].fTgt, &nouts[i]);
+   });
+   for (auto nout : nouts) {
+      if (!nout)
+         return 0;
+   }
+   return nouts.empty() ? 0 : nouts.back();
+}
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// TKey default constructor.
 
@@ -238,7 +359,7 @@ TKey::TKey(const TObject *obj, const char *name, Int_t bufsize, TDirectory* moth
 
    Build(motherDir, obj->ClassName(), -1);
 
-   Int_t lbuf, nout, noutot, bufmax, nzip;
+   Int_t lbuf, noutot;
    fBufferRef = new TBufferFile(TBuffer::kWrite, bufsize);
    fBufferRef->SetParent(GetFile());
    fCycle     = fMotherDir->AppendKey(this);
@@ -252,29 +373,18 @@ TKey::TKey(const TObject *obj, const char *name, Int_t bufsize, TDirectory* moth
 
    Int_t cxlevel = GetFile() ? GetFile()->GetCompressionLevel() : 0;
    ROOT::RCompressionSetting::EAlgorithm::EValues cxAlgorithm = static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(GetFile() ? GetFile()->GetCompressionAlgorithm() : 0);
+   UInt_t zstdDictId = GetFile() ? GetFile()->GetZstdDictionaryId() : 0;
    if (cxlevel > 0 && fObjlen > 256) {
       Int_t nbuffers = 1 + (fObjlen - 1)/kMAXZIPBUF;
       Int_t buflen = TMath::Max(512,fKeylen + fObjlen + 9*nbuffers + 28); //add 28 bytes in case object is placed in a deleted gap
       fBuffer = new char[buflen];
-      char *objbuf = fBufferRef->Buffer() + fKeylen;
-      char *bufcur = &fBuffer[fKeylen];
-      noutot = 0;
-      nzip   = 0;
-      for (Int_t i = 0; i < nbuffers; ++i) {
-         if (i == nbuffers - 1) bufmax = fObjlen - nzip;
-         else               bufmax = kMAXZIPBUF;
-         R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm);
-         if (nout == 0 || nout >= fObjlen) { //this happens when the buffer cannot be compressed
-            fBuffer = fBufferRef->Buffer();
-            Create(fObjlen);
-            fBufferRef->SetBufferOffset(0);
-            Streamer(*fBufferRef);         //write key itself again
-            return;
-         }
-         bufcur += nout;
-         noutot += nout;
-         objbuf += kMAXZIPBUF;
-         nzip   += kMAXZIPBUF;
+      noutot = ZipBlocks(cxlevel, cxAlgorithm, zstdDictId, fBufferRef->Buffer() + fKeylen, fObjlen, &fBuffer[fKeylen]);
+      if (noutot == 0) { //this happens when the buffer cannot be compressed
+         fBuffer = fBufferRef->Buffer();
+         Create(fObjlen);
+         fBufferRef->SetBufferOffset(0);
+         Streamer(*fBufferRef);         //write key itself again
+         return;
       }
       Create(noutot);
       fBufferRef->SetBufferOffset(0);
@@ -334,7 +444,7 @@ TKey::TKey(const void *obj, const TClass *cl, const char *name, Int_t bufsize, T
    Streamer(*fBufferRef);         //write key itself
    fKeylen    = fBufferRef->Length();
 
-   Int_t lbuf, nout, noutot, bufmax, nzip;
+   Int_t lbuf, noutot;
 
    fBufferRef->MapObject(actualStart,clActual);         //register obj in map in case of self reference
    clActual->Streamer((void*)actualStart, *fBufferRef); //write object
@@ -343,29 +453,18 @@ TKey::TKey(const void *obj, const TClass *cl, const char *name, Int_t bufsize, T
 
    Int_t cxlevel = GetFile() ? GetFile()->GetCompressionLevel() : 0;
    ROOT::RCompressionSetting::EAlgorithm::EValues cxAlgorithm = static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(GetFile() ? GetFile()->GetCompressionAlgorithm() : 0);
+   UInt_t zstdDictId = GetFile() ? GetFile()->GetZstdDictionaryId() : 0;
    if (cxlevel > 0 && fObjlen > 256) {
       Int_t nbuffers = 1 + (fObjlen - 1)/kMAXZIPBUF;
       Int_t buflen = TMath::Max(512,fKeylen + fObjlen + 9*nbuffers + 28); //add 28 bytes in case object is placed in a deleted gap
       fBuffer = new char[buflen];
-      char *objbuf = fBufferRef->Buffer() + fKeylen;
-      char *bufcur = &fBuffer[fKeylen];
-      noutot = 0;
-      nzip   = 0;
-      for (Int_t i = 0; i < nbuffers; ++i) {
-         if (i == nbuffers - 1) bufmax = fObjlen - nzip;
-         else               bufmax = kMAXZIPBUF;
-         R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm);
-         if (nout == 0 || nout >= fObjlen) { //this happens when the buffer cannot be compressed
-            fBuffer = fBufferRef->Buffer();
-            Create(fObjlen);
-            fBufferRef->SetBufferOffset(0);
-            Streamer(*fBufferRef);         //write key itself again
-            return;
-         }
-         bufcur += nout;
-         noutot += nout;
-         objbuf += kMAXZIPBUF;
-         nzip   += kMAXZIPBUF;
+      noutot = ZipBlocks(cxlevel, cxAlgorithm, zstdDictId, fBufferRef->Buffer() + fKeylen, fObjlen, &fBuffer[fKeylen]);
+      if (noutot == 0) { //this happens when the buffer cannot be compressed
+         fBuffer = fBufferRef->Buffer();
+         Create(fObjlen);
+         fBufferRef->SetBufferOffset(0);
+         Streamer(*fBufferRef);         //write key itself again
+         return;
       }
       Create(noutot);
       fBufferRef->SetBufferOffset(0);
@@ -815,20 +914,7 @@ TObject *TKey::ReadObj()
       bufferRef.MapObject(pobj,cl);  //register obj in map to handle self reference
 
    if (fObjlen > fNbytes-fKeylen) {
-      char *objbuf = bufferRef.Buffer() + fKeylen;
-      UChar_t *bufcur = (UChar_t *)&compressedBuffer[fKeylen];
-      Int_t nin, nout = 0, nbuf;
-      Int_t noutot = 0;
-      while (1) {
-         Int_t hc = R__unzip_header(&nin, bufcur, &nbuf);
-         if (hc!=0) break;
-         R__unzip(&nin, bufcur, &nbuf, (unsigned char*) objbuf, &nout);
-         if (!nout) break;
-         noutot += nout;
-         if (noutot >= fObjlen) break;
-         bufcur += nin;
-         objbuf += nout;
-      }
+      Int_t nout = UnzipBlocks((UChar_t *)&compressedBuffer[fKeylen], bufferRef.Buffer() + fKeylen, fObjlen);
       compressedBuffer.reset(nullptr);
       if (nout) {
          tobj->Streamer(bufferRef); //does not work with example 2 above
@@ -940,20 +1026,7 @@ TObject *TKey::ReadObjWithBuffer(char *bufferRead)
       bufferRef.MapObject(pobj,cl);  //register obj in map to handle self reference
 
    if (fObjlen > fNbytes-fKeylen) {
-      char *objbuf = bufferRef.Buffer() + fKeylen;
-      UChar_t *bufcur = (UChar_t *)&bufferRead[fKeylen];
-      Int_t nin, nout = 0, nbuf;
-      Int_t noutot = 0;
-      while (1) {
-         Int_t hc = R__unzip_header(&nin, bufcur, &nbuf);
-         if (hc!=0) break;
-         R__unzip(&nin, bufcur, &nbuf, (unsigned char*) objbuf, &nout);
-         if (!nout) break;
-         noutot += nout;
-         if (noutot >= fObjlen) break;
-         bufcur += nin;
-         objbuf += nout;
-      }
+      Int_t nout = UnzipBlocks((UChar_t *)&bufferRead[fKeylen], bufferRef.Buffer() + fKeylen, fObjlen);
       if (nout) {
          tobj->Streamer(bufferRef); //does not work with example 2 above
       } else {
@@ -1084,20 +1157,7 @@ void *TKey::ReadObjectAny(const TClass* expectedClass)
       bufferRef.MapObject(pobj,cl);  //register obj in map to handle self reference
 
    if (fObjlen > fNbytes-fKeylen) {
-      char *objbuf = bufferRef.Buffer() + fKeylen;
-      UChar_t *bufcur = (UChar_t *)&compressedBuffer[fKeylen];
-      Int_t nin, nout = 0, nbuf;
-      Int_t noutot = 0;
-      while (1) {
-         Int_t hc = R__unzip_header(&nin, bufcur, &nbuf);
-         if (hc!=0) break;
-         R__unzip(&nin, bufcur, &nbuf, (unsigned char*) objbuf, &nout);
-         if (!nout) break;
-         noutot += nout;
-         if (noutot >= fObjlen) break;
-         bufcur += nin;
-         objbuf += nout;
-      }
+      Int_t nout = UnzipBlocks((UChar_t *)&compressedBuffer[fKeylen], bufferRef.Buffer() + fKeylen, fObjlen);
       if (nout) {
          cl->Streamer((void*)pobj, bufferRef, clOnfile);    //read object
       } else {
@@ -1172,20 +1232,7 @@ Int_t TKey::Read(TObject *obj)
 
    bufferRef.SetBufferOffset(fKeylen);
    if (fObjlen > fNbytes-fKeylen) {
-      char *objbuf = bufferRef.Buffer() + fKeylen;
-      UChar_t *bufcur = (UChar_t *)&compressedBuffer[fKeylen];
-      Int_t nin, nout = 0, nbuf;
-      Int_t noutot = 0;
-      while (1) {
-         Int_t hc = R__unzip_header(&nin, bufcur, &nbuf);
-         if (hc!=0) break;
-         R__unzip(&nin, bufcur, &nbuf, (unsigned char*) objbuf, &nout);
-         if (!nout) break;
-         noutot += nout;
-         if (noutot >= fObjlen) break;
-         bufcur += nin;
-         objbuf += nout;
-      }
+      Int_t nout = UnzipBlocks((UChar_t *)&compressedBuffer[fKeylen], bufferRef.Buffer() + fKeylen, fObjlen);
       if (nout) obj->Streamer(bufferRef);
    } else {
       obj->Streamer(bufferRef);
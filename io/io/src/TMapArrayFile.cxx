@@ -0,0 +1,403 @@
+// @(#)root/io:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+/**
+\class TMapArrayFile
+\ingroup IO
+
+A memory mapped file holding named arrays of doubles, meant to share
+histogram contents between a producer and many consumer processes at
+high rate, e.g. for online monitoring.
+
+Contrary to TMapFile, nothing is streamed and the region does not need
+to be mapped at a fixed address: the file only contains offsets, and the
+arrays are plain contiguous doubles. The producer copies the bin contents
+into the file with Update(); consumers map the file read-only and either
+look at the live contents through GetArray(), or take a consistent copy
+with Read(). Every array is protected by a sequence lock: Update() makes
+its version odd while it writes and even again once it is done, and
+Read() retries until it copied the array without a concurrent update.
+Consumers never block the producer.
+
+Only one producer may update a given array at a time. Add() is not
+thread-safe, and the size of the file and the maximum number of arrays
+are fixed when the file is created.
+
+~~~{.cpp}
+// producer
+auto mf = TMapArrayFile::Create("dqm.map", "RECREATE");
+TH1D h("h", "h", 100, 0., 1.);
+Int_t ih = mf->Add("h", h.GetNcells());
+// ... fill h
+mf->Update(ih, h.GetArray());
+
+// consumer
+auto mf = TMapArrayFile::Create("dqm.map");
+TH1D h("h", "h", 100, 0., 1.);
+Int_t ih = mf->FindArray("h");
+if (ih >= 0 && mf->GetArraySize(ih) == h.GetNcells())
+   mf->Read(ih, h.GetArray());
+~~~
+
+The sums of squares of weights of a histogram, TH1::GetSumw2(), and its
+statistics, TH1::GetStats(), can be shared as further arrays.
+
+Memory mapped files of arrays are only supported on Unix systems.
+**/
+
+#include "TMapArrayFile.h"
+#include "TError.h"
+#include "TSystem.h"
+
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <thread>
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+ClassImp(TMapArrayFile);
+
+namespace {
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2 && ATOMIC_INT_LOCK_FREE == 2,
+              "TMapArrayFile needs lock-free atomics to work across processes");
+
+constexpr char gMapArrayMagic[8] = {'R', 'O', 'O', 'T', 'M', 'A', 'F', '1'};
+constexpr Long64_t kMapArrayAlign = 64;
+
+/// Description of one array, at a fixed place in the file.
+struct alignas(64) RMapArrayRec {
+   char fName[TMapArrayFile::kMaxNameLength + 1];
+   Long64_t fSize;               ///< Number of elements
+   Long64_t fOffset;             ///< Offset of the elements from the start of the file
+   std::atomic<ULong64_t> fSeq;  ///< Sequence lock: odd while the producer updates the array
+};
+
+/// Start of the file, followed by the array records and by the array elements.
+struct alignas(64) RMapArrayHeader {
+   char fMagic[8];
+   Int_t fMaxArrays;
+   Long64_t fMapSize;
+   Long64_t fUsed;                 ///< Number of bytes in use, only accessed by the producer
+   std::atomic<Int_t> fNarrays;    ///< Number of arrays whose record is complete
+};
+
+RMapArrayHeader *GetHeader(char *base)
+{
+   return reinterpret_cast<RMapArrayHeader *>(base);
+}
+
+RMapArrayRec *GetRecords(char *base)
+{
+   return reinterpret_cast<RMapArrayRec *>(base + sizeof(RMapArrayHeader));
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create or open a memory mapped file of arrays. Option can be either
+/// "NEW", "CREATE", "RECREATE", "UPDATE" or "READ" (see TFile). The size and
+/// the maximum number of arrays are only used when a file is created.
+/// Use Create() to get a TMapArrayFile.
+
+TMapArrayFile::TMapArrayFile(const char *name, Option_t *option, Long64_t size, Int_t maxArrays)
+   : fName(name), fBase(nullptr), fSize(0), fWritable(kFALSE)
+{
+#ifndef WIN32
+   gSystem->ExpandPathName(fName);
+
+   TString opt = option;
+   opt.ToUpper();
+   if (opt == "NEW")
+      opt = "CREATE";
+   Bool_t create = (opt == "CREATE" || opt == "RECREATE");
+   if (!create && opt != "UPDATE" && opt != "READ") {
+      Error("TMapArrayFile", "unknown option %s", option);
+      return;
+   }
+   fWritable = (opt != "READ");
+
+   const Long64_t minSize = sizeof(RMapArrayHeader) + maxArrays * sizeof(RMapArrayRec);
+   if (create && (maxArrays <= 0 || size < minSize)) {
+      Error("TMapArrayFile", "size %lld too small for %d arrays, need at least %lld bytes", size, maxArrays, minSize);
+      return;
+   }
+
+   int flags = fWritable ? O_RDWR : O_RDONLY;
+   if (opt == "CREATE")
+      flags |= O_CREAT | O_EXCL;
+   else if (opt == "RECREATE")
+      flags |= O_CREAT | O_TRUNC;
+   int fd = open(fName.Data(), flags, 0644);
+   if (fd < 0) {
+      SysError("TMapArrayFile", "cannot open file %s", fName.Data());
+      return;
+   }
+
+   if (create) {
+      if (ftruncate(fd, size) < 0) {
+         SysError("TMapArrayFile", "cannot resize file %s", fName.Data());
+         close(fd);
+         return;
+      }
+   } else {
+      struct stat st;
+      if (fstat(fd, &st) < 0 || st.st_size < (off_t)sizeof(RMapArrayHeader)) {
+         Error("TMapArrayFile", "%s is not a memory mapped file of arrays", fName.Data());
+         close(fd);
+         return;
+      }
+      size = st.st_size;
+   }
+
+   void *base = mmap(nullptr, size, fWritable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+   // The mapping stays valid when the descriptor is closed
+   close(fd);
+   if (base == MAP_FAILED) {
+      SysError("TMapArrayFile", "cannot map file %s", fName.Data());
+      return;
+   }
+   fBase = static_cast<char *>(base);
+   fSize = size;
+
+   auto header = GetHeader(fBase);
+   if (create) {
+      new (header) RMapArrayHeader;
+      header->fMaxArrays = maxArrays;
+      header->fMapSize = size;
+      header->fUsed = minSize;
+      header->fNarrays.store(0);
+      // Consumers only accept the file once the header is complete
+      std::atomic_thread_fence(std::memory_order_release);
+      memcpy(header->fMagic, gMapArrayMagic, sizeof(gMapArrayMagic));
+   } else if (memcmp(header->fMagic, gMapArrayMagic, sizeof(gMapArrayMagic)) != 0 || header->fMapSize != size) {
+      Error("TMapArrayFile", "%s is not a memory mapped file of arrays", fName.Data());
+      Close();
+   }
+#else
+   (void)option;
+   (void)size;
+   (void)maxArrays;
+   Error("TMapArrayFile", "memory mapped files of arrays are not supported on Windows");
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Unmap the file. The file itself is not removed.
+
+TMapArrayFile::~TMapArrayFile()
+{
+   Close();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Unmap the file. The pointers returned by GetArray() become invalid.
+
+void TMapArrayFile::Close()
+{
+#ifndef WIN32
+   if (fBase)
+      munmap(fBase, fSize);
+#endif
+   fBase = nullptr;
+   fSize = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add an array of `n` doubles, initialized to 0. Returns the index of the
+/// array, or -1 in case of error, e.g. if there is not enough space left.
+/// If an array of the same name and size exists already, its index is
+/// returned.
+
+Int_t TMapArrayFile::Add(const char *name, Long64_t n)
+{
+   if (!fWritable || !fBase) {
+      Error("Add", "file %s is not open for writing", fName.Data());
+      return -1;
+   }
+   if (!name || !*name || strlen(name) > kMaxNameLength || n < 0) {
+      Error("Add", "invalid name or size for array \"%s\"", name ? name : "");
+      return -1;
+   }
+
+   Int_t index = FindArray(name);
+   if (index >= 0) {
+      if (GetArraySize(index) == n)
+         return index;
+      Error("Add", "array %s exists already with a different size", name);
+      return -1;
+   }
+
+   auto header = GetHeader(fBase);
+   index = header->fNarrays.load(std::memory_order_relaxed);
+   Long64_t offset = (header->fUsed + kMapArrayAlign - 1) / kMapArrayAlign * kMapArrayAlign;
+   if (index >= header->fMaxArrays || offset + n * (Long64_t)sizeof(Double_t) > fSize) {
+      Error("Add", "no space left in %s for array %s", fName.Data(), name);
+      return -1;
+   }
+
+   auto rec = new (&GetRecords(fBase)[index]) RMapArrayRec;
+   memcpy(rec->fName, name, strlen(name) + 1);
+   rec->fSize = n;
+   rec->fOffset = offset;
+   rec->fSeq.store(0, std::memory_order_relaxed);
+   memset(fBase + offset, 0, n * sizeof(Double_t));
+   header->fUsed = offset + n * sizeof(Double_t);
+   header->fNarrays.store(index + 1, std::memory_order_release);
+   return index;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the index of the array called `name`, or -1 if there is none.
+
+Int_t TMapArrayFile::FindArray(const char *name) const
+{
+   Int_t n = GetNarrays();
+   for (Int_t i = 0; i < n; i++) {
+      if (!strcmp(GetRecords(fBase)[i].fName, name))
+         return i;
+   }
+   return -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the live, read-only contents of an array in the mapped file.
+/// They can change at any time while the producer updates them; use Read()
+/// to get a consistent copy.
+
+const Double_t *TMapArrayFile::GetArray(Int_t index) const
+{
+   if (index < 0 || index >= GetNarrays())
+      return nullptr;
+   return reinterpret_cast<const Double_t *>(fBase + GetRecords(fBase)[index].fOffset);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the name of an array, or nullptr if there is no such array.
+
+const char *TMapArrayFile::GetArrayName(Int_t index) const
+{
+   if (index < 0 || index >= GetNarrays())
+      return nullptr;
+   return GetRecords(fBase)[index].fName;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of elements of an array, or -1 if there is no such array.
+
+Long64_t TMapArrayFile::GetArraySize(Int_t index) const
+{
+   if (index < 0 || index >= GetNarrays())
+      return -1;
+   return GetRecords(fBase)[index].fSize;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of arrays in the file.
+
+Int_t TMapArrayFile::GetNarrays() const
+{
+   if (!fBase)
+      return 0;
+   return GetHeader(fBase)->fNarrays.load(std::memory_order_acquire);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the number of updates made to an array so far. A consumer can poll
+/// it to find out whether the array changed since its last Read().
+
+ULong64_t TMapArrayFile::GetVersion(Int_t index) const
+{
+   if (index < 0 || index >= GetNarrays())
+      return 0;
+   return GetRecords(fBase)[index].fSeq.load(std::memory_order_acquire) / 2;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy a consistent snapshot of an array into `dest`, which must have room
+/// for GetArraySize(index) elements. If `version` is given, it is set to the
+/// version of the copied contents. Returns kFALSE if there is no such array.
+
+Bool_t TMapArrayFile::Read(Int_t index, Double_t *dest, ULong64_t *version) const
+{
+   if (index < 0 || index >= GetNarrays())
+      return kFALSE;
+
+   auto &rec = GetRecords(fBase)[index];
+   const char *src = fBase + rec.fOffset;
+   while (true) {
+      ULong64_t seq = rec.fSeq.load(std::memory_order_acquire);
+      if (seq & 1) {
+         std::this_thread::yield();
+         continue;
+      }
+      memcpy(dest, src, rec.fSize * sizeof(Double_t));
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (rec.fSeq.load(std::memory_order_relaxed) == seq) {
+         if (version)
+            *version = seq / 2;
+         return kTRUE;
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Copy GetArraySize(index) elements from `src` into an array of the mapped
+/// file and increment its version. Returns kFALSE if the file is not writable
+/// or if there is no such array.
+
+Bool_t TMapArrayFile::Update(Int_t index, const Double_t *src)
+{
+   if (!fWritable || index < 0 || index >= GetNarrays())
+      return kFALSE;
+
+   auto &rec = GetRecords(fBase)[index];
+   ULong64_t seq = rec.fSeq.load(std::memory_order_relaxed);
+   rec.fSeq.store(seq + 1, std::memory_order_relaxed);
+   std::atomic_thread_fence(std::memory_order_release);
+   memcpy(fBase + rec.fOffset, src, rec.fSize * sizeof(Double_t));
+   rec.fSeq.store(seq + 2, std::memory_order_release);
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Print the arrays of the mapped file.
+
+void TMapArrayFile::Print(Option_t *) const
+{
+   Printf("Memory mapped file of arrays: %s", fName.Data());
+   Printf("Mode:                         %s", fWritable ? "UPDATE" : "READ");
+   if (!fBase)
+      return;
+   Printf("Mapped size:                  %.2f MB", fSize / 1048576.);
+   Int_t n = GetNarrays();
+   for (Int_t i = 0; i < n; i++)
+      Printf("   %-32s %10lld elements, version %llu", GetArrayName(i), GetArraySize(i), GetVersion(i));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Create or open a memory mapped file of arrays, see the constructor for the
+/// options. Returns nullptr in case of error.
+
+TMapArrayFile *TMapArrayFile::Create(const char *name, Option_t *option, Long64_t size, Int_t maxArrays)
+{
+   auto mapFile = new TMapArrayFile(name, option, size, maxArrays);
+   if (!mapFile->IsOpen()) {
+      delete mapFile;
+      return nullptr;
+   }
+   return mapFile;
+}
@@ -53,6 +53,9 @@ classes don't provide these copy ctor's, especially not when objects
 contain collections, etc. 2) is too limiting or dangerous (calling
 accidentally a virtual function will segv). So since we have a
 robust Streamer mechanism I opted for 3).
+
+To share only the contents of histograms at high rate, see TMapArrayFile,
+which neither streams nor needs a fixed map address.
 **/
 
 
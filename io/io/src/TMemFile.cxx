@@ -136,6 +136,23 @@ TMemFile::TMemFile(const char *path, ExternalDataPtr_t data)
    fExternalData = data;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Constructor to create a read-only TMemFile adopting an external memory range,
+/// e.g. a file received in shared memory or in a network buffer. The memory is
+/// used as is, without copy. It must stay valid and unchanged until the deleter
+/// is called, which happens once neither this TMemFile nor a copy of it uses the
+/// memory anymore.
+
+TMemFile::TMemFile(const char *path, const ZeroCopyView_t &datarange, ExternalDeleter_t deleter)
+   : TMemFile(path, datarange)
+{
+   const size_t size = datarange.fSize;
+   fExternalBuffer.reset(datarange.fStart, [deleter, size](const char *start) {
+      if (deleter)
+         deleter(start, size);
+   });
+}
+
 ////////////////////////////////////////////////////////////////////////////////////
 /// Constructor to create a read-only TMemFile using an std::unique_ptr<TBufferFile>
 
@@ -213,8 +230,9 @@ zombie:
 
 TMemFile::TMemFile(const TMemFile &orig)
    : TFile(orig.GetEndpointUrl()->GetUrl(), "WEB", orig.GetTitle(), orig.GetCompressionSettings()),
-     fBlockList(orig.GetEND()), fExternalData(orig.fExternalData), fIsOwnedByROOT(orig.fIsOwnedByROOT),
-     fSize(orig.GetEND()), fBlockSeek(&(fBlockList))
+     fBlockList(orig.IsExternalData() ? -1 : orig.GetEND()), fExternalData(orig.fExternalData),
+     fExternalBuffer(orig.fExternalBuffer), fIsOwnedByROOT(orig.fIsOwnedByROOT), fSize(orig.GetEND()),
+     fBlockSeek(&(fBlockList))
 {
    EMode optmode = ParseOption(orig.fOption);
 
@@ -224,6 +242,10 @@ TMemFile::TMemFile(const TMemFile &orig)
    if (!IsExternalData()) {
       // We intentionally allocated just one big buffer for this object.
       orig.CopyTo(fBlockList.fBuffer,fSize);
+   } else {
+      // Share the external memory range, which is kept alive by fExternalData or fExternalBuffer, if any
+      fBlockList.fBuffer = orig.fBlockList.fBuffer;
+      fBlockList.fSize = orig.fBlockList.fSize;
    }
 
    Init(!NeedsExistingFile(optmode)); // A copy is
@@ -25,6 +25,8 @@
 #include "TProcessID.h"
 #include "TFile.h"
 
+#include <type_traits>
+
 static const Int_t kRegrouped = TStreamerInfo::kOffsetL;
 
 // More possible optimizations:
@@ -1714,6 +1716,38 @@ namespace TStreamerInfoActions
       }
    }
 
+   /// Return the position of the next `n` values of type T in `buf` if they can be
+   /// read directly from the memory of the buffer, nullptr otherwise. This is the
+   /// case for a TBufferFile holding all the values, except for Long_t whose
+   /// on-file representation depends on the file version.
+   template <typename T>
+   static INLINE_TEMPLATE_ARGS char *GetBulkReadCursor(TBuffer &buf, Long64_t n)
+   {
+      if (std::is_same<T, Long_t>::value || std::is_same<T, ULong_t>::value)
+         return nullptr;
+      static TClass *const bufferFileClass = TBufferFile::Class();
+      if (buf.IsA() != bufferFileClass || (Long64_t)sizeof(T) * n > buf.BufferSize() - buf.Length())
+         return nullptr;
+      return buf.Buffer() + buf.Length();
+   }
+
+   /// Byte-swap the `n` consecutive values of type T at `cursor` into memory
+   /// locations `incr` bytes apart starting at `addr`, then advance `cursor`.
+   /// The loop over densely packed values is kept separate so that the compiler
+   /// can vectorize it.
+   template <typename T>
+   static INLINE_TEMPLATE_ARGS void ReadBasicTypeBulk(char *&cursor, char *addr, Int_t incr, Long64_t n)
+   {
+      if (incr == sizeof(T)) {
+         T *values = (T*)addr;
+         for (Long64_t i = 0; i < n; ++i)
+            frombuf(cursor, values + i);
+      } else {
+         for (Long64_t i = 0; i < n; ++i, addr += incr)
+            frombuf(cursor, (T*)addr);
+      }
+   }
+
    struct VectorLooper {
 
       template <typename T>
@@ -1722,6 +1756,12 @@ namespace TStreamerInfoActions
          const Int_t incr = ((TVectorLoopConfig*)loopconfig)->fIncrement;
          iter = (char*)iter + config->fOffset;
          end = (char*)end + config->fOffset;
+         const Long64_t n = ((char*)end - (char*)iter) / incr;
+         if (char *cursor = GetBulkReadCursor<T>(buf, n)) {
+            ReadBasicTypeBulk<T>(cursor, (char*)iter, incr, n);
+            buf.SetBufferOffset(cursor - buf.Buffer());
+            return 0;
+         }
          for(; iter != end; iter = (char*)iter + incr ) {
             T *x = (T*) ((char*) iter);
             buf >> *x;
@@ -2097,6 +2137,12 @@ namespace TStreamerInfoActions
       {
          const Int_t offset = config->fOffset;
 
+         if (char *cursor = GetBulkReadCursor<T>(buf, ((char*)end - (char*)iter) / sizeof(void*))) {
+            for(; iter != end; iter = (char*)iter + sizeof(void*) )
+               frombuf(cursor, (T*)( ((char*) (*(void**)iter) ) + offset ));
+            buf.SetBufferOffset(cursor - buf.Buffer());
+            return 0;
+         }
          for(; iter != end; iter = (char*)iter + sizeof(void*) ) {
             T *x = (T*)( ((char*) (*(void**)iter) ) + offset );
             buf >> *x;
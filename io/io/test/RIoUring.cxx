@@ -43,6 +43,38 @@ TEST(RRawFileUnix, ReadV)
    }
 }
 
+TEST(RRawFileUnix, ReadVRepeated)
+{
+   auto file = "test_uring_readv_repeated";
+   auto filesize = 1 << 20;
+   FileRaii fileGuard(file, std::string(filesize, 'b'));
+
+   // The ring is set up once and reused by the following vector reads
+   auto f = RRawFileUnix::Create(file);
+   for (int round = 0; round < 10; ++round) {
+      auto iovecs = make_iovecs(100, filesize);
+      f->ReadV(iovecs.data(), iovecs.size());
+      for (auto iovec : iovecs) {
+         EXPECT_EQ(std::min<std::size_t>(iovec.fSize, filesize - iovec.fOffset), iovec.fOutBytes);
+         for (std::size_t i = 0; i < iovec.fOutBytes; ++i) {
+            EXPECT_EQ('b', ((unsigned char *)iovec.fBuffer)[i]);
+         }
+         free(iovec.fBuffer);
+      }
+   }
+
+   // Explicitly switched off io_uring results in the same data from blocking reads
+   RRawFile::ROptions options;
+   options.fUseIoUring = false;
+   auto fBlocking = RRawFileUnix::Create(file, options);
+   auto iovecs = make_iovecs(100, filesize);
+   fBlocking->ReadV(iovecs.data(), iovecs.size());
+   for (auto iovec : iovecs) {
+      EXPECT_EQ(std::min<std::size_t>(iovec.fSize, filesize - iovec.fOffset), iovec.fOutBytes);
+      free(iovec.fBuffer);
+   }
+}
+
 TEST(RawUring, NopRoundTrip)
 {
    struct io_uring ring;
@@ -142,3 +174,69 @@ TEST(RawUring, FileRegistration)
       free(iovec.fBuffer);
    }
 }
+
+TEST(RIoUring, RegisteredBuffersAndFiles)
+{
+   auto file = "test_uring_registered";
+   auto filesize = 1 << 20;
+   FileRaii fileGuard(file, std::string(filesize, 'c'));
+   RRawFileUnix f(file, RRawFile::ROptions());
+   f.GetSize(); // open the file
+
+   // An arena whose slices serve as read buffers, as well as a buffer outside of the arena
+   const unsigned int nReads = 64;
+   const std::size_t readSize = 4096;
+   std::vector<unsigned char> arena(nReads * readSize);
+   std::vector<unsigned char> unregistered(readSize);
+
+   RIoUring ring(nReads + 1);
+   struct iovec iov;
+   iov.iov_base = arena.data();
+   iov.iov_len = arena.size();
+   bool hasBuffers = ring.RegisterBuffers(&iov, 1);
+   auto fd = f.GetFd();
+   bool hasFiles = ring.RegisterFiles(&fd, 1);
+   if (!hasBuffers || !hasFiles)
+      std::cout << "[          ] kernel refused registration, testing plain reads" << std::endl;
+
+   std::vector<RIoUring::RReadEvent> reads(nReads + 1);
+   for (unsigned int i = 0; i < nReads; ++i) {
+      reads[i].fBuffer = arena.data() + i * readSize;
+      reads[i].fOffset = i * readSize * 3;
+      reads[i].fSize = readSize;
+      reads[i].fFileDes = fd;
+   }
+   reads[nReads].fBuffer = unregistered.data();
+   reads[nReads].fOffset = filesize - readSize / 2; // short read at the end of the file
+   reads[nReads].fSize = readSize;
+   reads[nReads].fFileDes = fd;
+
+   ring.SubmitReadsAndWait(reads.data(), reads.size());
+   for (unsigned int i = 0; i < nReads; ++i)
+      EXPECT_EQ(readSize, reads[i].fOutBytes);
+   EXPECT_EQ(readSize / 2, reads[nReads].fOutBytes);
+   EXPECT_EQ(std::string(arena.size(), 'c'), std::string(arena.begin(), arena.end()));
+   EXPECT_EQ(std::string(readSize / 2, 'c'), std::string(unregistered.begin(), unregistered.begin() + readSize / 2));
+   ring.UnregisterBuffers();
+}
+
+TEST(RIoUring, SqPoll)
+{
+   auto file = "test_uring_sqpoll";
+   auto filesize = 1 << 20;
+   FileRaii fileGuard(file, std::string(filesize, 'd'));
+
+   // The ring falls back to a regular submission queue if the kernel refuses the polling thread
+   RRawFile::ROptions options;
+   options.fIoUringSqPoll = true;
+   auto f = RRawFileUnix::Create(file, options);
+   auto iovecs = make_iovecs(100, filesize);
+   f->ReadV(iovecs.data(), iovecs.size());
+   for (auto iovec : iovecs) {
+      EXPECT_EQ(std::min<std::size_t>(iovec.fSize, filesize - iovec.fOffset), iovec.fOutBytes);
+      for (std::size_t i = 0; i < iovec.fOutBytes; ++i) {
+         EXPECT_EQ('d', ((unsigned char *)iovec.fBuffer)[i]);
+      }
+      free(iovec.fBuffer);
+   }
+}
@@ -208,6 +208,43 @@ TEST(RRawFile, ReadBuffered)
 }
 
 
+TEST(RRawFile, Readahead)
+{
+   char buffer[27];
+   const std::string content = "abcdefghijklmnopqrstuvwxyz";
+   RRawFile::ROptions options;
+   options.fBlockSize = 2;
+   options.fReadaheadBlocks = 4;
+   std::unique_ptr<RRawFileMock> f(new RRawFileMock(content, options));
+
+   // Only the first two block refills are synchronous, the following blocks are prefetched through a clone
+   for (unsigned i = 0; i < content.length(); ++i) {
+      EXPECT_EQ(1u, f->Read(buffer + i, 1));
+   }
+   EXPECT_EQ(content, std::string(buffer, content.length()));
+   EXPECT_EQ(2u, f->fNumReadAt);
+   EXPECT_EQ(0u, f->Read(buffer, 1));
+   f->fNumReadAt = 0;
+
+   // Jumping discards the readahead window
+   EXPECT_EQ(1u, f->ReadAt(buffer, 1, 10));
+   EXPECT_EQ('k', buffer[0]);
+   EXPECT_EQ(1u, f->ReadAt(buffer, 1, 12));
+   EXPECT_EQ('m', buffer[0]);
+   EXPECT_EQ(1u, f->ReadAt(buffer, 1, 14));
+   EXPECT_EQ('o', buffer[0]);
+   EXPECT_EQ(2u, f->fNumReadAt);
+
+   FileRaii readaheadGuard("test_rawfile_readahead", content);
+   auto file = RRawFile::Create("test_rawfile_readahead", options);
+   std::string line;
+   EXPECT_TRUE(file->Readln(line));
+   EXPECT_EQ(content, line);
+   file->Seek(3);
+   EXPECT_EQ(23u, file->Read(buffer, 23));
+   EXPECT_EQ(content.substr(3), std::string(buffer, 23));
+}
+
 TEST(RRawFile, Mmap)
 {
    std::uint64_t mapdOffset;
@@ -1,5 +1,6 @@
 #include "gtest/gtest.h"
 
+#include "Bytes.h"
 #include "TBufferFile.h"
 #include "TClass.h"
 #include <vector>
@@ -26,3 +27,56 @@ TEST(TBufferFile, ROOT_8367)
    EXPECT_FLOAT_EQ(v2[6], 7.);
    EXPECT_EQ(v2.size(), 7);
 }
+
+template <typename T>
+void CheckFastArrayRoundTrip()
+{
+   // Lengths around the sizes of the vector registers, written at an odd offset.
+   for (Int_t n = 0; n < 70; ++n) {
+      std::vector<T> values(n);
+      for (Int_t i = 0; i < n; ++i)
+         values[i] = static_cast<T>((i * 7919 + 13) * (i % 2 ? 1 : -1));
+      TBufferFile buffer(TBuffer::kWrite);
+      buffer.WriteUChar(1);
+      buffer.WriteFastArray(values.data(), n);
+      ASSERT_EQ(1 + n * (Int_t)sizeof(T), buffer.Length());
+
+      // The values are stored one by one in network byte order.
+      char *cursor = buffer.Buffer() + 1;
+      for (Int_t i = 0; i < n; ++i) {
+         T value;
+         frombuf(cursor, &value);
+         EXPECT_EQ(values[i], value);
+      }
+
+      buffer.SetReadMode();
+      buffer.SetBufferOffset(1);
+      std::vector<T> read(n);
+      buffer.ReadFastArray(read.data(), n);
+      EXPECT_EQ(values, read);
+      EXPECT_EQ(1 + n * (Int_t)sizeof(T), buffer.Length());
+   }
+}
+
+TEST(TBufferFile, FastArrayByteSwap)
+{
+   CheckFastArrayRoundTrip<Short_t>();
+   CheckFastArrayRoundTrip<Int_t>();
+   CheckFastArrayRoundTrip<Long64_t>();
+   CheckFastArrayRoundTrip<Float_t>();
+   CheckFastArrayRoundTrip<Double_t>();
+
+   // Double32_t without range nor bits are stored as floats.
+   std::vector<Double_t> values(1000);
+   for (Int_t i = 0; i < 1000; ++i)
+      values[i] = 0.1 * i;
+   TBufferFile buffer(TBuffer::kWrite);
+   buffer.WriteFastArrayDouble32(values.data(), 1000);
+   EXPECT_EQ(1000 * (Int_t)sizeof(Float_t), buffer.Length());
+   buffer.SetReadMode();
+   buffer.SetBufferOffset(0);
+   std::vector<Double_t> read(1000);
+   buffer.ReadFastArrayDouble32(read.data(), 1000);
+   for (Int_t i = 0; i < 1000; ++i)
+      EXPECT_EQ((Double_t)(Float_t)values[i], read[i]);
+}
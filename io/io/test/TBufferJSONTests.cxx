@@ -1,6 +1,9 @@
 #include "TBufferJSON.h"
 #include "TNamed.h"
+#include <cmath>
+#include <cstdio>
 #include <string>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -47,3 +50,41 @@ TEST(TBufferJSON, utf8_3)
    EXPECT_EQ(str0, named1->GetTitle());
 }
 
+
+// check that numbers are formatted as with the configured printf formats
+TEST(TBufferJSON, NumberFormat)
+{
+   auto expected = [](const char *fmt, double value) {
+      char buf[200];
+      if ((value == std::nearbyint(value)) && (std::abs(value) < 1e25)) {
+         snprintf(buf, sizeof(buf), "%1.0f", value);
+      } else {
+         snprintf(buf, sizeof(buf), fmt, value);
+         TBufferText::CompactFloatString(buf, sizeof(buf));
+      }
+      return std::string(buf);
+   };
+
+   const double values[] = {0., -0., 1., -17., 1e20, 0.1, -2.5e-7, 3.14159265358979, 1.23456789e100, 5e-324, 1e25};
+   char buf[200];
+   for (const char *fmt : {"%.14e", "%.3e", "%e", "%g", "%12.5f"}) {
+      TBufferText::SetDoubleFormat(fmt);
+      for (auto v : values)
+         EXPECT_EQ(expected(fmt, v), TBufferText::ConvertDouble(v, buf, sizeof(buf))) << fmt << " " << v;
+   }
+   TBufferText::SetDoubleFormat();
+
+   for (float v : {0.f, 42.f, 0.1f, -1.5e-3f, 3.4e38f}) {
+      char ref[200];
+      if ((v == std::nearbyint(v)) && (std::abs(v) < 1e15)) {
+         snprintf(ref, sizeof(ref), "%1.0f", v);
+      } else {
+         snprintf(ref, sizeof(ref), "%e", v);
+         TBufferText::CompactFloatString(ref, sizeof(ref));
+      }
+      EXPECT_STREQ(ref, TBufferText::ConvertFloat(v, buf, sizeof(buf))) << v;
+   }
+
+   std::vector<Long64_t> ints = {0, -1, 1234567890123LL, -9223372036854775807LL};
+   EXPECT_EQ(TString("[0, -1, 1234567890123, -9223372036854775807]"), TBufferJSON::ToJSON(&ints));
+}
@@ -160,6 +160,91 @@ TEST(TBufferMerger, AutoSave)
    RemoveFile("tbuffermerger_autosave.root");
 }
 
+static int SumOfTree(const char *name, int &nentries)
+{
+   TFile f(name);
+   auto t = f.Get<TTree>("mytree");
+   if (!t)
+      return -1;
+
+   int n, sum = 0;
+   nentries = (int)t->GetEntries();
+   t->SetBranchAddress("n", &n);
+   for (int i = 0; i < nentries; ++i) {
+      t->GetEntry(i);
+      sum += n;
+   }
+   return sum;
+}
+
+static void ParallelFill(TBufferMerger &merger, int nthreads, int nwrites, int nevents)
+{
+   std::vector<std::thread> threads;
+   for (int i = 0; i < nthreads; ++i) {
+      threads.emplace_back([=, &merger]() {
+         auto myfile = merger.GetFile();
+         auto mytree = new TTree("mytree", "mytree");
+         int n = 0;
+         mytree->Branch("n", &n, "n/I");
+         for (int w = 0; w < nwrites; ++w) {
+            for (int j = 0; j < nevents; ++j) {
+               n = 1;
+               mytree->Fill();
+            }
+            myfile->Write();
+         }
+         mytree->ResetBranchAddresses();
+      });
+   }
+
+   for (auto &&t : threads)
+      t.join();
+}
+
+TEST(TBufferMerger, MaxBuffered)
+{
+   const int nthreads = 8, nwrites = 16, nevents = 1000;
+
+   ROOT::EnableThreadSafety();
+
+   {
+      TBufferMerger merger("tbuffermerger_maxbuffered.root");
+      merger.SetMaxBuffered(64 * 1024);
+      EXPECT_EQ(64u * 1024u, merger.GetMaxBuffered());
+
+      ParallelFill(merger, nthreads, nwrites, nevents);
+   }
+
+   int nentries = 0;
+   EXPECT_EQ(nthreads * nwrites * nevents, SumOfTree("tbuffermerger_maxbuffered.root", nentries));
+   EXPECT_EQ(nthreads * nwrites * nevents, nentries);
+
+   RemoveFile("tbuffermerger_maxbuffered.root");
+}
+
+TEST(TBufferMerger, PreMerge)
+{
+   const int nthreads = 8, nwrites = 16, nevents = 1000;
+
+   ROOT::EnableThreadSafety();
+
+   {
+      TBufferMerger merger("tbuffermerger_premerge.root");
+      // Let the queue grow such that there is something to pre-merge
+      merger.SetAutoSave(1024 * 1024);
+      merger.SetPreMergeWorkers(4);
+      EXPECT_EQ(4u, merger.GetPreMergeWorkers());
+
+      ParallelFill(merger, nthreads, nwrites, nevents);
+   }
+
+   int nentries = 0;
+   EXPECT_EQ(nthreads * nwrites * nevents, SumOfTree("tbuffermerger_premerge.root", nentries));
+   EXPECT_EQ(nthreads * nwrites * nevents, nentries);
+
+   RemoveFile("tbuffermerger_premerge.root");
+}
+
 TEST(TBufferMerger, CheckTreeFillResults)
 {
    int sum_s, sum_p;
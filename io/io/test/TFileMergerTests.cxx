@@ -2,9 +2,15 @@
 
 #include "TFileMerger.h"
 
+#include "TFile.h"
+#include "TH1D.h"
 #include "TMemFile.h"
+#include "TSystem.h"
 #include "TTree.h"
 
+#include <string>
+#include <vector>
+
 static void CreateATuple(TMemFile &file, const char *name, double value)
 {
    auto mytree = new TTree(name, "A tree");
@@ -68,3 +74,56 @@ TEST(TFileMerger, CreateWithUnwritableTFilePointer)
    ROOT_EXPECT_ERROR(merger.OutputFile(std::move(output)), "TFileMerger::OutputFile",
                      "output file output.root is not writable");
 }
+
+TEST(TFileMerger, TreeReduction)
+{
+   const int nfiles = 7;
+   std::vector<std::string> names;
+   for (int i = 0; i < nfiles; ++i) {
+      names.push_back("tfilemerger_reduction_" + std::to_string(i) + ".root");
+      TFile f(names.back().c_str(), "RECREATE");
+      TTree t("t", "t");
+      t.SetImplicitMT(false);
+      int n = i;
+      t.Branch("n", &n);
+      t.Fill();
+      TH1D h("h", "h", nfiles, 0, nfiles);
+      h.Fill(i);
+      f.Write();
+   }
+
+   {
+      // Three levels of temporary files, histograms merged one input at a time
+      TFileMerger merger(kFALSE, kTRUE);
+      merger.SetReductionFanIn(2);
+      merger.SetMaxMergeMemory(1);
+      ASSERT_TRUE(merger.OutputFile("tfilemerger_reduction.root", "RECREATE"));
+      for (const auto &name : names)
+         ASSERT_TRUE(merger.AddFile(name.c_str(), kFALSE));
+      EXPECT_TRUE(merger.Merge());
+   }
+
+   {
+      TFile f("tfilemerger_reduction.root");
+      auto t = f.Get<TTree>("t");
+      ASSERT_TRUE(t != nullptr);
+      ASSERT_EQ(nfiles, t->GetEntries());
+      int n;
+      t->SetBranchAddress("n", &n);
+      for (int i = 0; i < nfiles; ++i) {
+         t->GetEntry(i);
+         EXPECT_EQ(i, n);
+      }
+      t->ResetBranchAddresses();
+
+      auto h = f.Get<TH1D>("h");
+      ASSERT_TRUE(h != nullptr);
+      EXPECT_EQ(nfiles, h->GetEntries());
+      for (int i = 0; i < nfiles; ++i)
+         EXPECT_EQ(1, h->GetBinContent(i + 1));
+   }
+
+   gSystem->Unlink("tfilemerger_reduction.root");
+   for (const auto &name : names)
+      gSystem->Unlink(name.c_str());
+}
@@ -0,0 +1,81 @@
+#include "ROOT/TFileOpenAsync.hxx"
+#include "TFile.h"
+#include "TNamed.h"
+#include "TROOT.h"
+#include "TSystem.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+void WriteFile(const std::string &name)
+{
+   TFile f(name.c_str(), "RECREATE");
+   TNamed n("name", name.c_str());
+   n.Write();
+}
+
+Int_t ReadCallsForOpen(const std::string &name)
+{
+   std::unique_ptr<TFile> f(TFile::Open(name.c_str()));
+   EXPECT_TRUE(f && !f->IsZombie());
+   return f ? f->GetReadCalls() : 0;
+}
+
+} // anonymous namespace
+
+TEST(TFileOpenAsync, OpenMany)
+{
+   ROOT::EnableThreadSafety();
+   std::vector<std::string> names;
+   for (int i = 0; i < 4; ++i) {
+      names.emplace_back("tfileopenasync_" + std::to_string(i) + ".root");
+      WriteFile(names.back());
+   }
+
+   std::vector<ROOT::Experimental::TFuture<std::unique_ptr<TFile>>> futures;
+   for (const auto &name : names)
+      futures.emplace_back(ROOT::Experimental::OpenAsync(name));
+   futures.emplace_back(ROOT::Experimental::OpenAsync("tfileopenasync_missing.root"));
+
+   for (std::size_t i = 0; i < names.size(); ++i) {
+      auto f = futures[i].get();
+      ASSERT_NE(nullptr, f);
+      auto n = f->Get<TNamed>("name");
+      ASSERT_NE(nullptr, n);
+      EXPECT_EQ(names[i], n->GetTitle());
+   }
+   EXPECT_EQ(nullptr, futures.back().get());
+
+   for (const auto &name : names)
+      gSystem->Unlink(name.c_str());
+}
+
+TEST(TFileOpenAsync, MetadataPrefetch)
+{
+   const std::string name = "tfileopenasync_prefetch.root";
+   WriteFile(name);
+
+   ASSERT_EQ(0, TFile::GetMetadataPrefetchSize());
+   const Int_t readCalls = ReadCallsForOpen(name);
+
+   TFile::SetMetadataPrefetchSize(1000000);
+   EXPECT_LT(ReadCallsForOpen(name), readCalls);
+   {
+      std::unique_ptr<TFile> f(TFile::Open(name.c_str()));
+      auto n = f->Get<TNamed>("name");
+      ASSERT_NE(nullptr, n);
+      EXPECT_EQ(name, n->GetTitle());
+   }
+
+   // Records larger than the limit are read as usual
+   TFile::SetMetadataPrefetchSize(10);
+   EXPECT_EQ(readCalls, ReadCallsForOpen(name));
+   TFile::SetMetadataPrefetchSize();
+
+   gSystem->Unlink(name.c_str());
+}
@@ -1,10 +1,16 @@
+#include <memory>
 #include <vector>
 
 #include "gtest/gtest.h"
 
+#include "TArrayC.h"
+#include "TDirectoryFile.h"
 #include "TFile.h"
 #include "TKey.h"
+#include "TList.h"
 #include "TNamed.h"
+#include "TObjString.h"
+#include "TROOT.h"
 #include "TSystem.h"
 
 TEST(TFile, WriteObjectTObject)
@@ -85,3 +91,195 @@ TEST(TFile, ReadFromSameFile)
 
    EXPECT_TRUE(o1 != o2) << "Same objects read from two different files have the same pointer!";
 }
+
+TEST(TFile, KeysIndex)
+{
+   const auto filename = "tfile_keysindex.root";
+   EXPECT_EQ(0, TDirectoryFile::GetKeysIndexThreshold());
+   TDirectoryFile::SetKeysIndexThreshold(10);
+   {
+      TFile f(filename, "RECREATE");
+      auto dir = f.mkdir("dir");
+      for (int i = 0; i < 100; ++i) {
+         TNamed named(TString::Format("n%d", i), TString::Format("t%d", i));
+         f.WriteTObject(&named);
+         dir->WriteTObject(&named);
+      }
+      // A second cycle of n7.
+      TNamed named("n7", "second cycle");
+      f.WriteTObject(&named);
+   }
+   TDirectoryFile::SetKeysIndexThreshold(0);
+
+   TFile f(filename);
+   EXPECT_EQ(102, f.GetNkeys());
+   auto n42 = f.Get<TNamed>("n42");
+   ASSERT_NE(nullptr, n42);
+   EXPECT_STREQ("t42", n42->GetTitle());
+   EXPECT_EQ(nullptr, f.Get("n100"));
+   EXPECT_EQ(nullptr, f.Get("n4"));
+   EXPECT_STREQ("second cycle", f.Get<TNamed>("n7")->GetTitle());
+   EXPECT_STREQ("t7", f.Get<TNamed>("n7;1")->GetTitle());
+   TKey *key = f.GetKey("n7");
+   ASSERT_NE(nullptr, key);
+   EXPECT_EQ(2, key->GetCycle());
+   EXPECT_EQ(1, f.GetKey("n7", 1)->GetCycle());
+   EXPECT_STREQ("t13", f.Get<TNamed>("dir/n13")->GetTitle());
+
+   // Listing the keys reads them all, keeping the keys already read.
+   ASSERT_EQ(102, f.GetListOfKeys()->GetSize());
+   EXPECT_EQ(key, f.GetKey("n7"));
+   EXPECT_NE(nullptr, f.GetListOfKeys()->FindObject("n99"));
+   EXPECT_EQ(100, f.Get<TDirectory>("dir")->GetListOfKeys()->GetSize());
+
+   f.Close();
+   gSystem->Unlink(filename);
+}
+
+TEST(TFile, ZstdDictionary)
+{
+   const auto filename = "tfile_zstddictionary.root";
+   const auto plainname = "tfile_zstddictionary_plain.root";
+   auto makeString = [](int i) {
+      TString s;
+      for (int j = 0; j < 10; ++j)
+         s += TString::Format("calibration channel %d gain %d.%03d pedestal %d;", 10 * i + j, j + 1, (i * 37 + j) % 1000, i % 7);
+      return s;
+   };
+   auto writeFile = [&](const char *name, bool useDictionary) {
+      TFile f(name, "RECREATE", "", 505);
+      if (useDictionary) {
+         TList samples;
+         samples.SetOwner();
+         for (int i = 1000; i < 1500; ++i)
+            samples.Add(new TObjString(makeString(i)));
+         EXPECT_TRUE(f.TrainZstdDictionary(&samples, 4096));
+         EXPECT_NE(0u, f.GetZstdDictionaryId());
+      }
+      Long64_t nbytes = 0;
+      for (int i = 0; i < 100; ++i) {
+         TObjString str(makeString(i));
+         f.WriteTObject(&str, TString::Format("s%d", i));
+         nbytes += f.GetKey(TString::Format("s%d", i))->GetNbytes();
+      }
+      return nbytes;
+   };
+   EXPECT_LT(writeFile(filename, true), writeFile(plainname, false));
+
+   TFile f(filename);
+   EXPECT_NE(0u, f.GetZstdDictionaryId());
+   for (int i = 0; i < 100; ++i) {
+      auto str = f.Get<TObjString>(TString::Format("s%d", i));
+      ASSERT_NE(nullptr, str);
+      EXPECT_EQ(makeString(i), str->String());
+   }
+   // A file has a single dictionary.
+   EXPECT_FALSE(f.SetZstdDictionary("", 0));
+
+   f.Close();
+   gSystem->Unlink(filename);
+   gSystem->Unlink(plainname);
+}
+
+TEST(TFile, WithoutGlobalRegistration)
+{
+   const auto filename = "tfile_withoutglobalregistration.root";
+   {
+      TFile f(filename, "RECREATE_WITHOUT_GLOBALREGISTRATION");
+      ASSERT_FALSE(f.IsZombie());
+      EXPECT_TRUE(f.IsWritable());
+      EXPECT_EQ(nullptr, gROOT->GetListOfFiles()->FindObject(&f));
+      TNamed named("named", "title");
+      f.WriteTObject(&named);
+   }
+   {
+      std::unique_ptr<TFile> f(TFile::Open(filename, "UPDATE_WITHOUT_GLOBALREGISTRATION"));
+      ASSERT_NE(nullptr, f);
+      EXPECT_EQ(nullptr, gROOT->GetListOfFiles()->FindObject(f.get()));
+      TNamed named("other", "title");
+      f->WriteTObject(&named);
+   }
+
+   TFile f(filename);
+   EXPECT_NE(nullptr, gROOT->GetListOfFiles()->FindObject(&f));
+   EXPECT_NE(nullptr, f.Get<TNamed>("named"));
+   EXPECT_NE(nullptr, f.Get<TNamed>("other"));
+   f.Close();
+   gSystem->Unlink(filename);
+}
+
+TEST(TFile, SameStreamerInfoRecord)
+{
+   const char *filenames[] = {"tfile_samesirecord_1.root", "tfile_samesirecord_2.root"};
+   for (auto filename : filenames) {
+      TFile f(filename, "RECREATE");
+      TNamed named("named", "title");
+      TObjString str("content");
+      f.WriteTObject(&named);
+      f.WriteTObject(&str);
+   }
+
+   // The second file has the same StreamerInfo record and is not checked again,
+   // but it gets the same class index.
+   TFile first(filenames[0]);
+   {
+      std::unique_ptr<TFile> second(TFile::Open(filenames[1], "UPDATE"));
+      ASSERT_NE(nullptr, first.GetClassIndex());
+      ASSERT_NE(nullptr, second->GetClassIndex());
+      for (Int_t uid = 1; uid < first.GetClassIndex()->GetSize(); ++uid) {
+         if (first.GetClassIndex()->At(uid))
+            EXPECT_TRUE(uid < second->GetClassIndex()->GetSize() && second->GetClassIndex()->At(uid)) << uid;
+      }
+      EXPECT_EQ("content", second->Get<TObjString>("TObjString")->String());
+      TNamed other("other", "title");
+      second->WriteTObject(&other);
+   }
+
+   // The StreamerInfos of the updated file are preserved.
+   TFile second(filenames[1]);
+   std::unique_ptr<TList> infos(second.GetStreamerInfoList());
+   ASSERT_NE(nullptr, infos);
+   EXPECT_NE(nullptr, infos->FindObject("TNamed"));
+   EXPECT_NE(nullptr, infos->FindObject("TObjString"));
+   EXPECT_EQ("content", second.Get<TObjString>("TObjString")->String());
+
+   first.Close();
+   second.Close();
+   for (auto filename : filenames)
+      gSystem->Unlink(filename);
+}
+
+#ifdef R__USE_IMT
+TEST(TFile, ParallelCompressionOfLargeKeys)
+{
+   const auto filename = "tfile_parallelcompression.root";
+   // Larger than three compression blocks of 16 MB.
+   TString content;
+   for (int i = 0; content.Length() < 50000000; ++i)
+      content += TString::Format("block content %d;", i % 100000);
+   TObjString str(content);
+
+   Int_t nbytes = 0;
+   {
+      TFile f(filename, "RECREATE", "", 101);
+      f.WriteTObject(&str, "sequential");
+      ROOT::EnableImplicitMT(4);
+      f.WriteTObject(&str, "parallel");
+      auto sequential = f.GetKey("sequential");
+      auto parallel = f.GetKey("parallel");
+      nbytes = sequential->GetNbytes() - sequential->GetKeylen();
+      // The blocks are the same, whether compressed in parallel or not.
+      EXPECT_EQ(nbytes, parallel->GetNbytes() - parallel->GetKeylen());
+      EXPECT_LT(nbytes, content.Length());
+   }
+
+   TFile f(filename);
+   EXPECT_EQ(content, f.Get<TObjString>("parallel")->String());
+   ROOT::DisableImplicitMT();
+   EXPECT_EQ(content, f.Get<TObjString>("parallel")->String());
+   EXPECT_EQ(content, f.Get<TObjString>("sequential")->String());
+
+   f.Close();
+   gSystem->Unlink(filename);
+}
+#endif
@@ -0,0 +1,103 @@
+#include "TMapArrayFile.h"
+
+#include "TError.h"
+#include "TSystem.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+TEST(TMapArrayFile, Basics)
+{
+   const char *fname = "tmaparrayfile_basics.map";
+   std::unique_ptr<TMapArrayFile> producer(TMapArrayFile::Create(fname, "RECREATE", 1 << 16, 4));
+   ASSERT_NE(nullptr, producer);
+   EXPECT_TRUE(producer->IsWritable());
+   Int_t ia = producer->Add("a", 10);
+   Int_t ib = producer->Add("b", 3);
+   EXPECT_EQ(0, ia);
+   EXPECT_EQ(1, ib);
+   EXPECT_EQ(ia, producer->Add("a", 10));
+   {
+      auto oldIgnoreLevel = gErrorIgnoreLevel;
+      gErrorIgnoreLevel = kBreak;
+      EXPECT_EQ(-1, producer->Add("a", 11));
+      EXPECT_EQ(-1, producer->Add("toolarge", 1 << 16));
+      gErrorIgnoreLevel = oldIgnoreLevel;
+   }
+
+   std::unique_ptr<TMapArrayFile> consumer(TMapArrayFile::Create(fname));
+   ASSERT_NE(nullptr, consumer);
+   EXPECT_FALSE(consumer->IsWritable());
+   EXPECT_EQ(2, consumer->GetNarrays());
+   EXPECT_EQ(ib, consumer->FindArray("b"));
+   EXPECT_EQ(-1, consumer->FindArray("c"));
+   EXPECT_EQ(10, consumer->GetArraySize(ia));
+   EXPECT_STREQ("b", consumer->GetArrayName(ib));
+   EXPECT_EQ(0U, consumer->GetVersion(ia));
+   EXPECT_FALSE(consumer->Update(ia, nullptr));
+
+   std::vector<Double_t> values(10);
+   for (int i = 0; i < 10; i++)
+      values[i] = i;
+   EXPECT_TRUE(producer->Update(ia, values.data()));
+
+   // The consumer sees the live contents and can take a copy
+   EXPECT_EQ(1U, consumer->GetVersion(ia));
+   EXPECT_EQ(9., consumer->GetArray(ia)[9]);
+   std::vector<Double_t> copy(10);
+   ULong64_t version = 0;
+   EXPECT_TRUE(consumer->Read(ia, copy.data(), &version));
+   EXPECT_EQ(1U, version);
+   EXPECT_EQ(values, copy);
+   EXPECT_FALSE(consumer->Read(5, copy.data()));
+
+   // Arrays added later are seen by an existing consumer
+   Int_t ic = producer->Add("c", 1);
+   EXPECT_EQ(ic, consumer->FindArray("c"));
+
+   producer.reset();
+   consumer.reset();
+   gSystem->Unlink(fname);
+}
+
+TEST(TMapArrayFile, ConcurrentUpdates)
+{
+   const char *fname = "tmaparrayfile_concurrent.map";
+   const Long64_t n = 10000;
+   std::unique_ptr<TMapArrayFile> producer(TMapArrayFile::Create(fname, "RECREATE"));
+   ASSERT_NE(nullptr, producer);
+   Int_t index = producer->Add("h", n);
+   std::unique_ptr<TMapArrayFile> consumer(TMapArrayFile::Create(fname, "READ"));
+   ASSERT_NE(nullptr, consumer);
+
+   std::atomic<bool> done(false);
+   std::thread writer([&]() {
+      std::vector<Double_t> values(n);
+      for (int update = 1; update <= 200; update++) {
+         std::fill(values.begin(), values.end(), update);
+         producer->Update(index, values.data());
+      }
+      done = true;
+   });
+
+   // Every snapshot must come from a single update
+   std::vector<Double_t> copy(n);
+   bool consistent = true;
+   while (!done) {
+      ULong64_t version;
+      consumer->Read(index, copy.data(), &version);
+      consistent &= std::all_of(copy.begin(), copy.end(), [&](Double_t v) { return v == version; });
+   }
+   writer.join();
+   EXPECT_TRUE(consistent);
+   EXPECT_EQ(200U, consumer->GetVersion(index));
+
+   producer.reset();
+   consumer.reset();
+   gSystem->Unlink(fname);
+}
@@ -2,6 +2,7 @@
 
 #include "TError.h"
 #include <cstring>
+#include <memory>
 
 #include "gtest/gtest.h"
 
@@ -84,3 +85,36 @@ TEST(TROMemFile, RealNoMemCopy)
    };
    ASSERT_EQ(expected.c_str(), MemBlockPtrGetter::GetBlockStart(&rosmf));
 }
+
+/// Check that an adopted memory range is not copied and released once, after its last user.
+TEST(TROMemFile, AdoptedBuffer)
+{
+   std::string expected = "Hello from TMemFile!";
+   size_t expected_size = expected.size() + 1;
+   int nDeleted = 0;
+   auto deleter = [&](const char *start, size_t size) {
+      EXPECT_EQ(expected.c_str(), start);
+      EXPECT_EQ(expected_size, size);
+      ++nDeleted;
+   };
+
+   struct MemBlockPtrGetter : public TMemFile {
+      static void *GetBlockStart(TMemFile *M) { return static_cast<MemBlockPtrGetter *>(M)->fBlockList.fBuffer; }
+   };
+
+   auto rosmf = std::make_unique<TMemFile>("hello.bin?filetype=raw",
+                                           TMemFile::ZeroCopyView_t{expected.c_str(), expected_size}, deleter);
+   EXPECT_EQ(expected.c_str(), MemBlockPtrGetter::GetBlockStart(rosmf.get()));
+
+   auto copy = std::make_unique<TMemFile>(*rosmf);
+   EXPECT_EQ(expected.c_str(), MemBlockPtrGetter::GetBlockStart(copy.get()));
+   rosmf.reset();
+   EXPECT_EQ(0, nDeleted);
+
+   std::vector<char> seen(copy->GetSize());
+   copy->CopyTo(&seen.front(), seen.size());
+   EXPECT_STREQ(expected.c_str(), &seen[0]);
+
+   copy.reset();
+   EXPECT_EQ(1, nDeleted);
+}
@@ -25,6 +25,8 @@
 // When Sync() is called, this triggers objects in the TFile space to   //
 // be communicated over MPI to a master writer which combines the data  //
 // before writing it to file.                                           //
+// Alternatively, WriteCollective() lets every rank write its data      //
+// directly into a shared ZIP archive with collective MPI-IO writes.    //
 //                                                                      //
 //////////////////////////////////////////////////////////////////////////
 
@@ -56,6 +58,22 @@ private:
 
    char *fSendBuf = 0; // message buffer, only used by worker
 
+   struct CollectiveEntry_t {
+      Long64_t fOffset; // position of the local header of the archive member
+      Long64_t fSize;   // size of the ROOT file stored in the member
+      UInt_t fCRC32;    // CRC-32 of the ROOT file
+      UInt_t fDosTime;  // modification time of the member
+      Int_t fRank;      // global rank that wrote the member
+      Int_t fIndex;     // number of the WriteCollective() call that wrote the member
+   };
+
+   Bool_t fCollective = kFALSE;  // WriteCollective() was called, no collector is involved
+   MPI_File fCollectiveFile;     // shared output archive, only used in collective mode
+   TString fCollectiveFilename;  // name of the shared output archive
+   Long64_t fCollectiveEnd = 0;  // end of the members written to the archive so far
+   Int_t fCollectiveWrites = 0;  // number of WriteCollective() calls so far
+   std::vector<CollectiveEntry_t> fCollectiveEntries; // archive members, only used by local rank 0
+
    struct ParallelFileMerger : public TObject {
    private:
       using ClientColl_t = std::vector<TMPIClientInfo>;
@@ -89,6 +107,8 @@ private:
    void CheckSplitLevel();
    void SplitMPIComm();
    void UpdateEndProcess();
+   TString GetCollectiveMemberName(Int_t rank, Int_t index) const;
+   void CloseCollective();
 
    Bool_t IsReceived();
 
@@ -119,6 +139,10 @@ public:
    void CreateEmptyBufferAndSend();
    void Sync();
 
+   // Collective Functions, called by all ranks of the sub communicator
+   Bool_t WriteCollective();
+   TString GetCollectiveFilename() const { return fCollectiveFilename; };
+
    // Finalize work and save output in disk.
    void Close(Option_t *option = "") final;
 
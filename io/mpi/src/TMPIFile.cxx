@@ -10,10 +10,15 @@
  *************************************************************************/
 
 #include "TMPIFile.h"
+#include "TDatime.h"
 #include "TFileCacheWrite.h"
 #include "TKey.h"
 #include "THashTable.h"
 #include "TMath.h"
+#include "TSystem.h"
+#include "RZip.h"
+
+#include <algorithm>
 
 ClassImp(TMPIFile);
 
@@ -44,11 +49,68 @@ Begin_Macro (source)
 }
 End_Macro
 
+### Collective writing
+
+Funnelling all the data through the collectors can saturate their network
+links. Instead, all the ranks can call WriteCollective(): every rank then
+writes the current content of its TMPIFile with collective MPI-IO writes,
+at its own offset, into a shared ZIP archive named after the file
+(`mpi_output.zip` for `mpi_output.root`), and only local rank 0 writes the
+archive's central directory on Close(). No rank acts as collector. The ROOT
+files in the archive are not merged; they are read with e.g.
+`TFile::Open("mpi_output.zip#mpi_output_3_0.root")` for the data written by
+rank 3 in its first WriteCollective() call, or all of them with a TChain.
+
+Begin_Macro (source)
+{
+   TMPIFile *newfile = new TMPIFile("mpi_output.root", "RECREATE");
+
+   // generate data objects, on all ranks
+
+   // write the data of all ranks, may be called several times
+   newfile->WriteCollective();
+
+   newfile->Close();
+}
+End_Macro
+
 See TMPIFile class for the list of functions
 */
 
 const Int_t MIN_FILE_NUM = 2;
 
+namespace {
+
+// Subset of the ZIP format written by TMPIFile::WriteCollective(), see TZIPFile.
+// Always using the Zip64 extensions keeps the header sizes independent of the data sizes.
+const UInt_t kZIPVersion = 45;
+const UInt_t kZIPLocalMagic = 0x04034b50;
+const UInt_t kZIPDirMagic = 0x02014b50;
+const UInt_t kZIPEndMagic = 0x06054b50;
+const UInt_t kZIP64EndRecordMagic = 0x06064b50;
+const UInt_t kZIP64EndLocatorMagic = 0x07064b50;
+const UInt_t kZIPMaxSize = 0xffffffff;
+
+// Size of the write requests, which MPI counts with an int
+const Long64_t kMaxWriteChunk = 1 << 30;
+
+/// Append the `bytes` lowest bytes of `value` in little-endian order
+void PutLE(std::vector<char> &buffer, ULong64_t value, Int_t bytes)
+{
+   for (Int_t i = 0; i < bytes; ++i)
+      buffer.push_back(static_cast<char>((value >> (8 * i)) & 0xff));
+}
+
+/// Current time in the MS-DOS format used by ZIP archives
+UInt_t GetDosTime()
+{
+   TDatime now;
+   return ((std::max(now.GetYear(), 1980) - 1980) << 25) | (now.GetMonth() << 21) | (now.GetDay() << 16) |
+          (now.GetHour() << 11) | (now.GetMinute() << 5) | (now.GetSecond() / 2);
+}
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// TMPIFile constructor
 ///
@@ -440,15 +502,220 @@ void TMPIFile::Sync()
    this->ResetAfterMerge((TFileMergeInfo *)0);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Called by all ranks of the sub communicator: writes the current content of
+/// this file, as a new member, into the shared ZIP archive GetCollectiveFilename().
+/// Each rank writes its own data at an offset reserved with MPI_Exscan, using
+/// collective MPI-IO writes; local rank 0 only keeps track of the members and
+/// writes the archive directory on Close(). Like Sync(), the resetable objects
+/// (e.g. TTree) are reset afterwards, so this can be called periodically.
+/// This replaces the Sync()/RunCollector() scheme; both cannot be mixed.
+/// Returns kFALSE in case of error.
+
+Bool_t TMPIFile::WriteCollective()
+{
+   if (!fCollective) {
+      std::string filename = GetName();
+      ULong_t found = filename.rfind(".root");
+      if (found != std::string::npos)
+         filename.resize(found);
+      if (fSplitLevel > 1) {
+         filename += "_";
+         filename += std::to_string(fMPIColor);
+      }
+      fCollectiveFilename = filename + ".zip";
+      if (MPI_File_open(fSubComm, fCollectiveFilename.Data(), MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL,
+                        &fCollectiveFile) != MPI_SUCCESS) {
+         Error("WriteCollective", "cannot open %s", fCollectiveFilename.Data());
+         return kFALSE;
+      }
+      // discard the content of a previous archive of the same name
+      MPI_File_set_size(fCollectiveFile, 0);
+      fCollective = kTRUE;
+   }
+
+   const TString member = GetCollectiveMemberName(fMPIGlobalRank, fCollectiveWrites);
+   const UInt_t dostime = GetDosTime();
+
+   // Local header of the archive member followed by the ROOT file
+   this->Write();
+   const Long64_t size = GetEND();
+   std::vector<char> buffer;
+   PutLE(buffer, kZIPLocalMagic, 4);
+   PutLE(buffer, kZIPVersion, 2);
+   PutLE(buffer, 0, 2); // flags
+   PutLE(buffer, 0, 2); // stored
+   PutLE(buffer, dostime, 4);
+   const std::size_t crcPos = buffer.size();
+   PutLE(buffer, 0, 4); // CRC-32, set below
+   PutLE(buffer, kZIPMaxSize, 4);
+   PutLE(buffer, kZIPMaxSize, 4);
+   PutLE(buffer, member.Length(), 2);
+   PutLE(buffer, 20, 2);
+   buffer.insert(buffer.end(), member.Data(), member.Data() + member.Length());
+   PutLE(buffer, 1, 2); // Zip64 extended information
+   PutLE(buffer, 16, 2);
+   PutLE(buffer, size, 8);
+   PutLE(buffer, size, 8);
+   const Long64_t headerSize = buffer.size();
+   buffer.resize(headerSize + size);
+   this->CopyTo(buffer.data() + headerSize, size);
+
+   ULong_t crc = R__crc32(0, nullptr, 0);
+   for (Long64_t pos = 0; pos < size; pos += kMaxWriteChunk) {
+      crc = R__crc32(crc, reinterpret_cast<const unsigned char *>(buffer.data() + headerSize + pos),
+                     std::min(kMaxWriteChunk, size - pos));
+   }
+   for (Int_t i = 0; i < 4; ++i)
+      buffer[crcPos + i] = static_cast<char>((crc >> (8 * i)) & 0xff);
+
+   // Reserve the space of this rank after the members written so far
+   Long64_t nbytes = buffer.size();
+   Long64_t offset = 0;
+   Long64_t total = 0;
+   MPI_Exscan(&nbytes, &offset, 1, MPI_LONG_LONG, MPI_SUM, fSubComm);
+   if (fMPILocalRank == 0)
+      offset = 0;
+   MPI_Allreduce(&nbytes, &total, 1, MPI_LONG_LONG, MPI_SUM, fSubComm);
+   offset += fCollectiveEnd;
+   fCollectiveEnd += total;
+
+   // All ranks must take part in the same number of collective writes
+   Long64_t nchunks = (nbytes + kMaxWriteChunk - 1) / kMaxWriteChunk;
+   Long64_t maxchunks = 0;
+   MPI_Allreduce(&nchunks, &maxchunks, 1, MPI_LONG_LONG, MPI_MAX, fSubComm);
+   Bool_t ok = kTRUE;
+   for (Long64_t i = 0; i < maxchunks; ++i) {
+      const Long64_t pos = std::min(i * kMaxWriteChunk, nbytes);
+      const Int_t count = std::min(kMaxWriteChunk, nbytes - pos);
+      if (MPI_File_write_at_all(fCollectiveFile, offset + pos, buffer.data() + pos, count, MPI_CHAR,
+                                MPI_STATUS_IGNORE) != MPI_SUCCESS)
+         ok = kFALSE;
+   }
+
+   // Local rank 0 collects what it needs for the archive directory
+   Long64_t entry[5] = {offset, size, static_cast<Long64_t>(crc), fMPIGlobalRank, dostime};
+   std::vector<Long64_t> entries(fMPILocalRank == 0 ? 5 * fMPILocalSize : 0);
+   MPI_Gather(entry, 5, MPI_LONG_LONG, entries.data(), 5, MPI_LONG_LONG, 0, fSubComm);
+   for (Int_t r = 0; r < (Int_t)entries.size() / 5; ++r) {
+      fCollectiveEntries.push_back({entries[5 * r], entries[5 * r + 1], static_cast<UInt_t>(entries[5 * r + 2]),
+                                    static_cast<UInt_t>(entries[5 * r + 4]), static_cast<Int_t>(entries[5 * r + 3]),
+                                    fCollectiveWrites});
+   }
+
+   Int_t allok = ok;
+   MPI_Allreduce(MPI_IN_PLACE, &allok, 1, MPI_INT, MPI_LAND, fSubComm);
+   if (!allok)
+      Error("WriteCollective", "failed to write to %s", fCollectiveFilename.Data());
+
+   ++fCollectiveWrites;
+   this->ResetAfterMerge((TFileMergeInfo *)0);
+   return allok;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns the name of the archive member written by the WriteCollective()
+/// call number `index` of the rank `rank`, e.g. "mpi_output_3_0.root".
+
+TString TMPIFile::GetCollectiveMemberName(Int_t rank, Int_t index) const
+{
+   std::string name = gSystem->BaseName(GetName());
+   ULong_t found = name.rfind(".root");
+   if (found != std::string::npos)
+      name.resize(found);
+   return TString::Format("%s_%d_%d.root", name.c_str(), rank, index);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Called by all ranks of the sub communicator in collective mode: local rank 0
+/// writes the central directory of the archive, then the archive is closed.
+
+void TMPIFile::CloseCollective()
+{
+   if (fMPILocalRank == 0) {
+      std::vector<char> buffer;
+      for (const auto &entry : fCollectiveEntries) {
+         const TString member = GetCollectiveMemberName(entry.fRank, entry.fIndex);
+         PutLE(buffer, kZIPDirMagic, 4);
+         PutLE(buffer, kZIPVersion, 2); // made by
+         PutLE(buffer, kZIPVersion, 2); // needed
+         PutLE(buffer, 0, 2);           // flags
+         PutLE(buffer, 0, 2);           // stored
+         PutLE(buffer, entry.fDosTime, 4);
+         PutLE(buffer, entry.fCRC32, 4);
+         PutLE(buffer, kZIPMaxSize, 4);
+         PutLE(buffer, kZIPMaxSize, 4);
+         PutLE(buffer, member.Length(), 2);
+         PutLE(buffer, 28, 2);
+         PutLE(buffer, 0, 2); // comment
+         PutLE(buffer, 0, 2); // disk
+         PutLE(buffer, 0, 2); // internal attributes
+         PutLE(buffer, 0, 4); // external attributes
+         PutLE(buffer, kZIPMaxSize, 4);
+         buffer.insert(buffer.end(), member.Data(), member.Data() + member.Length());
+         PutLE(buffer, 1, 2); // Zip64 extended information
+         PutLE(buffer, 24, 2);
+         PutLE(buffer, entry.fSize, 8);
+         PutLE(buffer, entry.fSize, 8);
+         PutLE(buffer, entry.fOffset, 8);
+      }
+      const Long64_t dirSize = buffer.size();
+      const Long64_t recordPos = fCollectiveEnd + dirSize;
+      const ULong64_t nentries = fCollectiveEntries.size();
+
+      PutLE(buffer, kZIP64EndRecordMagic, 4);
+      PutLE(buffer, 44, 8);
+      PutLE(buffer, kZIPVersion, 2);
+      PutLE(buffer, kZIPVersion, 2);
+      PutLE(buffer, 0, 4);
+      PutLE(buffer, 0, 4);
+      PutLE(buffer, nentries, 8);
+      PutLE(buffer, nentries, 8);
+      PutLE(buffer, dirSize, 8);
+      PutLE(buffer, fCollectiveEnd, 8);
+
+      PutLE(buffer, kZIP64EndLocatorMagic, 4);
+      PutLE(buffer, 0, 4);
+      PutLE(buffer, recordPos, 8);
+      PutLE(buffer, 1, 4);
+
+      PutLE(buffer, kZIPEndMagic, 4);
+      PutLE(buffer, 0, 2);
+      PutLE(buffer, 0, 2);
+      PutLE(buffer, std::min<ULong64_t>(nentries, 0xffff), 2);
+      PutLE(buffer, std::min<ULong64_t>(nentries, 0xffff), 2);
+      PutLE(buffer, kZIPMaxSize, 4);
+      PutLE(buffer, kZIPMaxSize, 4);
+      PutLE(buffer, 0, 2);
+
+      for (std::size_t pos = 0; pos < buffer.size(); pos += kMaxWriteChunk) {
+         const Int_t count = std::min<std::size_t>(kMaxWriteChunk, buffer.size() - pos);
+         if (MPI_File_write_at(fCollectiveFile, fCollectiveEnd + pos, buffer.data() + pos, count, MPI_CHAR,
+                               MPI_STATUS_IGNORE) != MPI_SUCCESS) {
+            Error("Close", "failed to write the directory of %s", fCollectiveFilename.Data());
+            break;
+         }
+      }
+      fCollectiveEntries.clear();
+   }
+   MPI_File_close(&fCollectiveFile);
+   fCollective = kFALSE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Closes the file. For Worker ranks, this function will signal to the
 /// Collector that the Worker has exited. It also closes the inherited TMemFile.
+/// In collective mode, this finishes the shared archive instead.
 
 void TMPIFile::Close(Option_t *option)
 {
    if (IsOpen()) {
-      // sends empty buffer
-      CreateEmptyBufferAndSend();
+      if (fCollective) {
+         CloseCollective();
+      } else {
+         // sends empty buffer
+         CreateEmptyBufferAndSend();
+      }
       // call parent close function
       TMemFile::Close(option);
       
@@ -6,6 +6,7 @@ import { cleanup, resize, selectActivePad } from '../base/ObjectPainter.mjs';
 import { TAxisPainter } from './TAxisPainter.mjs';
 import { TFramePainter } from './TFramePainter.mjs';
 import { TPadPainter } from './TPadPainter.mjs';
+import { R__unzip } from '../io.mjs';
 
 
 /** @summary direct draw of TFrame object,
@@ -286,8 +287,28 @@ class TCanvasPainter extends TPadPainter {
 
    /** @summary Hanler for websocket open event
      * @private */
-   onWebsocketOpened(/*handle*/) {
+   onWebsocketOpened(handle) {
       // indicate that we are ready to recieve any following commands
+      // announce that primitives without changes can be reused and which compressions can be decoded
+      handle.send("CAPS6:unchanged,ZL,L4");
+   }
+
+   /** @summary Decode compressed message, produced by TWebCanvas
+     * @desc message starts with "ZMSG6:<length>:" followed by ROOT compressed blocks
+     * @returns {Promise} with decoded text message
+     * @private */
+   decodeCompressedMsg(msg, offset) {
+      let arr = new Uint8Array(msg, offset || 0), hdr = "", p1 = -1, p2 = -1;
+      for (let n = 0; (n < arr.length) && (n < 32) && (p2 < 0); ++n) {
+         hdr += String.fromCharCode(arr[n]);
+         if (hdr[n] == ':') { if (p1 < 0) p1 = n; else p2 = n; }
+      }
+      if ((p2 < 0) || (hdr.slice(0, p1) != "ZMSG6"))
+         return Promise.resolve(null);
+      let len = parseInt(hdr.slice(p1+1, p2));
+      return R__unzip(new DataView(msg, (offset || 0) + p2 + 1), len).then(buf => {
+         return buf ? new TextDecoder().decode(buf) : null;
+      });
    }
 
    /** @summary Hanler for websocket close event
@@ -299,7 +320,12 @@ class TCanvasPainter extends TPadPainter {
 
    /** @summary Handle websocket messages
      * @private */
-   onWebsocketMsg(handle, msg) {
+   onWebsocketMsg(handle, msg, offset) {
+      if (typeof msg != 'string')
+         return this.decodeCompressedMsg(msg, offset).then(txt => {
+            if (txt) this.onWebsocketMsg(handle, txt);
+         });
+
       console.log("GET MSG len:" + msg.length + " " + msg.slice(0,60));
 
       if (msg == "CLOSE") {
@@ -1286,7 +1286,10 @@ class TPadPainter extends ObjectPainter {
 
          let promise;
 
-         if (snap.fKind === webSnapIds.kObject) { // object itself
+         if (!snap.fSnapshot && ((snap.fKind === webSnapIds.kObject) || (snap.fKind === webSnapIds.kSVG))) {
+            // object not changed since previous snapshot, server does not send it again
+            promise = objpainter.redraw();
+         } else if (snap.fKind === webSnapIds.kObject) { // object itself
             if (objpainter.updateObject(snap.fSnapshot, snap.fOption))
                promise = objpainter.redraw();
          } else if (snap.fKind === webSnapIds.kSVG) { // update SVG
@@ -1363,6 +1366,13 @@ class TPadPainter extends ObjectPainter {
          });
       }
 
+      // object without data can be only reused, request full snapshot from server
+      if (!snap.fSnapshot && ((snap.fKind === webSnapIds.kObject) || (snap.fKind === webSnapIds.kSVG))) {
+         let canp = this.getCanvPainter();
+         if (canp) canp.sendWebsocket("RELOAD");
+         return this.drawNextSnap(lst, indx);
+      }
+
       // here the case of normal drawing, will be handled in promise
       if ((snap.fKind === webSnapIds.kObject) || (snap.fKind === webSnapIds.kSVG))
          return this.drawObject(this.getDom(), snap.fSnapshot, snap.fOption).then(objpainter => {
@@ -23,6 +23,8 @@ The prefix can be optionally followed by B whose casing is ignored, eg. 1k, 1K,
 	parser.add_argument("-dbg", help="Parallelize the execution in multiple processes in debug mode (Does not delete partial files stored inside working directory)")
 	parser.add_argument("-d", help="Carry out the partial multiprocess execution in the specified directory")
 	parser.add_argument("-n", help="Open at most 'maxopenedfiles' at once (use 0 to request to use the system maximum)")
+	parser.add_argument("-fanin", help="Merge the inputs level by level in a tree of temporary files, each merging at most 'fanin' inputs (use 0 to merge all inputs at once)")
+	parser.add_argument("-maxmemory", help="Merge histograms in batches such that the inputs in memory do not exceed the given size (use 0 for no limit)")
 	parser.add_argument("-cachesize", help="Resize the prefetching cache use to speed up I/O operations(use 0 to disable)")
 	parser.add_argument("-experimental-io-features", help="Used with an argument provided, enables the corresponding experimental feature for output trees")
 	parser.add_argument("-f", help="Gives the ability to specify the compression level of the target file(by default 4) ")
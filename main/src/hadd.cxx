@@ -31,6 +31,8 @@
               inside working directory)
   \param -d   Carry out the partial multiprocess execution in the specified directory
   \param -n   Open at most `n` at once (use 0 to request to use the system maximum)
+  \param -fanin Merge the inputs in a tree of temporary files, each merging at most `fanin` inputs
+  \param -maxmemory Merge histograms in batches whose inputs do not exceed the given size in memory
   \param -experimental-io-features `<feature>` Enables the corresponding experimental feature for output trees
   \return hadd returns a status code: 0 if OK, -1 otherwise
 
@@ -141,6 +143,8 @@ int main( int argc, char **argv )
    Bool_t multiproc = kFALSE;
    Bool_t debug = kFALSE;
    Int_t maxopenedfiles = 0;
+   Int_t fanin = 0;
+   Long64_t maxmemory = 0;
    Int_t verbosity = 99;
    TString cacheSize;
    SysInfo_t s;
@@ -287,6 +291,33 @@ int main( int argc, char **argv )
             }
          }
          ++ffirst;
+      } else if ( strcmp(argv[a],"-fanin") == 0 ) {
+         if (a+1 >= argc) {
+            std::cerr << "Error: no fan-in was provided after -fanin.\n";
+         } else {
+            Long_t request = strtol(argv[a+1], 0, 10);
+            if (request < kMaxInt && request >= 0) {
+               fanin = (Int_t)request;
+               ++a;
+               ++ffirst;
+            } else {
+               std::cerr << "Error: could not parse the fan-in passed after -fanin: " << argv[a+1] << ". All inputs will be merged at once.\n";
+            }
+         }
+         ++ffirst;
+      } else if ( strcmp(argv[a],"-maxmemory") == 0 ) {
+         if (a+1 >= argc) {
+            std::cerr << "Error: no memory size was provided after -maxmemory.\n";
+         } else {
+            auto parseResult = ROOT::FromHumanReadableSize(argv[a+1],maxmemory);
+            if (parseResult != ROOT::EFromHumanReadableSize::kSuccess) {
+               maxmemory = 0;
+               std::cerr << "Error: could not parse the memory size passed after -maxmemory: " << argv[a+1] << ". We will not limit the memory.\n";
+            }
+            ++a;
+            ++ffirst;
+         }
+         ++ffirst;
       } else if ( strcmp(argv[a],"-v") == 0 ) {
          if (a+1 == argc || argv[a+1][0] == '-') {
             // Verbosity level was not specified use the default:
@@ -464,6 +495,8 @@ int main( int argc, char **argv )
          }
       }
       merger.SetNotrees(noTrees);
+      merger.SetReductionFanIn(fanin);
+      merger.SetMaxMergeMemory(maxmemory);
       merger.SetMergeOptions(cacheSize);
       merger.SetIOFeatures(features);
       Bool_t status;
@@ -0,0 +1,110 @@
+// @(#)root/fft:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+////////////////////////////////////////////////////////////////////////////////
+///
+/// Process-wide cache of the FFTW plans used by the TFFT* classes.
+///
+/// A plan only depends on the kind, the sizes, the flags of the transform and
+/// on whether it is done in place; it is executed on the arrays of each TFFT*
+/// object with the new-array execute functions of FFTW, which is possible
+/// because all the arrays are allocated with fftw_malloc(). Creating plans is
+/// serialized, since the FFTW planner is not thread-safe, while executing them
+/// is.
+///
+/// If `FFTW.WisdomFile` is set in .rootrc, the FFTW wisdom is read from this
+/// file before the first plan is created, and written back after each plan
+/// created with the "M", "P" or "EX" flags, such that the expensive planning
+/// is only done once across processes.
+///
+/////////////////////////////////////////////////////////////////////////////////
+
+#include "FFTWPlanCache.h"
+#include "TEnv.h"
+#include "TError.h"
+#include "TString.h"
+#include "TSystem.h"
+
+#include <mutex>
+#include <unordered_map>
+
+namespace {
+
+struct RFFTWPlanCache {
+   std::mutex fMutex;
+   std::unordered_map<std::string, fftw_plan> fPlans;
+   bool fWisdomRead = false;
+   TString fWisdomFile;
+
+   ~RFFTWPlanCache()
+   {
+      for (auto &plan : fPlans)
+         fftw_destroy_plan(plan.second);
+   }
+};
+
+RFFTWPlanCache &GetPlanCache()
+{
+   static RFFTWPlanCache cache;
+   return cache;
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Build the key identifying a plan in the cache.
+
+std::string ROOT::Internal::FFTW::MakePlanKey(const char *type, Int_t ndim, const Int_t *n, UInt_t flags,
+                                              Bool_t inPlace, Int_t sign, const Int_t *kinds)
+{
+   std::string key(type);
+   key += inPlace ? ":I:" : ":O:";
+   key += std::to_string(flags) + ":" + std::to_string(sign);
+   for (Int_t i = 0; i < ndim; i++) {
+      key += ":" + std::to_string(n[i]);
+      if (kinds)
+         key += "/" + std::to_string(kinds[i]);
+   }
+   return key;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the cached plan for `key`, calling `create` to make it if there is
+/// none yet. The returned plan is owned by the cache and must not be destroyed.
+
+fftw_plan ROOT::Internal::FFTW::GetPlan(const std::string &key, UInt_t flags, const std::function<fftw_plan()> &create)
+{
+   auto &cache = GetPlanCache();
+   std::lock_guard<std::mutex> lock(cache.fMutex);
+   auto it = cache.fPlans.find(key);
+   if (it != cache.fPlans.end())
+      return it->second;
+
+   if (!cache.fWisdomRead) {
+      cache.fWisdomRead = true;
+      cache.fWisdomFile = gEnv->GetValue("FFTW.WisdomFile", "");
+      if (!cache.fWisdomFile.IsNull()) {
+         gSystem->ExpandPathName(cache.fWisdomFile);
+         if (!gSystem->AccessPathName(cache.fWisdomFile) &&
+             !fftw_import_wisdom_from_filename(cache.fWisdomFile.Data()))
+            ::Warning("FFTW::GetPlan", "cannot read FFTW wisdom from %s", cache.fWisdomFile.Data());
+      }
+   }
+
+   fftw_plan plan = create();
+   if (!plan)
+      return nullptr;
+   cache.fPlans.emplace(key, plan);
+
+   if (flags != FFTW_ESTIMATE && !cache.fWisdomFile.IsNull() &&
+       !fftw_export_wisdom_to_filename(cache.fWisdomFile.Data()))
+      ::Warning("FFTW::GetPlan", "cannot write FFTW wisdom to %s", cache.fWisdomFile.Data());
+   return plan;
+}
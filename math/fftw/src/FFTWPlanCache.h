@@ -0,0 +1,32 @@
+// @(#)root/fft:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_FFTWPlanCache
+#define ROOT_FFTWPlanCache
+
+#include "Rtypes.h"
+#include "fftw3.h"
+
+#include <functional>
+#include <string>
+
+namespace ROOT {
+namespace Internal {
+namespace FFTW {
+
+std::string MakePlanKey(const char *type, Int_t ndim, const Int_t *n, UInt_t flags, Bool_t inPlace, Int_t sign = 0,
+                        const Int_t *kinds = nullptr);
+fftw_plan GetPlan(const std::string &key, UInt_t flags, const std::function<fftw_plan()> &create);
+
+} // namespace FFTW
+} // namespace Internal
+} // namespace ROOT
+
+#endif
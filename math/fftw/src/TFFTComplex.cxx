@@ -41,6 +41,7 @@
 
 #include "TFFTComplex.h"
 #include "fftw3.h"
+#include "FFTWPlanCache.h"
 #include "TComplex.h"
 
 
@@ -102,13 +103,12 @@ TFFTComplex::TFFTComplex(Int_t ndim, Int_t *n, Bool_t inPlace)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-///Destroys the data arrays and the plan. However, some plan information stays around
-///until the root session is over, and is reused if other plans of the same size are
-///created
+///Destroys the data arrays. The plan stays in the process-wide plan cache until
+///the root session is over, and is reused by other transforms of the same size
+///and type
 
 TFFTComplex::~TFFTComplex()
 {
-   fftw_destroy_plan((fftw_plan)fPlan);
    fPlan = 0;
    fftw_free((fftw_complex*)fIn);
    if (fOut)
@@ -142,14 +142,13 @@ void TFFTComplex::Init( Option_t *flags, Int_t sign,const Int_t* /*kind*/)
    fSign = sign;
    fFlags = flags;
 
-   if (fPlan)
-      fftw_destroy_plan((fftw_plan)fPlan);
-   fPlan = 0;
-
-   if (fOut)
-      fPlan = (void*)fftw_plan_dft(fNdim, fN, (fftw_complex*)fIn, (fftw_complex*)fOut, sign,MapFlag(flags));
-   else
-      fPlan = (void*)fftw_plan_dft(fNdim, fN, (fftw_complex*)fIn, (fftw_complex*)fIn, sign, MapFlag(flags));
+   const UInt_t flag = MapFlag(flags);
+   const std::string key = ROOT::Internal::FFTW::MakePlanKey("C2C", fNdim, fN, flag, !fOut, sign);
+   fPlan = (void*)ROOT::Internal::FFTW::GetPlan(key, flag, [&] {
+      if (fOut)
+         return fftw_plan_dft(fNdim, fN, (fftw_complex*)fIn, (fftw_complex*)fOut, sign, flag);
+      return fftw_plan_dft(fNdim, fN, (fftw_complex*)fIn, (fftw_complex*)fIn, sign, flag);
+   });
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -158,7 +157,7 @@ void TFFTComplex::Init( Option_t *flags, Int_t sign,const Int_t* /*kind*/)
 void TFFTComplex::Transform()
 {
    if (fPlan)
-      fftw_execute((fftw_plan)fPlan);
+      fftw_execute_dft((fftw_plan)fPlan, (fftw_complex*)fIn, (fftw_complex*)(fOut ? fOut : fIn));
    else {
       Error("Transform", "transform not initialised");
       return;
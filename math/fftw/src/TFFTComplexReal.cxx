@@ -43,6 +43,7 @@
 
 #include "TFFTComplexReal.h"
 #include "fftw3.h"
+#include "FFTWPlanCache.h"
 #include "TComplex.h"
 
 
@@ -108,13 +109,12 @@ TFFTComplexReal::TFFTComplexReal(Int_t ndim, Int_t *n, Bool_t inPlace)
 
 
 ////////////////////////////////////////////////////////////////////////////////
-///Destroys the data arrays and the plan. However, some plan information stays around
-///until the root session is over, and is reused if other plans of the same size are
-///created
+///Destroys the data arrays. The plan stays in the process-wide plan cache until
+///the root session is over, and is reused by other transforms of the same size
+///and type
 
 TFFTComplexReal::~TFFTComplexReal()
 {
-   fftw_destroy_plan((fftw_plan)fPlan);
    fPlan = 0;
    fftw_free((fftw_complex*)fIn);
    if (fOut)
@@ -149,14 +149,13 @@ void TFFTComplexReal::Init( Option_t *flags, Int_t /*sign*/,const Int_t* /*kind*
 {
    fFlags = flags;
 
-   if (fPlan)
-      fftw_destroy_plan((fftw_plan)fPlan);
-   fPlan = 0;
-
-   if (fOut)
-      fPlan = (void*)fftw_plan_dft_c2r(fNdim, fN,(fftw_complex*)fIn,(Double_t*)fOut, MapFlag(flags));
-   else
-      fPlan = (void*)fftw_plan_dft_c2r(fNdim, fN, (fftw_complex*)fIn, (Double_t*)fIn, MapFlag(flags));
+   const UInt_t flag = MapFlag(flags);
+   const std::string key = ROOT::Internal::FFTW::MakePlanKey("C2R", fNdim, fN, flag, !fOut);
+   fPlan = (void*)ROOT::Internal::FFTW::GetPlan(key, flag, [&] {
+      if (fOut)
+         return fftw_plan_dft_c2r(fNdim, fN, (fftw_complex*)fIn, (Double_t*)fOut, flag);
+      return fftw_plan_dft_c2r(fNdim, fN, (fftw_complex*)fIn, (Double_t*)fIn, flag);
+   });
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -165,7 +164,7 @@ void TFFTComplexReal::Init( Option_t *flags, Int_t /*sign*/,const Int_t* /*kind*
 void TFFTComplexReal::Transform()
 {
    if (fPlan)
-      fftw_execute((fftw_plan)fPlan);
+      fftw_execute_dft_c2r((fftw_plan)fPlan, (fftw_complex*)fIn, (Double_t*)(fOut ? fOut : fIn));
    else {
       Error("Transform", "transform was not initialized");
       return;
@@ -60,6 +60,9 @@
 
 #include "TFFTReal.h"
 #include "fftw3.h"
+#include "FFTWPlanCache.h"
+
+#include <vector>
 
 ClassImp(TFFTReal);
 
@@ -123,7 +126,7 @@ TFFTReal::TFFTReal(Int_t ndim, Int_t *n, Bool_t inPlace)
 
 TFFTReal::~TFFTReal()
 {
-   fftw_destroy_plan((fftw_plan)fPlan);
+   // the plan is owned by the process-wide plan cache
    fPlan = 0;
    fftw_free(fIn);
    fIn = 0;
@@ -175,18 +178,22 @@ TFFTReal::~TFFTReal()
 
 void TFFTReal::Init( Option_t* flags,Int_t /*sign*/, const Int_t *kind)
 {
-   if (fPlan)
-      fftw_destroy_plan((fftw_plan)fPlan);
    fPlan = 0;
 
    if (!fKind)
       fKind = (fftw_r2r_kind*)fftw_malloc(sizeof(fftw_r2r_kind)*fNdim);
 
    if (MapOptions(kind)){
-      if (fOut)
-         fPlan = (void*)fftw_plan_r2r(fNdim, fN, (Double_t*)fIn, (Double_t*)fOut, (fftw_r2r_kind*)fKind, MapFlag(flags));
-      else
-         fPlan = (void*)fftw_plan_r2r(fNdim, fN, (Double_t*)fIn, (Double_t*)fIn, (fftw_r2r_kind*)fKind, MapFlag(flags));
+      const UInt_t flag = MapFlag(flags);
+      std::vector<Int_t> kinds(fNdim);
+      for (Int_t i=0; i<fNdim; i++)
+         kinds[i] = ((fftw_r2r_kind*)fKind)[i];
+      const std::string key = ROOT::Internal::FFTW::MakePlanKey("R2R", fNdim, fN, flag, !fOut, 0, kinds.data());
+      fPlan = (void*)ROOT::Internal::FFTW::GetPlan(key, flag, [&] {
+         if (fOut)
+            return fftw_plan_r2r(fNdim, fN, (Double_t*)fIn, (Double_t*)fOut, (fftw_r2r_kind*)fKind, flag);
+         return fftw_plan_r2r(fNdim, fN, (Double_t*)fIn, (Double_t*)fIn, (fftw_r2r_kind*)fKind, flag);
+      });
       fFlags = flags;
    }
 }
@@ -197,7 +204,7 @@ void TFFTReal::Init( Option_t* flags,Int_t /*sign*/, const Int_t *kind)
 void TFFTReal::Transform()
 {
    if (fPlan)
-      fftw_execute((fftw_plan)fPlan);
+      fftw_execute_r2r((fftw_plan)fPlan, (Double_t*)fIn, (Double_t*)(fOut ? fOut : fIn));
    else {
       Error("Transform", "transform hasn't been initialised");
       return;
@@ -44,6 +44,7 @@
 
 #include "TFFTRealComplex.h"
 #include "fftw3.h"
+#include "FFTWPlanCache.h"
 #include "TComplex.h"
 
 
@@ -112,13 +113,12 @@ TFFTRealComplex::TFFTRealComplex(Int_t ndim, Int_t *n, Bool_t inPlace)
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-///Destroys the data arrays and the plan. However, some plan information stays around
-///until the root session is over, and is reused if other plans of the same size are
-///created
+///Destroys the data arrays. The plan stays in the process-wide plan cache until
+///the root session is over, and is reused by other transforms of the same size
+///and type
 
 TFFTRealComplex::~TFFTRealComplex()
 {
-   fftw_destroy_plan((fftw_plan)fPlan);
    fPlan = 0;
    fftw_free(fIn);
    fIn = 0;
@@ -153,14 +153,13 @@ void TFFTRealComplex::Init(Option_t *flags,Int_t /*sign*/, const Int_t* /*kind*/
 {
    fFlags = flags;
 
-   if (fPlan)
-      fftw_destroy_plan((fftw_plan)fPlan);
-   fPlan = 0;
-
-   if (fOut)
-      fPlan = (void*)fftw_plan_dft_r2c(fNdim, fN, (Double_t*)fIn, (fftw_complex*)fOut,MapFlag(flags));
-   else
-      fPlan = (void*)fftw_plan_dft_r2c(fNdim, fN, (Double_t*)fIn, (fftw_complex*)fIn, MapFlag(flags));
+   const UInt_t flag = MapFlag(flags);
+   const std::string key = ROOT::Internal::FFTW::MakePlanKey("R2C", fNdim, fN, flag, !fOut);
+   fPlan = (void*)ROOT::Internal::FFTW::GetPlan(key, flag, [&] {
+      if (fOut)
+         return fftw_plan_dft_r2c(fNdim, fN, (Double_t*)fIn, (fftw_complex*)fOut, flag);
+      return fftw_plan_dft_r2c(fNdim, fN, (Double_t*)fIn, (fftw_complex*)fIn, flag);
+   });
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -170,7 +169,7 @@ void TFFTRealComplex::Transform()
 {
 
    if (fPlan){
-      fftw_execute((fftw_plan)fPlan);
+      fftw_execute_dft_r2c((fftw_plan)fPlan, (Double_t*)fIn, (fftw_complex*)(fOut ? fOut : fIn));
    }
    else {
       Error("Transform", "transform hasn't been initialised");
@@ -7,6 +7,7 @@
 
 #include "TObject.h"
 #include "TString.h"
+#include "ROOT/EExecutionPolicy.hxx"
 
 #include <vector>
 
@@ -73,6 +74,10 @@ protected:
 
    Double_t *fAlpha;          ///< [fDim] Internal parameters of the hyper-rectangle
 
+   ROOT::EExecutionPolicy fExecutionPolicy = ROOT::EExecutionPolicy::kSequential; ///<! How cells are explored
+
+   static constexpr Long_t kExploreBatch = 64; ///< Number of points drawn at once in the parallel exploration of a cell
+
 public:
    TFoam();                          // Default constructor (used only by ROOT streamer)
    TFoam(const Char_t*);             // Principal user-defined constructor
@@ -92,6 +97,8 @@ public:
    virtual Int_t  Divide(TFoamCell *);       // Divide iCell into two daughters; iCell retained, taged as inactive
    virtual void MakeActiveList();            // Creates table of active cells
    virtual void GenerCel2(TFoamCell *&);     // Chose an active cell the with probability ~ Primary integral
+   TFoamCell *PickCell(Double_t random) const; // Active cell for the uniform random number random
+   void EvalBatch(Long_t n, Double_t *x, Double_t *rho, Bool_t parallel); // Evaluates the distribution on n points
    // Generation
    virtual Double_t Eval(Double_t *);        // Evaluates value of the distribution function
    virtual void     MakeEvent();             // Makes (generates) single MC event
@@ -99,6 +106,7 @@ public:
    virtual void     GetMCwt(Double_t &);     // Provides generated MC weight
    virtual Double_t GetMCwt();               // Provides generates MC weight
    virtual Double_t MCgenerate(Double_t *MCvect);// All three above function in one
+   Double_t MCgenerate(TRandom *rnd, Double_t *MCvect) const; // Thread-safe generation with the generator rnd
    // Finalization
    virtual void GetIntegMC(Double_t&, Double_t&);// Provides Integrand and abs. error from MC run
    virtual void GetIntNorm(Double_t&, Double_t&);// Provides normalization Inegrand
@@ -123,6 +131,8 @@ public:
    virtual void SetMaxWtRej(Double_t MaxWtRej){fMaxWtRej=MaxWtRej;}  // Sets max. weight for rejection
    virtual void SetInhiDiv(Int_t, Int_t );            // Set inhibition of cell division along certain edge
    virtual void SetXdivPRD(Int_t, Int_t, Double_t[]); // Set predefined division points
+   void SetExecutionPolicy(ROOT::EExecutionPolicy policy); // Sets sequential or parallel exploration of the cells
+   ROOT::EExecutionPolicy GetExecutionPolicy() const { return fExecutionPolicy; } // Gets how cells are explored
    // Getters and Setters
    virtual const char *GetVersion() const {return fVersion.Data();}// Get version of the FOAM
    virtual Int_t    GetTotDim() const { return fDim;}              // Get total dimension
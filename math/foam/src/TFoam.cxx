@@ -92,6 +92,13 @@ S. Jadach, Computer Physics Communications 152 (2003) 55.
 #include "TMath.h"
 #include "TInterpreter.h"
 
+#include <algorithm>
+#include <vector>
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
 ClassImp(TFoam);
 
 //FFFFFF  BoX-FORMATs for nice and flexible outputs
@@ -537,8 +544,6 @@ void TFoam::Explore(TFoamCell *cell)
 
    TFoamCell  *parent;
 
-   Double_t *xRand = new Double_t[fDim];
-
    Double_t *volPart=0;
 
    cell->CalcVolume();
@@ -559,36 +564,51 @@ void TFoam::Explore(TFoamCell *cell)
    for(i=0;i<fDim;i++) ((TH1D *)(*fHistEdg)[i])->Reset(); // Reset histograms
    fHistWt->Reset();
    //
+   // The random points are generated and the density is evaluated in batches,
+   // of one point unless the exploration runs in parallel, see SetExecutionPolicy().
+   const Bool_t parallel = fExecutionPolicy == ROOT::EExecutionPolicy::kMultiThread && fRho;
+   const Long_t nBatch = parallel ? std::min<Long_t>(fNSampl, kExploreBatch) : 1;
+   std::vector<Double_t> alphas(nBatch*fDim), points(nBatch*fDim), rhos(nBatch);
    // ||||||||||||||||||||||||||BEGIN MC LOOP|||||||||||||||||||||||||||||
    Double_t nevEff=0.;
-   for(iev=0;iev<fNSampl;iev++){
-      MakeAlpha();               // generate uniformly vector inside hypercube
-
-      if(fDim>0){
-      for(j=0; j<fDim; j++)
-         xRand[j]= cellPosi[j] +fAlpha[j]*(cellSize[j]);
+   for(iev=0;iev<fNSampl;){
+      const Long_t nev = std::min<Long_t>(nBatch, fNSampl-iev);
+      for(Long_t iBatch=0; iBatch<nev; iBatch++){
+         MakeAlpha();               // generate uniformly vector inside hypercube
+         for(j=0; j<fDim; j++){
+            alphas[iBatch*fDim+j] = fAlpha[j];
+            points[iBatch*fDim+j] = cellPosi[j] +fAlpha[j]*(cellSize[j]);
+         }
       }
-
-      wt=dx*Eval(xRand);
-
-      nProj = 0;
-      if(fDim>0) {
-         for(k=0; k<fDim; k++) {
-            xproj =fAlpha[k];
-            ((TH1D *)(*fHistEdg)[nProj])->Fill(xproj,wt);
-            nProj++;
+      EvalBatch(nev, points.data(), rhos.data(), parallel);
+      fNCalls += nev;
+
+      Bool_t done = kFALSE;
+      for(Long_t iBatch=0; iBatch<nev; iBatch++, iev++){
+         wt=dx*rhos[iBatch];
+
+         nProj = 0;
+         if(fDim>0) {
+            for(k=0; k<fDim; k++) {
+               xproj =alphas[iBatch*fDim+k];
+               ((TH1D *)(*fHistEdg)[nProj])->Fill(xproj,wt);
+               nProj++;
+            }
+         }
+         //
+         ceSum[0] += wt;    // sum of weights
+         ceSum[1] += wt*wt; // sum of weights squared
+         ceSum[2]++;        // sum of 1
+         if (ceSum[3]>wt) ceSum[3]=wt;  // minimum weight;
+         if (ceSum[4]<wt) ceSum[4]=wt;  // maximum weight
+         // test MC loop exit condition
+         nevEff = ceSum[1] == 0. ? 0. : ceSum[0]*ceSum[0]/ceSum[1];
+         if( nevEff >= fNBin*fEvPerBin) {
+            done = kTRUE;
+            break;
          }
       }
-      //
-      fNCalls++;
-      ceSum[0] += wt;    // sum of weights
-      ceSum[1] += wt*wt; // sum of weights squared
-      ceSum[2]++;        // sum of 1
-      if (ceSum[3]>wt) ceSum[3]=wt;  // minimum weight;
-      if (ceSum[4]<wt) ceSum[4]=wt;  // maximum weight
-      // test MC loop exit condition
-      nevEff = ceSum[1] == 0. ? 0. : ceSum[0]*ceSum[0]/ceSum[1];
-      if( nevEff >= fNBin*fEvPerBin) break;
+      if (done) break;
    }   // ||||||||||||||||||||||||||END MC LOOP|||||||||||||||||||||||||||||
    //------------------------------------------------------------------
    //---  predefine logics of searching for the best division edge ---
@@ -660,7 +680,6 @@ void TFoam::Explore(TFoamCell *cell)
       parent->SetDriv( parDriv   +intDriv -driOld );
    }
    delete [] volPart;
-   delete [] xRand;
    //cell->Print();
 } // TFoam::Explore
 
@@ -1057,6 +1076,34 @@ void TFoam::ResetRho(TFoamIntegrand *fun)
    SetRho(fun);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// User method.
+/// Sets how the distribution is evaluated during the exploration of the cells
+/// in Initialize(). With ROOT::EExecutionPolicy::kMultiThread, the
+/// exploration of a cell draws its random points in batches of up to
+/// kExploreBatch and evaluates the distribution on each batch in parallel;
+/// the distribution must then be thread safe. This requires a distribution in
+/// compiled mode, with the interactive mode the evaluation stays sequential.
+///
+/// The foam is reproducible for a given seed, but differs from the one built
+/// sequentially: the points of a batch drawn after the end of the sampling of
+/// a cell are discarded.
+
+void TFoam::SetExecutionPolicy(ROOT::EExecutionPolicy policy)
+{
+   if (policy == ROOT::EExecutionPolicy::kMultiProcess) {
+      Warning("SetExecutionPolicy", "Multi-process exploration is not supported, using sequential exploration");
+      policy = ROOT::EExecutionPolicy::kSequential;
+   }
+#ifndef R__USE_IMT
+   if (policy == ROOT::EExecutionPolicy::kMultiThread) {
+      Warning("SetExecutionPolicy", "ROOT was built without multi-threading support, using sequential exploration");
+      policy = ROOT::EExecutionPolicy::kSequential;
+   }
+#endif
+   fExecutionPolicy = policy;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Internal method.
 /// Evaluates distribution to be generated.
@@ -1078,18 +1125,48 @@ Double_t TFoam::Eval(Double_t *xRand)
    return result;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Internal method.
+/// Evaluates the distribution at the n points stored one after the other in x
+/// and writes the values to rho. If parallel is true, the points are evaluated
+/// concurrently on the threads of a ROOT::TThreadExecutor.
+
+void TFoam::EvalBatch(Long_t n, Double_t *x, Double_t *rho, Bool_t parallel)
+{
+#ifdef R__USE_IMT
+   if (parallel && fRho && n > 1) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach([&](Long_t i) { rho[i] = fRho->Density(fDim, x + i * fDim); }, ROOT::TSeq<Long_t>(n));
+      return;
+   }
+#else
+   (void)parallel;
+#endif
+   for (Long_t i = 0; i < n; i++)
+      rho[i] = Eval(x + i * fDim);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Internal method.
 /// Return randomly chosen active cell with probability equal to its
 /// contribution into total driver integral using interpolation search.
 
 void TFoam::GenerCel2(TFoamCell *&pCell)
+{
+   pCell = PickCell(fPseRan->Rndm());
+}       // TFoam::GenerCel2
+
+////////////////////////////////////////////////////////////////////////////////
+/// Internal method.
+/// Return the active cell corresponding to the uniform random number random,
+/// with probability equal to its contribution into total driver integral
+/// using interpolation search.
+
+TFoamCell *TFoam::PickCell(Double_t random) const
 {
    Long_t  lo, hi, hit;
    Double_t fhit, flo, fhi;
-   Double_t random;
 
-   random=fPseRan->Rndm();
    lo  = 0;              hi =fNoAct-1;
    flo = fPrimAcu[lo];  fhi=fPrimAcu[hi];
    while(lo+1<hi) {
@@ -1108,10 +1185,10 @@ void TFoam::GenerCel2(TFoamCell *&pCell)
       }
    }
    if (fPrimAcu[lo]>random)
-      pCell = fCells[fCellsAct[lo]];
+      return fCells[fCellsAct[lo]];
    else
-      pCell = fCells[fCellsAct[hi]];
-}       // TFoam::GenerCel2
+      return fCells[fCellsAct[hi]];
+}       // TFoam::PickCell
 
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1201,6 +1278,52 @@ Double_t TFoam::MCgenerate(Double_t *MCvect)
    return(fMCwt);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// User method which generates an MC event with the random number generator
+/// rnd, stores it in MCvect and returns its MC weight.
+///
+/// Unlike MCgenerate(Double_t*), this method does not modify the TFoam object:
+/// several threads can generate events concurrently after Initialize(), each
+/// with its own random number generator, provided that the distribution set
+/// with SetRho() is thread safe. The statistics of the MC weights
+/// (GetIntegMC(), GetWtParams(), ...) are not updated.
+/// Requires a distribution in compiled mode (SetRho() or SetRhoInt()).
+///
+/// ~~~ {.cpp}
+/// ROOT::TThreadExecutor pool(nThreads);
+/// pool.Foreach([&](unsigned int i) {
+///    TRandom3 rnd(i + 1);
+///    std::vector<Double_t> x(foam.GetTotDim());
+///    for (int iev = 0; iev < nEventsPerThread; iev++) {
+///       Double_t wt = foam.MCgenerate(&rnd, x.data());
+///       ...
+///    }
+/// }, ROOT::TSeqU(nThreads));
+/// ~~~
+
+Double_t TFoam::MCgenerate(TRandom *rnd, Double_t *MCvect) const
+{
+   if (!fRho) {
+      Error("MCgenerate", "Distribution function in compiled mode not set \n");
+      return 0;
+   }
+   std::vector<Double_t> alpha(fDim);
+   TFoamVect  cellPosi(fDim); TFoamVect  cellSize(fDim);
+   while (true) {
+      TFoamCell *rCell = PickCell(rnd->Rndm());   // choose randomly one cell
+      if (fDim > 0) rnd->RndmArray(fDim, alpha.data());
+      rCell->GetHcub(cellPosi,cellSize);
+      for (Int_t j=0; j<fDim; j++)
+         MCvect[j]= cellPosi[j] +alpha[j]*cellSize[j];
+      //  weight average normalized to PRIMARY integral over the cell
+      Double_t mcwt = rCell->GetVolume()*fRho->Density(fDim,MCvect) / rCell->GetPrim();
+      if (fOptRej != 1) return mcwt;
+      //*******  Optional rejection ******
+      if (fMaxWtRej*rnd->Rndm() > mcwt) continue;  // Wt=1 events, internal rejection
+      return (mcwt < fMaxWtRej) ? 1.0 : mcwt/fMaxWtRej;
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// User method.
 /// It provides the value of the integral calculated from the averages of the MC run
@@ -0,0 +1,344 @@
+// @(#)root/mathcore:$Id$
+
+/**********************************************************************
+ *                                                                    *
+ * Copyright (c) 2023 , LCG ROOT MathLib Team                         *
+ *                                                                    *
+ *                                                                    *
+ **********************************************************************/
+
+// Header file for class LorentzVectorCollection
+//
+#ifndef ROOT_Math_GenVector_LorentzVectorCollection
+#define ROOT_Math_GenVector_LorentzVectorCollection  1
+
+#include "Math/GenVector/LorentzVector.h"
+
+#include "Math/GenVector/GenVector_exception.h"
+
+#include "ROOT/RVec.hxx"
+
+#include <array>
+#include <cmath>
+#include <stdexcept>
+
+namespace ROOT {
+
+  namespace Math {
+
+//__________________________________________________________________________________________
+/** @ingroup GenVector
+
+Class describing a collection of LorentzVector objects, stored as a structure of arrays:
+each of the four coordinates of the coordinate system CoordSystem is kept in its own
+ROOT::VecOps::RVec. For example, for PtEtaPhiM4D the collection holds one array of pt,
+one of eta, one of phi and one of masses, as read from the branches of a TTree.
+
+The kinematic quantities (Px(), Pt(), M(), ...) are computed for all the elements at once
+and returned as RVec. Each of them is a loop over contiguous arrays without any virtual
+call, which the compiler can vectorize. The VectorUtil functions InvariantMass, DeltaR and
+boost are overloaded for collections and work element by element; combined with
+ROOT::VecOps::Combinations and Take they compute quantities over all the pairs of objects:
+
+~~~{.cpp}
+ROOT::Math::LorentzVectorCollection<ROOT::Math::PtEtaPhiM4D<double>> jets(pt, eta, phi, mass);
+auto pairs = ROOT::VecOps::Combinations(jets.Column(0), 2);
+auto mjj = ROOT::Math::VectorUtil::InvariantMass(jets.Take(pairs[0]), jets.Take(pairs[1]));
+~~~
+
+The class is header-only; its users must link against libROOTVecOps.
+
+@sa Overview of the @ref GenVector "physics vector library"
+*/
+
+    template< class CoordSystem >
+    class LorentzVectorCollection {
+
+    public:
+
+       typedef CoordSystem CoordinateType;
+       typedef typename CoordSystem::Scalar Scalar;
+       typedef ROOT::VecOps::RVec<Scalar> Column_t;
+       typedef typename Column_t::size_type size_type;
+       typedef LorentzVector<CoordSystem> Element_t;
+
+       /**
+          Default constructor: an empty collection.
+       */
+       LorentzVectorCollection() {}
+
+       /**
+          Construct from the four coordinate arrays, given in the order of the coordinate
+          system (e.g. pt, eta, phi and mass for PtEtaPhiM4D). The arrays must have the same size.
+       */
+       LorentzVectorCollection(const Column_t &a, const Column_t &b, const Column_t &c, const Column_t &d)
+          : fCoords{{a, b, c, d}}
+       {
+          if (b.size() != a.size() || c.size() != a.size() || d.size() != a.size())
+             throw std::runtime_error("LorentzVectorCollection: the coordinate arrays have different sizes");
+       }
+
+       /**
+          Construct from the LorentzVector objects in the range [first, last),
+          converting them to CoordSystem.
+       */
+       template <class InputIt>
+       LorentzVectorCollection(InputIt first, InputIt last)
+       {
+          for (; first != last; ++first)
+             push_back(*first);
+       }
+
+       /**
+          Construct from a collection using another coordinate system, converting all the elements.
+       */
+       template <class OtherCoords>
+       explicit LorentzVectorCollection(const LorentzVectorCollection<OtherCoords> &other)
+       {
+          reserve(other.size());
+          for (size_type i = 0; i < other.size(); ++i)
+             push_back(other[i]);
+       }
+
+       // ------ size and element access ------
+
+       size_type size() const { return fCoords[0].size(); }
+
+       bool empty() const { return fCoords[0].empty(); }
+
+       void reserve(size_type n)
+       {
+          for (auto &c : fCoords)
+             c.reserve(n);
+       }
+
+       /**
+          Append a LorentzVector, converting it to CoordSystem if needed.
+       */
+       template <class OtherCoords>
+       void push_back(const LorentzVector<OtherCoords> &v)
+       {
+          Scalar coords[4];
+          Element_t(v).Coordinates().GetCoordinates(coords);
+          for (unsigned int j = 0; j < 4; ++j)
+             fCoords[j].push_back(coords[j]);
+       }
+
+       /**
+          Return a copy of the i-th element as a LorentzVector.
+       */
+       Element_t operator[](size_type i) const
+       {
+          return Element_t(fCoords[0][i], fCoords[1][i], fCoords[2][i], fCoords[3][i]);
+       }
+
+       /**
+          Return the array of the coordinate icoord (the order being the one of the coordinate system).
+       */
+       const Column_t &Column(unsigned int icoord) const { return fCoords[icoord]; }
+
+       /**
+          Return the collection of the elements with the given indices, e.g. as returned by
+          ROOT::VecOps::Combinations or ROOT::VecOps::Argsort.
+       */
+       LorentzVectorCollection Take(const ROOT::VecOps::RVec<size_type> &indices) const
+       {
+          return LorentzVectorCollection(ROOT::VecOps::Take(fCoords[0], indices), ROOT::VecOps::Take(fCoords[1], indices),
+                                         ROOT::VecOps::Take(fCoords[2], indices), ROOT::VecOps::Take(fCoords[3], indices));
+       }
+
+       // ------ kinematics of all the elements ------
+
+       Column_t Px() const { return Apply([](const CoordSystem &c) { return c.Px(); }); }
+       Column_t Py() const { return Apply([](const CoordSystem &c) { return c.Py(); }); }
+       Column_t Pz() const { return Apply([](const CoordSystem &c) { return c.Pz(); }); }
+       Column_t E() const { return Apply([](const CoordSystem &c) { return c.E(); }); }
+       Column_t Pt() const { return Apply([](const CoordSystem &c) { return c.Pt(); }); }
+       Column_t Eta() const { return Apply([](const CoordSystem &c) { return c.Eta(); }); }
+       Column_t Phi() const { return Apply([](const CoordSystem &c) { return c.Phi(); }); }
+       Column_t P() const { return Apply([](const CoordSystem &c) { return c.P(); }); }
+       Column_t M() const { return Apply([](const CoordSystem &c) { return c.M(); }); }
+       Column_t M2() const { return Apply([](const CoordSystem &c) { return c.M2(); }); }
+       Column_t Mt() const { return Apply([](const CoordSystem &c) { return c.Mt(); }); }
+
+       /**
+          Compute the cartesian coordinates of all the elements in a single pass.
+       */
+       void GetPxPyPzE(Column_t &px, Column_t &py, Column_t &pz, Column_t &e) const
+       {
+          const size_type n = size();
+          px.resize(n);
+          py.resize(n);
+          pz.resize(n);
+          e.resize(n);
+          for (size_type i = 0; i < n; ++i) {
+             const CoordSystem c(fCoords[0][i], fCoords[1][i], fCoords[2][i], fCoords[3][i]);
+             px[i] = c.Px();
+             py[i] = c.Py();
+             pz[i] = c.Pz();
+             e[i] = c.E();
+          }
+       }
+
+       /**
+          Return the sum of all the elements.
+       */
+       Element_t Sum() const
+       {
+          Column_t px, py, pz, e;
+          GetPxPyPzE(px, py, pz, e);
+          Element_t v;
+          v.SetPxPyPzE(ROOT::VecOps::Sum(px), ROOT::VecOps::Sum(py), ROOT::VecOps::Sum(pz), ROOT::VecOps::Sum(e));
+          return v;
+       }
+
+       /**
+          Build the collection from cartesian coordinates, converting them to CoordSystem.
+       */
+       static LorentzVectorCollection
+       FromPxPyPzE(const Column_t &px, const Column_t &py, const Column_t &pz, const Column_t &e)
+       {
+          const size_type n = px.size();
+          if (py.size() != n || pz.size() != n || e.size() != n)
+             throw std::runtime_error("LorentzVectorCollection: the coordinate arrays have different sizes");
+          LorentzVectorCollection result;
+          for (auto &col : result.fCoords)
+             col.resize(n);
+          Scalar coords[4];
+          for (size_type i = 0; i < n; ++i) {
+             CoordSystem c;
+             c.SetPxPyPzE(px[i], py[i], pz[i], e[i]);
+             c.GetCoordinates(coords);
+             for (unsigned int j = 0; j < 4; ++j)
+                result.fCoords[j][i] = coords[j];
+          }
+          return result;
+       }
+
+       /**
+          Element-wise sum with a collection of the same size.
+       */
+       template <class OtherCoords>
+       LorentzVectorCollection operator+(const LorentzVectorCollection<OtherCoords> &other) const
+       {
+          if (other.size() != size())
+             throw std::runtime_error("LorentzVectorCollection: cannot add collections of different sizes");
+          Column_t px1, py1, pz1, e1, px2, py2, pz2, e2;
+          GetPxPyPzE(px1, py1, pz1, e1);
+          other.GetPxPyPzE(px2, py2, pz2, e2);
+          return FromPxPyPzE(px1 + px2, py1 + py2, pz1 + pz2, e1 + e2);
+       }
+
+    private:
+
+       /// Evaluate f on the coordinates of each element.
+       template <class F>
+       Column_t Apply(F f) const
+       {
+          const size_type n = size();
+          Column_t result(n);
+          for (size_type i = 0; i < n; ++i)
+             result[i] = f(CoordSystem(fCoords[0][i], fCoords[1][i], fCoords[2][i], fCoords[3][i]));
+          return result;
+       }
+
+       std::array<Column_t, 4> fCoords; // the arrays of the four coordinates
+
+    };
+
+
+    namespace VectorUtil {
+
+       /**
+          Invariant masses of the pairs (v1[i], v2[i]) of two collections of the same size.
+       */
+       template <class CoordSystem1, class CoordSystem2>
+       inline typename LorentzVectorCollection<CoordSystem1>::Column_t
+       InvariantMass(const LorentzVectorCollection<CoordSystem1> &v1, const LorentzVectorCollection<CoordSystem2> &v2)
+       {
+          typedef typename LorentzVectorCollection<CoordSystem1>::Column_t Column_t;
+          if (v1.size() != v2.size())
+             throw std::runtime_error("InvariantMass: the collections have different sizes");
+          Column_t px1, py1, pz1, e1, px2, py2, pz2, e2;
+          v1.GetPxPyPzE(px1, py1, pz1, e1);
+          v2.GetPxPyPzE(px2, py2, pz2, e2);
+          Column_t result(v1.size());
+          for (std::size_t i = 0; i < result.size(); ++i) {
+             const auto ee = e1[i] + e2[i];
+             const auto xx = px1[i] + px2[i];
+             const auto yy = py1[i] + py2[i];
+             const auto zz = pz1[i] + pz2[i];
+             const auto mm2 = ee * ee - xx * xx - yy * yy - zz * zz;
+             using std::sqrt;
+             result[i] = mm2 < 0.0 ? -sqrt(-mm2) : sqrt(mm2);
+          }
+          return result;
+       }
+
+       /**
+          Differences in pseudorapidity and phi of the pairs (v1[i], v2[i]) of two collections
+          of the same size, \f$ \Delta R = \sqrt{ ( \Delta \phi )^2 + ( \Delta \eta )^2 } \f$.
+       */
+       template <class CoordSystem1, class CoordSystem2>
+       inline typename LorentzVectorCollection<CoordSystem1>::Column_t
+       DeltaR(const LorentzVectorCollection<CoordSystem1> &v1, const LorentzVectorCollection<CoordSystem2> &v2)
+       {
+          typedef typename LorentzVectorCollection<CoordSystem1>::Column_t Column_t;
+          if (v1.size() != v2.size())
+             throw std::runtime_error("DeltaR: the collections have different sizes");
+          const Column_t eta1 = v1.Eta(), phi1 = v1.Phi();
+          const Column_t eta2 = v2.Eta(), phi2 = v2.Phi();
+          Column_t result(v1.size());
+          for (std::size_t i = 0; i < result.size(); ++i) {
+             auto dphi = phi2[i] - phi1[i];
+             if (dphi > M_PI) {
+                dphi -= 2.0 * M_PI;
+             } else if (dphi <= -M_PI) {
+                dphi += 2.0 * M_PI;
+             }
+             const auto deta = eta2[i] - eta1[i];
+             using std::sqrt;
+             result[i] = sqrt(dphi * dphi + deta * deta);
+          }
+          return result;
+       }
+
+       /**
+          Boost all the elements of a collection by the same beta vector b, which must
+          implement X(), Y() and Z().
+       */
+       template <class CoordSystem, class BoostVector>
+       LorentzVectorCollection<CoordSystem> boost(const LorentzVectorCollection<CoordSystem> &v, const BoostVector &b)
+       {
+          typedef typename LorentzVectorCollection<CoordSystem>::Column_t Column_t;
+          double bx = b.X();
+          double by = b.Y();
+          double bz = b.Z();
+          double b2 = bx*bx + by*by + bz*bz;
+          if (b2 >= 1) {
+             GenVector::Throw ( "Beta Vector supplied to set Boost represents speed >= c");
+             return LorentzVectorCollection<CoordSystem>();
+          }
+          using std::sqrt;
+          double gamma = 1.0 / sqrt(1.0 - b2);
+          double gamma2 = b2 > 0 ? (gamma - 1.0)/b2 : 0.0;
+          Column_t x, y, z, t;
+          v.GetPxPyPzE(x, y, z, t);
+          for (std::size_t i = 0; i < x.size(); ++i) {
+             double bp = bx*x[i] + by*y[i] + bz*z[i];
+             double t2 = gamma*(t[i] + bp);
+             x[i] += gamma2*bp*bx + gamma*bx*t[i];
+             y[i] += gamma2*bp*by + gamma*by*t[i];
+             z[i] += gamma2*bp*bz + gamma*bz*t[i];
+             t[i] = t2;
+          }
+          return LorentzVectorCollection<CoordSystem>::FromPxPyPzE(x, y, z, t);
+       }
+
+    } // end namespace VectorUtil
+
+  } // end namespace Math
+
+} // end namespace ROOT
+
+#endif
@@ -0,0 +1,10 @@
+// @(#)root/mathcore:$Id$
+
+#ifndef ROOT_Math_LorentzVectorCollection
+#define ROOT_Math_LorentzVectorCollection
+
+
+#include "Math/GenVector/LorentzVectorCollection.h"
+
+
+#endif
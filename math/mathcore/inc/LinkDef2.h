@@ -174,6 +174,7 @@
 
 #pragma link C++ class ROOT::Math::DistSampler+;
 #pragma link C++ class ROOT::Math::DistSamplerOptions+;
+#pragma link C++ class ROOT::Math::CdfTableSampler+;
 #pragma link C++ class ROOT::Math::GoFTest+;
 #pragma link C++ class std::vector<std::vector<double> >+;
 
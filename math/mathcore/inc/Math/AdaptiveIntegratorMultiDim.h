@@ -18,6 +18,10 @@
 
 #include "Math/VirtualIntegrator.h"
 
+#include "ROOT/EExecutionPolicy.hxx"
+
+#include <functional>
+
 namespace ROOT {
 namespace Math {
 
@@ -55,6 +59,18 @@ The class computes in addition to the integral of the function in the desired in
       2. size is too small for the specified number MAXPTS of function evaluations.
       3. n<2 or n>15
 
+### Parallel and batch evaluation:
+
+The integrand can be evaluated on many points at once. When a region is
+divided, the rule is evaluated on the points of both halves together:
+  - with SetExecutionPolicy(ROOT::EExecutionPolicy::kMultiThread), these points
+    are shared between the threads of a ROOT::TThreadExecutor. The integrand
+    must then be thread safe.
+  - with SetBatchFunction(), the integrand is called once with all these points,
+    e.g. for an integrand using SIMD instructions.
+
+The result does not depend on these settings.
+
 ### Method:
 
 An integration rule of degree seven is used together with a certain
@@ -127,6 +143,19 @@ public:
    /// set the integration function (must implement multi-dim function interface: IBaseFunctionMultiDim)
    void SetFunction(const IMultiGenFunction &f) override;
 
+   /// Type of an integrand evaluated on many points in one call as f(npoints, x, result),
+   /// where x[i*ndim+j] is the coordinate j of the point i and result[i] receives its value.
+   using BatchFunction_t = std::function<void(unsigned int, const double *, double *)>;
+
+   /// set an integrand of dimension ndim evaluated on batches of points, replacing the one given by SetFunction()
+   void SetBatchFunction(const BatchFunction_t &f, unsigned int ndim);
+
+   /// set how the integrand is evaluated: sequentially (default) or with multiple threads (kMultiThread)
+   void SetExecutionPolicy(ROOT::EExecutionPolicy policy);
+
+   /// return how the integrand is evaluated
+   ROOT::EExecutionPolicy ExecutionPolicy() const { return fExecutionPolicy; }
+
    /// return result of integration
    double Result() const override { return fResult; }
 
@@ -177,6 +206,9 @@ protected:
    // internal function to compute the integral (if absVal is true compute abs value of function integral
    double DoIntegral(const double* xmin, const double * xmax, bool absVal = false);
 
+   // evaluate the integrand on npoints points stored point by point
+   void EvalPoints(unsigned int npoints, const double *x, double *f) const;
+
  private:
 
    unsigned int fDim;     ///< dimensionality of integrand
@@ -193,6 +225,8 @@ protected:
    int fStatus;           ///< status of algorithm (error if not zero)
 
    const IMultiGenFunction* fFun;   // pointer to integrand function
+   BatchFunction_t fBatchFun;       ///< integrand evaluated on batches of points, used instead of fFun if set
+   ROOT::EExecutionPolicy fExecutionPolicy = ROOT::EExecutionPolicy::kSequential; ///< how the integrand is evaluated
 
 };
 
@@ -0,0 +1,118 @@
+// @(#)root/mathcore:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+// Header file for class CdfTableSampler
+
+#ifndef ROOT_Math_CdfTableSampler
+#define ROOT_Math_CdfTableSampler
+
+#include <cstddef>
+#include <vector>
+
+namespace ROOT {
+namespace Math {
+
+/**
+   Sampler of a one-dimensional distribution from its cumulative distribution
+   tabulated on a set of bins, as used by TF1::GetRandom and TH1::FillRandom.
+
+   The cumulative distribution is normalized to one and inverted within each bin,
+   either linearly (the distribution is constant in the bin, as for a
+   histogram) or with a parabola matching the integral on the first half of the
+   bin (the distribution is linear in the bin, as for a TF1).
+   The bin of a uniform random number is found with a guide table (Chen and
+   Asau, 1974), in constant expected time instead of the logarithmic time of a
+   binary search.
+
+   The sampler is immutable once constructed: a single object can be shared
+   between threads, each thread using its own random number generator.
+
+   ~~~ {.cpp}
+   const ROOT::Math::CdfTableSampler sampler = f1.MakeSampler();
+   TRandom3 rng(seed);
+   std::vector<double> x(100000);
+   sampler.Sample(rng, x.size(), x.data());
+   ~~~
+
+   @ingroup MathCore
+*/
+
+class CdfTableSampler {
+
+public:
+   /// Create an invalid sampler, without bins.
+   CdfTableSampler() = default;
+
+   /// Create a sampler with linear interpolation, given the n+1 `edges` of
+   /// n bins and the integrals of the distribution in each bin. The sampler
+   /// is invalid if an integral is negative or if their sum is zero.
+   CdfTableSampler(const std::vector<double> &edges, const std::vector<double> &integrals);
+
+   /// Create a sampler with parabolic interpolation, given n equidistant bins
+   /// in [xmin,xmax], the integrals of the distribution in each bin and on the
+   /// first half of each bin. If `logX` is true, the bins are defined in
+   /// log10(x): `xmin` and `xmax` are the log10 of the range and the sampled
+   /// values are converted back to x. The sampler is invalid if an integral is
+   /// negative or if their sum is zero.
+   CdfTableSampler(unsigned int n, double xmin, double xmax, const std::vector<double> &integrals,
+                   const std::vector<double> &halfIntegrals, bool logX = false);
+
+   /// Return true if the sampler has a valid table.
+   bool IsValid() const { return !fGuide.empty(); }
+
+   /// Return the number of bins.
+   unsigned int NBins() const { return fX0.size(); }
+
+   /// Return the normalized cumulative distribution at the lower edge of bin
+   /// `i`, in [0, NBins()]: 0 for i = 0, 1 for i = NBins().
+   double Cdf(unsigned int i) const { return fCdf[i]; }
+
+   /// Return the bin containing the probability `r`, in [0, NBins()-1], as
+   /// TMath::BinarySearch on the cumulative distribution.
+   unsigned int FindBin(double r) const;
+
+   /// Return the value x whose cumulative distribution is `r`, in [0,1].
+   double Quantile(double r) const;
+
+   /// Compute the quantiles `x` of the `n` probabilities `r`. `x` can be `r`.
+   void Quantile(std::size_t n, const double *r, double *x) const;
+
+   /// Return a random number following the distribution, using the generator
+   /// `rng`, which must provide `double Rndm()`, e.g. TRandom or ROOT::Math::Random.
+   template <class RNG>
+   double Sample(RNG &rng) const
+   {
+      return Quantile(rng.Rndm());
+   }
+
+   /// Fill `x` with `n` random numbers following the distribution.
+   template <class RNG>
+   void Sample(RNG &rng, std::size_t n, double *x) const
+   {
+      for (std::size_t i = 0; i < n; ++i)
+         x[i] = rng.Rndm();
+      Quantile(n, x, x);
+   }
+
+private:
+   double Init(const std::vector<double> &integrals);
+
+   std::vector<double> fCdf;          ///< Normalized cumulative distribution at the bin edges
+   std::vector<double> fX0;           ///< Lower edge of the bins
+   std::vector<double> fBeta;         ///< Width of the bins, or linear coefficient of the parabola
+   std::vector<double> fGamma;        ///< Twice the quadratic coefficient of the parabola, empty for linear
+   std::vector<unsigned int> fGuide;  ///< Bin of the probabilities i/fGuide.size()
+   bool fLogX = false;                ///< The bins are defined in log10(x)
+};
+
+} // namespace Math
+} // namespace ROOT
+
+#endif
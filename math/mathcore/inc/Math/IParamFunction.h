@@ -21,6 +21,7 @@
 
 #include <cassert>
 #include <string>
+#include <vector>
 
 /**
    @defgroup ParamFunc Parametric Function Evaluation Interfaces.
@@ -127,6 +128,17 @@ namespace ROOT {
             return DoEval(x);
          }
 
+         /**
+         Evaluate the function at n points for given parameters p, writing the values in result.
+         The coordinates are given per component, as stored by ROOT::Fit::FitData: x[j][i] is
+         the coordinate j of point i.
+         Use the virtual function DoEvalParBatch to implement it
+         */
+         void EvalBatch(unsigned int n, const T *const *x, const double *p, T *result) const
+         {
+            DoEvalParBatch(n, x, p, result);
+         }
+
       private:
          /**
             Implementation of the evaluation function using the x values and the parameters.
@@ -134,6 +146,26 @@ namespace ROOT {
          */
          virtual T DoEvalPar(const T *x, const double *p) const = 0;
 
+         /**
+            Implementation of the evaluation of a batch of points. The default implementation
+            calls DoEvalPar for each point; re-implement it to evaluate the whole batch in one go.
+         */
+         virtual void DoEvalParBatch(unsigned int n, const T *const *x, const double *p, T *result) const
+         {
+            const unsigned int ndim = this->NDim();
+            if (ndim == 1) {
+               for (unsigned int i = 0; i < n; ++i)
+                  result[i] = DoEvalPar(x[0] + i, p);
+               return;
+            }
+            std::vector<T> point(ndim);
+            for (unsigned int i = 0; i < n; ++i) {
+               for (unsigned int j = 0; j < ndim; ++j)
+                  point[j] = x[j][i];
+               result[i] = DoEvalPar(point.data(), p);
+            }
+         }
+
          /**
             Implement the ROOT::Math::IBaseFunctionMultiDim interface DoEval(x) using the cached parameter values
          */
@@ -94,6 +94,17 @@ time \f$t\f$, which is normalised to 1. Clearly \f$\tau_0~ < t ~< \tau\f$.
 Chaos, Solitons & Fractals, Volume 91, (2016) pp. 33–38
 http://dx.doi.org/10.1016/j.chaos.2016.05.003
 
+#### Independent streams
+
+The seed is used by MIXMAX to skip ahead, with the `seed_uniquestream` function,
+to a state determined by four 32 bit identifiers: SetSeed(seed) uses
+the two halves of the seed as the last two identifiers. For parallel applications,
+SetSeed(seed, stream) uses also `stream` as the second identifier; the sequences
+obtained for different pairs of seed and stream are then separated by the
+MIXMAX skipping, and SetSeed(seed, 0) is the same as SetSeed(seed). To obtain
+results independent of the number of threads, derive the stream from the index
+of the task rather than from the thread executing it.
+
 
 @ingroup Random
 */
@@ -131,6 +142,9 @@ http://dx.doi.org/10.1016/j.chaos.2016.05.003
          /// set the generator seed
          void  SetSeed(Result_t seed);
 
+         /// set the generator seed and select the independent stream `stream`
+         void  SetSeed(Result_t seed, uint32_t stream);
+
          // generate a random number (virtual interface)
          double Rndm() override { return Rndm_impl(); }
 
@@ -32,6 +32,7 @@ private:
 
 public:
    RanluxppEngine(uint64_t seed = 314159265);
+   RanluxppEngine(uint64_t seed, uint32_t stream);
    ~RanluxppEngine() override;
 
    /// Generate a double-precision random number with 48 bits of randomness
@@ -40,9 +41,13 @@ public:
    double operator()();
    /// Generate a random integer value with 48 bits
    uint64_t IntRndm();
+   /// Generate an array of `n` random numbers, the same as calling Rndm() `n` times
+   void RndmArray(int n, double *array);
 
    /// Initialize and seed the state of the generator
    void SetSeed(uint64_t seed);
+   /// Initialize and seed the state of the generator, starting the independent stream `stream`
+   void SetSeed(uint64_t seed, uint32_t stream);
    /// Skip `n` random numbers without generating them
    void Skip(uint64_t n);
 
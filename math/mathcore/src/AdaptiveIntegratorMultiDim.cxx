@@ -8,6 +8,11 @@
 
 #include <cmath>
 #include <algorithm>
+#include <vector>
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
 
 namespace ROOT {
 namespace Math {
@@ -65,6 +70,31 @@ void AdaptiveIntegratorMultiDim::SetFunction(const IMultiGenFunction &f)
    // set the integration function
    fFun = &f;
    fDim = f.NDim();
+   fBatchFun = nullptr;
+}
+
+void AdaptiveIntegratorMultiDim::SetBatchFunction(const BatchFunction_t &f, unsigned int ndim)
+{
+   // set the integration function evaluated on batches of points
+   fBatchFun = f;
+   fFun = nullptr;
+   fDim = ndim;
+}
+
+void AdaptiveIntegratorMultiDim::SetExecutionPolicy(ROOT::EExecutionPolicy policy)
+{
+   // set the execution policy used to evaluate the integrand
+   if (policy == ROOT::EExecutionPolicy::kMultiProcess) {
+      MATH_WARN_MSG("AdaptiveIntegratorMultiDim::SetExecutionPolicy","multi-process evaluation is not supported, use sequential evaluation");
+      policy = ROOT::EExecutionPolicy::kSequential;
+   }
+#ifndef R__USE_IMT
+   if (policy == ROOT::EExecutionPolicy::kMultiThread) {
+      MATH_WARN_MSG("AdaptiveIntegratorMultiDim::SetExecutionPolicy","ROOT was built without multi-threading support, use sequential evaluation");
+      policy = ROOT::EExecutionPolicy::kSequential;
+   }
+#endif
+   fExecutionPolicy = policy;
 }
 
 void AdaptiveIntegratorMultiDim::SetRelTolerance(double relTol){ this->fRelTol = relTol; }
@@ -73,6 +103,187 @@ void AdaptiveIntegratorMultiDim::SetRelTolerance(double relTol){ this->fRelTol =
 void AdaptiveIntegratorMultiDim::SetAbsTolerance(double absTol){ this->fAbsTol = absTol; }
 
 
+namespace {
+
+// abscissas and weights of the integration rule of degree seven
+const double xl2 = 0.358568582800318073;//lambda_2
+const double xl4 = 0.948683298050513796;//lambda_4
+const double xl5 = 0.688247201611685289;//lambda_5
+const double w2  = 980./6561; //weights/2^n
+const double w4  = 200./19683;
+const double wp2 = 245./486;//error weights/2^n
+const double wp4 = 25./729;
+
+const double wn1[14] = {     -0.193872885230909911, -0.555606360818980835,
+                             -0.876695625666819078, -1.15714067977442459,  -1.39694152314179743,
+                             -1.59609815576893754,  -1.75461057765584494,  -1.87247878880251983,
+                             -1.94970278920896201,  -1.98628257887517146,  -1.98221815780114818,
+                             -1.93750952598689219,  -1.85215668343240347,  -1.72615963013768225};
+
+const double wn3[14] = {     0.0518213686937966768,  0.0314992633236803330,
+                             0.0111771579535639891,-0.00914494741655235473,-0.0294670527866686986,
+                             -0.0497891581567850424,-0.0701112635269013768, -0.0904333688970177241,
+                             -0.110755474267134071, -0.131077579637250419,  -0.151399685007366752,
+                             -0.171721790377483099, -0.192043895747599447,  -0.212366001117715794};
+
+const double wn5[14] = {         0.871183254585174982e-01,  0.435591627292587508e-01,
+                                 0.217795813646293754e-01,  0.108897906823146873e-01,  0.544489534115734364e-02,
+                                 0.272244767057867193e-02,  0.136122383528933596e-02,  0.680611917644667955e-03,
+                                 0.340305958822333977e-03,  0.170152979411166995e-03,  0.850764897055834977e-04,
+                                 0.425382448527917472e-04,  0.212691224263958736e-04,  0.106345612131979372e-04};
+
+const double wpn1[14] = {   -1.33196159122085045, -2.29218106995884763,
+                            -3.11522633744855959, -3.80109739368998611, -4.34979423868312742,
+                            -4.76131687242798352, -5.03566529492455417, -5.17283950617283939,
+                            -5.17283950617283939, -5.03566529492455417, -4.76131687242798352,
+                            -4.34979423868312742, -3.80109739368998611, -3.11522633744855959};
+
+const double wpn3[14] = {     0.0445816186556927292, -0.0240054869684499309,
+                              -0.0925925925925925875, -0.161179698216735251,  -0.229766803840877915,
+                              -0.298353909465020564,  -0.366941015089163228,  -0.435528120713305891,
+                              -0.504115226337448555,  -0.572702331961591218,  -0.641289437585733882,
+                              -0.709876543209876532,  -0.778463648834019195,  -0.847050754458161859};
+
+/// result of the integration rule over a region
+struct RRegionRule {
+   double fValue = 0;         ///< estimate of the integral over the region
+   double fError = 0;         ///< estimate of its error
+   unsigned int fDivAxis = 0; ///< axis (starting at 1) along which the region should be divided
+   bool fAllZero = false;     ///< true if the integrand vanishes on all the points of the rule
+};
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write the 2^n + 2n(n+1) + 1 points of the integration rule of the region
+/// of center ctr and half widths wth to x, point by point, in the order
+/// expected by ApplyRule().
+
+void RulePoints(unsigned int n, const double *ctr, const double *wth, double *x)
+{
+   double z[15];
+   unsigned int j, j1, k;
+   auto add = [&]() {
+      std::copy(z, z + n, x);
+      x += n;
+   };
+
+   // center
+   for (j=0; j<n; j++) z[j] = ctr[j];
+   add();
+
+   // points on the axes
+   for (j=0; j<n; j++) {
+      z[j] = ctr[j] - xl2*wth[j]; add();
+      z[j] = ctr[j] + xl2*wth[j]; add();
+      z[j] = ctr[j] - xl4*wth[j]; add();
+      z[j] = ctr[j] + xl4*wth[j]; add();
+      z[j] = ctr[j];
+   }
+
+   // points on the planes of two axes
+   for (j=1; j<n; j++) {
+      j1 = j-1;
+      for (k=j; k<n; k++) {
+         for (double s1 : {-1., 1.}) {
+            z[j1] = ctr[j1] + s1*xl4*wth[j1];
+            for (double s2 : {-1., 1.}) {
+               z[k] = ctr[k] + s2*xl4*wth[k];
+               add();
+            }
+         }
+         z[k] = ctr[k];
+      }
+      z[j1] = ctr[j1];
+   }
+
+   // end nodes, the bit j of ivert giving the side along the axis j
+   for (unsigned int ivert = 0; ivert < (1u << n); ivert++) {
+      for (j=0; j<n; j++)
+         z[j] = ctr[j] + ((ivert >> j) & 1 ? xl5*wth[j] : -xl5*wth[j]);
+      add();
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Combine the values f of the integrand at the points given by RulePoints()
+/// into the estimates of the integral over the region of half widths wth and
+/// of its error.
+
+RRegionRule ApplyRule(unsigned int n, const double *wth, const double *f, bool absValue)
+{
+   auto value = [&](unsigned int i) { return absValue ? std::abs(f[i]) : f[i]; };
+   unsigned int i = 0;
+   unsigned int j;
+
+   double rgnvol = std::pow(2.0,static_cast<int>(n));//=2^n
+   for (j=0; j<n; j++)
+      rgnvol *= wth[j]; //region volume
+
+   const double sum1 = f[i++];
+
+   double difmax = 0;
+   double sum2 = 0;
+   double sum3 = 0;
+   unsigned int idvaxn = 0;
+   for (j=0; j<n; j++) {
+      const double f2 = value(i) + value(i+1);
+      const double f3 = value(i+2) + value(i+3);
+      i += 4;
+      sum2   += f2;//sum func eval with different weights separately
+      sum3   += f3;//for a given region
+      const double dif = std::abs(7*f2-f3-12*sum1);
+      //storing dimension with biggest error/difference (?)
+      if (dif >= difmax) {
+         difmax=dif;
+         idvaxn=j+1;
+      }
+   }
+
+   double sum4 = 0;
+   for (const unsigned int end = i + 2*n*(n-1); i < end; i++)
+      sum4 += value(i);
+
+   double sum5 = 0; //sum over end nodes
+   for (const unsigned int end = i + (1u << n); i < end; i++)
+      sum5 += value(i);
+
+   const double rgncmp = rgnvol*(wpn1[n-2]*sum1+wp2*sum2+wpn3[n-2]*sum3+wp4*sum4);
+   double rgnval = wn1[n-2]*sum1+w2*sum2+wn3[n-2]*sum3+w4*sum4+wn5[n-2]*sum5;
+   rgnval *= rgnvol;
+
+   RRegionRule rule;
+   rule.fValue = rgnval;
+   rule.fError = std::abs(rgnval-rgncmp);//compares estim error with expected error
+   rule.fDivAxis = idvaxn;
+   rule.fAllZero = (sum1==0 && sum2==0 && sum3==0 && sum4==0 && sum5==0);
+   return rule;
+}
+
+} // anonymous namespace
+
+void AdaptiveIntegratorMultiDim::EvalPoints(unsigned int npoints, const double *x, double *f) const
+{
+   // evaluate the integrand on npoints points stored point by point in x
+   const unsigned int n = fDim;
+   auto evalRange = [&](unsigned int first, unsigned int last) {
+      if (fBatchFun)
+         fBatchFun(last - first, x + first*n, f + first);
+      else
+         for (unsigned int i = first; i < last; i++)
+            f[i] = (*fFun)(x + i*n);
+   };
+#ifdef R__USE_IMT
+   if (fExecutionPolicy == ROOT::EExecutionPolicy::kMultiThread && npoints > 1) {
+      ROOT::TThreadExecutor pool;
+      const unsigned int nchunks = std::min(npoints, 2 * pool.GetPoolSize());
+      const unsigned int step = (npoints + nchunks - 1) / nchunks;
+      pool.Foreach([&](unsigned int first) { evalRange(first, std::min(first + step, npoints)); },
+                   ROOT::TSeqU(0, npoints, step));
+      return;
+   }
+#endif
+   evalRange(0, npoints);
+}
+
 double AdaptiveIntegratorMultiDim::DoIntegral(const double* xmin, const double * xmax, bool absValue)
 {
    // References:
@@ -96,45 +307,7 @@ double AdaptiveIntegratorMultiDim::DoIntegral(const double* xmin, const double *
    double relerr; //an estimation of the relative accuracy of the result
 
 
-   double ctr[15], wth[15], wthl[15], z[15];
-
-   static const double xl2 = 0.358568582800318073;//lambda_2
-   static const double xl4 = 0.948683298050513796;//lambda_4
-   static const double xl5 = 0.688247201611685289;//lambda_5
-   static const double w2  = 980./6561; //weights/2^n
-   static const double w4  = 200./19683;
-   static const double wp2 = 245./486;//error weights/2^n
-   static const double wp4 = 25./729;
-
-   static const double wn1[14] = {     -0.193872885230909911, -0.555606360818980835,
-                                       -0.876695625666819078, -1.15714067977442459,  -1.39694152314179743,
-                                       -1.59609815576893754,  -1.75461057765584494,  -1.87247878880251983,
-                                       -1.94970278920896201,  -1.98628257887517146,  -1.98221815780114818,
-                                       -1.93750952598689219,  -1.85215668343240347,  -1.72615963013768225};
-
-   static const double wn3[14] = {     0.0518213686937966768,  0.0314992633236803330,
-                                       0.0111771579535639891,-0.00914494741655235473,-0.0294670527866686986,
-                                       -0.0497891581567850424,-0.0701112635269013768, -0.0904333688970177241,
-                                       -0.110755474267134071, -0.131077579637250419,  -0.151399685007366752,
-                                       -0.171721790377483099, -0.192043895747599447,  -0.212366001117715794};
-
-   static const double wn5[14] = {         0.871183254585174982e-01,  0.435591627292587508e-01,
-                                           0.217795813646293754e-01,  0.108897906823146873e-01,  0.544489534115734364e-02,
-                                           0.272244767057867193e-02,  0.136122383528933596e-02,  0.680611917644667955e-03,
-                                           0.340305958822333977e-03,  0.170152979411166995e-03,  0.850764897055834977e-04,
-                                           0.425382448527917472e-04,  0.212691224263958736e-04,  0.106345612131979372e-04};
-
-   static const double wpn1[14] = {   -1.33196159122085045, -2.29218106995884763,
-                                      -3.11522633744855959, -3.80109739368998611, -4.34979423868312742,
-                                      -4.76131687242798352, -5.03566529492455417, -5.17283950617283939,
-                                      -5.17283950617283939, -5.03566529492455417, -4.76131687242798352,
-                                      -4.34979423868312742, -3.80109739368998611, -3.11522633744855959};
-
-   static const double wpn3[14] = {     0.0445816186556927292, -0.0240054869684499309,
-                                        -0.0925925925925925875, -0.161179698216735251,  -0.229766803840877915,
-                                        -0.298353909465020564,  -0.366941015089163228,  -0.435528120713305891,
-                                        -0.504115226337448555,  -0.572702331961591218,  -0.641289437585733882,
-                                        -0.709876543209876532,  -0.778463648834019195,  -0.847050754458161859};
+   double ctr[15], wth[15];
 
    double result = 0;
    double abserr = 0;
@@ -177,92 +350,29 @@ double AdaptiveIntegratorMultiDim::DoIntegral(const double* xmin, const double *
       wth[j] = (xmax[j] - xmin[j])*0.5;//its width
    }
 
-   double rgnvol, sum1, sum2, sum3, sum4, sum5, difmax, f2, f3, dif, aresult;
-   double rgncmp=0, rgnval, rgnerr;
-
-   unsigned int j1, k, l, m, idvaxn=0, idvax0=0, isbtmp, isbtpp;
-
-   //InitArgs(z,fParams);
-
-L20:
-   rgnvol = twondm;//=2^n
-   for (j=0; j<n; j++) {
-      rgnvol *= wth[j]; //region volume
-      z[j]    = ctr[j]; //temporary node
-   }
-   sum1 = (*fFun)((const double*)z);//EvalPar(z,fParams); //evaluate function
-
-   difmax = 0;
-   sum2   = 0;
-   sum3   = 0;
-
-   //loop over coordinates
-   for (j=0; j<n; j++) {
-      z[j]    = ctr[j] - xl2*wth[j];
-      if (absValue) f2 = std::abs((*fFun)(z));
-      else          f2 = (*fFun)(z);
-      z[j]    = ctr[j] + xl2*wth[j];
-      if (absValue) f2 += std::abs((*fFun)(z));
-      else          f2 += (*fFun)(z);
-      wthl[j] = xl4*wth[j];
-      z[j]    = ctr[j] - wthl[j];
-      if (absValue) f3 = std::abs((*fFun)(z));
-      else          f3 = (*fFun)(z);
-      z[j]    = ctr[j] + wthl[j];
-      if (absValue) f3 += std::abs((*fFun)(z));
-      else          f3 += (*fFun)(z);
-      sum2   += f2;//sum func eval with different weights separately
-      sum3   += f3;//for a given region
-      dif     = std::abs(7*f2-f3-12*sum1);
-      //storing dimension with biggest error/difference (?)
-      if (dif >= difmax) {
-         difmax=dif;
-         idvaxn=j+1;
-      }
-      z[j]    = ctr[j];
-   }
+   double rgnval, rgnerr, aresult;
+   bool allZero;
 
-   sum4 = 0;
-   for (j=1;j<n;j++) {
-      j1 = j-1;
-      for (k=j;k<n;k++) {
-         for (l=0;l<2;l++) {
-            wthl[j1] = -wthl[j1];
-            z[j1]    = ctr[j1] + wthl[j1];
-            for (m=0;m<2;m++) {
-               wthl[k] = -wthl[k];
-               z[k]    = ctr[k] + wthl[k];
-               if (absValue) sum4 += std::abs((*fFun)(z));
-               else            sum4 += (*fFun)(z);
-            }
-         }
-         z[k] = ctr[k];
-      }
-      z[j1] = ctr[j1];
-   }
+   unsigned int k, idvaxn=0, idvax0=0, isbtmp, isbtpp;
 
-   sum5 = 0;
+   // The integrand is evaluated on all the points of the rule of a region at
+   // once. The two halves of a divided region are evaluated together and are
+   // then processed in turn, in the same order as in the original algorithm.
+   std::vector<double> points(2*irlcls*n);
+   std::vector<double> values(2*irlcls);
+   RRegionRule rules[2];
+   unsigned int irule = 0;
 
-   for (j=0;j<n;j++) {
-      wthl[j] = -xl5*wth[j];
-      z[j] = ctr[j] + wthl[j];
-   }
-L90: //sum over end nodes ~gray codes
-   if (absValue) sum5 += std::abs((*fFun)(z));
-   else          sum5 += (*fFun)(z);
-   for (j=0;j<n;j++) {
-      wthl[j] = -wthl[j];
-      z[j] = ctr[j] + wthl[j];
-      if (wthl[j] > 0) goto L90;
-   }
+   RulePoints(n, ctr, wth, points.data());
+   EvalPoints(irlcls, points.data(), values.data());
+   rules[0] = ApplyRule(n, wth, values.data(), absValue);
 
-   rgncmp  = rgnvol*(wpn1[n-2]*sum1+wp2*sum2+wpn3[n-2]*sum3+wp4*sum4);
-   rgnval  = wn1[n-2]*sum1+w2*sum2+wn3[n-2]*sum3+w4*sum4+wn5[n-2]*sum5;
-   rgnval *= rgnvol;
-   // avoid difference of too small numbers
-   //rgnval = 1.0E-30;
-   //rgnerr  = TMath::Max( std::abs(rgnval-rgncmp), TMath::Max(std::abs(rgncmp), std::abs(rgnval) )*4.0E-16 );
-   rgnerr  = std::abs(rgnval-rgncmp);//compares estim error with expected error
+L20:
+   rgnval  = rules[irule].fValue;
+   rgnerr  = rules[irule].fError;
+   idvaxn  = rules[irule].fDivAxis;
+   allZero = rules[irule].fAllZero;
+   irule++;
 
    result += rgnval;
    abserr += rgnerr;
@@ -326,7 +436,7 @@ L160: //to divide or not
    if (relerr < 1e-5 && aresult < 1e-5)  fStatus = 0;
    if (isbrgs+irgnst > iwk) fStatus = 2;
    if (ifncls+2*irlcls > maxpts) {
-      if (sum1==0 && sum2==0 && sum3==0 && sum4==0 && sum5==0){
+      if (allZero){
          fStatus = 0;
          result = 0;
       }
@@ -369,6 +479,16 @@ L160: //to divide or not
       }
       wth[idvax0-1]  = 0.5*wth[idvax0-1];
       ctr[idvax0-1] -= wth[idvax0-1];
+      // the second half, processed after the first one
+      double ctr2[15];
+      std::copy(ctr, ctr+n, ctr2);
+      ctr2[idvax0-1] += 2*wth[idvax0-1];
+      RulePoints(n, ctr, wth, points.data());
+      RulePoints(n, ctr2, wth, points.data() + irlcls*n);
+      EvalPoints(2*irlcls, points.data(), values.data());
+      rules[0] = ApplyRule(n, wth, values.data(), absValue);
+      rules[1] = ApplyRule(n, wth, values.data() + irlcls, absValue);
+      irule = 0;
       goto L20;
    }
    nfnevl = ifncls;       //number of function evaluations performed.
@@ -386,7 +506,7 @@ L160: //to divide or not
 double AdaptiveIntegratorMultiDim::Integral(const IMultiGenFunction &f, const double* xmin, const double * xmax)
 {
    // calculate integral passing a function object
-   fFun = &f;
+   SetFunction(f);
    return Integral(xmin, xmax);
 
 }
@@ -0,0 +1,138 @@
+// @(#)root/mathcore:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+// Implementation file for class CdfTableSampler
+
+#include "Math/CdfTableSampler.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace ROOT {
+namespace Math {
+
+////////////////////////////////////////////////////////////////////////////////
+CdfTableSampler::CdfTableSampler(const std::vector<double> &edges, const std::vector<double> &integrals)
+{
+   const unsigned int n = integrals.size();
+   if (n == 0 || edges.size() != n + 1)
+      return;
+   fX0.assign(edges.begin(), edges.end() - 1);
+   fBeta.resize(n);
+   for (unsigned int i = 0; i < n; ++i)
+      fBeta[i] = edges[i + 1] - edges[i];
+   Init(integrals);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+CdfTableSampler::CdfTableSampler(unsigned int n, double xmin, double xmax, const std::vector<double> &integrals,
+                                 const std::vector<double> &halfIntegrals, bool logX)
+   : fLogX(logX)
+{
+   if (n == 0 || integrals.size() != n || halfIntegrals.size() != n)
+      return;
+   const double dx = (xmax - xmin) / n;
+   fX0.resize(n);
+   for (unsigned int i = 0; i < n; ++i)
+      fX0[i] = xmin + i * dx;
+   const double total = Init(integrals);
+   if (!IsValid())
+      return;
+
+   // the integral r for each bin is approximated by a parabola
+   //  x = x0 + beta*r + gamma*r**2
+   fBeta.resize(n);
+   fGamma.resize(n);
+   for (unsigned int i = 0; i < n; ++i) {
+      const double r2 = fCdf[i + 1] - fCdf[i];
+      const double r1 = halfIntegrals[i] / total;
+      const double r3 = 2 * r2 - 4 * r1;
+      fGamma[i] = (std::abs(r3) > 1e-8) ? r3 / (dx * dx) : 0;
+      fBeta[i] = r2 / dx - fGamma[i] * dx;
+      fGamma[i] *= 2;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Build the normalized cumulative distribution and the guide table, and
+/// return the sum of the integrals. The guide table stays empty, making the
+/// sampler invalid, if the integrals cannot be normalized.
+
+double CdfTableSampler::Init(const std::vector<double> &integrals)
+{
+   const unsigned int n = integrals.size();
+   fCdf.resize(n + 1);
+   fCdf[0] = 0;
+   for (unsigned int i = 0; i < n; ++i) {
+      if (!(integrals[i] >= 0))
+         return 0;
+      fCdf[i + 1] = fCdf[i] + integrals[i];
+   }
+   const double total = fCdf[n];
+   if (!(total > 0) || !std::isfinite(total))
+      return 0;
+   for (unsigned int i = 1; i <= n; ++i)
+      fCdf[i] /= total;
+
+   // same bin as TMath::BinarySearch(n, fCdf, p) for the probabilities p = g/n
+   fGuide.resize(n);
+   for (unsigned int g = 0; g < n; ++g) {
+      const double p = double(g) / n;
+      unsigned int i = std::lower_bound(fCdf.begin(), fCdf.begin() + n, p) - fCdf.begin();
+      if (i == n || fCdf[i] != p)
+         --i;
+      fGuide[g] = i;
+   }
+   return total;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+unsigned int CdfTableSampler::FindBin(double r) const
+{
+   const unsigned int n = fGuide.size();
+   unsigned int g = (r > 0) ? static_cast<unsigned int>(r * n) : 0;
+   if (g >= n)
+      g = n - 1;
+   unsigned int i = fGuide[g];
+   while (i + 1 < n && fCdf[i + 1] < r)
+      ++i;
+   // on a tie, TMath::BinarySearch returns the first bin starting at r
+   if (fCdf[i] != r && i + 1 < n && fCdf[i + 1] == r)
+      ++i;
+   return i;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+double CdfTableSampler::Quantile(double r) const
+{
+   const unsigned int bin = FindBin(r);
+   const double rr = r - fCdf[bin];
+   double x = fX0[bin];
+   if (fGamma.empty()) {
+      if (rr > 0)
+         x += fBeta[bin] * rr / (fCdf[bin + 1] - fCdf[bin]);
+      return x;
+   }
+   if (fGamma[bin] != 0)
+      x += (-fBeta[bin] + std::sqrt(fBeta[bin] * fBeta[bin] + 2 * fGamma[bin] * rr)) / fGamma[bin];
+   else
+      x += rr / fBeta[bin];
+   return fLogX ? std::pow(10., x) : x;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+void CdfTableSampler::Quantile(std::size_t n, const double *r, double *x) const
+{
+   for (std::size_t i = 0; i < n; ++i)
+      x[i] = Quantile(r[i]);
+}
+
+} // namespace Math
+} // namespace ROOT
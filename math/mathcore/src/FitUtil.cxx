@@ -980,30 +980,9 @@ double FitUtil::EvaluateLogL(const IModelFunction &func, const UnBinData &data,
 
          // needed to compute effective global weight in case of extended likelihood
 
-         auto mapFunction = [&](const unsigned i) {
+         auto pointFunction = [&](const unsigned i, double fval) {
             double W = 0;
             double W2 = 0;
-            double fval = 0;
-
-            if (data.NDim() > 1) {
-               std::vector<double> x(data.NDim());
-               for (unsigned int j = 0; j < data.NDim(); ++j)
-                  x[j] = *data.GetCoordComponent(i, j);
-#ifdef USE_PARAMCACHE
-               fval = func(x.data());
-#else
-               fval = func(x.data(), p);
-#endif
-
-               // one -dim case
-            } else {
-               const auto x = data.GetCoordComponent(i, 0);
-#ifdef USE_PARAMCACHE
-               fval = func(x);
-#else
-               fval = func(x, p);
-#endif
-            }
 
             if (normalizeFunc)
                fval = fval * (1 / norm);
@@ -1025,6 +1004,32 @@ double FitUtil::EvaluateLogL(const IModelFunction &func, const UnBinData &data,
             return LikelihoodAux<double>(logval, W, W2);
          };
 
+         // the model function is evaluated on batches of points, read directly from the
+         // coordinate columns of the data, to amortize the call overhead and let the
+         // function vectorize its evaluation
+         constexpr unsigned int kBatchSize = 256;
+         const unsigned int nBatches = (n + kBatchSize - 1) / kBatchSize;
+#ifdef USE_PARAMCACHE
+         const double *batchParams = func.Parameters();
+#else
+         const double *batchParams = p;
+#endif
+
+         auto mapFunction = [&](const unsigned ibatch) {
+            const unsigned int begin = ibatch * kBatchSize;
+            const unsigned int nbatch = std::min(kBatchSize, n - begin);
+            std::vector<const double *> x(data.NDim());
+            for (unsigned int j = 0; j < data.NDim(); ++j)
+               x[j] = data.GetCoordComponent(begin, j);
+            double fval[kBatchSize];
+            func.EvalBatch(nbatch, x.data(), batchParams, fval);
+
+            auto res = LikelihoodAux<double>(0.0, 0.0, 0.0);
+            for (unsigned int i = 0; i < nbatch; ++i)
+               res = res + pointFunction(begin + i, fval[i]);
+            return res;
+         };
+
 #ifdef R__USE_IMT
   // auto redFunction = [](const std::vector<LikelihoodAux<double>> & objs){
   //          return std::accumulate(objs.begin(), objs.end(), LikelihoodAux<double>(0.0,0.0,0.0),
@@ -1055,8 +1060,8 @@ double FitUtil::EvaluateLogL(const IModelFunction &func, const UnBinData &data,
   double sumW{};
   double sumW2{};
   if(executionPolicy == ROOT::EExecutionPolicy::kSequential){
-    for (unsigned int i=0; i<n; ++i) {
-      auto resArray = mapFunction(i);
+    for (unsigned int ibatch=0; ibatch<nBatches; ++ibatch) {
+      auto resArray = mapFunction(ibatch);
       logl+=resArray.logvalue;
       sumW+=resArray.weight;
       sumW2+=resArray.weight2;
@@ -1065,7 +1070,8 @@ double FitUtil::EvaluateLogL(const IModelFunction &func, const UnBinData &data,
   } else if(executionPolicy == ROOT::EExecutionPolicy::kMultiThread) {
     ROOT::TThreadExecutor pool;
     auto chunks = nChunks !=0? nChunks: setAutomaticChunking(data.Size());
-    auto resArray = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, n), redFunction, chunks);
+    chunks = std::max(1u, std::min(chunks, nBatches));
+    auto resArray = pool.MapReduce(mapFunction, ROOT::TSeq<unsigned>(0, nBatches), redFunction, chunks);
     logl=resArray.logvalue;
     sumW=resArray.weight;
     sumW2=resArray.weight2;
@@ -34,6 +34,22 @@ implementation draws 48 random bits for each generated floating point number
 (instead of 52 bits as in the original generator) to maintain the theoretical
 properties from understanding the original transition function of RANLUX as a
 chaotic dynamical system.
+
+Each seed selects a sequence starting \f$ 2^{96} \f$ states after the one of the
+previous seed. For parallel applications, SetSeed(seed, stream) and the matching
+constructor further split the sequence of a seed into \f$ 2^{32} \f$ streams of
+\f$ 2^{64} \f$ states each, so that the streams of all seeds never overlap. To
+obtain results independent of the number of threads, derive the stream from the
+index of the task rather than from the thread executing it:
+~~~{.cpp}
+ROOT::TThreadExecutor pool;
+auto results = pool.Map([](unsigned int task) {
+   ROOT::Math::RanluxppEngine2048 rng(seed, task);
+   std::vector<double> x(n);
+   rng.RndmArray(n, x.data());
+   return RunToy(x);
+}, ROOT::TSeqU(nTasks));
+~~~
 */
 
 #include "Math/RanluxppEngine.h"
@@ -213,6 +229,53 @@ public:
       return bits * div;
    }
 
+   /// Fill `array` with the next `n` floating point numbers, the same as calling
+   /// NextRandomFloat() `n` times
+   void NextRandomFloats(int n, double *array)
+   {
+      static constexpr double div = 1.0 / (uint64_t(1) << w);
+      static constexpr uint64_t mask = (uint64_t(1) << w) - 1;
+      static constexpr int nPerState = kMaxPos / w;
+      while (n > 0) {
+         if (fPosition + w > kMaxPos) {
+            Advance();
+         }
+         if (w == 48 && kMaxPos == 576 && fPosition == 0 && n >= nPerState) {
+            // Whole block: every three words of the state hold four numbers.
+            for (int i = 0; i < 3; i++) {
+               const uint64_t s0 = fState[3 * i], s1 = fState[3 * i + 1], s2 = fState[3 * i + 2];
+               array[4 * i + 0] = (s0 & mask) * div;
+               array[4 * i + 1] = (((s0 >> 48) | (s1 << 16)) & mask) * div;
+               array[4 * i + 2] = (((s1 >> 32) | (s2 << 32)) & mask) * div;
+               array[4 * i + 3] = (s2 >> 16) * div;
+            }
+            fPosition = kMaxPos;
+            array += nPerState;
+            n -= nPerState;
+            continue;
+         }
+         // Numbers left in the current block, which need no check for a new block.
+         int count = (kMaxPos - fPosition) / w;
+         if (count > n) {
+            count = n;
+         }
+         for (int i = 0; i < count; i++) {
+            int idx = fPosition / 64;
+            int offset = fPosition % 64;
+            int numBits = 64 - offset;
+
+            uint64_t bits = fState[idx] >> offset;
+            if (numBits < w) {
+               bits |= fState[idx + 1] << numBits;
+            }
+            array[i] = (bits & mask) * div;
+            fPosition += w;
+         }
+         array += count;
+         n -= count;
+      }
+   }
+
    /// Initialize and seed the state of the generator as in James' implementation
    void SetSeedJames(uint64_t s)
    {
@@ -310,6 +373,28 @@ public:
       fPosition = 0;
    }
 
+   /// Initialize and seed the state of the generator as proposed by Sibidanov, and
+   /// jump to the start of the given stream, 2 ** 64 states after the previous one
+   void SetSeedSibidanov(uint64_t s, uint32_t stream)
+   {
+      SetSeedSibidanov(s);
+      if (stream == 0) {
+         return;
+      }
+
+      uint64_t a_stream[9];
+      // Skip 2 ** 64 states for each stream.
+      powermod(kA, a_stream, uint64_t(1) << 32);
+      powermod(a_stream, a_stream, uint64_t(1) << 32);
+      powermod(a_stream, a_stream, stream);
+
+      uint64_t lcg[9];
+      to_lcg(fState, fCarry, lcg);
+      mulmod(a_stream, lcg);
+      to_ranlux(lcg, fState, fCarry);
+      fPosition = 0;
+   }
+
    /// Initialize and seed the state of the generator as described by the C++ standard
    void SetSeedStd24(uint64_t s)
    {
@@ -404,6 +489,12 @@ RanluxppEngine<p>::RanluxppEngine(uint64_t seed) : fImpl(new ImplType)
    this->SetSeed(seed);
 }
 
+template <int p>
+RanluxppEngine<p>::RanluxppEngine(uint64_t seed, uint32_t stream) : fImpl(new ImplType)
+{
+   this->SetSeed(seed, stream);
+}
+
 template <int p>
 RanluxppEngine<p>::~RanluxppEngine() = default;
 
@@ -431,6 +522,18 @@ void RanluxppEngine<p>::SetSeed(uint64_t seed)
    fImpl->SetSeedSibidanov(seed);
 }
 
+template <int p>
+void RanluxppEngine<p>::SetSeed(uint64_t seed, uint32_t stream)
+{
+   fImpl->SetSeedSibidanov(seed, stream);
+}
+
+template <int p>
+void RanluxppEngine<p>::RndmArray(int n, double *array)
+{
+   fImpl->NextRandomFloats(n, array);
+}
+
 template <int p>
 void RanluxppEngine<p>::Skip(uint64_t n)
 {
@@ -16,6 +16,11 @@
 #include <string.h>
 #include <limits>
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
+
 templateClassImp(TKDTree);
 
 
@@ -449,76 +454,107 @@ void TKDTree<Index, Value>::Build()
    //
    //
    //4.
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && fNPoints > 64 * (Index)fBucketSize) {
+      BuildParallel();
+      return;
+   }
+#endif
+   BuildSubtree(0, 0, 0, fNPoints);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Split the points of the non-terminal node cnode, of row crow, which occupy
+/// fIndPoints[cpos, cpos+npoints), along the axis with the biggest spread.
+/// Returns the number of points that go to the left and right daughters.
+/// See class description, section 4b for the details of the division algorithm.
+
+template <typename  Index, typename Value>
+void TKDTree<Index, Value>::SplitNode(Int_t cnode, Int_t crow, Int_t cpos, Int_t npoints, Int_t &nleft, Int_t &nright)
+{
+   // divide points
+   Int_t nbuckets0 = npoints/fBucketSize;           //current number of  buckets
+   if (npoints%fBucketSize) nbuckets0++;            //
+   Int_t restRows = fRowT0-crow;                    // rest of fully occupied node row
+   if (restRows<0) restRows =0;
+   for (;nbuckets0>(2<<restRows); restRows++) {}
+   Int_t nfull = 1<<restRows;
+   Int_t nrest = nbuckets0-nfull;
+   nleft =0; nright =0;
+   //
+   if (nrest>(nfull/2)){
+      nleft  = nfull*fBucketSize;
+      nright = npoints-nleft;
+   }else{
+      nright = nfull*fBucketSize/2;
+      nleft  = npoints-nright;
+   }
+
+   //
+   //find the axis with biggest spread
+   Value maxspread=0;
+   Value tempspread, min, max;
+   Index axspread=0;
+   Value *array;
+   for (Int_t idim=0; idim<fNDim; idim++){
+      array = fData[idim];
+      Spread(npoints, array, fIndPoints+cpos, min, max);
+      tempspread = max - min;
+      if (maxspread < tempspread) {
+         maxspread=tempspread;
+         axspread = idim;
+      }
+      if(cnode) continue;
+      //printf("set %d %6.3f %6.3f\n", idim, min, max);
+      fRange[2*idim] = min; fRange[2*idim+1] = max;
+   }
+   array = fData[axspread];
+   KOrdStat(npoints, array, nleft, fIndPoints+cpos);
+   fAxis[cnode]  = axspread;
+   fValue[cnode] = array[fIndPoints[cpos+nleft]];
+   //printf("Set node %d : ax %d val %f\n", cnode, node->fAxis, node->fValue);
+   //
+   if (0){
+      // consistency check
+      Info("Build()", "%s", Form("points %d left %d right %d", npoints, nleft, nright));
+      if (nleft<nright) Warning("Build", "Problem Left-Right");
+      if (nleft<0 || nright<0) Warning("Build()", "Problem Negative number");
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Non recursive building of the subtree of node, of row row, whose npoints
+/// points start at fIndPoints[pos].
+/// The subtree only reads and writes the nodes and the part of fIndPoints it
+/// owns, so that disjoint subtrees can be built concurrently.
+
+template <typename  Index, typename Value>
+void TKDTree<Index, Value>::BuildSubtree(Int_t node, Int_t row, Int_t pos, Int_t npoints)
+{
    //    stack for non recursive build - size 128 bytes enough
    Int_t rowStack[128];
    Int_t nodeStack[128];
    Int_t npointStack[128];
    Int_t posStack[128];
    Int_t currentIndex = 0;
-   Int_t iter =0;
-   rowStack[0]    = 0;
-   nodeStack[0]   = 0;
-   npointStack[0] = fNPoints;
-   posStack[0]   = 0;
+   rowStack[0]    = row;
+   nodeStack[0]   = node;
+   npointStack[0] = npoints;
+   posStack[0]    = pos;
    //
-   Int_t nbucketsall =0;
    while (currentIndex>=0){
-      iter++;
       //
-      Int_t npoints  = npointStack[currentIndex];
-      if (npoints<=fBucketSize) {
-         //printf("terminal node : index %d iter %d\n", currentIndex, iter);
+      Int_t cnpoints = npointStack[currentIndex];
+      if (cnpoints<=fBucketSize) {
          currentIndex--;
-         nbucketsall++;
          continue; // terminal node
       }
       Int_t crow     = rowStack[currentIndex];
       Int_t cpos     = posStack[currentIndex];
       Int_t cnode    = nodeStack[currentIndex];
-      //printf("currentIndex %d npoints %d node %d\n", currentIndex, npoints, cnode);
-      //
-      // divide points
-      Int_t nbuckets0 = npoints/fBucketSize;           //current number of  buckets
-      if (npoints%fBucketSize) nbuckets0++;            //
-      Int_t restRows = fRowT0-rowStack[currentIndex];  // rest of fully occupied node row
-      if (restRows<0) restRows =0;
-      for (;nbuckets0>(2<<restRows); restRows++) {}
-      Int_t nfull = 1<<restRows;
-      Int_t nrest = nbuckets0-nfull;
-      Int_t nleft =0, nright =0;
-      //
-      if (nrest>(nfull/2)){
-         nleft  = nfull*fBucketSize;
-         nright = npoints-nleft;
-      }else{
-         nright = nfull*fBucketSize/2;
-         nleft  = npoints-nright;
-      }
-
-      //
-      //find the axis with biggest spread
-      Value maxspread=0;
-      Value tempspread, min, max;
-      Index axspread=0;
-      Value *array;
-      for (Int_t idim=0; idim<fNDim; idim++){
-         array = fData[idim];
-         Spread(npoints, array, fIndPoints+cpos, min, max);
-         tempspread = max - min;
-         if (maxspread < tempspread) {
-            maxspread=tempspread;
-            axspread = idim;
-         }
-         if(cnode) continue;
-         //printf("set %d %6.3f %6.3f\n", idim, min, max);
-         fRange[2*idim] = min; fRange[2*idim+1] = max;
-      }
-      array = fData[axspread];
-      KOrdStat(npoints, array, nleft, fIndPoints+cpos);
-      fAxis[cnode]  = axspread;
-      fValue[cnode] = array[fIndPoints[cpos+nleft]];
-      //printf("Set node %d : ax %d val %f\n", cnode, node->fAxis, node->fValue);
       //
+      Int_t nleft, nright;
+      SplitNode(cnode, crow, cpos, cnpoints, nleft, nright);
       //
       npointStack[currentIndex] = nleft;
       rowStack[currentIndex]    = crow+1;
@@ -529,16 +565,54 @@ void TKDTree<Index, Value>::Build()
       rowStack[currentIndex]    = crow+1;
       posStack[currentIndex]    = cpos+nleft;
       nodeStack[currentIndex]   = (cnode*2)+2;
-      //
-      if (0){
-         // consistency check
-         Info("Build()", "%s", Form("points %d left %d right %d", npoints, nleft, nright));
-         if (nleft<nright) Warning("Build", "Problem Left-Right");
-         if (nleft<0 || nright<0) Warning("Build()", "Problem Negative number");
-      }
    }
 }
 
+#ifdef R__USE_IMT
+////////////////////////////////////////////////////////////////////////////////
+/// Build the tree using the implicit multi-threading pool.
+///
+/// The top rows are split breadth first, each row in parallel, until there
+/// are enough pending subtrees to keep the pool busy; these are then built
+/// concurrently with BuildSubtree(). The resulting tree is identical to the
+/// one built sequentially.
+
+template <typename  Index, typename Value>
+void TKDTree<Index, Value>::BuildParallel()
+{
+   struct RSubtree {
+      Int_t fNode, fRow, fPos, fNPoints;
+   };
+   ROOT::TThreadExecutor pool;
+   const std::size_t nTasks = 4 * pool.GetPoolSize();
+
+   std::vector<RSubtree> frontier{{0, 0, 0, fNPoints}};
+   std::vector<RSubtree> next;
+   while (!frontier.empty() && frontier.size() < nTasks) {
+      next.assign(2 * frontier.size(), RSubtree{0, 0, 0, 0});
+      auto split = [&](std::size_t i) {
+         const RSubtree &t = frontier[i];
+         if (t.fNPoints <= fBucketSize)
+            return; // terminal node
+         Int_t nleft, nright;
+         SplitNode(t.fNode, t.fRow, t.fPos, t.fNPoints, nleft, nright);
+         next[2 * i] = {t.fNode * 2 + 1, t.fRow + 1, t.fPos, nleft};
+         next[2 * i + 1] = {t.fNode * 2 + 2, t.fRow + 1, t.fPos + nleft, nright};
+      };
+      if (frontier.size() == 1)
+         split(0);
+      else
+         pool.Foreach(split, ROOT::TSeqU(frontier.size()));
+      frontier.clear();
+      for (const RSubtree &t : next)
+         if (t.fNPoints > fBucketSize)
+            frontier.push_back(t);
+   }
+   if (!frontier.empty())
+      pool.Foreach([&](const RSubtree &t) { BuildSubtree(t.fNode, t.fRow, t.fPos, t.fNPoints); }, frontier);
+}
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 ///Find kNN nearest neighbors to the point in the first argument
 ///Returns 1 on success, 0 on failure
@@ -561,6 +635,45 @@ void TKDTree<Index, Value>::FindNearestNeighbors(const Value *point, const Int_t
 
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Find the kNN nearest neighbors of each of the npoints points stored
+/// point by point in the array points, i.e. coordinate idim of point ipoint
+/// is points[ipoint*fNDim+idim].
+/// The indexes and distances of the neighbors of point ipoint are returned in
+/// ind[ipoint*kNN, (ipoint+1)*kNN) and dist[ipoint*kNN, (ipoint+1)*kNN);
+/// both arrays are provided by the user and are assumed to be at least
+/// npoints*kNN elements long.
+/// If implicit multi-threading is enabled, the points are processed in parallel.
+
+template <typename  Index, typename Value>
+void TKDTree<Index, Value>::FindNearestNeighbors(Index npoints, const Value *points, Int_t kNN, Index *ind, Value *dist)
+{
+   if (!ind || !dist) {
+      Error("FindNearestNeighbors", "Working arrays must be allocated by the user!");
+      return;
+   }
+   // the boundaries are shared, build them before any concurrent access
+   MakeBoundariesExact();
+   auto findOne = [&](Index ipoint) {
+      Index *cind = ind + (std::size_t)ipoint * kNN;
+      Value *cdist = dist + (std::size_t)ipoint * kNN;
+      for (Int_t i=0; i<kNN; i++){
+         cdist[i]=std::numeric_limits<Value>::max();
+         cind[i]=-1;
+      }
+      UpdateNearestNeighbors(0, points + (std::size_t)ipoint * fNDim, kNN, cind, cdist);
+   };
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && npoints > 1) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(findOne, ROOT::TSeq<Index>(npoints));
+      return;
+   }
+#endif
+   for (Index ipoint=0; ipoint<npoints; ipoint++)
+      findOne(ipoint);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///Update the nearest neighbors values by examining the node inode
 
@@ -757,11 +870,39 @@ void TKDTree<Index, Value>::FindInRange(Value * point, Value range, std::vector<
    UpdateRange(0, point, range, res);
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Find all points in the sphere of radius range around each of the npoints
+/// points stored point by point in the array points, i.e. coordinate idim of
+/// point ipoint is points[ipoint*fNDim+idim].
+/// On return, res[ipoint] holds the indexes of the points found around point ipoint.
+/// If implicit multi-threading is enabled, the points are processed in parallel.
+
+template <typename  Index, typename Value>
+void TKDTree<Index, Value>::FindInRange(Index npoints, const Value *points, Value range, std::vector<std::vector<Index>> &res)
+{
+   // the boundaries are shared, build them before any concurrent access
+   MakeBoundariesExact();
+   res.resize(npoints);
+   auto findOne = [&](Index ipoint) {
+      res[ipoint].clear();
+      UpdateRange(0, points + (std::size_t)ipoint * fNDim, range, res[ipoint]);
+   };
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && npoints > 1) {
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(findOne, ROOT::TSeq<Index>(npoints));
+      return;
+   }
+#endif
+   for (Index ipoint=0; ipoint<npoints; ipoint++)
+      findOne(ipoint);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///Internal recursive function with the implementation of range searches
 
 template <typename  Index, typename Value>
-void TKDTree<Index, Value>::UpdateRange(Index inode, Value* point, Value range, std::vector<Index> &res)
+void TKDTree<Index, Value>::UpdateRange(Index inode, const Value* point, Value range, std::vector<Index> &res)
 {
    Value min, max;
    DistanceToNode(point, inode, min, max);
@@ -47,6 +47,44 @@ TEST(RanluxppEngine, random2048)
    EXPECT_EQ(rng.Rndm(), 0.74670661284082484599);
 }
 
+TEST(RanluxppEngine, RndmArray)
+{
+   RanluxppEngine2048 rng(314159265);
+   RanluxppEngine2048 ref(314159265);
+
+   // Start in the middle of a block and fill across several blocks.
+   rng.Skip(5);
+   ref.Skip(5);
+   double array[100];
+   rng.RndmArray(100, array);
+   for (int i = 0; i < 100; i++) {
+      EXPECT_EQ(array[i], ref.Rndm());
+   }
+   // The single numbers continue from the end of the array.
+   EXPECT_EQ(rng.Rndm(), ref.Rndm());
+}
+
+TEST(RanluxppEngine, Streams)
+{
+   // Stream 0 is the sequence of the seed.
+   RanluxppEngine2048 rng(314159265, 0);
+   RanluxppEngine2048 ref(314159265);
+   for (int i = 0; i < 20; i++) {
+      EXPECT_EQ(rng.IntRndm(), ref.IntRndm());
+   }
+
+   // The streams are reproducible and differ from each other.
+   RanluxppEngine2048 stream1(314159265, 1);
+   RanluxppEngine2048 stream1Again(1);
+   stream1Again.SetSeed(314159265, 1);
+   RanluxppEngine2048 stream2(314159265, 2);
+   RanluxppEngine2048 seed0(314159265);
+   uint64_t first1 = stream1.IntRndm();
+   EXPECT_EQ(first1, stream1Again.IntRndm());
+   EXPECT_NE(first1, stream2.IntRndm());
+   EXPECT_NE(first1, seed0.IntRndm());
+}
+
 TEST(RanluxppCompatEngineJames, P3)
 {
    RanluxppCompatEngineJamesP3 rng(314159265);
@@ -0,0 +1,56 @@
+#include "Math/AdaptiveIntegratorMultiDim.h"
+#include "Math/Functor.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+
+namespace {
+
+constexpr unsigned int kNDim = 4;
+
+double Gauss(const double *x)
+{
+   double s = 0;
+   for (unsigned int i = 0; i < kNDim; i++)
+      s += (x[i] - 0.3) * (x[i] - 0.3);
+   return std::exp(-s / 0.02) + 0.1 * x[0];
+}
+
+} // namespace
+
+// The batch and multi-threaded evaluations must reproduce the sequential result exactly
+TEST(AdaptiveIntegratorMultiDim, BatchAndMultiThread)
+{
+   const double xmin[kNDim] = {0, 0, 0, 0};
+   const double xmax[kNDim] = {1, 1, 1, 1};
+   ROOT::Math::Functor f(&Gauss, kNDim);
+
+   ROOT::Math::AdaptiveIntegratorMultiDim ref(f, 0, 1E-6, 200000);
+   const double expected = ref.Integral(xmin, xmax);
+
+   ROOT::Math::AdaptiveIntegratorMultiDim batch(0, 1E-6, 200000);
+   unsigned int ncalls = 0;
+   batch.SetBatchFunction(
+      [&](unsigned int n, const double *x, double *result) {
+         ncalls++;
+         for (unsigned int i = 0; i < n; i++)
+            result[i] = Gauss(x + i * kNDim);
+      },
+      kNDim);
+   EXPECT_EQ(batch.Integral(xmin, xmax), expected);
+   EXPECT_EQ(batch.Error(), ref.Error());
+   EXPECT_EQ(batch.NEval(), ref.NEval());
+   EXPECT_EQ(batch.Status(), ref.Status());
+   // each batch holds the points of both halves of a divided region
+   const unsigned int nRulePoints = (1u << kNDim) + 2 * kNDim * (kNDim + 1) + 1;
+   EXPECT_EQ(ncalls, (ref.NEval() / nRulePoints + 1) / 2);
+
+#ifdef R__USE_IMT
+   ROOT::Math::AdaptiveIntegratorMultiDim mt(f, 0, 1E-6, 200000);
+   mt.SetExecutionPolicy(ROOT::EExecutionPolicy::kMultiThread);
+   EXPECT_EQ(mt.Integral(xmin, xmax), expected);
+   EXPECT_EQ(mt.Error(), ref.Error());
+   EXPECT_EQ(mt.NEval(), ref.NEval());
+#endif
+}
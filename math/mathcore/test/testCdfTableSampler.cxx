@@ -0,0 +1,79 @@
+#include "Math/CdfTableSampler.h"
+#include "TMath.h"
+#include "TRandom3.h"
+
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <vector>
+
+using ROOT::Math::CdfTableSampler;
+
+// The bin lookup with the guide table must agree with a binary search, also
+// with empty bins.
+TEST(CdfTableSampler, FindBin)
+{
+   TRandom3 rng(1);
+   const unsigned int n = 57;
+   std::vector<double> edges(n + 1), integrals(n);
+   for (unsigned int i = 0; i <= n; ++i)
+      edges[i] = i;
+   for (unsigned int i = 0; i < n; ++i)
+      integrals[i] = (i % 5 == 2 || i > 50) ? 0. : rng.Exp(1.);
+   const CdfTableSampler sampler(edges, integrals);
+   ASSERT_TRUE(sampler.IsValid());
+   EXPECT_EQ(sampler.NBins(), n);
+   EXPECT_EQ(sampler.Cdf(0), 0.);
+   EXPECT_EQ(sampler.Cdf(n), 1.);
+
+   std::vector<double> cdf(n + 1);
+   for (unsigned int i = 0; i <= n; ++i)
+      cdf[i] = sampler.Cdf(i);
+   for (int i = 0; i < 100000; ++i) {
+      const double r = rng.Rndm();
+      EXPECT_EQ(sampler.FindBin(r), (unsigned int)TMath::BinarySearch(n, cdf.data(), r));
+   }
+   for (unsigned int i = 0; i <= n; ++i)
+      EXPECT_EQ(sampler.FindBin(cdf[i]), (unsigned int)TMath::BinarySearch(n, cdf.data(), cdf[i]));
+}
+
+// A histogram-like sampler inverts its cumulative distribution linearly.
+TEST(CdfTableSampler, Linear)
+{
+   const CdfTableSampler sampler({0., 1., 3., 4.}, {1., 2., 1.});
+   ASSERT_TRUE(sampler.IsValid());
+   EXPECT_DOUBLE_EQ(sampler.Quantile(0.), 0.);
+   EXPECT_DOUBLE_EQ(sampler.Quantile(0.125), 0.5);
+   EXPECT_DOUBLE_EQ(sampler.Quantile(0.5), 2.);
+   EXPECT_DOUBLE_EQ(sampler.Quantile(0.875), 3.5);
+
+   TRandom3 rng(2);
+   std::vector<double> x(100000);
+   sampler.Sample(rng, x.size(), x.data());
+   EXPECT_NEAR(TMath::Mean(x.begin(), x.end()), 2., 0.01);
+}
+
+// The parabolic interpolation is exact for a distribution linear in each bin.
+TEST(CdfTableSampler, Quadratic)
+{
+   // f(x) = x in [0,2]
+   const unsigned int n = 4;
+   std::vector<double> integrals(n), halfIntegrals(n);
+   for (unsigned int i = 0; i < n; ++i) {
+      const double a = 0.5 * i, b = a + 0.5, c = a + 0.25;
+      integrals[i] = 0.5 * (b * b - a * a);
+      halfIntegrals[i] = 0.5 * (c * c - a * a);
+   }
+   const CdfTableSampler sampler(n, 0., 2., integrals, halfIntegrals);
+   ASSERT_TRUE(sampler.IsValid());
+   for (double r : {0.01, 0.2, 0.5, 0.77, 0.99})
+      EXPECT_NEAR(sampler.Quantile(r), 2. * std::sqrt(r), 1e-12);
+}
+
+TEST(CdfTableSampler, Invalid)
+{
+   EXPECT_FALSE(CdfTableSampler().IsValid());
+   EXPECT_FALSE(CdfTableSampler({0., 1., 2.}, {0., 0.}).IsValid());
+   EXPECT_FALSE(CdfTableSampler({0., 1., 2.}, {1., -1.}).IsValid());
+   EXPECT_FALSE(CdfTableSampler({0., 1.}, {1., 1.}).IsValid());
+}
@@ -0,0 +1,112 @@
+// @(#)root/matrix:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_MatrixBlas
+#define ROOT_MatrixBlas
+
+//////////////////////////////////////////////////////////////////////////
+//                                                                      //
+// Dispatch of the dense kernels of the Matrix library to an optimized  //
+// BLAS/LAPACK. The library is linked to BLAS/LAPACK and                //
+// R__HAS_MATRIX_BLAS is defined when ROOT is configured with           //
+// -Dmatrix-blas=ON and both libraries are found.                       //
+//                                                                      //
+// The matrices of the Matrix library are stored by row while BLAS and  //
+// LAPACK expect them by column: the row-wise array of a matrix is the  //
+// column-wise array of its transpose.                                  //
+//                                                                      //
+//////////////////////////////////////////////////////////////////////////
+
+#include "Rtypes.h"
+
+#ifdef R__HAS_MATRIX_BLAS
+extern "C" {
+void dgemm_(const char *transa, const char *transb, const int *m, const int *n, const int *k, const double *alpha,
+            const double *a, const int *lda, const double *b, const int *ldb, const double *beta, double *c,
+            const int *ldc);
+void sgemm_(const char *transa, const char *transb, const int *m, const int *n, const int *k, const float *alpha,
+            const float *a, const int *lda, const float *b, const int *ldb, const float *beta, float *c,
+            const int *ldc);
+void dgetrf_(const int *m, const int *n, double *a, const int *lda, int *ipiv, int *info);
+void dgetri_(const int *n, double *a, const int *lda, const int *ipiv, double *work, const int *lwork, int *info);
+void dpotrf_(const char *uplo, const int *n, double *a, const int *lda, int *info);
+}
+#endif
+
+namespace ROOT {
+namespace Internal {
+namespace MatrixBlas {
+
+/// Smallest number of multiply-adds for which a product is handed to BLAS or
+/// split between threads; smaller products are faster with the plain loops.
+constexpr Long64_t kMinOps = 64 * 64 * 64;
+
+/// Smallest matrix size for which a decomposition or inversion is handed to LAPACK.
+constexpr Int_t kMinLapackSize = 64;
+
+/// Return true if BLAS/LAPACK are used for matrices of size n x n.
+inline bool UseLapack(Int_t n)
+{
+#ifdef R__HAS_MATRIX_BLAS
+   return n >= kMinLapackSize;
+#else
+   (void)n;
+   return false;
+#endif
+}
+
+#ifdef R__HAS_MATRIX_BLAS
+inline void Gemm(const char *transa, const char *transb, const int *m, const int *n, const int *k, const double *a,
+                 const int *lda, const double *b, const int *ldb, double *c, const int *ldc)
+{
+   const double alpha = 1.;
+   const double beta = 0.;
+   dgemm_(transa, transb, m, n, k, &alpha, a, lda, b, ldb, &beta, c, ldc);
+}
+
+inline void Gemm(const char *transa, const char *transb, const int *m, const int *n, const int *k, const float *a,
+                 const int *lda, const float *b, const int *ldb, float *c, const int *ldc)
+{
+   const float alpha = 1.;
+   const float beta = 0.;
+   sgemm_(transa, transb, m, n, k, &alpha, a, lda, b, ldb, &beta, c, ldc);
+}
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute C = op(A) * op(B) with BLAS, where op(A) is A or A^T according to
+/// transA and has m rows and k columns, op(B) has k rows and n columns and all
+/// matrices are stored by row. Returns false, leaving C untouched, if BLAS is
+/// not available or the product is too small to profit from it.
+
+template <class Element>
+bool Multiply(bool transA, bool transB, Int_t m, Int_t n, Int_t k, const Element *a, const Element *b, Element *c)
+{
+#ifdef R__HAS_MATRIX_BLAS
+   if (Long64_t(m) * n * k < kMinOps)
+      return false;
+   // By column, C^T = op(B)^T * op(A)^T, and the arrays of A and B hold A^T and B^T.
+   const char ta = transA ? 'T' : 'N';
+   const char tb = transB ? 'T' : 'N';
+   const int lda = transA ? m : k;
+   const int ldb = transB ? k : n;
+   Gemm(&tb, &ta, &n, &m, &k, b, &ldb, a, &lda, c, &n);
+   return true;
+#else
+   (void)transA; (void)transB; (void)m; (void)n; (void)k; (void)a; (void)b; (void)c;
+   return false;
+#endif
+}
+
+} // namespace MatrixBlas
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -26,6 +26,7 @@
 
 #include "TDecompChol.h"
 #include "TMath.h"
+#include "MatrixBlas.h"
 
 ClassImp(TDecompChol);
 
@@ -115,31 +116,45 @@ Bool_t TDecompChol::Decompose()
    Int_t i,j,icol,irow;
    const Int_t     n  = fU.GetNrows();
          Double_t *pU = fU.GetMatrixArray();
-   for (icol = 0; icol < n; icol++) {
-      const Int_t rowOff = icol*n;
-
-      //Compute fU(j,j) and test for non-positive-definiteness.
-      Double_t ujj = pU[rowOff+icol];
-      for (irow = 0; irow < icol; irow++) {
-         const Int_t pos_ij = irow*n+icol;
-         ujj -= pU[pos_ij]*pU[pos_ij];
-      }
-      if (ujj <= 0) {
+   if (ROOT::Internal::MatrixBlas::UseLapack(n)) {
+#ifdef R__HAS_MATRIX_BLAS
+      // The array of the symmetric fU is the same by row and by column: the
+      // lower factor L computed by column is stored as U = L^T by row.
+      const char uplo = 'L';
+      Int_t info = 0;
+      dpotrf_(&uplo,&n,pU,&n,&info);
+      if (info != 0) {
          Error("Decompose()","matrix not positive definite");
          return kFALSE;
       }
-      ujj = TMath::Sqrt(ujj);
-      pU[rowOff+icol] = ujj;
-
-      if (icol < n-1) {
-         for (j = icol+1; j < n; j++) {
-            for (i = 0; i < icol; i++) {
-               const Int_t rowOff2 = i*n;
-               pU[rowOff+j] -= pU[rowOff2+j]*pU[rowOff2+icol];
+#endif
+   } else {
+      for (icol = 0; icol < n; icol++) {
+         const Int_t rowOff = icol*n;
+
+         //Compute fU(j,j) and test for non-positive-definiteness.
+         Double_t ujj = pU[rowOff+icol];
+         for (irow = 0; irow < icol; irow++) {
+            const Int_t pos_ij = irow*n+icol;
+            ujj -= pU[pos_ij]*pU[pos_ij];
+         }
+         if (ujj <= 0) {
+            Error("Decompose()","matrix not positive definite");
+            return kFALSE;
+         }
+         ujj = TMath::Sqrt(ujj);
+         pU[rowOff+icol] = ujj;
+
+         if (icol < n-1) {
+            for (j = icol+1; j < n; j++) {
+               for (i = 0; i < icol; i++) {
+                  const Int_t rowOff2 = i*n;
+                  pU[rowOff+j] -= pU[rowOff2+j]*pU[rowOff2+icol];
+               }
             }
+            for (j = icol+1; j < n; j++)
+               pU[rowOff+j] /= ujj;
          }
-         for (j = icol+1; j < n; j++)
-            pU[rowOff+j] /= ujj;
       }
    }
 
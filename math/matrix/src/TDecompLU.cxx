@@ -11,6 +11,10 @@
 
 #include "TDecompLU.h"
 #include "TMath.h"
+#include "MatrixBlas.h"
+
+#include <algorithm>
+#include <vector>
 
 ClassImp(TDecompLU);
 
@@ -714,6 +718,33 @@ Bool_t TDecompLU::DecomposeLUGauss(TMatrixD &lu,Int_t *index,Double_t &sign,
    sign    = 1.0;
    nrZeros = 0;
 
+#ifdef R__HAS_MATRIX_BLAS
+   if (ROOT::Internal::MatrixBlas::UseLapack(n)) {
+      // LAPACK factorizes by column: transpose in place before and after
+      for (Int_t i = 0; i < n; i++)
+         for (Int_t j = i+1; j < n; j++)
+            std::swap(pLU[i*n+j],pLU[j*n+i]);
+      Int_t info = 0;
+      dgetrf_(&n,&n,pLU,&n,index,&info);
+      for (Int_t i = 0; i < n; i++)
+         for (Int_t j = i+1; j < n; j++)
+            std::swap(pLU[i*n+j],pLU[j*n+i]);
+
+      for (Int_t j = 0; j < n; j++) {
+         index[j]--;                       // LAPACK pivots start at 1
+         if (index[j] != j)
+            sign = -sign;
+         if (TMath::Abs(pLU[j*n+j]) < tol)
+            nrZeros++;
+      }
+      if (info > 0) {
+         ::Error("TDecompLU::DecomposeLUGauss","matrix is singular");
+         return kFALSE;
+      }
+      return kTRUE;
+   }
+#endif
+
    index[n-1] = n-1;
    for (Int_t j = 0; j < n-1; j++) {
       const Int_t off_j = j*n;
@@ -793,6 +824,50 @@ Bool_t TDecompLU::InvertLU(TMatrixD &lu,Double_t tol,Double_t *det)
       index = allocatedI;
    }
 
+#ifdef R__HAS_MATRIX_BLAS
+   if (ROOT::Internal::MatrixBlas::UseLapack(n)) {
+      // The array of lu holds its transpose by column, whose inverse by column
+      // is the inverse of lu by row: no transposition is needed.
+      Int_t info = 0;
+      dgetrf_(&n,&n,pLU,&n,index,&info);
+      Int_t nrZeros = 0;
+      Double_t sign = 1.0;
+      for (Int_t j = 0; j < n; j++) {
+         if (index[j] != j+1)
+            sign = -sign;
+         if (TMath::Abs(pLU[j*n+j]) < tol)
+            nrZeros++;
+      }
+      if (info > 0 || nrZeros > 0) {
+         if (allocatedI)
+            delete [] allocatedI;
+         ::Error("TDecompLU::InvertLU","matrix is singular, %d diag elements < tolerance of %.4e",nrZeros,tol);
+         return kFALSE;
+      }
+
+      if (det) {
+         Double_t d1;
+         Double_t d2;
+         const TVectorD diagv = TMatrixDDiag_const(lu);
+         DiagProd(diagv,tol,d1,d2);
+         d1 *= sign;
+         *det = d1*TMath::Power(2.0,d2);
+      }
+
+      Double_t wsize = 0;
+      Int_t lwork = -1;
+      dgetri_(&n,pLU,&n,index,&wsize,&lwork,&info);
+      lwork = std::max(n,Int_t(wsize));
+      std::vector<Double_t> work(lwork);
+      dgetri_(&n,pLU,&n,index,work.data(),&lwork,&info);
+
+      if (allocatedI)
+         delete [] allocatedI;
+
+      return kTRUE;
+   }
+#endif
+
    Double_t sign = 1.0;
    Int_t nrZeros = 0;
    if (!DecomposeLUCrout(lu,index,sign,tol,nrZeros) || nrZeros > 0) {
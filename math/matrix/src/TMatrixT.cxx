@@ -30,9 +30,116 @@ See the \ref Matrix page for the documentation of the linear algebra package
 #include "TDecompLU.h"
 #include "TMatrixDEigen.h"
 #include "TMath.h"
+#include "MatrixBlas.h"
+
+#include <algorithm>
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
 
 templateClassImp(TMatrixT);
 
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Call func(first,last) on ranges of rows [first,last) covering [0,nrows).
+/// If implicit multi-threading is enabled and the product has at least
+/// MatrixBlas::kMinOps multiply-adds, the ranges are processed in parallel.
+
+template <class F>
+void ForEachRowRange(Int_t nrows, Long64_t nops, const F &func)
+{
+#ifdef R__USE_IMT
+   if (nrows > 1 && nops >= ROOT::Internal::MatrixBlas::kMinOps && ROOT::IsImplicitMTEnabled()) {
+      ROOT::TThreadExecutor pool;
+      const Int_t nranges = std::min<Int_t>(nrows, 4 * pool.GetPoolSize());
+      const Int_t step = (nrows + nranges - 1) / nranges;
+      pool.Foreach([&](Int_t first) { func(first, std::min(first + step, nrows)); }, ROOT::TSeqI(0, nrows, step));
+      return;
+   }
+#else
+   (void)nops;
+#endif
+   func(0, nrows);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Rows [first,last) of C = A*B, see TMatrixTAutoloadOps::AMultB.
+
+template<class Element>
+void AMultBRows(const Element * const ap,Int_t ncolsa,Int_t first,Int_t last,
+                const Element * const bp,Int_t nb,Int_t ncolsb,Element *cp)
+{
+   cp += first*ncolsb;
+   const Element *arp0 = ap+first*ncolsa;        // Pointer to  A[i,0];
+   while (arp0 < ap+last*ncolsa) {
+      for (const Element *bcp = bp; bcp < bp+ncolsb; ) { // Pointer to the j-th column of B, Start bcp = B[0,0]
+         const Element *arp = arp0;                       // Pointer to the i-th row of A, reset to A[i,0]
+         Element cij = 0;
+         while (bcp < bp+nb) {                     // Scan the i-th row of A and
+            cij += *arp++ * *bcp;                   // the j-th col of B
+            bcp += ncolsb;
+         }
+         *cp++ = cij;
+         bcp -= nb-1;                              // Set bcp to the (j+1)-th col
+      }
+      arp0 += ncolsa;                             // Set ap to the (i+1)-th row
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Rows [first,last) of C = A^T*B, see TMatrixTAutoloadOps::AtMultB.
+
+template<class Element>
+void AtMultBRows(const Element * const ap,Int_t ncolsa,Int_t first,Int_t last,
+                 const Element * const bp,Int_t nb,Int_t ncolsb,Element *cp)
+{
+   cp += first*ncolsb;
+   const Element *acp0 = ap+first;     // Pointer to  A[i,0];
+   while (acp0 < ap+last) {
+      for (const Element *bcp = bp; bcp < bp+ncolsb; ) { // Pointer to the j-th column of B, Start bcp = B[0,0]
+         const Element *acp = acp0;                       // Pointer to the i-th column of A, reset to A[0,i]
+         Element cij = 0;
+         while (bcp < bp+nb) {           // Scan the i-th column of A and
+            cij += *acp * *bcp;           // the j-th col of B
+            acp += ncolsa;
+            bcp += ncolsb;
+         }
+         *cp++ = cij;
+         bcp -= nb-1;                    // Set bcp to the (j+1)-th col
+      }
+      acp0++;                           // Set acp0 to the (i+1)-th col
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Rows [first,last) of C = A*B^T, see TMatrixTAutoloadOps::AMultBt.
+
+template<class Element>
+void AMultBtRows(const Element * const ap,Int_t ncolsa,Int_t first,Int_t last,
+                 const Element * const bp,Int_t nb,Int_t ncolsb,Element *cp)
+{
+   cp += first*(nb/ncolsb);
+   const Element *arp0 = ap+first*ncolsa;       // Pointer to  A[i,0];
+   while (arp0 < ap+last*ncolsa) {
+      const Element *brp0 = bp;                  // Pointer to  B[j,0];
+      while (brp0 < bp+nb) {
+         const Element *arp = arp0;               // Pointer to the i-th row of A, reset to A[i,0]
+         const Element *brp = brp0;               // Pointer to the j-th row of B, reset to B[j,0]
+         Element cij = 0;
+         while (brp < brp0+ncolsb)                 // Scan the i-th row of A and
+            cij += *arp++ * *brp++;                 // the j-th row of B
+         *cp++ = cij;
+         brp0 += ncolsb;                           // Set brp0 to the (j+1)-th row
+      }
+      arp0 += ncolsa;                             // Set arp0 to the (i+1)-th row
+   }
+}
+
+} // namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Constructor for (nrows x ncols) matrix
 
@@ -3073,72 +3180,60 @@ TMatrixT<Element> &TMatrixTAutoloadOps::ElementDiv(TMatrixT<Element> &target,con
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Elementary routine to calculate matrix multiplication A*B
+///
+/// Large products are computed with BLAS if the library was built with it,
+/// otherwise their rows are split between threads when implicit
+/// multi-threading is enabled.
 
 template<class Element>
 void TMatrixTAutoloadOps::AMultB(const Element * const ap,Int_t na,Int_t ncolsa,
             const Element * const bp,Int_t nb,Int_t ncolsb,Element *cp)
 {
-   const Element *arp0 = ap;                     // Pointer to  A[i,0];
-   while (arp0 < ap+na) {
-      for (const Element *bcp = bp; bcp < bp+ncolsb; ) { // Pointer to the j-th column of B, Start bcp = B[0,0]
-         const Element *arp = arp0;                       // Pointer to the i-th row of A, reset to A[i,0]
-         Element cij = 0;
-         while (bcp < bp+nb) {                     // Scan the i-th row of A and
-            cij += *arp++ * *bcp;                   // the j-th col of B
-            bcp += ncolsb;
-         }
-         *cp++ = cij;
-         bcp -= nb-1;                              // Set bcp to the (j+1)-th col
-      }
-      arp0 += ncolsa;                             // Set ap to the (i+1)-th row
-   }
+   if (ncolsa <= 0 || ncolsb <= 0) return;
+   const Int_t nrowsa = na/ncolsa;
+   if (ROOT::Internal::MatrixBlas::Multiply(false,false,nrowsa,ncolsb,ncolsa,ap,bp,cp)) return;
+   ForEachRowRange(nrowsa,Long64_t(nrowsa)*ncolsa*ncolsb,[&](Int_t first,Int_t last) {
+      AMultBRows(ap,ncolsa,first,last,bp,nb,ncolsb,cp);
+   });
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Elementary routine to calculate matrix multiplication A^T*B
+///
+/// Large products are computed with BLAS if the library was built with it,
+/// otherwise their rows are split between threads when implicit
+/// multi-threading is enabled.
 
 template<class Element>
 void TMatrixTAutoloadOps::AtMultB(const Element * const ap,Int_t ncolsa,
              const Element * const bp,Int_t nb,Int_t ncolsb,Element *cp)
 {
-   const Element *acp0 = ap;           // Pointer to  A[i,0];
-   while (acp0 < ap+ncolsa) {
-      for (const Element *bcp = bp; bcp < bp+ncolsb; ) { // Pointer to the j-th column of B, Start bcp = B[0,0]
-         const Element *acp = acp0;                       // Pointer to the i-th column of A, reset to A[0,i]
-         Element cij = 0;
-         while (bcp < bp+nb) {           // Scan the i-th column of A and
-            cij += *acp * *bcp;           // the j-th col of B
-            acp += ncolsa;
-            bcp += ncolsb;
-         }
-         *cp++ = cij;
-         bcp -= nb-1;                    // Set bcp to the (j+1)-th col
-      }
-      acp0++;                           // Set acp0 to the (i+1)-th col
-   }
+   if (ncolsa <= 0 || ncolsb <= 0) return;
+   const Int_t nrowsb = nb/ncolsb;
+   if (ROOT::Internal::MatrixBlas::Multiply(true,false,ncolsa,ncolsb,nrowsb,ap,bp,cp)) return;
+   ForEachRowRange(ncolsa,Long64_t(ncolsa)*nrowsb*ncolsb,[&](Int_t first,Int_t last) {
+      AtMultBRows(ap,ncolsa,first,last,bp,nb,ncolsb,cp);
+   });
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Elementary routine to calculate matrix multiplication A*B^T
+///
+/// Large products are computed with BLAS if the library was built with it,
+/// otherwise their rows are split between threads when implicit
+/// multi-threading is enabled.
 
 template<class Element>
 void TMatrixTAutoloadOps::AMultBt(const Element * const ap,Int_t na,Int_t ncolsa,
              const Element * const bp,Int_t nb,Int_t ncolsb,Element *cp)
 {
-   const Element *arp0 = ap;                    // Pointer to  A[i,0];
-   while (arp0 < ap+na) {
-      const Element *brp0 = bp;                  // Pointer to  B[j,0];
-      while (brp0 < bp+nb) {
-         const Element *arp = arp0;               // Pointer to the i-th row of A, reset to A[i,0]
-         const Element *brp = brp0;               // Pointer to the j-th row of B, reset to B[j,0]
-         Element cij = 0;
-         while (brp < brp0+ncolsb)                 // Scan the i-th row of A and
-            cij += *arp++ * *brp++;                 // the j-th row of B
-         *cp++ = cij;
-         brp0 += ncolsb;                           // Set brp0 to the (j+1)-th row
-      }
-      arp0 += ncolsa;                             // Set arp0 to the (i+1)-th row
-   }
+   if (ncolsa <= 0 || ncolsb <= 0) return;
+   const Int_t nrowsa = na/ncolsa;
+   const Int_t nrowsb = nb/ncolsb;
+   if (ROOT::Internal::MatrixBlas::Multiply(false,true,nrowsa,nrowsb,ncolsa,ap,bp,cp)) return;
+   ForEachRowRange(nrowsa,Long64_t(nrowsa)*nrowsb*ncolsa,[&](Int_t first,Int_t last) {
+      AMultBtRows(ap,ncolsa,first,last,bp,nb,ncolsb,cp);
+   });
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -401,23 +401,7 @@ void TMatrixTSym<Element>::TMult(const TMatrixT<Element> &a)
    const Element * const bp = ap;
          Element *       cp = this->GetMatrixArray();
 
-   const Element *acp0 = ap;           // Pointer to  A[i,0];
-   while (acp0 < ap+a.GetNcols()) {
-      for (const Element *bcp = bp; bcp < bp+ncolsb; ) { // Pointer to the j-th column of A, Start bcp = A[0,0]
-         const Element *acp = acp0;                       // Pointer to the i-th column of A, reset to A[0,i]
-         Element cij = 0;
-         while (bcp < bp+nb) {           // Scan the i-th column of A and
-            cij += *acp * *bcp;           // the j-th col of A
-            acp += ncolsa;
-            bcp += ncolsb;
-         }
-         *cp++ = cij;
-         bcp -= nb-1;                    // Set bcp to the (j+1)-th col
-      }
-      acp0++;                           // Set acp0 to the (i+1)-th col
-   }
-
-   R__ASSERT(cp == this->GetMatrixArray()+this->fNelems && acp0 == ap+ncolsa);
+   AtMultB(ap,ncolsa,bp,nb,ncolsb,cp);
 #endif
 }
 
@@ -449,23 +433,7 @@ void TMatrixTSym<Element>::TMult(const TMatrixTSym<Element> &a)
    const Element * const bp = ap;
          Element *       cp = this->GetMatrixArray();
 
-   const Element *acp0 = ap;           // Pointer to  A[i,0];
-   while (acp0 < ap+a.GetNcols()) {
-      for (const Element *bcp = bp; bcp < bp+ncolsb; ) { // Pointer to the j-th column of A, Start bcp = A[0,0]
-         const Element *acp = acp0;                       // Pointer to the i-th column of A, reset to A[0,i]
-         Element cij = 0;
-         while (bcp < bp+nb) {           // Scan the i-th column of A and
-            cij += *acp * *bcp;           // the j-th col of A
-            acp += ncolsa;
-            bcp += ncolsb;
-         }
-         *cp++ = cij;
-         bcp -= nb-1;                    // Set bcp to the (j+1)-th col
-      }
-      acp0++;                           // Set acp0 to the (i+1)-th col
-   }
-
-   R__ASSERT(cp == this->GetMatrixArray()+this->fNelems && acp0 == ap+ncolsa);
+   AtMultB(ap,ncolsa,bp,nb,ncolsb,cp);
 #endif
 }
 
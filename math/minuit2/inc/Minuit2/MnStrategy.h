@@ -48,6 +48,9 @@ public:
 
    int StorageLevel() const { return fStoreLevel; }
 
+   // whether the numerical derivatives are computed in parallel with ROOT's implicit multi-threading
+   bool ParallelDerivatives() const { return fParallelDeriv; }
+
    bool IsLow() const { return fStrategy == 0; }
    bool IsMedium() const { return fStrategy == 1; }
    bool IsHigh() const { return fStrategy >= 2; }
@@ -69,6 +72,10 @@ public:
    // 0 = store only last iterations 1 = full storage (default)
    void SetStorageLevel(unsigned int level) { fStoreLevel = level; }
 
+   // compute the numerical gradient and the Hessian in parallel, over the parameters, when ROOT's
+   // implicit multi-threading is enabled. This requires an FCN which is safe to call from several threads.
+   void SetParallelDerivatives(bool on) { fParallelDeriv = on; }
+
 private:
    unsigned int fStrategy;
 
@@ -80,6 +87,7 @@ private:
    double fHessTlrG2;
    unsigned int fHessGradNCyc;
    int fStoreLevel;
+   bool fParallelDeriv = false;
 };
 
 } // namespace Minuit2
@@ -21,6 +21,7 @@
 #define _MN_NO_THREAD_SAVE_
 #endif
 
+#include <cstddef>
 #include <cstdlib>
 #include <new>
 
@@ -41,6 +42,13 @@ class StackError {
     of heap memory which is then used like a stack, otherwise via standard
     malloc/free. Note that defining _MN_NO_THREAD_SAVE_ makes the code thread-
     unsave. The gain in performance is mainly for cost-cheap FCN functions.
+
+    In the thread-safe mode, the blocks of up to kMaxCachedSize bytes, which
+    hold the vectors and matrices of fits with up to ~20 parameters, are not
+    returned to the heap when they are deallocated but kept in a per-thread
+    cache of free blocks, one for each power-of-two size class. Consecutive
+    iterations of a minimization and consecutive small fits then reuse the
+    same memory instead of calling malloc/free for each temporary.
  */
 
 class StackAllocator {
@@ -92,9 +100,7 @@ public:
 #endif
 
 #else
-      void *result = malloc(nBytes);
-      if (!result)
-         throw std::bad_alloc();
+      void *result = AllocateCached(nBytes);
 #endif
 
       return result;
@@ -123,7 +129,7 @@ public:
       CheckConsistency();
 #endif
 #else
-      free(p);
+      DeallocateCached(p);
 #endif
       // std::cout << "Block at " << delBlock
       //   << " deallocated, fStackOffset = " << fStackOffset << std::endl;
@@ -208,6 +214,104 @@ public:
    }
 
 private:
+#ifndef _MN_NO_THREAD_SAVE_
+   enum {
+      kMinCachedSize = 16,   ///< size of the smallest size class in bytes
+      kNSizeClasses = 9,     ///< size classes of 16, 32, ..., 4096 bytes
+      kMaxCachedSize = kMinCachedSize << (kNSizeClasses - 1),
+      kMaxCachedBlocks = 64, ///< maximum number of free blocks kept per size class and thread
+      kNoSizeClass = kNSizeClasses
+   };
+
+   /// Header in front of each block, holding its size class. Its size keeps the user memory aligned like malloc does.
+   union BlockHeader {
+      unsigned int fSizeClass;
+      std::max_align_t fAlign;
+   };
+
+   /// Free blocks of a thread, as singly linked lists (stored in the free blocks themselves) per size class.
+   /// It is trivially destructible such that it can still be used (in pass-through mode) while the static
+   /// objects holding Minuit2 vectors and matrices are destroyed after the thread_local objects.
+   struct BlockCache {
+      void *fFree[kNSizeClasses];
+      unsigned int fNFree[kNSizeClasses];
+      bool fDisabled;
+   };
+
+   /// Returns the cached blocks to the heap at thread exit and stops caching for this thread.
+   struct BlockCacheCleaner {
+      BlockCache &fCache;
+      BlockCacheCleaner(BlockCache &cache) : fCache(cache) {}
+      ~BlockCacheCleaner()
+      {
+         for (int i = 0; i < kNSizeClasses; ++i) {
+            while (fCache.fFree[i]) {
+               void *next = *static_cast<void **>(fCache.fFree[i]);
+               free(static_cast<BlockHeader *>(fCache.fFree[i]) - 1);
+               fCache.fFree[i] = next;
+            }
+            fCache.fNFree[i] = 0;
+         }
+         fCache.fDisabled = true;
+      }
+   };
+
+   static BlockCache &GetBlockCache()
+   {
+      static thread_local BlockCache cache = {};
+      static thread_local BlockCacheCleaner cleaner(cache);
+      return cleaner.fCache;
+   }
+
+   static unsigned int SizeClass(size_t nBytes)
+   {
+      if (nBytes > kMaxCachedSize)
+         return kNoSizeClass;
+      unsigned int sizeClass = 0;
+      for (size_t size = kMinCachedSize; size < nBytes; size <<= 1)
+         ++sizeClass;
+      return sizeClass;
+   }
+
+   static void *AllocateCached(size_t nBytes)
+   {
+      unsigned int sizeClass = SizeClass(nBytes);
+      if (sizeClass != kNoSizeClass) {
+         BlockCache &cache = GetBlockCache();
+         if (void *result = cache.fFree[sizeClass]) {
+            cache.fFree[sizeClass] = *static_cast<void **>(result);
+            --cache.fNFree[sizeClass];
+            return result;
+         }
+         nBytes = size_t(kMinCachedSize) << sizeClass;
+      }
+      BlockHeader *header = static_cast<BlockHeader *>(malloc(sizeof(BlockHeader) + nBytes));
+      if (!header)
+         throw std::bad_alloc();
+      header->fSizeClass = sizeClass;
+      return header + 1;
+   }
+
+   static void DeallocateCached(void *p)
+   {
+      if (!p)
+         return;
+      BlockHeader *header = static_cast<BlockHeader *>(p) - 1;
+      unsigned int sizeClass = header->fSizeClass;
+      if (sizeClass != kNoSizeClass) {
+         BlockCache &cache = GetBlockCache();
+         if (!cache.fDisabled && cache.fNFree[sizeClass] < kMaxCachedBlocks) {
+            // blocks freed by another thread than the allocating one simply move to the cache of this thread
+            *static_cast<void **>(p) = cache.fFree[sizeClass];
+            cache.fFree[sizeClass] = p;
+            ++cache.fNFree[sizeClass];
+            return;
+         }
+      }
+      free(header);
+   }
+#endif
+
    unsigned char *fStack;
    //   unsigned char fStack[default_size];
    int fStackOffset;
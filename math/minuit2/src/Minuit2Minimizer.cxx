@@ -499,6 +499,11 @@ bool Minuit2Minimizer::Minimize()
       if (ret)
          SetStorageLevel(storageLevel);
 
+      // compute the numerical derivatives in parallel with IMT (requires a thread-safe FCN)
+      int parallelDerivatives = 0;
+      if (minuit2Opt->GetValue("ParallelDerivatives", parallelDerivatives))
+         strategy.SetParallelDerivatives(parallelDerivatives);
+
       if (printLevel > 0) {
          std::cout << "Minuit2Minimizer::Minuit  - Changing default options" << std::endl;
          minuit2Opt->Print();
@@ -1207,7 +1212,13 @@ bool Minuit2Minimizer::Hesse()
    if (Precision() > 0)
       fState.SetPrecision(Precision());
 
-   ROOT::Minuit2::MnHesse hesse(strategy);
+   ROOT::Minuit2::MnStrategy mnStrategy(strategy);
+   ROOT::Math::IOptions *minuit2Opt = ROOT::Math::MinimizerOptions::FindDefault("Minuit2");
+   int parallelDerivatives = 0;
+   if (minuit2Opt && minuit2Opt->GetValue("ParallelDerivatives", parallelDerivatives))
+      mnStrategy.SetParallelDerivatives(parallelDerivatives);
+
+   ROOT::Minuit2::MnHesse hesse(mnStrategy);
 
    // case when function minimum exists
    if (fMinimum) {
@@ -21,6 +21,15 @@
 #include "Minuit2/MnPrint.h"
 #include "Minuit2/MPIProcess.h"
 
+#ifdef USE_ROOT_ERROR
+#include "RConfigure.h"
+#endif
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
+
 namespace ROOT {
 
 namespace Minuit2 {
@@ -235,6 +244,24 @@ MinimumState MnHesse::operator()(const MnFcn &mfcn, const MinimumState &st, cons
    }
 
    // off-diagonal Elements
+#ifdef R__USE_IMT
+   if (fStrategy.ParallelDerivatives() && ROOT::IsImplicitMTEnabled() && n > 1) {
+      // one task per row, each working on its own copy of the parameters
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(
+         [&](unsigned int i) {
+            MnAlgebraicVector xi = x;
+            xi(i) += dirin(i);
+            for (unsigned int j = i + 1; j < n; j++) {
+               xi(j) += dirin(j);
+               double fs1 = mfcn(xi);
+               vhmat(i, j) = (fs1 + amin - yy(i) - yy(j)) / (dirin(i) * dirin(j));
+               xi(j) -= dirin(j);
+            }
+         },
+         ROOT::TSeqU(n - 1));
+   } else
+#endif
    // initial starting values
    if (n > 0) {
       MPIProcess mpiprocOffDiagonal(n * (n - 1) / 2, 0);
@@ -27,6 +27,15 @@
 
 #include "Minuit2/MPIProcess.h"
 
+#ifdef USE_ROOT_ERROR
+#include "RConfigure.h"
+#endif
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#include "TROOT.h"
+#endif
+
 namespace ROOT {
 
 namespace Minuit2 {
@@ -97,35 +106,9 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
 
    print.Debug("Calculating gradient around value", fcnmin, "at point", par.Vec());
 
-#ifndef _OPENMP
-
-   MPIProcess mpiproc(n, 0);
-
-   // for serial execution this can be outside the loop
-   MnAlgebraicVector x = par.Vec();
-
-   unsigned int startElementIndex = mpiproc.StartElementIndex();
-   unsigned int endElementIndex = mpiproc.EndElementIndex();
-
-   for (unsigned int i = startElementIndex; i < endElementIndex; i++) {
-
-#else
-
-   // parallelize this loop using OpenMP
-//#define N_PARALLEL_PAR 5
-#pragma omp parallel
-#pragma omp for
-   //#pragma omp for schedule (static, N_PARALLEL_PAR)
-
-   for (int i = 0; i < int(n); i++) {
-
-#endif
-
-#ifdef _OPENMP
-      // create in loop since each thread will use its own copy
-      MnAlgebraicVector x = par.Vec();
-#endif
-
+   // Compute the derivative with respect to parameter i. The work vector x must be equal to par.Vec() on input and
+   // is restored on output.
+   auto computeDerivative = [&](unsigned int i, MnAlgebraicVector &x, bool printCycles) {
       double xtf = x(i);
       double epspri = eps2 + std::fabs(grd(i) * eps2);
       double stepb4 = 0.;
@@ -169,36 +152,38 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
          grd(i) = 0.5 * (fs1 - fs2) / step;
          g2(i) = (fs1 + fs2 - 2. * fcnmin) / step / step;
 
+         if (printCycles) {
 #ifdef _OPENMP
 #pragma omp critical
 #endif
-         {
+            {
+#ifdef _OPENMP
+               // must create thread-local MnPrint instances when printing inside threads
+               MnPrint printtl("Numerical2PGradientCalculator[OpenMP]");
+#endif
+               if (i == 0 && j == 0) {
 #ifdef _OPENMP
-            // must create thread-local MnPrint instances when printing inside threads
-            MnPrint printtl("Numerical2PGradientCalculator[OpenMP]");
+                  printtl.Debug([&](std::ostream &os) {
+#else
+                  print.Debug([&](std::ostream &os) {
 #endif
-            if (i == 0 && j == 0) {
+                     os << std::setw(10) << "parameter" << std::setw(6) << "cycle" << std::setw(15) << "x"
+                        << std::setw(15) << "step" << std::setw(15) << "f1" << std::setw(15) << "f2" << std::setw(15)
+                        << "grd" << std::setw(15) << "g2" << std::endl;
+                  });
+               }
 #ifdef _OPENMP
                printtl.Debug([&](std::ostream &os) {
 #else
                print.Debug([&](std::ostream &os) {
 #endif
-                  os << std::setw(10) << "parameter" << std::setw(6) << "cycle" << std::setw(15) << "x" << std::setw(15)
-                     << "step" << std::setw(15) << "f1" << std::setw(15) << "f2" << std::setw(15) << "grd"
-                     << std::setw(15) << "g2" << std::endl;
+                  const int pr = os.precision(13);
+                  const int iext = Trafo().ExtOfInt(i);
+                  os << std::setw(10) << Trafo().Name(iext) << std::setw(5) << j << "  " << x(i) << " " << step << " "
+                     << fs1 << " " << fs2 << " " << grd(i) << " " << g2(i) << std::endl;
+                  os.precision(pr);
                });
             }
-#ifdef _OPENMP
-            printtl.Debug([&](std::ostream &os) {
-#else
-            print.Debug([&](std::ostream &os) {
-#endif
-               const int pr = os.precision(13);
-               const int iext = Trafo().ExtOfInt(i);
-               os << std::setw(10) << Trafo().Name(iext) << std::setw(5) << j << "  " << x(i) << " " << step << " "
-                  << fs1 << " " << fs2 << " " << grd(i) << " " << g2(i) << std::endl;
-               os.precision(pr);
-            });
          }
 
          if (std::fabs(grdb4 - grd(i)) / (std::fabs(grd(i)) + dfmin / step) < GradTolerance()) {
@@ -209,17 +194,55 @@ operator()(const MinimumParameters &par, const FunctionGradient &Gradient) const
             break;
          }
       }
+   };
+
+#ifdef R__USE_IMT
+   if (Strategy().ParallelDerivatives() && ROOT::IsImplicitMTEnabled() && n > 1) {
+      // Each task uses its own copy of the parameters. The cycles are not printed, as the output of the threads
+      // would be interleaved.
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(
+         [&](unsigned int i) {
+            MnAlgebraicVector x = par.Vec();
+            computeDerivative(i, x, false);
+         },
+         ROOT::TSeqU(n));
+   } else
+#endif
+   {
+#ifndef _OPENMP
 
-      //     vgrd(i) = grd;
-      //     vgrd2(i) = g2;
-      //     vgstp(i) = gstep;
-   }
+      MPIProcess mpiproc(n, 0);
+
+      // for serial execution this can be outside the loop
+      MnAlgebraicVector x = par.Vec();
+
+      unsigned int startElementIndex = mpiproc.StartElementIndex();
+      unsigned int endElementIndex = mpiproc.EndElementIndex();
+
+      for (unsigned int i = startElementIndex; i < endElementIndex; i++)
+         computeDerivative(i, x, true);
+
+      mpiproc.SyncVector(grd);
+      mpiproc.SyncVector(g2);
+      mpiproc.SyncVector(gstep);
+
+#else
+
+      // parallelize this loop using OpenMP
+//#define N_PARALLEL_PAR 5
+#pragma omp parallel
+#pragma omp for
+      //#pragma omp for schedule (static, N_PARALLEL_PAR)
+
+      for (int i = 0; i < int(n); i++) {
+         // create in loop since each thread will use its own copy
+         MnAlgebraicVector x = par.Vec();
+         computeDerivative(i, x, true);
+      }
 
-#ifndef _OPENMP
-   mpiproc.SyncVector(grd);
-   mpiproc.SyncVector(g2);
-   mpiproc.SyncVector(gstep);
 #endif
+   }
 
    // print after parallel processing to avoid synchronization issues
    print.Debug([&](std::ostream &os) {
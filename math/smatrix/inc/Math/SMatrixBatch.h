@@ -0,0 +1,602 @@
+// @(#)root/smatrix:$Id$
+
+#ifndef ROOT_Math_SMatrixBatch
+#define ROOT_Math_SMatrixBatch
+
+/*********************************************************************************
+//
+// Description: Batches of fixed size matrices and vectors, stored interleaved
+//              so that the same operation is applied to all the members of a
+//              batch by loops the compiler can vectorize.
+//
+***************************************************************************/
+
+#include "Math/SMatrix.h"
+#include "Math/SVector.h"
+
+#include <array>
+#include <cmath>
+#include <utility>
+
+
+namespace ROOT {
+
+namespace Math {
+
+//__________________________________________________________________________
+/**
+    SMatrixBatch: a batch of N independent D1 x D2 matrices.
+
+    The matrices are stored interleaved: the N values of element (i,j) are
+    contiguous, so that an operation on the batch is a loop over the matrix
+    elements whose innermost loop runs over the N lanes. With N a multiple of the
+    SIMD width (e.g. 4 or 8 for double) one instruction processes several matrices.
+    It is meant for workloads such as track fits, where the same small-matrix
+    algebra (e.g. a Kalman filter update) is repeated on many independent tracks.
+
+    The lanes are filled and read back with SetLane() and GetLane(), or element by
+    element with operator()(i, j, lane).
+
+    @ingroup SMatrixSVector
+*/
+template <class T, unsigned int D1, unsigned int D2, unsigned int N>
+class SMatrixBatch {
+
+public:
+   typedef T value_type;
+
+   enum {
+      kRows = D1,  ///< number of rows
+      kCols = D2,  ///< number of columns
+      kSize = D1 * D2, ///< number of elements of each matrix
+      kLanes = N  ///< number of matrices in the batch
+   };
+
+   /// default constructor: all the matrices are zero
+   SMatrixBatch() : fArray() {}
+
+   /// element (i,j) of the matrix of the given lane
+   T &operator()(unsigned int i, unsigned int j, unsigned int lane) { return fArray[(i * D2 + j) * N + lane]; }
+   const T &operator()(unsigned int i, unsigned int j, unsigned int lane) const
+   {
+      return fArray[(i * D2 + j) * N + lane];
+   }
+
+   /// the N values of element (i,j), one per lane
+   T *Lanes(unsigned int i, unsigned int j) { return &fArray[(i * D2 + j) * N]; }
+   const T *Lanes(unsigned int i, unsigned int j) const { return &fArray[(i * D2 + j) * N]; }
+
+   /// copy the matrix m in the given lane
+   template <class R>
+   void SetLane(unsigned int lane, const SMatrix<T, D1, D2, R> &m)
+   {
+      for (unsigned int i = 0; i < D1; ++i)
+         for (unsigned int j = 0; j < D2; ++j)
+            (*this)(i, j, lane) = m(i, j);
+   }
+
+   /// return the matrix of the given lane
+   SMatrix<T, D1, D2> GetLane(unsigned int lane) const
+   {
+      SMatrix<T, D1, D2> m;
+      for (unsigned int i = 0; i < D1; ++i)
+         for (unsigned int j = 0; j < D2; ++j)
+            m(i, j) = (*this)(i, j, lane);
+      return m;
+   }
+
+   /// set all the matrices to the identity
+   void SetIdentity()
+   {
+      for (unsigned int i = 0; i < D1; ++i)
+         for (unsigned int j = 0; j < D2; ++j)
+            for (unsigned int l = 0; l < N; ++l)
+               (*this)(i, j, l) = (i == j) ? T(1) : T(0);
+   }
+
+   SMatrixBatch &operator+=(const SMatrixBatch &rhs)
+   {
+      for (unsigned int k = 0; k < kSize * N; ++k)
+         fArray[k] += rhs.fArray[k];
+      return *this;
+   }
+
+   SMatrixBatch &operator-=(const SMatrixBatch &rhs)
+   {
+      for (unsigned int k = 0; k < kSize * N; ++k)
+         fArray[k] -= rhs.fArray[k];
+      return *this;
+   }
+
+   SMatrixBatch &operator*=(const T &rhs)
+   {
+      for (unsigned int k = 0; k < kSize * N; ++k)
+         fArray[k] *= rhs;
+      return *this;
+   }
+
+   /// invert in place all the square matrices of the batch; see ROOT::Math::Invert
+   bool Invert(bool *ok = nullptr);
+
+   /// invert in place all the symmetric positive definite matrices of the batch using
+   /// a Cholesky decomposition; see CholeskyDecompBatch
+   bool InvertChol(bool *ok = nullptr);
+
+private:
+   T fArray[kSize * N];
+};
+
+//__________________________________________________________________________
+/**
+    SVectorBatch: a batch of N independent vectors of dimension D, stored
+    interleaved like SMatrixBatch.
+
+    @ingroup SMatrixSVector
+*/
+template <class T, unsigned int D, unsigned int N>
+class SVectorBatch {
+
+public:
+   typedef T value_type;
+
+   enum {
+      kSize = D, ///< dimension of each vector
+      kLanes = N ///< number of vectors in the batch
+   };
+
+   /// default constructor: all the vectors are zero
+   SVectorBatch() : fArray() {}
+
+   /// element i of the vector of the given lane
+   T &operator()(unsigned int i, unsigned int lane) { return fArray[i * N + lane]; }
+   const T &operator()(unsigned int i, unsigned int lane) const { return fArray[i * N + lane]; }
+
+   /// the N values of element i, one per lane
+   T *Lanes(unsigned int i) { return &fArray[i * N]; }
+   const T *Lanes(unsigned int i) const { return &fArray[i * N]; }
+
+   /// copy the vector v in the given lane
+   void SetLane(unsigned int lane, const SVector<T, D> &v)
+   {
+      for (unsigned int i = 0; i < D; ++i)
+         (*this)(i, lane) = v[i];
+   }
+
+   /// return the vector of the given lane
+   SVector<T, D> GetLane(unsigned int lane) const
+   {
+      SVector<T, D> v;
+      for (unsigned int i = 0; i < D; ++i)
+         v[i] = (*this)(i, lane);
+      return v;
+   }
+
+   SVectorBatch &operator+=(const SVectorBatch &rhs)
+   {
+      for (unsigned int k = 0; k < D * N; ++k)
+         fArray[k] += rhs.fArray[k];
+      return *this;
+   }
+
+   SVectorBatch &operator-=(const SVectorBatch &rhs)
+   {
+      for (unsigned int k = 0; k < D * N; ++k)
+         fArray[k] -= rhs.fArray[k];
+      return *this;
+   }
+
+private:
+   T fArray[D * N];
+};
+
+
+//==============================================================================
+// operations on batches
+//==============================================================================
+
+template <class T, unsigned int D1, unsigned int D2, unsigned int N>
+inline SMatrixBatch<T, D1, D2, N> operator+(SMatrixBatch<T, D1, D2, N> lhs, const SMatrixBatch<T, D1, D2, N> &rhs)
+{
+   return lhs += rhs;
+}
+
+template <class T, unsigned int D1, unsigned int D2, unsigned int N>
+inline SMatrixBatch<T, D1, D2, N> operator-(SMatrixBatch<T, D1, D2, N> lhs, const SMatrixBatch<T, D1, D2, N> &rhs)
+{
+   return lhs -= rhs;
+}
+
+template <class T, unsigned int D, unsigned int N>
+inline SVectorBatch<T, D, N> operator+(SVectorBatch<T, D, N> lhs, const SVectorBatch<T, D, N> &rhs)
+{
+   return lhs += rhs;
+}
+
+template <class T, unsigned int D, unsigned int N>
+inline SVectorBatch<T, D, N> operator-(SVectorBatch<T, D, N> lhs, const SVectorBatch<T, D, N> &rhs)
+{
+   return lhs -= rhs;
+}
+
+/**
+   Matrix product of each lane: C = A * B
+
+   @ingroup MatrixFunctions
+*/
+template <class T, unsigned int D1, unsigned int D, unsigned int D2, unsigned int N>
+inline SMatrixBatch<T, D1, D2, N> operator*(const SMatrixBatch<T, D1, D, N> &lhs, const SMatrixBatch<T, D, D2, N> &rhs)
+{
+   SMatrixBatch<T, D1, D2, N> result;
+   for (unsigned int i = 0; i < D1; ++i) {
+      for (unsigned int k = 0; k < D; ++k) {
+         const T *a = lhs.Lanes(i, k);
+         for (unsigned int j = 0; j < D2; ++j) {
+            const T *b = rhs.Lanes(k, j);
+            T *c = result.Lanes(i, j);
+            for (unsigned int l = 0; l < N; ++l)
+               c[l] += a[l] * b[l];
+         }
+      }
+   }
+   return result;
+}
+
+/**
+   Matrix - vector product of each lane: w = A * v
+
+   @ingroup MatrixFunctions
+*/
+template <class T, unsigned int D1, unsigned int D2, unsigned int N>
+inline SVectorBatch<T, D1, N> operator*(const SMatrixBatch<T, D1, D2, N> &lhs, const SVectorBatch<T, D2, N> &rhs)
+{
+   SVectorBatch<T, D1, N> result;
+   for (unsigned int i = 0; i < D1; ++i) {
+      T *w = result.Lanes(i);
+      for (unsigned int k = 0; k < D2; ++k) {
+         const T *a = lhs.Lanes(i, k);
+         const T *v = rhs.Lanes(k);
+         for (unsigned int l = 0; l < N; ++l)
+            w[l] += a[l] * v[l];
+      }
+   }
+   return result;
+}
+
+/**
+   Transpose of each lane
+
+   @ingroup MatrixFunctions
+*/
+template <class T, unsigned int D1, unsigned int D2, unsigned int N>
+inline SMatrixBatch<T, D2, D1, N> Transpose(const SMatrixBatch<T, D1, D2, N> &rhs)
+{
+   SMatrixBatch<T, D2, D1, N> result;
+   for (unsigned int i = 0; i < D1; ++i)
+      for (unsigned int j = 0; j < D2; ++j)
+         for (unsigned int l = 0; l < N; ++l)
+            result(j, i, l) = rhs(i, j, l);
+   return result;
+}
+
+/**
+   Similarity of each lane: U * A * U^T, with A symmetric.
+   As for SMatrix, the product is computed as (U * A) * U^T and the result is
+   symmetrized exactly.
+
+   @ingroup MatrixFunctions
+*/
+template <class T, unsigned int D1, unsigned int D2, unsigned int N>
+inline SMatrixBatch<T, D1, D1, N> Similarity(const SMatrixBatch<T, D1, D2, N> &lhs, const SMatrixBatch<T, D2, D2, N> &rhs)
+{
+   const SMatrixBatch<T, D1, D2, N> tmp = lhs * rhs;
+   SMatrixBatch<T, D1, D1, N> result;
+   for (unsigned int i = 0; i < D1; ++i) {
+      for (unsigned int j = 0; j <= i; ++j) {
+         T *c = result.Lanes(i, j);
+         for (unsigned int k = 0; k < D2; ++k) {
+            const T *a = tmp.Lanes(i, k);
+            const T *b = lhs.Lanes(j, k);
+            for (unsigned int l = 0; l < N; ++l)
+               c[l] += a[l] * b[l];
+         }
+         if (i != j) {
+            T *cT = result.Lanes(j, i);
+            for (unsigned int l = 0; l < N; ++l)
+               cT[l] = c[l];
+         }
+      }
+   }
+   return result;
+}
+
+/**
+   Similarity vector - matrix product of each lane: v^T * A * v
+
+   @ingroup MatrixFunctions
+*/
+template <class T, unsigned int D, unsigned int N>
+inline std::array<T, N> Similarity(const SMatrixBatch<T, D, D, N> &lhs, const SVectorBatch<T, D, N> &rhs)
+{
+   const SVectorBatch<T, D, N> tmp = lhs * rhs;
+   std::array<T, N> result{};
+   for (unsigned int i = 0; i < D; ++i) {
+      const T *a = tmp.Lanes(i);
+      const T *b = rhs.Lanes(i);
+      for (unsigned int l = 0; l < N; ++l)
+         result[l] += a[l] * b[l];
+   }
+   return result;
+}
+
+
+//__________________________________________________________________________
+/**
+    CholeskyDecompBatch: Cholesky decomposition of a batch of symmetric positive
+    definite matrices, following CholeskyDecomp.
+
+    Only the lower triangle of the matrices is read. A lane for which the
+    decomposition fails (matrix not positive definite) is flagged, and its
+    results must not be used; the other lanes are not affected.
+
+    @ingroup SMatrixSVector
+*/
+template <class T, unsigned int D, unsigned int N>
+class CholeskyDecompBatch {
+
+private:
+   /// lower triangular matrices L, packed storage, with diagonal elements pre-inverted
+   T fL[D * (D + 1) / 2][N];
+   /// flags indicating a successful decomposition of each lane
+   bool fOk[N];
+
+public:
+   /// perform the Cholesky decomposition of all the lanes of m
+   explicit CholeskyDecompBatch(const SMatrixBatch<T, D, D, N> &m)
+   {
+      // element L(i,j) is at packed position (i * (i+1)) / 2 + j
+      T ok[N];
+      for (unsigned int l = 0; l < N; ++l)
+         ok[l] = T(1);
+      for (unsigned int i = 0; i < D; ++i) {
+         const unsigned int basei = (i * (i + 1)) / 2;
+         T tmpdiag[N];
+         for (unsigned int l = 0; l < N; ++l)
+            tmpdiag[l] = T(0);
+         for (unsigned int j = 0; j < i; ++j) {
+            const unsigned int basej = (j * (j + 1)) / 2;
+            const T *src = m.Lanes(i, j);
+            T *lij = fL[basei + j];
+            for (unsigned int l = 0; l < N; ++l)
+               lij[l] = src[l];
+            for (unsigned int k = 0; k < j; ++k) {
+               const T *a = fL[basei + k];
+               const T *b = fL[basej + k];
+               for (unsigned int l = 0; l < N; ++l)
+                  lij[l] -= a[l] * b[l];
+            }
+            const T *ljj = fL[basej + j];
+            for (unsigned int l = 0; l < N; ++l) {
+               lij[l] *= ljj[l];
+               tmpdiag[l] += lij[l] * lij[l];
+            }
+         }
+         const T *src = m.Lanes(i, i);
+         T *lii = fL[basei + i];
+         for (unsigned int l = 0; l < N; ++l) {
+            T d = src[l] - tmpdiag[l];
+            // a lane which is not positive definite is flagged, and continues with
+            // a dummy value so that the loop stays branch free
+            ok[l] = (d > T(0)) ? ok[l] : T(0);
+            d = (d > T(0)) ? d : T(1);
+            lii[l] = std::sqrt(T(1) / d);
+         }
+      }
+      for (unsigned int l = 0; l < N; ++l)
+         fOk[l] = (ok[l] != T(0));
+   }
+
+   /// return true if the decomposition of all the lanes succeeded
+   bool Ok() const
+   {
+      for (unsigned int l = 0; l < N; ++l)
+         if (!fOk[l])
+            return false;
+      return true;
+   }
+
+   /// return true if the decomposition of the given lane succeeded
+   bool Ok(unsigned int lane) const { return fOk[lane]; }
+
+   /// solve the linear systems M x = rhs of all the lanes, rhs is replaced by the solutions
+   bool Solve(SVectorBatch<T, D, N> &rhs) const
+   {
+      // solve Ly = rhs
+      for (unsigned int k = 0; k < D; ++k) {
+         const unsigned int base = (k * (k + 1)) / 2;
+         T *r = rhs.Lanes(k);
+         for (unsigned int i = 0; i < k; ++i) {
+            const T *y = rhs.Lanes(i);
+            const T *a = fL[base + i];
+            for (unsigned int l = 0; l < N; ++l)
+               r[l] -= y[l] * a[l];
+         }
+         // elements on diagonale are pre-inverted!
+         const T *d = fL[base + k];
+         for (unsigned int l = 0; l < N; ++l)
+            r[l] *= d[l];
+      }
+      // solve L^Tx = y
+      for (unsigned int k = D; k--;) {
+         T *r = rhs.Lanes(k);
+         for (unsigned int i = k + 1; i < D; ++i) {
+            const T *x = rhs.Lanes(i);
+            const T *a = fL[(i * (i + 1)) / 2 + k];
+            for (unsigned int l = 0; l < N; ++l)
+               r[l] -= x[l] * a[l];
+         }
+         const T *d = fL[(k * (k + 1)) / 2 + k];
+         for (unsigned int l = 0; l < N; ++l)
+            r[l] *= d[l];
+      }
+      return Ok();
+   }
+
+   /// place the inverses of the decomposed matrices in m
+   bool Invert(SMatrixBatch<T, D, D, N> &m) const
+   {
+      // invert the off-diagonal part of L
+      T li[D * (D + 1) / 2][N];
+      for (unsigned int k = 0; k < D * (D + 1) / 2; ++k)
+         for (unsigned int l = 0; l < N; ++l)
+            li[k][l] = fL[k][l];
+      for (unsigned int i = 1; i < D; ++i) {
+         const unsigned int basei = (i * (i + 1)) / 2;
+         for (unsigned int j = 0; j < i; ++j) {
+            T tmp[N];
+            for (unsigned int l = 0; l < N; ++l)
+               tmp[l] = T(0);
+            for (unsigned int k = j; k < i; ++k) {
+               const T *a = li[basei + k];
+               const T *b = li[(k * (k + 1)) / 2 + j];
+               for (unsigned int l = 0; l < N; ++l)
+                  tmp[l] -= a[l] * b[l];
+            }
+            for (unsigned int l = 0; l < N; ++l)
+               li[basei + j][l] = tmp[l] * li[basei + i][l];
+         }
+      }
+      // Li = L^(-1) formed, now calculate M^(-1) = Li^T Li
+      for (unsigned int i = 0; i < D; ++i) {
+         for (unsigned int j = 0; j <= i; ++j) {
+            T *dst = m.Lanes(i, j);
+            for (unsigned int l = 0; l < N; ++l)
+               dst[l] = T(0);
+            for (unsigned int k = i; k < D; ++k) {
+               const T *a = li[(k * (k + 1)) / 2 + i];
+               const T *b = li[(k * (k + 1)) / 2 + j];
+               for (unsigned int l = 0; l < N; ++l)
+                  dst[l] += a[l] * b[l];
+            }
+            if (i != j) {
+               T *dstT = m.Lanes(j, i);
+               for (unsigned int l = 0; l < N; ++l)
+                  dstT[l] = dst[l];
+            }
+         }
+      }
+      return Ok();
+   }
+};
+
+
+/**
+   Invert in place all the square matrices of a batch, using Gauss-Jordan
+   elimination with partial pivoting in each lane.
+   The pivot search and the row exchanges are done lane by lane, the
+   elimination for all the lanes at once.
+   A lane holding a singular matrix is flagged in ok (if given) and contains
+   undefined values; the other lanes are not affected.
+
+   @returns true if all the matrices were inverted
+
+   @ingroup MatrixFunctions
+*/
+template <class T, unsigned int D, unsigned int N>
+bool Invert(SMatrixBatch<T, D, D, N> &m, bool *ok = nullptr)
+{
+   SMatrixBatch<T, D, D, N> inv;
+   inv.SetIdentity();
+   bool allOk = true;
+   if (ok) {
+      for (unsigned int l = 0; l < N; ++l)
+         ok[l] = true;
+   }
+   for (unsigned int k = 0; k < D; ++k) {
+      // choose the pivot of column k and move it on the diagonal
+      for (unsigned int l = 0; l < N; ++l) {
+         unsigned int p = k;
+         T pmax = std::abs(m(k, k, l));
+         for (unsigned int i = k + 1; i < D; ++i) {
+            const T a = std::abs(m(i, k, l));
+            if (a > pmax) {
+               pmax = a;
+               p = i;
+            }
+         }
+         if (p != k) {
+            for (unsigned int j = 0; j < D; ++j) {
+               std::swap(m(k, j, l), m(p, j, l));
+               std::swap(inv(k, j, l), inv(p, j, l));
+            }
+         }
+      }
+      // normalize row k
+      T rpiv[N];
+      const T *piv = m.Lanes(k, k);
+      for (unsigned int l = 0; l < N; ++l)
+         rpiv[l] = (piv[l] != T(0)) ? T(1) / piv[l] : T(0);
+      for (unsigned int l = 0; l < N; ++l) {
+         if (rpiv[l] == T(0)) {
+            allOk = false;
+            if (ok)
+               ok[l] = false;
+         }
+      }
+      for (unsigned int j = 0; j < D; ++j) {
+         T *a = m.Lanes(k, j);
+         T *b = inv.Lanes(k, j);
+         for (unsigned int l = 0; l < N; ++l) {
+            a[l] *= rpiv[l];
+            b[l] *= rpiv[l];
+         }
+      }
+      // eliminate column k from the other rows
+      for (unsigned int i = 0; i < D; ++i) {
+         if (i == k)
+            continue;
+         T f[N];
+         const T *mik = m.Lanes(i, k);
+         for (unsigned int l = 0; l < N; ++l)
+            f[l] = mik[l];
+         for (unsigned int j = 0; j < D; ++j) {
+            const T *ak = m.Lanes(k, j);
+            const T *bk = inv.Lanes(k, j);
+            T *a = m.Lanes(i, j);
+            T *b = inv.Lanes(i, j);
+            for (unsigned int l = 0; l < N; ++l) {
+               a[l] -= f[l] * ak[l];
+               b[l] -= f[l] * bk[l];
+            }
+         }
+      }
+   }
+   m = inv;
+   return allOk;
+}
+
+template <class T, unsigned int D1, unsigned int D2, unsigned int N>
+inline bool SMatrixBatch<T, D1, D2, N>::Invert(bool *ok)
+{
+   static_assert(D1 == D2, "SMatrixBatch::Invert requires square matrices");
+   return ROOT::Math::Invert(*this, ok);
+}
+
+template <class T, unsigned int D1, unsigned int D2, unsigned int N>
+inline bool SMatrixBatch<T, D1, D2, N>::InvertChol(bool *ok)
+{
+   static_assert(D1 == D2, "SMatrixBatch::InvertChol requires square matrices");
+   CholeskyDecompBatch<T, D1, N> decomp(*this);
+   decomp.Invert(*this);
+   if (ok) {
+      for (unsigned int l = 0; l < N; ++l)
+         ok[l] = decomp.Ok(l);
+   }
+   return decomp.Ok();
+}
+
+}  // namespace Math
+
+}  // namespace ROOT
+
+
+#endif  /* ROOT_Math_SMatrixBatch  */
@@ -55,6 +55,11 @@ class TUnuranEmpDist;
 
    In addition is possible to set the random number generator in the constructor of the class, its seed
    via the TUnuran::SetSeed() method.
+
+   For sampling in multiple threads, initialize a single TUnuran object and call TUnuran::Clone for each
+   thread. The clones copy the already set-up UNU.RAN generator (no new setup is performed) and use their
+   own random number generator, so each thread samples an independent and reproducible stream.
+   Arrays of random numbers can be filled with TUnuran::Generate and TUnuran::GenerateDiscr.
 */
 
 
@@ -211,6 +216,38 @@ public:
    */
    int SampleDiscr();
 
+   /**
+      Sample n values of a continuous distribution and store them in x.
+      For multi-dimensional distributions x must have a size of at least n times the dimension,
+      and the points are stored one after the other.
+      Return false if the generator is not initialized.
+   */
+   bool Generate(unsigned int n, double * x);
+
+   /**
+      Sample n values of a discrete distribution and store them in x.
+      Return false if the generator is not initialized.
+   */
+   bool GenerateDiscr(unsigned int n, int * x);
+
+   /**
+      Create a copy of the initialized generator which samples using the given random engine.
+      The (possibly expensive) setup of the UNU.RAN method is not repeated, only its tables are copied.
+      Clones are independent of each other and can be used concurrently, one per thread.
+      When initialized from a distribution object, the clones share the distribution with this object,
+      which must therefore outlive them and must not be re-initialized while they are used.
+      Methods evaluating the PDF or CDF during sampling (e.g. rejection in TDR) require these
+      functions to be thread safe.
+      Return a null pointer if this object is not initialized.
+   */
+   std::unique_ptr<TUnuran> Clone(TRandom * r) const;
+
+   /**
+      Create a copy of the initialized generator (see above) owning a new TRandom3 engine
+      with the given seed.
+   */
+   std::unique_ptr<TUnuran> Clone(unsigned int seed) const;
+
    /**
       Set the random engine.
       Must be called before init to have effect
@@ -309,6 +346,7 @@ protected:
    UNUR_URNG  * fUrng;                   // pointer to Unuran C random generator struct
    std::unique_ptr<TUnuranBaseDist> fDist; // pointer for distribution wrapper
    TRandom * fRng;                       //pointer to ROOT random number generator
+   std::unique_ptr<TRandom> fOwnedRng;   //! random number generator owned by clones created with a seed
    std::string fMethod;                  //string representing the method
 
 };
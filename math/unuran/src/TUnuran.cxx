@@ -21,6 +21,7 @@
 #include "UnuranDistrAdapter.h"
 
 #include "TRandom.h"
+#include "TRandom3.h"
 
 #include <cassert>
 
@@ -441,6 +442,57 @@ bool TUnuran::SampleMulti(double * x)
    return true;
 }
 
+bool TUnuran::Generate(unsigned int n, double * x)
+{
+   // sample n values (or points for multidimensional distributions) in one go
+   if (fGen == 0) return false;
+   if (unur_distr_is_cvec(unur_get_distr(fGen)) || unur_distr_is_cvemp(unur_get_distr(fGen))) {
+      const int ndim = unur_get_dimension(fGen);
+      for (unsigned int i = 0; i < n; ++i)
+         unur_sample_vec(fGen, x + i * ndim);
+      return true;
+   }
+   for (unsigned int i = 0; i < n; ++i)
+      x[i] = unur_sample_cont(fGen);
+   return true;
+}
+
+bool TUnuran::GenerateDiscr(unsigned int n, int * x)
+{
+   // sample n values of a discrete distribution in one go
+   if (fGen == 0) return false;
+   for (unsigned int i = 0; i < n; ++i)
+      x[i] = unur_sample_discr(fGen);
+   return true;
+}
+
+std::unique_ptr<TUnuran> TUnuran::Clone(TRandom * r) const
+{
+   // copy the initialized generator, using the given random engine
+   // the distribution objects stay owned by this instance: when the generator was created with
+   // the string API the clone gets its own private copy of the distribution
+   if (fGen == 0 || r == 0) return nullptr;
+   std::unique_ptr<TUnuran> clone(new TUnuran(r));
+   clone->fMethod = fMethod;
+   clone->fGen = unur_gen_clone(fGen);
+   if (clone->fGen == 0) {
+      Error("Clone","Cannot clone generator object");
+      return nullptr;
+   }
+   // the cloned generator still points to the random engine of this instance
+   if (! clone->SetRandomGenerator() ) return nullptr;
+   return clone;
+}
+
+std::unique_ptr<TUnuran> TUnuran::Clone(unsigned int seed) const
+{
+   // copy the initialized generator with an own TRandom3 engine
+   auto rng = std::make_unique<TRandom3>(seed);
+   auto clone = Clone(rng.get());
+   if (clone) clone->fOwnedRng = std::move(rng);
+   return clone;
+}
+
 void TUnuran::SetSeed(unsigned int seed) {
    return fRng->SetSeed(seed);
 }
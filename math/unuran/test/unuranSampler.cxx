@@ -8,6 +8,10 @@
 #include "Math/Functor.h"
 #include "TH1.h"
 #include "TH2.h"
+#include "TUnuran.h"
+
+#include <thread>
+#include <vector>
 
 using namespace ROOT::Math; 
 
@@ -229,4 +233,43 @@ TEST(MultiDim, DistSamplerOptAPI){
     EXPECT_NEAR(h1->GetRMS(2), 2, 10*h1->GetRMSError(2));
     EXPECT_NEAR(h1->GetCorrelationFactor(1,2), 0.7, 0.1);
     
-}
\ No newline at end of file
+}
+
+// test cloning an initialized generator and sampling the clones in parallel
+TEST(OneDim, CloneParallel)
+{
+    TUnuran unr;
+    bool ret = unr.Init("normal(3.,0.75); domain = (0,6)", "method = tdr; c = 0");
+    EXPECT_EQ(ret, true);
+    if (!ret) return;
+
+    const unsigned int nthreads = 4;
+    const unsigned int n = 10000;
+    std::vector<std::unique_ptr<TUnuran>> clones;
+    for (unsigned int i = 0; i < nthreads; ++i) {
+        clones.emplace_back(unr.Clone(i + 1));
+        ASSERT_TRUE(clones.back() != nullptr);
+    }
+
+    std::vector<std::vector<double>> values(nthreads, std::vector<double>(n));
+    std::vector<std::thread> threads;
+    for (unsigned int i = 0; i < nthreads; ++i)
+        threads.emplace_back([&, i]() { clones[i]->Generate(n, values[i].data()); });
+    for (auto &t : threads)
+        t.join();
+
+    for (unsigned int i = 0; i < nthreads; ++i) {
+        TH1D h1("h1", "h1", 100, 0, 6);
+        for (auto x : values[i])
+            h1.Fill(x);
+        EXPECT_NEAR(h1.GetMean(), 3., 5 * h1.GetMeanError());
+        EXPECT_NEAR(h1.GetRMS(), 0.75, 5 * h1.GetRMSError());
+    }
+    EXPECT_NE(values[0][0], values[1][0]);
+
+    // a clone with the same seed reproduces the same stream
+    auto again = unr.Clone(1u);
+    std::vector<double> repeated(n);
+    again->Generate(n, repeated.data());
+    EXPECT_EQ(repeated, values[0]);
+}
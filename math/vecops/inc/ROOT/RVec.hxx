@@ -58,6 +58,20 @@ namespace ROOT {
 namespace VecOps {
 template<typename T>
 class RVec;
+
+/// \brief Let each thread recycle the heap buffers of the RVecs it destroys, up to `bytesPerThread` bytes.
+/// \param[in] bytesPerThread Maximum size of the buffers kept by each thread, 0 to disable recycling (the default).
+///
+/// RVecs whose elements do not fit in the inline storage allocate a heap buffer, which is freed when the RVec is
+/// destroyed or grows. Code that creates and destroys RVecs of similar sizes for every event, e.g. RDataFrame
+/// Defines that return collections of objects, then spends much of its time in malloc and free, which also contend
+/// with each other in multi-thread event loops. With recycling enabled, freed buffers of up to 16 MB are cached by
+/// the thread that freed them, by power-of-two size class, and reused by the next RVecs of that thread that need a
+/// buffer of that size class, so that allocations are served without calls to the system allocator in steady state.
+///
+/// The setting can be changed at any time, also while RVecs exist. Disabling recycling frees the buffers cached by
+/// the current thread; the buffers cached by other threads are freed as they exit.
+void SetBufferPoolSize(std::size_t bytesPerThread);
 }
 
 namespace Internal {
@@ -116,6 +130,127 @@ inline uint64_t NextPowerOf2(uint64_t A)
    return A + 1;
 }
 
+/// Allocate the heap buffer of an RVec for at least `capacity` elements of `elementSize` bytes each, and update
+/// `capacity` to the number of elements the buffer actually fits. See ROOT::VecOps::SetBufferPoolSize().
+void *AllocateBuffer(std::size_t &capacity, std::size_t elementSize);
+
+/// Free a heap buffer of an RVec, obtained with AllocateBuffer(), malloc() or realloc(), that fits `capacity`
+/// elements of `elementSize` bytes each. See ROOT::VecOps::SetBufferPoolSize().
+void FreeBuffer(void *buffer, std::size_t capacity, std::size_t elementSize);
+
+/// \name Reductions of RVec<float> and RVec<double> with explicit SIMD lanes, see src/RVecKernels.cxx.
+/// The Max, Min, ArgMax and ArgMin kernels require a non-empty input.
+///@{
+float SumKernel(const float *v, std::size_t n);
+double SumKernel(const double *v, std::size_t n);
+float MaxKernel(const float *v, std::size_t n);
+double MaxKernel(const double *v, std::size_t n);
+float MinKernel(const float *v, std::size_t n);
+double MinKernel(const double *v, std::size_t n);
+std::size_t ArgMaxKernel(const float *v, std::size_t n);
+std::size_t ArgMaxKernel(const double *v, std::size_t n);
+std::size_t ArgMinKernel(const float *v, std::size_t n);
+std::size_t ArgMinKernel(const double *v, std::size_t n);
+///@}
+
+// Implementations of Sum, Max, Min, ArgMax and ArgMin, which use the kernels for RVec<float> and RVec<double>.
+template <typename T, typename R>
+R SumImpl(const T *v, std::size_t n, const R zero)
+{
+   return std::accumulate(v, v + n, zero);
+}
+inline float SumImpl(const float *v, std::size_t n, float zero)
+{
+   return zero + SumKernel(v, n);
+}
+inline double SumImpl(const double *v, std::size_t n, double zero)
+{
+   return zero + SumKernel(v, n);
+}
+
+template <typename T>
+T MaxImpl(const T *v, std::size_t n)
+{
+   return *std::max_element(v, v + n);
+}
+inline float MaxImpl(const float *v, std::size_t n)
+{
+   return n > 0 ? MaxKernel(v, n) : *v;
+}
+inline double MaxImpl(const double *v, std::size_t n)
+{
+   return n > 0 ? MaxKernel(v, n) : *v;
+}
+
+template <typename T>
+T MinImpl(const T *v, std::size_t n)
+{
+   return *std::min_element(v, v + n);
+}
+inline float MinImpl(const float *v, std::size_t n)
+{
+   return n > 0 ? MinKernel(v, n) : *v;
+}
+inline double MinImpl(const double *v, std::size_t n)
+{
+   return n > 0 ? MinKernel(v, n) : *v;
+}
+
+template <typename T>
+std::size_t ArgMaxImpl(const T *v, std::size_t n)
+{
+   return std::distance(v, std::max_element(v, v + n));
+}
+inline std::size_t ArgMaxImpl(const float *v, std::size_t n)
+{
+   return n > 0 ? ArgMaxKernel(v, n) : 0;
+}
+inline std::size_t ArgMaxImpl(const double *v, std::size_t n)
+{
+   return n > 0 ? ArgMaxKernel(v, n) : 0;
+}
+
+template <typename T>
+std::size_t ArgMinImpl(const T *v, std::size_t n)
+{
+   return std::distance(v, std::min_element(v, v + n));
+}
+inline std::size_t ArgMinImpl(const float *v, std::size_t n)
+{
+   return n > 0 ? ArgMinKernel(v, n) : 0;
+}
+inline std::size_t ArgMinImpl(const double *v, std::size_t n)
+{
+   return n > 0 ? ArgMinKernel(v, n) : 0;
+}
+
+/// Copy the `n` elements of `in` for which `mask` is true to `out`, which has room for `n` elements, and return their
+/// number. Trivially copyable elements are copied unconditionally, advancing the output position by the mask value,
+/// which avoids a data-dependent branch per element.
+template <typename T, typename V>
+std::size_t CopyMasked(const T *in, const V *mask, std::size_t n, T *out, std::true_type /*isTriviallyCopyable*/)
+{
+   std::size_t j = 0u;
+   for (std::size_t i = 0u; i < n; ++i) {
+      out[j] = in[i];
+      j += static_cast<bool>(mask[i]);
+   }
+   return j;
+}
+
+template <typename T, typename V>
+std::size_t CopyMasked(const T *in, const V *mask, std::size_t n, T *out, std::false_type /*isTriviallyCopyable*/)
+{
+   std::size_t j = 0u;
+   for (std::size_t i = 0u; i < n; ++i) {
+      if (mask[i]) {
+         out[j] = in[i];
+         ++j;
+      }
+   }
+   return j;
+}
+
 /// This is all the stuff common to all SmallVectors.
 class R__CLING_PTRCHECK(off) SmallVectorBase {
 public:
@@ -383,8 +518,9 @@ void R__CLING_PTRCHECK(off) SmallVectorTemplateBase<T, TriviallyCopyable>::grow(
    // Always grow, even from zero.
    size_t NewCapacity = size_t(NextPowerOf2(this->capacity() + 2));
    NewCapacity = std::min(std::max(NewCapacity, MinSize), this->SizeTypeMax());
-   T *NewElts = static_cast<T *>(malloc(NewCapacity * sizeof(T)));
+   T *NewElts = static_cast<T *>(AllocateBuffer(NewCapacity, sizeof(T)));
    R__ASSERT(NewElts != nullptr);
+   NewCapacity = std::min(NewCapacity, this->SizeTypeMax());
 
    // Move the elements over.
    this->uninitialized_move(this->begin(), this->end(), NewElts);
@@ -395,7 +531,7 @@ void R__CLING_PTRCHECK(off) SmallVectorTemplateBase<T, TriviallyCopyable>::grow(
 
       // If this wasn't grown from the inline copy, deallocate the old space.
       if (!this->isSmall())
-         free(this->begin());
+         FreeBuffer(this->begin(), this->capacity(), sizeof(T));
    }
 
    this->fBeginX = NewElts;
@@ -537,7 +673,7 @@ public:
       // Subclass has already destructed this vector's elements.
       // If this wasn't grown from the inline copy, deallocate the old space.
       if (!this->isSmall() && this->Owns())
-         free(this->begin());
+         Internal::VecOps::FreeBuffer(this->begin(), this->capacity(), sizeof(T));
    }
 
    // also give up adopted memory if applicable
@@ -1014,7 +1150,7 @@ RVecImpl<T> &RVecImpl<T>::operator=(RVecImpl<T> &&RHS)
       if (this->Owns()) {
          this->destroy_range(this->begin(), this->end());
          if (!this->isSmall())
-            free(this->begin());
+            Internal::VecOps::FreeBuffer(this->begin(), this->capacity(), sizeof(T));
       }
       this->fBeginX = RHS.fBeginX;
       this->fSize = RHS.fSize;
@@ -1216,14 +1352,9 @@ public:
 
       RVecN ret;
       ret.reserve(n);
-      size_type j = 0u;
-      for (size_type i = 0u; i < n; ++i) {
-         if (conds[i]) {
-            // the begin() is to go around the R__ASSERT in operator[]
-            ret.begin()[j] = this->operator[](i);
-            ++j;
-         }
-      }
+      // the begin() is to go around the R__ASSERT in operator[]
+      const auto j = Internal::VecOps::CopyMasked(this->begin(), conds.begin(), n, ret.begin(),
+                                                  std::is_trivially_copyable<T>{});
       ret.set_size(j);
       return ret;
    }
@@ -1860,7 +1991,7 @@ auto Dot(const RVec<T> &v0, const RVec<V> &v1) -> decltype(v0[0] * v1[0])
 template <typename T, typename R = T>
 R Sum(const RVec<T> &v, const R zero = R(0))
 {
-   return std::accumulate(v.begin(), v.end(), zero);
+   return Internal::VecOps::SumImpl(v.data(), v.size(), zero);
 }
 
 /// Get the mean of the elements of an RVec
@@ -1927,7 +2058,7 @@ R Mean(const RVec<T> &v, const R zero)
 template <typename T>
 T Max(const RVec<T> &v)
 {
-   return *std::max_element(v.begin(), v.end());
+   return Internal::VecOps::MaxImpl(v.data(), v.size());
 }
 
 /// Get the smallest element of an RVec
@@ -1943,7 +2074,7 @@ T Max(const RVec<T> &v)
 template <typename T>
 T Min(const RVec<T> &v)
 {
-   return *std::min_element(v.begin(), v.end());
+   return Internal::VecOps::MinImpl(v.data(), v.size());
 }
 
 /// Get the index of the greatest element of an RVec
@@ -1961,7 +2092,7 @@ T Min(const RVec<T> &v)
 template <typename T>
 std::size_t ArgMax(const RVec<T> &v)
 {
-   return std::distance(v.begin(), std::max_element(v.begin(), v.end()));
+   return Internal::VecOps::ArgMaxImpl(v.data(), v.size());
 }
 
 /// Get the index of the smallest element of an RVec
@@ -1979,7 +2110,7 @@ std::size_t ArgMax(const RVec<T> &v)
 template <typename T>
 std::size_t ArgMin(const RVec<T> &v)
 {
-   return std::distance(v.begin(), std::min_element(v.begin(), v.end()));
+   return Internal::VecOps::ArgMinImpl(v.data(), v.size());
 }
 
 /// Get the variance of the elements of an RVec
@@ -11,6 +11,10 @@
  *************************************************************************/
 
 #include "ROOT/RVec.hxx"
+
+#include <atomic>
+#include <cstdlib>
+
 using namespace ROOT::VecOps;
 
 // Check that no bytes are wasted and everything is well-aligned.
@@ -34,6 +38,123 @@ static_assert(sizeof(RVec<void *>) ==
                     (1 + ROOT::Internal::VecOps::RVecInlineStorageSize<void *>::value) * sizeof(void *),
               "wasted space in RVec");
 
+namespace {
+
+/// Buffers are recycled by size class: class n holds buffers of at least 2^n bytes.
+constexpr int kMinBufferClass = 6;  // 64 bytes
+constexpr int kMaxBufferClass = 24; // 16 MB
+
+/// Maximum size of the buffers cached by each thread, 0 if recycling is disabled.
+std::atomic<std::size_t> gBufferPoolSize{0};
+
+/// Smallest n such that 2^n >= size.
+int CeilLog2(std::size_t size)
+{
+   int n = 0;
+   while ((std::size_t(1) << n) < size)
+      ++n;
+   return n;
+}
+
+/// Largest n such that 2^n <= size.
+int FloorLog2(std::size_t size)
+{
+   int n = 0;
+   while ((std::size_t(1) << (n + 1)) <= size)
+      ++n;
+   return n;
+}
+
+/// The buffers cached by one thread. No locking is needed as buffers always go back to the pool of the thread that
+/// frees them, whichever thread allocated them.
+struct RBufferPool {
+   std::vector<void *> fFreeBuffers[kMaxBufferClass - kMinBufferClass + 1];
+   std::size_t fPooledBytes = 0;
+
+   void Clear()
+   {
+      for (auto &buffers : fFreeBuffers) {
+         for (auto *buffer : buffers)
+            free(buffer);
+         buffers.clear();
+      }
+      fPooledBytes = 0;
+   }
+   ~RBufferPool();
+};
+
+/// Set when the pool of this thread is destroyed at thread exit, after which RVecs go back to malloc and free.
+thread_local bool tlsBufferPoolDestroyed = false;
+
+RBufferPool::~RBufferPool()
+{
+   Clear();
+   tlsBufferPoolDestroyed = true;
+}
+
+RBufferPool *GetBufferPool()
+{
+   if (tlsBufferPoolDestroyed || gBufferPoolSize.load(std::memory_order_relaxed) == 0)
+      return nullptr;
+   thread_local RBufferPool pool;
+   return &pool;
+}
+
+} // anonymous namespace
+
+void ROOT::VecOps::SetBufferPoolSize(std::size_t bytesPerThread)
+{
+   auto *pool = GetBufferPool();
+   gBufferPoolSize = bytesPerThread;
+   if (pool && bytesPerThread == 0)
+      pool->Clear();
+}
+
+void *ROOT::Internal::VecOps::AllocateBuffer(std::size_t &capacity, std::size_t elementSize)
+{
+   const std::size_t bytes = capacity * elementSize;
+   auto *pool = GetBufferPool();
+   const int sizeClass = std::max(CeilLog2(bytes), kMinBufferClass);
+   if (!pool || sizeClass > kMaxBufferClass)
+      return malloc(bytes);
+
+   const std::size_t classBytes = std::size_t(1) << sizeClass;
+   void *buffer = nullptr;
+   auto &buffers = pool->fFreeBuffers[sizeClass - kMinBufferClass];
+   if (!buffers.empty()) {
+      buffer = buffers.back();
+      buffers.pop_back();
+      pool->fPooledBytes -= classBytes;
+   } else {
+      // allocate the whole size class, so that the buffer goes back to this class when it is freed
+      buffer = malloc(classBytes);
+   }
+   if (buffer)
+      capacity = classBytes / elementSize;
+   return buffer;
+}
+
+void ROOT::Internal::VecOps::FreeBuffer(void *buffer, std::size_t capacity, std::size_t elementSize)
+{
+   const std::size_t bytes = capacity * elementSize;
+   auto *pool = GetBufferPool();
+   if (!pool || bytes < (std::size_t(1) << kMinBufferClass)) {
+      free(buffer);
+      return;
+   }
+
+   // the buffer might be larger than its capacity, e.g. if it was allocated by malloc: classify it by the bytes it
+   // is known to have, rounding down
+   const int sizeClass = std::min(FloorLog2(bytes), kMaxBufferClass);
+   const std::size_t classBytes = std::size_t(1) << sizeClass;
+   if (pool->fPooledBytes + classBytes > gBufferPoolSize.load(std::memory_order_relaxed)) {
+      free(buffer);
+      return;
+   }
+   pool->fFreeBuffers[sizeClass - kMinBufferClass].push_back(buffer);
+   pool->fPooledBytes += classBytes;
+}
+
 void ROOT::Internal::VecOps::SmallVectorBase::report_size_overflow(size_t MinSize)
 {
    std::string Reason = "RVec unable to grow. Requested capacity (" + std::to_string(MinSize) +
@@ -68,12 +189,17 @@ void ROOT::Internal::VecOps::SmallVectorBase::grow_pod(void *FirstEl, size_t Min
    NewCapacity = std::min(std::max(NewCapacity, MinSize), SizeTypeMax());
 
    void *NewElts;
-   if (fBeginX == FirstEl || !this->Owns()) {
-      NewElts = malloc(NewCapacity * TSize);
+   if (fBeginX == FirstEl || !this->Owns() || GetBufferPool()) {
+      NewElts = AllocateBuffer(NewCapacity, TSize);
       R__ASSERT(NewElts != nullptr);
+      NewCapacity = std::min(NewCapacity, SizeTypeMax());
 
       // Copy the elements over.  No need to run dtors on PODs.
       memcpy(NewElts, this->fBeginX, size() * TSize);
+      // With buffer recycling enabled, also buffers that were not grown from the inline copy are moved to a new
+      // buffer of the next size class rather than grown with realloc.
+      if (fBeginX != FirstEl && this->Owns())
+         FreeBuffer(this->fBeginX, capacity(), TSize);
    } else {
       // If this wasn't grown from the inline copy, grow the allocated space.
       NewElts = realloc(this->fBeginX, NewCapacity * TSize);
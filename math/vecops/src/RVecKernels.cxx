@@ -0,0 +1,184 @@
+// Implementation of the reductions of RVec<float> and RVec<double> with explicit SIMD lanes.
+// See /math/vecops/ARCHITECTURE.md for more information.
+
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+// This file is compiled without -ffast-math: the kernels must give the same results as the scalar algorithms they
+// replace, also in presence of NaNs, except for the rounding of sums and the sign of zero maxima and minima.
+
+#include "ROOT/RVec.hxx"
+
+#include <cstddef>
+
+// On x86-64 Linux the kernels are compiled for several instruction sets, and the dynamic loader picks the best one the
+// CPU supports.
+#if defined(__x86_64__) && defined(__linux__) && defined(__GNUC__) && \
+   (!defined(__clang__) || __clang_major__ >= 14)
+#define R__RVEC_KERNEL __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define R__RVEC_KERNEL
+#endif
+
+namespace {
+
+/// Number of independent lanes the kernels work with: a whole cache line, i.e. 8 doubles or 16 floats.
+/// Operations on the lanes of the inner loops do not depend on each other, so that the compiler maps them onto SIMD
+/// registers of any width.
+template <typename T>
+constexpr std::size_t kLanes = 64 / sizeof(T);
+
+template <typename T>
+T SumLanes(const T *v, std::size_t n)
+{
+   T acc[kLanes<T>] = {};
+   std::size_t i = 0;
+   for (; i + kLanes<T> <= n; i += kLanes<T>)
+      for (std::size_t k = 0; k < kLanes<T>; ++k)
+         acc[k] += v[i + k];
+   T sum = 0;
+   for (std::size_t k = 0; k < kLanes<T>; ++k)
+      sum += acc[k];
+   for (; i < n; ++i)
+      sum += v[i];
+   return sum;
+}
+
+// Max and Min only replace the current value when the comparison with the new one is true, like std::max_element and
+// std::min_element: NaNs are never selected unless v[0] is NaN, in which case it is the result. `v` is not empty.
+template <typename T>
+T MaxLanes(const T *v, std::size_t n)
+{
+   T acc[kLanes<T>];
+   for (std::size_t k = 0; k < kLanes<T>; ++k)
+      acc[k] = v[0];
+   std::size_t i = 0;
+   for (; i + kLanes<T> <= n; i += kLanes<T>)
+      for (std::size_t k = 0; k < kLanes<T>; ++k)
+         acc[k] = v[i + k] > acc[k] ? v[i + k] : acc[k];
+   T max = acc[0];
+   for (std::size_t k = 1; k < kLanes<T>; ++k)
+      max = acc[k] > max ? acc[k] : max;
+   for (; i < n; ++i)
+      max = v[i] > max ? v[i] : max;
+   return max;
+}
+
+template <typename T>
+T MinLanes(const T *v, std::size_t n)
+{
+   T acc[kLanes<T>];
+   for (std::size_t k = 0; k < kLanes<T>; ++k)
+      acc[k] = v[0];
+   std::size_t i = 0;
+   for (; i + kLanes<T> <= n; i += kLanes<T>)
+      for (std::size_t k = 0; k < kLanes<T>; ++k)
+         acc[k] = v[i + k] < acc[k] ? v[i + k] : acc[k];
+   T min = acc[0];
+   for (std::size_t k = 1; k < kLanes<T>; ++k)
+      min = acc[k] < min ? acc[k] : min;
+   for (; i < n; ++i)
+      min = v[i] < min ? v[i] : min;
+   return min;
+}
+
+// Each lane keeps the first index at which its best value occurs. Among lanes with the same best value, the smallest
+// index is the first occurrence overall. `v` is not empty.
+template <typename T, typename Compare>
+std::size_t ArgBestLanes(const T *v, std::size_t n, Compare isBetter)
+{
+   T best[kLanes<T>];
+   std::size_t idx[kLanes<T>];
+   for (std::size_t k = 0; k < kLanes<T>; ++k) {
+      best[k] = v[0];
+      idx[k] = 0;
+   }
+   std::size_t i = 0;
+   for (; i + kLanes<T> <= n; i += kLanes<T>) {
+      for (std::size_t k = 0; k < kLanes<T>; ++k) {
+         const bool better = isBetter(v[i + k], best[k]);
+         best[k] = better ? v[i + k] : best[k];
+         idx[k] = better ? i + k : idx[k];
+      }
+   }
+   T bestValue = best[0];
+   std::size_t bestIdx = idx[0];
+   for (std::size_t k = 1; k < kLanes<T>; ++k) {
+      if (isBetter(best[k], bestValue) || (best[k] == bestValue && idx[k] < bestIdx)) {
+         bestValue = best[k];
+         bestIdx = idx[k];
+      }
+   }
+   for (; i < n; ++i) {
+      if (isBetter(v[i], bestValue)) {
+         bestValue = v[i];
+         bestIdx = i;
+      }
+   }
+   return bestIdx;
+}
+
+} // anonymous namespace
+
+namespace ROOT {
+namespace Internal {
+namespace VecOps {
+
+R__RVEC_KERNEL float SumKernel(const float *v, std::size_t n)
+{
+   return SumLanes(v, n);
+}
+
+R__RVEC_KERNEL double SumKernel(const double *v, std::size_t n)
+{
+   return SumLanes(v, n);
+}
+
+R__RVEC_KERNEL float MaxKernel(const float *v, std::size_t n)
+{
+   return MaxLanes(v, n);
+}
+
+R__RVEC_KERNEL double MaxKernel(const double *v, std::size_t n)
+{
+   return MaxLanes(v, n);
+}
+
+R__RVEC_KERNEL float MinKernel(const float *v, std::size_t n)
+{
+   return MinLanes(v, n);
+}
+
+R__RVEC_KERNEL double MinKernel(const double *v, std::size_t n)
+{
+   return MinLanes(v, n);
+}
+
+R__RVEC_KERNEL std::size_t ArgMaxKernel(const float *v, std::size_t n)
+{
+   return ArgBestLanes(v, n, [](float a, float b) { return a > b; });
+}
+
+R__RVEC_KERNEL std::size_t ArgMaxKernel(const double *v, std::size_t n)
+{
+   return ArgBestLanes(v, n, [](double a, double b) { return a > b; });
+}
+
+R__RVEC_KERNEL std::size_t ArgMinKernel(const float *v, std::size_t n)
+{
+   return ArgBestLanes(v, n, [](float a, float b) { return a < b; });
+}
+
+R__RVEC_KERNEL std::size_t ArgMinKernel(const double *v, std::size_t n)
+{
+   return ArgBestLanes(v, n, [](double a, double b) { return a < b; });
+}
+
+} // namespace VecOps
+} // namespace Internal
+} // namespace ROOT
@@ -12,6 +12,7 @@
 #include <vector>
 #include <sstream>
 #include <cmath>
+#include <limits>
 
 using namespace ROOT;
 using namespace ROOT::VecOps;
@@ -1292,6 +1293,79 @@ struct ThrowingCopy {
    ThrowingCopy &operator=(ThrowingCopy &&) = default;
 };
 
+TEST(VecOps, BufferPool)
+{
+   ROOT::VecOps::SetBufferPoolSize(1024 * 1024);
+
+   const double *buffer = nullptr;
+   {
+      ROOT::RVecD v(100, 1.);
+      EXPECT_EQ(v.capacity(), 128u); // buffers span a whole size class
+      buffer = v.data();
+   }
+   // the next RVec of the same size class reuses the buffer
+   ROOT::RVecD v1(120, 2.);
+   EXPECT_EQ(v1.data(), buffer);
+   EXPECT_EQ(Sum(v1), 240.);
+
+   // growing moves the elements to a buffer of the next size class
+   v1.resize(500, 3.);
+   EXPECT_EQ(Sum(v1), 240. + 380 * 3.);
+   const std::string longString = "a long string that does not fit in the small buffer of std::string";
+   ROOT::RVec<std::string> strings(100, longString);
+   strings.resize(1000, "b");
+   EXPECT_EQ(strings[0], longString);
+   EXPECT_EQ(strings[999], "b");
+
+   // buffers of adopted memory are never recycled
+   std::vector<double> vec(200, 4.);
+   {
+      ROOT::RVecD adopting(vec.data(), vec.size());
+   }
+   ROOT::RVecD v2(200, 5.);
+   EXPECT_NE(v2.data(), vec.data());
+   EXPECT_EQ(vec[0], 4.);
+
+   ROOT::VecOps::SetBufferPoolSize(0);
+}
+
+TEST(VecOps, ReductionKernels)
+{
+   // long enough to exercise both the lanes and the remainder of the kernels
+   ROOT::RVecD v(37);
+   for (std::size_t i = 0; i < v.size(); ++i)
+      v[i] = (i * 7) % 11;
+   ROOT::RVecF vf(v.begin(), v.end());
+
+   EXPECT_EQ(Sum(v), 185.);
+   EXPECT_EQ(Sum(vf), 185.f);
+   EXPECT_EQ(Max(v), 10.);
+   EXPECT_EQ(Min(vf), 0.f);
+   // ties are resolved in favour of the first occurrence
+   EXPECT_EQ(ArgMax(v), 3u);
+   EXPECT_EQ(ArgMax(vf), 3u);
+   EXPECT_EQ(ArgMin(v), 0u);
+   EXPECT_EQ(ArgMin(vf), 0u);
+
+   // NaNs are skipped, except at the first position
+   v[20] = std::numeric_limits<double>::quiet_NaN();
+   EXPECT_EQ(Max(v), 10.);
+   EXPECT_EQ(ArgMax(v), 3u);
+   v[0] = std::numeric_limits<double>::quiet_NaN();
+   EXPECT_TRUE(std::isnan(Max(v)));
+   EXPECT_EQ(ArgMin(v), 0u);
+
+   EXPECT_EQ(Sum(ROOT::RVecF{}), 0.f);
+   EXPECT_EQ(ArgMax(ROOT::RVecD{}), 0u);
+
+   ROOT::RVecF masked = vf[vf > 5.f];
+   EXPECT_EQ(masked.size(), 17u);
+   EXPECT_EQ(masked[0], 7.f);
+   EXPECT_TRUE(All(masked > 5.f));
+   ROOT::RVec<std::string> strings{"a", "b", "c"};
+   CheckEqual(strings[ROOT::RVecI{1, 0, 1}], ROOT::RVec<std::string>{"a", "c"});
+}
+
 // RVec does not guarantee exception safety, but we still want to test
 // that we don't segfault or otherwise crash if element construction or move throws.
 TEST(VecOps, NoExceptionSafety)
@@ -15,27 +15,37 @@
 #include "TParticlePDG.h"
 #include "TParticleClassPDG.h"
 
+#include <atomic>
+#include <utility>
+#include <vector>
+
 class THashList;
-class TExMap;
 
 class TDatabasePDG: public TNamed {
 
 protected:
+   enum { kPdgTableSize = 10000 };         // pdg-codes in ]-kPdgTableSize, kPdgTableSize[ are in fPdgTable
+
    THashList           *fParticleList;     // list of PDG particles
    TObjArray           *fListOfClasses;    // list of classes (leptons etc.)
-   mutable TExMap      *fPdgMap;           //!hash-map from pdg-code to particle
+   std::vector<TParticlePDG*> fPdgTable;   //!particles indexed by pdg-code + kPdgTableSize
+   std::vector<std::pair<Int_t, TParticlePDG*>> fPdgSorted; //!particles with other pdg-codes, sorted by pdg-code
+   mutable std::atomic<Bool_t> fInitialized; //!true once the particle table has been read
 
    // make copy-constructor and assigment protected since class cannot be copied
    TDatabasePDG(const TDatabasePDG& db)
      : TNamed(db), fParticleList(db.fParticleList),
-     fListOfClasses(db.fListOfClasses), fPdgMap(0) { }
+     fListOfClasses(db.fListOfClasses), fInitialized(kFALSE) { BuildPdgMap(); }
 
    TDatabasePDG& operator=(const TDatabasePDG& db)
    {if(this!=&db) {TNamed::operator=(db); fParticleList=db.fParticleList;
-         fListOfClasses=db.fListOfClasses; fPdgMap=db.fPdgMap;}
+         fListOfClasses=db.fListOfClasses; BuildPdgMap(); fInitialized=kFALSE;}
       return *this;}
 
-   void BuildPdgMap() const;
+   void AddToPdgMap(TParticlePDG *p);
+   void BuildPdgMap();
+   TParticlePDG *FindParticle(Int_t pdgCode) const;
+   void Initialize() const;
 
 public:
 
@@ -65,7 +75,7 @@ public:
    TParticlePDG  *GetParticle(const char *name) const;
 
    TParticleClassPDG* GetParticleClass(const char* name) {
-      if (fParticleList == 0)  ((TDatabasePDG*)this)->ReadPDGTable();
+      if (!fInitialized.load(std::memory_order_acquire))  Initialize();
       return (TParticleClassPDG*) fListOfClasses->FindObject(name);
    }
 
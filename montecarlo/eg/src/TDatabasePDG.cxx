@@ -13,13 +13,15 @@
 #include "TROOT.h"
 #include "TEnv.h"
 #include "THashList.h"
-#include "TExMap.h"
 #include "TSystem.h"
 #include "TDatabasePDG.h"
 #include "TDecayChannel.h"
 #include "TParticlePDG.h"
 #include <stdlib.h>
 
+#include <algorithm>
+#include <mutex>
+
 
 /** \class TDatabasePDG
     \ingroup eg
@@ -46,6 +48,12 @@ Root.DatabasePDG: $(HOME)/my_pdg_table.txt
 See TParticlePDG for the description of a static particle properties.
 See TParticle    for the description of a dynamic particle particle.
 
+The particle table is read once, under a lock, by the first lookup. After
+that, GetParticle() can be called concurrently from several threads: the
+lookup by pdg-code is a plain index in a flat array for the codes of the
+common particles, and a binary search in a sorted array for the others.
+Adding particles is not thread-safe.
+
 The current default pdg_table file displays lifetime 0 for some unstable particles.
 
 */
@@ -61,14 +69,23 @@ TDatabasePDG** GetInstancePtr()
    return &fgInstance;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Mutex serializing the creation of the instance and the reading of the particle table.
+
+static std::recursive_mutex &GetDatabasePDGMutex()
+{
+   static std::recursive_mutex mutex;
+   return mutex;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Create PDG database. Initialization of the DB has to be done via explicit
 /// call to ReadDataBasePDG (also done by GetParticle methods)
 
-TDatabasePDG::TDatabasePDG(): TNamed("PDGDB","The PDG particle data base")
+TDatabasePDG::TDatabasePDG(): TNamed("PDGDB","The PDG particle data base"),
+   fPdgTable(2*kPdgTableSize, nullptr), fInitialized(kFALSE)
 {
    fParticleList  = 0;
-   fPdgMap        = 0;
    fListOfClasses = 0;
    auto fgInstance = GetInstancePtr();
    if (*fgInstance != nullptr) {
@@ -87,7 +104,6 @@ TDatabasePDG::~TDatabasePDG()
    if (fParticleList) {
       fParticleList->Delete();
       delete fParticleList;    // this deletes all objects in the list
-      if (fPdgMap) delete fPdgMap;
    }
                                 // classes do not own particles...
    if (fListOfClasses) {
@@ -107,29 +123,69 @@ TDatabasePDG* TDatabasePDG::Instance()
 {
    auto fgInstance = GetInstancePtr();
    if (*fgInstance == nullptr) {
+      std::lock_guard<std::recursive_mutex> lock(GetDatabasePDGMutex());
       // Constructor creates a new instance, inits fgInstance.
-      new TDatabasePDG();
+      if (*fgInstance == nullptr)
+         new TDatabasePDG();
    }
    return *fgInstance;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Build fPdgMap mapping pdg-code to particle.
-///
-/// Initial size is set so as to be able to hold at least 600
-/// particles: 521 in default table, ALICE adds 54 more.
-/// To be revisited after LHC discovers SUSY.
+/// Read the default particle table, unless particles were already defined.
+/// Called by the first lookup; concurrent lookups wait for it to finish.
+
+void TDatabasePDG::Initialize() const
+{
+   std::lock_guard<std::recursive_mutex> lock(GetDatabasePDGMutex());
+   if (fInitialized.load(std::memory_order_relaxed))
+      return;
+   if (fParticleList == 0)  ((TDatabasePDG*)this)->ReadPDGTable();
+   fInitialized.store(kTRUE, std::memory_order_release);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add a particle to the tables mapping pdg-code to particle.
 
-void TDatabasePDG::BuildPdgMap() const
+void TDatabasePDG::AddToPdgMap(TParticlePDG *p)
 {
-   fPdgMap = new TExMap(4*TMath::Max(600, fParticleList->GetEntries())/3 + 3);
+   Int_t code = p->PdgCode();
+   if (code > -kPdgTableSize && code < kPdgTableSize) {
+      fPdgTable[code + kPdgTableSize] = p;
+      return;
+   }
+   auto it = std::lower_bound(fPdgSorted.begin(), fPdgSorted.end(), code,
+                              [](const std::pair<Int_t, TParticlePDG*> &e, Int_t c) { return e.first < c; });
+   fPdgSorted.emplace(it, code, p);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Build the tables mapping pdg-code to particle from the particle list.
+
+void TDatabasePDG::BuildPdgMap()
+{
+   fPdgTable.assign(2*kPdgTableSize, nullptr);
+   fPdgSorted.clear();
+   if (!fParticleList) return;
    TIter next(fParticleList);
    TParticlePDG *p;
    while ((p = (TParticlePDG*)next())) {
-      fPdgMap->Add((Long64_t)p->PdgCode(), (Long64_t)p);
+      AddToPdgMap(p);
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Find a particle by its pdg-code, without reading the particle table.
+
+TParticlePDG *TDatabasePDG::FindParticle(Int_t PDGcode) const
+{
+   if (PDGcode > -kPdgTableSize && PDGcode < kPdgTableSize)
+      return fPdgTable[PDGcode + kPdgTableSize];
+   auto it = std::lower_bound(fPdgSorted.begin(), fPdgSorted.end(), PDGcode,
+                              [](const std::pair<Int_t, TParticlePDG*> &e, Int_t c) { return e.first < c; });
+   return (it != fPdgSorted.end() && it->first == PDGcode) ? it->second : nullptr;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///
 ///  Particle definition normal constructor. If the particle is set to be
@@ -148,7 +204,8 @@ TParticlePDG* TDatabasePDG::AddParticle(const char *name, const char *title,
                                         Int_t Anti,
                                         Int_t TrackingCode)
 {
-   TParticlePDG* old = GetParticle(PDGcode);
+   if (fParticleList == 0)  Initialize();
+   TParticlePDG* old = FindParticle(PDGcode);
 
    if (old) {
       printf(" *** TDatabasePDG::AddParticle: particle with PDGcode=%d already defined\n",PDGcode);
@@ -159,10 +216,9 @@ TParticlePDG* TDatabasePDG::AddParticle(const char *name, const char *title,
                                      charge, ParticleClass, PDGcode, Anti,
                                      TrackingCode);
    fParticleList->Add(p);
-   if (fPdgMap)
-      fPdgMap->Add((Long64_t)PDGcode, (Long64_t)p);
+   AddToPdgMap(p);
 
-   TParticleClassPDG* pclass = GetParticleClass(ParticleClass);
+   TParticleClassPDG* pclass = (TParticleClassPDG*) fListOfClasses->FindObject(ParticleClass);
 
    if (!pclass) {
       pclass = new TParticleClassPDG(ParticleClass);
@@ -179,7 +235,8 @@ TParticlePDG* TDatabasePDG::AddParticle(const char *name, const char *title,
 
 TParticlePDG* TDatabasePDG::AddAntiParticle(const char* Name, Int_t PdgCode)
 {
-   TParticlePDG* old = GetParticle(PdgCode);
+   if (fParticleList == 0)  Initialize();
+   TParticlePDG* old = FindParticle(PdgCode);
 
    if (old) {
       printf(" *** TDatabasePDG::AddAntiParticle: can't redefine parameters\n");
@@ -187,7 +244,7 @@ TParticlePDG* TDatabasePDG::AddAntiParticle(const char* Name, Int_t PdgCode)
    }
 
    Int_t pdg_code  = abs(PdgCode);
-   TParticlePDG* p = GetParticle(pdg_code);
+   TParticlePDG* p = FindParticle(pdg_code);
 
    if (!p) {
       printf(" *** TDatabasePDG::AddAntiParticle: particle with pdg code %d not known\n", pdg_code);
@@ -215,7 +272,7 @@ TParticlePDG* TDatabasePDG::AddAntiParticle(const char* Name, Int_t PdgCode)
 
 TParticlePDG *TDatabasePDG::GetParticle(const char *name) const
 {
-   if (fParticleList == 0)  ((TDatabasePDG*)this)->ReadPDGTable();
+   if (!fInitialized.load(std::memory_order_acquire))  Initialize();
 
    TParticlePDG *def = (TParticlePDG *)fParticleList->FindObject(name);
 //     if (!def) {
@@ -231,10 +288,9 @@ TParticlePDG *TDatabasePDG::GetParticle(const char *name) const
 
 TParticlePDG *TDatabasePDG::GetParticle(Int_t PDGcode) const
 {
-   if (fParticleList == 0)  ((TDatabasePDG*)this)->ReadPDGTable();
-   if (fPdgMap       == 0)  BuildPdgMap();
+   if (!fInitialized.load(std::memory_order_acquire))  Initialize();
 
-   return (TParticlePDG *)fPdgMap->GetValue((Long64_t)PDGcode);
+   return FindParticle(PDGcode);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -242,7 +298,7 @@ TParticlePDG *TDatabasePDG::GetParticle(Int_t PDGcode) const
 
 void TDatabasePDG::Print(Option_t *option) const
 {
-   if (fParticleList == 0)  ((TDatabasePDG*)this)->ReadPDGTable();
+   if (!fInitialized.load(std::memory_order_acquire))  Initialize();
 
    TIter next(fParticleList);
    TParticlePDG *p;
@@ -697,7 +753,7 @@ void TDatabasePDG::ReadPDGTable(const char *FileName)
 
       // define decay channels for antiparticles
       if (p->PdgCode() < 0) {
-         ap = GetParticle(-p->PdgCode());
+         ap = FindParticle(-p->PdgCode());
          if (!ap) continue;
          nch = ap->NDecayChannels();
          for (ich=0; ich<nch; ich++) {
@@ -708,7 +764,7 @@ void TDatabasePDG::ReadPDGTable(const char *FileName)
                // conserve CPT
 
                code[i] = dc->DaughterPdgCode(i);
-               daughter = GetParticle(code[i]);
+               daughter = FindParticle(code[i]);
                if (daughter && daughter->AntiParticle()) {
                   // this particle does have an
                   // antiparticle
@@ -30,12 +30,20 @@ The RRawFileDavix class provides read-only access to remote non-ROOT files.  It
 the transport layer.  It instructs the RRawFile base class to buffer in larger chunks than the default for
 local files, assuming that remote file access has high(er) latency.
 
+S3 URLs (s3:// and s3s://) are signed with the credentials configured for TDavixFile (Davix.S3.SecretKey,
+Davix.S3.AccessKey, Davix.S3.Region and Davix.S3.Token, or the corresponding S3_* environment variables).
+As S3 does not support multi-range requests, the ranges of a vector read are fetched with parallel ranged
+GETs. The number of parallel requests is set by Davix.ReadV.ParallelRequests (default 8 for S3, 0 otherwise,
+meaning a single multi-range request).
+
 */
 
 class RRawFileDavix : public RRawFile {
 private:
    std::unique_ptr<Internal::RDavixFileDes> fFileDes;
 
+   void ReadVParallel(RIOVec *ioVec, unsigned int nReq);
+
 protected:
    void OpenImpl() final;
    size_t ReadAtImpl(void *buffer, size_t nbytes, std::uint64_t offset) final;
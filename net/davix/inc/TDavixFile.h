@@ -50,6 +50,8 @@
 //Davix.S3.Region
 //Davix.S3.Token
 //
+//Davix.ReadV.CoalesceGap
+//
 // Environment variables:
 // X509_USER_CERT, X509_USER_KEY, X509_USER_PROXY ... usual meaning for the X509 Grid things. gEnv vars have higher priority.
 // S3_ACCESS_KEY, S3_SECRET_KEY, S3_REGION, S3_TOKEN. gEnv vars have higher priority.
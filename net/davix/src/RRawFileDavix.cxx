@@ -11,10 +11,16 @@
 
 #include "ROOT/RRawFileDavix.hxx"
 
+#include <TEnv.h>
 #include <TError.h>
 
+#include <algorithm>
+#include <cstdlib>
 #include <memory>
+#include <mutex>
 #include <stdexcept>
+#include <string>
+#include <thread>
 #include <vector>
 
 #include <davix.hpp>
@@ -22,6 +28,30 @@
 
 namespace {
 constexpr int kDefaultBlockSize = 128 * 1024; // Read in relatively large 128k blocks for better network utilization
+constexpr int kDefaultS3ParallelRequests = 8; // S3 does not support multi-range requests, ranges are read in parallel
+
+// Older davix versions lack the setters of the S3 region and STS token, see TDavixFile.cxx
+template <typename TRequestParams = Davix::RequestParams>
+auto SetAwsRegion(TRequestParams &params, const char *region) -> decltype(params.setAwsRegion(region), void())
+{
+   params.setAwsRegion(region);
+}
+template <typename TRequestParams = Davix::RequestParams>
+void SetAwsRegion(...)
+{
+   Warning("RRawFileDavix", "Unable to set AWS region, not supported by this version of davix");
+}
+
+template <typename TRequestParams = Davix::RequestParams>
+auto SetAwsToken(TRequestParams &params, const char *token) -> decltype(params.setAwsToken(token), void())
+{
+   params.setAwsToken(token);
+}
+template <typename TRequestParams = Davix::RequestParams>
+void SetAwsToken(...)
+{
+   Warning("RRawFileDavix", "Unable to set AWS token, not supported by this version of davix");
+}
 } // anonymous namespace
 
 namespace ROOT {
@@ -31,11 +61,44 @@ struct RDavixFileDes {
    RDavixFileDes() : fd(nullptr), pos(&ctx) {}
    RDavixFileDes(const RDavixFileDes &) = delete;
    RDavixFileDes &operator=(const RDavixFileDes &) = delete;
-   ~RDavixFileDes() = default;
+   ~RDavixFileDes()
+   {
+      for (auto extraFd : extraFds)
+         pos.close(extraFd, nullptr);
+   }
 
    DAVIX_FD *fd;
    Davix::Context ctx;
    Davix::DavPosix pos;
+   Davix::RequestParams params;
+   /// Number of ranges of a vector read requested in parallel, 0 to use a single multi-range request
+   int nParallel = 0;
+   /// Additional descriptors used by the parallel range requests, sharing the connection pool of ctx
+   std::vector<DAVIX_FD *> extraFds;
+   std::mutex extraFdsMutex;
+
+   DAVIX_FD *AcquireFd(const std::string &url)
+   {
+      {
+         std::lock_guard<std::mutex> lock(extraFdsMutex);
+         if (!extraFds.empty()) {
+            auto result = extraFds.back();
+            extraFds.pop_back();
+            return result;
+         }
+      }
+      Davix::DavixError *err = nullptr;
+      auto result = pos.open(&params, url, O_RDONLY, &err);
+      if (result == nullptr)
+         throw std::runtime_error("Cannot open '" + url + "', error: " + err->getErrMsg());
+      return result;
+   }
+
+   void ReleaseFd(DAVIX_FD *extraFd)
+   {
+      std::lock_guard<std::mutex> lock(extraFdsMutex);
+      extraFds.push_back(extraFd);
+   }
 };
 
 } // namespace Internal
@@ -45,6 +108,24 @@ struct RDavixFileDes {
 ROOT::Internal::RRawFileDavix::RRawFileDavix(std::string_view url, ROptions options)
    : RRawFile(url, options), fFileDes(new RDavixFileDes())
 {
+   auto &params = fFileDes->params;
+   params.setTransparentRedirectionSupport(true);
+
+   // Same S3 settings as for TDavixFile
+   const char *secretKey = gEnv->GetValue("Davix.S3.SecretKey", getenv("S3_SECRET_KEY"));
+   const char *accessKey = gEnv->GetValue("Davix.S3.AccessKey", getenv("S3_ACCESS_KEY"));
+   if (secretKey && accessKey) {
+      params.setAwsAuthorizationKeys(secretKey, accessKey);
+      if (const char *region = gEnv->GetValue("Davix.S3.Region", getenv("S3_REGION")))
+         SetAwsRegion(params, region);
+      if (const char *token = gEnv->GetValue("Davix.S3.Token", getenv("S3_TOKEN")))
+         SetAwsToken(params, token);
+   }
+
+   const auto transport = GetTransport(fUrl);
+   const bool isS3 = (transport == "s3" || transport == "s3s");
+   fFileDes->nParallel =
+      std::max(0, gEnv->GetValue("Davix.ReadV.ParallelRequests", isS3 ? kDefaultS3ParallelRequests : 0));
 }
 
 ROOT::Internal::RRawFileDavix::~RRawFileDavix()
@@ -62,7 +143,7 @@ std::uint64_t ROOT::Internal::RRawFileDavix::GetSizeImpl()
 {
    struct stat buf;
    Davix::DavixError *err = nullptr;
-   if (fFileDes->pos.stat(nullptr, fUrl, &buf, &err) == -1) {
+   if (fFileDes->pos.stat(&fFileDes->params, fUrl, &buf, &err) == -1) {
       throw std::runtime_error("Cannot determine size of '" + fUrl + "', error: " + err->getErrMsg());
    }
    return buf.st_size;
@@ -71,7 +152,7 @@ std::uint64_t ROOT::Internal::RRawFileDavix::GetSizeImpl()
 void ROOT::Internal::RRawFileDavix::OpenImpl()
 {
    Davix::DavixError *err = nullptr;
-   fFileDes->fd = fFileDes->pos.open(nullptr, fUrl, O_RDONLY, &err);
+   fFileDes->fd = fFileDes->pos.open(&fFileDes->params, fUrl, O_RDONLY, &err);
    if (fFileDes->fd == nullptr) {
       throw std::runtime_error("Cannot open '" + fUrl + "', error: " + err->getErrMsg());
    }
@@ -91,6 +172,11 @@ size_t ROOT::Internal::RRawFileDavix::ReadAtImpl(void *buffer, size_t nbytes, st
 
 void ROOT::Internal::RRawFileDavix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
 {
+   if (fFileDes->nParallel > 0 && nReq > 1) {
+      ReadVParallel(ioVec, nReq);
+      return;
+   }
+
    Davix::DavixError *davixErr = NULL;
    std::vector<Davix::DavIOVecInput> in(nReq);
    std::vector<Davix::DavIOVecOuput> out(nReq);
@@ -111,3 +197,47 @@ void ROOT::Internal::RRawFileDavix::ReadVImpl(RIOVec *ioVec, unsigned int nReq)
       ioVec[i].fOutBytes = out[i].diov_size;
    }
 }
+
+void ROOT::Internal::RRawFileDavix::ReadVParallel(RIOVec *ioVec, unsigned int nReq)
+{
+   // Every worker reads every nThreads-th range with ranged GETs on its own descriptor; the descriptors are opened
+   // on the same context and thus reuse its pooled connections to the server
+   const unsigned int nThreads = std::min<unsigned int>(fFileDes->nParallel, nReq);
+   std::vector<std::string> errors(nThreads);
+
+   auto worker = [this, ioVec, nReq, nThreads, &errors](unsigned int idxThread) {
+      DAVIX_FD *fd = nullptr;
+      try {
+         fd = (idxThread == 0) ? fFileDes->fd : fFileDes->AcquireFd(fUrl);
+      } catch (const std::runtime_error &e) {
+         errors[idxThread] = e.what();
+         return;
+      }
+      for (unsigned int i = idxThread; i < nReq; i += nThreads) {
+         R__ASSERT(ioVec[i].fSize > 0);
+         Davix::DavixError *err = nullptr;
+         auto retval = fFileDes->pos.pread(fd, ioVec[i].fBuffer, ioVec[i].fSize, ioVec[i].fOffset, &err);
+         if (retval < 0) {
+            errors[idxThread] = "Cannot read from '" + fUrl + "', error: " + err->getErrMsg();
+            Davix::DavixError::clearError(&err);
+            break;
+         }
+         ioVec[i].fOutBytes = static_cast<size_t>(retval);
+      }
+      if (idxThread > 0)
+         fFileDes->ReleaseFd(fd);
+   };
+
+   std::vector<std::thread> threads;
+   threads.reserve(nThreads - 1);
+   for (unsigned int t = 1; t < nThreads; ++t)
+      threads.emplace_back(worker, t);
+   worker(0);
+   for (auto &t : threads)
+      t.join();
+
+   for (const auto &e : errors) {
+      if (!e.empty())
+         throw std::runtime_error(e);
+   }
+}
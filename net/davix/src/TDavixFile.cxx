@@ -564,6 +564,9 @@ void TDavixFileInternal::parseConfig()
    env_var = gEnv->GetValue("Davix.GSI.GridMode", (const char *)"y");
    if (!isno(env_var))
       enableGridMode();
+
+   // vector read coalescing
+   readvCoalesceGap = gEnv->GetValue("Davix.ReadV.CoalesceGap", 0);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -971,23 +974,74 @@ Long64_t TDavixFile::DavixReadBuffers(Davix_fd *fd, char *buf, Long64_t *pos, In
 {
    DavixError *davixErr = NULL;
    Double_t start_time = eventStart();
-   DavIOVecInput in[nbuf];
-   DavIOVecOuput out[nbuf];
 
-   int lastPos = 0;
+   // Consecutive chunks separated by at most readvCoalesceGap bytes (no coalescing
+   // if negative) are requested as a single range, which keeps the number of
+   // ranges of the HTTP request low.
+   // Adjacent chunks are also adjacent in buf and are read in place, the others are
+   // read into a scratch buffer and copied, discarding the bytes of the gaps.
+   struct Range_t {
+      Int_t fFirst;     // first chunk of the range
+      Int_t fLast;      // last chunk of the range
+      Long64_t fBufPos; // position of the first chunk in buf
+      Long64_t fSize;   // size of the range, including the gaps
+      bool fContiguous; // no gaps between the chunks
+   };
+   std::vector<Range_t> ranges;
+   ranges.reserve(nbuf);
+   const Long64_t maxGap = d_ptr->readvCoalesceGap;
+   Long64_t bufPos = 0;
    for (Int_t i = 0; i < nbuf; ++i) {
-      in[i].diov_buffer = &buf[lastPos];
-      in[i].diov_offset = pos[i];
-      in[i].diov_size = len[i];
-      lastPos += len[i];
+      if (!ranges.empty() && maxGap >= 0) {
+         Range_t &r = ranges.back();
+         const Long64_t end = pos[r.fFirst] + r.fSize;
+         const Long64_t gap = pos[i] - end;
+         if (gap >= 0 && gap <= maxGap) {
+            r.fLast = i;
+            r.fSize += gap + len[i];
+            r.fContiguous = r.fContiguous && gap == 0;
+            bufPos += len[i];
+            continue;
+         }
+      }
+      ranges.push_back({i, i, bufPos, len[i], true});
+      bufPos += len[i];
+   }
+
+   std::vector<DavIOVecInput> in(ranges.size());
+   std::vector<DavIOVecOuput> out(ranges.size());
+   std::vector<std::vector<char>> scratch;
+   scratch.reserve(ranges.size());
+   for (std::size_t i = 0; i < ranges.size(); ++i) {
+      const Range_t &r = ranges[i];
+      if (r.fContiguous) {
+         in[i].diov_buffer = &buf[r.fBufPos];
+      } else {
+         scratch.emplace_back(r.fSize);
+         in[i].diov_buffer = scratch.back().data();
+      }
+      in[i].diov_offset = pos[r.fFirst];
+      in[i].diov_size = r.fSize;
    }
 
-   Long64_t ret = d_ptr->davixPosix->preadVec(fd, in, out, nbuf, &davixErr);
+   Long64_t ret = d_ptr->davixPosix->preadVec(fd, in.data(), out.data(), in.size(), &davixErr);
    if (ret < 0) {
       Error("DavixReadBuffers", "can not read data with davix: %s (%d)",
             davixErr->getErrMsg().c_str(), davixErr->getStatus());
       DavixError::clearError(&davixErr);
    } else {
+      // Copy the chunks of the ranges read into a scratch buffer
+      for (std::size_t i = 0; i < ranges.size(); ++i) {
+         const Range_t &r = ranges[i];
+         if (r.fContiguous)
+            continue;
+         const char *rangeBuf = static_cast<const char *>(in[i].diov_buffer);
+         Long64_t chunkBufPos = r.fBufPos;
+         for (Int_t j = r.fFirst; j <= r.fLast; ++j) {
+            memcpy(&buf[chunkBufPos], rangeBuf + (pos[j] - pos[r.fFirst]), len[j]);
+            chunkBufPos += len[j];
+         }
+      }
       eventStop(start_time, ret);
    }
 
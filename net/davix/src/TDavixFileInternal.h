@@ -65,6 +65,7 @@ private:
       fUrl(mUrl),
       opt(mopt),
       oflags(0),
+      readvCoalesceGap(0),
       dirdVec() { }
 
    TDavixFileInternal(const char* url, Option_t* mopt) :
@@ -77,6 +78,7 @@ private:
       fUrl(url),
       opt(mopt),
       oflags(0),
+      readvCoalesceGap(0),
       dirdVec() { }
 
    ~TDavixFileInternal();
@@ -136,6 +138,7 @@ private:
    TUrl fUrl;
    Option_t* opt;
    int oflags;
+   Long64_t readvCoalesceGap; // Max gap between vector read chunks requested as one range
    std::vector<void*> dirdVec;
 
 public:
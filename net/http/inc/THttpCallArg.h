@@ -162,6 +162,9 @@ public:
    /** mark reply as 404 error - page/request not exists or refused */
    void Set404() { SetContentType("_404_"); }
 
+   /** mark reply as 304 - content did not change since the version cached by the client */
+   void Set304() { SetContentType("_304_"); }
+
    /** Return true if reply can be postponed by server  */
    virtual Bool_t CanPostpone() const { return kTRUE; }
 
@@ -229,6 +232,7 @@ public:
    const char *GetContentType() const { return fContentType.Data(); }
 
    Bool_t Is404() const { return IsContentType("_404_"); }
+   Bool_t Is304() const { return IsContentType("_304_"); }
    Bool_t IsFile() const { return IsContentType("_file_"); }
    Bool_t IsPostponed() const { return IsContentType("_postponed_"); }
    Bool_t IsText() const { return IsContentType("text/plain"); }
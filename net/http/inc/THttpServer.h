@@ -64,6 +64,8 @@ protected:
 
    virtual void ProcessBatchHolder(std::shared_ptr<THttpCallArg> &arg);
 
+   void CheckETag(THttpCallArg &arg);
+
    void StopServerThread();
 
    std::string BuildWSEntryPage();
@@ -16,6 +16,7 @@
 #include "THttpCallArg.h"
 
 #include <vector>
+#include <string>
 #include <memory>
 #include <mutex>
 
@@ -26,10 +27,19 @@ class THttpWSHandler : public TNamed {
 
 friend class THttpServer;
 
+public:
+   /// Policy applied when the send queue of a websocket connection is full
+   enum ESendQueuePolicy {
+      kSendQueueReject, ///< new message is rejected, send method returns -1
+      kSendQueueReplace ///< last queued message is replaced by the new one, use when messages supersede each other
+   };
+
 private:
    Bool_t fSyncMode{kTRUE};  ///<! is handler runs in synchronous mode (default, no multi-threading)
    Bool_t fDisabled{kFALSE}; ///<!  when true, all further operations will be ignored
    Int_t fSendCnt{0};        ///<! counter for completed send operations
+   Int_t fSendQueueLimit{0}; ///<! number of messages which can wait while previous send operation is not completed
+   ESendQueuePolicy fSendQueuePolicy{kSendQueueReject}; ///<! policy when send queue is full
    std::mutex fMutex;        ///<!  protect list of engines
    std::vector<std::shared_ptr<THttpWSEngine>> fEngines; ///<!  list of active WS engines (connections)
 
@@ -45,6 +55,8 @@ private:
 
    Int_t CompleteSend(std::shared_ptr<THttpWSEngine> &engine);
 
+   Int_t SubmitSend(std::shared_ptr<THttpWSEngine> &engine, Int_t kind, std::string &&data, const char *hdr = nullptr);
+
 protected:
 
    THttpWSHandler(const char *name, const char *title, Bool_t syncmode = kTRUE);
@@ -100,8 +112,20 @@ public:
 
    void CloseWS(UInt_t wsid);
 
+   void SetSendQueue(Int_t limit, ESendQueuePolicy policy = kSendQueueReject);
+
+   /// Returns number of messages which can wait in send queue of each connection
+   Int_t GetSendQueueLimit() const { return fSendQueueLimit; }
+
+   /// Returns policy applied when send queue is full
+   ESendQueuePolicy GetSendQueuePolicy() const { return fSendQueuePolicy; }
+
+   Bool_t CanSendWS(UInt_t wsid);
+
    Int_t SendWS(UInt_t wsid, const void *buf, int len);
 
+   Int_t SendWS(UInt_t wsid, std::string &&data);
+
    Int_t SendHeaderWS(UInt_t wsid, const char *hdr, const void *buf, int len);
 
    Int_t SendCharStarWS(UInt_t wsid, const char *str);
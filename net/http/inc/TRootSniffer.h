@@ -14,6 +14,7 @@
 
 #include "TNamed.h"
 #include "TList.h"
+#include <map>
 #include <memory>
 #include <string>
 
@@ -127,6 +128,7 @@ protected:
    TString fCurrentAllowedMethods;     ///<! list of allowed methods, extracted when analyzed object restrictions
    TList fRestrictions;                ///<! list of restrictions for different locations
    TString fAutoLoad;                  ///<! scripts names, which are add as _autoload parameter to h.json request
+   std::map<std::string, std::pair<std::string, std::string>> fJsonCache; ///<! binary image and JSON of objects, per item and options
 
    void ScanObjectMembers(TRootSnifferScanRec &rec, TClass *cl, char *ptr);
 
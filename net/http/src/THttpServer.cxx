@@ -31,12 +31,15 @@
 #include "TCivetweb.h"
 #include "TFastCgi.h"
 
+#include <algorithm>
 #include <chrono>
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
+#include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 class THttpTimer : public TTimer {
 public:
@@ -651,6 +654,12 @@ Bool_t THttpServer::SubmitHttp(std::shared_ptr<THttpCallArg> arg, Bool_t can_run
 /// gSystem->ProcessEvents() is called.
 /// User can call serv->ProcessRequests() directly, but only from main thread.
 /// If special server thread is created, called from that thread
+///
+/// Identical requests for data (like root.json or h.json of the same item,
+/// with the same query and user and without post data) which are waiting
+/// in the queue at the same time are processed only once, and the reply
+/// is copied to all of them. This avoids serializing the same objects again
+/// for every client when many clients poll the same items.
 
 Int_t THttpServer::ProcessRequests()
 {
@@ -664,38 +673,77 @@ Int_t THttpServer::ProcessRequests()
 
    Int_t cnt = 0;
 
-   std::unique_lock<std::mutex> lk(fMutex, std::defer_lock);
+   // requests which do not modify anything and can share the same reply
+   auto is_data_request = [](const THttpCallArg &arg) {
+      static const std::vector<std::string> data_files = {"h.json",   "h.xml",     "root.json", "root.bin",  "root.xml",
+                                                          "root.png", "root.jpeg", "root.gif",  "item.json", "item.xml"};
+      if ((arg.fMethod != "GET") || !arg.fPostData.empty() || (arg.fWSId != 0))
+         return false;
+      return std::find(data_files.begin(), data_files.end(), arg.fFileName.Data()) != data_files.end();
+   };
+
+   auto is_same_request = [](const THttpCallArg &arg1, const THttpCallArg &arg2) {
+      return (arg1.fFileName == arg2.fFileName) && (arg1.fPathName == arg2.fPathName) &&
+             (arg1.fQuery == arg2.fQuery) && (arg1.fTopName == arg2.fTopName) && (arg1.fUserName == arg2.fUserName);
+   };
+
+   std::vector<std::shared_ptr<THttpCallArg>> args;
 
    // first process requests in the queue
    while (true) {
-      std::shared_ptr<THttpCallArg> arg;
-
-      lk.lock();
-      if (!fArgs.empty()) {
-         arg = fArgs.front();
-         fArgs.pop();
+      {
+         std::lock_guard<std::mutex> grd(fMutex);
+         while (!fArgs.empty()) {
+            args.emplace_back(fArgs.front());
+            fArgs.pop();
+         }
       }
-      lk.unlock();
 
-      if (!arg)
+      if (args.empty())
          break;
 
-      if (arg->fFileName == "root_batch_holder.js") {
-         ProcessBatchHolder(arg);
-         continue;
-      }
+      for (std::size_t n = 0; n < args.size(); ++n) {
+         auto arg = std::move(args[n]);
 
-      fSniffer->SetCurrentCallArg(arg.get());
+         if (!arg)
+            continue;
 
-      try {
-         cnt++;
-         ProcessRequest(arg);
-         fSniffer->SetCurrentCallArg(nullptr);
-      } catch (...) {
-         fSniffer->SetCurrentCallArg(nullptr);
+         if (arg->fFileName == "root_batch_holder.js") {
+            ProcessBatchHolder(arg);
+            continue;
+         }
+
+         fSniffer->SetCurrentCallArg(arg.get());
+
+         try {
+            cnt++;
+            ProcessRequest(arg);
+            fSniffer->SetCurrentCallArg(nullptr);
+         } catch (...) {
+            fSniffer->SetCurrentCallArg(nullptr);
+         }
+
+         // reply identical requests waiting in the queue with the same content
+         if (!arg->IsPostponed() && !arg->Is304() && is_data_request(*arg)) {
+            for (std::size_t k = n + 1; k < args.size(); ++k) {
+               auto &other = args[k];
+               if (!other || !is_data_request(*other) || !is_same_request(*arg, *other))
+                  continue;
+               other->fContentType = arg->fContentType;
+               other->fHeader = arg->fHeader;
+               other->fZipping = arg->fZipping;
+               other->fContent = arg->fContent;
+               CheckETag(*other);
+               other->NotifyCondition();
+               other.reset();
+               cnt++;
+            }
+         }
+
+         arg->NotifyCondition();
       }
 
-      arg->NotifyCondition();
+      args.clear();
    }
 
    // regularly call Process() method of engine to let perform actions in ROOT context
@@ -1060,6 +1108,32 @@ void THttpServer::ProcessRequest(std::shared_ptr<THttpCallArg> arg)
    // potentially add cors header
    if (IsCors())
       arg->AddHeader("Access-Control-Allow-Origin", GetCors());
+
+   CheckETag(*arg);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add ETag header, computed from the reply content, to the reply of request
+///
+/// Browser then keeps the reply but always revalidates it, sending back the
+/// ETag in the If-None-Match header. When it matches, content did not change
+/// and reply is replaced by "304 Not Modified" without content.
+
+void THttpServer::CheckETag(THttpCallArg &arg)
+{
+   if (arg.Is404() || arg.IsFile() || arg.IsPostponed() || arg.Is304() || arg.fContent.empty())
+      return;
+
+   TString etag = TString::Format("\"%zx-%zx\"", std::hash<std::string>{}(arg.fContent), arg.fContent.length());
+
+   arg.AddHeader("ETag", etag.Data());
+   arg.AddHeader("Cache-Control", "private, no-cache, must-revalidate, max-age=0");
+
+   if (arg.GetRequestHeader("If-None-Match") == etag) {
+      arg.Set304();
+      arg.SetZipping(THttpCallArg::kNoZip);
+      arg.fContent.clear();
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////
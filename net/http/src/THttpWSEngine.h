@@ -16,9 +16,11 @@
 
 #include "THttpCallArg.h"
 
+#include <atomic>
 #include <mutex>
 #include <thread>
 #include <string>
+#include <deque>
 #include <condition_variable>
 
 class THttpWSHandler;
@@ -28,8 +30,8 @@ class THttpWSEngine {
 private:
    friend class THttpWSHandler;
 
-   bool fMTSend{false};     ///<!  true when send operation runs, set under locked fMutex from WSHandler
-   bool fDisabled{false};   ///<!  true shortly before cleanup, set under locked fMutex from WSHandler
+   std::atomic<int> fMTSend{0}; ///<!  number of booked but not completed send operations, booked under locked fMutex from WSHandler
+   bool fDisabled{false};       ///<!  true shortly before cleanup, set under locked fMutex from WSHandler
 
    std::thread fSendThrd;    ///<! dedicated thread for all send operations
    bool fHasSendThrd{false}; ///<! if thread was started one have to call join method for it
@@ -38,9 +40,23 @@ private:
    std::condition_variable fCond;                      ///<! condition used to sync with sending thread
    bool fWaiting{false};                               ///<! if condition wait is called
    bool fSending{false};                               ///<! performing send operation in other thread
-   enum { kNone, kData, kHeader, kText } fKind{kNone}; ///<! kind of operation
-   std::string fData;                                  ///<! data (binary or text)
-   std::string fHdr;                                   ///<! header
+
+   enum EKind { kNone, kData, kHeader, kText };
+
+   struct SendItem {
+      EKind fKind{kNone}; ///<! kind of operation
+      std::string fData;  ///<! data (binary or text)
+      std::string fHdr;   ///<! header
+   };
+
+   std::deque<SendItem> fQueue;                        ///<! messages waiting to be sent, oldest first
+
+   /// Returns true when there are messages waiting to be sent
+   bool HasQueuedSend()
+   {
+      std::lock_guard<std::mutex> grd(fMutex);
+      return !fQueue.empty();
+   }
 
 protected:
    THttpWSEngine() = default;
@@ -139,11 +139,13 @@ std::shared_ptr<THttpWSEngine> THttpWSHandler::FindEngine(UInt_t wsid, Bool_t bo
             return nullptr;
 
          if (book_send) {
-            if (eng->fMTSend) {
-               Error("FindEngine", "Try to book next send operation before previous completed");
+            if ((fSendQueuePolicy == kSendQueueReject) && (eng->fMTSend > fSendQueueLimit)) {
+               // with configured queue a full queue is normal back-pressure, caller can check CanSendWS()
+               if (fSendQueueLimit == 0)
+                  Error("FindEngine", "Try to book next send operation before previous completed");
                return nullptr;
             }
-            eng->fMTSend = kTRUE;
+            eng->fMTSend++;
          }
          return eng;
       }
@@ -301,7 +303,7 @@ Int_t THttpWSHandler::RunSendingThrd(std::shared_ptr<THttpWSEngine> engine)
          PerformSend(engine);
          if (IsDisabled() || engine->fDisabled) break;
          std::unique_lock<std::mutex> lk(engine->fMutex);
-         if (engine->fKind == THttpWSEngine::kNone) {
+         if (engine->fQueue.empty()) {
             engine->fWaiting = true;
             engine->fCond.wait(lk);
             engine->fWaiting = false;
@@ -318,46 +320,47 @@ Int_t THttpWSHandler::RunSendingThrd(std::shared_ptr<THttpWSEngine> engine)
 
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Perform send operation, stored in buffer
+/// Perform send operation for the oldest message in the queue
 
 Int_t THttpWSHandler::PerformSend(std::shared_ptr<THttpWSEngine> engine)
 {
+   THttpWSEngine::SendItem item;
+
    {
       std::lock_guard<std::mutex> grd(engine->fMutex);
 
       // no need to do something - operation was processed already by somebody else
-      if (engine->fKind == THttpWSEngine::kNone)
+      if (engine->fQueue.empty())
          return 0;
 
       if (engine->fSending)
          return 1;
       engine->fSending = true;
+
+      item = std::move(engine->fQueue.front());
+      engine->fQueue.pop_front();
    }
 
    if (IsDisabled() || engine->fDisabled)
       return 0;
 
-   switch (engine->fKind) {
+   switch (item.fKind) {
    case THttpWSEngine::kData:
-      engine->Send(engine->fData.data(), engine->fData.length());
+      engine->Send(item.fData.data(), item.fData.length());
       break;
    case THttpWSEngine::kHeader:
-      engine->SendHeader(engine->fHdr.c_str(), engine->fData.data(), engine->fData.length());
+      engine->SendHeader(item.fHdr.c_str(), item.fData.data(), item.fData.length());
       break;
    case THttpWSEngine::kText:
-      engine->SendCharStar(engine->fData.c_str());
+      engine->SendCharStar(item.fData.c_str());
       break;
    default:
       break;
    }
 
-   engine->fData.clear();
-   engine->fHdr.clear();
-
    {
       std::lock_guard<std::mutex> grd(engine->fMutex);
       engine->fSending = false;
-      engine->fKind = THttpWSEngine::kNone;
    }
 
    return CompleteSend(engine);
@@ -370,48 +373,82 @@ Int_t THttpWSHandler::PerformSend(std::shared_ptr<THttpWSEngine> engine)
 Int_t THttpWSHandler::CompleteSend(std::shared_ptr<THttpWSEngine> &engine)
 {
    fSendCnt++;
-   engine->fMTSend = false; // probably we do not need to lock mutex to reset flag
+   engine->fMTSend--; // atomic counter, no need to lock mutex
    CompleteWSSend(engine->GetId());
    return 0; // indicates that operation is completed
 }
 
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Send binary data via given websocket id. Returns:
+/// Configure send queue of websocket connections
 ///
-/// * -1 - in case of error
-/// *  0 - when operation was executed immediately
-/// *  1 - when send operation will be performed in different thread
+/// By default (limit 0) only one send operation can be performed for the connection,
+/// next operation can be submitted only after previous one is completed.
+/// With positive limit, up to `limit` messages can wait in the queue of each connection
+/// while previous message is sent, which is useful for slow clients.
+/// When queue is full, `policy` is applied:
+///
+/// * kSendQueueReject - new message is rejected, SendWS() and others return -1
+/// * kSendQueueReplace - last queued message is replaced by the new one and reported as completed;
+///                       use it when each message supersedes the previous one, like full canvas updates
+///
+/// Should be configured before connections are established
 
-Int_t THttpWSHandler::SendWS(UInt_t wsid, const void *buf, int len)
+void THttpWSHandler::SetSendQueue(Int_t limit, ESendQueuePolicy policy)
 {
-   auto engine = FindEngine(wsid, kTRUE);
-   if (!engine) return -1;
+   fSendQueueLimit = limit > 0 ? limit : 0;
+   fSendQueuePolicy = policy;
+   // at least one message should be kept to be replaced
+   if ((fSendQueuePolicy == kSendQueueReplace) && (fSendQueueLimit == 0))
+      fSendQueueLimit = 1;
+}
 
-   if ((IsSyncMode() || !AllowMTSend()) && engine->CanSendDirectly()) {
-      engine->Send(buf, len);
-      return CompleteSend(engine);
-   }
+////////////////////////////////////////////////////////////////////////////////
+/// Returns kTRUE if next send operation can be submitted for given websocket id
+/// without rejecting it because of full send queue
 
-   bool notify = false;
+Bool_t THttpWSHandler::CanSendWS(UInt_t wsid)
+{
+   auto engine = FindEngine(wsid);
+   if (!engine)
+      return kFALSE;
+
+   return (fSendQueuePolicy == kSendQueueReplace) || (engine->fMTSend <= fSendQueueLimit);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Put message into send queue of the connection and trigger sending. Returns:
+///
+/// *  0 - when operation was executed immediately
+/// *  1 - when send operation will be performed in different thread
+
+Int_t THttpWSHandler::SubmitSend(std::shared_ptr<THttpWSEngine> &engine, Int_t kind, std::string &&data, const char *hdr)
+{
+   bool notify = false, replaced = false;
 
    // now we indicate that there is data and any thread can access it
    {
       std::lock_guard<std::mutex> grd(engine->fMutex);
 
-      if (engine->fKind != THttpWSEngine::kNone) {
-         Error("SendWS", "Data kind is not empty - something screwed up");
-         return -1;
-      }
-
       notify = engine->fWaiting;
 
-      engine->fKind = THttpWSEngine::kData;
+      if ((fSendQueuePolicy == kSendQueueReplace) && ((Int_t)engine->fQueue.size() >= fSendQueueLimit)) {
+         engine->fQueue.pop_back();
+         replaced = true;
+      }
 
-      engine->fData.resize(len);
-      std::copy((const char *)buf, (const char *)buf + len, engine->fData.begin());
+      engine->fQueue.emplace_back();
+      auto &item = engine->fQueue.back();
+      item.fKind = (THttpWSEngine::EKind)kind;
+      item.fData = std::move(data);
+      if (hdr)
+         item.fHdr = hdr;
    }
 
+   // superseded message will never be sent, but its operation should be completed
+   if (replaced)
+      CompleteSend(engine);
+
    if (engine->fHasSendThrd) {
       if (notify) engine->fCond.notify_all();
       return 1;
@@ -420,56 +457,68 @@ Int_t THttpWSHandler::SendWS(UInt_t wsid, const void *buf, int len)
    return RunSendingThrd(engine);
 }
 
-
 ////////////////////////////////////////////////////////////////////////////////
-/// Send binary data with text header via given websocket id. Returns:
+/// Send binary data via given websocket id. Returns:
 ///
-/// * -1 - in case of error,
-/// *  0 - when operation was executed immediately,
-/// *  1 - when send operation will be performed in different thread,
+/// * -1 - in case of error or when send queue is full
+/// *  0 - when operation was executed immediately
+/// *  1 - when send operation will be performed in different thread
 
-Int_t THttpWSHandler::SendHeaderWS(UInt_t wsid, const char *hdr, const void *buf, int len)
+Int_t THttpWSHandler::SendWS(UInt_t wsid, const void *buf, int len)
 {
    auto engine = FindEngine(wsid, kTRUE);
    if (!engine) return -1;
 
-   if ((IsSyncMode() || !AllowMTSend()) && engine->CanSendDirectly()) {
-      engine->SendHeader(hdr, buf, len);
+   if ((IsSyncMode() || !AllowMTSend()) && engine->CanSendDirectly() && !engine->HasQueuedSend()) {
+      engine->Send(buf, len);
       return CompleteSend(engine);
    }
 
-   bool notify = false;
+   return SubmitSend(engine, THttpWSEngine::kData, std::string((const char *)buf, len));
+}
 
-   // now we indicate that there is data and any thread can access it
-   {
-      std::lock_guard<std::mutex> grd(engine->fMutex);
+////////////////////////////////////////////////////////////////////////////////
+/// Send binary data via given websocket id.
+/// Buffer is moved into send queue, therefore data is not copied when send operation is postponed.
+/// Returns same values as SendWS(UInt_t, const void *, int)
 
-      if (engine->fKind != THttpWSEngine::kNone) {
-         Error("SendWS", "Data kind is not empty - something screwed up");
-         return -1;
-      }
+Int_t THttpWSHandler::SendWS(UInt_t wsid, std::string &&data)
+{
+   auto engine = FindEngine(wsid, kTRUE);
+   if (!engine) return -1;
 
-      notify = engine->fWaiting;
+   if ((IsSyncMode() || !AllowMTSend()) && engine->CanSendDirectly() && !engine->HasQueuedSend()) {
+      engine->Send(data.data(), data.length());
+      return CompleteSend(engine);
+   }
 
-      engine->fKind = THttpWSEngine::kHeader;
+   return SubmitSend(engine, THttpWSEngine::kData, std::move(data));
+}
 
-      engine->fHdr = hdr;
-      engine->fData.resize(len);
-      std::copy((const char *)buf, (const char *)buf + len, engine->fData.begin());
-   }
+////////////////////////////////////////////////////////////////////////////////
+/// Send binary data with text header via given websocket id. Returns:
+///
+/// * -1 - in case of error or when send queue is full,
+/// *  0 - when operation was executed immediately,
+/// *  1 - when send operation will be performed in different thread,
 
-   if (engine->fHasSendThrd) {
-      if (notify) engine->fCond.notify_all();
-      return 1;
+Int_t THttpWSHandler::SendHeaderWS(UInt_t wsid, const char *hdr, const void *buf, int len)
+{
+   auto engine = FindEngine(wsid, kTRUE);
+   if (!engine) return -1;
+
+   if ((IsSyncMode() || !AllowMTSend()) && engine->CanSendDirectly() && !engine->HasQueuedSend()) {
+      engine->SendHeader(hdr, buf, len);
+      return CompleteSend(engine);
    }
 
-   return RunSendingThrd(engine);
+   return SubmitSend(engine, THttpWSEngine::kHeader, std::string((const char *)buf, len), hdr);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Send string via given websocket id. Returns:
 ///
-/// * -1 - in case of error,
+/// * -1 - in case of error or when send queue is full,
 /// *  0 - when operation was executed immediately,
 /// *  1 - when send operation will be performed in different thread,
 
@@ -478,32 +527,10 @@ Int_t THttpWSHandler::SendCharStarWS(UInt_t wsid, const char *str)
    auto engine = FindEngine(wsid, kTRUE);
    if (!engine) return -1;
 
-   if ((IsSyncMode() || !AllowMTSend()) && engine->CanSendDirectly()) {
+   if ((IsSyncMode() || !AllowMTSend()) && engine->CanSendDirectly() && !engine->HasQueuedSend()) {
       engine->SendCharStar(str);
       return CompleteSend(engine);
    }
 
-   bool notify = false;
-
-   // now we indicate that there is data and any thread can access it
-   {
-      std::lock_guard<std::mutex> grd(engine->fMutex);
-
-      if (engine->fKind != THttpWSEngine::kNone) {
-         Error("SendWS", "Data kind is not empty - something screwed up");
-         return -1;
-      }
-
-      notify = engine->fWaiting;
-
-      engine->fKind = THttpWSEngine::kText;
-      engine->fData = str;
-   }
-
-   if (engine->fHasSendThrd) {
-      if (notify) engine->fCond.notify_all();
-      return 1;
-   }
-
-   return RunSendingThrd(engine);
+   return SubmitSend(engine, THttpWSEngine::kText, std::string(str));
 }
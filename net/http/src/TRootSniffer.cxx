@@ -14,6 +14,7 @@
 #include "TDirectoryFile.h"
 #include "TKey.h"
 #include "TList.h"
+#include "TBufferFile.h"
 #include "TBufferJSON.h"
 #include "TROOT.h"
 #include "TFolder.h"
@@ -1152,10 +1153,34 @@ Bool_t TRootSniffer::ProduceJson(const std::string &path, const std::string &opt
    if (!obj_ptr || (!obj_cl && !member))
       return kFALSE;
 
+   // Histograms are first streamed in binary form, which is much faster than the conversion to JSON.
+   // If the binary image did not change since the previous request, the same JSON is returned.
+   std::pair<std::string, std::string> *cached = nullptr;
+   if (!member && obj_cl && obj_cl->InheritsFrom("TH1")) {
+      TBufferFile sbuf(TBuffer::kWrite, 100000);
+      sbuf.WriteObjectAny(obj_ptr, obj_cl);
+
+      std::string key = path + "?" + std::to_string(compact);
+      auto iter = fJsonCache.find(key);
+      if ((iter != fJsonCache.end()) && (iter->second.first.length() == (std::size_t)sbuf.Length()) &&
+          (memcmp(iter->second.first.data(), sbuf.Buffer(), sbuf.Length()) == 0)) {
+         res = iter->second.second;
+         return !res.empty();
+      }
+
+      if ((iter == fJsonCache.end()) && (fJsonCache.size() >= 100))
+         fJsonCache.clear();
+      cached = &fJsonCache[key];
+      cached->first.assign(sbuf.Buffer(), sbuf.Length());
+   }
+
    // TODO: implement direct storage into std::string
    TString buf = TBufferJSON::ConvertToJSON(obj_ptr, obj_cl, compact >= 0 ? compact : 0, member ? member->GetName() : nullptr);
    res = buf.Data();
 
+   if (cached)
+      cached->second = res;
+
    return !res.empty();
 }
 
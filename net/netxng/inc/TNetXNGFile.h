@@ -23,6 +23,7 @@
 
 #include "TFile.h"
 #include "TSemaphore.h"
+#include <functional>
 #ifndef __CLING__
 #include <XrdCl/XrdClFileSystem.hh>
 #endif
@@ -77,6 +78,8 @@ public:
    Bool_t   ReadBuffer(char *buffer, Long64_t position, Int_t length) override;
    Bool_t   ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
                         Int_t nbuffs) override;
+   Bool_t   ReadBuffersAsync(char *buffer, Long64_t *position, Int_t *length,
+                             Int_t nbuffs, std::function<void(Bool_t failed)> callback);
    TString  GetNewUrl() override { return fNewUrl; }
 
 private:
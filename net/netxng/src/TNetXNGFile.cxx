@@ -19,6 +19,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "TArchiveFile.h"
+#include "TError.h"
 #include "TNetXNGFile.h"
 #include "TEnv.h"
 #include "TSystem.h"
@@ -30,7 +31,13 @@
 #include <XrdCl/XrdClXRootDResponses.hh>
 #include <XrdCl/XrdClDefaultEnv.hh>
 #include <XrdVersion.hh>
+#include <atomic>
 #include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
 
 //------------------------------------------------------------------------------
 // Open handler for async open requests
@@ -74,6 +81,29 @@ class TAsyncOpenHandler: public XrdCl::ResponseHandler
       TNetXNGFile *fFile;
 };
 
+//------------------------------------------------------------------------------
+// State shared by the readv requests of one call to ReadBuffersAsync
+////////////////////////////////////////////////////////////////////////////////
+
+struct TAsyncReadvState
+{
+   std::atomic<Int_t>           fPending{1}; // Outstanding requests, plus one while issuing them
+   std::atomic<bool>            fFailed{false};
+   std::function<void(Bool_t)>  fCallback;   // Invoked when all the requests completed
+
+   void Fail(const std::string &error)
+   {
+      ::Error("TNetXNGFile::ReadBuffers", "%s", error.c_str());
+      fFailed = true;
+   }
+
+   void Done(Int_t nRequests = 1)
+   {
+      if ((fPending -= nRequests) == 0)
+         fCallback(fFailed);
+   }
+};
+
 //------------------------------------------------------------------------------
 // Async readv handler
 ////////////////////////////////////////////////////////////////////////////////
@@ -85,10 +115,8 @@ class TAsyncReadvHandler: public XrdCl::ResponseHandler
       // Constructor
       //////////////////////////////////////////////////////////////////////////
 
-      TAsyncReadvHandler(std::vector<XrdCl::XRootDStatus*> *statuses,
-                         Int_t                              statusIndex,
-                         TSemaphore                        *semaphore):
-         fStatuses(statuses), fStatusIndex(statusIndex), fSemaphore(semaphore) {}
+      TAsyncReadvHandler(std::shared_ptr<TAsyncReadvState> state):
+         fState(std::move(state)) {}
 
 
       //------------------------------------------------------------------------
@@ -98,18 +126,91 @@ class TAsyncReadvHandler: public XrdCl::ResponseHandler
       void HandleResponse(XrdCl::XRootDStatus *status,
                           XrdCl::AnyObject    *response) override
       {
-         fStatuses->at(fStatusIndex) = status;
-         fSemaphore->Post();
+         if (!status->IsOK())
+            fState->Fail(status->ToStr());
+         delete status;
          delete response;
+         fState->Done();
          delete this;
       }
 
    private:
-      std::vector<XrdCl::XRootDStatus*> *fStatuses;    // Pointer to status vector
-      Int_t                              fStatusIndex; // Index into status vector
-      TSemaphore                        *fSemaphore;   // Synchronize the responses
+      std::shared_ptr<TAsyncReadvState> fState; // Completion of the whole vector read
+};
+
+//------------------------------------------------------------------------------
+// Process-wide cache of the data server locations and of their vector read
+// limits, used to skip the redirector and query round-trips when the same
+// file is opened again (switched off with NetXNG.CacheOpenLocations: 0)
+////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+class TNetXNGOpenCache
+{
+   public:
+      // Location to which an open of url was redirected, or empty string
+      std::string GetLocation(const std::string &url)
+      {
+         std::lock_guard<std::mutex> lock(fMutex);
+         auto it = fLocations.find(url);
+         return it != fLocations.end() ? it->second : std::string();
+      }
+
+      void SetLocation(const std::string &url, const std::string &location)
+      {
+         std::lock_guard<std::mutex> lock(fMutex);
+         if (fLocations.size() >= kMaxEntries)
+            fLocations.clear();
+         fLocations[url] = location;
+      }
+
+      void ForgetLocation(const std::string &url)
+      {
+         std::lock_guard<std::mutex> lock(fMutex);
+         fLocations.erase(url);
+      }
+
+      Bool_t GetReadvLimits(const std::string &server, Int_t &iorMax, Int_t &iovMax)
+      {
+         std::lock_guard<std::mutex> lock(fMutex);
+         auto it = fReadvLimits.find(server);
+         if (it == fReadvLimits.end())
+            return kFALSE;
+         iorMax = it->second.first;
+         iovMax = it->second.second;
+         return kTRUE;
+      }
+
+      void SetReadvLimits(const std::string &server, Int_t iorMax, Int_t iovMax)
+      {
+         std::lock_guard<std::mutex> lock(fMutex);
+         if (fReadvLimits.size() >= kMaxEntries)
+            fReadvLimits.clear();
+         fReadvLimits[server] = std::make_pair(iorMax, iovMax);
+      }
+
+   private:
+      static constexpr std::size_t kMaxEntries = 1000;
+
+      std::mutex                                      fMutex;
+      std::map<std::string, std::string>              fLocations;   // Original URL -> last URL
+      std::map<std::string, std::pair<Int_t, Int_t>>  fReadvLimits; // Data server -> readv_ior_max, readv_iov_max
 };
 
+TNetXNGOpenCache &GetOpenCache()
+{
+   static TNetXNGOpenCache cache;
+   return cache;
+}
+
+Bool_t IsOpenCacheEnabled()
+{
+   return gEnv->GetValue("NetXNG.CacheOpenLocations", 1) != 0;
+}
+
+} // anonymous namespace
+
 
 ClassImp(TNetXNGFile);
 
@@ -194,8 +295,24 @@ TNetXNGFile::TNetXNGFile(const char *url,
       return;
    }
 
-   // Open the file synchronously
-   status = fFile->Open(fUrl->GetURL(), fMode);
+   // Open the file synchronously. When reading, first try the data server
+   // which served the previous open of the same URL, falling back to the
+   // full open if the file is not there anymore
+   const Bool_t useCache = (fMode == OpenFlags::Read) && IsOpenCacheEnabled();
+   const std::string location = useCache ? GetOpenCache().GetLocation(fUrl->GetURL()) : std::string();
+   if (!location.empty()) {
+      if (gDebug >= 1)
+         Info("Open", "opening %s at cached location %s", fUrl->GetURL().c_str(), location.c_str());
+      status = fFile->Open(location, fMode);
+      if (!status.IsOK()) {
+         GetOpenCache().ForgetLocation(fUrl->GetURL());
+         // a file object cannot be reused after a failed open
+         delete fFile;
+         fFile = new File();
+      }
+   }
+   if (location.empty() || !status.IsOK())
+      status = fFile->Open(fUrl->GetURL(), fMode);
    if (!status.IsOK()) {
 #if XrdVNUMBER >= 40000
       if( status.code == errRedirect )
@@ -209,6 +326,17 @@ TNetXNGFile::TNetXNGFile(const char *url,
       return;
    }
 
+#if XrdVNUMBER >= 40000
+   if (useCache && location.empty()) {
+      std::string lasturl;
+      fFile->GetProperty("LastURL", lasturl);
+      URL lrl(lasturl);
+      // local redirections are not cached, they are cheap to resolve
+      if (!lasturl.empty() && lasturl != fUrl->GetURL() && lrl.GetProtocol().compare("file") != 0)
+         GetOpenCache().SetLocation(fUrl->GetURL(), lasturl);
+   }
+#endif
+
    if( (fMode & OpenFlags::New) || (fMode & OpenFlags::Delete) ||
        (fMode & OpenFlags::Update) )
       fWritable = true;
@@ -469,6 +597,66 @@ Bool_t TNetXNGFile::ReadBuffer(char *buffer, Long64_t position, Int_t length)
 
 Bool_t TNetXNGFile::ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
       Int_t nbuffs)
+{
+   Double_t start = 0;
+   if (gPerfStats) start = TTimeStamp();
+
+   Int_t totalBytes = 0;
+   for (Int_t i = 0; i < nbuffs; ++i)
+      totalBytes += length[i];
+
+   // Issue the requests asynchronously but wait for all responses
+   TSemaphore semaphore(0);
+   Bool_t     failed = kFALSE;
+   if (ReadBuffersAsync(buffer, position, length, nbuffs, [&](Bool_t f) {
+          failed = f;
+          semaphore.Post();
+       }))
+      return kTRUE;
+   semaphore.Wait();
+
+   if (failed)
+      return kTRUE;
+
+   // Bump the globals
+   fBytesRead  += totalBytes;
+   fgBytesRead += totalBytes;
+   fReadCalls  ++;
+   fgReadCalls ++;
+
+   if (gPerfStats) {
+      fOffset = position[0];
+      gPerfStats->FileReadEvent(this, totalBytes, start);
+   }
+
+   if (gMonitoringWriter)
+      gMonitoringWriter->SendFileReadProgress(this);
+
+   return kFALSE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read scattered data chunks without waiting for the data
+///
+/// The chunks are sent as one or more vector reads, and `callback` is invoked
+/// exactly once, from an XRootD client thread or from this one if the requests
+/// could not be issued, when all the responses arrived. Its argument is kTRUE
+/// if any of the reads failed. The buffer must stay valid until then. As
+/// opposed to ReadBuffers(), the read statistics of the file are not updated.
+///
+/// param buffer:   a pointer to a buffer big enough to hold all of the
+///                 requested data
+/// param position: position[i] is the seek position of chunk i of len
+///                 length[i]
+/// param length:   length[i] is the length of the chunk at offset
+///                 position[i]
+/// param nbuffs:   number of chunks
+/// param callback: function invoked on completion
+/// returns:        kTRUE if the file is not usable, in which case the
+///                 callback is not invoked
+
+Bool_t TNetXNGFile::ReadBuffersAsync(char *buffer, Long64_t *position, Int_t *length,
+      Int_t nbuffs, std::function<void(Bool_t failed)> callback)
 {
    using namespace XrdCl;
 
@@ -478,23 +666,15 @@ Bool_t TNetXNGFile::ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
 
    std::vector<ChunkList>      chunkLists;
    ChunkList                   chunks;
-   std::vector<XRootDStatus*> *statuses;
-   TSemaphore                 *semaphore;
-   Int_t                       totalBytes = 0;
    Long64_t                    offset     = 0;
    char                       *cursor     = buffer;
 
-   Double_t start = 0;
-   if (gPerfStats) start = TTimeStamp();
-
    if (fArchiveOffset)
       for (Int_t i = 0; i < nbuffs; i++)
          position[i] += fArchiveOffset;
 
    // Build a list of chunks. Put the buffers in the ChunkInfo's
    for (Int_t i = 0; i < nbuffs; ++i) {
-      totalBytes += length[i];
-
       // If the length is bigger than max readv size, split into smaller chunks
       if (length[i] > fReadvIorMax) {
          Int_t nsplit = length[i] / fReadvIorMax;
@@ -532,65 +712,27 @@ Bool_t TNetXNGFile::ReadBuffers(char *buffer, Long64_t *position, Int_t *length,
    if( !chunks.empty() )
       chunkLists.push_back(chunks);
 
-   TAsyncReadvHandler *handler;
-   XRootDStatus        status;
-   semaphore = new TSemaphore(0);
-   statuses  = new std::vector<XRootDStatus*>(chunkLists.size());
+   auto state = std::make_shared<TAsyncReadvState>();
+   state->fPending  += static_cast<Int_t>(chunkLists.size());
+   state->fCallback  = std::move(callback);
 
-   // Read asynchronously but wait for all responses
    std::vector<ChunkList>::iterator it;
    for (it = chunkLists.begin(); it != chunkLists.end(); ++it)
    {
-      handler = new TAsyncReadvHandler(statuses, it - chunkLists.begin(),
-                                       semaphore);
-      status = fFile->VectorRead(*it, 0, handler);
+      TAsyncReadvHandler *handler = new TAsyncReadvHandler(state);
+      XRootDStatus status = fFile->VectorRead(*it, 0, handler);
 
       if (!status.IsOK()) {
-         Error("ReadBuffers", "%s", status.ToStr().c_str());
-         return kTRUE;
-      }
-   }
-
-   // Wait for all responses
-   for (it = chunkLists.begin(); it != chunkLists.end(); ++it) {
-      semaphore->Wait();
-   }
-
-   // Check for errors
-   for (it = chunkLists.begin(); it != chunkLists.end(); ++it) {
-      XRootDStatus *st = statuses->at(it - chunkLists.begin());
-
-      if (!st->IsOK()) {
-         Error("ReadBuffers", "%s", st->ToStr().c_str());
-         for( ; it != chunkLists.end(); ++it )
-         {
-            st = statuses->at( it - chunkLists.begin() );
-            delete st;
-         }
-         delete statuses;
-         delete semaphore;
-
-         return kTRUE;
+         // The handler of a request that was not issued is never called
+         delete handler;
+         state->Fail(status.ToStr());
+         state->Done(static_cast<Int_t>(chunkLists.end() - it));
+         break;
       }
-      delete st;
    }
 
-   // Bump the globals
-   fBytesRead  += totalBytes;
-   fgBytesRead += totalBytes;
-   fReadCalls  ++;
-   fgReadCalls ++;
-
-   if (gPerfStats) {
-      fOffset = position[0];
-      gPerfStats->FileReadEvent(this, totalBytes, start);
-   }
-
-   if (gMonitoringWriter)
-      gMonitoringWriter->SendFileReadProgress(this);
-
-   delete statuses;
-   delete semaphore;
+   // Release the reference held while issuing the requests
+   state->Done();
    return kFALSE;
 }
 
@@ -760,6 +902,10 @@ Bool_t TNetXNGFile::GetVectorReadLimits()
 #else
    URL dataServer(fFile->GetDataServer());
 #endif
+   const Bool_t useCache = IsOpenCacheEnabled();
+   if (useCache && GetOpenCache().GetReadvLimits(dataServer.GetHostId(), fReadvIorMax, fReadvIovMax))
+      return kTRUE;
+
    FileSystem fs(dataServer);
    Buffer  arg;
    Buffer *response;
@@ -795,6 +941,9 @@ Bool_t TNetXNGFile::GetVectorReadLimits()
      fReadvIorMax = 2097136;
    }
 
+   if (useCache)
+      GetOpenCache().SetReadvLimits(dataServer.GetHostId(), fReadvIorMax, fReadvIovMax);
+
    return kTRUE;
 }
 
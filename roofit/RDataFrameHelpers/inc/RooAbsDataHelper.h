@@ -22,6 +22,7 @@
 #include <RooArgSet.h>
 #include <RooDataSet.h>
 #include <RooDataHist.h>
+#include <RooVectorDataStore.h>
 #include <RooMsgService.h>
 
 #include <ROOT/RDataFrame.hxx>
@@ -34,6 +35,7 @@
 #include <cstddef>
 #include <string>
 #include <stdexcept>
+#include <type_traits>
 
 class TTreeReader;
 
@@ -163,45 +165,83 @@ private:
   /// \note The order of the variables inside `events` must be consistent with the order given in the constructor.
   /// No matching by name is performed.
   /// \param eventSize Size of a single event.
+  ///
+  /// For a RooDataSet, the events are transposed into one column per variable,
+  /// which are appended to the dataset in bulk with
+  /// RooVectorDataStore::appendColumns(). This avoids setting all variables
+  /// and filling the dataset event by event.
   void FillDataSet(const std::vector<double>& events, unsigned int eventSize) {
     if (events.empty())
       return;
 
     const RooArgSet& argSet = *_dataset->get();
 
-    for (std::size_t i = 0; i < events.size(); i += eventSize) {
+    if (std::is_same<DataSet_t, RooDataSet>::value) {
+      std::vector<std::vector<double>> columns(eventSize);
+      for (auto& column : columns) {
+        column.reserve(events.size() / eventSize);
+      }
+      for (std::size_t i = 0; i < events.size(); i += eventSize) {
+        if (!InRange(argSet, &events[i], eventSize))
+          continue;
+        for (std::size_t j=0; j < eventSize; ++j) {
+          columns[j].push_back(events[i+j]);
+        }
+      }
 
-      // Creating a RooDataSet from an RDataFrame should be consistent with the
-      // creation from a TTree. The construction from a TTree discards entries
-      // outside the variable definition range, so we have to do that too (see
-      // also RooTreeDataStore::loadValues).
+      auto store = dynamic_cast<RooVectorDataStore*>(_dataset->store());
+      if (store && store->appendColumns(argSet, std::move(columns)))
+        return;
 
-      bool allOK = true;
-      for (std::size_t j=0; j < eventSize; ++j) {
-        auto * destArg = static_cast<RooAbsRealLValue*>(argSet[j]);
-        double sourceVal = events[i+j];
-
-        if (!destArg->inRange(sourceVal, nullptr)) {
-          _numInvalid++ ;
-          allOK = false;
-          const auto prefix = std::string(_dataset->ClassName()) + "Helper::FillDataSet(" + _dataset->GetName() + ") ";
-          if (_numInvalid < 5) {
-            // Unlike in the TreeVectorStore case, we don't log the event
-            // number here because we don't know it anyway, because of
-            // RDataFrame slots and multithreading.
-            oocoutI(nullptr, DataHandling) << prefix << "Skipping event because " << destArg->GetName()
-                << " cannot accommodate the value " << sourceVal << "\n";
-          } else if (_numInvalid == 5) {
-            oocoutI(nullptr, DataHandling) << prefix << "Skipping ...\n";
-          }
-          break ;
+      // The layout of the dataset doesn't support the bulk insertion, so we
+      // fall back to adding the events that passed the range check one by one.
+      const std::size_t nPassed = columns.empty() ? 0 : columns.front().size();
+      for (std::size_t i = 0; i < nPassed; ++i) {
+        for (std::size_t j=0; j < eventSize; ++j) {
+          static_cast<RooAbsRealLValue*>(argSet[j])->setVal(columns[j][i]);
         }
-        destArg->setVal(sourceVal);
-      }
-      if(allOK) {
         _dataset->add(argSet);
       }
+      return;
+    }
+
+    for (std::size_t i = 0; i < events.size(); i += eventSize) {
+      if (!InRange(argSet, &events[i], eventSize))
+        continue;
+      for (std::size_t j=0; j < eventSize; ++j) {
+        static_cast<RooAbsRealLValue*>(argSet[j])->setVal(events[i+j]);
+      }
+      _dataset->add(argSet);
+    }
+  }
+
+  /// Check if all values of the event fit into the ranges of the variables.
+  bool InRange(const RooArgSet& argSet, const double* event, unsigned int eventSize) {
+    // Creating a RooDataSet from an RDataFrame should be consistent with the
+    // creation from a TTree. The construction from a TTree discards entries
+    // outside the variable definition range, so we have to do that too (see
+    // also RooTreeDataStore::loadValues).
+
+    for (std::size_t j=0; j < eventSize; ++j) {
+      auto * destArg = static_cast<RooAbsRealLValue*>(argSet[j]);
+      double sourceVal = event[j];
+
+      if (!destArg->inRange(sourceVal, nullptr)) {
+        _numInvalid++ ;
+        const auto prefix = std::string(_dataset->ClassName()) + "Helper::FillDataSet(" + _dataset->GetName() + ") ";
+        if (_numInvalid < 5) {
+          // Unlike in the TreeVectorStore case, we don't log the event
+          // number here because we don't know it anyway, because of
+          // RDataFrame slots and multithreading.
+          oocoutI(nullptr, DataHandling) << prefix << "Skipping event because " << destArg->GetName()
+              << " cannot accommodate the value " << sourceVal << "\n";
+        } else if (_numInvalid == 5) {
+          oocoutI(nullptr, DataHandling) << prefix << "Skipping ...\n";
+        }
+        return false;
+      }
     }
+    return true;
   }
 };
 
@@ -488,6 +488,112 @@ __rooglobal__ void computeNovosibirsk(BatchesHandle batches)
       batches._output[i] = fast_exp(batches._output[i]);
 }
 
+/// Apply the interpolation for one nuisance parameter of a PiecewiseInterpolation to the output, which holds the
+/// result of the previous parameters. The inputs are the low, high and nominal variations and the parameter. The extra
+/// arguments are the interpolation code, whether the output should be initialized with the nominal values first, and
+/// whether negative results should be set to zero at the end.
+__rooglobal__ void computePiecewiseInterpolation(BatchesHandle batches)
+{
+   Batch low = batches[0], high = batches[1], nominal = batches[2], param = batches[3];
+   const int icode = batches.extraArg(0);
+   const bool init = batches.extraArg(1);
+   const bool clampAtZero = batches.extraArg(2);
+
+   if (init) {
+      for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP)
+         batches._output[i] = nominal[i];
+   }
+
+   switch (icode) {
+   case 0:
+      // piece-wise linear
+      for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP) {
+         if (param[i] > 0)
+            batches._output[i] += param[i] * (high[i] - nominal[i]);
+         else
+            batches._output[i] += param[i] * (nominal[i] - low[i]);
+      }
+      break;
+   case 1:
+      // piece-wise log
+      for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP) {
+         if (param[i] >= 0)
+            batches._output[i] *= pow(high[i] / nominal[i], +param[i]);
+         else
+            batches._output[i] *= pow(low[i] / nominal[i], -param[i]);
+      }
+      break;
+   case 2:
+   case 3:
+      // parabolic with linear extrapolation, and the parabolic version of log-normal
+      for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP) {
+         const double a = 0.5 * (high[i] + low[i]) - nominal[i];
+         const double b = 0.5 * (high[i] - low[i]);
+         if (param[i] > 1.)
+            batches._output[i] += (2 * a + b) * (param[i] - 1) + high[i] - nominal[i];
+         else if (param[i] < -1.)
+            batches._output[i] += -1 * (2 * a - b) * (param[i] + 1) + low[i] - nominal[i];
+         else
+            batches._output[i] += a * param[i] * param[i] + b * param[i];
+      }
+      break;
+   case 4:
+      // polynomial interpolation and linear extrapolation
+      for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP) {
+         const double x = param[i];
+         if (x > 1.) {
+            batches._output[i] += x * (high[i] - nominal[i]);
+         } else if (x < -1.) {
+            batches._output[i] += x * (nominal[i] - low[i]);
+         } else {
+            const double eps_plus = high[i] - nominal[i];
+            const double eps_minus = nominal[i] - low[i];
+            const double S = 0.5 * (eps_plus + eps_minus);
+            const double A = 0.0625 * (eps_plus - eps_minus);
+
+            double val = nominal[i] + x * (S + x * A * (15. + x * x * (-10. + x * x * 3.)));
+            if (val < 0.)
+               val = 0.;
+            batches._output[i] += val - nominal[i];
+         }
+      }
+      break;
+   case 5:
+      // polynomial interpolation and linear extrapolation, skipping bins with zero nominal value
+      for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP) {
+         const double x = param[i];
+         if (x > 1. || x < -1.) {
+            if (x > 0)
+               batches._output[i] += x * (high[i] - nominal[i]);
+            else
+               batches._output[i] += x * (nominal[i] - low[i]);
+         } else if (nominal[i] != 0) {
+            const double eps_plus = high[i] - nominal[i];
+            const double eps_minus = nominal[i] - low[i];
+            const double S = (eps_plus + eps_minus) / 2;
+            const double A = (eps_plus - eps_minus) / 2;
+
+            // functions and derivatives are equal at the boundaries
+            const double a = S;
+            const double b = 3 * A / 2.;
+            const double d = -A / 2.;
+
+            double val = nominal[i] + a * x + b * x * x + d * x * x * x * x;
+            if (val < 0.)
+               val = 0.;
+            batches._output[i] += val - nominal[i];
+         }
+      }
+      break;
+   }
+
+   if (clampAtZero) {
+      for (size_t i = BEGIN; i < batches.getNEvents(); i += STEP)
+         if (batches._output[i] < 0.)
+            batches._output[i] = 0.;
+   }
+}
+
 __rooglobal__ void computePoisson(BatchesHandle batches)
 {
    Batch x = batches[0], mean = batches[1];
@@ -619,6 +725,7 @@ std::vector<void (*)(BatchesHandle)> getFunctions()
            computeLognormal,
            computeNegativeLogarithms,
            computeNovosibirsk,
+           computePiecewiseInterpolation,
            computePoisson,
            computePolynomial,
            computeProdPdf,
@@ -78,8 +78,8 @@ public:
    void compute(cudaStream_t *, Computer computer, RestrictArr output, size_t nEvents, const VarVector &vars,
                 const ArgVector &extraArgs) override
    {
-      static std::vector<double> buffer;
-      buffer.resize(vars.size() * bufferSize);
+      // Not static: the RooFitDriver can call compute() for several nodes concurrently.
+      std::vector<double> buffer(vars.size() * bufferSize);
 
       if (ROOT::IsImplicitMTEnabled()) {
          ROOT::Internal::TExecutor ex;
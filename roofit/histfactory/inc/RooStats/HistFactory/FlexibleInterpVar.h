@@ -61,6 +61,8 @@ namespace HistFactory{
     const std::vector<double>& low() const;
     const std::vector<double>& high() const;
 
+    void translate(RooFit::Detail::CodeSquashContext &ctx) const override;
+
   private:
 
     double PolyInterpValue(int i, double x) const;
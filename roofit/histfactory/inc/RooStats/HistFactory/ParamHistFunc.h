@@ -62,6 +62,8 @@ public:
   std::list<double>* plotSamplingHint(RooAbsRealLValue& obs, double xlo, double xhi) const override;
   bool isBinnedDistribution(const RooArgSet& obs) const override { return _dataVars.overlaps(obs); }
 
+  void translate(RooFit::Detail::CodeSquashContext &ctx) const override;
+
 
 protected:
 
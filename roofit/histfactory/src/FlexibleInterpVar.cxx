@@ -24,6 +24,7 @@
 #include "RooArgList.h"
 #include "RooMsgService.h"
 #include "RooTrace.h"
+#include "RooFit/Detail/CodeSquashContext.h"
 
 #include "RooStats/HistFactory/FlexibleInterpVar.h"
 
@@ -451,6 +452,23 @@ double FlexibleInterpVar::evaluate() const
   return total;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Translate the interpolation into code for the RooFuncWrapper, accumulating
+/// the contributions of all parameters in a temporary variable.
+
+void FlexibleInterpVar::translate(RooFit::Detail::CodeSquashContext &ctx) const
+{
+  std::string total = ctx.getTmpVarName();
+  std::string code = "double " + total + " = " + RooFit::Detail::CodeSquashContext::toString(_nominal) + ";\n";
+  for (std::size_t i = 0; i < _paramList.size(); ++i) {
+    code += total + " = " + ctx.buildCall("RooFit::Detail::EvaluateFuncs::flexibleInterp", _interpCode[i], _low[i],
+                                          _high[i], _interpBoundary, _nominal, _paramList[i], total) + ";\n";
+  }
+  code += total + " = " + total + " <= 0 ? std::numeric_limits<double>::min() : " + total + ";\n";
+  ctx.addToCodeBody(this, code);
+  ctx.addResult(this, total);
+}
+
 void FlexibleInterpVar::printMultiline(ostream& os, Int_t contents,
                    bool verbose, TString indent) const
 {
@@ -47,6 +47,7 @@
 #include "RooArgList.h"
 #include "RooWorkspace.h"
 #include "RunContext.h"
+#include "RooFit/Detail/CodeSquashContext.h"
 
 #include "TH1.h"
 
@@ -615,6 +616,13 @@ void ParamHistFunc::computeBatch(cudaStream_t*, double* output, size_t size, Roo
     data.push_back(dataMap.at(var));
   }
 
+  // Look up the values of the parameters only once per bin, and not for
+  // every entry in the dataset
+  std::vector<double> paramValues(_dataSet.numEntries());
+  for (std::size_t iBin = 0; iBin < paramValues.size(); ++iBin) {
+    paramValues[iBin] = dataMap.at(&getParameter(iBin))[0];
+  }
+
   // Run computation for each entry in the dataset
   for (std::size_t i = 0; i < size; ++i) {
     for (unsigned int j = 0; j < _dataVars.size(); ++j) {
@@ -623,9 +631,7 @@ void ParamHistFunc::computeBatch(cudaStream_t*, double* output, size_t size, Roo
       var.setCachedValue(data[j][i], /*notifyClients=*/false);
     }
 
-    const auto index = _dataSet.getIndex(_dataVars, /*fast=*/true);
-    const RooAbsReal& param = getParameter(index);
-    output[i] = param.getVal();
+    output[i] = paramValues[_dataSet.getIndex(_dataVars, /*fast=*/true)];
   }
 
   // Restore old values
@@ -635,6 +641,21 @@ void ParamHistFunc::computeBatch(cudaStream_t*, double* output, size_t size, Roo
   }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Translate the parameter lookup into code for the RooFuncWrapper. The
+/// parameters are arranged in the bin order of the internal RooDataHist, so
+/// they can be indexed with its bin index.
+
+void ParamHistFunc::translate(RooFit::Detail::CodeSquashContext &ctx) const
+{
+  RooArgList params;
+  for (Int_t i = 0; i < _dataSet.numEntries(); ++i) {
+    params.add(getParameter(i));
+  }
+  std::string const& idx = _dataSet.calculateTreeIndexForCodeSquash(this, ctx, _dataVars);
+  ctx.addResult(this, ctx.buildArg(params) + "[" + idx + "]");
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Advertise that all integrals can be handled internally.
 
@@ -32,6 +32,8 @@
 #include "RooNumIntConfig.h"
 #include "RooTrace.h"
 #include "RunContext.h"
+#include "RooBatchCompute.h"
+#include "RooFit/Detail/CodeSquashContext.h"
 
 #include <exception>
 #include <math.h>
@@ -308,133 +310,62 @@ double PiecewiseInterpolation::evaluate() const
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Translate the interpolation into code for the RooFuncWrapper, accumulating
+/// the contributions of all parameters in a temporary variable.
+
+void PiecewiseInterpolation::translate(RooFit::Detail::CodeSquashContext &ctx) const
+{
+  std::string const& nominal = ctx.getResult(_nominal);
+  std::string sum = ctx.getTmpVarName();
+  std::string code = "double " + sum + " = " + nominal + ";\n";
+  for (unsigned int i = 0; i < _paramSet.size(); ++i) {
+    code += sum + " = " + ctx.buildCall("RooFit::Detail::EvaluateFuncs::piecewiseInterpolation", _interpCode[i],
+                                        _lowSet[i], _highSet[i], nominal, _paramSet[i], sum) + ";\n";
+  }
+  if (_positiveDefinite) {
+    code += sum + " = " + sum + " < 0 ? 0 : " + sum + ";\n";
+  }
+  ctx.addToCodeBody(this, code);
+  ctx.addResult(this, sum);
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Interpolate between input distributions for all values of the observable in `evalData`.
-/// \param[in,out] evalData Struct holding spans pointing to input data. The results of this function will be stored here.
-/// \param[in] normSet Arguments to normalise over.
-void PiecewiseInterpolation::computeBatch(cudaStream_t*, double* sum, size_t /*size*/, RooFit::Detail::DataMap const& dataMap) const {
+/// The interpolation for each nuisance parameter is applied to the output
+/// with the RooBatchCompute::PiecewiseInterpolation kernel in turn.
+/// \param[in] stream The CUDA stream, if the computation is done on the GPU.
+/// \param[out] sum The output array.
+/// \param[in] nEvents The number of values to compute.
+/// \param[in] dataMap The input data of the servers.
+void PiecewiseInterpolation::computeBatch(cudaStream_t* stream, double* sum, size_t nEvents, RooFit::Detail::DataMap const& dataMap) const {
+  auto dispatch = stream ? RooBatchCompute::dispatchCUDA : RooBatchCompute::dispatchCPU;
   auto nominal = dataMap.at(_nominal);
-  for(unsigned int j=0; j < nominal.size(); ++j) {
-    sum[j] = nominal[j];
-  }
 
   for (unsigned int i=0; i < _paramSet.size(); ++i) {
-    const double param = static_cast<RooAbsReal*>(_paramSet.at(i))->getVal();
-    auto low   = dataMap.at(_lowSet.at(i));
-    auto high  = dataMap.at(_highSet.at(i));
     const int icode = _interpCode[i];
-
-    switch(icode) {
-    case 0: {
-      // piece-wise linear
-      for (unsigned int j=0; j < nominal.size(); ++j) {
-        if(param >0)
-          sum[j] += param * (high[j]    - nominal[j]);
-        else
-          sum[j] += param * (nominal[j] - low[j]    );
-      }
-      break;
-    }
-    case 1: {
-      // pice-wise log
-      for (unsigned int j=0; j < nominal.size(); ++j) {
-        if(param >=0)
-          sum[j] *= pow(high[j]/ nominal[j], +param);
-        else
-          sum[j] *= pow(low[j] / nominal[j], -param);
-      }
-      break;
-    }
-    case 2:
-      // parabolic with linear
-      for (unsigned int j=0; j < nominal.size(); ++j) {
-        const double a = 0.5*(high[j]+low[j])-nominal[j];
-        const double b = 0.5*(high[j]-low[j]);
-        const double c = 0;
-        if (param > 1.) {
-          sum[j] += (2*a+b)*(param -1)+high[j]-nominal[j];
-        } else if (param < -1.) {
-          sum[j] += -1*(2*a-b)*(param +1)+low[j]-nominal[j];
-        } else {
-          sum[j] +=  a*pow(param ,2) + b*param +c;
-        }
-      }
-      break;
-    case 3: {
-      //parabolic version of log-normal
-      for (unsigned int j=0; j < nominal.size(); ++j) {
-        const double a = 0.5*(high[j]+low[j])-nominal[j];
-        const double b = 0.5*(high[j]-low[j]);
-        const double c = 0;
-        if (param > 1.) {
-          sum[j] += (2*a+b)*(param -1)+high[j]-nominal[j];
-        } else if (param < -1.) {
-          sum[j] += -1*(2*a-b)*(param +1)+low[j]-nominal[j];
-        } else {
-          sum[j] +=  a*pow(param ,2) + b*param +c;
-        }
-      }
-      break;
-    }
-    case 4:
-      for (unsigned int j=0; j < nominal.size(); ++j) {
-        const double x  = param;
-        if (x > 1.) {
-          sum[j] += x * (high[j]    - nominal[j]);
-        } else if (x < -1.) {
-          sum[j] += x * (nominal[j] - low[j]);
-        } else {
-          const double eps_plus = high[j] - nominal[j];
-          const double eps_minus = nominal[j] - low[j];
-          const double S = 0.5 * (eps_plus + eps_minus);
-          const double A = 0.0625 * (eps_plus - eps_minus);
-
-          double val = nominal[j] + x * (S + x * A * ( 15. + x * x * (-10. + x * x * 3.  ) ) );
-
-          if (val < 0.) val = 0.;
-          sum[j] += val - nominal[j];
-        }
-      }
-      break;
-    case 5:
-      for (unsigned int j=0; j < nominal.size(); ++j) {
-        if (param > 1. || param < -1.) {
-          if(param>0)
-            sum[j] += param * (high[j]    - nominal[j]);
-          else
-            sum[j] += param * (nominal[j] - low[j]    );
-        } else if (nominal[j] != 0) {
-          const double eps_plus = high[j] - nominal[j];
-          const double eps_minus = nominal[j] - low[j];
-          const double S = (eps_plus + eps_minus)/2;
-          const double A = (eps_plus - eps_minus)/2;
-
-          //fcns+der are eq at bd
-          const double a = S;
-          const double b = 3*A/(2*1.);
-          //double c = 0;
-          const double d = -A/(2*1.*1.*1.);
-
-          double val = nominal[j] + a * param + b * pow(param, 2) + d * pow(param, 4);
-          if (val < 0.) val = 0.;
-
-          sum[j] += val - nominal[j];
-        }
-      }
-      break;
-    default:
+    if (icode < 0 || icode > 5) {
       coutE(InputArguments) << "PiecewiseInterpolation::evaluateSpan(): " << _paramSet[i].GetName()
                        << " with unknown interpolation code" << icode << std::endl;
       throw std::invalid_argument("PiecewiseInterpolation::evaluateSpan() got invalid interpolation code " + std::to_string(icode));
-      break;
     }
   }
 
-  if (_positiveDefinite) {
-    for(unsigned int j=0; j < nominal.size(); ++j) {
-      if (sum[j] < 0.)
-        sum[j] = 0.;
-    }
+  if (_paramSet.empty()) {
+    // Without parameters, the result is the nominal value. With the nominal
+    // values as variations, the linear interpolation doesn't change it.
+    dispatch->compute(stream, RooBatchCompute::PiecewiseInterpolation, sum, nEvents,
+                      {nominal, nominal, nominal, nominal}, {0., 1., double(_positiveDefinite)});
+    return;
+  }
+
+  for (unsigned int i=0; i < _paramSet.size(); ++i) {
+    const bool first = i == 0;
+    const bool last = i + 1 == _paramSet.size();
+    dispatch->compute(stream, RooBatchCompute::PiecewiseInterpolation, sum, nEvents,
+                      {dataMap.at(&_lowSet[i]), dataMap.at(&_highSet[i]), nominal, dataMap.at(&_paramSet[i])},
+                      {double(_interpCode[i]), double(first), double(last && _positiveDefinite)});
   }
 }
 
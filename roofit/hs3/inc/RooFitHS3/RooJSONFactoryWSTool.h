@@ -17,6 +17,7 @@
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 class RooArgList;
@@ -119,6 +120,7 @@ protected:
    std::unique_ptr<RooDataSet> unbinned(RooDataHist const &hist);
    RooRealVar *getWeightVar(const char *name);
    RooRealVar *createObservable(const std::string &name, const RooJSONFactoryWSTool::Var &var);
+   RooAbsArg &wsImportArg(RooAbsArg const &arg);
 
 public:
    class MissingRootnodeError : public std::exception {
@@ -150,6 +152,26 @@ public:
    RooJSONFactoryWSTool(RooWorkspace &ws) : _workspace{&ws} {}
    RooWorkspace *workspace() { return _workspace; }
 
+   /// Construct an object of type `Obj_t` with the given name and the
+   /// constructor arguments `args`, which are passed after the name and the
+   /// title, and import it into the workspace. This is much faster than going
+   /// through the string parsing of RooWorkspace::factory().
+   /// \return The object in the workspace, which can also be an existing
+   ///         object of the same name that was reused.
+   template <class Obj_t, typename... Args_t>
+   Obj_t &wsEmplace(const std::string &name, Args_t &&...args)
+   {
+      return wsImport(Obj_t(name.c_str(), name.c_str(), std::forward<Args_t>(args)...));
+   }
+
+   /// Import the object `arg` into the workspace, recycling the existing
+   /// nodes of the same name, and return the object in the workspace.
+   template <class Obj_t>
+   Obj_t &wsImport(Obj_t const &arg)
+   {
+      return static_cast<Obj_t &>(wsImportArg(arg));
+   }
+
    template <class T>
    static bool registerImporter(const std::string &key, bool topPriority = true)
    {
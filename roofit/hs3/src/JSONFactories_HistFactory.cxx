@@ -115,46 +115,38 @@ T *findClient(RooAbsArg *gamma)
 RooRealVar *getNP(RooJSONFactoryWSTool *tool, const char *parname)
 {
    RooRealVar *par = tool->workspace()->var(parname);
-   if (!tool->workspace()->var(parname)) {
-      par = (RooRealVar *)tool->workspace()->factory(std::string(parname) + "[0.,-5,5]");
-   }
-   if (par) {
-      par->setAttribute("np");
+   if (!par) {
+      par = &tool->wsEmplace<RooRealVar>(parname, 0., -5., 5.);
    }
+   par->setAttribute("np");
    std::string globname = std::string("nom_") + parname;
    RooRealVar *nom = tool->workspace()->var(globname);
    if (!nom) {
-      nom = (RooRealVar *)tool->workspace()->factory(globname + "[0.]");
-   }
-   if (nom) {
-      nom->setAttribute("glob");
-      nom->setRange(-5, 5);
-      nom->setConstant(true);
+      nom = &tool->wsEmplace<RooRealVar>(globname, 0.);
    }
+   nom->setAttribute("glob");
+   nom->setRange(-5, 5);
+   nom->setConstant(true);
    std::string constrname = std::string("sigma_") + parname;
    RooRealVar *sigma = tool->workspace()->var(constrname);
    if (!sigma) {
-      sigma = (RooRealVar *)tool->workspace()->factory(constrname + "[1.]");
-   }
-   if (sigma) {
-      sigma->setRange(sigma->getVal(), sigma->getVal());
-      sigma->setConstant(true);
+      sigma = &tool->wsEmplace<RooRealVar>(constrname, 1.);
    }
-   if (!par)
-      RooJSONFactoryWSTool::error(TString::Format("unable to find nuisance parameter '%s'", parname));
+   sigma->setRange(sigma->getVal(), sigma->getVal());
+   sigma->setConstant(true);
    return par;
 }
 RooAbsPdf *getConstraint(RooJSONFactoryWSTool *tool, const std::string &sysname)
 {
    RooAbsPdf *pdf = tool->workspace()->pdf((sysname + "_constraint").c_str());
    if (!pdf) {
-      pdf = (RooAbsPdf *)(tool->workspace()->factory(
-         TString::Format("RooGaussian::%s_constraint(alpha_%s,nom_alpha_%s,sigma_alpha_%s)", sysname.c_str(),
-                         sysname.c_str(), sysname.c_str(), sysname.c_str())
-            .Data()));
-   }
-   if (!pdf) {
-      RooJSONFactoryWSTool::error(TString::Format("unable to find constraint term '%s'", sysname.c_str()));
+      RooRealVar *par = tool->workspace()->var("alpha_" + sysname);
+      RooRealVar *nom = tool->workspace()->var("nom_alpha_" + sysname);
+      RooRealVar *sigma = tool->workspace()->var("sigma_alpha_" + sysname);
+      if (!par || !nom || !sigma) {
+         RooJSONFactoryWSTool::error(TString::Format("unable to find constraint term '%s'", sysname.c_str()));
+      }
+      pdf = &tool->wsEmplace<RooGaussian>(sysname + "_constraint", *par, *nom, *sigma);
    }
    return pdf;
 }
@@ -212,7 +204,7 @@ public:
                if (r) {
                   normElems.add(*r);
                } else {
-                  normElems.add(*static_cast<RooRealVar *>(tool->workspace()->factory(nfname + "[1.]")));
+                  normElems.add(tool->wsEmplace<RooRealVar>(nfname, 1.));
                }
             }
          }
@@ -284,13 +276,11 @@ public:
             }
          }
 
-         RooProduct shape(name.c_str(), (name + "_shape").c_str(), shapeElems);
-         tool->workspace()->import(shape, RooFit::RecycleConflictNodes(true), RooFit::Silence(true));
+         tool->wsImport(RooProduct(name.c_str(), (name + "_shape").c_str(), shapeElems));
          if (normElems.size() > 0) {
-            RooProduct norm((name + "_norm").c_str(), (name + "_norm").c_str(), normElems);
-            tool->workspace()->import(norm, RooFit::RecycleConflictNodes(true), RooFit::Silence(true));
+            tool->wsEmplace<RooProduct>(name + "_norm", normElems);
          } else {
-            tool->workspace()->factory("RooConstVar::" + name + "_norm(1.)");
+            tool->wsEmplace<RooConstVar>(name + "_norm", 1.);
          }
       } catch (const std::runtime_error &e) {
          RooJSONFactoryWSTool::error("function '" + name +
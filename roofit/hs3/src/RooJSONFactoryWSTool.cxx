@@ -23,6 +23,7 @@
 #include <RooDataSet.h>
 #include <RooDataHist.h>
 #include <RooStats/ModelConfig.h>
+#include <RooWorkspace.h>
 
 #include "TROOT.h"
 #include "TH1.h"
@@ -180,7 +181,7 @@ RooAbsReal *RooJSONFactoryWSTool::request<RooAbsReal>(const std::string &objname
    if (retval)
       return retval;
    if (isNumber(objname))
-      return dynamic_cast<RooAbsReal *>(this->workspace()->factory(objname));
+      return &wsEmplace<RooConstVar>(objname, std::stod(objname));
    if (irootnode().has_child("pdfs")) {
       const JSONNode &pdfs = irootnode()["pdfs"];
       if (pdfs.has_child(objname)) {
@@ -1033,9 +1034,8 @@ RooRealVar *RooJSONFactoryWSTool::getWeightVar(const char *weightName)
 {
    RooRealVar *weightVar = _workspace->var(weightName);
    if (!weightVar) {
-      _workspace->factory(std::string(weightName) + "[0.,0.,10000000]");
+      weightVar = &wsEmplace<RooRealVar>(weightName, 0., 0., 10000000.);
    }
-   weightVar = _workspace->var(weightName);
    return weightVar;
 }
 
@@ -1264,12 +1264,21 @@ void RooJSONFactoryWSTool::clearScope()
    _scope.observables.clear();
 }
 
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+// import an object into the workspace, without going through the factory
+RooAbsArg &RooJSONFactoryWSTool::wsImportArg(RooAbsArg const &arg)
+{
+   if (_workspace->import(arg, RooFit::RecycleConflictNodes(true), RooFit::Silence(true))) {
+      RooJSONFactoryWSTool::error(std::string("unable to import object '") + arg.GetName() + "' into the workspace");
+   }
+   return *_workspace->arg(arg.GetName());
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
 // create an observable
 RooRealVar *RooJSONFactoryWSTool::createObservable(const std::string &name, const RooJSONFactoryWSTool::Var &var)
 {
-   _workspace->factory(name + "[" + std::to_string(var.min) + "]");
-   RooRealVar *rrv = _workspace->var(name);
+   RooRealVar *rrv = &wsEmplace<RooRealVar>(name, var.min);
    rrv->setMin(var.min);
    rrv->setMax(var.max);
    rrv->setConstant(true);
@@ -1287,7 +1296,7 @@ RooJSONFactoryWSTool::readBinnedData(const JSONNode &n, const std::string &namec
       RooJSONFactoryWSTool::error("data is not a map");
    if (varlist.empty()) {
       std::string obsname = "obs_x_" + namecomp;
-      varlist.add(*(_workspace->factory(obsname + "[0.]")));
+      varlist.add(wsEmplace<RooRealVar>(obsname, 0.));
    }
    auto bins = RooJSONFactoryWSTool::generateBinIndices(varlist);
    if (!n.has_child("counts"))
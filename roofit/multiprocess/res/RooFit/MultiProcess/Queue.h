@@ -16,14 +16,15 @@
 #include "RooFit/MultiProcess/types.h"
 #include "RooFit/MultiProcess/Messenger.h"
 
-#include <queue>
+#include <deque>
+#include <vector>
 
 namespace RooFit {
 namespace MultiProcess {
 
 class Queue {
 public:
-   bool pop(JobTask &job_task);
+   bool pop(std::size_t worker_id, JobTask &job_task);
    void add(JobTask job_task);
 
    void loop();
@@ -32,7 +33,8 @@ public:
    void process_worker_message(std::size_t this_worker_id, W2Q message);
 
 private:
-   std::queue<JobTask> queue_;
+   std::vector<std::deque<JobTask>> worker_queues_; // one deque of tasks per worker
+   std::size_t next_worker_ = 0;                    // worker whose deque receives the next task
    std::size_t N_tasks_ = 0; // total number of received tasks
    std::size_t N_tasks_at_workers_ = 0;
 };
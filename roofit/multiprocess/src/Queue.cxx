@@ -17,6 +17,8 @@
 #include "RooFit/MultiProcess/Job.h" // complete Job object for JobManager::get_job_object()
 #include "RooFit/MultiProcess/util.h"
 
+#include <algorithm> // max_element
+
 namespace RooFit {
 namespace MultiProcess {
 
@@ -38,25 +40,53 @@ namespace MultiProcess {
  * runtimes (this simple strategy could be implemented with a PUSH-PULL
  * ZeroMQ socket from master to workers, which would distribute tasks in a
  * round-robin fashion, which, indeed, does not do load balancing).
+ *
+ * The tasks are kept in one deque per worker. A worker takes tasks from its
+ * own deque first, and steals from the back of the fullest other deque when
+ * its own deque is empty. This keeps the assignment of tasks to workers
+ * stable between evaluations, while still balancing the load.
  */
 
 /// Have a worker ask for a task-message from the queue
 ///
+/// Tasks are taken from the front of the worker's own deque. If that one is
+/// empty, a task is stolen from the back of the fullest deque of the other
+/// workers.
+///
+/// \param[in] worker_id ID of the worker that asks for a task.
 /// \param[out] job_task JobTask reference to put the Job ID and the task index into.
 /// \return true if a task was popped from the queue successfully, false if the queue was empty.
-bool Queue::pop(JobTask &job_task)
+bool Queue::pop(std::size_t worker_id, JobTask &job_task)
 {
-   if (queue_.empty()) {
-      return false;
-   } else {
-      job_task = queue_.front();
-      queue_.pop();
+   if (worker_queues_.empty()) {
+      worker_queues_.resize(JobManager::instance()->process_manager().N_workers());
+   }
+
+   auto &own_queue = worker_queues_[worker_id];
+   if (!own_queue.empty()) {
+      job_task = own_queue.front();
+      own_queue.pop_front();
       return true;
    }
+
+   auto victim = std::max_element(worker_queues_.begin(), worker_queues_.end(),
+                                  [](std::deque<JobTask> const &a, std::deque<JobTask> const &b) {
+                                     return a.size() < b.size();
+                                  });
+   if (victim == worker_queues_.end() || victim->empty()) {
+      return false;
+   }
+   job_task = victim->back();
+   victim->pop_back();
+   return true;
 }
 
 /// Enqueue a task
 ///
+/// On the queue process, the tasks are distributed over the deques of the
+/// workers in a round-robin fashion, so that a worker gets the same tasks
+/// of a Job in subsequent evaluations as long as no work stealing happens.
+///
 /// \param[in] job_task JobTask object that contains the Job ID and the task index.
 void Queue::add(JobTask job_task)
 {
@@ -64,7 +94,11 @@ void Queue::add(JobTask job_task)
       JobManager::instance()->messenger().send_from_master_to_queue(M2Q::enqueue, job_task.job_id, job_task.state_id,
                                                                     job_task.task_id);
    } else if (JobManager::instance()->process_manager().is_queue()) {
-      queue_.push(job_task);
+      if (worker_queues_.empty()) {
+         worker_queues_.resize(JobManager::instance()->process_manager().N_workers());
+      }
+      worker_queues_[next_worker_].push_back(job_task);
+      next_worker_ = (next_worker_ + 1) % worker_queues_.size();
    } else {
       throw std::logic_error("calling Communicator::to_master_queue from slave process");
    }
@@ -94,7 +128,7 @@ void Queue::process_worker_message(std::size_t this_worker_id, W2Q message)
    case W2Q::dequeue: {
       // dequeue task
       JobTask job_task;
-      bool popped = pop(job_task);
+      bool popped = pop(this_worker_id, job_task);
       if (popped) {
          // Note: below two commands should be run atomically for thread safety (if that ever becomes an issue)
          JobManager::instance()->messenger().send_from_queue_to_worker(
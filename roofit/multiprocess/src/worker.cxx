@@ -108,6 +108,11 @@ void worker_loop()
                      JobManager::get_job_object(job_id_for_state)->update_state();
                   }
 
+                  // ask for the next task already, so that the answer of the queue is waiting for us when we
+                  // are done with this one and we don't sit idle during the round trip
+                  JobManager::instance()->messenger().send_from_worker_to_queue(W2Q::dequeue);
+                  dequeue_acknowledged = false;
+
                   JobManager::get_job_object(job_id)->evaluate_task(task_id);
                   JobManager::get_job_object(job_id)->send_back_task_result_from_worker(task_id);
 
@@ -34,6 +34,8 @@ public:
 
   Int_t getAnalyticalIntegral(RooArgSet& allVars, RooArgSet& analVars, const char* rangeName=0) const override;
   double analyticalIntegral(Int_t code, const char* rangeName=0) const override;
+  std::string buildCallToAnalyticIntegral(Int_t code, const char *rangeName,
+                                          RooFit::Detail::CodeSquashContext &ctx) const override;
 
   Int_t getGenerator(const RooArgSet& directVars, RooArgSet &generateVars, bool staticInitOK=true) const override;
   void generateEvent(Int_t code) override;
@@ -56,6 +58,7 @@ protected:
   double evaluate() const override;
   void computeBatch(cudaStream_t*, double* output, size_t size, RooFit::Detail::DataMap const&) const override;
   inline bool canComputeBatchWithCuda() const override { return true; }
+  void translate(RooFit::Detail::CodeSquashContext &ctx) const override;
 
 private:
 
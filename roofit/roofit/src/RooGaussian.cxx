@@ -22,6 +22,8 @@ Plain Gaussian p.d.f
 
 #include "RooGaussian.h"
 #include "RooBatchCompute.h"
+#include "RooFit/Detail/CodeSquashContext.h"
+#include "RooFit/Detail/EvaluateFuncs.h"
 #include "RooHelpers.h"
 #include "RooMath.h"
 #include "RooRandom.h"
@@ -70,6 +72,13 @@ void RooGaussian::computeBatch(cudaStream_t* stream, double* output, size_t nEve
           {dataMap.at(x), dataMap.at(mean), dataMap.at(sigma)});
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Translate the Gaussian into code for the RooFuncWrapper.
+void RooGaussian::translate(RooFit::Detail::CodeSquashContext &ctx) const
+{
+  ctx.addResult(this, ctx.buildCall("RooFit::Detail::EvaluateFuncs::gaussianEvaluate", x, mean, sigma));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 Int_t RooGaussian::getAnalyticalIntegral(RooArgSet& allVars, RooArgSet& analVars, const char* /*rangeName*/) const
@@ -117,6 +126,21 @@ double RooGaussian::analyticalIntegral(Int_t code, const char* rangeName) const
   );
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Build the code of the analytical integrals for the RooFuncWrapper. For
+/// the integral over the mean, the roles of `x` and `mean` are swapped.
+
+std::string RooGaussian::buildCallToAnalyticIntegral(Int_t code, const char *rangeName,
+                                                     RooFit::Detail::CodeSquashContext &ctx) const
+{
+  assert(code==1 || code==2);
+  const char *funcName = "RooFit::Detail::EvaluateFuncs::gaussianIntegral";
+  if (code == 1) {
+    return ctx.buildCall(funcName, x.min(rangeName), x.max(rangeName), mean, sigma);
+  }
+  return ctx.buildCall(funcName, mean.min(rangeName), mean.max(rangeName), x, sigma);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 Int_t RooGaussian::getGenerator(const RooArgSet& directVars, RooArgSet &generateVars, bool /*staticInitOK*/) const
@@ -17,6 +17,8 @@ Poisson pdf
 #include "RooMath.h"
 #include "RooNaNPacker.h"
 #include "RooBatchCompute.h"
+#include "RooFit/Detail/CodeSquashContext.h"
+#include "RooFit/Detail/EvaluateFuncs.h"
 
 #include "Math/ProbFuncMathCore.h"
 
@@ -72,6 +74,22 @@ void RooPoisson::computeBatch(cudaStream_t* stream, double* output, size_t nEven
     {static_cast<double>(_protectNegative), static_cast<double>(_noRounding)});
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Translate the Poisson distribution into code for the RooFuncWrapper.
+void RooPoisson::translate(RooFit::Detail::CodeSquashContext &ctx) const
+{
+  std::string xName = ctx.getResult(x);
+  if (!_noRounding) {
+    xName = "std::floor(" + xName + ")";
+  }
+  std::string const &meanName = ctx.getResult(mean);
+  std::string result = ctx.buildCall("RooFit::Detail::EvaluateFuncs::poissonEvaluate", xName, meanName);
+  if (_protectNegative) {
+    result = "(" + meanName + " < 0 ? std::numeric_limits<double>::quiet_NaN() : " + result + ")";
+  }
+  ctx.addResult(this, result);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 Int_t RooPoisson::getAnalyticalIntegral(RooArgSet& allVars, RooArgSet& analVars, const char* /*rangeName*/) const
@@ -142,6 +160,25 @@ double RooPoisson::analyticalIntegral(Int_t code, const char* rangeName) const
 
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Build the code of the analytical integrals for the RooFuncWrapper.
+
+std::string RooPoisson::buildCallToAnalyticIntegral(Int_t code, const char *rangeName,
+                                                    RooFit::Detail::CodeSquashContext &ctx) const
+{
+  R__ASSERT(code == 1 || code == 2);
+  RooRealProxy const &integrand = code == 1 ? x : mean;
+  const double integrandMin = integrand.min(rangeName);
+  const double integrandMax = integrand.hasMax() ? integrand.max(rangeName) : std::numeric_limits<double>::infinity();
+
+  std::string xName = ctx.getResult(x);
+  if (!_noRounding) {
+    xName = "std::floor(" + xName + ")";
+  }
+  return ctx.buildCall("RooFit::Detail::EvaluateFuncs::poissonIntegral", code, mean, xName, integrandMin,
+                       integrandMax, static_cast<unsigned int>(_protectNegative));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Advertise internal generator in x
 
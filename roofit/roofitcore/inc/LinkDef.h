@@ -124,6 +124,7 @@
 #pragma link C++ class RooFIter+ ;
 #pragma link C++ class RooFormula+ ;
 #pragma link C++ class RooFormulaVar+ ;
+#pragma link C++ class RooFit::Experimental::RooFuncWrapper+ ;
 #pragma link C++ class RooGenContext+ ;
 #pragma link C++ class RooGenericPdf+ ;
 #pragma link C++ class RooGenProdProj+ ;
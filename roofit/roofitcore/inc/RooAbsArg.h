@@ -49,6 +49,11 @@ class RooCollectionProxy;
 using RooSetProxy = RooCollectionProxy<RooArgSet>;
 using RooListProxy = RooCollectionProxy<RooArgList>;
 class RooExpensiveObjectCache ;
+namespace RooFit {
+namespace Detail {
+class CodeSquashContext;
+}
+} // namespace RooFit
 class RooWorkspace ;
 
 class RooRefArray : public TObjArray {
@@ -592,8 +597,15 @@ public:
   };
 
   virtual bool canComputeBatchWithCuda() const { return false; }
+  /// Returns true if computeBatch() only reads the data map, so that the
+  /// RooFitDriver can call it concurrently to the computeBatch() of other
+  /// nodes. This is the case for nodes that only dispatch to a RooBatchCompute
+  /// kernel, which is assumed if the node can be computed with CUDA.
+  virtual bool canComputeBatchConcurrently() const { return canComputeBatchWithCuda(); }
   virtual bool isReducerNode() const { return false; }
 
+  virtual void translate(RooFit::Detail::CodeSquashContext &ctx) const;
+
   virtual void applyWeightSquared(bool flag);
 
   virtual std::unique_ptr<RooArgSet> fillNormSetForServer(RooArgSet const& normSet, RooAbsArg const& server) const;
@@ -85,6 +85,7 @@ protected:
   TString     _sealNotice ;  ///< User-defined notice shown when reading a sealed likelihood
   RooArgSet*  _funcObsSet ;  ///< List of observables in the pdf expression
   RooArgSet   _cachedNodes ; ///<! List of nodes that are cached as constant expressions
+  RooArgSet   _cachedConstParams ; ///<! Snapshot of the constant parameters with which the cached nodes were computed
 
   RooAbsReal* _origFunc ;  ///< Original function
   RooAbsData* _origData ;  ///< Original data
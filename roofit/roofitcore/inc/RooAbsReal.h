@@ -168,6 +168,7 @@ public:
   virtual double analyticalIntegralWN(Int_t code, const RooArgSet* normSet, const char* rangeName=0) const ;
   virtual Int_t getAnalyticalIntegral(RooArgSet& allVars, RooArgSet& analVars, const char* rangeName=0) const ;
   virtual double analyticalIntegral(Int_t code, const char* rangeName=0) const ;
+  virtual std::string buildCallToAnalyticIntegral(Int_t code, const char *rangeName, RooFit::Detail::CodeSquashContext &ctx) const;
   virtual bool forceAnalyticalInt(const RooAbsArg& /*dep*/) const {
     // Interface to force RooRealIntegral to offer given observable for internal integration
     // even if this is deemed unsafe. This default implementation returns always false
@@ -372,6 +373,10 @@ public:
   virtual bool isOffsetting() const { return false ; }
   virtual double offset() const { return 0 ; }
 
+  /// Return true if gradient() can compute the analytical gradient of this function.
+  virtual bool hasGradient() const { return false; }
+  virtual void gradient(double *out) const;
+
   static void setHideOffset(bool flag);
   static bool hideOffset() ;
 
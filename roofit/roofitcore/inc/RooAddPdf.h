@@ -90,6 +90,8 @@ public:
   CacheMode canNodeBeCached() const override { return RooAbsArg::NotAdvised ; };
   void setCacheAndTrackHints(RooArgSet&) override;
 
+  void translate(RooFit::Detail::CodeSquashContext &ctx) const override;
+
 protected:
 
   void selectNormalization(const RooArgSet* depSet=0, bool force=false) override;
@@ -133,6 +135,8 @@ protected:
   double getValV(const RooArgSet* set=nullptr) const override ;
   void computeBatch(cudaStream_t*, double* output, size_t nEvents, RooFit::Detail::DataMap const&) const override;
   inline bool canComputeBatchWithCuda() const override { return true; }
+  // computeBatch() updates the coefficient and normalization caches
+  inline bool canComputeBatchConcurrently() const override { return false; }
 
 
   mutable RooAICRegistry _codeReg; ///<! Registry of component analytical integration codes
@@ -78,6 +78,7 @@ public:
   const RooHistFunc& histFunc() const { return (*_histFunc); }
   double evaluate() const override;
   void computeBatch(cudaStream_t*, double* output, size_t size, RooFit::Detail::DataMap const&) const override;
+  void translate(RooFit::Detail::CodeSquashContext &ctx) const override;
 
 private:
   RooTemplateProxy<const RooHistFunc> _histFunc;
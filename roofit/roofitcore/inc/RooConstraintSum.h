@@ -57,6 +57,8 @@ public:
 
   std::unique_ptr<RooArgSet> fillNormSetForServer(RooArgSet const& normSet, RooAbsArg const& server) const override;
 
+  void translate(RooFit::Detail::CodeSquashContext &ctx) const override;
+
 protected:
 
   RooListProxy _set1 ;    ///< Set of constraint terms
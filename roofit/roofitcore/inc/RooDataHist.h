@@ -40,6 +40,9 @@ namespace RooFit {
 namespace TestStatistics {
 class RooAbsL;
 }
+namespace Detail {
+class CodeSquashContext;
+}
 }
 
 class RooDataHist : public RooAbsData, public RooDirItem {
@@ -158,6 +161,9 @@ public:
     return getIndex(static_cast<const RooAbsCollection&>(coord), fast);
   }
 
+  std::string calculateTreeIndexForCodeSquash(RooAbsArg const *klass, RooFit::Detail::CodeSquashContext &ctx,
+                                              const RooAbsCollection &coords) const;
+
   void removeSelfFromDir() { removeFromDir(this) ; }
 
 
@@ -0,0 +1,148 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2023, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#ifndef RooFit_Detail_CodeSquashContext_h
+#define RooFit_Detail_CodeSquashContext_h
+
+#include <RooAbsArg.h>
+#include <RooFit/Detail/DataMap.h>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+class RooAbsCollection;
+
+template <class T>
+class RooTemplateProxy;
+
+namespace RooFit {
+namespace Detail {
+
+/// \class CodeSquashContext
+/// A class to maintain the context for squashing of RooFit models into code.
+///
+/// The RooFit::Experimental::RooFuncWrapper translates a computation graph
+/// into the body of a single C++ function `double f(double *params, double
+/// const *obs)`, which is then compiled by the interpreter and differentiated
+/// by Clad. Each node of the graph implements RooAbsArg::translate(), where it
+/// gets the code of its inputs with getResult() and registers its own code
+/// with addResult(). Results that are not simple variables are stored in
+/// temporary variables, so each node is only evaluated once.
+///
+/// Nodes that depend on vector observables of the dataset are computed inside
+/// the loop over the events opened by a reducer node like the RooNLLVarNew
+/// with beginLoop(). All other nodes are computed once, outside of the loops.
+
+class CodeSquashContext {
+public:
+   /// RAII helper to close the loop over the events opened by beginLoop().
+   class LoopScope {
+   public:
+      LoopScope(CodeSquashContext &ctx) : _ctx{ctx} {}
+      ~LoopScope() { _ctx.endLoop(); }
+
+   private:
+      CodeSquashContext &_ctx;
+   };
+
+   void addParam(RooAbsArg const &param, std::size_t idx);
+   void addObs(RooAbsArg const &obs, std::size_t offset, std::size_t size);
+
+   void addResult(RooAbsArg const *key, std::string const &value);
+   std::string const &getResult(RooAbsArg const &arg);
+
+   template <class T>
+   std::string const &getResult(RooTemplateProxy<T> const &key)
+   {
+      return getResult(key.arg());
+   }
+
+   bool isVector(RooAbsArg const &arg);
+
+   std::string getTmpVarName();
+
+   void addToCodeBody(std::string const &in, bool isScopeIndep = false);
+   void addToCodeBody(RooAbsArg const *klass, std::string const &in);
+
+   std::unique_ptr<LoopScope> beginLoop(RooAbsArg const *in);
+   /// Name of the index of the current loop over the events.
+   std::string const &loopIndex() const { return _loopIndex; }
+
+   /// Build the code to call the function `funcname` with the arguments
+   /// `args`, which are translated with buildArg().
+   template <typename... Args_t>
+   std::string buildCall(std::string const &funcname, Args_t const &...args)
+   {
+      std::stringstream ss;
+      ss << funcname << "(";
+      buildCallArgs(ss, args...);
+      ss << ")";
+      return ss.str();
+   }
+
+   std::string buildArg(RooAbsArg const &arg) { return getResult(arg); }
+   template <class T>
+   std::string buildArg(RooTemplateProxy<T> const &arg)
+   {
+      return getResult(arg);
+   }
+   std::string buildArg(RooAbsCollection const &in);
+   std::string buildArg(std::vector<double> const &in);
+   std::string buildArg(std::string const &in) { return in; }
+   std::string buildArg(const char *in) { return in; }
+   template <class T, typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+   std::string buildArg(T x)
+   {
+      return toString(static_cast<double>(x));
+   }
+
+   static std::string toString(double x);
+
+   std::string assembleCode(std::string const &returnExpr);
+
+private:
+   struct ObsInfo {
+      std::size_t offset = 0; ///< Index of the first value in the observables array
+      std::size_t size = 0;   ///< Number of values, one for scalar observables
+   };
+
+   void endLoop();
+
+   template <class Arg_t, typename... Args_t>
+   void buildCallArgs(std::stringstream &ss, Arg_t const &arg, Args_t const &...args)
+   {
+      ss << buildArg(arg);
+      if (sizeof...(args) > 0) {
+         ss << ", ";
+      }
+      buildCallArgs(ss, args...);
+   }
+   void buildCallArgs(std::stringstream &) {}
+
+   std::map<DataKey, std::string> _results;    ///< Code of the nodes that were translated already
+   std::map<DataKey, ObsInfo> _obsInfos;        ///< Location of the observables in the observables array
+   std::map<DataKey, bool> _isVector;           ///< Cache of isVector()
+   std::string _globalScope;                    ///< Code outside of the loops
+   std::string _loopBody;                       ///< Code of the loop currently open
+   std::string _loopIndex;                      ///< Index of the loop currently open, empty outside of loops
+   std::size_t _loopSize = 0;                   ///< Number of events of the loop currently open
+   std::vector<DataKey> _loopResults;           ///< Nodes whose results are only valid in the current loop
+   int _tmpVarIdx = 0;                          ///< Counter to create unique names for the temporary variables
+};
+
+} // namespace Detail
+} // namespace RooFit
+
+#endif
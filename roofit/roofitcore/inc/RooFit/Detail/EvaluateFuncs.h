@@ -0,0 +1,312 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2023, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#ifndef RooFit_Detail_EvaluateFuncs_h
+#define RooFit_Detail_EvaluateFuncs_h
+
+#include <Math/ProbFuncMathCore.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+/// \namespace RooFit::Detail::EvaluateFuncs
+/// Inline implementations of the mathematical functions of RooFit pdfs and
+/// functions. They are used as building blocks of the code generated by the
+/// RooFit::Experimental::RooFuncWrapper, so they must only depend on their
+/// arguments and be simple enough to be differentiated by Clad.
+
+namespace RooFit {
+namespace Detail {
+namespace EvaluateFuncs {
+
+/// Unnormalized Gaussian, as in RooGaussian::evaluate().
+inline double gaussianEvaluate(double x, double mean, double sigma)
+{
+   const double arg = x - mean;
+   const double sig = sigma;
+   return std::exp(-0.5 * arg * arg / (sig * sig));
+}
+
+/// Integral of the unnormalized Gaussian between xMin and xMax, as in
+/// RooGaussian::analyticalIntegral().
+inline double gaussianIntegral(double xMin, double xMax, double mean, double sigma)
+{
+   // The normalisation constant 1./sqrt(2*pi*sigma^2) is left out in evaluate().
+   // Therefore, the integral is scaled up by that amount to make RooFit normalise
+   // correctly.
+   const double resultScale = 2.5066282746310002 * sigma; // sqrt(2 pi) * sigma
+
+   // Here everything is scaled and shifted into a standard normal distribution:
+   const double xscale = std::sqrt(2.) * sigma;
+   const double max = (xMax - mean) / xscale;
+   const double min = (xMin - mean) / xscale;
+
+   // Here we go for maximum precision: We compute all integrals in the UPPER
+   // tail of the Gaussian, because erfc has the highest precision there.
+   // Therefore, the different cases for range limits in the negative hemisphere are mapped onto
+   // the equivalent points in the upper hemisphere using erfc(-x) = 2. - erfc(x)
+   const double ecmin = std::erfc(std::abs(min));
+   const double ecmax = std::erfc(std::abs(max));
+
+   return resultScale * 0.5 * (min * max < 0.0 ? 2.0 - (ecmin + ecmax) : max <= 0. ? ecmax - ecmin : ecmin - ecmax);
+}
+
+/// Poisson probability of `x` for a mean `par`, as TMath::Poisson().
+inline double poissonEvaluate(double x, double par)
+{
+   if (x < 0)
+      return 0;
+   if (x == 0.0)
+      return std::exp(-par);
+   return std::exp(x * std::log(par) - std::lgamma(x + 1.) - par);
+}
+
+/// Integral of the Poisson distribution over `x` (code 1) or over the mean
+/// (code 2), as in RooPoisson::analyticalIntegral(). An infinite upper limit
+/// stands for an integration range without maximum.
+inline double poissonIntegral(int code, double mu, double x, double integrandMin, double integrandMax,
+                              unsigned int protectNegative)
+{
+   if (protectNegative && mu < 0.0)
+      return std::exp(-2.0 * mu); // make it fall quickly
+
+   if (code == 1) {
+      // Implement integral over x as summation. Add special handling in case
+      // range boundaries are not on integer values of x
+      integrandMin = std::max(0., integrandMin);
+
+      if (integrandMax < 0. || integrandMax < integrandMin)
+         return 0;
+      // Integrating the full Poisson distribution here
+      if (std::isinf(integrandMax))
+         return 1.;
+
+      // The range as integers. ixMin is included, ixMax outside.
+      const unsigned int ixMin = integrandMin;
+      const unsigned int ixMax = std::min(integrandMax + 1., (double)std::numeric_limits<unsigned int>::max());
+
+      // Sum from 0 to just before the bin outside of the range.
+      if (ixMin == 0)
+         return ROOT::Math::poisson_cdf(ixMax - 1, mu);
+
+      // If necessary, subtract from 0 to the beginning of the range
+      if (ixMin <= mu)
+         return ROOT::Math::poisson_cdf(ixMax - 1, mu) - ROOT::Math::poisson_cdf(ixMin - 1, mu);
+
+      // Avoid catastrophic cancellation in the high tails:
+      return ROOT::Math::poisson_cdf_c(ixMin - 1, mu) - ROOT::Math::poisson_cdf_c(ixMax - 1, mu);
+   }
+
+   // the integral with respect to the mean is the integral of a gamma distribution
+   // negative ix does not need protection (gamma returns 0.0)
+   const double ix = 1 + x;
+   return ROOT::Math::gamma_cdf(integrandMax, ix, 1.0) - ROOT::Math::gamma_cdf(integrandMin, ix, 1.0);
+}
+
+/// Contribution of one parameter to the interpolated value `sum` of a
+/// PiecewiseInterpolation, for the interpolation code `code`.
+inline double
+piecewiseInterpolation(unsigned int code, double low, double high, double nominal, double param, double sum)
+{
+   if (code == 0) {
+      // piece-wise linear
+      if (param > 0)
+         return sum + param * (high - nominal);
+      return sum + param * (nominal - low);
+   } else if (code == 1) {
+      // piece-wise log
+      if (param >= 0)
+         return sum * std::pow(high / nominal, +param);
+      return sum * std::pow(low / nominal, -param);
+   } else if (code == 2 || code == 3) {
+      // parabolic with linear, or parabolic version of log-normal
+      const double a = 0.5 * (high + low) - nominal;
+      const double b = 0.5 * (high - low);
+      if (param > 1)
+         return sum + (2 * a + b) * (param - 1) + high - nominal;
+      if (param < -1)
+         return sum + -1 * (2 * a - b) * (param + 1) + low - nominal;
+      return sum + a * param * param + b * param;
+   } else if (code == 4) {
+      if (param > 1)
+         return sum + param * (high - nominal);
+      if (param < -1)
+         return sum + param * (nominal - low);
+      const double eps_plus = high - nominal;
+      const double eps_minus = nominal - low;
+      const double S = 0.5 * (eps_plus + eps_minus);
+      const double A = 0.0625 * (eps_plus - eps_minus);
+
+      // fcns+der+2nd_der are eq at bd
+      double val = nominal + param * (S + param * A * (15 + param * param * (-10 + param * param * 3)));
+      if (val < 0)
+         val = 0;
+      return sum + val - nominal;
+   } else if (code == 5) {
+      if (param > 1 || param < -1) {
+         if (param > 0)
+            return sum + param * (high - nominal);
+         return sum + param * (nominal - low);
+      }
+      if (nominal == 0)
+         return sum;
+      const double eps_plus = high - nominal;
+      const double eps_minus = nominal - low;
+      const double S = (eps_plus + eps_minus) / 2;
+      const double A = (eps_plus - eps_minus) / 2;
+
+      // fcns+der are eq at bd
+      const double a = S;
+      const double b = 3 * A / 2;
+      const double d = -A / 2;
+
+      double val = nominal + a * param + b * param * param + d * param * param * param * param;
+      if (val < 0)
+         val = 0;
+      return sum + val - nominal;
+   }
+   return sum;
+}
+
+/// Contribution of one parameter to the interpolated value `total` of a
+/// FlexibleInterpVar, for the interpolation code `code` and the boundary
+/// `boundary` of the polynomial interpolation.
+inline double flexibleInterp(unsigned int code, double low, double high, double boundary, double nominal,
+                             double paramVal, double total)
+{
+   if (code == 0) {
+      // piece-wise linear
+      if (paramVal > 0)
+         return total + paramVal * (high - nominal);
+      return total + paramVal * (nominal - low);
+   } else if (code == 1) {
+      // piece-wise log
+      if (paramVal >= 0)
+         return total * std::pow(high / nominal, +paramVal);
+      return total * std::pow(low / nominal, -paramVal);
+   } else if (code == 2 || code == 3) {
+      // parabolic with linear, or parabolic version of log-normal
+      const double a = 0.5 * (high + low) - nominal;
+      const double b = 0.5 * (high - low);
+      if (paramVal > 1)
+         return total + (2 * a + b) * (paramVal - 1) + high - nominal;
+      if (paramVal < -1)
+         return total + -1 * (2 * a - b) * (paramVal + 1) + low - nominal;
+      return total + a * paramVal * paramVal + b * paramVal;
+   } else if (code == 4) {
+      const double x = paramVal;
+      if (x >= boundary)
+         return total * std::pow(high / nominal, +paramVal);
+      if (x <= -boundary)
+         return total * std::pow(low / nominal, -paramVal);
+      if (x == 0)
+         return total;
+
+      // polynomial interpolation, with the same coefficients as
+      // FlexibleInterpVar::PolyInterpValue()
+      const double x0 = boundary;
+      const double powUp = std::pow(high / nominal, x0);
+      const double powDown = std::pow(low / nominal, x0);
+      const double logHi = std::log(high);
+      const double logLo = std::log(low);
+      const double powUpLog = high <= 0.0 ? 0.0 : powUp * logHi;
+      const double powDownLog = low <= 0.0 ? 0.0 : -powDown * logLo;
+      const double powUpLog2 = high <= 0.0 ? 0.0 : powUpLog * logHi;
+      const double powDownLog2 = low <= 0.0 ? 0.0 : -powDownLog * logLo;
+
+      const double S0 = 0.5 * (powUp + powDown);
+      const double A0 = 0.5 * (powUp - powDown);
+      const double S1 = 0.5 * (powUpLog + powDownLog);
+      const double A1 = 0.5 * (powUpLog - powDownLog);
+      const double S2 = 0.5 * (powUpLog2 + powDownLog2);
+      const double A2 = 0.5 * (powUpLog2 - powDownLog2);
+
+      // fcns+der+2nd_der are eq at bd
+      const double a = 1. / (8 * x0) * (15 * A0 - 7 * x0 * S1 + x0 * x0 * A2);
+      const double b = 1. / (8 * x0 * x0) * (-24 + 24 * S0 - 9 * x0 * A1 + x0 * x0 * S2);
+      const double c = 1. / (4 * std::pow(x0, 3)) * (-5 * A0 + 5 * x0 * S1 - x0 * x0 * A2);
+      const double d = 1. / (4 * std::pow(x0, 4)) * (12 - 12 * S0 + 7 * x0 * A1 - x0 * x0 * S2);
+      const double e = 1. / (8 * std::pow(x0, 5)) * (+3 * A0 - 3 * x0 * S1 + x0 * x0 * A2);
+      const double f = 1. / (8 * std::pow(x0, 6)) * (-8 + 8 * S0 - 5 * x0 * A1 + x0 * x0 * S2);
+
+      // evaluate the 6-th degree polynomial using Horner's method
+      return total * (1. + x * (a + x * (b + x * (c + x * (d + x * (e + x * f))))));
+   }
+   return total;
+}
+
+/// Bin number of `val` in a uniform binning with `numBins` bins in [low, high],
+/// clamped to the valid bins as in RooUniformBinning::binNumber().
+inline int getUniformBinning(double low, double high, double val, int numBins)
+{
+   const double binWidth = (high - low) / numBins;
+   const int bin = static_cast<int>((val - low) / binWidth);
+   return bin < 0 ? 0 : (bin > numBins - 1 ? numBins - 1 : bin);
+}
+
+/// Bin number of `val` in a binning with `numBins` bins and the `numBins + 1`
+/// increasing bin boundaries `edges`, clamped to the valid bins as in
+/// RooBinning::binNumber().
+inline int getBinNumber(double const *edges, int numBins, double val)
+{
+   int bin = 0;
+   while (bin < numBins - 1 && val >= edges[bin + 1]) {
+      ++bin;
+   }
+   return bin;
+}
+
+/// Term of an unbinned negative log-likelihood for an event of weight
+/// `weight` and probability `pdfVal`, as in RooNLLVarNew.
+inline double nllTerm(double weight, double pdfVal)
+{
+   if (weight * weight == 0.)
+      return 0.;
+   return -weight * std::log(pdfVal);
+}
+
+/// Term of a binned negative log-likelihood for a bin with `N` observed
+/// events and `mu` expected events, as in RooNLLVarNew. The term includes the
+/// observed events, which the normal Poisson term would subtract.
+inline double binnedNllTerm(double N, double mu)
+{
+   if (mu <= 0 && N > 0) {
+      // data present where zero events are predicted
+      return std::numeric_limits<double>::quiet_NaN();
+   }
+   if (std::abs(mu) < 1e-10 && std::abs(N) < 1e-10) {
+      // log(Poisson(0,0)=0 but can't be calculated with usual log-formula
+      return 0.;
+   }
+   return -1 * (-mu + N * std::log(mu) - std::lgamma(N + 1)) + N;
+}
+
+/// Extended term of a negative log-likelihood for `sumEntries` observed and
+/// `expected` expected events, as in RooAbsPdf::extendedTerm(). If
+/// `sumEntriesW2` is not zero, the term is corrected for the squared weights.
+inline double extendedNllTerm(double sumEntries, double expected, double sumEntriesW2)
+{
+   if (expected < 0)
+      return std::numeric_limits<double>::quiet_NaN();
+   // Explicitly handle case Nobs=Nexp=0
+   if (std::abs(expected) < 1e-10 && std::abs(sumEntries) < 1e-10)
+      return 0.;
+   double extra = expected - sumEntries * std::log(expected);
+   if (sumEntriesW2 != 0.0)
+      extra *= sumEntriesW2 / sumEntries;
+   return extra;
+}
+
+} // namespace EvaluateFuncs
+} // namespace Detail
+} // namespace RooFit
+
+#endif
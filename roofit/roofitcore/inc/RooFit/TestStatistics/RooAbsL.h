@@ -141,6 +141,9 @@ protected:
    bool extended_ = false;
 
    std::size_t sim_count_ = 1; // Total number of component p.d.f.s in RooSimultaneous (if any)
+
+   bool constTermsOptimized_ = false; ///< Whether the constant terms are cached in the dataset
+   RooArgSet constParamsSnapshot_;    ///< Constant parameters with which the constant terms were cached
 };
 
 } // namespace TestStatistics
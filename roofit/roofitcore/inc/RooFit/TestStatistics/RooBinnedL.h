@@ -40,9 +40,11 @@ public:
 private:
    mutable bool _first = true;        ///<!
    mutable std::vector<double> _binw; ///<!
+   std::vector<double> logNFactorial_; ///<! log(N!) of the observed count in each bin
    std::unique_ptr<RooChangeTracker> paramTracker_;
    Section lastSection_ = {0, 0};  // used for cache together with the parameter tracker
    mutable ROOT::Math::KahanSum<double> cachedResult_ = 0;
+   bool haveCachedResult_ = false;
 };
 
 } // namespace TestStatistics
@@ -0,0 +1,74 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2023, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#ifndef RooFit_RooFuncWrapper_h
+#define RooFit_RooFuncWrapper_h
+
+#include <RooAbsReal.h>
+#include <RooListProxy.h>
+
+#include <string>
+#include <vector>
+
+class RooAbsData;
+class RooSimultaneous;
+
+namespace RooFit {
+
+namespace Experimental {
+
+/// A wrapper class to store a C++ function of type 'double (*)(double*, double const*)'.
+/// The parameters can be accessed as params[<relative position of param in paramSet>] in the function body.
+/// The observables can be accessed as obs[i] for the i-th observable.
+class RooFuncWrapper final : public RooAbsReal {
+public:
+   RooFuncWrapper(const char *name, const char *title, RooAbsReal const &obj, RooArgSet const &normSet,
+                  const RooAbsData *data = nullptr, RooSimultaneous const *simPdf = nullptr);
+
+   RooFuncWrapper(const RooFuncWrapper &other, const char *name = nullptr);
+
+   TObject *clone(const char *newname) const override { return new RooFuncWrapper(*this, newname); }
+
+   /// Return the default error level of the wrapped function for MINUIT.
+   double defaultErrorLevel() const override { return _defaultErrorLevel; }
+
+   /// Return true if Clad could generate the gradient of the function.
+   bool hasGradient() const override { return _grad; }
+   void gradient(double *out) const override;
+
+   /// Return the code of the body of the generated function.
+   std::string const &funcBody() const { return _funcBody; }
+
+protected:
+   double evaluate() const override;
+
+private:
+   void updateGradientVarBuffer() const;
+
+   using Func = double (*)(double *, double const *);
+   using Grad = void (*)(double *, double const *, double *);
+
+   RooListProxy _params;                          ///< Parameters of the function, sorted by name
+   std::string _funcName;                         ///< Name of the generated function
+   std::string _funcBody;                         ///< Body of the generated function
+   Func _func = nullptr;                          ///<! The generated function
+   Grad _grad = nullptr;                          ///<! The gradient generated by Clad, if any
+   mutable std::vector<double> _gradientVarBuffer; ///<! Values of the parameters passed to the function
+   std::vector<double> _observables;              ///<! Values of the observables passed to the function
+   double _defaultErrorLevel = 1.0;               ///< Default error level of the wrapped function
+
+   ClassDefOverride(RooFuncWrapper, 0);
+};
+
+} // namespace Experimental
+
+} // namespace RooFit
+
+#endif
@@ -67,7 +67,7 @@ enum MPSplit { BulkPartition=0, Interleave=1, SimComponents=2, Hybrid=3 } ;
 
 /// For setting the batch mode flag with the BatchMode() command argument to
 /// RooAbsPdf::fitTo();
-enum class BatchModeOption { Off, Cpu, Cuda, Old };
+enum class BatchModeOption { Off, Cpu, Cuda, Old, CodeGen };
 
 /**
  * \defgroup CmdArgs RooFit command arguments
@@ -83,11 +83,15 @@ public:
   std::list<double>* plotSamplingHint(RooAbsRealLValue& obs, double xlo, double xhi) const override ;
   bool isBinnedDistribution(const RooArgSet&) const override { return _intOrder==0 ; }
   RooArgSet const& getHistObsList() const { return _histObsList; }
+  /// Return the observables that are mapped onto the histogram observables.
+  RooArgSet const& variables() const { return _depList; }
 
 
   Int_t getBin() const;
   std::vector<Int_t> getBins(RooFit::Detail::DataMap const& dataMap) const;
 
+  void translate(RooFit::Detail::CodeSquashContext &ctx) const override;
+
 protected:
 
   bool importWorkspaceHook(RooWorkspace& ws) override ;
@@ -19,6 +19,8 @@
 #include "RooAbsIntegrator.h"
 #include "RooNumIntConfig.h"
 
+#include <vector>
+
 class RooIntegrator1D : public RooAbsIntegrator {
 public:
 
@@ -90,6 +92,9 @@ protected:
 
   double *_x ; //! do not persist
 
+  std::vector<double> _xBatch; ///<! Points of a refinement step that are evaluated in one batch
+  static constexpr int _minBatchSize = 64; ///<! Minimum number of points for a batch evaluation
+
   ClassDefOverride(RooIntegrator1D,0) // 1-dimensional numerical integration engine
 };
 
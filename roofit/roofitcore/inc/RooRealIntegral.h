@@ -23,6 +23,7 @@
 #include "RooSetProxy.h"
 #include "RooListProxy.h"
 #include <list>
+#include <vector>
 
 class RooArgSet ;
 class TH1F ;
@@ -81,6 +82,8 @@ public:
   void setAllowComponentSelection(bool allow);
   bool getAllowComponentSelection() const;
 
+  void translate(RooFit::Detail::CodeSquashContext &ctx) const override;
+
 protected:
 
   mutable bool _valid;
@@ -92,6 +95,7 @@ protected:
   //friend class RooAbsPdf ;
 
   bool initNumIntegrator() const;
+  bool fillNumIntCacheKey(std::vector<double>& key) const;
   void autoSelectDirtyMode() ;
 
   virtual double sum() const ;
@@ -136,6 +140,10 @@ protected:
 
   mutable RooArgSet* _params ; ///<! cache for set of parameters
 
+  mutable std::vector<double> _numIntCacheKey ; ///<! Values the last numeric integration depended on
+  mutable double _numIntCacheVal = 0.0 ;        ///<! Result of the last numeric integration
+  mutable bool _hasNumIntCache = false ;        ///<! If the result of the last numeric integration is cached
+
   bool _cacheNum ;           ///< Cache integral if numeric
   static Int_t _cacheAllNDim ; ///<! Cache all integrals with given numeric dimension
 
@@ -137,6 +137,8 @@ public:
 
   static void cleanup() ;
 
+  void translate(RooFit::Detail::CodeSquashContext &ctx) const override;
+
   protected:
 
   static bool _printScientific ;
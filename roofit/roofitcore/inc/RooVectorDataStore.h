@@ -88,6 +88,7 @@ public:
   /// @{
   ArraysStruct getArrays() const;
   void recomputeSumWeight();
+  bool appendColumns(RooAbsCollection const& vars, std::vector<std::vector<double>>&& columns);
   /// @}
 
 private:
@@ -63,6 +63,8 @@ private:
    // Private member functions
 
    double getValHeterogeneous();
+   double getValConcurrent();
+   bool updateDirtyState(NodeInfo &info);
    std::chrono::microseconds simulateFit(std::chrono::microseconds h2dTime, std::chrono::microseconds d2hTime,
                                          std::chrono::microseconds diffThreshold);
    void markGPUNodes();
@@ -53,6 +53,8 @@ public:
 
    std::unique_ptr<RooArgSet> fillNormSetForServer(RooArgSet const &normSet, RooAbsArg const &server) const override;
 
+   void translate(RooFit::Detail::CodeSquashContext &ctx) const override;
+
 private:
    double evaluate() const override;
    void resetWeightVarNames();
@@ -20,6 +20,7 @@
 #include <RooConstraintSum.h>
 #include <RooDataSet.h>
 #include <RooFitDriver.h>
+#include <RooFuncWrapper.h>
 #include <RooNLLVarNew.h>
 #include <RooRealVar.h>
 #include <RooSimultaneous.h>
@@ -116,15 +117,21 @@ RooFit::BatchModeHelpers::createNLL(RooAbsPdf &pdf, RooAbsData &data, std::uniqu
    nll->addOwnedComponents(std::move(binSamplingPdfs));
    nll->addOwnedComponents(std::move(nllTerms));
 
-   if (auto simPdf = dynamic_cast<RooSimultaneous *>(&finalPdf)) {
+   auto simPdf = dynamic_cast<RooSimultaneous *>(&finalPdf);
+   if (simPdf) {
       RooArgSet parameters;
       pdf.getParameters(data.get(), parameters);
       nll->recursiveRedirectServers(parameters);
+   }
+
+   // The code generation replaces the RooFitDriver
+   if (batchMode != RooFit::BatchModeOption::CodeGen) {
       driver = std::make_unique<RooFitDriver>(*nll, observables, batchMode);
-      driver->setData(data, rangeName, &simPdf->indexCat());
-   } else {
-      driver = std::make_unique<RooFitDriver>(*nll, observables, batchMode);
-      driver->setData(data, rangeName);
+      if (simPdf) {
+         driver->setData(data, rangeName, &simPdf->indexCat());
+      } else {
+         driver->setData(data, rangeName);
+      }
    }
 
    // Set the fitrange attribute so that RooPlot can automatically plot the fitting range by default
@@ -149,6 +156,13 @@ RooFit::BatchModeHelpers::createNLL(RooAbsPdf &pdf, RooAbsData &data, std::uniqu
       pdf.setStringAttribute("fitrange", fitrangeValue.c_str());
    }
 
+   if (batchMode == RooFit::BatchModeOption::CodeGen) {
+      auto nllWrapper = std::make_unique<RooFit::Experimental::RooFuncWrapper>(nll->GetName(), nll->GetTitle(), *nll,
+                                                                               observables, &data, simPdf);
+      nllWrapper->addOwnedComponents(std::move(nll));
+      return nllWrapper;
+   }
+
    auto driverWrapper = makeDriverAbsRealWrapper(std::move(driver), *data.get());
    driverWrapper->addOwnedComponents(std::move(nll));
 
@@ -0,0 +1,275 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2023, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#include <RooFit/Detail/CodeSquashContext.h>
+
+#include <RooAbsCollection.h>
+#include <RooArgSet.h>
+
+#include <cctype>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+
+bool isSimpleExpression(std::string const &value)
+{
+   for (char c : value) {
+      if (!std::isalnum(static_cast<unsigned char>(c)) && c != '_' && c != '.' && c != '[' && c != ']' && c != '+' &&
+          c != '-') {
+         return false;
+      }
+   }
+   return !value.empty();
+}
+
+} // namespace
+
+namespace RooFit {
+namespace Detail {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Register the parameter `param`, which is the element `idx` of the
+/// parameter array of the generated function.
+
+void CodeSquashContext::addParam(RooAbsArg const &param, std::size_t idx)
+{
+   _results[&param] = "params[" + std::to_string(idx) + "]";
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Register the observable `obs`, whose `size` values start at `offset` in
+/// the observables array of the generated function. Observables with more
+/// than one value are vector observables, which can only be used inside loops.
+
+void CodeSquashContext::addObs(RooAbsArg const &obs, std::size_t offset, std::size_t size)
+{
+   _obsInfos[&obs] = ObsInfo{offset, size};
+   _isVector[&obs] = size > 1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Register the code `value` that computes the node `key`. The code is stored
+/// in a temporary variable unless it is a variable or a constant already.
+
+void CodeSquashContext::addResult(RooAbsArg const *key, std::string const &value)
+{
+   if (isSimpleExpression(value)) {
+      _results[key] = value;
+   } else {
+      std::string varName = getTmpVarName();
+      addToCodeBody(key, "const double " + varName + " = " + value + ";\n");
+      _results[key] = varName;
+   }
+   if (!_loopIndex.empty() && isVector(*key)) {
+      _loopResults.emplace_back(key);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the code of the node `arg`, translating it first if necessary.
+
+std::string const &CodeSquashContext::getResult(RooAbsArg const &arg)
+{
+   auto foundObs = _obsInfos.find(&arg);
+   if (foundObs != _obsInfos.end()) {
+      ObsInfo const &info = foundObs->second;
+      std::string &out = _results[&arg];
+      if (info.size == 1) {
+         out = "obs[" + std::to_string(info.offset) + "]";
+      } else if (_loopIndex.empty()) {
+         throw std::runtime_error(std::string("CodeSquashContext: the vector observable ") + arg.GetName() +
+                                  " is used outside of a loop over the data");
+      } else {
+         out = "obs[" + std::to_string(info.offset) + "+" + _loopIndex + "]";
+      }
+      return out;
+   }
+
+   auto found = _results.find(&arg);
+   if (found != _results.end()) {
+      return found->second;
+   }
+
+   if (_loopIndex.empty() && isVector(arg)) {
+      throw std::runtime_error(std::string("CodeSquashContext: the node ") + arg.GetName() +
+                               " depends on vector observables and is used outside of a loop over the data");
+   }
+
+   arg.translate(*this);
+
+   found = _results.find(&arg);
+   if (found == _results.end()) {
+      throw std::runtime_error(std::string("CodeSquashContext: ") + arg.ClassName() + "::translate() for " +
+                               arg.GetName() + " did not register a result");
+   }
+   return found->second;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return true if the node `arg` depends on vector observables, without a
+/// reducer node in between, in which case it has one value per event.
+
+bool CodeSquashContext::isVector(RooAbsArg const &arg)
+{
+   auto found = _isVector.find(&arg);
+   if (found != _isVector.end()) {
+      return found->second;
+   }
+   bool out = false;
+   if (!arg.isReducerNode()) {
+      for (RooAbsArg *server : arg.servers()) {
+         if (server->isValueServer(arg) && isVector(*server)) {
+            out = true;
+            break;
+         }
+      }
+   }
+   _isVector[&arg] = out;
+   return out;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return a unique name for a new temporary variable.
+
+std::string CodeSquashContext::getTmpVarName()
+{
+   return "t" + std::to_string(_tmpVarIdx++);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the code `in` to the body of the loop currently open, or to the code
+/// outside of the loops if `isScopeIndep` is true or no loop is open.
+
+void CodeSquashContext::addToCodeBody(std::string const &in, bool isScopeIndep)
+{
+   if (_loopIndex.empty() || isScopeIndep) {
+      _globalScope += in;
+   } else {
+      _loopBody += in;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Add the code `in` computing the node `klass`, inside the current loop if
+/// the node depends on vector observables.
+
+void CodeSquashContext::addToCodeBody(RooAbsArg const *klass, std::string const &in)
+{
+   addToCodeBody(in, !isVector(*klass));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Open a loop over the events for the reducer node `in`. The number of
+/// events is taken from the vector observables `in` depends on. The loop is
+/// closed when the returned scope object is destroyed.
+
+std::unique_ptr<CodeSquashContext::LoopScope> CodeSquashContext::beginLoop(RooAbsArg const *in)
+{
+   if (!_loopIndex.empty()) {
+      throw std::runtime_error("CodeSquashContext: nested loops over the data are not supported");
+   }
+
+   RooArgSet nodes;
+   in->treeNodeServerList(&nodes);
+   std::size_t loopSize = 1;
+   for (RooAbsArg *node : nodes) {
+      auto found = _obsInfos.find(node);
+      if (found == _obsInfos.end() || found->second.size == 1)
+         continue;
+      if (loopSize > 1 && found->second.size != loopSize) {
+         throw std::runtime_error(std::string("CodeSquashContext: the observables of ") + in->GetName() +
+                                  " have different numbers of events");
+      }
+      loopSize = found->second.size;
+   }
+
+   _loopIndex = "loopIdx" + std::to_string(_tmpVarIdx++);
+   _loopSize = loopSize;
+   _loopBody.clear();
+   return std::make_unique<LoopScope>(*this);
+}
+
+void CodeSquashContext::endLoop()
+{
+   _globalScope += "for (int " + _loopIndex + " = 0; " + _loopIndex + " < " + std::to_string(_loopSize) + "; ++" +
+                   _loopIndex + ") {\n" + _loopBody + "}\n";
+   _loopBody.clear();
+   _loopIndex.clear();
+   _loopSize = 0;
+   // The variables declared in the loop body are out of scope now.
+   for (DataKey const &key : _loopResults) {
+      _results.erase(key);
+   }
+   _loopResults.clear();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Declare an array with the code of the elements of the collection `in` and
+/// return its name.
+
+std::string CodeSquashContext::buildArg(RooAbsCollection const &in)
+{
+   bool isVec = false;
+   std::string elements;
+   for (RooAbsArg *arg : in) {
+      if (!elements.empty())
+         elements += ", ";
+      elements += getResult(*arg);
+      isVec = isVec || isVector(*arg);
+   }
+   std::string arrName = getTmpVarName();
+   addToCodeBody("double " + arrName + "[] = {" + elements + "};\n", !isVec);
+   return arrName;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Declare a constant array with the values `in` and return its name.
+
+std::string CodeSquashContext::buildArg(std::vector<double> const &in)
+{
+   std::string elements;
+   for (double x : in) {
+      if (!elements.empty())
+         elements += ", ";
+      elements += toString(x);
+   }
+   std::string arrName = getTmpVarName();
+   addToCodeBody("const double " + arrName + "[] = {" + elements + "};\n", true);
+   return arrName;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the code of a double constant, without loss of precision.
+
+std::string CodeSquashContext::toString(double x)
+{
+   if (std::isnan(x))
+      return "std::numeric_limits<double>::quiet_NaN()";
+   if (std::isinf(x))
+      return x > 0 ? "std::numeric_limits<double>::infinity()" : "-std::numeric_limits<double>::infinity()";
+   std::stringstream ss;
+   ss << std::setprecision(std::numeric_limits<double>::max_digits10) << x;
+   return ss.str();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the function body with all the code registered so far, returning
+/// the expression `returnExpr`.
+
+std::string CodeSquashContext::assembleCode(std::string const &returnExpr)
+{
+   return _globalScope + "return " + returnExpr + ";\n";
+}
+
+} // namespace Detail
+} // namespace RooFit
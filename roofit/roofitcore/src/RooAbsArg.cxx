@@ -2494,3 +2494,23 @@ void RooAbsArg::applyWeightSquared(bool flag) {
 std::unique_ptr<RooArgSet> RooAbsArg::fillNormSetForServer(RooArgSet const& /*normSet*/, RooAbsArg const& /*server*/) const {
    return nullptr;
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Register the code that computes this RooAbsArg with the
+/// RooFit::Detail::CodeSquashContext, to squash a computation graph into a
+/// single function with the RooFit::Experimental::RooFuncWrapper. Classes that
+/// support code generation override this function, the default implementation
+/// throws a `std::runtime_error`.
+///
+/// \param[in] ctx The context in which the code is generated. The code of the
+///            servers is obtained with CodeSquashContext::getResult(), and
+///            the code of this RooAbsArg is registered with
+///            CodeSquashContext::addResult().
+void RooAbsArg::translate(RooFit::Detail::CodeSquashContext & /*ctx*/) const
+{
+   std::stringstream errorMsg;
+   errorMsg << "Translate function for class \"" << ClassName() << "\" has not yet been implemented.";
+   coutE(Minimization) << errorMsg.str() << std::endl;
+   throw std::runtime_error(errorMsg.str());
+}
@@ -58,6 +58,7 @@ parallelized calculation of test statistics.
 #include "RooProduct.h"
 #include "RooRealSumPdf.h"
 #include "RooTrace.h"
+#include "TestStatistics/ConstantTermsOptimizer.h"
 #include "RooVectorDataStore.h"
 #include "RooBinSamplingPdf.h"
 
@@ -555,10 +556,19 @@ void RooAbsOptTestStatistic::constOptimizeTestStatistic(ConstOpCode opcode, bool
     break ;
 
   case ValueChange:
+    // Nothing to do if the constant parameters still have the values with
+    // which the nodes were cached, e.g. if another minimizer is created for
+    // this test statistic or if the values were reset between two fits
+    if (_optimized && !RooFit::TestStatistics::ConstantTermsOptimizer::constantParametersChanged(*_funcClone, *_dataClone, _cachedConstParams)) {
+      cxcoutI(Optimization) << "RooAbsOptTestStatistic::constOptimize(" << GetName()
+             << ") the constant parameters didn't change since the constant terms were cached, reusing the cache" << endl ;
+      break ;
+    }
     cxcoutI(Optimization) << "RooAbsOptTestStatistic::constOptimize(" << GetName()
            << ") the value of one ore more constant parameter were changed re-evaluating constant term optimization" << endl ;
     // Request a forcible cache update of all cached nodes
     _dataClone->store()->forceCacheUpdate() ;
+    RooFit::TestStatistics::ConstantTermsOptimizer::snapshotConstantParameters(*_funcClone, *_dataClone, _cachedConstParams) ;
 
     break ;
   }
@@ -672,6 +682,7 @@ void RooAbsOptTestStatistic::optimizeConstantTerms(bool activate, bool applyTrac
 
     // Cache constant nodes with dataset - also cache entries corresponding to zero-weights in data when using BinnedLikelihood
     _dataClone->cacheArgs(this,_cachedNodes,_normSet,!_funcClone->getAttribute("BinnedLikelihood")) ;
+    RooFit::TestStatistics::ConstantTermsOptimizer::snapshotConstantParameters(*_funcClone, *_dataClone, _cachedConstParams) ;
 
     // Put all cached nodes in AClean value caching mode so that their evaluate() is never called
     for (auto cacheArg : _cachedNodes) {
@@ -717,6 +728,7 @@ void RooAbsOptTestStatistic::optimizeConstantTerms(bool activate, bool applyTrac
     _dataClone->setDirtyProp(false) ;
 
     _cachedNodes.removeAll() ;
+    _cachedConstParams.removeAll() ;
 
 
     _optimized = false ;
@@ -784,6 +796,7 @@ bool RooAbsOptTestStatistic::setDataSlave(RooAbsData& indata, bool cloneData, bo
   // ReCache constant nodes with dataset
   if (_cachedNodes.getSize()>0) {
     _dataClone->cacheArgs(this,_cachedNodes,_normSet) ;
+    RooFit::TestStatistics::ConstantTermsOptimizer::snapshotConstantParameters(*_funcClone, *_dataClone, _cachedConstParams) ;
   }
 
   // Adjust internal event count
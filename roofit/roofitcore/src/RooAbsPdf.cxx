@@ -1379,6 +1379,9 @@ int RooAbsPdf::calcSumW2CorrectedCovariance(RooMinimizer &minimizer, RooAbsReal
 ///                                                          implemented for the PDFs of the model, likelihood computations are 2x to 10x faster.
 ///                                                          The relative difference of the single log-likelihoods w.r.t. the legacy mode is usually better than 1.E-12,
 ///                                                          and fit parameters usually agree to better than 1.E-6.
+///                                                          With `BatchMode("codegen")`, the likelihood is instead translated into a single C++ function
+///                                                          that is compiled by the interpreter, and the minimizer uses its gradient generated with Clad.
+///                                                          This is only supported for models whose classes implement RooAbsArg::translate().
 /// <tr><td> `IntegrateBins(double precision)` <td> In binned fits, integrate the PDF over the bins instead of using the probability density at the bin centre.
 ///                                                 This can reduce the bias observed when fitting functions with high curvature to binned data.
 ///                                                 - precision > 0: Activate bin integration everywhere. Use precision between 0.01 and 1.E-6, depending on binning.
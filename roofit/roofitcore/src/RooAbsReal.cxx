@@ -440,6 +440,24 @@ double RooAbsReal::analyticalIntegral(Int_t code, const char* /*rangeName*/) con
 
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return the code that computes the analytical integral with the given code
+/// and range, for the code generation with the RooFit::Detail::CodeSquashContext.
+/// Classes that implement analyticalIntegral() and support code generation
+/// override this function, the default implementation throws a
+/// `std::runtime_error`.
+
+std::string RooAbsReal::buildCallToAnalyticIntegral(Int_t /*code*/, const char * /*rangeName*/,
+                                                    RooFit::Detail::CodeSquashContext & /*ctx*/) const
+{
+  std::stringstream errorMsg;
+  errorMsg << "An analytical integral function for class \"" << ClassName() << "\" has not yet been implemented.";
+  coutE(Minimization) << errorMsg.str() << std::endl;
+  throw std::runtime_error(errorMsg.str());
+}
+
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Get the label associated with the variable
 
@@ -4945,3 +4963,19 @@ void RooAbsReal::checkBatchComputation(const RooBatchCompute::RunContext& evalDa
     throw CachingError(formatter);
   }
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compute the analytical gradient of this function with respect to its
+/// parameters, i.e. all the variables returned by getParameters(nullptr)
+/// sorted by name, evaluated at their current values. The output array must
+/// have one element per parameter. Only available if hasGradient() returns
+/// true, the default implementation throws a `std::runtime_error`.
+
+void RooAbsReal::gradient(double * /*out*/) const
+{
+  std::stringstream errorMsg;
+  errorMsg << "The class \"" << ClassName() << "\" of " << GetName() << " can't compute analytical gradients.";
+  coutE(Minimization) << errorMsg.str() << std::endl;
+  throw std::runtime_error(errorMsg.str());
+}
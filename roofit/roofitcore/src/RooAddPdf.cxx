@@ -67,6 +67,7 @@ An (enforced) condition for this assumption is that each \f$ \mathrm{PDF}_i \f$
 
 #include "RooAddGenContext.h"
 #include "RooBatchCompute.h"
+#include "RooFit/Detail/CodeSquashContext.h"
 #include "RooDataSet.h"
 #include "RooGlobalFunc.h"
 #include "RooNaNPacker.h"
@@ -806,6 +807,37 @@ void RooAddPdf::computeBatch(cudaStream_t* stream, double* output, size_t nEvent
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Translate the weighted sum of the component pdfs into code for the
+/// RooFuncWrapper. Only plain, non-recursive fractions and coefficients
+/// without projections or supplemental normalization are supported.
+
+void RooAddPdf::translate(RooFit::Detail::CodeSquashContext &ctx) const
+{
+  if (_coefList.empty() || _recursive || _projectCoefs || getNormAndCache(nullptr).second->_needSupNorm) {
+    std::stringstream errMsg;
+    errMsg << "RooAddPdf::translate(" << GetName() << ") only supports non-recursive coefficients"
+           << " without projection or supplemental normalization";
+    coutE(Minimization) << errMsg.str() << std::endl;
+    throw std::runtime_error(errMsg.str());
+  }
+
+  std::string sum;
+  std::string coefSum;
+  for (std::size_t i = 0; i < _coefList.size(); ++i) {
+    std::string const &coef = ctx.getResult(_coefList[i]);
+    sum += (i == 0 ? "" : " + ") + coef + " * " + ctx.getResult(_pdfList[i]);
+    coefSum += (i == 0 ? "" : " + ") + coef;
+  }
+
+  if (_haveLastCoef) {
+    ctx.addResult(this, "(" + sum + ") / (" + coefSum + ")");
+  } else {
+    ctx.addResult(this, sum + " + (1.0 - (" + coefSum + ")) * " + ctx.getResult(_pdfList[_pdfList.size() - 1]));
+  }
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Reset error counter to given value, limiting the number
 /// of future error messages for this pdf to 'resetValue'
@@ -39,6 +39,7 @@ in the two sets.
 #include "RooChi2Var.h"
 #include "RooMsgService.h"
 #include "RooBatchCompute.h"
+#include "RooFit/Detail/CodeSquashContext.h"
 
 #include <algorithm>
 #include <cmath>
@@ -175,6 +176,20 @@ void RooAddition::computeBatch(cudaStream_t* stream, double* output, size_t nEve
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Translate the sum of the terms into code for the RooFuncWrapper.
+
+void RooAddition::translate(RooFit::Detail::CodeSquashContext &ctx) const
+{
+  std::string result;
+  for (RooAbsArg *arg : _set) {
+    if (!result.empty()) result += " + ";
+    result += ctx.getResult(*arg);
+  }
+  ctx.addResult(this, result.empty() ? "0.0" : "(" + result + ")");
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Return the default error level for MINUIT error analysis
 /// If the addition contains one or more RooNLLVars and
@@ -28,6 +28,7 @@
 
 #include "RooDataHist.h"
 #include "RunContext.h"
+#include "RooFit/Detail/CodeSquashContext.h"
 
 bool RooBinWidthFunction::_enabled = true;
 
@@ -84,3 +85,21 @@ void RooBinWidthFunction::computeBatch(cudaStream_t*, double* output, size_t, Ro
     }
   }
 }
+
+
+/// Translate the lookup of the bin volumes into code for the RooFuncWrapper.
+void RooBinWidthFunction::translate(RooFit::Detail::CodeSquashContext &ctx) const {
+  if(!_enabled) {
+    ctx.addResult(this, "1.0");
+    return;
+  }
+  const RooHistFunc& histFunc = *_histFunc;
+  const RooDataHist& dataHist = histFunc.dataHist();
+  auto volumes = dataHist.binVolumes(0, dataHist.numEntries());
+  std::vector<double> values(volumes.begin(), volumes.end());
+  if (_divideByBinWidth) {
+    for (double& val : values) val = 1. / val;
+  }
+  std::string const& idx = dataHist.calculateTreeIndexForCodeSquash(this, ctx, histFunc.variables());
+  ctx.addResult(this, ctx.buildArg(values) + "[" + idx + "]");
+}
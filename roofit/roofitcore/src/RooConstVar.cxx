@@ -24,6 +24,7 @@ RooConstVar represent a constant real-valued object
 
 #include "RooConstVar.h"
 #include "RunContext.h"
+#include "RooFit/Detail/CodeSquashContext.h"
 
 using namespace std;
 
@@ -63,6 +64,14 @@ RooSpan<const double> RooConstVar::getValues(RooBatchCompute::RunContext& evalDa
   return evalData.spans[this];
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Translate the constant into its value.
+
+void RooConstVar::translate(RooFit::Detail::CodeSquashContext &ctx) const
+{
+  ctx.addResult(this, RooFit::Detail::CodeSquashContext::toString(_value));
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Write object contents to stream
 
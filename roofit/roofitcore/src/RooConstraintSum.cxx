@@ -38,6 +38,7 @@ arguments.
 #include "RooWorkspace.h"
 #include "RooAbsRealLValue.h"
 #include "RooAbsCategoryLValue.h"
+#include "RooFit/Detail/CodeSquashContext.h"
 
 #include <memory>
 
@@ -110,6 +111,20 @@ std::unique_ptr<RooArgSet> RooConstraintSum::fillNormSetForServer(RooArgSet cons
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Translate the sum of the negative logarithms of the constraint terms into
+/// code for the RooFuncWrapper.
+
+void RooConstraintSum::translate(RooFit::Detail::CodeSquashContext &ctx) const
+{
+   std::string result;
+   for (RooAbsArg *comp : _set1) {
+      result += "-std::log(" + ctx.getResult(*comp) + ")";
+   }
+   ctx.addResult(this, result.empty() ? "0.0" : result);
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Replace the variables in this RooConstraintSum with the global observables
 /// in the dataset if they match by name. This function will do nothing if this
@@ -64,6 +64,7 @@ See RooAbsData::plotOn().
 #include "RooFormula.h"
 #include "RooUniformBinning.h"
 #include "RooSpan.h"
+#include "RooFit/Detail/CodeSquashContext.h"
 
 #include "ROOT/StringUtils.hxx"
 
@@ -74,6 +75,9 @@ See RooAbsData::plotOn().
 #include "TMath.h"
 #include "Math/Util.h"
 
+#include <sstream>
+#include <stdexcept>
+
 using namespace std;
 
 ClassImp(RooDataHist);
@@ -1031,6 +1035,45 @@ Int_t RooDataHist::getIndex(const RooAbsCollection& coord, bool fast) const {
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Build the code that computes the bin index for the RooFuncWrapper, where
+/// the coordinates `coords` of the node `klass` have the same layout as the
+/// internal variables. Values outside of the binning are assigned to the
+/// first or last bin. Only real-valued coordinates are supported.
+
+std::string RooDataHist::calculateTreeIndexForCodeSquash(RooAbsArg const *klass, RooFit::Detail::CodeSquashContext &ctx,
+                                                         const RooAbsCollection &coords) const
+{
+  checkInit();
+  assert(coords.size() == _vars.size());
+
+  std::string code;
+  for (unsigned int i = 0; i < _vars.size(); ++i) {
+    const RooAbsBinning* binning = _lvbins[i].get();
+    if (!binning) {
+      std::stringstream errMsg;
+      errMsg << "RooDataHist::calculateTreeIndexForCodeSquash(" << klass->GetName()
+             << ") does not support category dimensions";
+      coutE(Minimization) << errMsg.str() << std::endl;
+      throw std::runtime_error(errMsg.str());
+    }
+
+    std::string binNumber;
+    if (binning->isUniform()) {
+      binNumber = ctx.buildCall("RooFit::Detail::EvaluateFuncs::getUniformBinning", binning->lowBound(),
+                                binning->highBound(), *coords[i], binning->numBins());
+    } else {
+      std::vector<double> edges(binning->array(), binning->array() + binning->numBoundaries());
+      binNumber = ctx.buildCall("RooFit::Detail::EvaluateFuncs::getBinNumber", edges, binning->numBins(), *coords[i]);
+    }
+    if (!code.empty()) code += " + ";
+    code += std::to_string(_idxMult[i]) + " * " + binNumber;
+  }
+
+  return code.empty() ? "0" : code;
+}
+
+
 
 
 ////////////////////////////////////////////////////////////////////////////////
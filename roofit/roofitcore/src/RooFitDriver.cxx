@@ -24,6 +24,13 @@ computations take place in the RooBatchCompute library and can be carried off
 by either the CPU or a CUDA-supporting GPU. The RooFitDriver class takes care
 of data transfers. An instance of this class is created every time
 RooAbsPdf::fitTo() is called and gets destroyed when the fitting ends.
+
+On the CPU, when implicit multi-threading is enabled (ROOT::EnableImplicitMT()),
+the nodes that don't depend on each other are computed concurrently by the
+threads of the pool, provided that their computation is thread safe (see
+RooAbsArg::canComputeBatchConcurrently()). The RooBatchCompute kernels
+additionally split the events of each node between the threads, such that a
+single evaluation of the likelihood uses all the cores.
 **/
 
 #include <RooFitDriver.h>
@@ -42,6 +49,13 @@ RooAbsPdf::fitTo() is called and gets destroyed when the fitting ends.
 
 #include "NormalizationHelpers.h"
 
+#include <RConfigure.h>
+#ifdef R__USE_IMT
+#include <ROOT/TThreadExecutor.hxx>
+#include <TROOT.h>
+#endif
+
+#include <algorithm>
 #include <iomanip>
 #include <numeric>
 #include <thread>
@@ -81,6 +95,7 @@ struct NodeInfo {
    bool isVariable = false;
    bool isDirty = true;
    bool isCategory = false;
+   bool canComputeConcurrently = false;
    std::size_t outputSize = 1;
    std::size_t lastSetValCount = std::numeric_limits<std::size_t>::max();
    std::size_t originalDataToken = 0;
@@ -222,6 +237,8 @@ void RooFitDriver::setData(DataSpansMap const &dataSpans)
       if (!info.isScalar) {
          setOperMode(info.absArg, RooAbsArg::ADirty);
       }
+
+      info.canComputeConcurrently = !info.isScalar && info.absArg->canComputeBatchConcurrently();
    }
 
    // Extra steps for initializing in cuda mode
@@ -310,6 +327,28 @@ void RooFitDriver::computeCPUNode(const RooAbsArg *node, NodeInfo &info)
    }
 }
 
+/// Check whether a node has to be recomputed because one of its servers
+/// changed, and if so flag its clients as dirty in turn. The nodes have to be
+/// checked in topological order.
+bool RooFitDriver::updateDirtyState(NodeInfo &info)
+{
+   if (info.fromDataset)
+      return false;
+   if (info.isVariable) {
+      auto *var = static_cast<RooRealVar const *>(info.absArg);
+      if (info.lastSetValCount == var->valueResetCounter())
+         return false;
+      info.lastSetValCount = var->valueResetCounter();
+   } else if (!info.isDirty) {
+      return false;
+   }
+   for (NodeInfo *clientInfo : info.clientInfos) {
+      clientInfo->isDirty = true;
+   }
+   info.isDirty = false;
+   return true;
+}
+
 /// Returns the value of the top node in the computation graph
 double RooFitDriver::getVal()
 {
@@ -319,30 +358,66 @@ double RooFitDriver::getVal()
       return getValHeterogeneous();
    }
 
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled()) {
+      return getValConcurrent();
+   }
+#endif
+
    for (auto &nodeInfo : _nodes) {
-      RooAbsArg *node = nodeInfo.absArg;
-      if (!nodeInfo.fromDataset) {
-         if (nodeInfo.isVariable) {
-            auto *var = static_cast<RooRealVar const *>(node);
-            if (nodeInfo.lastSetValCount != var->valueResetCounter()) {
-               nodeInfo.lastSetValCount = var->valueResetCounter();
-               for (NodeInfo *clientInfo : nodeInfo.clientInfos) {
-                  clientInfo->isDirty = true;
-               }
-               computeCPUNode(node, nodeInfo);
-               nodeInfo.isDirty = false;
-            }
+      if (updateDirtyState(nodeInfo)) {
+         computeCPUNode(nodeInfo.absArg, nodeInfo);
+      }
+   }
+
+   // return the final value
+   return _dataMapCPU.at(&topNode())[0];
+}
+
+/// Returns the value of the top node in the computation graph, computing the
+/// independent nodes concurrently on the implicit multi-threading pool.
+double RooFitDriver::getValConcurrent()
+{
+#ifdef R__USE_IMT
+   // Group the nodes to recompute in waves: a node only depends on nodes of
+   // the previous waves, so the nodes of a wave can be computed concurrently.
+   std::vector<int> nodeWaves(_nodes.size(), -1);
+   std::vector<std::vector<NodeInfo *>> waves;
+   for (std::size_t iNode = 0; iNode < _nodes.size(); ++iNode) {
+      NodeInfo &info = _nodes[iNode];
+      if (!updateDirtyState(info))
+         continue;
+      int wave = 0;
+      for (NodeInfo *serverInfo : info.serverInfos) {
+         wave = std::max(wave, nodeWaves[serverInfo - _nodes.data()] + 1);
+      }
+      nodeWaves[iNode] = wave;
+      if (waves.size() <= static_cast<std::size_t>(wave))
+         waves.resize(wave + 1);
+      waves[wave].push_back(&info);
+   }
+
+   ROOT::TThreadExecutor pool;
+   std::vector<NodeInfo *> concurrentNodes;
+   for (auto const &wave : waves) {
+      concurrentNodes.clear();
+      for (NodeInfo *info : wave) {
+         if (info->canComputeConcurrently) {
+            // the buffer manager is not thread safe
+            if (!info->buffer)
+               info->buffer = _bufferManager.makeCpuBuffer(info->outputSize);
+            concurrentNodes.push_back(info);
          } else {
-            if (nodeInfo.isDirty) {
-               for (NodeInfo *clientInfo : nodeInfo.clientInfos) {
-                  clientInfo->isDirty = true;
-               }
-               computeCPUNode(node, nodeInfo);
-               nodeInfo.isDirty = false;
-            }
+            computeCPUNode(info->absArg, *info);
          }
       }
+      if (concurrentNodes.size() > 1) {
+         pool.Foreach([this](NodeInfo *info) { computeCPUNode(info->absArg, *info); }, concurrentNodes);
+      } else if (concurrentNodes.size() == 1) {
+         computeCPUNode(concurrentNodes[0]->absArg, *concurrentNodes[0]);
+      }
    }
+#endif
 
    // return the final value
    return _dataMapCPU.at(&topNode())[0];
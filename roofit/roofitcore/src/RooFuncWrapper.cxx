@@ -0,0 +1,204 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2023, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+/**
+\file RooFuncWrapper.cxx
+\class RooFit::Experimental::RooFuncWrapper
+\ingroup Roofitcore
+
+The RooFuncWrapper translates a computation graph, typically a likelihood,
+into the code of a single C++ function with the RooFit::Detail::CodeSquashContext,
+and compiles it with the interpreter. If the function can be differentiated
+by Clad, the generated gradient is provided with RooAbsReal::gradient(), which
+is used by the RooMinimizer instead of numeric derivatives.
+
+The wrapper is created by RooAbsPdf::fitTo() or RooAbsPdf::createNLL() with
+the `BatchMode("codegen")` command argument. Only the classes that implement
+RooAbsArg::translate() are supported.
+**/
+
+#include <RooFuncWrapper.h>
+
+#include <RooAbsData.h>
+#include <RooMsgService.h>
+#include <RooSimultaneous.h>
+#include <RooFit/BatchModeDataHelpers.h>
+#include <RooFit/Detail/CodeSquashContext.h>
+
+#include "NormalizationHelpers.h"
+
+#include <TInterpreter.h>
+
+#include <algorithm>
+#include <sstream>
+#include <stack>
+#include <stdexcept>
+
+namespace {
+
+// Declare the headers needed by the generated code and its gradient once.
+void declareRuntimeHeaders()
+{
+   static bool declared = false;
+   if (!declared) {
+      declared = true;
+      gInterpreter->Declare("#include <RooFit/Detail/EvaluateFuncs.h>");
+      gInterpreter->Declare("#include <Math/CladDerivator.h>\n#pragma clad OFF");
+   }
+}
+
+} // namespace
+
+namespace RooFit {
+
+namespace Experimental {
+
+////////////////////////////////////////////////////////////////////////////////
+/// Generate the code of the function `obj`, normalized over `normSet`, and
+/// compile it together with its gradient.
+/// \param[in] name Name of the wrapper.
+/// \param[in] title Title of the wrapper.
+/// \param[in] obj The function to translate, typically a likelihood.
+/// \param[in] normSet The normalization set of the pdfs in `obj`.
+/// \param[in] data Optional dataset, whose values are copied into the
+///            observables array of the generated function.
+/// \param[in] simPdf Optional simultaneous pdf, whose index category is used
+///            to split the dataset for the prefixed observables of each channel.
+
+RooFuncWrapper::RooFuncWrapper(const char *name, const char *title, RooAbsReal const &obj, RooArgSet const &normSet,
+                               const RooAbsData *data, RooSimultaneous const *simPdf)
+   : RooAbsReal{name, title}, _params{"!params", "List of parameters", this}, _defaultErrorLevel{obj.defaultErrorLevel()}
+{
+   // Collect the parameters, sorted by name, which is also the order of the
+   // gradient we provide.
+   RooArgSet paramSet;
+   obj.getParameters(&normSet, paramSet);
+   RooArgList paramList{paramSet};
+   paramList.sort();
+   for (RooAbsArg *param : paramList) {
+      if (!dynamic_cast<RooAbsReal const *>(param)) {
+         std::stringstream errMsg;
+         errMsg << "RooFuncWrapper(" << GetName() << "): the parameter " << param->GetName()
+                << " is not real-valued, which is not supported";
+         coutE(Minimization) << errMsg.str() << std::endl;
+         throw std::runtime_error(errMsg.str());
+      }
+   }
+   _params.add(paramList);
+   _gradientVarBuffer.resize(_params.size());
+
+   RooFit::Detail::CodeSquashContext ctx;
+   for (std::size_t i = 0; i < _params.size(); ++i) {
+      ctx.addParam(_params[i], i);
+   }
+
+   // Replace the pdfs by the pdfs normalized over the normalization set for
+   // the time of the code generation.
+   RooFit::NormalizationIntegralUnfolder unfolder{obj, normSet};
+   RooAbsArg &topNode = unfolder.arg();
+
+   if (data) {
+      std::stack<std::vector<double>> buffers;
+      auto spans = RooFit::BatchModeDataHelpers::getDataSpans(*data, "", simPdf ? &simPdf->indexCat() : nullptr,
+                                                              buffers);
+      RooArgSet nodes;
+      topNode.treeNodeServerList(&nodes);
+      for (RooAbsArg *node : nodes) {
+         auto found = spans.find(node);
+         if (found == spans.end())
+            continue;
+         RooSpan<const double> const &span = found->second;
+         ctx.addObs(*node, _observables.size(), span.size());
+         _observables.insert(_observables.end(), span.begin(), span.end());
+      }
+   }
+
+   _funcBody = ctx.assembleCode(ctx.getResult(topNode));
+
+   static int funcIdx = 0;
+   _funcName = "roo_func_wrapper_" + std::to_string(funcIdx++);
+
+   declareRuntimeHeaders();
+
+   std::string funcCode = "double " + _funcName + "(double *params, double const *obs) {\n" + _funcBody + "}";
+   if (!gInterpreter->Declare(funcCode.c_str())) {
+      std::stringstream errMsg;
+      errMsg << "RooFuncWrapper(" << GetName() << "): the generated code could not be compiled";
+      coutE(Minimization) << errMsg.str() << std::endl;
+      throw std::runtime_error(errMsg.str());
+   }
+   _func = reinterpret_cast<Func>(gInterpreter->ProcessLine((_funcName + ";").c_str()));
+
+   // Request the gradient with respect to the parameters from Clad, in the
+   // same way as TFormula does. If the differentiation fails, the minimizer
+   // falls back to numeric derivatives.
+   std::string requestCode = "#pragma cling optimize(2)\n"
+                             "#pragma clad ON\n"
+                             "void " + _funcName + "_req() {\n"
+                             "  clad::gradient(" + _funcName + ", \"params\");\n"
+                             "}\n"
+                             "#pragma clad OFF";
+   std::string wrapperName = _funcName + "_derivativeWrapper";
+   std::string wrapperCode = "void " + wrapperName + "(double *params, double const *obs, double *out) {\n"
+                             "  clad::array_ref<double> cladOut(out, " + std::to_string(_params.size()) + ");\n"
+                             "  " + _funcName + "_grad_0(params, obs, cladOut);\n"
+                             "}";
+   if (gInterpreter->Declare(requestCode.c_str()) && gInterpreter->Declare(wrapperCode.c_str())) {
+      _grad = reinterpret_cast<Grad>(gInterpreter->ProcessLine((wrapperName + ";").c_str()));
+   } else {
+      coutW(Minimization) << "RooFuncWrapper(" << GetName()
+                          << "): the gradient could not be generated with Clad, falling back to numeric derivatives"
+                          << std::endl;
+   }
+}
+
+RooFuncWrapper::RooFuncWrapper(const RooFuncWrapper &other, const char *name)
+   : RooAbsReal(other, name),
+     _params("!params", this, other._params),
+     _funcName(other._funcName),
+     _funcBody(other._funcBody),
+     _func(other._func),
+     _grad(other._grad),
+     _gradientVarBuffer(other._gradientVarBuffer),
+     _observables(other._observables),
+     _defaultErrorLevel(other._defaultErrorLevel)
+{
+}
+
+void RooFuncWrapper::updateGradientVarBuffer() const
+{
+   std::transform(_params.begin(), _params.end(), _gradientVarBuffer.begin(),
+                  [](RooAbsArg *obj) { return static_cast<RooAbsReal *>(obj)->getVal(); });
+}
+
+double RooFuncWrapper::evaluate() const
+{
+   updateGradientVarBuffer();
+   return _func(_gradientVarBuffer.data(), _observables.data());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill `out` with the derivatives of the function with respect to the
+/// parameters, in the order of the parameters sorted by name.
+
+void RooFuncWrapper::gradient(double *out) const
+{
+   if (!_grad) {
+      RooAbsReal::gradient(out);
+      return;
+   }
+   updateGradientVarBuffer();
+   std::fill(out, out + _params.size(), 0.0);
+   _grad(_gradientVarBuffer.data(), _observables.data(), out);
+}
+
+} // namespace Experimental
+
+} // namespace RooFit
@@ -183,9 +183,10 @@ namespace RooFit {
       else if(lower == "cpu") mode = BatchModeOption::Cpu;
       else if(lower == "cuda") mode = BatchModeOption::Cuda;
       else if(lower == "old") mode = BatchModeOption::Old;
+      else if(lower == "codegen") mode = BatchModeOption::CodeGen;
       // Note that the "old" argument is undocumented, because accessing the
       // old batch mode is an advanced developer feature.
-      else throw std::runtime_error("Only supported string values for BatchMode() are \"off\", \"cpu\", or \"cuda\".");
+      else throw std::runtime_error("Only supported string values for BatchMode() are \"off\", \"cpu\", \"cuda\", or \"codegen\".");
       return RooCmdArg("BatchMode", static_cast<int>(mode));
   }
   /// Integrate the PDF over bins. Improves accuracy for binned fits. Switch off using `0.` as argument. \see RooAbsPdf::fitTo().
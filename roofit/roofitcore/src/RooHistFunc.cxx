@@ -32,10 +32,12 @@ discrete dimensions and may have negative values.
 #include "RooWorkspace.h"
 #include "RooHistPdf.h"
 #include "RooHelpers.h"
+#include "RooFit/Detail/CodeSquashContext.h"
 
 #include "TError.h"
 #include "TBuffer.h"
 
+#include <sstream>
 #include <stdexcept>
 
 using namespace std;
@@ -233,6 +235,26 @@ void RooHistFunc::computeBatch(cudaStream_t*, double* output, size_t size, RooFi
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Translate the histogram lookup into code for the RooFuncWrapper. Only
+/// histograms without interpolation are supported, and values outside of the
+/// histogram range are assigned to the first or last bin.
+
+void RooHistFunc::translate(RooFit::Detail::CodeSquashContext &ctx) const
+{
+  if (_intOrder != 0) {
+    std::stringstream errMsg;
+    errMsg << "RooHistFunc::translate(" << GetName() << ") does not support interpolation";
+    coutE(Minimization) << errMsg.str() << std::endl;
+    throw std::runtime_error(errMsg.str());
+  }
+
+  std::string const &idx = _dataHist->calculateTreeIndexForCodeSquash(this, ctx, _depList);
+  std::vector<double> weights(_dataHist->weightArray(), _dataHist->weightArray() + _dataHist->numEntries());
+  ctx.addResult(this, ctx.buildArg(weights) + "[" + idx + "]");
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Only handle case of maximum in all variables
 
@@ -35,6 +35,7 @@ numerical integration algorithm.
 #include "RooNumIntConfig.h"
 #include "RooNumIntFactory.h"
 #include "RooMsgService.h"
+#include "RooRealBinding.h"
 
 #include <assert.h>
 
@@ -398,7 +399,26 @@ double RooIntegrator1D::addTrapezoids(Int_t n)
     const double xmin = _xmin;
 
     double sum = 0.;
-    // TODO Replace by batch computation
+
+    // Real bindings of one-dimensional functions support batch evaluations,
+    // so all new points of this refinement step can be computed at once. As
+    // setting up the batch computation has some overhead, this is only done
+    // for large enough numbers of points.
+    auto realBinding = dynamic_cast<const RooRealBinding*>(integrand());
+    if (realBinding && _function->getDimension() == 1 && nInt >= _minBatchSize) {
+      _xBatch.resize(nInt);
+      for (int j=0; j<nInt; ++j) {
+        _xBatch[j] = xmin + (0.5+j)*del;
+      }
+      auto results = realBinding->getValues({RooSpan<const double>(_xBatch)});
+      if (results.size() == static_cast<std::size_t>(nInt)) {
+        for (double result : results) {
+          sum += result;
+        }
+        return (_savedResult= 0.5*(_savedResult + _range*sum/nInt));
+      }
+    }
+
     for (int j=0; j<nInt; ++j) {
       double x = xmin + (0.5+j)*del;
       sum += integrand(xvec(x));
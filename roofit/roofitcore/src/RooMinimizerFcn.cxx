@@ -40,6 +40,28 @@ using namespace std;
 
 namespace {
 
+// Wrapper of the RooMinimizerFcn that provides the analytical gradient of the
+// function to the minimizer.
+class RooMinimizerFcnGradient : public ROOT::Math::IMultiGradFunction {
+public:
+   RooMinimizerFcnGradient(RooMinimizerFcn const &fcn) : _fcn{fcn} {}
+
+   ROOT::Math::IMultiGradFunction *Clone() const override { return new RooMinimizerFcnGradient(_fcn); }
+   unsigned int NDim() const override { return _fcn.NDim(); }
+   void Gradient(const double *x, double *grad) const override { _fcn.evaluateGradient(x, grad); }
+
+private:
+   double DoEval(const double *x) const override { return _fcn(x); }
+   double DoDerivative(const double *x, unsigned int icoord) const override
+   {
+      std::vector<double> grad(NDim());
+      _fcn.evaluateGradient(x, grad.data());
+      return grad[icoord];
+   }
+
+   RooMinimizerFcn const &_fcn;
+};
+
 // Helper function that wraps RooAbsArg::getParameters and directly returns the
 // output RooArgSet. To be used in the initializer list of the RooMinimizerFcn
 // constructor.
@@ -55,13 +77,68 @@ RooArgSet getParameters(RooAbsReal const& funct) {
 RooMinimizerFcn::RooMinimizerFcn(RooAbsReal *funct, RooMinimizer* context,
             bool verbose) :
   RooAbsMinimizerFcn(getParameters(*funct), context, verbose), _funct(funct)
-{}
+{
+  initGradient();
+}
 
 
 
 RooMinimizerFcn::RooMinimizerFcn(const RooMinimizerFcn& other) : RooAbsMinimizerFcn(other), ROOT::Math::IBaseFunctionMultiDim(other),
   _funct(other._funct)
-{}
+{
+  initGradient();
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// If the function provides its gradient, find where the floating parameters
+/// are in the gradient, which is ordered like the parameters of the function
+/// sorted by name, and create the interface with gradient for the minimizer.
+
+void RooMinimizerFcn::initGradient()
+{
+  if (!_funct->hasGradient()) return;
+
+  RooArgList allParams{getParameters(*_funct)};
+  allParams.sort();
+  _gradientOutput.resize(allParams.size());
+  _gradIndices.clear();
+  for (RooAbsArg *param : *_floatParamList) {
+    _gradIndices.push_back(allParams.index(param->GetName()));
+  }
+  _gradFcn = std::make_unique<RooMinimizerFcnGradient>(*this);
+}
+
+
+bool RooMinimizerFcn::fit(ROOT::Fit::Fitter& fitter) const
+{
+  return _gradFcn ? fitter.FitFCN(*_gradFcn) : fitter.FitFCN(*this);
+}
+
+
+ROOT::Math::IMultiGenFunction* RooMinimizerFcn::getMultiGenFcn()
+{
+  if (_gradFcn) return _gradFcn.get();
+  return this;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the gradient of the function with respect to the floating
+/// parameters at the parameter values `x`.
+
+void RooMinimizerFcn::evaluateGradient(const double *x, double *out) const
+{
+  for (unsigned index = 0; index < _nDim; index++) {
+    SetPdfParamVal(index, x[index]);
+  }
+
+  _funct->gradient(_gradientOutput.data());
+
+  for (unsigned index = 0; index < _nDim; index++) {
+    out[index] = _gradientOutput[_gradIndices[index]];
+  }
+}
 
 
 RooMinimizerFcn::~RooMinimizerFcn()
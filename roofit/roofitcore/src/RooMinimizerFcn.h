@@ -23,6 +23,7 @@
 #include "RooArgList.h"
 
 #include <fstream>
+#include <memory>
 #include <vector>
 
 #include "RooAbsMinimizerFcn.h"
@@ -49,13 +50,19 @@ public:
    void setOptimizeConstOnFunction(RooAbsArg::ConstOpCode opcode, bool doAlsoTrackingOpt) override;
 
    void setOffsetting(bool flag) override;
-   bool fit(ROOT::Fit::Fitter& fitter) const override { return fitter.FitFCN(*this); };
-   ROOT::Math::IMultiGenFunction* getMultiGenFcn() override { return this; };
+   bool fit(ROOT::Fit::Fitter& fitter) const override;
+   ROOT::Math::IMultiGenFunction* getMultiGenFcn() override;
+
+   void evaluateGradient(const double *x, double *out) const;
 
 private:
    double DoEval(const double *x) const override;
+   void initGradient();
 
    RooAbsReal *_funct;
+   std::unique_ptr<ROOT::Math::IMultiGradFunction> _gradFcn; ///< Interface with gradient, if the function provides one
+   std::vector<std::size_t> _gradIndices;        ///< Index of each floating parameter in the gradient of the function
+   mutable std::vector<double> _gradientOutput;  ///< Buffer for the gradient of the function
 };
 
 #endif
@@ -25,12 +25,17 @@ functions from `RooBatchCompute` library to provide faster computation times.
 #include <RooNLLVarNew.h>
 
 #include <RooAddition.h>
+#include <RooAddPdf.h>
 #include <RooFormulaVar.h>
+#include <RooMsgService.h>
 #include <RooNaNPacker.h>
 #include <RooRealSumPdf.h>
 #include <RooProdPdf.h>
 #include <RooRealVar.h>
 #include <RooFit/Detail/Buffers.h>
+#include <RooFit/Detail/CodeSquashContext.h>
+
+#include "RooNormalizedPdf.h"
 
 #include <ROOT/StringUtils.hxx>
 
@@ -40,6 +45,7 @@ functions from `RooBatchCompute` library to provide faster computation times.
 #include <TMath.h>
 
 #include <numeric>
+#include <sstream>
 #include <stdexcept>
 #include <vector>
 
@@ -58,6 +64,29 @@ createFractionInRange(RooAbsPdf const &pdf, RooArgSet const &observables, std::s
       pdf.createIntegral(observables, &observables, pdf.getIntegratorConfig(), rangeNames.c_str())};
 }
 
+/// Build the code of the expected number of events of an extended pdf for
+/// the RooFuncWrapper, which is the sum of the coefficients of a RooAddPdf.
+std::string buildExpectedEventsCode(RooAbsPdf const &pdf, RooFit::Detail::CodeSquashContext &ctx)
+{
+   RooAbsPdf const *extPdf = &pdf;
+   if (auto normPdf = dynamic_cast<RooNormalizedPdf const *>(extPdf)) {
+      extPdf = &normPdf->pdf();
+   }
+   auto addPdf = dynamic_cast<RooAddPdf const *>(extPdf);
+   if (!addPdf || addPdf->coefList().size() != addPdf->pdfList().size()) {
+      throw std::runtime_error(std::string("RooNLLVarNew::translate(): the expected number of events of ") +
+                               pdf.GetName() +
+                               " can only be translated for a RooAddPdf with one coefficient per component");
+   }
+   std::string expected;
+   for (RooAbsArg *coef : addPdf->coefList()) {
+      if (!expected.empty())
+         expected += " + ";
+      expected += ctx.getResult(*coef);
+   }
+   return "(" + expected + ")";
+}
+
 template <class Input>
 double kahanSum(Input const &input)
 {
@@ -306,6 +335,63 @@ double RooNLLVarNew::evaluate() const
    return _value;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Translate the likelihood into code for the RooFuncWrapper, with one loop
+/// over the events of the dataset. The offsetting and the correction for
+/// fits in sub-ranges are not supported.
+
+void RooNLLVarNew::translate(RooFit::Detail::CodeSquashContext &ctx) const
+{
+   if (_fractionInRange) {
+      std::stringstream errMsg;
+      errMsg << "RooNLLVarNew::translate(" << GetName() << ") does not support fits in sub-ranges";
+      coutE(Minimization) << errMsg.str() << std::endl;
+      throw std::runtime_error(errMsg.str());
+   }
+
+   std::string resName = ctx.getTmpVarName();
+   std::string sumWName = ctx.getTmpVarName();
+   std::string sumW2Name = ctx.getTmpVarName();
+   ctx.addToCodeBody("double " + resName + " = 0.0;\n", true);
+   ctx.addToCodeBody("double " + sumWName + " = 0.0;\n", true);
+   ctx.addToCodeBody("double " + sumW2Name + " = 0.0;\n", true);
+
+   std::string binWidths;
+   if (_binnedL) {
+      binWidths = ctx.buildArg(_binw);
+   }
+
+   {
+      auto scope = ctx.beginLoop(this);
+      std::string weight = ctx.getResult(_weightSquared ? _weightSquaredVar : _weightVar);
+      std::string const &pdf = ctx.getResult(_pdf);
+
+      if (_binnedL) {
+         std::string const mu = pdf + " * " + binWidths + "[" + ctx.loopIndex() + "]";
+         ctx.addToCodeBody(resName + " += " +
+                           ctx.buildCall("RooFit::Detail::EvaluateFuncs::binnedNllTerm", weight, mu) + ";\n");
+      } else {
+         ctx.addToCodeBody(resName + " += " + ctx.buildCall("RooFit::Detail::EvaluateFuncs::nllTerm", weight, pdf) +
+                           ";\n");
+         ctx.addToCodeBody(sumWName + " += " + ctx.getResult(_weightVar) + ";\n");
+         if (_weightSquared) {
+            ctx.addToCodeBody(sumW2Name + " += " + ctx.getResult(_weightSquaredVar) + ";\n");
+         }
+      }
+   }
+
+   if (_isExtended && !_binnedL) {
+      std::string const expected = buildExpectedEventsCode(*_pdf, ctx);
+      ctx.addToCodeBody(resName + " += " +
+                           ctx.buildCall("RooFit::Detail::EvaluateFuncs::extendedNllTerm", sumWName, expected,
+                                         _weightSquared ? sumW2Name : std::string("0.0")) +
+                           ";\n",
+                        true);
+   }
+
+   ctx.addResult(this, resName);
+}
+
 void RooNLLVarNew::getParametersHook(const RooArgSet * /*nset*/, RooArgSet *params, bool /*stripDisconnected*/) const
 {
    // strip away the observables and weights
@@ -11,6 +11,7 @@
  */
 
 #include "RooNormalizedPdf.h"
+#include "RooFit/Detail/CodeSquashContext.h"
 
 /**
  * \class RooNormalizedPdf
@@ -36,3 +37,13 @@ void RooNormalizedPdf::computeBatch(cudaStream_t * /*stream*/, double *output, s
       }
    }
 }
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Translate the ratio of the pdf and its normalization integral into code
+/// for the RooFuncWrapper.
+
+void RooNormalizedPdf::translate(RooFit::Detail::CodeSquashContext &ctx) const
+{
+   ctx.addResult(this, ctx.getResult(_pdf) + " / " + ctx.getResult(_normIntegral));
+}
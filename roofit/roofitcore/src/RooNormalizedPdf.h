@@ -58,6 +58,11 @@ public:
       return static_cast<RooAbsPdf &>(*_pdf).expectedEvents(nset);
    }
 
+   /// The unnormalized pdf in the numerator.
+   RooAbsPdf const &pdf() const { return static_cast<RooAbsPdf const &>(*_pdf); }
+
+   void translate(RooFit::Detail::CodeSquashContext &ctx) const override;
+
 protected:
    void computeBatch(cudaStream_t *, double *output, size_t size, RooFit::Detail::DataMap const&) const override;
    double evaluate() const override
@@ -30,6 +30,7 @@ A RooProduct represents the product of a given set of RooAbsReal objects.
 #include "RooAbsCategory.h"
 #include "RooMsgService.h"
 #include "RooTrace.h"
+#include "RooFit/Detail/CodeSquashContext.h"
 
 #include <cmath>
 #include <memory>
@@ -402,6 +403,25 @@ void RooProduct::computeBatch(cudaStream_t* /*stream*/, double* output, size_t n
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Translate the product of the terms into code for the RooFuncWrapper. The
+/// category terms enter with the index of their current state.
+
+void RooProduct::translate(RooFit::Detail::CodeSquashContext &ctx) const
+{
+  std::string result;
+  for (RooAbsArg *item : _compRSet) {
+    if (!result.empty()) result += " * ";
+    result += ctx.getResult(*item);
+  }
+  for (RooAbsArg *item : _compCSet) {
+    if (!result.empty()) result += " * ";
+    result += std::to_string(static_cast<RooAbsCategory *>(item)->getCurrentIndex());
+  }
+  ctx.addResult(this, result.empty() ? "1.0" : "(" + result + ")");
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Forward the plot sampling hint from the p.d.f. that defines the observable obs
 
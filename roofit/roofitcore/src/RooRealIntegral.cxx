@@ -46,11 +46,14 @@ integration is performed in the various implementations of the RooAbsIntegrator
 #include "RooDouble.h"
 #include "RooTrace.h"
 #include "RooHelpers.h"
+#include "RooFit/Detail/CodeSquashContext.h"
 
 #include "TClass.h"
 
 #include <iostream>
 #include <memory>
+#include <sstream>
+#include <stdexcept>
 
 using namespace std;
 
@@ -828,9 +831,17 @@ double RooRealIntegral::evaluate() const
         cacheVal = (RooDouble*) expensiveObjectCache().retrieveObject(GetName(),RooDouble::Class(),parameters())  ;
       }
 
+      // Check if the values the integral depends on did actually change since
+      // the last numeric integration. The integral can be dirty without that,
+      // e.g. if other parameters of the computation graph were modified.
+      std::vector<double> numIntKey;
+      const bool hasNumIntKey = !cacheVal && fillNumIntCacheKey(numIntKey);
+
       if (cacheVal) {
         retVal = *cacheVal ;
    // cout << "using cached value of integral" << GetName() << endl ;
+      } else if (hasNumIntKey && _hasNumIntCache && numIntKey == _numIntCacheKey) {
+        retVal = _numIntCacheVal ;
       } else {
 
 
@@ -861,6 +872,12 @@ double RooRealIntegral::evaluate() const
         _intList.assign(_saveInt) ;
         _sumList.assign(_saveSum) ;
 
+        if (hasNumIntKey) {
+          _numIntCacheKey = std::move(numIntKey) ;
+          _numIntCacheVal = retVal ;
+          _hasNumIntCache = true ;
+        }
+
         // Cache numeric integrals in >1d expensive object cache
         if ((_cacheNum && _intList.getSize()>0) || _intList.getSize()>=_cacheAllNDim) {
           RooDouble* val = new RooDouble(retVal) ;
@@ -924,6 +941,112 @@ double RooRealIntegral::evaluate() const
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill `key` with everything a numeric integration depends on: the values of
+/// the parameters, the integration limits of the observables and the
+/// component selection state of the integrand. If the key is the same as for
+/// the previous numeric integration, the previous result can be reused.
+/// \return `false` if the integral depends on servers that can't be
+/// represented as numbers in the key, in which case no caching is done.
+
+bool RooRealIntegral::fillNumIntCacheKey(std::vector<double>& key) const
+{
+  const char* rangeName = RooNameReg::str(_rangeName) ;
+
+  for (const auto server : _serverList) {
+    if (server == &_function.arg()) continue ;
+
+    // Integrated observables only enter with their integration limits
+    const bool isIntegrated = _intList.find(*server) || _anaList.find(*server) || _sumList.find(*server)
+                              || _facList.find(*server) ;
+    if (isIntegrated) {
+      if (auto lvalue = dynamic_cast<RooAbsRealLValue*>(server)) {
+        key.push_back(lvalue->getMin(rangeName)) ;
+        key.push_back(lvalue->getMax(rangeName)) ;
+      }
+      continue ;
+    }
+
+    if (auto real = dynamic_cast<RooAbsReal*>(server)) {
+      key.push_back(real->getVal()) ;
+    } else if (auto cat = dynamic_cast<RooAbsCategory*>(server)) {
+      key.push_back(cat->getCurrentIndex()) ;
+    } else {
+      return false ;
+    }
+  }
+
+  if (!_funcNormSet && _globalSelectComp) {
+    return true ;
+  }
+
+  RooArgSet nodes ;
+  _function.arg().treeNodeServerList(&nodes) ;
+
+  // The normalization of the integrand depends on the ranges of the
+  // normalization observables
+  if (_funcNormSet) {
+    for (const auto arg : *_funcNormSet) {
+      if (auto lvalue = dynamic_cast<RooAbsRealLValue*>(nodes.find(*arg))) {
+        key.push_back(lvalue->getMin()) ;
+        key.push_back(lvalue->getMax()) ;
+      }
+    }
+  }
+
+  // If not all components are selected globally, the selection state of the
+  // components changes the integrand too
+  if (!_globalSelectComp) {
+    for (const auto node : nodes) {
+      if (auto real = dynamic_cast<RooAbsReal*>(node)) {
+        key.push_back(real->isSelectedComp()) ;
+      }
+    }
+  }
+
+  return true ;
+}
+
+
+////////////////////////////////////////////////////////////////////////////////
+/// Translate the integral into code for the RooFuncWrapper. Only integrals
+/// that are fully analytical without Jacobian terms are supported, in which
+/// case the code is built by RooAbsReal::buildCallToAnalyticIntegral() of the
+/// integrand.
+
+void RooRealIntegral::translate(RooFit::Detail::CodeSquashContext &ctx) const
+{
+  std::string result;
+  if (_intOperMode == PassThrough) {
+    result = ctx.getResult(_function);
+  } else if (_intOperMode == Analytic && _jacList.empty() && (!_funcNormSet || _funcNormSet->empty())) {
+    result = static_cast<RooAbsReal const &>(_function.arg())
+                .buildCallToAnalyticIntegral(_mode, RooNameReg::str(_rangeName), ctx);
+  } else {
+    std::stringstream errMsg;
+    errMsg << "RooRealIntegral::translate(" << GetName()
+           << ") only supports analytical integrals without Jacobian terms and normalization set";
+    coutE(Minimization) << errMsg.str() << endl;
+    throw std::runtime_error(errMsg.str());
+  }
+
+  // Multiply with the integration ranges of the factorized variables
+  double factor = 1.0;
+  for (const auto arg : _facList) {
+    if (auto argLV = dynamic_cast<RooAbsRealLValue const *>(arg)) {
+      factor *= (argLV->getMax() - argLV->getMin());
+    } else if (auto catLV = dynamic_cast<RooAbsCategoryLValue const *>(arg)) {
+      factor *= catLV->numTypes();
+    }
+  }
+  if (factor != 1.0) {
+    result = RooFit::Detail::CodeSquashContext::toString(factor) + " * " + result;
+  }
+
+  ctx.addResult(this, result);
+}
+
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Return product of jacobian terms originating from analytical integration
@@ -996,6 +1119,7 @@ bool RooRealIntegral::redirectServersHook(const RooAbsCollection& /*newServerLis
                    bool /*mustReplaceAll*/, bool /*nameChange*/, bool /*isRecursive*/)
 {
   _restartNumIntEngine = true ;
+  _hasNumIntCache = false ;
 
   autoSelectDirtyMode() ;
 
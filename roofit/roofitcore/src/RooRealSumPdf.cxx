@@ -51,6 +51,7 @@ to the fractions of the various functions. **This requires setting the last argu
 #include "RooRealVar.h"
 #include "RooMsgService.h"
 #include "RooNaNPacker.h"
+#include "RooFit/Detail/CodeSquashContext.h"
 #include "RunContext.h"
 
 #include <TError.h>
@@ -321,6 +322,34 @@ void RooRealSumPdf::computeBatch(cudaStream_t* /*stream*/, double* output, size_
 }
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Translate the weighted sum of the functions into code for the
+/// RooFuncWrapper. If there is one coefficient less than functions, the last
+/// coefficient is one minus the sum of the others.
+
+void RooRealSumPdf::translate(RooFit::Detail::CodeSquashContext &ctx) const
+{
+  std::string sum;
+  std::string coefSum;
+  for (std::size_t i = 0; i < _funcList.size(); ++i) {
+    std::string const &func = ctx.getResult(_funcList[i]);
+    std::string coef;
+    if (i < _coefList.size()) {
+      coef = ctx.getResult(_coefList[i]);
+      coefSum += (i == 0 ? "" : " + ") + coef;
+    } else {
+      coef = "(1.0 - (" + coefSum + "))";
+    }
+    sum += (i == 0 ? "" : " + ") + coef + " * " + func;
+  }
+
+  if (_doFloor || _doFloorGlobal) {
+    sum = "std::max(0., " + sum + ")";
+  }
+  ctx.addResult(this, sum.empty() ? "0.0" : "(" + sum + ")");
+}
+
+
 bool RooRealSumPdf::checkObservables(RooAbsReal const& caller, RooArgSet const* nset,
                                      RooArgList const& funcList, RooArgList const& coefList)
 {
@@ -41,6 +41,7 @@ or integrals to sub ranges. The range without any name is used as default range.
 #include "RooUniformBinning.h"
 #include "RunContext.h"
 #include "RooSentinel.h"
+#include "RooFit/Detail/CodeSquashContext.h"
 
 #include "TTree.h"
 #include "TBuffer.h"
@@ -792,6 +793,16 @@ void RooRealVar::writeToStream(ostream& os, bool compact) const
 
 
 
+////////////////////////////////////////////////////////////////////////////////
+/// Translate a variable which is neither a parameter nor an observable of the
+/// generated code into its current value.
+
+void RooRealVar::translate(RooFit::Detail::CodeSquashContext &ctx) const
+{
+  ctx.addResult(this, RooFit::Detail::CodeSquashContext::toString(getVal()));
+}
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Print value of variable
 
@@ -1423,6 +1423,53 @@ void RooVectorDataStore::recomputeSumWeight() {
 }
 
 
+/// Append the values of the real-valued variables `vars` in bulk, where
+/// `columns[i]` holds the values of `vars[i]` for all new entries. This avoids
+/// the per-entry overhead of fill() when importing large datasets, e.g. from
+/// an RDataFrame or an RNTuple. If the store is still empty, the column
+/// buffers are adopted without copying.
+///
+/// Only unweighted stores with real-valued columns without errors are
+/// supported, and all columns of the store have to be filled. If this is not
+/// the case, or the columns don't have the same size, nothing is appended.
+/// \return `true` if the values were appended.
+bool RooVectorDataStore::appendColumns(RooAbsCollection const& vars, std::vector<std::vector<double>>&& columns)
+{
+  if (_wgtVar || _extWgtArray || _cache || !_realfStoreList.empty() || !_catStoreList.empty()
+      || vars.size() != columns.size() || vars.size() != _realStoreList.size()) {
+    return false;
+  }
+
+  const std::size_t nNew = columns.empty() ? 0 : columns.front().size();
+  std::vector<RealVector*> targets;
+  targets.reserve(vars.size());
+  for (std::size_t i = 0; i < vars.size(); ++i) {
+    auto found = std::find_if(_realStoreList.begin(), _realStoreList.end(), [&](RealVector const* real) {
+      return std::string{real->_nativeReal->GetName()} == vars[i]->GetName();
+    });
+    if (found == _realStoreList.end() || columns[i].size() != nNew
+        || std::find(targets.begin(), targets.end(), *found) != targets.end()) {
+      return false;
+    }
+    targets.push_back(*found);
+  }
+
+  const bool adopt = size() == 0;
+  for (std::size_t i = 0; i < targets.size(); ++i) {
+    std::vector<double>& vec = targets[i]->_vec;
+    if (adopt) {
+      vec = std::move(columns[i]);
+    } else {
+      vec.insert(vec.end(), columns[i].begin(), columns[i].end());
+    }
+  }
+
+  _sumWeight += nNew;
+
+  return true;
+}
+
+
 /// Exports all arrays in this RooVectorDataStore into a simple datastructure
 /// to be used by RooFit internal export functions.
 RooVectorDataStore::ArraysStruct  RooVectorDataStore::getArrays() const {
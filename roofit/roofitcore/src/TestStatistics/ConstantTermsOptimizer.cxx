@@ -18,6 +18,8 @@
 #include <RooArgSet.h>
 #include <RooAbsData.h>
 
+#include <memory>
+
 namespace RooFit {
 namespace TestStatistics {
 
@@ -162,5 +164,39 @@ void ConstantTermsOptimizer::optimizeCaching(RooAbsReal *function, RooArgSet *no
    dataset->optimizeReadingWithCaching(*function, RooArgSet(), requiredExtraObservables()) ;
 }
 
+/// Store a snapshot of the constant parameters of \p function, which are the parameters the cached constant terms
+/// depend on in addition to the observables of \p dataset. If they didn't change since the snapshot was taken, which
+/// can be checked with constantParametersChanged(), the cached values are still valid and can be reused by the next
+/// minimization on the same dataset, e.g. in likelihood scans or when creating a new RooMinimizer.
+void ConstantTermsOptimizer::snapshotConstantParameters(RooAbsReal const &function, RooAbsData const &dataset,
+                                                        RooArgSet &snapshot)
+{
+   RooArgSet params;
+   function.getParameters(dataset.get(), params);
+   std::unique_ptr<RooAbsCollection> constParams{params.selectByAttrib("Constant", true)};
+   snapshot.removeAll();
+   constParams->snapshot(snapshot, false);
+}
+
+/// Check if the set of constant parameters or their values changed with respect to the \p snapshot that was taken
+/// with snapshotConstantParameters().
+bool ConstantTermsOptimizer::constantParametersChanged(RooAbsReal const &function, RooAbsData const &dataset,
+                                                       RooArgSet const &snapshot)
+{
+   RooArgSet params;
+   function.getParameters(dataset.get(), params);
+   std::unique_ptr<RooAbsCollection> constParams{params.selectByAttrib("Constant", true)};
+   if (constParams->size() != snapshot.size()) {
+      return true;
+   }
+   for (const auto param : *constParams) {
+      RooAbsArg *snapshotParam = snapshot.find(*param);
+      if (!snapshotParam || !param->isIdentical(*snapshotParam, true)) {
+         return true;
+      }
+   }
+   return false;
+}
+
 } // namespace TestStatistics
 } // namespace RooFit
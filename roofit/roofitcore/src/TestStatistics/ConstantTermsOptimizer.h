@@ -28,6 +28,8 @@ struct ConstantTermsOptimizer {
    static void optimizeCaching(RooAbsReal *function, RooArgSet *norm_set, RooArgSet* observables, RooAbsData *dataset);
    static void disableConstantTermsOptimization(RooAbsReal *function, RooArgSet *norm_set, RooArgSet* observables, RooAbsData *dataset);
    static RooArgSet requiredExtraObservables();
+   static void snapshotConstantParameters(RooAbsReal const &function, RooAbsData const &dataset, RooArgSet &snapshot);
+   static bool constantParametersChanged(RooAbsReal const &function, RooAbsData const &dataset, RooArgSet const &snapshot);
 };
 
 }
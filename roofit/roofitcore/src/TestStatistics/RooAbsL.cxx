@@ -228,7 +228,15 @@ void RooAbsL::constOptimizeTestStatistic(RooAbsArg::ConstOpCode opcode, bool doA
 {
    // to be further implemented, this is just a first test implementation
    if (opcode == RooAbsArg::Activate) {
+      // If the constant terms were already cached by an earlier minimization, e.g. with another minimizer on this
+      // likelihood, and the constant parameters didn't change since then, the cache can be reused as it is.
+      if (constTermsOptimized_ &&
+          !ConstantTermsOptimizer::constantParametersChanged(*pdf_, *data_, constParamsSnapshot_)) {
+         return;
+      }
       ConstantTermsOptimizer::enableConstantTermsOptimization(pdf_.get(), normSet_.get(), data_.get(), doAlsoTrackingOpt);
+      ConstantTermsOptimizer::snapshotConstantParameters(*pdf_, *data_, constParamsSnapshot_);
+      constTermsOptimized_ = true;
    }
 }
 
@@ -74,6 +74,13 @@ RooBinnedL::RooBinnedL(RooAbsPdf *pdf, RooAbsData *data)
          ++biter;
       }
    }
+
+   // The observed counts never change, so neither does the log(N!) term of their Poisson probability
+   logNFactorial_.resize(N_events_);
+   for (std::size_t i = 0; i < N_events_; ++i) {
+      data_->get(i);
+      logNFactorial_[i] = TMath::LnGamma(data_->weight() + 1);
+   }
 }
 
 RooBinnedL::~RooBinnedL() = default;
@@ -93,8 +100,9 @@ RooBinnedL::evaluatePartition(Section bins, std::size_t /*components_begin*/, st
    // expensive than that, we tolerate the additional cost...
    ROOT::Math::KahanSum<double> result;
 
-   // Do not reevaluate likelihood if parameters nor event range have changed
-   if (!paramTracker_->hasChanged(true) && bins == lastSection_ && (cachedResult_ != 0)) return cachedResult_;
+   // Do not reevaluate likelihood if parameters nor event range have changed. In a
+   // simultaneous fit this skips the channels that do not depend on the changed parameters.
+   if (!paramTracker_->hasChanged(true) && bins == lastSection_ && haveCachedResult_) return cachedResult_;
 
 //   data->store()->recalculateCache(_projDeps, firstEvent, lastEvent, stepSize, (_binnedPdf?false:true));
    // TODO: check when we might need _projDeps (it seems to be mostly empty); ties in with TODO below
@@ -127,7 +135,7 @@ RooBinnedL::evaluatePartition(Section bins, std::size_t /*components_begin*/, st
 
       } else {
 
-         double term = -1 * (-mu + N * log(mu) - TMath::LnGamma(N + 1));
+         double term = -1 * (-mu + N * log(mu) - logNFactorial_[i]);
 
          sumWeight += eventWeight;
          result += term;
@@ -147,6 +155,7 @@ RooBinnedL::evaluatePartition(Section bins, std::size_t /*components_begin*/, st
    }
 
    cachedResult_ = result;
+   haveCachedResult_ = true;
    lastSection_ = bins;
    return result;
 }
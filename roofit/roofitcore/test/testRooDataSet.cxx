@@ -8,6 +8,7 @@
 #include <RooRealVar.h>
 #include <RooHelpers.h>
 #include <RooCategory.h>
+#include <RooVectorDataStore.h>
 #include <RooWorkspace.h>
 
 #include <TFile.h>
@@ -308,3 +309,44 @@ TEST(RooDataSet, ReduceWithCompositeDataStore)
    EXPECT_EQ(dataSetWeighted.weight(), dataSetComposite.weight());
    EXPECT_EQ(dataSetComposite.weight(), dataSetReduced.weight());
 }
+
+/// Verify that columns appended in bulk to the RooVectorDataStore end up in
+/// the same dataset as when filling the events one by one.
+TEST(RooDataSet, AppendColumns)
+{
+   RooRealVar x{"x", "x", 0.0, -10.0, 10.0};
+   RooRealVar y{"y", "y", 0.0, -10.0, 10.0};
+
+   RooDataSet dataSetRef{"dataSetRef", "dataSetRef", {x, y}};
+   RooDataSet dataSet{"dataSet", "dataSet", {x, y}};
+   auto store = dynamic_cast<RooVectorDataStore *>(dataSet.store());
+   ASSERT_NE(store, nullptr);
+
+   // Append twice, such that the first columns are adopted and the second
+   // ones are copied.
+   for (int iChunk = 0; iChunk < 2; ++iChunk) {
+      std::vector<std::vector<double>> columns(2);
+      for (int i = 0; i < 10; ++i) {
+         x.setVal(0.1 * i + iChunk);
+         y.setVal(-0.2 * i);
+         dataSetRef.add({x, y});
+         columns[0].push_back(x.getVal());
+         columns[1].push_back(y.getVal());
+      }
+      // The variables are given in a different order than in the dataset.
+      std::vector<std::vector<double>> swapped{columns[1], columns[0]};
+      EXPECT_TRUE(store->appendColumns(RooArgList{y, x}, std::move(swapped)));
+   }
+
+   // Columns with different sizes are rejected.
+   EXPECT_FALSE(store->appendColumns(RooArgList{x, y}, {{1.0}, {}}));
+
+   ASSERT_EQ(dataSet.numEntries(), dataSetRef.numEntries());
+   EXPECT_EQ(dataSet.sumEntries(), dataSetRef.sumEntries());
+   for (int i = 0; i < dataSet.numEntries(); ++i) {
+      RooArgSet const &row = *dataSet.get(i);
+      RooArgSet const &rowRef = *dataSetRef.get(i);
+      EXPECT_EQ(static_cast<RooRealVar &>(row["x"]).getVal(), static_cast<RooRealVar &>(rowRef["x"]).getVal());
+      EXPECT_EQ(static_cast<RooRealVar &>(row["y"]).getVal(), static_cast<RooRealVar &>(rowRef["y"]).getVal());
+   }
+}
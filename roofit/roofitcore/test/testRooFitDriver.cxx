@@ -22,6 +22,8 @@
 #include "RooMinimizer.h"
 #include "RooFitResult.h"
 
+#include "TROOT.h"
+
 #include <utility>
 #include <chrono>
 
@@ -98,3 +100,43 @@ TEST(testRooFitDriver, SimpleLikelihoodFit)
    EXPECT_EQ(resultScalar.evalCount, resultBatchNew.evalCount);
    ASSERT_TRUE(resultBatchNew.result->isIdentical(*resultScalar.result));
 }
+
+#ifdef R__USE_IMT
+// The independent nodes of the graph are evaluated concurrently with implicit
+// multi-threading, which must not change the result.
+TEST(testRooFitDriver, ConcurrentEvaluation)
+{
+   RooRealVar x("x", "x", 0, 10);
+
+   RooRealVar mean("mean", "mean", 5.28, 5.20, 5.30);
+   RooRealVar sigma("sigma", "sigma", 0.0027, 0.001, 1.);
+   RooGaussian sig("sig", "sig", x, mean, sigma);
+
+   RooRealVar m0("m0", "m0", 10.);
+   RooRealVar c("c", "c", -20.0, -100., -1.);
+   RooArgusBG bkg("bkg", "bkg", x, m0, c);
+
+   RooRealVar nsig("nsig", "nsig", 200, 0., 1000);
+   RooRealVar nbkg("nbkg", "nbkg", 800, 0., 1000);
+   RooAddPdf model("model", "model", {sig, bkg}, {nsig, nbkg});
+
+   std::unique_ptr<RooDataSet> data{model.generate(x, 5000)};
+
+   using namespace ROOT::Experimental;
+   RooNLLVarNew nll("nll", "nll", model, *data->get(), true, "", false);
+   RooFitDriver driver(nll, x, RooFit::BatchModeOption::Cpu);
+   driver.setData(*data);
+
+   ROOT::DisableImplicitMT();
+   const double valSequential = driver.getVal();
+   mean.setVal(5.25);
+   const double valSequentialChanged = driver.getVal();
+   mean.setVal(5.28);
+
+   ROOT::EnableImplicitMT(4);
+   EXPECT_DOUBLE_EQ(driver.getVal(), valSequential);
+   mean.setVal(5.25);
+   EXPECT_DOUBLE_EQ(driver.getVal(), valSequentialChanged);
+   ROOT::DisableImplicitMT();
+}
+#endif
@@ -0,0 +1,110 @@
+/*
+ * Project: RooFit
+ *
+ * Copyright (c) 2023, CERN
+ *
+ * Redistribution and use in source and binary forms,
+ * with or without modification, are permitted according to the terms
+ * listed in LICENSE (http://roofit.sourceforge.net/license.txt)
+ */
+
+#include <RooAddPdf.h>
+#include <RooDataSet.h>
+#include <RooFitResult.h>
+#include <RooFuncWrapper.h>
+#include <RooGaussian.h>
+#include <RooHelpers.h>
+#include <RooMinimizer.h>
+#include <RooRealVar.h>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+namespace {
+
+// Numeric derivative of the function with respect to the parameter, for
+// reference.
+double numericDerivative(RooAbsReal &func, RooRealVar &param, double eps = 1e-6)
+{
+   const double orig = param.getVal();
+   param.setVal(orig + eps);
+   const double plus = func.getVal();
+   param.setVal(orig - eps);
+   const double minus = func.getVal();
+   param.setVal(orig);
+   return (plus - minus) / (2 * eps);
+}
+
+} // namespace
+
+TEST(RooFuncWrapper, GaussianNLL)
+{
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   RooRealVar x{"x", "x", 0, -10, 10};
+   RooRealVar mu{"mu", "mu", 1, -5, 5};
+   RooRealVar sigma{"sigma", "sigma", 2, 0.1, 10};
+   RooGaussian gauss{"gauss", "gauss", x, mu, sigma};
+
+   std::unique_ptr<RooDataSet> data{gauss.generate(x, 1000)};
+
+   std::unique_ptr<RooAbsReal> nllRef{gauss.createNLL(*data, RooFit::BatchMode("cpu"))};
+   std::unique_ptr<RooAbsReal> nllFunc{gauss.createNLL(*data, RooFit::BatchMode("codegen"))};
+
+   EXPECT_NEAR(nllFunc->getVal(), nllRef->getVal(), 1e-8 * std::abs(nllRef->getVal()));
+
+   mu.setVal(0.5);
+   sigma.setVal(2.5);
+   EXPECT_NEAR(nllFunc->getVal(), nllRef->getVal(), 1e-8 * std::abs(nllRef->getVal()));
+
+   if (!nllFunc->hasGradient())
+      return;
+
+   // The gradient is ordered like the parameters sorted by name.
+   double grad[2];
+   nllFunc->gradient(grad);
+   EXPECT_NEAR(grad[0], numericDerivative(*nllRef, mu), 1e-4);
+   EXPECT_NEAR(grad[1], numericDerivative(*nllRef, sigma), 1e-4);
+}
+
+TEST(RooFuncWrapper, ExtendedAddPdfFit)
+{
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   RooRealVar x{"x", "x", 0, -10, 10};
+   RooRealVar mu1{"mu1", "mu1", -2, -5, 5};
+   RooRealVar mu2{"mu2", "mu2", 2, -5, 5};
+   RooRealVar sigma{"sigma", "sigma", 1.5, 0.1, 10};
+   RooGaussian gauss1{"gauss1", "gauss1", x, mu1, sigma};
+   RooGaussian gauss2{"gauss2", "gauss2", x, mu2, sigma};
+   RooRealVar n1{"n1", "n1", 300, 0, 2000};
+   RooRealVar n2{"n2", "n2", 700, 0, 2000};
+   RooAddPdf model{"model", "model", {gauss1, gauss2}, {n1, n2}};
+
+   std::unique_ptr<RooDataSet> data{model.generate(x)};
+
+   std::unique_ptr<RooAbsReal> nllRef{model.createNLL(*data, RooFit::BatchMode("cpu"), RooFit::Extended())};
+   std::unique_ptr<RooAbsReal> nllFunc{model.createNLL(*data, RooFit::BatchMode("codegen"), RooFit::Extended())};
+
+   EXPECT_NEAR(nllFunc->getVal(), nllRef->getVal(), 1e-8 * std::abs(nllRef->getVal()));
+
+   RooArgSet params;
+   model.getParameters(data->get(), params);
+   RooArgSet paramsInit;
+   params.snapshot(paramsInit);
+
+   auto fit = [&](RooAbsReal &nll) {
+      params.assign(paramsInit);
+      RooMinimizer m{nll};
+      m.setPrintLevel(-1);
+      m.setStrategy(0);
+      m.minimize("Minuit2");
+      return std::unique_ptr<RooFitResult>{m.save()};
+   };
+
+   auto resultRef = fit(*nllRef);
+   auto resultFunc = fit(*nllFunc);
+
+   EXPECT_TRUE(resultFunc->isIdentical(*resultRef, 1e-3, 1e-3));
+}
@@ -15,6 +15,8 @@
 
 #include "RooStats/LikelihoodInterval.h"
 
+#include <vector>
+
 namespace RooStats {
 
    class LikelihoodInterval;
@@ -53,6 +55,14 @@ namespace RooStats {
       /// floating (global maximum likelihood value).
       HypoTestResult* GetHypoTest() const override;
 
+      /// Return \f$ -\ln(\lambda) \f$ at the given points of the parameters of interest,
+      /// computed from independent conditional fits that can run in parallel processes.
+      std::vector<double> GetLikelihoodScan(const std::vector<std::vector<double>> &points) const;
+
+      /// Set the number of processes used by GetLikelihoodScan().
+      /// With 0 or 1, the points are scanned in the calling process.
+      void SetNWorkers(int nWorkers) { fNWorkers = nWorkers; }
+      int GetNWorkers() const { return fNWorkers; }
 
 
    protected:
@@ -69,6 +79,7 @@ namespace RooStats {
 
     mutable RooFitResult * fFitResult;  //// internal  result of global fit
     mutable bool fGlobalFitDone;        ///< flag to control if a global fit has been done
+    int fNWorkers = 0;                  ///<! number of processes for the likelihood scans
 
 
     ClassDefOverride(ProfileLikelihoodCalculator,2) // A concrete implementation of CombinedCalculator that uses the ProfileLikelihood ratio.
@@ -226,6 +226,11 @@ class ToyMCSampler: public TestStatSampler {
       /// calling with argument or nullptr deactivates proof
       void SetProofConfig(ProofConfig *pc = nullptr) { fProofConfig = pc; }
 
+      /// Generate and evaluate the toys in `nWorkers` parallel processes
+      /// without PROOF. A value of 0 or 1 means a serial run.
+      void SetNWorkers(Int_t nWorkers) { fNWorkers = nWorkers; }
+      Int_t GetNWorkers() const { return fNWorkers; }
+
       void SetProtoData(const RooDataSet* d) { fProtoData = d; }
 
    protected:
@@ -238,6 +243,8 @@ class ToyMCSampler: public TestStatSampler {
       /// helper method for clearing  the cache
       virtual void ClearCache();
 
+      RooDataSet* GetSamplingDistributionsMultiProcess(RooArgSet& paramPoint);
+
 
       /// densities, snapshots, and test statistics to reweight to
       RooAbsPdf *fPdf; ///< model (can be alt or null)
@@ -271,6 +278,7 @@ class ToyMCSampler: public TestStatSampler {
       const RooDataSet *fProtoData; ///< in dev
 
       ProofConfig *fProofConfig;   ///<!
+      Int_t fNWorkers = 0;         ///<! number of processes for parallel runs without PROOF
 
       mutable NuisanceParametersSampler *fNuisanceParametersSampler; ///<!
 
@@ -45,6 +45,10 @@ ConfInterval pointer).
 This calculator can work with both one-dimensional intervals or multi-
 dimensional ones (contours).
 
+Scans of the profile likelihood, for example on a grid of the parameters of
+interest, can be computed with GetLikelihoodScan(). The conditional fits of
+the scan points can run in parallel processes, see SetNWorkers().
+
 Note that for hypothesis tests, it is often better to use the
 AsymptoticCalculator, which can compute in addition the expected
 \f$p\f$-value using an Asimov data set.
@@ -68,6 +72,15 @@ AsymptoticCalculator, which can compute in addition the expected
 #include "RooMinimizer.h"
 //#include "RooProdPdf.h"
 
+#ifndef R__WIN32
+#include "ROOT/TProcessExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+
 using namespace std;
 
 ClassImp(RooStats::ProfileLikelihoodCalculator); ;
@@ -288,6 +301,107 @@ LikelihoodInterval* ProfileLikelihoodCalculator::GetInterval() const {
    return interval;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Scan the profile likelihood at the given points of the parameters of interest.
+/// Each point is a vector with the values of the POIs, in the order of
+/// GetParametersOfInterest(). The returned vector contains \f$ -\ln(\lambda) \f$
+/// at each point, which is the difference between the minimum of the NLL
+/// with the POIs fixed to the point and the global minimum. An empty vector
+/// is returned if the configuration is invalid or the global fit fails.
+///
+/// The conditional fits are independent of each other. If SetNWorkers() was
+/// called, the points are split into contiguous chunks that are scanned in
+/// parallel processes forked with ROOT::TProcessExecutor, each with its own
+/// copy of the likelihood and minimizer. Within a chunk, each fit starts from
+/// the nuisance parameter values found for the previous point. The points
+/// should therefore be ordered such that consecutive points are neighbours,
+/// for example by scanning the rows of a 2D grid in alternating directions.
+
+std::vector<double> ProfileLikelihoodCalculator::GetLikelihoodScan(const std::vector<std::vector<double>> &points) const
+{
+   std::vector<double> out;
+   RooAbsPdf * pdf = GetPdf();
+   RooAbsData* data = GetData();
+   if (!data || !pdf || fPOI.empty()) return out;
+
+   for (auto const &point : points) {
+      if (point.size() != fPOI.size()) {
+         oocoutE(nullptr,InputArguments) << "ProfileLikelihoodCalculator::GetLikelihoodScan - each scan point needs "
+                                         << fPOI.size() << " values, one per parameter of interest" << std::endl;
+         return out;
+      }
+   }
+
+   std::unique_ptr<RooAbsReal> nll{DoGlobalFit()};
+   if (!nll || !fFitResult) return out;
+   const double globalMinNll = fFitResult->minNll();
+
+   std::unique_ptr<RooArgSet> params{nll->getParameters(RooArgSet())};
+   params->assign(fFitResult->floatParsFinal());
+   RooArgSet globalFitValues;
+   params->snapshot(globalFitValues);
+
+   std::vector<RooRealVar *> pois;
+   std::vector<bool> poisConstant;
+   for (auto const *arg : fPOI) {
+      auto *poi = dynamic_cast<RooRealVar *>(params->find(arg->GetName()));
+      if (!poi) {
+         oocoutE(nullptr,InputArguments) << "ProfileLikelihoodCalculator::GetLikelihoodScan - the parameter of interest "
+                                         << arg->GetName() << " is not a real-valued parameter of the likelihood" << std::endl;
+         return out;
+      }
+      pois.push_back(poi);
+      poisConstant.push_back(poi->isConstant());
+   }
+
+   auto scanChunk = [&](std::size_t begin, std::size_t end) {
+      std::vector<double> chunk;
+      chunk.reserve(end - begin);
+      params->assign(globalFitValues);
+      for (RooRealVar *poi : pois) poi->setConstant(true);
+      for (std::size_t i = begin; i < end; ++i) {
+         for (std::size_t j = 0; j < pois.size(); ++j) pois[j]->setVal(points[i][j]);
+         std::unique_ptr<RooFitResult> result{DoMinimizeNLL(nll.get())};
+         chunk.push_back(result ? result->minNll() - globalMinNll : std::numeric_limits<double>::quiet_NaN());
+      }
+      return chunk;
+   };
+
+   const std::size_t nChunks = std::max<std::size_t>(1, std::min<std::size_t>(std::max(fNWorkers, 1), points.size()));
+   auto chunkBegin = [&](std::size_t iChunk) {
+      return iChunk * (points.size() / nChunks) + std::min(iChunk, points.size() % nChunks);
+   };
+
+#ifndef R__WIN32
+   if (nChunks > 1) {
+      // The results come back in the order in which the workers finish, so
+      // each chunk is prefixed with its index to put them back in order.
+      auto work = [&](int iChunk) {
+         std::vector<double> chunk{double(iChunk)};
+         std::vector<double> values = scanChunk(chunkBegin(iChunk), chunkBegin(iChunk + 1));
+         chunk.insert(chunk.end(), values.begin(), values.end());
+         return chunk;
+      };
+      ROOT::TProcessExecutor pool(nChunks);
+      std::vector<std::vector<double>> results = pool.Map(work, ROOT::TSeqI(nChunks));
+      out.resize(points.size(), std::numeric_limits<double>::quiet_NaN());
+      for (auto const &chunk : results) {
+         if (chunk.empty()) continue;
+         std::size_t iChunk = static_cast<std::size_t>(chunk[0]);
+         std::copy(chunk.begin() + 1, chunk.end(), out.begin() + chunkBegin(iChunk));
+      }
+   } else
+#endif
+   {
+      out = scanChunk(0, points.size());
+   }
+
+   params->assign(globalFitValues);
+   for (std::size_t j = 0; j < pois.size(); ++j) pois[j]->setConstant(poisConstant[j]);
+
+   return out;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Main interface to get a HypoTestResult.
 /// It does two fits:
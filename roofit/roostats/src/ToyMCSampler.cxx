@@ -27,6 +27,12 @@ TestStatistic.
 For parallel runs, ToyMCSampler can be given an instance of ProofConfig
 and then run in parallel using proof or proof-lite. Internally, it uses
 ToyMCStudy with the RooStudyManager.
+
+Without PROOF, the toys can be generated and evaluated in parallel processes
+with ROOT::TProcessExecutor, see SetNWorkers(). Each worker process works on
+its own copy of the models and gets a random seed drawn from
+RooRandom::randomGenerator() in the calling process, so the results are
+reproducible for a given seed and number of workers.
 */
 
 #include "RooStats/ToyMCSampler.h"
@@ -50,6 +56,14 @@ ToyMCStudy with the RooStudyManager.
 
 #include "TMath.h"
 
+#ifndef R__WIN32
+#include "ROOT/TProcessExecutor.hxx"
+#include "ROOT/TSeq.hxx"
+#endif
+
+#include <algorithm>
+#include <vector>
+
 
 using namespace RooFit;
 using namespace std;
@@ -303,8 +317,11 @@ RooDataSet* ToyMCSampler::GetSamplingDistributions(RooArgSet& paramPointIn)
 {
 
    // ======= S I N G L E   R U N ? =======
-   if(!fProofConfig)
+   if(!fProofConfig) {
+      if(fNWorkers > 1)
+         return GetSamplingDistributionsMultiProcess(paramPointIn);
       return GetSamplingDistributionsSingleWorker(paramPointIn);
+   }
 
    // ======= P A R A L L E L   R U N =======
    if (!CheckConfig()){
@@ -346,6 +363,73 @@ RooDataSet* ToyMCSampler::GetSamplingDistributions(RooArgSet& paramPointIn)
    return output;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Generate and evaluate the toys in fNWorkers processes forked with
+/// ROOT::TProcessExecutor, and merge the results. The toys are split evenly
+/// over the workers, and each worker is seeded with a random number drawn
+/// in the calling process before forking. Adaptive sampling is not supported.
+
+RooDataSet* ToyMCSampler::GetSamplingDistributionsMultiProcess(RooArgSet& paramPointIn)
+{
+#ifdef R__WIN32
+   oocoutW(nullptr, InputArguments)
+      << "ToyMCSampler: parallel processes are not supported on Windows, running serially." << endl;
+   return GetSamplingDistributionsSingleWorker(paramPointIn);
+#else
+   if (!CheckConfig()){
+      oocoutE(nullptr, InputArguments)
+         << "Bad COnfiguration in ToyMCSampler "
+         << endl;
+      return nullptr;
+   }
+
+   if(fToysInTails) {
+      oocoutW(nullptr, InputArguments)
+         << "Adaptive sampling in ToyMCSampler is not supported for parallel runs."
+         << endl;
+   }
+
+   const Int_t totToys = fNToys;
+   const double toysInTails = fToysInTails;
+   const int nWorkers = std::max(1, std::min(fNWorkers, totToys));
+
+   // draw the seeds of the workers here, so the result doesn't depend on which
+   // worker process ends up running which share of the toys
+   std::vector<UInt_t> seeds(nWorkers);
+   for (auto &seed : seeds) {
+      seed = RooRandom::randomGenerator()->Integer(TMath::Limits<unsigned int>::Max());
+   }
+
+   auto work = [&](int iWorker) -> RooDataSet * {
+      // runs in a forked process, so changing the state doesn't affect the caller
+      RooRandom::randomGenerator()->SetSeed(seeds[iWorker]);
+      fNToys = totToys / nWorkers + (iWorker < totToys % nWorkers ? 1 : 0);
+      fToysInTails = 0.0;
+      return GetSamplingDistributionsSingleWorker(paramPointIn);
+   };
+
+   ROOT::TProcessExecutor pool(nWorkers);
+   std::vector<RooDataSet *> results = pool.Map(work, ROOT::TSeqI(nWorkers));
+
+   fNToys = totToys;
+   fToysInTails = toysInTails;
+
+   RooDataSet *output = nullptr;
+   for (RooDataSet *result : results) {
+      if (!result) {
+         continue;
+      }
+      if (!output) {
+         output = result;
+      } else {
+         output->append(*result);
+         delete result;
+      }
+   }
+   return output;
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// This is the main function for serial runs. It is called automatically
 /// from inside GetSamplingDistribution when no ProofConfig is given.
@@ -0,0 +1,46 @@
+// Tests for the RooStats::ProfileLikelihoodCalculator
+
+#include "RooRealVar.h"
+#include "RooGaussian.h"
+#include "RooDataSet.h"
+#include "RooHelpers.h"
+#include "RooStats/ProfileLikelihoodCalculator.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+
+/// Check that the likelihood scan in parallel processes gives the same
+/// result as the serial scan, and that it matches the analytical result for
+/// the mean of a Gaussian with known width.
+TEST(ProfileLikelihoodCalculator, LikelihoodScan)
+{
+   RooHelpers::LocalChangeMsgLevel changeMsgLvl(RooFit::WARNING);
+
+   RooRealVar x("x", "x", 0, -10, 10);
+   RooRealVar mu("mu", "mu", 0, -5, 5);
+   RooRealVar sigma("sigma", "sigma", 2.0);
+   RooGaussian gauss("gauss", "gauss", x, mu, sigma);
+
+   std::unique_ptr<RooDataSet> data{gauss.generate(x, 200)};
+   const double mean = data->mean(x);
+
+   RooStats::ProfileLikelihoodCalculator plc(*data, gauss, mu);
+
+   std::vector<std::vector<double>> points;
+   for (int i = 0; i < 7; ++i) {
+      points.push_back({-0.6 + 0.2 * i});
+   }
+
+   std::vector<double> serial = plc.GetLikelihoodScan(points);
+   plc.SetNWorkers(3);
+   std::vector<double> parallel = plc.GetLikelihoodScan(points);
+
+   ASSERT_EQ(serial.size(), points.size());
+   ASSERT_EQ(parallel.size(), points.size());
+   for (std::size_t i = 0; i < points.size(); ++i) {
+      const double delta = (points[i][0] - mean) / sigma.getVal();
+      EXPECT_NEAR(serial[i], 0.5 * data->numEntries() * delta * delta, 1e-4);
+      EXPECT_NEAR(parallel[i], serial[i], 1e-6);
+   }
+}
@@ -0,0 +1,49 @@
+// Tests for the RooStats::ToyMCSampler
+
+#include "RooRealVar.h"
+#include "RooGaussian.h"
+#include "RooExtendPdf.h"
+#include "RooRandom.h"
+#include "RooStats/NumEventsTestStat.h"
+#include "RooStats/SamplingDistribution.h"
+#include "RooStats/ToyMCSampler.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+
+/// Check that the toys generated in parallel processes are complete and
+/// reproducible for a given seed.
+TEST(ToyMCSampler, MultiProcess)
+{
+   RooRealVar x("x", "x", 0, -10, 10);
+   RooRealVar mu("mu", "mu", 0, -5, 5);
+   RooRealVar sigma("sigma", "sigma", 1, 0.1, 5);
+   RooGaussian gauss("gauss", "gauss", x, mu, sigma);
+   RooRealVar nEvents("nEvents", "nEvents", 50, 0, 1000);
+   RooExtendPdf model("model", "model", gauss, nEvents);
+
+   RooStats::NumEventsTestStat testStat(model);
+
+   RooStats::ToyMCSampler sampler(testStat, 100);
+   sampler.SetPdf(model);
+   sampler.SetObservables(x);
+   sampler.SetParametersForTestStat(mu);
+   sampler.SetNWorkers(2);
+
+   auto sample = [&]() {
+      RooRandom::randomGenerator()->SetSeed(1234);
+      RooArgSet paramPoint(mu, nEvents);
+      return std::unique_ptr<RooStats::SamplingDistribution>{sampler.GetSamplingDistribution(paramPoint)};
+   };
+
+   auto dist1 = sample();
+   auto dist2 = sample();
+   ASSERT_NE(dist1, nullptr);
+   ASSERT_NE(dist2, nullptr);
+
+   const std::vector<double> &values1 = dist1->GetSamplingDistribution();
+   const std::vector<double> &values2 = dist2->GetSamplingDistribution();
+   ASSERT_EQ(values1.size(), 100u);
+   EXPECT_EQ(values1, values2);
+}
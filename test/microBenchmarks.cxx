@@ -0,0 +1,347 @@
+// @(#)root/test:$Id$
+
+//////////////////////////////////////////////////////////////////
+//
+//___Micro-benchmarks of frequently used ROOT functions___
+//
+//   microBenchmarks times small, hot operations with Google
+//   Benchmark: axis lookups, histogram filling, TBufferFile array
+//   streaming, compression and decompression with each algorithm,
+//   RVec operations, the per-entry overhead of RDataFrame, TClass
+//   lookups and, when built with root7, the packing of RNTuple
+//   column elements.
+//
+//   All Google Benchmark options are available, for instance:
+//     microBenchmarks --benchmark_filter=Zip
+//     microBenchmarks --benchmark_out=results.json --benchmark_out_format=json
+//   The JSON output contains the context of the run (machine, date)
+//   and can be compared between ROOT versions with the compare.py
+//   tool of Google Benchmark.
+//
+//_____________________________batch only_____________________
+
+#include <benchmark/benchmark.h>
+
+#include <Compression.h>
+#include <RZip.h>
+#include <ROOT/RDataFrame.hxx>
+#include <ROOT/RVec.hxx>
+#include <TAxis.h>
+#include <TBufferFile.h>
+#include <TClass.h>
+#include <TH1.h>
+#include <TRandom3.h>
+
+#ifdef R__MICROBENCH_NTUPLE
+#include <ROOT/RColumnElement.hxx>
+#include <ROOT/RColumnModel.hxx>
+#endif
+
+#include <cstddef>
+#include <vector>
+
+namespace {
+
+/// Uniform random numbers in [min, max), the same for every run
+std::vector<double> MakeData(std::size_t n, double min = 0., double max = 1.)
+{
+   TRandom3 rng(4357);
+   std::vector<double> data(n);
+   for (auto &x : data)
+      x = rng.Uniform(min, max);
+   return data;
+}
+
+constexpr std::size_t kNValues = 4096; // power of two, see the masks below
+
+} // anonymous namespace
+
+//--TAxis----------------------------------------------------------------------------------------
+
+static void BM_TAxis_FindBin_Fixed(benchmark::State &state)
+{
+   TAxis axis(state.range(0), 0., 1.);
+   const auto xs = MakeData(kNValues, -0.1, 1.1);
+   std::size_t i = 0;
+   for (auto _ : state)
+      benchmark::DoNotOptimize(axis.FindBin(xs[i++ & (kNValues - 1)]));
+   state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TAxis_FindBin_Fixed)->Arg(10)->Arg(1000);
+
+static void BM_TAxis_FindBin_Variable(benchmark::State &state)
+{
+   const int nbins = state.range(0);
+   std::vector<double> edges(nbins + 1);
+   for (int b = 0; b <= nbins; ++b)
+      edges[b] = double(b) * b / nbins / nbins;
+   TAxis axis(nbins, edges.data());
+   const auto xs = MakeData(kNValues, -0.1, 1.1);
+   std::size_t i = 0;
+   for (auto _ : state)
+      benchmark::DoNotOptimize(axis.FindBin(xs[i++ & (kNValues - 1)]));
+   state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TAxis_FindBin_Variable)->Arg(10)->Arg(1000);
+
+//--TH1------------------------------------------------------------------------------------------
+
+static void BM_TH1D_Fill(benchmark::State &state)
+{
+   TH1D h("h", "h", 100, 0., 1.);
+   const auto xs = MakeData(kNValues, -0.1, 1.1);
+   std::size_t i = 0;
+   for (auto _ : state)
+      h.Fill(xs[i++ & (kNValues - 1)]);
+   state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TH1D_Fill);
+
+static void BM_TH1D_FillWeighted(benchmark::State &state)
+{
+   TH1D h("h", "h", 100, 0., 1.);
+   h.Sumw2();
+   const auto xs = MakeData(kNValues, -0.1, 1.1);
+   std::size_t i = 0;
+   for (auto _ : state) {
+      const auto x = xs[i++ & (kNValues - 1)];
+      h.Fill(x, 0.5 + x);
+   }
+   state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TH1D_FillWeighted);
+
+//--TBufferFile----------------------------------------------------------------------------------
+
+static void BM_TBufferFile_WriteFastArray(benchmark::State &state)
+{
+   const auto values = MakeData(state.range(0));
+   TBufferFile buf(TBuffer::kWrite, values.size() * sizeof(double) + 1024);
+   for (auto _ : state) {
+      buf.SetBufferOffset(0);
+      buf.WriteFastArray(values.data(), values.size());
+   }
+   state.SetBytesProcessed(state.iterations() * values.size() * sizeof(double));
+}
+BENCHMARK(BM_TBufferFile_WriteFastArray)->Arg(16)->Arg(4096);
+
+static void BM_TBufferFile_ReadFastArray(benchmark::State &state)
+{
+   auto values = MakeData(state.range(0));
+   TBufferFile buf(TBuffer::kWrite, values.size() * sizeof(double) + 1024);
+   buf.WriteFastArray(values.data(), values.size());
+   buf.SetReadMode();
+   for (auto _ : state) {
+      buf.SetBufferOffset(0);
+      buf.ReadFastArray(values.data(), values.size());
+      benchmark::DoNotOptimize(values.data());
+   }
+   state.SetBytesProcessed(state.iterations() * values.size() * sizeof(double));
+}
+BENCHMARK(BM_TBufferFile_ReadFastArray)->Arg(16)->Arg(4096);
+
+//--R__zip / R__unzip----------------------------------------------------------------------------
+
+namespace {
+
+using EAlgorithm = ROOT::RCompressionSetting::EAlgorithm::EValues;
+
+/// 256 kB of doubles with few significant digits: compressible, but not trivially so
+std::vector<char> MakeZipInput()
+{
+   std::vector<char> input(256 * 1024);
+   auto values = reinterpret_cast<double *>(input.data());
+   TRandom3 rng(4357);
+   for (std::size_t i = 0; i < input.size() / sizeof(double); ++i)
+      values[i] = int(rng.Gaus(100., 10.) * 100) / 100.;
+   return input;
+}
+
+const char *AlgorithmName(int algorithm)
+{
+   switch (algorithm) {
+   case EAlgorithm::kZLIB: return "ZLIB";
+   case EAlgorithm::kLZMA: return "LZMA";
+   case EAlgorithm::kLZ4: return "LZ4";
+   case EAlgorithm::kZSTD: return "ZSTD";
+   default: return "?";
+   }
+}
+
+} // anonymous namespace
+
+static void BM_Zip(benchmark::State &state)
+{
+   const auto algorithm = static_cast<EAlgorithm>(state.range(0));
+   const int level = state.range(1);
+   auto input = MakeZipInput();
+   std::vector<char> output(input.size());
+   int nout = 0;
+   for (auto _ : state) {
+      int srcsize = input.size();
+      int tgtsize = output.size();
+      R__zipMultipleAlgorithm(level, &srcsize, input.data(), &tgtsize, output.data(), &nout, algorithm);
+   }
+   if (nout == 0)
+      state.SkipWithError("compression failed");
+   state.SetLabel(AlgorithmName(algorithm));
+   state.counters["ratio"] = double(input.size()) / (nout ? nout : 1);
+   state.SetBytesProcessed(state.iterations() * input.size());
+}
+
+static void BM_Unzip(benchmark::State &state)
+{
+   const auto algorithm = static_cast<EAlgorithm>(state.range(0));
+   const int level = state.range(1);
+   auto input = MakeZipInput();
+   std::vector<char> zipped(input.size());
+   int srcsize = input.size();
+   int tgtsize = zipped.size();
+   int nzipped = 0;
+   R__zipMultipleAlgorithm(level, &srcsize, input.data(), &tgtsize, zipped.data(), &nzipped, algorithm);
+   if (nzipped == 0) {
+      state.SkipWithError("compression failed");
+      return;
+   }
+   std::vector<unsigned char> output(input.size());
+   int nout = 0;
+   for (auto _ : state) {
+      int zsize = nzipped;
+      int osize = output.size();
+      R__unzip(&zsize, reinterpret_cast<unsigned char *>(zipped.data()), &osize, output.data(), &nout);
+   }
+   if (nout != int(input.size()))
+      state.SkipWithError("decompression failed");
+   state.SetLabel(AlgorithmName(algorithm));
+   state.SetBytesProcessed(state.iterations() * input.size());
+}
+
+static void ZipArguments(benchmark::internal::Benchmark *b)
+{
+   b->Args({EAlgorithm::kZLIB, 1})->Args({EAlgorithm::kZLIB, 6});
+   b->Args({EAlgorithm::kLZMA, 1})->Args({EAlgorithm::kLZMA, 7});
+   b->Args({EAlgorithm::kLZ4, 1})->Args({EAlgorithm::kLZ4, 4});
+   b->Args({EAlgorithm::kZSTD, 1})->Args({EAlgorithm::kZSTD, 5});
+}
+BENCHMARK(BM_Zip)->Apply(ZipArguments);
+BENCHMARK(BM_Unzip)->Apply(ZipArguments);
+
+//--RVec-----------------------------------------------------------------------------------------
+
+static void BM_RVec_SumOfProduct(benchmark::State &state)
+{
+   const auto data = MakeData(2 * state.range(0));
+   ROOT::RVecD a(data.begin(), data.begin() + state.range(0));
+   ROOT::RVecD b(data.begin() + state.range(0), data.end());
+   for (auto _ : state)
+      benchmark::DoNotOptimize(ROOT::VecOps::Sum(a * b));
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RVec_SumOfProduct)->Arg(8)->Arg(1024);
+
+static void BM_RVec_MaskedSelection(benchmark::State &state)
+{
+   const auto data = MakeData(state.range(0));
+   ROOT::RVecD a(data.begin(), data.end());
+   for (auto _ : state) {
+      auto selected = a[a > 0.5];
+      benchmark::DoNotOptimize(selected.data());
+   }
+   state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RVec_MaskedSelection)->Arg(8)->Arg(1024);
+
+//--RDataFrame-----------------------------------------------------------------------------------
+
+// Time per entry of a Define, a Filter and a Sum, the event loop overhead dominates
+static void BM_RDataFrame_EntryOverhead(benchmark::State &state)
+{
+   const ULong64_t nEntries = state.range(0);
+   for (auto _ : state) {
+      ROOT::RDataFrame df(nEntries);
+      auto sum = df.Define("x", [](ULong64_t e) { return double(e); }, {"rdfentry_"})
+                    .Filter([](double x) { return x >= 0.; }, {"x"})
+                    .Sum<double>("x");
+      benchmark::DoNotOptimize(*sum);
+   }
+   state.SetItemsProcessed(state.iterations() * nEntries);
+}
+BENCHMARK(BM_RDataFrame_EntryOverhead)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+//--TClass---------------------------------------------------------------------------------------
+
+static void BM_TClass_GetClassByName(benchmark::State &state)
+{
+   for (auto _ : state)
+      benchmark::DoNotOptimize(TClass::GetClass("TH1D"));
+   state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TClass_GetClassByName);
+
+static void BM_TClass_GetClassByTypeid(benchmark::State &state)
+{
+   for (auto _ : state)
+      benchmark::DoNotOptimize(TClass::GetClass(typeid(TH1D)));
+   state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TClass_GetClassByTypeid);
+
+//--RColumnElement-------------------------------------------------------------------------------
+
+#ifdef R__MICROBENCH_NTUPLE
+
+namespace {
+
+using ROOT::Experimental::EColumnType;
+using ROOT::Experimental::Detail::RColumnElementBase;
+
+void ColumnTypeArguments(benchmark::internal::Benchmark *b)
+{
+   b->Arg(int(EColumnType::kReal64))->Arg(int(EColumnType::kSplitReal64));
+}
+
+} // anonymous namespace
+
+static void BM_RColumnElement_Pack(benchmark::State &state)
+{
+   const auto type = static_cast<EColumnType>(state.range(0));
+   auto element = RColumnElementBase::Generate(type);
+   auto values = MakeData(64 * 1024);
+   std::vector<unsigned char> packed(element->GetPackedSize(values.size()));
+   for (auto _ : state) {
+      element->Pack(packed.data(), values.data(), values.size());
+      benchmark::DoNotOptimize(packed.data());
+   }
+   state.SetLabel(RColumnElementBase::GetTypeName(type));
+   state.SetBytesProcessed(state.iterations() * values.size() * sizeof(double));
+}
+BENCHMARK(BM_RColumnElement_Pack)->Apply(ColumnTypeArguments);
+
+static void BM_RColumnElement_Unpack(benchmark::State &state)
+{
+   const auto type = static_cast<EColumnType>(state.range(0));
+   auto element = RColumnElementBase::Generate(type);
+   auto values = MakeData(64 * 1024);
+   std::vector<unsigned char> packed(element->GetPackedSize(values.size()));
+   element->Pack(packed.data(), values.data(), values.size());
+   for (auto _ : state) {
+      element->Unpack(values.data(), packed.data(), values.size());
+      benchmark::DoNotOptimize(values.data());
+   }
+   state.SetLabel(RColumnElementBase::GetTypeName(type));
+   state.SetBytesProcessed(state.iterations() * values.size() * sizeof(double));
+}
+BENCHMARK(BM_RColumnElement_Unpack)->Apply(ColumnTypeArguments);
+
+#endif // R__MICROBENCH_NTUPLE
+
+int main(int argc, char **argv)
+{
+   TH1::AddDirectory(kFALSE);
+
+   benchmark::Initialize(&argc, argv);
+   if (benchmark::ReportUnrecognizedArguments(argc, argv))
+      return 1;
+   benchmark::RunSpecifiedBenchmarks();
+   return 0;
+}
@@ -0,0 +1,396 @@
+// @(#)root/test:$Id$
+
+/////////////////////////////////////////////////////////////////
+//
+//___A benchmark comparing TTree and RNTuple I/O throughput___
+//
+//   stressIOBench writes the same generated data set, with a fixed
+//   random seed, as a TTree and as an RNTuple for a list of
+//   compression settings, and reads it back for a list of thread
+//   counts (implicit multi-threading), optionally also from remote
+//   copies of the files. Each measurement is printed and, with -o,
+//   written to a JSON file, so that results of different ROOT
+//   versions or machines can be compared.
+//
+//   Can be run as:
+//     stressIOBench [-n entries] [-c settings] [-t threads] [-s seed]
+//                   [-r url] [-o results.json]
+//
+//   -n entries   number of entries to generate (default 100000)
+//   -c settings  comma separated list of compression settings,
+//                algorithm * 100 + level (default 0,101,207,404,505)
+//   -t threads   comma separated list of thread counts, 0 means
+//                implicit multi-threading disabled (default 0,4)
+//   -s seed      seed of the data generator (default 4357)
+//   -r url       also read the files from this location, e.g.
+//                root://eosuser.cern.ch//eos/user/x/xyz/ or
+//                https://server/path/; the files written locally by
+//                a previous run (stressIOBench_<format>_<setting>.root)
+//                have to be copied there first
+//   -o file      write the results to the given JSON file
+//
+//   Every entry holds an event with a few scalars and collections
+//   of tracks; the sum of the event energies is compared between
+//   writing and reading to check the data.
+//
+//_____________________________batch only_____________________
+
+#include <ROOT/RNTuple.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
+
+#include <RConfigure.h>
+#include <TError.h>
+#include <TFile.h>
+#include <TROOT.h>
+#include <TRandom3.h>
+#include <TStopwatch.h>
+#include <TString.h>
+#include <TSystem.h>
+#include <TTree.h>
+#include <TUrl.h>
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+using ROOT::Experimental::RNTupleModel;
+using ROOT::Experimental::RNTupleReader;
+using ROOT::Experimental::RNTupleWriteOptions;
+using ROOT::Experimental::RNTupleWriter;
+
+namespace {
+
+/// Event of the generated data set, the same for both formats
+struct BenchEvent {
+   Int_t fRun = 0;
+   Int_t fEvent = 0;
+   Float_t fEnergy = 0;
+   std::vector<Float_t> fPx;
+   std::vector<Float_t> fPy;
+   std::vector<Float_t> fPz;
+   std::vector<Int_t> fCharge;
+
+   /// Fill the event with reproducible content, returns the event energy
+   Double_t Generate(TRandom3 &rnd, Int_t event)
+   {
+      fRun = 1 + event / 10000;
+      fEvent = event;
+      const Int_t ntracks = rnd.Poisson(20);
+      fPx.resize(ntracks);
+      fPy.resize(ntracks);
+      fPz.resize(ntracks);
+      fCharge.resize(ntracks);
+      fEnergy = 0;
+      for (Int_t i = 0; i < ntracks; ++i) {
+         fPx[i] = rnd.Gaus(0, 1);
+         fPy[i] = rnd.Gaus(0, 1);
+         fPz[i] = rnd.Gaus(0, 10);
+         fCharge[i] = rnd.Rndm() < 0.5 ? -1 : 1;
+         fEnergy += std::sqrt(fPx[i] * fPx[i] + fPy[i] * fPy[i] + fPz[i] * fPz[i]);
+      }
+      return fEnergy;
+   }
+};
+
+/// One measurement, written as one record of the JSON output
+struct BenchResult {
+   std::string fFormat;
+   std::string fOperation;
+   std::string fBackend;
+   Int_t fCompression = 0;
+   Int_t fThreads = 0;
+   Long64_t fEntries = 0;
+   Long64_t fBytes = 0;
+   Double_t fRealTime = 0;
+   Double_t fCpuTime = 0;
+};
+
+Long64_t gEntries = 100000;
+UInt_t gSeed = 4357;
+std::vector<Int_t> gCompressions{0, 101, 207, 404, 505};
+std::vector<Int_t> gThreads{0, 4};
+std::string gRemote;
+std::string gOutput;
+std::vector<BenchResult> gResults;
+Bool_t gFailed = kFALSE;
+
+std::vector<Int_t> ParseList(const char *arg)
+{
+   std::vector<Int_t> result;
+   TString str(arg), token;
+   Ssiz_t from = 0;
+   while (str.Tokenize(token, from, ","))
+      result.push_back(token.Atoi());
+   return result;
+}
+
+std::string FileName(const char *format, Int_t compression)
+{
+   return TString::Format("stressIOBench_%s_%d.root", format, compression).Data();
+}
+
+Long64_t FileSize(const std::string &url)
+{
+   std::unique_ptr<TFile> f(TFile::Open(url.c_str()));
+   return f ? f->GetSize() : -1;
+}
+
+void SetThreads(Int_t nthreads)
+{
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled())
+      ROOT::DisableImplicitMT();
+   if (nthreads > 0)
+      ROOT::EnableImplicitMT(nthreads);
+#else
+   (void)nthreads;
+#endif
+}
+
+void Report(BenchResult &&result, Double_t sum, Double_t expected)
+{
+   const Double_t mbps = result.fRealTime > 0 ? result.fBytes / 1e6 / result.fRealTime : 0;
+   const Bool_t ok = std::fabs(sum - expected) <= 1e-6 * std::fabs(expected);
+   printf("%-7s %-5s %-6s compression %3d threads %2d: %8.3f s real, %8.3f s cpu, %9.2f MB/s ..... %s\n",
+          result.fFormat.c_str(), result.fOperation.c_str(), result.fBackend.c_str(), result.fCompression,
+          result.fThreads, result.fRealTime, result.fCpuTime, mbps, ok ? "OK" : "FAILED");
+   if (!ok)
+      gFailed = kTRUE;
+   gResults.emplace_back(std::move(result));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write the data set as TTree, returns sum of the event energies
+
+Double_t WriteTTree(const std::string &path, Int_t compression)
+{
+   TRandom3 rnd(gSeed);
+   BenchEvent event;
+   Double_t sum = 0;
+
+   std::unique_ptr<TFile> f(TFile::Open(path.c_str(), "RECREATE", "", compression));
+   auto tree = new TTree("events", "stressIOBench events");
+   tree->Branch("run", &event.fRun);
+   tree->Branch("event", &event.fEvent);
+   tree->Branch("energy", &event.fEnergy);
+   tree->Branch("px", &event.fPx);
+   tree->Branch("py", &event.fPy);
+   tree->Branch("pz", &event.fPz);
+   tree->Branch("charge", &event.fCharge);
+   for (Long64_t i = 0; i < gEntries; ++i) {
+      sum += event.Generate(rnd, i);
+      tree->Fill();
+   }
+   f->Write();
+   f->Close();
+   return sum;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read all branches of the TTree, returns sum of the event energies
+
+Double_t ReadTTree(const std::string &url, Long64_t &entries)
+{
+   std::unique_ptr<TFile> f(TFile::Open(url.c_str()));
+   TTree *tree = f ? f->Get<TTree>("events") : nullptr;
+   if (!tree) {
+      Error("ReadTTree", "cannot read tree from %s", url.c_str());
+      return 0;
+   }
+   Float_t energy = 0;
+   tree->SetBranchAddress("energy", &energy);
+   Double_t sum = 0;
+   entries = tree->GetEntries();
+   for (Long64_t i = 0; i < entries; ++i) {
+      tree->GetEntry(i);
+      sum += energy;
+   }
+   return sum;
+}
+
+std::unique_ptr<RNTupleModel> MakeModel(std::shared_ptr<Float_t> &energy)
+{
+   auto model = RNTupleModel::Create();
+   model->MakeField<Int_t>("run");
+   model->MakeField<Int_t>("event");
+   energy = model->MakeField<Float_t>("energy");
+   model->MakeField<std::vector<Float_t>>("px");
+   model->MakeField<std::vector<Float_t>>("py");
+   model->MakeField<std::vector<Float_t>>("pz");
+   model->MakeField<std::vector<Int_t>>("charge");
+   return model;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write the data set as RNTuple, returns sum of the event energies
+
+Double_t WriteRNTuple(const std::string &path, Int_t compression)
+{
+   TRandom3 rnd(gSeed);
+   BenchEvent event;
+   Double_t sum = 0;
+
+   auto model = RNTupleModel::Create();
+   auto run = model->MakeField<Int_t>("run");
+   auto evt = model->MakeField<Int_t>("event");
+   auto energy = model->MakeField<Float_t>("energy");
+   auto px = model->MakeField<std::vector<Float_t>>("px");
+   auto py = model->MakeField<std::vector<Float_t>>("py");
+   auto pz = model->MakeField<std::vector<Float_t>>("pz");
+   auto charge = model->MakeField<std::vector<Int_t>>("charge");
+
+   RNTupleWriteOptions options;
+   options.SetCompression(compression);
+   auto writer = RNTupleWriter::Recreate(std::move(model), "events", path, options);
+   for (Long64_t i = 0; i < gEntries; ++i) {
+      sum += event.Generate(rnd, i);
+      *run = event.fRun;
+      *evt = event.fEvent;
+      *energy = event.fEnergy;
+      std::swap(*px, event.fPx);
+      std::swap(*py, event.fPy);
+      std::swap(*pz, event.fPz);
+      std::swap(*charge, event.fCharge);
+      writer->Fill();
+      // keep the allocated vectors for the next event
+      std::swap(*px, event.fPx);
+      std::swap(*py, event.fPy);
+      std::swap(*pz, event.fPz);
+      std::swap(*charge, event.fCharge);
+   }
+   return sum;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read all fields of the RNTuple, returns sum of the event energies
+
+Double_t ReadRNTuple(const std::string &url, Long64_t &entries)
+{
+   std::shared_ptr<Float_t> energy;
+   auto model = MakeModel(energy);
+   auto reader = RNTupleReader::Open(std::move(model), "events", url);
+   Double_t sum = 0;
+   entries = reader->GetNEntries();
+   for (auto i : reader->GetEntryRange()) {
+      reader->LoadEntry(i);
+      sum += *energy;
+   }
+   return sum;
+}
+
+using WriteFunc_t = Double_t (*)(const std::string &, Int_t);
+using ReadFunc_t = Double_t (*)(const std::string &, Long64_t &);
+
+////////////////////////////////////////////////////////////////////////////////
+/// Run write and read measurements of one format for all settings
+
+void RunFormat(const char *format, WriteFunc_t writeFunc, ReadFunc_t readFunc)
+{
+   for (auto compression : gCompressions) {
+      const auto path = FileName(format, compression);
+      Double_t expected = 0;
+
+      for (auto nthreads : gThreads) {
+         SetThreads(nthreads);
+         TStopwatch timer;
+         expected = writeFunc(path, compression);
+         timer.Stop();
+         BenchResult result{format, "write", "local", compression, nthreads, gEntries, FileSize(path),
+                            timer.RealTime(), timer.CpuTime()};
+         Report(std::move(result), expected, expected);
+      }
+
+      std::vector<std::pair<std::string, std::string>> backends{{"local", path}};
+      if (!gRemote.empty())
+         backends.emplace_back(TUrl(gRemote.c_str()).GetProtocol(), gRemote + path);
+
+      for (auto &backend : backends) {
+         const Long64_t bytes = FileSize(backend.second);
+         for (auto nthreads : gThreads) {
+            SetThreads(nthreads);
+            Long64_t entries = 0;
+            TStopwatch timer;
+            const Double_t sum = readFunc(backend.second, entries);
+            timer.Stop();
+            BenchResult result{format, "read", backend.first, compression, nthreads, entries, bytes,
+                               timer.RealTime(), timer.CpuTime()};
+            Report(std::move(result), sum, expected);
+         }
+      }
+   }
+   SetThreads(0);
+}
+
+void WriteJSON(const std::string &fileName)
+{
+   FILE *f = fopen(fileName.c_str(), "w");
+   if (!f) {
+      Error("stressIOBench", "cannot write results to %s", fileName.c_str());
+      gFailed = kTRUE;
+      return;
+   }
+   fprintf(f, "{\"root_version\":\"%s\",\"root_git_commit\":\"%s\",\"host\":\"%s\",\"seed\":%u,\"results\":[",
+           gROOT->GetVersion(), gROOT->GetGitCommit(), gSystem->HostName(), gSeed);
+   for (std::size_t i = 0; i < gResults.size(); ++i) {
+      const auto &r = gResults[i];
+      fprintf(f,
+              "%s\n{\"format\":\"%s\",\"operation\":\"%s\",\"backend\":\"%s\",\"compression\":%d,\"threads\":%d,"
+              "\"entries\":%lld,\"bytes\":%lld,\"realtime\":%g,\"cputime\":%g}",
+              i ? "," : "", r.fFormat.c_str(), r.fOperation.c_str(), r.fBackend.c_str(), r.fCompression, r.fThreads,
+              r.fEntries, r.fBytes, r.fRealTime, r.fCpuTime);
+   }
+   fprintf(f, "\n]}\n");
+   fclose(f);
+}
+
+} // anonymous namespace
+
+int main(int argc, char **argv)
+{
+   for (int i = 1; i < argc; ++i) {
+      const bool hasValue = i + 1 < argc;
+      if (!strcmp(argv[i], "-n") && hasValue) {
+         gEntries = atoll(argv[++i]);
+      } else if (!strcmp(argv[i], "-c") && hasValue) {
+         gCompressions = ParseList(argv[++i]);
+      } else if (!strcmp(argv[i], "-t") && hasValue) {
+         gThreads = ParseList(argv[++i]);
+      } else if (!strcmp(argv[i], "-s") && hasValue) {
+         gSeed = atoi(argv[++i]);
+      } else if (!strcmp(argv[i], "-r") && hasValue) {
+         gRemote = argv[++i];
+         if (gRemote.back() != '/')
+            gRemote += '/';
+      } else if (!strcmp(argv[i], "-o") && hasValue) {
+         gOutput = argv[++i];
+      } else {
+         printf("Usage: stressIOBench [-n entries] [-c settings] [-t threads] [-s seed] [-r url] [-o results.json]\n");
+         return 1;
+      }
+   }
+
+#ifndef R__USE_IMT
+   gThreads = {0};
+#endif
+
+   printf("******************************************************************\n");
+   printf("*  stressIOBench: ROOT %s, %lld entries, seed %u\n", gROOT->GetVersion(), gEntries, gSeed);
+   printf("******************************************************************\n");
+
+   RunFormat("ttree", WriteTTree, ReadTTree);
+   RunFormat("rntuple", WriteRNTuple, ReadRNTuple);
+
+   if (!gOutput.empty())
+      WriteJSON(gOutput);
+
+   printf("******************************************************************\n");
+   printf("*  stressIOBench %s\n", gFailed ? "FAILED" : "OK");
+   printf("******************************************************************\n");
+
+   return gFailed ? 1 : 0;
+}
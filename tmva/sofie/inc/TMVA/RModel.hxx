@@ -9,6 +9,7 @@
 #include <memory>
 #include <ctime>
 #include <set>
+#include <map>
 #include <iomanip>
 #include <fstream>
 #include <sstream>
@@ -24,6 +25,7 @@ enum class Options {
    kDefault = 0x0,
    kNoSession = 0x1,
    kNoWeightFile = 0x2,
+   kBF16Weights = 0x4,  ///< store the float weights in the weight file as bfloat16
 };
 
 std::underlying_type_t<Options> operator|(Options opA, Options opB);
@@ -52,8 +54,13 @@ private:
    const std::unordered_set<std::string> fAllowedStdLib = {"vector", "algorithm", "cmath"};
    std::unordered_set<std::string> fNeededStdLib = {"vector"};
    bool fUseWeightFile = true;
+   bool fUseBF16Weights = false;
    bool fUseSession = true;
 
+   void FuseOperators();
+   std::map<std::string, size_t> PlanIntermediateMemory(const std::vector<std::string> &operatorCode,
+                                                        const std::string &sessionCode, size_t &poolSize);
+
 public:
 
    //explicit move ctor/assn
@@ -72,6 +79,9 @@ public:
    const ETensorType& GetTensorType(std::string name);
 
    bool CheckIfTensorAlreadyExist(std::string tensor_name);
+   bool IsInitializedTensor(const std::string& name) const {
+      return fInitializedTensors.find(name) != fInitializedTensors.end();
+   }
    void AddInputTensorInfo(std::string input_name, ETensorType type, std::vector<Dim> shape);
    void AddInputTensorInfo(std::string input_name, ETensorType type, std::vector<size_t> shape);
    void AddOperator(std::unique_ptr<ROperator> op, int order_execution = -1);
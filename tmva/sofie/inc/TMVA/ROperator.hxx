@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <memory>
+#include <string>
 
 #include "TMVA/SOFIE_common.hxx"
 //#include "RModel.hxx"
@@ -28,6 +29,16 @@ public:
    // generate session data members specific to operator
    virtual std::string GenerateSessionMembersCode(std::string /*opName*/) { return ""; }
    virtual std::string Header() { return "";}
+   // true if the output tensor can be written to the memory of an input tensor of the same length,
+   // i.e. if each output element only depends on the input elements with the same index
+   virtual bool SupportsInPlace() const { return false; }
+   // names of the input and output tensors, used by RModel::FuseOperators.
+   // An empty list means that the tensors of the operator are not known and disables the fusion
+   virtual std::vector<std::string> GetOpInputTensors() const { return {}; }
+   virtual std::vector<std::string> GetOpOutputTensors() const { return {}; }
+   // try to absorb the operator `next`, which is the only consumer of the output of this operator,
+   // before the operators are initialized. Return true if `next` can be removed from the model
+   virtual bool Fuse(ROperator & /*next*/, RModel & /*model*/) { return false; }
 
 
    //virtual void Forward_reference() = 0;
@@ -58,6 +58,9 @@ public:
       fNX1(UTILITY::Clean_name(nameX1)), fNX2(UTILITY::Clean_name(nameX2)), fNY(UTILITY::Clean_name(nameY)){}
 
    // type of output given input
+   std::vector<std::string> GetOpInputTensors() const { return {fNX1, fNX2}; }
+   std::vector<std::string> GetOpOutputTensors() const { return {fNY}; }
+
    std::vector<ETensorType> TypeInference(std::vector<ETensorType> input){
       return input;
    }
@@ -98,6 +101,8 @@ public:
    }
 
 
+   bool SupportsInPlace() const { return true; }
+
    std::string Generate(std::string OpName){
       OpName = "op_" + OpName;
 
@@ -62,6 +62,10 @@ public:
    }
 	
 
+   std::vector<std::string> GetOpInputTensors() const { return {fNX, fNScale, fNB, fNMean, fNVar}; }
+   std::vector<std::string> GetOpOutputTensors() const { return {fNY}; }
+   float GetEpsilon() const { return fepsilon; }
+
    std::vector<ETensorType> TypeInference(std::vector<ETensorType> input) {
       ETensorType out = input[0];
       return {out};
@@ -35,6 +35,9 @@
                fInputs.push_back(UTILITY::Clean_name(name));
          }
 
+         std::vector<std::string> GetOpInputTensors() const { return fInputs; }
+         std::vector<std::string> GetOpOutputTensors() const { return {fOutput}; }
+
          std::vector<ETensorType> TypeInference(std::vector<ETensorType> input){
              return input;
          }
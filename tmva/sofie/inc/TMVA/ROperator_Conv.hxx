@@ -4,6 +4,8 @@
 #include "TMVA/SOFIE_common.hxx"
 #include "TMVA/ROperator.hxx"
 #include "TMVA/RModel.hxx"
+#include "TMVA/ROperator_BatchNormalization.hxx"
+#include "TMVA/ROperator_Relu.hxx"
 
 #include <memory>
 #include <sstream>
@@ -11,6 +13,7 @@
 #include <stdexcept>
 #include <vector>
 #include <cassert>
+#include <cmath>
 
 namespace TMVA {
 namespace Experimental {
@@ -41,6 +44,7 @@ private:
    std::string fType;
 
    size_t fDim;   // dimension of the convolution
+   bool fFusedRelu = false; // apply a Relu on the output, from a fused Relu operator
 
 
 public:
@@ -80,6 +84,69 @@ public:
       }
    }
 
+   std::vector<std::string> GetOpInputTensors() const { return {fNX, fNW, fNB}; }
+   std::vector<std::string> GetOpOutputTensors() const { return {fNY}; }
+
+   bool Fuse(ROperator & next, RModel & model) {
+      if (fFusedRelu) return false;
+      // a following Relu is computed in place on the convolution output
+      if (dynamic_cast<ROperator_Relu<T> *>(&next)) {
+         fNY = next.GetOpOutputTensors()[0];
+         fFusedRelu = true;
+         return true;
+      }
+      if (auto bn = dynamic_cast<ROperator_BatchNormalization<T> *>(&next))
+         return FuseBatchNormalization(*bn, model);
+      return false;
+   }
+
+   // fold an inference batch normalization in the weights and the bias of the convolution:
+   // W' = W * s and B' = (B - mean) * s + beta per output channel, with s = scale / sqrt(var + epsilon)
+   bool FuseBatchNormalization(const ROperator_BatchNormalization<T> & bn, RModel & model) {
+      if (fType != "float") return false;
+      auto bnInputs = bn.GetOpInputTensors();  // X, scale, B, mean, var
+      if (!model.IsInitializedTensor(fNW) || (!fNB.empty() && !model.IsInitializedTensor(fNB)))
+         return false;
+      std::vector<size_t> shapeW = model.GetTensorShape(fNW);
+      if (shapeW.empty() || model.GetTensorType(fNW) != ETensorType::FLOAT) return false;
+      size_t nChannels = shapeW[0];
+      for (size_t i = 1; i < bnInputs.size(); i++) {
+         if (!model.IsInitializedTensor(bnInputs[i]) || model.GetTensorType(bnInputs[i]) != ETensorType::FLOAT ||
+             ConvertShapeToLength(model.GetTensorShape(bnInputs[i])) != nChannels)
+            return false;
+      }
+      if (!fNB.empty() && ConvertShapeToLength(model.GetTensorShape(fNB)) != nChannels) return false;
+
+      const float *scale = static_cast<float *>(model.GetInitializedTensorData(bnInputs[1]).get());
+      const float *beta = static_cast<float *>(model.GetInitializedTensorData(bnInputs[2]).get());
+      const float *mean = static_cast<float *>(model.GetInitializedTensorData(bnInputs[3]).get());
+      const float *var = static_cast<float *>(model.GetInitializedTensorData(bnInputs[4]).get());
+      const float *w = static_cast<float *>(model.GetInitializedTensorData(fNW).get());
+      const float *b = fNB.empty() ? nullptr : static_cast<float *>(model.GetInitializedTensorData(fNB).get());
+
+      size_t lengthW = ConvertShapeToLength(shapeW);
+      size_t channelSize = lengthW / nChannels;
+      float *newW = new float[lengthW];
+      float *newB = new float[nChannels];
+      for (size_t c = 0; c < nChannels; c++) {
+         float s = scale[c] / std::sqrt(var[c] + bn.GetEpsilon());
+         for (size_t j = 0; j < channelSize; j++)
+            newW[c * channelSize + j] = w[c * channelSize + j] * s;
+         newB[c] = ((b ? b[c] : 0.f) - mean[c]) * s + beta[c];
+      }
+      model.UpdateInitializedTensor(fNW, ETensorType::FLOAT, shapeW,
+                                    std::shared_ptr<void>(newW, std::default_delete<float[]>()));
+      std::shared_ptr<void> newBPtr(newB, std::default_delete<float[]>());
+      if (fNB.empty()) {
+         fNB = fNY + "_bias";
+         model.AddInitializedTensor(fNB, ETensorType::FLOAT, {nChannels}, newBPtr);
+      } else {
+         model.UpdateInitializedTensor(fNB, ETensorType::FLOAT, model.GetTensorShape(fNB), newBPtr);
+      }
+      fNY = bn.GetOpOutputTensors()[0];
+      return true;
+   }
+
    std::vector<ETensorType> TypeInference(std::vector<ETensorType> input) {
       ETensorType out = input[0];
       return {out};
@@ -392,6 +459,10 @@ public:
       assert(fShapeW[1] == fShapeX[1] / fAttrGroup);
       out << SP << "int " << OpName << "_n = " << fShapeW[0] << ";\n"; // output channels
       out << SP << "int " << OpName << "_k = " << fShapeW[1] * fAttrKernelShape[0] * fAttrKernelShape[1] * fAttrKernelShape[2] << ";\n";
+      // for small convolutions the matrix multiplication is generated inline instead of calling BLAS
+      size_t oSize = oHeight * oWidth * oDepth;
+      size_t kSize = fShapeW[1] * fAttrKernelShape[0] * fAttrKernelShape[1] * fAttrKernelShape[2];
+      bool useInlineGemm = fShapeW[0] / fAttrGroup * oSize * kSize <= UTILITY::kMaxInlineGemmSize;
       out << SP << "float " << OpName << "_alpha = 1.0;\n";
       out << SP << "float " << OpName << "_beta = 0.0;\n";
 
@@ -473,11 +544,17 @@ public:
                 << OpName << "_xcol);\n\n ";
          }
          // BLAS
-         out << SP << SP << "BLAS::sgemm_(&" << OpName << "_transA, &" << OpName << "_transB, &" << OpName << "_m, &"
-             << OpName << "_n, &" << OpName << "_k, &" << OpName << "_alpha, " << OpName << "_xcol, &" << OpName
-             << "_m,\n"; // use m if op_xcol is not transpose , otherwise k
-         out << SP << SP << SP << OpName << "_f, &" << OpName << "_k, &" << OpName << "_beta, tensor_" << fNY
-             << " + out_offset, &" << OpName << "_m);\n";
+         if (useInlineGemm) {
+            // row-major output (output channels x output size) = filters x unrolled input
+            out << UTILITY::GenerateGemmKernel(fShapeW[0], oSize, kSize, false, false, 1., 0., OpName + "_f",
+                                               OpName + "_xcol", "(tensor_" + fNY + " + out_offset)", SP + SP);
+         } else {
+            out << SP << SP << "BLAS::sgemm_(&" << OpName << "_transA, &" << OpName << "_transB, &" << OpName << "_m, &"
+                << OpName << "_n, &" << OpName << "_k, &" << OpName << "_alpha, " << OpName << "_xcol, &" << OpName
+                << "_m,\n"; // use m if op_xcol is not transpose , otherwise k
+            out << SP << SP << SP << OpName << "_f, &" << OpName << "_k, &" << OpName << "_beta, tensor_" << fNY
+                << " + out_offset, &" << OpName << "_m);\n";
+         }
       } else {
          // case of group convolution
          // Unroll (IM2COL) the input tensor- make loop on groups and repeat operations (IM2COL + GEMM for each
@@ -525,12 +602,18 @@ public:
          out << SP << SP << SP << "size_t offset_f = g * "
              << fShapeW[0] * fShapeW[1] * fAttrKernelShape[0] * fAttrKernelShape[1] * fAttrKernelShape[2] / fAttrGroup 
              << ";\n";
-         out << SP << SP << "BLAS::sgemm_(&" << OpName << "_transA, &" << OpName << "_transB, &" << OpName << "_m, &"
-             << OpName << "_n, &" << OpName << "_k, &" << OpName << "_alpha, " << OpName << "_xcol, &" << OpName
-             << "_m,\n"; // use m if op_xcol is not transpose , otherwise k
-         out << SP << SP << SP << OpName << "_f + offset_f, &" << OpName << "_k, &" << OpName << "_beta, tensor_" << fNY
-             << " + out_offset"
-             << ", &" << OpName << "_m);\n";
+         if (useInlineGemm) {
+            out << UTILITY::GenerateGemmKernel(fShapeW[0] / fAttrGroup, oSize, kSize, false, false, 1., 0.,
+                                               "(" + OpName + "_f + offset_f)", OpName + "_xcol",
+                                               "(tensor_" + fNY + " + out_offset)", SP + SP);
+         } else {
+            out << SP << SP << "BLAS::sgemm_(&" << OpName << "_transA, &" << OpName << "_transB, &" << OpName << "_m, &"
+                << OpName << "_n, &" << OpName << "_k, &" << OpName << "_alpha, " << OpName << "_xcol, &" << OpName
+                << "_m,\n"; // use m if op_xcol is not transpose , otherwise k
+            out << SP << SP << SP << OpName << "_f + offset_f, &" << OpName << "_k, &" << OpName << "_beta, tensor_" << fNY
+                << " + out_offset"
+                << ", &" << OpName << "_m);\n";
+         }
 
          out << SP << SP << "}\n"; // end of group loop
       }
@@ -549,6 +632,12 @@ public:
 
       }
 
+      if (fFusedRelu) {
+         out << SP << "for (int id = 0; id < " << ConvertShapeToLength(fShapeY) << " ; id++){\n";
+         out << SP << SP << "tensor_" << fNY << "[id] = ((tensor_" << fNY << "[id] > 0 )? tensor_" << fNY << "[id] : 0);\n";
+         out << SP << "}\n";
+      }
+
       
       return out.str();
       }
@@ -5,6 +5,7 @@
 #include "TMVA/SOFIE_common.hxx"
 #include "TMVA/ROperator.hxx"
 #include "TMVA/RModel.hxx"
+#include "TMVA/ROperator_Relu.hxx"
 
 #include <sstream>
 #include <algorithm>
@@ -39,6 +40,7 @@ namespace SOFIE{
       std::vector<size_t> fShapeY;
 
       std::string fType;
+      bool fFusedRelu = false; // apply a Relu on the output, from a fused Relu operator
 
    public:
 
@@ -65,6 +67,17 @@ namespace SOFIE{
          }
       }
 
+      std::vector<std::string> GetOpInputTensors() const { return {fNA, fNB, fNC}; }
+      std::vector<std::string> GetOpOutputTensors() const { return {fNY}; }
+
+      bool Fuse(ROperator & next, RModel & /*model*/){
+         // a following Relu is computed in place on the Gemm output
+         if (fFusedRelu || dynamic_cast<ROperator_Relu<T> *>(&next) == nullptr) return false;
+         fNY = next.GetOpOutputTensors()[0];
+         fFusedRelu = true;
+         return true;
+      }
+
       std::vector<ETensorType> TypeInference(std::vector<ETensorType> input){
          ETensorType out = input[0];
          return {out};
@@ -211,12 +224,21 @@ namespace SOFIE{
                assert(length == ConvertShapeToLength(fShapeC));
             out << SP << "std::copy(" << "tensor_" << fNC2 << ", " << "tensor_" << fNC2 << " + " << length << ", " << "tensor_" << fNY << ");\n";
          }
-         if (fType == "float"){
+         if (fType == "float" && static_cast<size_t>(m) * n * k <= UTILITY::kMaxInlineGemmSize) {
+            // small matrices: the beta term is needed only for the bias copied in the output
+            out << UTILITY::GenerateGemmKernel(m, n, k, fAttrTransA, fAttrTransB, fAttrAlpha, (fNC != "") ? fAttrBeta : 0,
+                                               "tensor_" + fNA, "tensor_" + fNB, "tensor_" + fNY, SP);
+         } else if (fType == "float"){
             out << SP << "BLAS::sgemm_(&" << OpName << "_transB, &" << OpName << "_transA, &" << OpName
              << "_n, &" << OpName << "_m, &" << OpName << "_k, &" << OpName << "_alpha, " << "tensor_" << fNB
              << ", &" << OpName << "_ldb, " << "tensor_" << fNA << ", &" << OpName << "_lda, &" << OpName << "_beta, " << "tensor_" << fNY << ", &"
              << OpName << "_n);\n";
           }
+          if (fFusedRelu){
+            out << SP << "for (int id = 0; id < " << ConvertShapeToLength(fShapeY) << " ; id++){\n";
+            out << SP << SP << "tensor_" << fNY << "[id] = ((tensor_" << fNY << "[id] > 0 )? tensor_" << fNY << "[id] : 0);\n";
+            out << SP << "}\n";
+          }
 
           return out.str();
 
@@ -111,6 +111,9 @@ template <typename T> class ROperator_LSTM final : public ROperator {
       }
    }
 
+   std::vector<std::string> GetOpInputTensors() const { return {fNX, fNW, fNR, fNB, fNSequence_lens, fNInitial_h, fNInitial_c, fNP}; }
+   std::vector<std::string> GetOpOutputTensors() const { return {fNY, fNY_h, fNY_c}; }
+
    /*! \brief Infers the type of the output tensors
     *
     * \param input type of the input tensors
@@ -38,6 +38,9 @@ public:
 		}
    }
 
+   std::vector<std::string> GetOpInputTensors() const { return {fNX}; }
+   std::vector<std::string> GetOpOutputTensors() const { return {fNY}; }
+
    std::vector<ETensorType> TypeInference(std::vector<ETensorType> input){
       return input;
    }
@@ -56,6 +59,8 @@ public:
    }
 
 
+   bool SupportsInPlace() const { return true; }
+
    std::string Generate(std::string OpName){
       OpName = "op_" + OpName;
       if (fShape.empty()) {
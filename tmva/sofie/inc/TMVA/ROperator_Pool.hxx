@@ -83,6 +83,9 @@ public:
    }
 
    // return input type (defined abstract in ROperator class )
+   std::vector<std::string> GetOpInputTensors() const { return {fNX}; }
+   std::vector<std::string> GetOpOutputTensors() const { return {fNY}; }
+
    std::vector<ETensorType> TypeInference(std::vector<ETensorType> input) {
       // only one input in Pool operators
       return input;
@@ -96,6 +96,9 @@ template <typename T> class ROperator_RNN final : public ROperator {
       }
    }
 
+   std::vector<std::string> GetOpInputTensors() const { return {fNX, fNW, fNR, fNB, fNSequence_lens, fNInitial_h}; }
+   std::vector<std::string> GetOpOutputTensors() const { return {fNY, fNY_h}; }
+
    /*! \brief Infers the type of the output tensors
     *
     * \param input type of the input tensors
@@ -26,6 +26,9 @@ public:
    ROperator_Relu(std::string nameX, std::string nameY):
       fNX(UTILITY::Clean_name(nameX)), fNY(UTILITY::Clean_name(nameY)){}
 
+   std::vector<std::string> GetOpInputTensors() const { return {fNX}; }
+   std::vector<std::string> GetOpOutputTensors() const { return {fNY}; }
+
    std::vector<ETensorType> TypeInference(std::vector<ETensorType> input){
       return input;
    }
@@ -44,6 +47,8 @@ public:
    }
 
 
+   bool SupportsInPlace() const { return true; }
+
    std::string Generate(std::string OpName){
       OpName = "op_" + OpName;
       if (fShape.empty()) {
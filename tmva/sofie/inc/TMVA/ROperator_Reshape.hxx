@@ -52,6 +52,9 @@ public:
    }
 
    // output type is same as input
+   std::vector<std::string> GetOpInputTensors() const { return {fNData, fNShape}; }
+   std::vector<std::string> GetOpOutputTensors() const { return {fNOutput}; }
+
    std::vector<ETensorType> TypeInference(std::vector<ETensorType> input){
       auto ret = std::vector<ETensorType>(1, input[0]);
       return ret;
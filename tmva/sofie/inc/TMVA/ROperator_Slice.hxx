@@ -63,6 +63,14 @@ public:
      fAttributes.push_back(axes); 
     }
 
+   std::vector<std::string> GetOpInputTensors() const {
+      std::vector<std::string> ret{fNData};
+      ret.insert(ret.end(), fNames.begin(), fNames.end());
+      return ret;
+   }
+
+   std::vector<std::string> GetOpOutputTensors() const { return {fNOutput}; }
+
    // output type is same as input 
    std::vector<ETensorType> TypeInference(std::vector<ETensorType> input){
       auto ret = std::vector<ETensorType>(1, input[0]);
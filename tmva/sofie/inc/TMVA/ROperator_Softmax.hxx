@@ -26,6 +26,9 @@
     ROperator_Softmax(std::string nameX, std::string nameY):
        fNX(UTILITY::Clean_name(nameX)), fNY(UTILITY::Clean_name(nameY)){}
 
+    std::vector<std::string> GetOpInputTensors() const { return {fNX}; }
+    std::vector<std::string> GetOpOutputTensors() const { return {fNY}; }
+
     std::vector<ETensorType> TypeInference(std::vector<ETensorType> input){
        return input;
     }
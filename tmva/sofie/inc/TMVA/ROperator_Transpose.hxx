@@ -38,6 +38,9 @@ public:
       fNData(UTILITY::Clean_name(nameData)), fNOutput(UTILITY::Clean_name(nameOutput)) {
    }
 
+   std::vector<std::string> GetOpInputTensors() const { return {fNData}; }
+   std::vector<std::string> GetOpOutputTensors() const { return {fNOutput}; }
+
    std::vector<ETensorType> TypeInference(std::vector<ETensorType> input){
       return input;
    }
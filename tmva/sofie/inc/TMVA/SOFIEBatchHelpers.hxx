@@ -0,0 +1,141 @@
+#ifndef TMVA_SOFIE_SOFIE_BATCH_HELPERS
+#define TMVA_SOFIE_SOFIE_BATCH_HELPERS
+
+#include <ROOT/RDF/RActionImpl.hxx>
+#include <RtypesCore.h>
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+class TTreeReader;
+
+namespace TMVA{
+namespace Experimental{
+
+/// RDataFrame action helper evaluating a model generated by SOFIE on batches of entries.
+///
+/// Calling the generated `infer()` once per entry, as the SofieFunctor does, makes the BLAS calls
+/// of the generated code work on a single event. This helper instead collects in each slot the input
+/// values of `batchSize` entries and evaluates them with a single call to `infer()`, which requires
+/// a model generated with the same batch size, e.g. with `model.Generate(Options::kDefault, batchSize)`.
+/// The last incomplete batch of each slot is padded with zeros.
+///
+/// The helper is booked as an action, where the first column must be the entry number `rdfentry_`
+/// followed by the input columns. The result contains the model outputs of all the processed entries,
+/// ordered by entry number, with a fixed number of outputs per entry:
+/// ```
+///    auto nslots = df.GetNSlots();
+///    auto dnnOutput = df.Book<ULong64_t, float, float, float>(
+///       TMVA::Experimental::SofieBatchHelper<TMVA_SOFIE_Model::Session>(256, nslots),
+///       {"rdfentry_", "x1", "x2", "x3"});
+/// ```
+/// Since the outputs are known only once a batch is complete, they are not available as a column of the
+/// same event loop, but they can be used in a following one, e.g. by indexing the result with the
+/// entry number when no filters are applied.
+template <typename Session_t, typename T = float>
+class SofieBatchHelper : public ROOT::Detail::RDF::RActionImpl<SofieBatchHelper<Session_t, T>> {
+public:
+   using Result_t = std::vector<T>;
+
+private:
+   std::shared_ptr<Result_t> fResult;
+   std::size_t fBatchSize;
+   std::vector<Session_t> fSessions;                       // one session per slot
+   std::vector<std::vector<T>> fInputs;                    // input values of the current batch per slot
+   std::vector<std::vector<ULong64_t>> fBatchEntries;      // entry numbers of the current batch per slot
+   std::vector<std::vector<ULong64_t>> fEntries;           // entry numbers of the evaluated entries per slot
+   std::vector<std::vector<T>> fOutputs;                   // model outputs of the evaluated entries per slot
+   std::vector<std::size_t> fNOutputs;                     // number of model outputs per entry, per slot
+
+   void EvaluateBatch(unsigned int slot)
+   {
+      auto &entries = fBatchEntries[slot];
+      if (entries.empty())
+         return;
+      auto &input = fInputs[slot];
+      const std::size_t nInputs = input.size() / entries.size();
+      input.resize(fBatchSize * nInputs, T(0));
+      auto y = fSessions[slot].infer(input.data());
+      if (y.size() % fBatchSize != 0)
+         throw std::runtime_error("SofieBatchHelper: the model output size " + std::to_string(y.size()) +
+                                  " is not a multiple of the batch size " + std::to_string(fBatchSize));
+      fNOutputs[slot] = y.size() / fBatchSize;
+      fOutputs[slot].insert(fOutputs[slot].end(), y.begin(), y.begin() + entries.size() * fNOutputs[slot]);
+      fEntries[slot].insert(fEntries[slot].end(), entries.begin(), entries.end());
+      entries.clear();
+      input.clear();
+   }
+
+public:
+   /// Create the helper for models generated with the given batch size. One session is created per slot,
+   /// hence `nslots` should be the number of slots of the RDataFrame.
+   SofieBatchHelper(std::size_t batchSize, unsigned int nslots = 1, const std::string &filename = "")
+      : fResult(std::make_shared<Result_t>()), fBatchSize(batchSize)
+   {
+      if (fBatchSize < 1)
+         throw std::invalid_argument("SofieBatchHelper: invalid batch size 0");
+      if (nslots < 1)
+         nslots = 1;
+      fSessions.reserve(nslots);
+      for (unsigned int i = 0; i < nslots; i++) {
+         fSessions.emplace_back(filename);
+      }
+      fInputs.resize(nslots);
+      fBatchEntries.resize(nslots);
+      fEntries.resize(nslots);
+      fOutputs.resize(nslots);
+      fNOutputs.resize(nslots, 0);
+   }
+
+   SofieBatchHelper(SofieBatchHelper &&) = default;
+   SofieBatchHelper(const SofieBatchHelper &) = delete;
+
+   std::shared_ptr<Result_t> GetResultPtr() const { return fResult; }
+   void Initialize() {}
+   void InitTask(TTreeReader *, unsigned int) {}
+   std::string GetActionName() { return "SofieBatchHelper"; }
+
+   template <typename... ColumnTypes>
+   void Exec(unsigned int slot, ULong64_t entry, ColumnTypes... values)
+   {
+      auto &input = fInputs[slot];
+      for (auto &&val : {static_cast<T>(values)...}) {
+         input.push_back(val);
+      }
+      fBatchEntries[slot].push_back(entry);
+      if (fBatchEntries[slot].size() == fBatchSize)
+         EvaluateBatch(slot);
+   }
+
+   /// Evaluate the last batches and merge the outputs of all the slots, ordered by entry number.
+   void Finalize()
+   {
+      std::vector<std::pair<ULong64_t, const T *>> outputs;
+      std::size_t nOutputs = 0;
+      for (unsigned int slot = 0; slot < fSessions.size(); slot++) {
+         EvaluateBatch(slot);
+         if (!fEntries[slot].empty())
+            nOutputs = fNOutputs[slot];
+         for (std::size_t i = 0; i < fEntries[slot].size(); i++) {
+            outputs.emplace_back(fEntries[slot][i], fOutputs[slot].data() + i * nOutputs);
+         }
+      }
+      std::sort(outputs.begin(), outputs.end(),
+                [](const std::pair<ULong64_t, const T *> &a, const std::pair<ULong64_t, const T *> &b) {
+                   return a.first < b.first;
+                });
+      fResult->reserve(outputs.size() * nOutputs);
+      for (auto &out : outputs) {
+         fResult->insert(fResult->end(), out.second, out.second + nOutputs);
+      }
+   }
+};
+
+}//Experimental
+}//TMVA
+
+#endif //TMVA_SOFIE_SOFIE_BATCH_HELPERS
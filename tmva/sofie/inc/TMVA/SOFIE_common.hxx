@@ -111,12 +111,42 @@ std::string Clean_name(std::string input_tensor_name);
 /// compute stride of a tensor given its shape (assume layout is row-major)
 std::vector<size_t> ComputeStrideFromShape(const std::vector<size_t> & shape);
 
+/// matrix multiplications with m * n * k up to this value are generated as inline loops instead of BLAS calls,
+/// since for small matrices the overhead of the BLAS call and of the packing of the matrices dominates
+constexpr size_t kMaxInlineGemmSize = 32768;
+
+/// generate the code computing the row-major matrix product y = alpha * op(a) * op(b) + beta * y of sizes
+/// known at generation time, where op(a) is m x k and op(b) is k x n. The columns of y are computed in blocks
+/// whose partial sums are kept in registers. The code does not depend on BLAS
+std::string GenerateGemmKernel(size_t m, size_t n, size_t k, bool transA, bool transB, float alpha, float beta,
+                               const std::string & a, const std::string & b, const std::string & y,
+                               const std::string & indent);
+
 /// function to check if a >> 0 and a < MAX using a single comparison
 //// use trick casting to unsigned values so it becomes a single comparison
 inline bool is_a_ge_zero_and_a_lt_b(int a, int b) {
    return static_cast<unsigned>(a) < static_cast<unsigned>(b);
 }
 
+/// convert a float to the bit pattern of the nearest bfloat16 (the 16 most significant bits of the float),
+/// rounding to nearest even
+inline std::uint16_t FloatToBF16(float x) {
+   std::uint32_t bits;
+   std::memcpy(&bits, &x, sizeof(bits));
+   if ((bits & 0x7fffffff) > 0x7f800000)
+      return static_cast<std::uint16_t>((bits >> 16) | 0x40); // keep NaN quiet
+   bits += 0x7fff + ((bits >> 16) & 1);
+   return static_cast<std::uint16_t>(bits >> 16);
+}
+
+/// convert the bit pattern of a bfloat16 to a float
+inline float BF16ToFloat(std::uint16_t x) {
+   std::uint32_t bits = static_cast<std::uint32_t>(x) << 16;
+   float f;
+   std::memcpy(&f, &bits, sizeof(f));
+   return f;
+}
+
 
 /// im2col : efficient function to re-arrange input data of convolution to a matrix
 /// that can be used by BLAS
@@ -1,12 +1,41 @@
 #include <limits>
 #include <algorithm>
 #include <cctype>
+#include <map>
 
 #include "TMVA/RModel.hxx"
 
 
 
 
+namespace {
+
+   // find the names of the tensors that are used in a piece of generated code, where they are always
+   // referred to as tensor_<name>. A tensor that is used in another way than by indexing its elements,
+   // like assigning the pointer or calling member functions, is reported as aliased.
+   void FindUsedTensors(const std::string &code, std::set<std::string> &used, bool &aliased)
+   {
+      const std::string prefix = "tensor_";
+      auto isIdChar = [](char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '_'; };
+      for (std::size_t pos = code.find(prefix); pos != std::string::npos; pos = code.find(prefix, pos)) {
+         if (pos > 0 && isIdChar(code[pos - 1])) {
+            pos += prefix.size();
+            continue;
+         }
+         std::size_t end = pos + prefix.size();
+         while (end < code.size() && isIdChar(code[end])) ++end;
+         used.insert(code.substr(pos + prefix.size(), end - pos - prefix.size()));
+         std::size_t next = code.find_first_not_of(" \t", end);
+         if (next != std::string::npos && (code[next] == '.' ||
+               (code[next] == '=' && (next + 1 == code.size() || code[next + 1] != '=')))) {
+            aliased = true;
+         }
+         pos = end;
+      }
+   }
+
+}
+
 namespace TMVA{
 namespace Experimental{
 namespace SOFIE{
@@ -179,6 +208,45 @@ namespace SOFIE{
       }
    }
 
+   // Merge an operator into the preceding one when the operator is the only consumer of its output,
+   // e.g. a Relu following a Gemm or a Conv, or a BatchNormalization following a Conv, whose
+   // parameters are then folded in the convolution weights. This saves the intermediate tensor
+   // and a loop over it per fused operator. It must be called before the operators are initialized
+   void RModel::FuseOperators(){
+      std::map<std::string, size_t> nConsumers;
+      for (auto& op : fOperators){
+         auto inputs = op->GetOpInputTensors();
+         // the tensors of this operator are not known: we cannot prove that a fusion is safe
+         if (inputs.empty()) return;
+         for (auto& name : inputs){
+            if (!name.empty()) nConsumers[name]++;
+         }
+      }
+      // the initialized tensors can be modified by the fusion, e.g. when folding a batch normalization,
+      // hence they must not be shared with other operators
+      auto initializedTensorsNotShared = [&](const ROperator & op){
+         for (auto& name : op.GetOpInputTensors()){
+            if (IsInitializedTensor(name) && nConsumers[name] != 1) return false;
+         }
+         return true;
+      };
+      size_t id = 0;
+      while (id + 1 < fOperators.size()){
+         auto outputs = fOperators[id]->GetOpOutputTensors();
+         auto nextInputs = fOperators[id + 1]->GetOpInputTensors();
+         bool canFuse = outputs.size() == 1 && !nextInputs.empty() && nextInputs[0] == outputs[0] &&
+                        nConsumers[outputs[0]] == 1 &&
+                        std::find(fOutputTensorNames.begin(), fOutputTensorNames.end(), outputs[0]) == fOutputTensorNames.end() &&
+                        initializedTensorsNotShared(*fOperators[id]) && initializedTensorsNotShared(*fOperators[id + 1]);
+         if (canFuse && fOperators[id]->Fuse(*fOperators[id + 1], *this)){
+            // the fused operator can absorb the following one again, e.g. Conv + BatchNormalization + Relu
+            fOperators.erase(fOperators.begin() + id + 1);
+         } else {
+            id++;
+         }
+      }
+   }
+
    void RModel::Initialize(int batchSize){
       // check if there are only parametrized input tensor and convert in
       // ready input tensor according to batch size
@@ -199,6 +267,7 @@ namespace SOFIE{
          }
       }
 
+      FuseOperators();
 
       for (auto& i : fOperators){
          //std::cout << "initialize operator  " << typeid(*i).name() << std::endl;
@@ -212,6 +281,8 @@ namespace SOFIE{
          fUseSession = false;
       if (static_cast<std::underlying_type_t<Options>>(Options::kNoWeightFile) & options)
          fUseWeightFile = false;
+      if (static_cast<std::underlying_type_t<Options>>(Options::kBF16Weights) & options)
+         fUseBF16Weights = true;
       Initialize(batchSize);
       fGC += ("//Code generated automatically by TMVA for Inference of Model file [" + fFileName + "] at [" + fParseTime.substr(0, fParseTime.length()-1) +"] \n");
       // add header guards
@@ -249,6 +320,25 @@ namespace SOFIE{
          }
          fGC += ("}//BLAS\n");
       }
+      // generate the code of the operators before the declarations of the intermediate tensors, which
+      // depend on where the tensors are used
+      std::string sessionMembersCode;
+      std::string initCode;
+      std::vector<std::string> operatorCode(fOperators.size());
+      if (fUseSession) {
+         for (size_t id = 0; id < fOperators.size(); id++) {
+            sessionMembersCode += fOperators[id]->GenerateSessionMembersCode(std::to_string(id));
+         }
+         for (size_t id = 0; id < fOperators.size(); id++) {
+            initCode += fOperators[id]->GenerateInitCode();
+         }
+      }
+      for (size_t id = 0; id < fOperators.size(); id++) {
+         operatorCode[id] = fOperators[id]->Generate(std::to_string(id));
+      }
+      size_t poolSize = 0;
+      auto poolOffsets = PlanIntermediateMemory(operatorCode, sessionMembersCode + initCode, poolSize);
+
       if (fUseSession) {
          fGC += "struct Session {\n";
       }
@@ -276,8 +366,16 @@ namespace SOFIE{
 
          }
       }
+      if (poolSize > 0) {
+         fGC += "std::vector<float> fIntermediateMemoryPool = std::vector<float>(" + std::to_string(poolSize) + ");\n";
+      }
       for (auto&i: fIntermediateTensorInfos){
          if (i.second.type == ETensorType::FLOAT){
+            auto offset = poolOffsets.find(i.first);
+            if (offset != poolOffsets.end()) {
+               fGC += "float * tensor_" + i.first + " = fIntermediateMemoryPool.data() + " + std::to_string(offset->second) + ";\n";
+               continue;
+            }
             size_t length = 1;
             for (auto & dim: i.second.shape){
                length *= dim;
@@ -290,10 +388,7 @@ namespace SOFIE{
       if (fUseSession) {
          // add here specific operator code that needs to define session data members
          fGC += "\n";
-         for (size_t id = 0; id < fOperators.size(); id++) {
-            std::string opName = std::to_string(id);
-            fGC += fOperators[id]->GenerateSessionMembersCode(opName);
-         }
+         fGC += sessionMembersCode;
          fGC += "\n";
          fGC += "Session(std::string filename =\"\") {\n";
          // here add initialization and reading of weight tensors
@@ -303,9 +398,7 @@ namespace SOFIE{
             //fUseWeightFile = fUseWeightFile;
          }
          // add here initialization code
-         for (size_t id = 0; id < fOperators.size() ; id++){
-            fGC += fOperators[id]->GenerateInitCode();
-         }
+         fGC += initCode;
          fGC += "}\n\n";
       }
 
@@ -350,8 +443,8 @@ namespace SOFIE{
       fGC.pop_back(); //remove last ","
       fGC += "){\n";
 
-      for (size_t id = 0; id < fOperators.size() ; id++){
-         fGC+= (fOperators[id]->Generate(std::to_string(id)));
+      for (auto &code : operatorCode){
+         fGC += code;
       }
       if (outputSize == 1) {
          size_t outputLength = ConvertShapeToLength(GetTensorShape(fOutputTensorNames[0]));
@@ -391,6 +484,96 @@ namespace SOFIE{
       fGC += "\n#endif  // " + hgname + "\n";
    }
 
+   std::map<std::string, size_t> RModel::PlanIntermediateMemory(const std::vector<std::string> &operatorCode,
+                                                                const std::string &sessionCode, size_t &poolSize) {
+      // Place the intermediate float tensors in one memory pool, where tensors whose lifetimes don't
+      // overlap share the same memory. The lifetime of a tensor goes from the first to the last operator
+      // using it. The outputs, the tensors used in the session constructor or members and the tensors of
+      // operators that alias them keep their own memory.
+      std::set<std::string> excluded(fOutputTensorNames.begin(), fOutputTensorNames.end());
+      bool aliased = false;
+      FindUsedTensors(sessionCode, excluded, aliased);
+      std::vector<std::set<std::string>> used(operatorCode.size());
+      for (size_t id = 0; id < operatorCode.size(); id++) {
+         aliased = false;
+         FindUsedTensors(operatorCode[id], used[id], aliased);
+         if (aliased) excluded.insert(used[id].begin(), used[id].end());
+      }
+
+      std::map<std::string, std::pair<size_t, size_t>> lifetimes;
+      for (size_t id = 0; id < used.size(); id++) {
+         for (auto &name : used[id]) {
+            auto info = fIntermediateTensorInfos.find(name);
+            if (info == fIntermediateTensorInfos.end() || info->second.type != ETensorType::FLOAT || excluded.count(name) > 0)
+               continue;
+            auto lifetime = lifetimes.emplace(name, std::make_pair(id, id)).first;
+            lifetime->second.second = id;
+         }
+      }
+
+      // Assign the tensors to slots of the pool in order of execution. A slot is free once the last operator
+      // using its tensor was executed. The smallest free slot that is large enough is taken, otherwise the
+      // largest free slot is grown. The output of an in-place operator takes the slot of an input that is
+      // not used anymore.
+      struct Slot {
+         size_t length;
+         size_t lastUse;
+      };
+      std::vector<Slot> slots;
+      std::map<std::string, size_t> tensorSlots;
+      for (size_t id = 0; id < used.size(); id++) {
+         std::vector<std::string> defined;
+         for (auto &name : used[id]) {
+            auto lifetime = lifetimes.find(name);
+            if (lifetime != lifetimes.end() && lifetime->second.first == id) defined.push_back(name);
+         }
+         for (auto &name : defined) {
+            size_t length = ConvertShapeToLength(fIntermediateTensorInfos[name].shape);
+            size_t chosen = slots.size();
+            if (defined.size() == 1 && fOperators[id]->SupportsInPlace()) {
+               for (auto &input : used[id]) {
+                  auto lifetime = lifetimes.find(input);
+                  if (lifetime == lifetimes.end() || lifetime->second.first == id || lifetime->second.second != id)
+                     continue;
+                  size_t slot = tensorSlots[input];
+                  if (slots[slot].length >= length) {
+                     chosen = slot;
+                     break;
+                  }
+               }
+            }
+            if (chosen == slots.size()) {
+               size_t bestFit = slots.size();
+               size_t largest = slots.size();
+               for (size_t slot = 0; slot < slots.size(); slot++) {
+                  if (slots[slot].lastUse >= id) continue;
+                  if (slots[slot].length >= length && (bestFit == slots.size() || slots[slot].length < slots[bestFit].length))
+                     bestFit = slot;
+                  if (largest == slots.size() || slots[slot].length > slots[largest].length)
+                     largest = slot;
+               }
+               chosen = (bestFit != slots.size()) ? bestFit : largest;
+               if (chosen == slots.size()) slots.push_back({0, 0});
+            }
+            slots[chosen].length = std::max(slots[chosen].length, length);
+            slots[chosen].lastUse = lifetimes[name].second;
+            tensorSlots[name] = chosen;
+         }
+      }
+
+      std::vector<size_t> slotOffsets(slots.size());
+      poolSize = 0;
+      for (size_t slot = 0; slot < slots.size(); slot++) {
+         slotOffsets[slot] = poolSize;
+         poolSize += slots[slot].length;
+      }
+      std::map<std::string, size_t> offsets;
+      for (auto &tensorSlot : tensorSlots) {
+         offsets[tensorSlot.first] = slotOffsets[tensorSlot.second];
+      }
+      return offsets;
+   }
+
    void RModel::ReadInitializedTensorsFromFile() {
       // generate the code to read initialized tensors from a text data file
       if (fInitializedTensors.empty()) return;
@@ -402,6 +585,8 @@ namespace SOFIE{
       fGC += "   }\n";
       fGC += "   std::string tensor_name;\n";
       fGC += "   int length;\n";
+      if (fUseBF16Weights)
+         fGC += "   std::uint16_t bf16;\n";
 
       //loop on tensors and parse the file
       for (auto& i: fInitializedTensors){
@@ -423,8 +608,15 @@ namespace SOFIE{
                    slength + " , read \" + std::to_string(length) ;\n";
             fGC += "      throw std::runtime_error(err_msg);\n";
             fGC += "    }\n";
-            fGC += "    for (int i =0; i < length; ++i) \n";
-            fGC += "       f >> " + tensor_name + "[i];\n";
+            if (fUseBF16Weights) {
+               fGC += "    for (int i =0; i < length; ++i) {\n";
+               fGC += "       f >> std::hex >> bf16 >> std::dec;\n";
+               fGC += "       " + tensor_name + "[i] = TMVA::Experimental::SOFIE::UTILITY::BF16ToFloat(bf16);\n";
+               fGC += "    }\n";
+            } else {
+               fGC += "    for (int i =0; i < length; ++i) \n";
+               fGC += "       f >> " + tensor_name + "[i];\n";
+            }
          }
       }
       fGC += "   f.close();\n";
@@ -450,6 +642,15 @@ namespace SOFIE{
             std::string tensor_name = "tensor_" + i.first;
             f << tensor_name << " " << length << "\n";
             const float * data = (std::static_pointer_cast<float>(i.second.fData)).get();
+            if (fUseBF16Weights) {
+               // the weights are written as the hexadecimal bit patterns of the rounded bfloat16 values
+               f << std::hex;
+               for (size_t idx = 0; idx < length; idx++) {
+                  f << UTILITY::FloatToBF16(data[idx]) << ((idx < length - 1) ? " " : "\n");
+               }
+               f << std::dec;
+               continue;
+            }
             for (size_t idx = 0; idx < length - 1; idx++) {
                f << std::setprecision(std::numeric_limits<float>::max_digits10) << data[idx] << " ";
             }
@@ -1,5 +1,7 @@
 #include "TMVA/SOFIE_common.hxx"
 #include<cctype>
+#include <iomanip>
+#include <limits>
 #include <sstream>
 
 namespace TMVA{
@@ -197,6 +199,53 @@ std::vector<size_t> UTILITY::ComputeStrideFromShape(const std::vector<size_t> &
 }
 
 
+std::string UTILITY::GenerateGemmKernel(size_t m, size_t n, size_t k, bool transA, bool transB, float alpha, float beta,
+                                        const std::string & a, const std::string & b, const std::string & y,
+                                        const std::string & indent) {
+   // number of columns of the output computed together, kept in registers
+   const size_t nBlock = 8;
+   const size_t nMain = n - n % nBlock;
+   auto indexA = [&](const std::string & i, const std::string & l) {
+      return transA ? l + " * " + std::to_string(m) + " + " + i : i + " * " + std::to_string(k) + " + " + l;
+   };
+   auto indexB = [&](const std::string & l, const std::string & j) {
+      return transB ? "(" + j + ") * " + std::to_string(k) + " + " + l : l + " * " + std::to_string(n) + " + " + j;
+   };
+   std::stringstream salpha, sbeta;
+   salpha << std::setprecision(std::numeric_limits<float>::max_digits10) << alpha;
+   sbeta << std::setprecision(std::numeric_limits<float>::max_digits10) << beta;
+   auto store = [&](const std::string & yIndex, const std::string & acc) {
+      std::string out = y + "[" + yIndex + "] = " + ((alpha != 1) ? "float(" + salpha.str() + ") * " : "") + acc;
+      if (beta != 0) out += " + float(" + sbeta.str() + ") * " + y + "[" + yIndex + "]";
+      return out + ";\n";
+   };
+
+   std::stringstream out;
+   out << indent << "for (int i = 0; i < " << m << "; i++) {\n";
+   if (nMain > 0) {
+      out << indent << "   for (int j = 0; j < " << nMain << "; j += " << nBlock << ") {\n";
+      out << indent << "      float acc[" << nBlock << "] = {};\n";
+      out << indent << "      for (int l = 0; l < " << k << "; l++) {\n";
+      out << indent << "         const float al = " << a << "[" << indexA("i", "l") << "];\n";
+      out << indent << "         for (int jj = 0; jj < " << nBlock << "; jj++)\n";
+      out << indent << "            acc[jj] += al * " << b << "[" << indexB("l", "j + jj") << "];\n";
+      out << indent << "      }\n";
+      out << indent << "      for (int jj = 0; jj < " << nBlock << "; jj++)\n";
+      out << indent << "         " << store("i * " + std::to_string(n) + " + j + jj", "acc[jj]");
+      out << indent << "   }\n";
+   }
+   if (nMain < n) {
+      out << indent << "   for (int j = " << nMain << "; j < " << n << "; j++) {\n";
+      out << indent << "      float acc = 0;\n";
+      out << indent << "      for (int l = 0; l < " << k << "; l++)\n";
+      out << indent << "         acc += " << a << "[" << indexA("i", "l") << "] * " << b << "[" << indexB("l", "j") << "];\n";
+      out << indent << "      " << store("i * " + std::to_string(n) + " + j", "acc");
+      out << indent << "   }\n";
+   }
+   out << indent << "}\n";
+   return out.str();
+}
+
 }//SOFIE
 }//Experimental
 }//TMVA
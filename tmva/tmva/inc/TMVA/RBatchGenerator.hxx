@@ -0,0 +1,168 @@
+#ifndef TMVA_RBATCHGENERATOR
+#define TMVA_RBATCHGENERATOR
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "TMVA/RTensor.hxx"
+#include "ROOT/RDataFrame.hxx"
+#include "ROOT/RDF/RDatasetSpec.hxx"
+#include "TFile.h"
+#include "TTree.h"
+
+namespace TMVA {
+namespace Experimental {
+
+/// \brief Generator of training batches streamed from a TTree
+///
+/// The dataset is read in chunks of consecutive entries with RDataFrame, so that only one chunk is held in
+/// memory at any time and datasets larger than the available memory can be used for the training. The
+/// entries of a chunk are written directly at shuffled positions of a contiguous row-major float tensor,
+/// and the batches are views on this tensor, hence they are not copied again. The order of the chunks is
+/// shuffled at every epoch as well.
+///
+/// The batches are RTensor objects, which can be used from Python as numpy arrays without copy through the
+/// array interface, e.g. to be passed to `torch.from_numpy`.
+///
+/// \tparam Args Types of the columns, which are converted to float
+///
+/// #### Usage example:
+/// ```
+///    RBatchGenerator<float, float, int> generator("tree", "file.root", {"x", "y", "label"}, 100000, 1024);
+///    for (int epoch = 0; epoch < nEpochs; epoch++) {
+///       while (generator.HasNextBatch()) {
+///          auto batch = generator.GetNextBatch(); // shape (batch size, number of columns)
+///          ...
+///       }
+///       generator.Reset();
+///    }
+/// ```
+template <typename... Args>
+class RBatchGenerator {
+private:
+   std::string fTreeName;
+   std::string fFileName;
+   std::vector<std::string> fColumns;
+   std::size_t fChunkSize;
+   std::size_t fBatchSize;
+   bool fShuffle;
+   std::mt19937 fRng;
+
+   std::size_t fNumEntries = 0;
+   std::vector<std::size_t> fChunkOrder; ///< Order of the chunks in the current epoch
+   std::size_t fNextChunk = 0;           ///< Index of the next chunk to be loaded in fChunkOrder
+   std::vector<float> fChunk;            ///< Entries of the current chunk, row-major
+   std::size_t fChunkRows = 0;           ///< Number of entries in the current chunk
+   std::size_t fCurrentRow = 0;          ///< First entry of the next batch in the current chunk
+
+   void LoadChunk(std::size_t chunk)
+   {
+      const auto begin = chunk * fChunkSize;
+      const auto end = std::min(begin + fChunkSize, fNumEntries);
+      const auto numCols = fColumns.size();
+      fChunkRows = end - begin;
+      fCurrentRow = 0;
+      fChunk.resize(fChunkRows * numCols);
+
+      // Positions of the entries in the chunk
+      std::vector<std::size_t> rows(fChunkRows);
+      std::iota(rows.begin(), rows.end(), 0);
+      if (fShuffle)
+         std::shuffle(rows.begin(), rows.end(), fRng);
+
+      ROOT::RDF::Experimental::RDatasetSpec spec(fTreeName, fFileName,
+                                                 {static_cast<Long64_t>(begin), static_cast<Long64_t>(end)});
+      ROOT::RDataFrame df(spec);
+      std::size_t entry = 0;
+      float *data = fChunk.data();
+      df.Foreach(
+         [&](Args... values) {
+            if (entry >= fChunkRows)
+               throw std::runtime_error("RBatchGenerator: more entries than expected read in chunk");
+            float *row = data + rows[entry] * numCols;
+            std::size_t j = 0;
+            ((row[j++] = static_cast<float>(values)), ...);
+            entry++;
+         },
+         fColumns);
+      if (entry != fChunkRows)
+         throw std::runtime_error("RBatchGenerator: read " + std::to_string(entry) + " entries instead of " +
+                                  std::to_string(fChunkRows) + " in chunk " + std::to_string(chunk));
+   }
+
+public:
+   /// \brief Construct the generator
+   /// \param[in] treeName Name of the tree
+   /// \param[in] fileName Name of the file, or glob expression of the names of the files
+   /// \param[in] columns Names of the columns, in the order of the columns of the batches
+   /// \param[in] chunkSize Number of entries loaded in memory at once
+   /// \param[in] batchSize Number of entries of the batches
+   /// \param[in] shuffle Flag to shuffle the chunks and the entries inside the chunks
+   /// \param[in] seed Seed of the random generator used for the shuffling
+   RBatchGenerator(const std::string &treeName, const std::string &fileName, const std::vector<std::string> &columns,
+                   std::size_t chunkSize, std::size_t batchSize, bool shuffle = true, unsigned int seed = 0)
+      : fTreeName(treeName), fFileName(fileName), fColumns(columns), fChunkSize(chunkSize), fBatchSize(batchSize),
+        fShuffle(shuffle), fRng(seed)
+   {
+      if (fColumns.size() != sizeof...(Args))
+         throw std::runtime_error("RBatchGenerator: the number of columns does not match the number of column types");
+      if (fBatchSize == 0 || fChunkSize < fBatchSize || fChunkSize % fBatchSize != 0)
+         throw std::runtime_error("RBatchGenerator: the chunk size must be a non-zero multiple of the batch size");
+
+      std::unique_ptr<TFile> file{TFile::Open(fFileName.c_str(), "READ")};
+      if (!file || file->IsZombie())
+         throw std::runtime_error("RBatchGenerator: failed to open input file " + fFileName);
+      auto tree = file->Get<TTree>(fTreeName.c_str());
+      if (!tree)
+         throw std::runtime_error("RBatchGenerator: failed to read tree " + fTreeName + " from file " + fFileName);
+      fNumEntries = tree->GetEntries();
+
+      Reset();
+   }
+
+   /// Return the number of entries of the dataset
+   std::size_t GetNumEntries() const { return fNumEntries; }
+
+   /// Start a new epoch, with a new order of the chunks and of the entries inside the chunks
+   void Reset()
+   {
+      fChunkOrder.resize((fNumEntries + fChunkSize - 1) / fChunkSize);
+      std::iota(fChunkOrder.begin(), fChunkOrder.end(), 0);
+      if (fShuffle)
+         std::shuffle(fChunkOrder.begin(), fChunkOrder.end(), fRng);
+      fNextChunk = 0;
+      fChunkRows = 0;
+      fCurrentRow = 0;
+   }
+
+   /// Return true if the current epoch has batches left
+   bool HasNextBatch() const { return fCurrentRow < fChunkRows || fNextChunk < fChunkOrder.size(); }
+
+   /// \brief Return the next batch of the current epoch
+   /// \return Tensor of shape (number of entries, number of columns), which is a view on the memory of the
+   /// generator valid until the next call. The batches from the last chunk of the dataset can be smaller
+   /// than the batch size.
+   RTensor<float> GetNextBatch()
+   {
+      if (fCurrentRow >= fChunkRows) {
+         if (fNextChunk >= fChunkOrder.size())
+            throw std::runtime_error("RBatchGenerator: no batches left in the current epoch");
+         LoadChunk(fChunkOrder[fNextChunk++]);
+      }
+      const auto rows = std::min(fBatchSize, fChunkRows - fCurrentRow);
+      RTensor<float> batch(fChunk.data() + fCurrentRow * fColumns.size(), {rows, fColumns.size()});
+      fCurrentRow += rows;
+      return batch;
+   }
+};
+
+} // namespace Experimental
+} // namespace TMVA
+
+#endif // TMVA_RBATCHGENERATOR
@@ -147,14 +147,14 @@ public:
       if (x.size() != fVariables.size())
          throw std::runtime_error("Size of input vector is not equal to number of variables.");
 
+      // Take lock to protect the memory used by the TMVA reader and the model evaluation
+      R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
+
       // Copy over inputs to memory used by TMVA reader
       for (std::size_t i = 0; i < x.size(); i++) {
          fValues[i] = x[i];
       }
 
-      // Take lock to protect model evaluation
-      R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
-
       // Evaluate TMVA model
       // Classification
       if (fAnalysisType == Internal::AnalysisType::Classification) {
@@ -175,8 +175,13 @@ public:
       }
    }
 
-   /// Compute model prediction on input RTensor
-   RTensor<float> Compute(RTensor<float> &x)
+   /// \brief Compute model prediction on input RTensor
+   ///
+   /// The input tensor of shape (number of entries, number of variables) can have any memory layout,
+   /// e.g. a column-major block with one contiguous column per variable. The lock protecting the TMVA reader is taken once for the whole
+   /// batch of entries, hence batches should be preferred over single entries when the same RReader
+   /// is shared between threads.
+   RTensor<float> Compute(const RTensor<float> &x)
    {
       // Error-handling for input tensor
       const auto shape = x.GetShape();
@@ -196,12 +201,20 @@ public:
       if (fAnalysisType == Internal::AnalysisType::Multiclass)
          y = y.Reshape({numEntries, numClasses});
 
+      // Strides of the input tensor for the entries and the variables
+      const auto &strides = x.GetStrides();
+      const std::size_t strideEntry = strides[0];
+      const std::size_t strideVar = strides[1];
+      const float *data = x.GetData();
+
+      // Take lock to protect the memory used by the TMVA reader and the model evaluation
+      R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
+
       // Fill output tensor
       for (std::size_t i = 0; i < numEntries; i++) {
          for (std::size_t j = 0; j < numVars; j++) {
-            fValues[j] = x(i, j);
+            fValues[j] = data[i * strideEntry + j * strideVar];
          }
-         R__WRITE_LOCKGUARD(ROOT::gCoreMutex);
          // Classification
          if (fAnalysisType == Internal::AnalysisType::Classification) {
             y(i) = fReader->EvaluateMVA(name);
@@ -67,6 +67,7 @@ struct BranchlessTree {
    inline T Inference(const T *input, const int stride);
    inline void FillSparse();
    inline std::string GetInferenceCode(const std::string& funcName, const std::string& typeName);
+   inline std::string GetBatchInferenceCode(const std::string &funcName, const std::string &typeName, int batchSize);
 };
 
 /// Perform inference on a single input vector
@@ -145,6 +146,61 @@ inline std::string BranchlessTree<T>::GetInferenceCode(const std::string& funcNa
    return ss.str();
 }
 
+/// Get code for compiling the inference function of the branchless tree on a fixed
+/// number of events at once
+///
+/// The function traverses the tree level by level for all the events together, so that
+/// the independent loads and comparisons of the events can be vectorized by the compiler,
+/// e.g. with gather instructions. The score of each event is added to the predictions.
+///
+/// \param[in] funcName Name of the function
+/// \param[in] typeName Name of the type used for the computation
+/// \param[in] batchSize Number of events processed together
+/// \return Code of the inference function as string
+template <typename T>
+inline std::string
+BranchlessTree<T>::GetBatchInferenceCode(const std::string &funcName, const std::string &typeName, int batchSize)
+{
+   std::stringstream ss;
+
+   // Build signature
+   ss << "inline void " << funcName << "(const " << typeName
+      << "* input, const int stride, const int strideBatch, " << typeName << "* predictions)";
+
+   // Function body
+   ss << "\n{\n";
+
+   // Hard-code thresholds and cut variables
+   ss << "   const int inputs[" << fInputs.size() << "] = {";
+   int last = static_cast<int>(fInputs.size() - 1);
+   for (int i = 0; i < last + 1; i++) {
+      ss << fInputs[i];
+      if (i != last) ss << ", ";
+   }
+   ss << "};\n";
+
+   ss << "   const " << typeName << " thresholds[" << fThresholds.size() << "] = {";
+   last = static_cast<int>(fThresholds.size() - 1);
+   for (int i = 0; i < last + 1; i++) {
+      ss << fThresholds[i];
+      if (i != last) ss << ", ";
+   }
+   ss << "};\n";
+
+   // Add inference code
+   ss << "   int index[" << batchSize << "] = {};\n";
+   for (int level = 0; level < fTreeDepth; ++level) {
+      ss << "   for (int j = 0; j < " << batchSize << "; j++)\n";
+      ss << "      index[j] = 2 * index[j] + 1 + "
+         << "(input[j * strideBatch + inputs[index[j]] * stride] > thresholds[index[j]]);\n";
+   }
+   ss << "   for (int j = 0; j < " << batchSize << "; j++)\n";
+   ss << "      predictions[j] += thresholds[index[j]];\n";
+   ss << "}";
+
+   return ss.str();
+}
+
 } // namespace Experimental
 } // namespace TMVA
 
@@ -185,6 +185,9 @@ BranchlessForest<T>::Load(const std::string &key, const std::string &filename, c
 /// \tparam T Value type for the computation (usually floating point type)
 template <typename T>
 struct BranchlessJittedForest : public ForestBase<T, std::function<void (const T *, const int, bool, T*)>> {
+   /// Number of events for which the trees are traversed at once
+   static constexpr int kBatchSize = 8;
+
     std::string Load(const std::string &key, const std::string &filename, const int output = 0, const bool sortTrees = true);
    void Inference(const T *inputs, const int rows, bool layout, T *predictions);
 };
@@ -269,7 +272,8 @@ BranchlessJittedForest<T>::Load(const std::string &key, const std::string &filen
       // Save code for jitting
       std::stringstream ss;
       ss << "tree" << c;
-      codes[c] = tree.GetInferenceCode(ss.str(), typeName);
+      codes[c] = tree.GetInferenceCode(ss.str(), typeName) + "\n\n" +
+                 tree.GetBatchInferenceCode(ss.str() + "_batch", typeName, kBatchSize);
 
       c++;
    }
@@ -309,7 +313,17 @@ BranchlessJittedForest<T>::Load(const std::string &key, const std::string &filen
              << "\n{\n"
              << "   const auto strideTree = layout ? 1 : rows;\n"
              << "   const auto strideBatch = layout ? " << this->fNumInputs << " : 1;\n"
-             << "   for (int i = 0; i < rows; i++) {\n"
+             << "   int i = 0;\n"
+             // Traverse each tree for blocks of events at once
+             << "   for (; i + " << kBatchSize << " <= rows; i += " << kBatchSize << ") {\n"
+             << "      for (int j = 0; j < " << kBatchSize << "; j++)\n"
+             << "         predictions[i + j] = 0.0;\n";
+   for (int i = 0; i < static_cast<int>(codes.size()); i++) {
+      jitForest << "      tree" << i << "_batch(inputs + i * strideBatch, strideTree, strideBatch, predictions + i);\n";
+   }
+   jitForest << "   }\n"
+             // Remaining events
+             << "   for (; i < rows; i++) {\n"
              << "      predictions[i] = 0.0;\n";
    for (int i = 0; i < static_cast<int>(codes.size()); i++) {
       std::stringstream ss;
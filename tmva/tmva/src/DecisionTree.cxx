@@ -1356,6 +1356,31 @@ struct TrainNodeInfo{
 
        return ret;
    };
+
+   // Add the sums of another TrainNodeInfo in place, which avoids allocating a new one
+   // for each partial result when merging the results of the threads
+   TrainNodeInfo &operator+=(const TrainNodeInfo &other)
+   {
+      if (cNvars != other.cNvars) {
+         std::cout << "!!! ERROR TrainNodeInfo1+=TrainNodeInfo2 failure. cNvars1 != cNvars2." << std::endl;
+         return *this;
+      }
+      for (Int_t ivar = 0; ivar < cNvars; ivar++) {
+         for (UInt_t ibin = 0; ibin < nBins[ivar]; ibin++) {
+            nSelS[ivar][ibin] += other.nSelS[ivar][ibin];
+            nSelB[ivar][ibin] += other.nSelB[ivar][ibin];
+            nSelS_unWeighted[ivar][ibin] += other.nSelS_unWeighted[ivar][ibin];
+            nSelB_unWeighted[ivar][ibin] += other.nSelB_unWeighted[ivar][ibin];
+            target[ivar][ibin] += other.target[ivar][ibin];
+            target2[ivar][ibin] += other.target2[ivar][ibin];
+         }
+      }
+      nTotS += other.nTotS;
+      nTotS_unWeighted += other.nTotS_unWeighted;
+      nTotB += other.nTotB;
+      nTotB_unWeighted += other.nTotB_unWeighted;
+      return *this;
+   }
  
 };
 //===========================================================================
@@ -1600,7 +1625,10 @@ Double_t TMVA::DecisionTree::TrainNodeFast( const EventConstList & eventSample,
          for(UInt_t iev=start; iev<end; iev++) {
 
             Double_t eventWeight =  eventSample[iev]->GetWeight();
-            if (eventSample[iev]->GetClass() == fSigClass) {
+            // the class and the target are the same for all the variables
+            const Bool_t isSignal = eventSample[iev]->GetClass() == fSigClass;
+            const Double_t eventTarget = DoRegression() ? eventSample[iev]->GetTarget(0) : 0.;
+            if (isSignal) {
                nodeInfof.nTotS+=eventWeight;
                nodeInfof.nTotS_unWeighted++;    }
             else {
@@ -1625,7 +1653,7 @@ Double_t TMVA::DecisionTree::TrainNodeFast( const EventConstList & eventSample,
                   // #### figure out which bin it belongs in ...
                   // "maximum" is nbins-1 (the "-1" because we start counting from 0 !!
                   iBin = TMath::Min(Int_t(nBins[ivar]-1),TMath::Max(0,int (invBinWidth[ivar]*(eventData-xmin[ivar]) ) ));
-                  if (eventSample[iev]->GetClass() == fSigClass) {
+                  if (isSignal) {
                      nodeInfof.nSelS[ivar][iBin]+=eventWeight;
                      nodeInfof.nSelS_unWeighted[ivar][iBin]++;
                   }
@@ -1634,8 +1662,8 @@ Double_t TMVA::DecisionTree::TrainNodeFast( const EventConstList & eventSample,
                      nodeInfof.nSelB_unWeighted[ivar][iBin]++;
                   }
                   if (DoRegression()) {
-                     nodeInfof.target[ivar][iBin] +=eventWeight*eventSample[iev]->GetTarget(0);
-                     nodeInfof.target2[ivar][iBin]+=eventWeight*eventSample[iev]->GetTarget(0)*eventSample[iev]->GetTarget(0);
+                     nodeInfof.target[ivar][iBin] +=eventWeight*eventTarget;
+                     nodeInfof.target2[ivar][iBin]+=eventWeight*eventTarget*eventTarget;
                   }
                }
             }
@@ -1646,8 +1674,12 @@ Double_t TMVA::DecisionTree::TrainNodeFast( const EventConstList & eventSample,
       // #### Need an intial struct to pass to std::accumulate
       TrainNodeInfo nodeInfoInit(cNvars, nBins);
 
-      // #### Run the threads in parallel then merge the results
-      auto redfunc = [nodeInfoInit](std::vector<TrainNodeInfo> v) -> TrainNodeInfo { return std::accumulate(v.begin(), v.end(), nodeInfoInit); };
+      // #### Run the threads in parallel then merge the results in place into the first one
+      auto redfunc = [&nodeInfoInit](std::vector<TrainNodeInfo> v) -> TrainNodeInfo {
+         if (v.empty()) return nodeInfoInit;
+         for (std::size_t i = 1; i < v.size(); i++) v[0] += v[i];
+         return std::move(v[0]);
+      };
       nodeInfo = TMVA::Config::Instance().GetThreadExecutor().MapReduce(f, seeds, redfunc);
    }
  
@@ -1110,6 +1110,15 @@ TCanvas *TMVA::Factory::GetROCCurve(TString datasetname, UInt_t iClass, Types::E
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Iterates through all booked methods and calls training
+///
+/// The methods booked with the same DataLoader share a single DataSet, which is
+/// built only once, and each method applies its own variable transformations on
+/// the fly when reading the events. The methods are trained one after the other,
+/// since the DataSet keeps the current event and tree type as state and the
+/// transformations return a temporary event owned by the method. The methods that
+/// support it (e.g. BDT with nCuts > 0, DL on the CPU architecture) use the implicit
+/// multi-threading pool enabled with ROOT::EnableImplicitMT() inside their
+/// training instead.
 
 void TMVA::Factory::TrainAllMethods()
 {
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include "TMVA/RBatchGenerator.hxx"
+#include "ROOT/RDataFrame.hxx"
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+using namespace TMVA::Experimental;
+
+class RBatchGeneratorTest : public ::testing::Test {
+protected:
+   static constexpr const char *fFileName = "rbatchgenerator.root";
+
+   static void SetUpTestCase()
+   {
+      ROOT::RDataFrame(10).Define("x", "1.f * rdfentry_").Define("y", "-2. * rdfentry_").Snapshot("tree", fFileName);
+   }
+
+   static void TearDownTestCase() { std::remove(fFileName); }
+};
+
+TEST_F(RBatchGeneratorTest, Ordered)
+{
+   RBatchGenerator<float, double> generator("tree", fFileName, {"x", "y"}, 4, 2, false);
+   EXPECT_EQ(generator.GetNumEntries(), 10u);
+   std::vector<std::size_t> batchSizes;
+   float expected = 0;
+   while (generator.HasNextBatch()) {
+      auto batch = generator.GetNextBatch();
+      EXPECT_EQ(batch.GetShape()[1], 2u);
+      batchSizes.push_back(batch.GetShape()[0]);
+      for (std::size_t i = 0; i < batch.GetShape()[0]; i++) {
+         EXPECT_EQ(batch(i, 0), expected);
+         EXPECT_EQ(batch(i, 1), -2.f * expected);
+         expected++;
+      }
+   }
+   EXPECT_EQ(batchSizes, (std::vector<std::size_t>{2, 2, 2, 2, 2}));
+}
+
+TEST_F(RBatchGeneratorTest, ShuffledEpochs)
+{
+   RBatchGenerator<float, double> generator("tree", fFileName, {"x", "y"}, 4, 2, true, 42);
+   for (int epoch = 0; epoch < 2; epoch++) {
+      std::vector<float> values;
+      while (generator.HasNextBatch()) {
+         auto batch = generator.GetNextBatch();
+         for (std::size_t i = 0; i < batch.GetShape()[0]; i++) {
+            EXPECT_EQ(batch(i, 1), -2.f * batch(i, 0));
+            values.push_back(batch(i, 0));
+         }
+      }
+      // every entry is seen exactly once per epoch
+      std::sort(values.begin(), values.end());
+      ASSERT_EQ(values.size(), 10u);
+      for (std::size_t i = 0; i < values.size(); i++)
+         EXPECT_EQ(values[i], 1.f * i);
+      generator.Reset();
+   }
+}
+
+TEST_F(RBatchGeneratorTest, InvalidSizes)
+{
+   using Generator_t = RBatchGenerator<float, double>;
+   EXPECT_THROW(Generator_t("tree", fFileName, {"x", "y"}, 5, 2), std::runtime_error);
+   EXPECT_THROW(Generator_t("tree", fFileName, {"x"}, 4, 2), std::runtime_error);
+}
@@ -175,6 +175,22 @@ TEST(RReader, ClassificationComputeTensor)
    EXPECT_EQ(shapeY[0], shapeX[0]);
 }
 
+TEST(RReader, ClassificationComputeTensorColumnMajor)
+{
+   TrainClassificationModel();
+   ROOT::RDataFrame df("TreeS", filenameClassification);
+   auto x = AsTensor<float>(df, variablesClassification);
+   auto xColumnMajor = AsTensor<float>(df, variablesClassification, MemoryLayout::ColumnMajor);
+
+   RReader model(modelClassification);
+   auto y = model.Compute(x);
+   auto yColumnMajor = model.Compute(xColumnMajor);
+
+   ASSERT_EQ(yColumnMajor.GetSize(), y.GetSize());
+   for (std::size_t i = 0; i < y.GetSize(); i++)
+      EXPECT_EQ(yColumnMajor(i), y(i));
+}
+
 TEST(RReader, ClassificationComputeDataFrame)
 {
    TrainClassificationModel();
@@ -0,0 +1,27 @@
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RCACHEOPTIONS
+#define ROOT_RCACHEOPTIONS
+
+#include <cstddef>
+#include <string>
+
+namespace ROOT {
+
+namespace RDF {
+
+/// A collection of options to steer where RInterface::Cache() keeps the cached columns
+struct RCacheOptions {
+   std::size_t fMemoryBudget = 0; ///< Maximum estimated size in bytes of an in-memory cache, 0 means no limit
+   std::string fSpillDirectory;   ///< Directory of the on-disk cache used above the budget, by default the current one
+};
+} // ns RDF
+} // ns ROOT
+
+#endif
@@ -64,7 +64,8 @@ private:
    std::vector<std::deque<bool>> fBoolEvtValues; // one per column per slot
 
    void FillHeaders(const std::string &);
-   void FillRecord(const std::string &, Record_t &);
+   void FillRecord(const std::string &, Record_t &, std::set<std::string> &);
+   void FillRecords(const std::vector<std::string> &);
    void GenerateHeaders(size_t);
    std::vector<void *> GetColumnReadersImpl(std::string_view, const std::type_info &);
    void ValidateColTypes(std::vector<std::string> &) const;
@@ -62,6 +62,16 @@
 /// \cond HIDDEN_SYMBOLS
 
 namespace ROOT {
+namespace Detail {
+namespace RDF {
+class RLoopManager;
+}
+} // namespace Detail
+namespace RDF {
+template <typename Proxied, typename DataSource>
+class RInterface;
+}
+
 namespace Internal {
 namespace RDF {
 using namespace ROOT::TypeTraits;
@@ -356,6 +366,54 @@ BufferedFillHelper::Exec(unsigned int, const std::vector<unsigned int> &, const
 template <typename HIST = Hist_t>
 class R__CLING_PTRCHECK(off) FillHelper : public RActionImpl<FillHelper<HIST>> {
    std::vector<HIST *> fObjects;
+   // For TH1Ds, scalar values and weights are buffered per slot and filled in bulk with TH1::FillN
+   std::vector<std::vector<double>> fBuffers;
+   std::vector<std::vector<double>> fWBuffers;
+   static constexpr std::size_t fgBufSize = 1024;
+
+   template <typename H = HIST, std::enable_if_t<std::is_same<H, ::TH1D>::value, int> = 0>
+   void FlushBuffer(unsigned int slot)
+   {
+      auto &buffer = fBuffers[slot];
+      if (buffer.empty())
+         return;
+      auto &wBuffer = fWBuffers[slot];
+      fObjects[slot]->FillN(buffer.size(), buffer.data(), wBuffer.empty() ? nullptr : wBuffer.data());
+      buffer.clear();
+      wBuffer.clear();
+   }
+
+   template <typename H = HIST, std::enable_if_t<!std::is_same<H, ::TH1D>::value, int> = 0>
+   void FlushBuffer(unsigned int)
+   {
+   }
+
+   template <typename X, typename H = HIST,
+             std::enable_if_t<std::is_same<H, ::TH1D>::value && std::is_arithmetic<X>::value, int> = 0>
+   void FillOrBuffer(unsigned int slot, const X &x)
+   {
+      fBuffers[slot].emplace_back(x);
+      if (fBuffers[slot].size() == fgBufSize)
+         FlushBuffer(slot);
+   }
+
+   template <typename X, typename W, typename H = HIST,
+             std::enable_if_t<std::is_same<H, ::TH1D>::value && std::is_arithmetic<X>::value &&
+                                 std::is_arithmetic<W>::value,
+                              int> = 0>
+   void FillOrBuffer(unsigned int slot, const X &x, const W &w)
+   {
+      fBuffers[slot].emplace_back(x);
+      fWBuffers[slot].emplace_back(w);
+      if (fBuffers[slot].size() == fgBufSize)
+         FlushBuffer(slot);
+   }
+
+   template <typename... Xs>
+   void FillOrBuffer(unsigned int slot, const Xs &...xs)
+   {
+      fObjects[slot]->Fill(xs...);
+   }
 
    template <typename H = HIST, typename = decltype(std::declval<H>().Reset())>
    void ResetIfPossible(H *h)
@@ -456,12 +514,11 @@ class R__CLING_PTRCHECK(off) FillHelper : public RActionImpl<FillHelper<HIST>> {
    template <std::size_t ColIdx, typename End_t, typename... Its>
    void ExecLoop(unsigned int slot, End_t end, Its... its)
    {
-      auto *thisSlotH = fObjects[slot];
       // loop increments all of the iterators while leaving scalars unmodified
       // TODO this could be simplified with fold expressions or std::apply in C++17
       auto nop = [](auto &&...) {};
       for (; GetNthElement<ColIdx>(its...) != end; nop(++its...)) {
-         thisSlotH->Fill(*its...);
+         FillOrBuffer(slot, *its...);
       }
    }
 
@@ -477,15 +534,23 @@ public:
          fObjects[i] = new HIST(*fObjects[0]);
          UnsetDirectoryIfPossible(fObjects[i]);
       }
+      if (std::is_same<HIST, ::TH1D>::value) {
+         fBuffers.resize(nSlots);
+         fWBuffers.resize(nSlots);
+         for (auto &buffer : fBuffers)
+            buffer.reserve(fgBufSize);
+      }
    }
 
    void InitTask(TTreeReader *, unsigned int) {}
 
+   void FinalizeTask(unsigned int slot) { FlushBuffer(slot); }
+
    // no container arguments
    template <typename... ValTypes, std::enable_if_t<!Disjunction<IsDataContainer<ValTypes>...>::value, int> = 0>
    auto Exec(unsigned int slot, const ValTypes &...x) -> decltype(fObjects[slot]->Fill(x...), void())
    {
-      fObjects[slot]->Fill(x...);
+      FillOrBuffer(slot, x...);
    }
 
    // at least one container argument
@@ -527,6 +592,9 @@ public:
 
    void Finalize()
    {
+      for (unsigned int slot = 0; slot < fObjects.size(); ++slot)
+         FlushBuffer(slot);
+
       if (fObjects.size() == 1)
          return;
 
@@ -537,7 +605,11 @@ public:
          delete *it;
    }
 
-   HIST &PartialUpdate(unsigned int slot) { return *fObjects[slot]; }
+   HIST &PartialUpdate(unsigned int slot)
+   {
+      FlushBuffer(slot);
+      return *fObjects[slot];
+   }
 
    // Helper functions for RMergeableValue
    std::unique_ptr<RMergeableValueBase> GetMergeableValue() const final
@@ -1774,6 +1846,74 @@ public:
    }
 };
 
+/// Type-erased writer of the RNTuple produced by SnapshotRNTupleHelper.
+/// The implementation lives in RDFActionHelpers.cxx so that this header does not depend on ROOTNTuple.
+class RSnapshotNTupleWriter {
+public:
+   virtual ~RSnapshotNTupleWriter() = default;
+   /// Prepare the given slot for filling; the per-slot fill contexts are created on first use.
+   virtual void InitSlot(unsigned int slot) = 0;
+   /// Fill one entry in the given slot. `values` holds the addresses of the column values, in field order.
+   virtual void Fill(unsigned int slot, void *const *values) = 0;
+   /// Commit the remaining clusters, close the output and point the output RDataFrame to the new RNTuple.
+   virtual void Finalize() = 0;
+};
+
+std::unique_ptr<RSnapshotNTupleWriter>
+MakeSnapshotNTupleWriter(const std::string &fileName, const std::string &dirName, const std::string &ntupleName,
+                         const ColumnNames_t &fieldNames, const std::vector<std::string> &typeNames,
+                         const RSnapshotOptions &options, unsigned int nSlots,
+                         const std::shared_ptr<ROOT::RDF::RInterface<RLoopManager, void>> &outputDF);
+
+/// Helper object for a Snapshot action that writes an RNTuple, in single-thread and multi-thread runs.
+/// Every slot fills its own clusters, the clusters are committed to the shared page sink of an RNTupleParallelWriter.
+template <typename... ColTypes>
+class R__CLING_PTRCHECK(off) SnapshotRNTupleHelper : public RActionImpl<SnapshotRNTupleHelper<ColTypes...>> {
+   const unsigned int fNSlots;
+   const std::string fFileName;
+   const std::string fDirName;
+   const std::string fNTupleName;
+   const ColumnNames_t fOutputFieldNames;
+   const RSnapshotOptions fOptions;
+   std::shared_ptr<ROOT::RDF::RInterface<RLoopManager, void>> fOutputDF; // replaced in Finalize
+   std::unique_ptr<RSnapshotNTupleWriter> fWriter;
+
+public:
+   using ColumnTypes_t = TypeList<ColTypes...>;
+   SnapshotRNTupleHelper(unsigned int nSlots, std::string_view filename, std::string_view dirname,
+                         std::string_view ntuplename, const ColumnNames_t &bnames, const RSnapshotOptions &options,
+                         const std::shared_ptr<ROOT::RDF::RInterface<RLoopManager, void>> &outputDF)
+      : fNSlots(nSlots), fFileName(filename), fDirName(dirname), fNTupleName(ntuplename),
+        fOutputFieldNames(ReplaceDotWithUnderscore(bnames)), fOptions(options), fOutputDF(outputDF)
+   {
+      ValidateSnapshotOutput(fOptions, fNTupleName, fFileName);
+   }
+   SnapshotRNTupleHelper(const SnapshotRNTupleHelper &) = delete;
+   SnapshotRNTupleHelper(SnapshotRNTupleHelper &&) = default;
+
+   void Initialize()
+   {
+      fWriter = MakeSnapshotNTupleWriter(fFileName, fDirName, fNTupleName, fOutputFieldNames,
+                                         {TypeID2TypeName(typeid(ColTypes))...}, fOptions, fNSlots, fOutputDF);
+   }
+
+   void InitTask(TTreeReader *, unsigned int slot) { fWriter->InitSlot(slot); }
+
+   void Exec(unsigned int slot, ColTypes &...values)
+   {
+      void *const addresses[] = {&values...};
+      fWriter->Fill(slot, addresses);
+   }
+
+   void Finalize()
+   {
+      fWriter->Finalize();
+      fWriter.reset();
+   }
+
+   std::string GetActionName() { return "Snapshot"; }
+};
+
 template <typename Acc, typename Merge, typename R, typename T, typename U,
           bool MustCopyAssign = std::is_same<R, U>::value>
 class R__CLING_PTRCHECK(off) AggregateHelper
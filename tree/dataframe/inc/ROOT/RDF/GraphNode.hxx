@@ -11,7 +11,9 @@
 #ifndef ROOT_RDF_GRAPHNODE
 #define ROOT_RDF_GRAPHNODE
 
+#include <iomanip>
 #include <string>
+#include <sstream>
 #include <memory>
 #include <vector>
 #include "ROOT/RStringView.hxx"
@@ -51,6 +53,12 @@ class GraphNode {
 
    std::string fName, fColor, fShape;
 
+   ENodeType fType;
+
+   /// C++ code that books this node on the previous one with concrete types, e.g. `.Filter(...)`, as exported by
+   /// ROOT::RDF::Experimental::ExportCode(). For actions, their name. Empty if the node cannot be exported.
+   std::string fCode;
+
    /// Columns defined up to this node. By checking the defined columns between two consecutive
    /// nodes, it is possible to know if there was some Define in between.
    std::vector<std::string> fDefinedColumns;
@@ -113,7 +121,7 @@ class GraphNode {
 public:
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Creates a node with a name
-   GraphNode(std::string_view name, unsigned int id, ENodeType t) : fID(id), fName(name)
+   GraphNode(std::string_view name, unsigned int id, ENodeType t) : fID(id), fName(name), fType(t)
    {
       switch (t) {
       case ENodeType::kAction: SetAction(/*hasRun=*/false); break;
@@ -129,6 +137,19 @@ public:
    /// \brief Appends a node on the head of the current node
    void SetPrevNode(const std::shared_ptr<GraphNode> &node) { fPrevNode = node; }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Shows the time spent in the node, as measured with RInterface::SetProfiling(), below its name
+   void AddProfile(double seconds)
+   {
+      std::stringstream label;
+      label << "<BR/><FONT POINT-SIZE=\"10.0\">" << std::setprecision(3) << seconds * 1000. << " ms</FONT>";
+      fName += label.str();
+   }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Sets the C++ code that books the node, see ROOT::RDF::Experimental::ExportCode()
+   void SetCode(const std::string &code) { fCode = code; }
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Adds the column defined up to the node
    void AddDefinedColumns(const std::vector<std::string> &columns) { fDefinedColumns = columns; }
@@ -137,6 +158,8 @@ public:
    unsigned int GetID() const { return fID; }
    std::string GetName() const { return fName; }
    std::string GetShape() const { return fShape; }
+   ENodeType GetType() const { return fType; }
+   const std::string &GetCode() const { return fCode; }
    GraphNode *GetPrevNode() const { return fPrevNode.get(); }
 
    ////////////////////////////////////////////////////////////////////////////
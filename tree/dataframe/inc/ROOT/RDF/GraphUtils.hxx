@@ -68,6 +68,10 @@ private:
    /// \brief Starting by an array of leaves, it draws the entire graph.
    std::string FromGraphActionsToDot(std::vector<std::shared_ptr<GraphNode>> leaves) const;
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Adds the timings of the last profiled event loop, if any, to the visited nodes.
+   void AddProfiles(const RLoopManager &loopManager);
+
 public:
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Starting from the root node, prints the entire graph.
@@ -77,6 +81,12 @@ public:
    /// \brief Starting from the root node, prints the entire graph.
    std::string RepresentGraph(RLoopManager *rLoopManager);
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Starting from a node, prints the branch it belongs to, including the Defines booked after the node.
+   /// The branch ends in an action node called `actionName`, as if such an action had been booked on the node.
+   std::string RepresentGraph(ROOT::Detail::RDF::RNodeBase &node, const RColumnRegister &colRegister,
+                              const std::string &actionName);
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Starting from a Filter or Range, prints the branch it belongs to
    template <typename Proxied, typename DataSource>
@@ -85,7 +95,22 @@ public:
       auto loopManager = rInterface.GetLoopManager();
       loopManager->Jit();
 
-      return FromGraphLeafToDot(*rInterface.GetProxiedPtr()->GetGraph(fVisitedMap));
+      auto leaf = rInterface.GetProxiedPtr()->GetGraph(fVisitedMap);
+      AddProfiles(*loopManager);
+      return FromGraphLeafToDot(*leaf);
+   }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Returns the C++ code of a function that books the entire graph with concrete types.
+   /// See ROOT::RDF::Experimental::ExportCode().
+   std::string ExportCode(RLoopManager *loopManager, const std::string &functionName);
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Returns the C++ code of a function that books the entire graph the node belongs to with concrete types.
+   template <typename Proxied, typename DataSource>
+   std::string ExportCode(RInterface<Proxied, DataSource> &rInterface, const std::string &functionName)
+   {
+      return ExportCode(rInterface.GetLoopManager(), functionName);
    }
 
    ////////////////////////////////////////////////////////////////////////////
@@ -98,7 +123,9 @@ public:
       loopManager->Jit();
 
       auto actionPtr = resultPtr.fActionPtr;
-      return FromGraphLeafToDot(*actionPtr->GetGraph(fVisitedMap));
+      auto leaf = actionPtr->GetGraph(fVisitedMap);
+      AddProfiles(*loopManager);
+      return FromGraphLeafToDot(*leaf);
    }
 };
 
@@ -249,6 +249,8 @@ struct SnapshotHelperArgs {
    std::string fTreeName;
    std::vector<std::string> fOutputColNames;
    ROOT::RDF::RSnapshotOptions fOptions;
+   /// Only used for RNTuple output: the RDataFrame returned by Snapshot, which is made to read the output in Finalize
+   std::shared_ptr<ROOT::RDF::RInterface<RLoopManager, void>> fOutputDF;
 };
 
 // Snapshot action
@@ -274,7 +276,14 @@ BuildAction(const ColumnNames_t &colNames, const std::shared_ptr<SnapshotHelperA
    std::vector<bool> isDefine = makeIsDefine();
 
    std::unique_ptr<RActionBase> actionPtr;
-   if (!ROOT::IsImplicitMTEnabled()) {
+   if (options.fOutputFormat == ROOT::RDF::ESnapshotOutputFormat::kRNTuple) {
+      // single- and multi-thread RNTuple snapshot
+      using Helper_t = SnapshotRNTupleHelper<ColTypes...>;
+      using Action_t = RAction<Helper_t, PrevNodeType>;
+      actionPtr.reset(new Action_t(
+         Helper_t(nSlots, filename, dirname, treename, outputColNames, options, snapHelperArgs->fOutputDF), colNames,
+         prevNode, colRegister));
+   } else if (!ROOT::IsImplicitMTEnabled()) {
       // single-thread snapshot
       using Helper_t = SnapshotHelper<ColTypes...>;
       using Action_t = RAction<Helper_t, PrevNodeType>;
@@ -780,6 +789,18 @@ std::pair<std::vector<std::string>, std::vector<std::string>>
 AddSizeBranches(const std::vector<std::string> &branches, TTree *tree, std::vector<std::string> &&colsWithoutAliases,
                 std::vector<std::string> &&colsWithAliases);
 
+std::string GetPersistentCacheFileName(RNodeBase &node, const RColumnRegister &colRegister,
+                                       const std::string &datasetDescription, TTree *tree,
+                                       const ColumnNames_t &columns, const std::vector<std::string> &columnTypes,
+                                       std::string_view cacheDir);
+
+ULong64_t EstimateCacheSize(TTree *tree, bool hasDataSource, ULong64_t nEmptyEntries, const ColumnNames_t &columns,
+                            const std::vector<std::string> &columnTypes);
+
+ROOT::RDF::RInterface<RLoopManager, void>
+GetOrMakePersistentCache(const std::string &fileName,
+                         const std::function<void(const std::string &ntupleName, const std::string &fileName)> &write);
+
 } // namespace RDF
 } // namespace Internal
 
@@ -103,6 +103,7 @@ public:
    template <typename... ColTypes, std::size_t... S>
    void CallExec(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>)
    {
+      RDFInternal::RNodeProfiler::RTimer timer(fLoopManager->GetProfiler(), this, slot, entry);
       fHelper.Exec(slot, fValues[slot][S]->template Get<ColTypes>(entry)...);
       (void)entry; // avoid unused parameter warning (gcc 12.1)
    }
@@ -114,6 +115,15 @@ public:
          CallExec(slot, entry, ColumnTypes_t{}, TypeInd_t{});
    }
 
+   void RunBulk(unsigned int slot, Long64_t firstEntry, std::size_t bulkSize) final
+   {
+      const auto &mask = fPrevNode.CheckFiltersBulk(slot, firstEntry, bulkSize);
+      for (std::size_t i = 0; i < bulkSize; ++i) {
+         if (mask[i])
+            CallExec(slot, firstEntry + i, ColumnTypes_t{}, TypeInd_t{});
+      }
+   }
+
    void TriggerChildrenCount() final { fPrevNode.IncrChildrenCount(); }
 
    /// Clean-up operations to be performed at the end of a task.
@@ -132,6 +142,8 @@ public:
       SetHasRun();
    }
 
+   std::string GetActionName() final { return fHelper.GetActionName(); }
+
    std::shared_ptr<RDFGraphDrawing::GraphNode>
    GetGraph(std::unordered_map<void *, std::shared_ptr<RDFGraphDrawing::GraphNode>> &visitedMap) final
    {
@@ -142,6 +154,7 @@ public:
       const auto nodeType = HasRun() ? RDFGraphDrawing::ENodeType::kUsedAction : RDFGraphDrawing::ENodeType::kAction;
       auto thisNode =
          std::make_shared<RDFGraphDrawing::GraphNode>(fHelper.GetActionName(), visitedMap.size(), nodeType);
+      thisNode->SetCode(fHelper.GetActionName());
       visitedMap[(void *)this] = thisNode;
 
       auto upmostNode = AddDefinesToGraph(thisNode, GetColRegister(), prevColumns, visitedMap);
@@ -16,6 +16,7 @@
 #include "ROOT/RDF/Utils.hxx" // ColumnNames_t
 #include "RtypesCore.h"
 
+#include <cstddef>
 #include <memory>
 #include <string>
 
@@ -64,6 +65,8 @@ public:
    RLoopManager *GetLoopManager() { return fLoopManager; }
    unsigned int GetNSlots() const { return fNSlots; }
    virtual void Run(unsigned int slot, Long64_t entry) = 0;
+   /// Process the `bulkSize` entries starting at `firstEntry` that pass the upstream filters.
+   virtual void RunBulk(unsigned int slot, Long64_t firstEntry, std::size_t bulkSize) = 0;
    virtual void Initialize() = 0;
    virtual void InitSlot(TTreeReader *r, unsigned int slot) = 0;
    virtual void TriggerChildrenCount() = 0;
@@ -77,6 +80,9 @@ public:
    virtual bool HasRun() const { return fHasRun; }
    virtual void SetHasRun() { fHasRun = true; }
 
+   /// Name of the action as shown by SaveGraph().
+   virtual std::string GetActionName() = 0;
+
    virtual std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode>
    GetGraph(std::unordered_map<void *, std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode>> &visitedMap) = 0;
 
@@ -58,6 +58,7 @@ private:
     */
    std::vector<std::string> fFileNameGlobs;
    REntryRange fEntryRange; ///< Start (inclusive) and end (exclusive) entry for the dataset processing
+   std::vector<Long64_t> fEntriesPerFile; ///< Number of entries of each file if known upfront, empty otherwise
    ROOT::Internal::TreeUtils::RFriendInfo fFriendInfo; ///< List of friends
 
 public:
@@ -76,6 +77,8 @@ public:
 
    void AddFriend(const std::vector<std::pair<std::string, std::string>> &treeAndFileNameGlobs,
                   const std::string &alias = "");
+
+   void SetEntriesPerFile(const std::vector<Long64_t> &entriesPerFile);
 };
 
 } // namespace Experimental
@@ -62,6 +62,10 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
 
    F fExpression;
    ValuesPerSlot_t fLastResults;
+   /// Values of the entries of the current bulk, per slot. Only used in bulk processing mode.
+   std::vector<ValuesPerSlot_t> fBulkResults;
+   /// Per-slot flags that tell which values of the current bulk have already been evaluated.
+   std::vector<RDFInternal::RMaskedEntryRange> fBulkEvaluated;
 
    /// Column readers per slot and per input column
    std::vector<std::array<std::shared_ptr<RColumnReaderBase>, ColumnTypes_t::list_size>> fValues;
@@ -71,27 +75,24 @@ class R__CLING_PTRCHECK(off) RDefine final : public RDefineBase {
    std::unordered_map<std::string, std::unique_ptr<RDefineBase>> fVariedDefines;
 
    template <typename... ColTypes, std::size_t... S>
-   void UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, NoneTag)
+   ret_type EvalHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, NoneTag)
    {
-      fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()] =
-         fExpression(fValues[slot][S]->template Get<ColTypes>(entry)...);
+      return fExpression(fValues[slot][S]->template Get<ColTypes>(entry)...);
       (void)entry; // avoid unused parameter warning (gcc 12.1)
    }
 
    template <typename... ColTypes, std::size_t... S>
-   void UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, SlotTag)
+   ret_type EvalHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, SlotTag)
    {
-      fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()] =
-         fExpression(slot, fValues[slot][S]->template Get<ColTypes>(entry)...);
+      return fExpression(slot, fValues[slot][S]->template Get<ColTypes>(entry)...);
       (void)entry; // avoid unused parameter warning (gcc 12.1)
    }
 
    template <typename... ColTypes, std::size_t... S>
-   void
-   UpdateHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, SlotAndEntryTag)
+   ret_type
+   EvalHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>, SlotAndEntryTag)
    {
-      fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()] =
-         fExpression(slot, entry, fValues[slot][S]->template Get<ColTypes>(entry)...);
+      return fExpression(slot, entry, fValues[slot][S]->template Get<ColTypes>(entry)...);
    }
 
 public:
@@ -99,7 +100,8 @@ public:
            const RDFInternal::RColumnRegister &colRegister, RLoopManager &lm,
            const std::string &variationName = "nominal")
       : RDefineBase(name, type, colRegister, lm, columns, variationName), fExpression(std::move(expression)),
-        fLastResults(lm.GetNSlots() * RDFInternal::CacheLineStep<ret_type>()), fValues(lm.GetNSlots())
+        fLastResults(lm.GetNSlots() * RDFInternal::CacheLineStep<ret_type>()), fBulkResults(lm.GetNSlots()),
+        fBulkEvaluated(lm.GetNSlots()), fValues(lm.GetNSlots())
    {
       fLoopManager->Register(this);
    }
@@ -113,6 +115,7 @@ public:
       RDFInternal::RColumnReadersInfo info{fColumnNames, fColRegister, fIsDefine.data(), *fLoopManager};
       fValues[slot] = RDFInternal::MakeColumnReaders(slot, r, ColumnTypes_t{}, info, fVariation);
       fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = -1;
+      fBulkEvaluated[slot].Invalidate();
    }
 
    /// Return the (type-erased) address of the Define'd value for the given processing slot.
@@ -126,11 +129,39 @@ public:
    {
       if (entry != fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()]) {
          // evaluate this define expression, cache the result
-         UpdateHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{}, ExtraArgsTag{});
+         RDFInternal::RNodeProfiler::RTimer timer(fLoopManager->GetProfiler(), fProfilingKey, slot, entry);
+         fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()] =
+            EvalHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{}, ExtraArgsTag{});
          fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = entry;
       }
    }
 
+   /// In bulk mode, nodes process the whole bulk one after the other, so the value of each entry of the bulk is
+   /// stored separately and evaluated at most once.
+   void *GetEntryValuePtr(unsigned int slot, Long64_t entry) final
+   {
+      auto &evaluated = fBulkEvaluated[slot];
+      if (!evaluated.Contains(entry)) {
+         Update(slot, entry);
+         return GetValuePtr(slot);
+      }
+      const std::size_t idx = entry - evaluated.FirstEntry();
+      auto &values = fBulkResults[slot];
+      if (!evaluated[idx]) {
+         RDFInternal::RNodeProfiler::RTimer timer(fLoopManager->GetProfiler(), fProfilingKey, slot, entry);
+         values[idx] = EvalHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{}, ExtraArgsTag{});
+         evaluated[idx] = true;
+      }
+      return static_cast<void *>(&values[idx]);
+   }
+
+   void InitBulk(unsigned int slot, Long64_t firstEntry, std::size_t bulkSize) final
+   {
+      if (fBulkResults[slot].size() < bulkSize)
+         fBulkResults[slot].resize(bulkSize);
+      fBulkEvaluated[slot].Reset(firstEntry, bulkSize, false);
+   }
+
    void Update(unsigned int /*slot*/, const ROOT::RDF::RSampleInfo &/*id*/) final {}
 
    const std::type_info &GetTypeId() const final { return typeid(ret_type); }
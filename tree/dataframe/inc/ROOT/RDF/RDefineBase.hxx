@@ -17,6 +17,7 @@
 #include "ROOT/RDF/Utils.hxx"
 #include "ROOT/RVec.hxx"
 
+#include <cstddef>
 #include <deque>
 #include <map>
 #include <memory>
@@ -48,6 +49,9 @@ protected:
    ROOT::RVecB fIsDefine;
    std::vector<std::string> fVariationDeps; ///< List of systematic variations that affect the value of this define.
    std::string fVariation;                  ///< This indicates for what variation this define evaluates values.
+   /// Address under which this define is timed when profiling (see RInterface::SetProfiling()): the jitted
+   /// placeholder that forwards to it, if any, as that is the define the computation graph refers to.
+   const void *fProfilingKey = this;
 
 public:
    RDefineBase(std::string_view name, std::string_view type, const RDFInternal::RColumnRegister &colRegister,
@@ -61,9 +65,20 @@ public:
    virtual void *GetValuePtr(unsigned int slot) = 0;
    virtual const std::type_info &GetTypeId() const = 0;
    std::string GetName() const;
+   const void *GetProfilingKey() const { return fProfilingKey; }
+   void SetProfilingKey(const void *key) { fProfilingKey = key; }
    std::string GetTypeName() const;
    /// Update the value at the address returned by GetValuePtr with the content corresponding to the given entry
    virtual void Update(unsigned int slot, Long64_t entry) = 0;
+   /// Update the value for the given entry if needed and return its (type-erased) address.
+   /// In bulk mode the value lives in per-bulk storage, elsewhere it is the address returned by GetValuePtr.
+   virtual void *GetEntryValuePtr(unsigned int slot, Long64_t entry)
+   {
+      Update(slot, entry);
+      return GetValuePtr(slot);
+   }
+   /// Prepare the evaluation of the `bulkSize` entries starting at `firstEntry`, in bulk processing mode.
+   virtual void InitBulk(unsigned int /*slot*/, Long64_t /*firstEntry*/, std::size_t /*bulkSize*/) {}
    /// Update function to be called once per sample, used if the derived type is a RDefinePerSample
    virtual void Update(unsigned int /*slot*/, const ROOT::RDF::RSampleInfo &/*id*/) {}
    /// Clean-up operations to be performed at the end of a task.
@@ -0,0 +1,236 @@
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RDEFINEBULK
+#define ROOT_RDF_RDEFINEBULK
+
+#include "ROOT/RDF/ColumnReaderUtils.hxx"
+#include "ROOT/RDF/RColumnReaderBase.hxx"
+#include "ROOT/RDF/RDefineBase.hxx"
+#include "ROOT/RDF/RLoopManager.hxx"
+#include "ROOT/RDF/Utils.hxx"
+#include "ROOT/RStringView.hxx"
+#include "ROOT/RVec.hxx"
+#include "ROOT/TypeTraits.hxx"
+#include "RtypesCore.h"
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <deque>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility> // std::index_sequence
+#include <vector>
+
+class TTreeReader;
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+template <typename T>
+struct RVecValueType {
+   static_assert(sizeof(T) == 0, "DefineBulk expressions must take and return ROOT::RVec objects");
+};
+
+template <typename T>
+struct RVecValueType<ROOT::RVec<T>> {
+   using type = T;
+};
+
+/// The types of the columns read by a DefineBulk expression, given the types of its ROOT::RVec parameters.
+template <typename List>
+struct BulkColumnTypes;
+
+template <typename... Args>
+struct BulkColumnTypes<ROOT::TypeTraits::TypeList<Args...>> {
+   using type = ROOT::TypeTraits::TypeList<typename RVecValueType<std::decay_t<Args>>::type...>;
+};
+
+template <typename List>
+using BulkColumnTypes_t = typename BulkColumnTypes<List>::type;
+
+} // namespace RDF
+} // namespace Internal
+
+namespace Detail {
+namespace RDF {
+
+using namespace ROOT::TypeTraits;
+
+/// A defined column whose expression is evaluated once per bulk of entries: it receives one ROOT::RVec per input
+/// column with the values of all the entries of the bulk and returns a ROOT::RVec with one value per entry.
+/// Outside of bulk processing mode, the expression is called once per entry with RVecs of size one.
+template <typename F>
+class R__CLING_PTRCHECK(off) RDefineBulk final : public RDefineBase {
+   using ColumnTypes_t = RDFInternal::BulkColumnTypes_t<typename CallableTraits<F>::arg_types>;
+   using TypeInd_t = std::make_index_sequence<ColumnTypes_t::list_size>;
+   using ret_type = typename RDFInternal::RVecValueType<std::decay_t<typename CallableTraits<F>::ret_type>>::type;
+   // Avoid instantiating vector<bool> as `operator[]` returns temporaries in that case. Use std::deque instead.
+   using ValuesPerSlot_t =
+      std::conditional_t<std::is_same<ret_type, bool>::value, std::deque<ret_type>, std::vector<ret_type>>;
+
+   template <typename... ColTypes>
+   static std::tuple<ROOT::RVec<ColTypes>...> MakeInputs(TypeList<ColTypes...>);
+   using Inputs_t = decltype(MakeInputs(ColumnTypes_t{}));
+
+   /// State of one processing slot.
+   struct RSlotData {
+      Inputs_t fInputs;               ///< Values of the input columns for the entries being evaluated
+      ROOT::RVec<ret_type> fResults;  ///< Values of the defined column for the entries being evaluated
+      Long64_t fFirstEntry = -1;      ///< First entry of the current bulk
+      std::size_t fNEntries = 0;      ///< Number of entries of the current bulk
+      bool fEvaluated = false;        ///< Whether fResults holds the values of the current bulk
+   };
+
+   F fExpression;
+   ValuesPerSlot_t fLastResults;
+   std::vector<RSlotData> fSlotData;
+
+   /// Column readers per slot and per input column
+   std::vector<std::array<std::shared_ptr<RColumnReaderBase>, ColumnTypes_t::list_size>> fValues;
+
+   /// Define objects corresponding to systematic variations other than nominal for this defined column.
+   /// The map key is the full variation name, e.g. "pt:up".
+   std::unordered_map<std::string, std::unique_ptr<RDefineBase>> fVariedDefines;
+
+   template <typename... ColTypes, std::size_t... S>
+   void EvalBulk(unsigned int slot, Long64_t firstEntry, std::size_t n, TypeList<ColTypes...>,
+                 std::index_sequence<S...>)
+   {
+      auto &data = fSlotData[slot];
+      // fill the (contiguous) inputs column by column, then evaluate the expression on the whole bulk at once
+      using expander = int[];
+      (void)expander{0, (FillInput<ColTypes>(std::get<S>(data.fInputs), fValues[slot][S].get(), firstEntry, n), 0)...};
+      data.fResults = fExpression(std::get<S>(data.fInputs)...);
+      if (data.fResults.size() != n)
+         throw std::runtime_error("DefineBulk: the expression of column \"" + fName + "\" returned " +
+                                  std::to_string(data.fResults.size()) + " values for " + std::to_string(n) +
+                                  " entries");
+   }
+
+   template <typename T>
+   static void FillInput(ROOT::RVec<T> &input, RColumnReaderBase *reader, Long64_t firstEntry, std::size_t n)
+   {
+      input.resize(n);
+      for (std::size_t i = 0; i < n; ++i)
+         input[i] = reader->template Get<T>(firstEntry + i);
+   }
+
+public:
+   RDefineBulk(std::string_view name, std::string_view type, F expression, const ROOT::RDF::ColumnNames_t &columns,
+               const RDFInternal::RColumnRegister &colRegister, RLoopManager &lm,
+               const std::string &variationName = "nominal")
+      : RDefineBase(name, type, colRegister, lm, columns, variationName), fExpression(std::move(expression)),
+        fLastResults(lm.GetNSlots() * RDFInternal::CacheLineStep<ret_type>()), fSlotData(lm.GetNSlots()),
+        fValues(lm.GetNSlots())
+   {
+      fLoopManager->Register(this);
+   }
+
+   RDefineBulk(const RDefineBulk &) = delete;
+   RDefineBulk &operator=(const RDefineBulk &) = delete;
+   ~RDefineBulk() { fLoopManager->Deregister(this); }
+
+   void InitSlot(TTreeReader *r, unsigned int slot) final
+   {
+      RDFInternal::RColumnReadersInfo info{fColumnNames, fColRegister, fIsDefine.data(), *fLoopManager};
+      fValues[slot] = RDFInternal::MakeColumnReaders(slot, r, ColumnTypes_t{}, info, fVariation);
+      fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = -1;
+      fSlotData[slot].fNEntries = 0;
+      fSlotData[slot].fEvaluated = false;
+   }
+
+   /// Return the (type-erased) address of the Define'd value for the given processing slot.
+   void *GetValuePtr(unsigned int slot) final
+   {
+      return static_cast<void *>(&fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()]);
+   }
+
+   /// Update the value at the address returned by GetValuePtr with the content corresponding to the given entry
+   void Update(unsigned int slot, Long64_t entry) final
+   {
+      if (entry != fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()]) {
+         EvalBulk(slot, entry, 1, ColumnTypes_t{}, TypeInd_t{});
+         fSlotData[slot].fEvaluated = false;
+         fLastResults[slot * RDFInternal::CacheLineStep<ret_type>()] = fSlotData[slot].fResults[0];
+         fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = entry;
+      }
+   }
+
+   /// In bulk mode, the expression is evaluated for all the entries of the bulk the first time one of them is read.
+   void *GetEntryValuePtr(unsigned int slot, Long64_t entry) final
+   {
+      auto &data = fSlotData[slot];
+      if (data.fNEntries == 0 || entry < data.fFirstEntry || entry >= data.fFirstEntry + Long64_t(data.fNEntries)) {
+         Update(slot, entry);
+         return GetValuePtr(slot);
+      }
+      if (!data.fEvaluated) {
+         EvalBulk(slot, data.fFirstEntry, data.fNEntries, ColumnTypes_t{}, TypeInd_t{});
+         data.fEvaluated = true;
+      }
+      return static_cast<void *>(&data.fResults[entry - data.fFirstEntry]);
+   }
+
+   void InitBulk(unsigned int slot, Long64_t firstEntry, std::size_t bulkSize) final
+   {
+      auto &data = fSlotData[slot];
+      data.fFirstEntry = firstEntry;
+      data.fNEntries = bulkSize;
+      data.fEvaluated = false;
+   }
+
+   const std::type_info &GetTypeId() const final { return typeid(ret_type); }
+
+   /// Clean-up operations to be performed at the end of a task.
+   void FinalizeSlot(unsigned int slot) final
+   {
+      for (auto &v : fValues[slot])
+         v.reset();
+
+      for (auto &e : fVariedDefines)
+         e.second->FinalizeSlot(slot);
+   }
+
+   /// Create clones of this Define that work with values in varied "universes".
+   void MakeVariations(const std::vector<std::string> &variations) final
+   {
+      for (const auto &variation : variations) {
+         if (std::find(fVariationDeps.begin(), fVariationDeps.end(), variation) == fVariationDeps.end())
+            continue;
+         if (fVariedDefines.find(variation) != fVariedDefines.end())
+            continue;
+
+         fVariedDefines[variation] = std::unique_ptr<RDefineBase>(
+            new RDefineBulk(fName, fType, fExpression, fColumnNames, fColRegister, *fLoopManager, variation));
+      }
+   }
+
+   /// Return a clone of this Define that works with values in the variationName "universe".
+   RDefineBase &GetVariedDefine(const std::string &variationName) final
+   {
+      auto it = fVariedDefines.find(variationName);
+      if (it == fVariedDefines.end()) {
+         assert(std::find(fVariationDeps.begin(), fVariationDeps.end(), variationName) == fVariationDeps.end());
+         return *this;
+      }
+
+      return *(it->second);
+   }
+};
+
+} // ns RDF
+} // ns Detail
+} // ns ROOT
+
+#endif // ROOT_RDF_RDEFINEBULK
@@ -30,21 +30,14 @@ class R__CLING_PTRCHECK(off) RDefineReader final : public ROOT::Detail::RDF::RCo
    /// Non-owning reference to the node responsible for the custom column. Needed when querying custom values.
    RDFDetail::RDefineBase &fDefine;
 
-   /// Non-owning ptr to the value of a custom column.
-   void *fCustomValuePtr = nullptr;
-
    /// The slot this value belongs to.
    unsigned int fSlot = std::numeric_limits<unsigned int>::max();
 
-   void *GetImpl(Long64_t entry) final
-   {
-      fDefine.Update(fSlot, entry);
-      return fCustomValuePtr;
-   }
+   void *GetImpl(Long64_t entry) final { return fDefine.GetEntryValuePtr(fSlot, entry); }
 
 public:
    RDefineReader(unsigned int slot, RDFDetail::RDefineBase &define, const std::type_info &tid)
-      : fDefine(define), fCustomValuePtr(define.GetValuePtr(slot)), fSlot(slot)
+      : fDefine(define), fSlot(slot)
    {
       CheckReaderTypeMatches(define.GetTypeId(), tid, define.GetName(), "RDefineReader");
    }
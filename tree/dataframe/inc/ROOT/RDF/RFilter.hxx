@@ -92,24 +92,63 @@ public:
    bool CheckFilters(unsigned int slot, Long64_t entry) final
    {
       if (entry != fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()]) {
-         if (!fPrevNode.CheckFilters(slot, entry)) {
+         const auto &mask = fBulkMasks[slot];
+         if (mask.Contains(entry)) {
+            // the entry belongs to the bulk being processed, the filter has already been evaluated
+            fLastResult[slot * RDFInternal::CacheLineStep<int>()] = mask[entry - mask.FirstEntry()];
+         } else if (!fChain.empty()) {
+            // this filter evaluates a chain of unnamed filters in an optimized order
+            fLastResult[slot * RDFInternal::CacheLineStep<int>()] = CheckFilterChain(slot, entry);
+         } else if (!fPrevNode.CheckFilters(slot, entry)) {
             // a filter upstream returned false, cache the result
             fLastResult[slot * RDFInternal::CacheLineStep<int>()] = false;
          } else {
             // evaluate this filter, cache the result
-            auto passed = CheckFilterHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{});
-            passed ? ++fAccepted[slot * RDFInternal::CacheLineStep<ULong64_t>()]
-                   : ++fRejected[slot * RDFInternal::CacheLineStep<ULong64_t>()];
-            fLastResult[slot * RDFInternal::CacheLineStep<int>()] = passed;
+            fLastResult[slot * RDFInternal::CacheLineStep<int>()] = EvalFilter(slot, entry);
          }
          fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = entry;
       }
       return fLastResult[slot * RDFInternal::CacheLineStep<int>()];
    }
 
+   bool EvalFilter(unsigned int slot, Long64_t entry) final
+   {
+      const bool passed = CheckFilterHelper(slot, entry, ColumnTypes_t{}, TypeInd_t{});
+      passed ? ++fAccepted[slot * RDFInternal::CacheLineStep<ULong64_t>()]
+             : ++fRejected[slot * RDFInternal::CacheLineStep<ULong64_t>()];
+      return passed;
+   }
+
+   bool CheckPrevFilters(unsigned int slot, Long64_t entry) final { return fPrevNode.CheckFilters(slot, entry); }
+
+   RFilterBase *GetPrevFilter() final { return dynamic_cast<RFilterBase *>(static_cast<RNodeBase *>(&fPrevNode)); }
+
+   const RDFInternal::RMaskedEntryRange &
+   CheckFiltersBulk(unsigned int slot, Long64_t firstEntry, std::size_t bulkSize) final
+   {
+      auto &mask = fBulkMasks[slot];
+      if (mask.FirstEntry() != firstEntry || mask.Size() != bulkSize) {
+         const auto &prevMask = fPrevNode.CheckFiltersBulk(slot, firstEntry, bulkSize);
+         mask.Reset(firstEntry, bulkSize, false);
+         ULong64_t nAccepted = 0;
+         ULong64_t nRejected = 0;
+         for (std::size_t i = 0; i < bulkSize; ++i) {
+            if (!prevMask[i])
+               continue;
+            const bool passed = CheckFilterHelper(slot, firstEntry + i, ColumnTypes_t{}, TypeInd_t{});
+            mask[i] = passed;
+            passed ? ++nAccepted : ++nRejected;
+         }
+         fAccepted[slot * RDFInternal::CacheLineStep<ULong64_t>()] += nAccepted;
+         fRejected[slot * RDFInternal::CacheLineStep<ULong64_t>()] += nRejected;
+      }
+      return mask;
+   }
+
    template <typename... ColTypes, std::size_t... S>
    bool CheckFilterHelper(unsigned int slot, Long64_t entry, TypeList<ColTypes...>, std::index_sequence<S...>)
    {
+      RDFInternal::RNodeProfiler::RTimer timer(fLoopManager->GetProfiler(), this, slot, entry);
       return fFilter(fValues[slot][S]->template Get<ColTypes>(entry)...);
       // avoid unused parameter warnings (gcc 12.1)
       (void)slot;
@@ -121,6 +160,7 @@ public:
       RDFInternal::RColumnReadersInfo info{fColumnNames, fColRegister, fIsDefine.data(), *fLoopManager};
       fValues[slot] = RDFInternal::MakeColumnReaders(slot, r, ColumnTypes_t{}, info, fVariation);
       fLastCheckedEntry[slot * RDFInternal::CacheLineStep<Long64_t>()] = -1;
+      fBulkMasks[slot].Invalidate();
    }
 
    // recursive chain of `Report`s
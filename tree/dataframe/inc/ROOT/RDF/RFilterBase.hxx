@@ -41,6 +41,7 @@ protected:
    std::vector<int> fLastResult = {true}; // std::vector<bool> cannot be used in a MT context safely
    std::vector<ULong64_t> fAccepted = {0};
    std::vector<ULong64_t> fRejected = {0};
+   std::vector<RDFInternal::RMaskedEntryRange> fBulkMasks; ///< Per-slot selection masks of the last bulk of entries
    const std::string fName;
    const ROOT::RDF::ColumnNames_t fColumnNames;
    RDFInternal::RColumnRegister fColRegister;
@@ -49,6 +50,21 @@ protected:
    std::string fVariation; ///< This indicates for what variation this filter evaluates values.
    std::unordered_map<std::string, std::shared_ptr<RFilterBase>> fVariedFilters;
 
+   /// Per-slot state of the reordering of fChain, see RLoopManager::SetFilterReorderingEntries().
+   struct RFilterChainState {
+      std::vector<std::size_t> fOrder;   ///< Evaluation order of the filters of the chain, as indices in fChain
+      std::vector<double> fCost;         ///< Total time (s) spent evaluating each filter while sampling
+      std::vector<ULong64_t> fNPassed;   ///< Number of sampled entries that passed each filter
+      ULong64_t fNSampled = 0;           ///< Number of sampled entries
+   };
+   /// Chain of consecutive unnamed filters, in declaration order and ending with this filter, that this filter evaluates
+   /// in a measured optimal order. Empty if filter reordering is disabled or this filter is not the end of a chain.
+   std::vector<RFilterBase *> fChain;
+   std::vector<RFilterChainState> fChainStates; ///< Per-slot reordering state of fChain
+
+   bool CheckFilterChain(unsigned int slot, Long64_t entry);
+   void InitFilterChain();
+
 public:
    RFilterBase(RLoopManager *df, std::string_view name, const unsigned int nSlots,
                const RDFInternal::RColumnRegister &colRegister, const ColumnNames_t &columns,
@@ -72,6 +88,14 @@ public:
    /// Clean-up operations to be performed at the end of a task.
    virtual void FinalizeSlot(unsigned int slot) = 0;
    virtual void InitNode();
+
+   /// Evaluate the condition of this filter only, without checking the upstream filters.
+   virtual bool EvalFilter(unsigned int slot, Long64_t entry) = 0;
+   /// Check the filters upstream of this one.
+   virtual bool CheckPrevFilters(unsigned int slot, Long64_t entry) = 0;
+   /// Return the previous node if it is a filter, nullptr otherwise.
+   virtual RFilterBase *GetPrevFilter() = 0;
+   virtual unsigned int GetNChildren() const { return fNChildren; }
 };
 
 } // ns RDF
@@ -18,6 +18,7 @@
 #include "ROOT/RDF/InterfaceUtils.hxx"
 #include "ROOT/RDF/RColumnRegister.hxx"
 #include "ROOT/RDF/RDefine.hxx"
+#include "ROOT/RDF/RDefineBulk.hxx"
 #include "ROOT/RDF/RDefinePerSample.hxx"
 #include "ROOT/RDF/RFilter.hxx"
 #include "ROOT/RDF/RVariation.hxx"
@@ -28,6 +29,7 @@
 #include "ROOT/RDF/RDFDescription.hxx"
 #include "ROOT/RDF/RVariationsDescription.hxx"
 #include "ROOT/RResultPtr.hxx"
+#include "ROOT/RCacheOptions.hxx"
 #include "ROOT/RSnapshotOptions.hxx"
 #include "ROOT/RStringView.hxx"
 #include "ROOT/RVec.hxx"
@@ -453,6 +455,57 @@ public:
    }
    // clang-format on
 
+   // clang-format off
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Define a new column computed by a kernel that processes a whole bulk of entries at once.
+   /// \param[in] name The name of the defined column.
+   /// \param[in] expression Callable of signature RVec<R>(const RVec<T1> &, const RVec<T2> &, ...) that returns the values of the defined column for the entries whose input values it receives.
+   /// \param[in] columns Names of the columns/branches in input to the kernel.
+   /// \return the first node of the computation graph for which the new quantity is defined.
+   ///
+   /// In bulk processing mode (see SetBulkSize()), the kernel is called once per bulk with the values of its input
+   /// columns for all the entries of the bulk, stored contiguously, and must return one value per entry. Kernels
+   /// written with RVec operations or plain loops over the inputs can be vectorized by the compiler, and the bulk is
+   /// a natural unit to offload to an accelerator from within the kernel. The kernel is evaluated for all the entries of
+   /// the bulk, including those rejected by upstream filters, the first time one of its values is needed. Outside of
+   /// bulk processing mode, the kernel is called once per entry with RVecs of size one.
+   ///
+   /// ~~~{.cpp}
+   /// df.SetBulkSize(1024);
+   /// auto r = df.DefineBulk("r", [](const ROOT::RVecD &x, const ROOT::RVecD &y) { return sqrt(x * x + y * y); },
+   ///                        {"x", "y"});
+   /// ~~~
+   template <typename F>
+   RInterface<Proxied, DS_t> DefineBulk(std::string_view name, F expression, const ColumnNames_t &columns = {})
+   {
+      const std::string where = "DefineBulk";
+      RDFInternal::CheckValidCppVarName(name, where);
+      RDFInternal::CheckForRedefinition(where, name, fColRegister, fLoopManager->GetBranchNames(),
+                                        fDataSource ? fDataSource->GetColumnNames() : ColumnNames_t{});
+
+      using NewCol_t = RDFDetail::RDefineBulk<F>;
+      using ColTypes_t = RDFInternal::BulkColumnTypes_t<typename TTraits::CallableTraits<F>::arg_types>;
+      using RetType = typename RDFInternal::RVecValueType<
+         std::decay_t<typename TTraits::CallableTraits<F>::ret_type>>::type;
+      constexpr auto nColumns = ColTypes_t::list_size;
+
+      const auto validColumnNames = GetValidatedColumnNames(nColumns, columns);
+      CheckAndFillDSColumns(validColumnNames, ColTypes_t());
+
+      auto retTypeName = RDFInternal::TypeID2TypeName(typeid(RetType));
+      if (retTypeName.empty())
+         retTypeName = "CLING_UNKNOWN_TYPE_" + RDFInternal::DemangleTypeIdName(typeid(RetType));
+
+      auto newColumn = std::make_shared<NewCol_t>(name, retTypeName, std::move(expression), validColumnNames,
+                                                  fColRegister, *fLoopManager);
+
+      RDFInternal::RColumnRegister newCols(fColRegister);
+      newCols.AddDefine(std::move(newColumn));
+
+      RInterface<Proxied> newInterface(fProxiedPtr, *fLoopManager, std::move(newCols), fDataSource);
+      return newInterface;
+   }
+
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Define a new column.
    /// \param[in] name The name of the defined column.
@@ -1044,6 +1097,21 @@ public:
    /// opts.fLazy = true;
    /// df.Snapshot("outputTree", "outputFile.root", {"x"}, opts);
    /// ~~~
+   ///
+   /// ### Writing an RNTuple
+   ///
+   /// With `RSnapshotOptions::fOutputFormat` set to `ESnapshotOutputFormat::kRNTuple`, Snapshot writes an RNTuple
+   /// called `treename` instead of a TTree (this requires ROOT to be built with `root7=ON`):
+   /// ~~~{.cpp}
+   /// RSnapshotOptions opts;
+   /// opts.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+   /// df.Snapshot("outputNTuple", "outputFile.root", {"x", "y"}, opts);
+   /// ~~~
+   /// In multi-thread runs, each slot fills and compresses its own clusters, which are committed to the output file as
+   /// they are ready without going through a TBufferMerger; as for TTree output, the order of the entries is not
+   /// preserved. The returned RDataFrame reads the RNTuple and is only usable once the event loop has run.
+   /// Writing to a sub-directory and the RSnapshotOptions that only concern TTrees (fAutoFlush, fSplitLevel) are not
+   /// supported for RNTuple output.
    template <typename... ColumnTypes>
    RResultPtr<RInterface<RLoopManager>>
    Snapshot(std::string_view treename, std::string_view filename, const ColumnNames_t &columnList,
@@ -1091,7 +1159,7 @@ public:
                                          colListWithAliasesAndSizeBranches, options});
 
       ::TDirectory::TContext ctxt;
-      auto newRDF = std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, colListNoAliasesWithSizeBranches);
+      auto newRDF = MakeSnapshotOutputDF(fullTreeName, filename, colListNoAliasesWithSizeBranches, *snapHelperArgs);
 
       auto resPtr = CreateAction<RDFInternal::ActionTags::Snapshot, RDFDetail::RInferredType>(
          colListNoAliasesWithSizeBranches, newRDF, snapHelperArgs, colListNoAliasesWithSizeBranches.size());
@@ -1291,6 +1359,86 @@ public:
       return Cache(selectedColumns);
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Save selected columns to a cache file that persists across sessions, or read them from it.
+   /// \param[in] columnList columns to be cached.
+   /// \param[in] cacheDir directory of the cache files. By default, the current working directory.
+   /// \return a `RDataFrame` that reads the cached dataset.
+   ///
+   /// Like Cache(), this action runs the event loop and returns a new `RDataFrame` completely detached from the
+   /// originating one. Instead of storing the columns in memory, it writes them as an RNTuple to a file in `cacheDir`,
+   /// so that it can be used for datasets that do not fit in memory. The name of the file is a hash of the input
+   /// dataset (including size and modification time of local input files), of the computation graph up to this node
+   /// and of the names and types of the cached columns. If such a file already exists, e.g. from a previous session,
+   /// no event loop is run and the returned `RDataFrame` reads the file.
+   ///
+   /// \attention The graph is hashed through the names of its nodes (as shown by SaveGraph()), not through the code of
+   /// the C++ callables of Filters and Defines: after changing such code without changing the name of the nodes, remove
+   /// the file from `cacheDir`. As for Snapshot(), in multi-thread runs the cached entries are shuffled.
+   ///
+   /// This requires ROOT to be built with `root7=ON`.
+   ///
+   /// ### Example usage:
+   /// ~~~{.cpp}
+   /// auto cached = df.Filter("pt > 20", "ptcut").Define("pt2", "pt * pt").PersistentCache({"pt", "pt2"}, "/scratch/rdf");
+   /// ~~~
+   RInterface<RLoopManager> PersistentCache(const ColumnNames_t &columnList, std::string_view cacheDir = "")
+   {
+      const auto columnListWithoutSizeColumns = RDFInternal::FilterArraySizeColNames(columnList, "PersistentCache");
+      const auto validColumnNames =
+         GetValidatedColumnNames(columnListWithoutSizeColumns.size(), columnListWithoutSizeColumns);
+      const auto colTypes = GetValidatedArgTypes(validColumnNames, fColRegister, fLoopManager->GetTree(), fDataSource,
+                                                 "PersistentCache", /*vector2rvec=*/false);
+      const auto fileName =
+         RDFInternal::GetPersistentCacheFileName(*fProxiedPtr, fColRegister, DescribeDataset(), fLoopManager->GetTree(),
+                                                 columnListWithoutSizeColumns, colTypes, cacheDir);
+
+      auto write = [&](const std::string &ntupleName, const std::string &cacheFileName) {
+         RSnapshotOptions options;
+         options.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+         Snapshot(ntupleName, cacheFileName, columnListWithoutSizeColumns, options);
+      };
+      return RDFInternal::GetOrMakePersistentCache(fileName, write);
+   }
+
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Save selected columns in memory, or on disk if they would not fit in a memory budget.
+   /// \param[in] columnList columns to be cached.
+   /// \param[in] options memory budget, and directory of the cache file used above it.
+   /// \return a `RDataFrame` that reads the cached dataset.
+   ///
+   /// Before running the event loop, the size of the cached columns is estimated from the number of entries of the
+   /// input dataset (an upper bound, Filters are not taken into account) and the size per entry of each column: the
+   /// uncompressed size of its branch for columns read from a TTree, the size of its type otherwise (for collections
+   /// this only counts the collection object, not its elements). If the estimate fits in `options.fMemoryBudget`,
+   /// this is Cache(columnList), otherwise PersistentCache(columnList, options.fSpillDirectory).
+   /// When the number of entries of the input is not known, e.g. for most data sources, the columns are cached on disk.
+   ///
+   /// ### Example usage:
+   /// ~~~{.cpp}
+   /// ROOT::RDF::RCacheOptions opts;
+   /// opts.fMemoryBudget = 4ull << 30; // 4 GB
+   /// opts.fSpillDirectory = "/scratch/rdf";
+   /// auto cached = df.Filter("pt > 20").Cache({"pt", "eta"}, opts);
+   /// ~~~
+   RInterface<RLoopManager> Cache(const ColumnNames_t &columnList, const RCacheOptions &options)
+   {
+      if (options.fMemoryBudget == 0)
+         return Cache(columnList);
+
+      const auto columnListWithoutSizeColumns = RDFInternal::FilterArraySizeColNames(columnList, "Cache");
+      const auto validColumnNames =
+         GetValidatedColumnNames(columnListWithoutSizeColumns.size(), columnListWithoutSizeColumns);
+      const auto colTypes = GetValidatedArgTypes(validColumnNames, fColRegister, fLoopManager->GetTree(), fDataSource,
+                                                 "Cache", /*vector2rvec=*/false);
+      const auto estimatedSize =
+         RDFInternal::EstimateCacheSize(fLoopManager->GetTree(), fDataSource != nullptr,
+                                        fLoopManager->GetNEmptyEntries(), validColumnNames, colTypes);
+      if (estimatedSize <= options.fMemoryBudget)
+         return Cache(columnList);
+      return PersistentCache(columnList, options.fSpillDirectory);
+   }
+
    // clang-format off
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Creates a node that filters entries based on range: [begin, end).
@@ -2828,6 +2976,82 @@ public:
    /// ~~~
    unsigned int GetNRuns() const { return fLoopManager->GetNRuns(); }
 
+   /// \brief Process entries in bulks of the given size in the next event loops.
+   /// \param[in] bulkSize Number of entries per bulk, 0 or 1 to process one entry at a time (the default).
+   ///
+   /// In bulk processing mode each node of the computation graph processes a whole bulk of entries before the next
+   /// node runs: Filters compute a selection mask once per bulk and actions only loop over the selected entries,
+   /// which saves the chain of calls through the graph otherwise made for every entry. Defined columns are still
+   /// evaluated at most once per entry. The setting applies to the whole computation graph.
+   ///
+   /// Bulk processing is used for empty sources and for data sources that support it, e.g. RNTuple. TTrees, which are
+   /// read one entry after the other, and graphs with systematic variations are processed one entry at a time.
+   /// Callbacks registered with OnPartialResult are invoked at the end of the bulk in which they become due.
+   ///
+   /// Example usage:
+   /// ~~~{.cpp}
+   /// ROOT::RDataFrame df(1000000);
+   /// df.SetBulkSize(1024);
+   /// auto sum = df.Define("x", [](ULong64_t e) { return e * 0.5; }, {"rdfentry_"}).Filter("x > 10").Sum("x");
+   /// ~~~
+   void SetBulkSize(unsigned int bulkSize) { fLoopManager->SetBulkSize(bulkSize); }
+
+   /// \brief Let chains of unnamed Filters run in the order that minimizes their cost, in the next event loops.
+   /// \param[in] nSampleEntries Number of entries per processing slot used to measure the Filters, 0 to disable
+   ///            the reordering (the default).
+   ///
+   /// A chain of consecutive unnamed Filters, in which every Filter but the last one has no other children than the
+   /// next Filter, selects the entries that pass all of its Filters. With reordering enabled, all the Filters of the
+   /// chain are evaluated for the first `nSampleEntries` entries of each slot to measure their pass rate and cost per
+   /// entry. The remaining entries are checked in increasing order of cost / (1 - pass rate), stopping at the first
+   /// Filter that fails, so that cheap and selective cuts run first regardless of the order in which they are written.
+   ///
+   /// \attention Enabling reordering asserts that the unnamed Filters of the graph commute: each must be safe to
+   /// evaluate on entries rejected by the Filters above it (e.g. `Filter("v.size() > 0").Filter("v[0] > 1")` does not
+   /// qualify) and must not have side effects. Named Filters, whose counts appear in Report(), are never reordered
+   /// and end the chains. Bulk processing (see SetBulkSize()) evaluates Filters in declaration order.
+   ///
+   /// Example usage:
+   /// ~~~{.cpp}
+   /// ROOT::RDataFrame df("t", "f.root");
+   /// df.SetFilterReordering(1000);
+   /// auto h = df.Filter("ExpensiveIsolation(muons)").Filter("nMuon == 2").Histo1D("pt");
+   /// ~~~
+   void SetFilterReordering(ULong64_t nSampleEntries) { fLoopManager->SetFilterReorderingEntries(nSampleEntries); }
+
+   /// \brief Measure the time spent in each node of the computation graph in the next event loops.
+   /// \param[in] everyN Time the nodes for one entry every `everyN` entries, 0 to disable profiling (the default).
+   ///
+   /// The evaluations of Defines, Filters and actions for the sampled entries are timed, and the times are
+   /// extrapolated to all entries. The time of a node excludes the time of the nodes it triggers, e.g. of a Define that
+   /// is evaluated when a Filter first reads the defined column, but includes the time to read its input columns from
+   /// the dataset. To see how much of the reading is spent in I/O and how much in deserialization, use a
+   /// TTreePerfStats on the input TTree. Each timed evaluation reads the clock twice, which is comparable to the cost
+   /// of a simple Filter or Define, so values of `everyN` of 100 or more keep the overhead negligible.
+   ///
+   /// The timings of the last event loop are returned by GetProfile() and shown by SaveGraph().
+   ///
+   /// Example usage:
+   /// ~~~{.cpp}
+   /// ROOT::RDataFrame df("t", "f.root");
+   /// df.SetProfiling(100);
+   /// auto h = df.Define("pt2", "pt * pt").Filter("pt2 > 100").Histo1D("pt2");
+   /// h->Draw();
+   /// for (const auto &node : df.GetProfile())
+   ///    std::cout << node.fKind << " " << node.fName << ": " << node.fTime << " s\n";
+   /// ~~~
+   void SetProfiling(ULong64_t everyN) { fLoopManager->SetProfilingEvery(everyN); }
+
+   /// \brief Return the time spent in the nodes of the computation graph during the last event loop.
+   ///
+   /// The list is empty if the last event loop did not run with profiling enabled, see SetProfiling(). It contains
+   /// the nodes that were timed at least once, in an unspecified order. This method does not trigger the event loop.
+   std::vector<ROOT::RDF::RNodeProfile> GetProfile() const
+   {
+      const auto *profiler = fLoopManager->GetProfiler();
+      return profiler ? profiler->GetProfile() : std::vector<ROOT::RDF::RNodeProfile>{};
+   }
+
    // clang-format off
    ////////////////////////////////////////////////////////////////////////////
    /// \brief Execute a user-defined accumulation operation on the processed column values in each processing slot.
@@ -3247,6 +3471,21 @@ private:
       return *this; // never reached
    }
 
+   ////////////////////////////////////////////////////////////////////////////
+   /// \brief Create the RDataFrame returned by Snapshot.
+   /// For TTree output, this reads the (future) output tree lazily. An RNTuple can only be opened once written, so for
+   /// RNTuple output this returns an empty placeholder that the Snapshot action replaces at the end of the event loop.
+   std::shared_ptr<ROOT::RDataFrame> MakeSnapshotOutputDF(std::string_view fullTreeName, std::string_view filename,
+                                                         const ColumnNames_t &columns,
+                                                         RDFInternal::SnapshotHelperArgs &snapHelperArgs)
+   {
+      if (snapHelperArgs.fOptions.fOutputFormat != ROOT::RDF::ESnapshotOutputFormat::kRNTuple)
+         return std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, columns);
+      auto newRDF = std::make_shared<ROOT::RDataFrame>(ULong64_t(0));
+      snapHelperArgs.fOutputDF = newRDF;
+      return newRDF;
+   }
+
    template <typename... ColumnTypes>
    RResultPtr<RInterface<RLoopManager>> SnapshotImpl(std::string_view fullTreeName, std::string_view filename,
                                                      const ColumnNames_t &columnList, const RSnapshotOptions &options)
@@ -3266,7 +3505,7 @@ private:
          std::string(filename), std::string(dirname), std::string(treename), columnListWithoutSizeColumns, options});
 
       ::TDirectory::TContext ctxt;
-      auto newRDF = std::make_shared<ROOT::RDataFrame>(fullTreeName, filename, validCols);
+      auto newRDF = MakeSnapshotOutputDF(fullTreeName, filename, validCols, *snapHelperArgs);
 
       auto resPtr = CreateAction<RDFInternal::ActionTags::Snapshot, ColumnTypes...>(validCols, newRDF, snapHelperArgs);
 
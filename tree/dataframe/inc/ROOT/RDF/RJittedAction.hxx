@@ -48,6 +48,7 @@ public:
    void SetAction(std::unique_ptr<RActionBase> a) { fConcreteAction = std::move(a); }
 
    void Run(unsigned int slot, Long64_t entry) final;
+   void RunBulk(unsigned int slot, Long64_t firstEntry, std::size_t bulkSize) final;
    void Initialize() final;
    void InitSlot(TTreeReader *r, unsigned int slot) final;
    void TriggerChildrenCount() final;
@@ -57,6 +58,8 @@ public:
    bool HasRun() const final;
    void SetHasRun() final;
 
+   std::string GetActionName() final;
+
    std::shared_ptr<GraphDrawing::GraphNode>
    GetGraph(std::unordered_map<void *, std::shared_ptr<GraphDrawing::GraphNode>> &visitedMap);
 
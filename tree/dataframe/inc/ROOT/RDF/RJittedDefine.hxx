@@ -18,6 +18,7 @@
 #include "RtypesCore.h"
 
 #include <memory>
+#include <string>
 #include <type_traits>
 
 class TTreeReader;
@@ -36,6 +37,8 @@ class RJittedDefine : public RDefineBase {
    /// The expectation is that this always compares equal to fConcreteDefine->GetTypeId() (which however is only
    /// available after jitting). It can be null if TypeName2TypeID failed to figure out this type.
    const std::type_info *fTypeId = nullptr;
+   /// C++ code that books an equivalent typed Define, see ROOT::RDF::Experimental::ExportCode().
+   std::string fExportCode;
 
 public:
    RJittedDefine(std::string_view name, std::string_view type, RLoopManager &lm,
@@ -50,12 +53,20 @@ public:
    }
    ~RJittedDefine();
 
-   void SetDefine(std::unique_ptr<RDefineBase> c) { fConcreteDefine = std::move(c); }
+   void SetDefine(std::unique_ptr<RDefineBase> c)
+   {
+      c->SetProfilingKey(this);
+      fConcreteDefine = std::move(c);
+   }
+
+   void SetExportCode(const std::string &code) { fExportCode = code; }
+   const std::string &GetExportCode() const { return fExportCode; }
 
    void InitSlot(TTreeReader *r, unsigned int slot) final;
    void *GetValuePtr(unsigned int slot) final;
    const std::type_info &GetTypeId() const final;
    void Update(unsigned int slot, Long64_t entry) final;
+   void *GetEntryValuePtr(unsigned int slot, Long64_t entry) final;
    void Update(unsigned int slot, const ROOT::RDF::RSampleInfo &id) final;
    void FinalizeSlot(unsigned int slot) final;
    void MakeVariations(const std::vector<std::string> &variations) final;
@@ -38,15 +38,20 @@ namespace RDFGraphDrawing = ROOT::Internal::RDF::GraphDrawing;
 /// at a later time, from jitted code.
 class RJittedFilter final : public RFilterBase {
    std::unique_ptr<RFilterBase> fConcreteFilter = nullptr;
+   /// C++ code that books an equivalent typed Filter, see ROOT::RDF::Experimental::ExportCode().
+   std::string fExportCode;
 
 public:
    RJittedFilter(RLoopManager *lm, std::string_view name, const std::vector<std::string> &variations);
    ~RJittedFilter();
 
    void SetFilter(std::unique_ptr<RFilterBase> f);
+   void SetExportCode(const std::string &code) { fExportCode = code; }
 
    void InitSlot(TTreeReader *r, unsigned int slot) final;
    bool CheckFilters(unsigned int slot, Long64_t entry) final;
+   const ROOT::Internal::RDF::RMaskedEntryRange &
+   CheckFiltersBulk(unsigned int slot, Long64_t firstEntry, std::size_t bulkSize) final;
    void Report(ROOT::RDF::RCutFlowReport &) const final;
    void PartialReport(ROOT::RDF::RCutFlowReport &) const final;
    void FillReport(ROOT::RDF::RCutFlowReport &) const final;
@@ -58,6 +63,10 @@ public:
    void InitNode() final;
    void AddFilterName(std::vector<std::string> &filters) final;
    void FinalizeSlot(unsigned int slot) final;
+   bool EvalFilter(unsigned int slot, Long64_t entry) final;
+   bool CheckPrevFilters(unsigned int slot, Long64_t entry) final;
+   RFilterBase *GetPrevFilter() final;
+   unsigned int GetNChildren() const final;
    std::shared_ptr<RDFGraphDrawing::GraphNode>
    GetGraph(std::unordered_map<void *, std::shared_ptr<RDFGraphDrawing::GraphNode>> &visitedMap);
    std::shared_ptr<RNodeBase> GetVariedFilter(const std::string &variationName) final;
@@ -14,7 +14,9 @@
 #include "ROOT/InternalTreeUtils.hxx" // RNoCleanupNotifier
 #include "ROOT/RDF/RColumnReaderBase.hxx"
 #include "ROOT/RDF/RDatasetSpec.hxx"
+#include "ROOT/RDF/RMaskedEntryRange.hxx"
 #include "ROOT/RDF/RNodeBase.hxx"
+#include "ROOT/RDF/RNodeProfiler.hxx"
 #include "ROOT/RDF/RNewSampleNotifier.hxx"
 #include "ROOT/RDF/RSampleInfo.hxx"
 
@@ -23,6 +25,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 // forward declarations
@@ -100,6 +103,8 @@ namespace RDFInternal = ROOT::Internal::RDF;
 class RFilterBase;
 class RRangeBase;
 class RDefineBase;
+class RJittedDefine;
+class RJittedFilter;
 using ROOT::RDF::RDataSource;
 
 /// The head node of a RDF computation graph.
@@ -142,6 +147,22 @@ class RLoopManager : public RNodeBase {
    /// Readers for TTree/RDataSource columns (one per slot), shared by all nodes in the computation graph.
    std::vector<std::unordered_map<std::string, std::shared_ptr<RColumnReaderBase>>> fDatasetColumnReaders;
 
+   /// Number of entries processed at once in bulk processing mode, 0 or 1 to process one entry at a time.
+   unsigned int fBulkSize{0};
+   /// Masks with all entries selected returned by CheckFiltersBulk, one per slot.
+   std::vector<RDFInternal::RMaskedEntryRange> fBulkMasks;
+   /// Number of entries per slot used to measure the filters of reorderable filter chains, 0 to disable reordering.
+   ULong64_t fFilterReorderingEntries{0};
+   /// Time the nodes of the graph for one entry every fProfilingEvery in the next event loops, 0 to disable profiling.
+   ULong64_t fProfilingEvery{0};
+   /// Timings of the last event loop run with profiling enabled, null if the last event loop was not profiled.
+   std::unique_ptr<RDFInternal::RNodeProfiler> fProfiler;
+
+   /// Jitted Defines and Filters by a key of their name, expression and inputs, so that identical jitted nodes booked
+   /// in different branches of the graph can be shared. See RDFInterfaceUtils.cxx.
+   std::unordered_map<std::string, std::weak_ptr<RJittedDefine>> fSharedJittedDefines;
+   std::unordered_map<std::string, std::weak_ptr<RJittedFilter>> fSharedJittedFilters;
+
    /// Cache of the tree/chain branch names. Never access directy, always use GetBranchNames().
    ColumnNames_t fValidBranchNames;
 
@@ -154,8 +175,11 @@ class RLoopManager : public RNodeBase {
    void RunDataSourceMT();
    void RunDataSource();
    void RunAndCheckFilters(unsigned int slot, Long64_t entry);
+   void RunAndCheckFiltersBulk(unsigned int slot, Long64_t firstEntry, std::size_t bulkSize);
+   bool CanRunBulk() const;
    void InitNodeSlots(TTreeReader *r, unsigned int slot);
    void InitNodes();
+   void InitProfiler();
    void CleanUpNodes();
    void CleanUpTask(TTreeReader *r, unsigned int slot);
    void EvalChildrenCounts();
@@ -191,6 +215,8 @@ public:
    void Register(RDFInternal::RVariationBase *varPtr);
    void Deregister(RDFInternal::RVariationBase *varPtr);
    bool CheckFilters(unsigned int, Long64_t) final;
+   const RDFInternal::RMaskedEntryRange &
+   CheckFiltersBulk(unsigned int slot, Long64_t firstEntry, std::size_t bulkSize) final;
    unsigned int GetNSlots() const { return fNSlots; }
    void Report(ROOT::RDF::RCutFlowReport &rep) const final;
    /// End of recursive chain of calls, does nothing
@@ -201,6 +227,18 @@ public:
    void ToJitExec(const std::string &) const;
    void RegisterCallback(ULong64_t everyNEvents, std::function<void(unsigned int)> &&f);
    unsigned int GetNRuns() const { return fNRuns; }
+   void SetBulkSize(unsigned int bulkSize) { fBulkSize = bulkSize; }
+   unsigned int GetBulkSize() const { return fBulkSize; }
+   void SetFilterReorderingEntries(ULong64_t nEntries) { fFilterReorderingEntries = nEntries; }
+   ULong64_t GetFilterReorderingEntries() const { return fFilterReorderingEntries; }
+   void SetProfilingEvery(ULong64_t everyN) { fProfilingEvery = everyN; }
+   ULong64_t GetProfilingEvery() const { return fProfilingEvery; }
+   /// Return the profiler of the last event loop, or nullptr if it was not profiled.
+   RDFInternal::RNodeProfiler *GetProfiler() const { return fProfiler.get(); }
+   std::shared_ptr<RJittedDefine> FindSharedJittedDefine(const std::string &key) const;
+   void AddSharedJittedDefine(const std::string &key, const std::shared_ptr<RJittedDefine> &define);
+   std::shared_ptr<RJittedFilter> FindSharedJittedFilter(const std::string &key) const;
+   void AddSharedJittedFilter(const std::string &key, const std::shared_ptr<RJittedFilter> &filter);
    bool HasDataSourceColumnReaders(const std::string &col, const std::type_info &ti) const;
    void AddDataSourceColumnReaders(const std::string &col, std::vector<std::unique_ptr<RColumnReaderBase>> &&readers,
                                    const std::type_info &ti);
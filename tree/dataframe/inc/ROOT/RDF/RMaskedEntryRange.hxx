@@ -0,0 +1,54 @@
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RMASKEDENTRYRANGE
+#define ROOT_RDF_RMASKEDENTRYRANGE
+
+#include "RtypesCore.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace ROOT {
+namespace Internal {
+namespace RDF {
+
+/// A contiguous range of entries together with a mask that tells which of them are selected.
+/// Used in bulk processing mode: filters produce one such mask per bulk of entries, and downstream
+/// nodes only process the entries for which the mask is set.
+class RMaskedEntryRange {
+   std::vector<char> fMask; ///< One flag per entry in the range. std::vector<bool> is avoided on purpose.
+   Long64_t fBegin{-1};     ///< Entry number of the first entry of the range, -1 if the range is not set.
+
+public:
+   Long64_t FirstEntry() const { return fBegin; }
+   std::size_t Size() const { return fMask.size(); }
+   bool operator[](std::size_t idx) const { return fMask[idx]; }
+   char &operator[](std::size_t idx) { return fMask[idx]; }
+
+   /// Return true if the range is set and contains the given entry.
+   bool Contains(Long64_t entry) const { return fBegin >= 0 && entry >= fBegin && entry - fBegin < Long64_t(Size()); }
+
+   /// Make this the range of `size` entries starting at `firstEntry`, with all flags set to `value`.
+   void Reset(Long64_t firstEntry, std::size_t size, bool value)
+   {
+      fBegin = firstEntry;
+      fMask.resize(size);
+      std::fill(fMask.begin(), fMask.end(), value);
+   }
+
+   /// Forget the range, so that Contains() returns false for any entry.
+   void Invalidate() { fBegin = -1; }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif
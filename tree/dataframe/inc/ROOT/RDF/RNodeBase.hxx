@@ -11,9 +11,11 @@
 #ifndef ROOT_RDFNODEBASE
 #define ROOT_RDFNODEBASE
 
+#include "ROOT/RDF/RMaskedEntryRange.hxx"
 #include "RtypesCore.h"
 #include "TError.h" // R__ASSERT
 
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <vector>
@@ -54,6 +56,10 @@ public:
    }
    virtual ~RNodeBase() {}
    virtual bool CheckFilters(unsigned int, Long64_t) = 0;
+   /// Check the filters for the `bulkSize` entries starting at `firstEntry` and return the selection mask.
+   /// The mask stays valid until the next call for the same slot.
+   virtual const ROOT::Internal::RDF::RMaskedEntryRange &
+   CheckFiltersBulk(unsigned int slot, Long64_t firstEntry, std::size_t bulkSize) = 0;
    virtual void Report(ROOT::RDF::RCutFlowReport &) const = 0;
    virtual void PartialReport(ROOT::RDF::RCutFlowReport &) const = 0;
    virtual void IncrChildrenCount() = 0;
@@ -0,0 +1,149 @@
+/*************************************************************************
+ * Copyright (C) 1995-2022, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_RDF_RNODEPROFILER
+#define ROOT_RDF_RNODEPROFILER
+
+#include "RtypesCore.h"
+
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ROOT {
+namespace RDF {
+
+/// Time spent in one node of the computation graph during the last event loop run with profiling enabled.
+/// See RInterface::SetProfiling().
+struct RNodeProfile {
+   std::string fKind;     ///< "Define", "Filter" or "Action"
+   std::string fName;     ///< Name of the node as shown by SaveGraph(), e.g. the defined column or the action
+   ULong64_t fSamples{0}; ///< Number of evaluations of the node that were timed, summed over the slots
+   double fTime{0.};      ///< Estimated time in seconds spent in the node, excluding the time of the nodes it invoked
+};
+
+} // namespace RDF
+
+namespace Internal {
+namespace RDF {
+
+/// Sampled timing of the Defines, Filters and actions of a computation graph during an event loop.
+/// The evaluations of the nodes for one entry every `sampleEvery` are timed; the time of the nodes evaluated
+/// while another node is being timed (e.g. a Define read by a Filter) is subtracted from the time of the latter,
+/// so that the times of all nodes add up to the time spent in the graph. The nodes are registered before the event
+/// loop starts and found by address during the event loop, which only reads the map.
+class RNodeProfiler {
+   using Clock_t = std::chrono::steady_clock;
+
+   struct RSlotData {
+      std::vector<double> fTimes;
+      std::vector<ULong64_t> fSamples;
+      double fNestedTime{0.}; ///< Time of the nodes nested in the one being timed, or in the whole evaluation
+   };
+
+   const ULong64_t fSampleEvery;
+   std::unordered_map<const void *, unsigned int> fNodeIndices;
+   std::vector<ROOT::RDF::RNodeProfile> fNodes;
+   std::vector<RSlotData> fSlotData;
+
+public:
+   /// Times the evaluation of a node for a given entry during its lifetime, if the entry is sampled.
+   class RTimer {
+      RNodeProfiler *fProfiler{nullptr};
+      unsigned int fSlot{0};
+      unsigned int fNodeIdx{0};
+      double fOuterNestedTime{0.};
+      Clock_t::time_point fStart;
+
+   public:
+      RTimer(RNodeProfiler *profiler, const void *node, unsigned int slot, Long64_t entry)
+      {
+         if (!profiler || ULong64_t(entry) % profiler->fSampleEvery != 0)
+            return;
+         const auto it = profiler->fNodeIndices.find(node);
+         if (it == profiler->fNodeIndices.end())
+            return;
+         fProfiler = profiler;
+         fSlot = slot;
+         fNodeIdx = it->second;
+         auto &nested = profiler->fSlotData[slot].fNestedTime;
+         fOuterNestedTime = nested;
+         nested = 0.;
+         fStart = Clock_t::now();
+      }
+      RTimer(const RTimer &) = delete;
+      RTimer &operator=(const RTimer &) = delete;
+      ~RTimer()
+      {
+         if (!fProfiler)
+            return;
+         const double elapsed = std::chrono::duration<double>(Clock_t::now() - fStart).count();
+         auto &data = fProfiler->fSlotData[fSlot];
+         data.fTimes[fNodeIdx] += elapsed - data.fNestedTime;
+         ++data.fSamples[fNodeIdx];
+         data.fNestedTime = fOuterNestedTime + elapsed;
+      }
+   };
+
+   RNodeProfiler(ULong64_t sampleEvery, unsigned int nSlots) : fSampleEvery(sampleEvery), fSlotData(nSlots) {}
+
+   /// Add a node to the profile. Must be called before the event loop starts.
+   void AddNode(const void *node, const std::string &kind, const std::string &name)
+   {
+      if (!fNodeIndices.emplace(node, fNodes.size()).second)
+         return;
+      fNodes.push_back({kind, name, 0ull, 0.});
+      for (auto &data : fSlotData) {
+         data.fTimes.push_back(0.);
+         data.fSamples.push_back(0ull);
+      }
+   }
+
+   /// Stop looking up a node that is being destroyed, so that a new node at the same address is not mistaken for it.
+   /// Its timings are still part of the profile returned by GetProfile().
+   void RemoveNode(const void *node) { fNodeIndices.erase(node); }
+
+   /// Return the profile of the nodes that were evaluated at least once for a sampled entry, with the times
+   /// extrapolated to all entries.
+   std::vector<ROOT::RDF::RNodeProfile> GetProfile() const
+   {
+      std::vector<ROOT::RDF::RNodeProfile> profile;
+      for (std::size_t i = 0; i < fNodes.size(); ++i) {
+         auto node = Collect(i);
+         if (node.fSamples > 0)
+            profile.emplace_back(std::move(node));
+      }
+      return profile;
+   }
+
+   /// Return the profile of the given node, with no samples if the node was never timed or is unknown.
+   ROOT::RDF::RNodeProfile GetProfile(const void *node) const
+   {
+      const auto it = fNodeIndices.find(node);
+      return it == fNodeIndices.end() ? ROOT::RDF::RNodeProfile{} : Collect(it->second);
+   }
+
+private:
+   ROOT::RDF::RNodeProfile Collect(std::size_t idx) const
+   {
+      auto node = fNodes[idx];
+      for (const auto &data : fSlotData) {
+         node.fSamples += data.fSamples[idx];
+         node.fTime += data.fTimes[idx];
+      }
+      node.fTime *= fSampleEvery;
+      return node;
+   }
+};
+
+} // namespace RDF
+} // namespace Internal
+} // namespace ROOT
+
+#endif
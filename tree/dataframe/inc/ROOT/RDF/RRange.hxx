@@ -18,6 +18,7 @@
 
 #include <cassert>
 #include <memory>
+#include <string>
 
 namespace ROOT {
 
@@ -45,6 +46,19 @@ class RRange final : public RRangeBase {
    const std::shared_ptr<PrevNode_t> fPrevNodePtr;
    PrevNode_t &fPrevNode;
 
+   /// Apply the range logic to an entry that passed the upstream filters.
+   bool ApplyRange()
+   {
+      ++fNProcessedEntries;
+      const bool passed = !(fNProcessedEntries <= fStart || (fStop > 0 && fNProcessedEntries > fStop) ||
+                            (fStride != 1 && fNProcessedEntries % fStride != 0));
+      if (fNProcessedEntries == fStop) {
+         fHasStopped = true;
+         fPrevNode.StopProcessing();
+      }
+      return passed;
+   }
+
 public:
    RRange(unsigned int start, unsigned int stop, unsigned int stride, std::shared_ptr<PrevNode_t> pd)
       : RRangeBase(pd->GetLoopManagerUnchecked(), start, stop, stride, pd->GetLoopManagerUnchecked()->GetNSlots(),
@@ -64,29 +78,37 @@ public:
    bool CheckFilters(unsigned int slot, Long64_t entry) final
    {
       if (entry != fLastCheckedEntry) {
-         if (fHasStopped)
+         if (fBulkMask.Contains(entry)) {
+            // the entry belongs to the bulk being processed, the range has already been applied
+            fLastResult = fBulkMask[entry - fBulkMask.FirstEntry()];
+         } else if (fHasStopped) {
             return false;
-         if (!fPrevNode.CheckFilters(slot, entry)) {
+         } else if (!fPrevNode.CheckFilters(slot, entry)) {
             // a filter upstream returned false, cache the result
             fLastResult = false;
          } else {
             // apply range filter logic, cache the result
-            ++fNProcessedEntries;
-            if (fNProcessedEntries <= fStart || (fStop > 0 && fNProcessedEntries > fStop) ||
-                (fStride != 1 && fNProcessedEntries % fStride != 0))
-               fLastResult = false;
-            else
-               fLastResult = true;
-            if (fNProcessedEntries == fStop) {
-               fHasStopped = true;
-               fPrevNode.StopProcessing();
-            }
+            fLastResult = ApplyRange();
          }
          fLastCheckedEntry = entry;
       }
       return fLastResult;
    }
 
+   const RDFInternal::RMaskedEntryRange &
+   CheckFiltersBulk(unsigned int slot, Long64_t firstEntry, std::size_t bulkSize) final
+   {
+      if (fBulkMask.FirstEntry() != firstEntry || fBulkMask.Size() != bulkSize) {
+         const auto &prevMask = fPrevNode.CheckFiltersBulk(slot, firstEntry, bulkSize);
+         fBulkMask.Reset(firstEntry, bulkSize, false);
+         for (std::size_t i = 0; i < bulkSize && !fHasStopped; ++i) {
+            if (prevMask[i])
+               fBulkMask[i] = ApplyRange();
+         }
+      }
+      return fBulkMask;
+   }
+
    // recursive chain of `Report`s
    // RRange simply forwards these calls to the previous node
    void Report(ROOT::RDF::RCutFlowReport &rep) const final { fPrevNode.PartialReport(rep); }
@@ -127,6 +149,8 @@ public:
          return thisNode;
       }
       thisNode->SetPrevNode(prevNode);
+      thisNode->SetCode(".Range(" + std::to_string(fStart) + ", " + std::to_string(fStop) + ", " +
+                        std::to_string(fStride) + ")");
 
       // If there have been some defines between the last Filter and this Range node we won't detect them:
       // Ranges don't keep track of Defines (they have no RColumnRegister data member).
@@ -40,6 +40,7 @@ protected:
    bool fLastResult{true};
    ULong64_t fNProcessedEntries{0};
    bool fHasStopped{false};    ///< True if the end of the range has been reached
+   ROOT::Internal::RDF::RMaskedEntryRange fBulkMask; ///< Selection mask of the last bulk of entries
    const unsigned int fNSlots; ///< Number of thread slots used by this node, inherited from parent node.
    std::unordered_map<std::string, std::shared_ptr<RRangeBase>> fVariedRanges;
 
@@ -45,6 +45,12 @@ class R__CLING_PTRCHECK(off) RVariedAction final : public RActionBase {
    std::vector<Helper> fHelpers; ///< Action helpers per variation.
    /// Owning pointers to upstream nodes for each systematic variation (with the "nominal" at index 0).
    std::vector<std::shared_ptr<PrevNodeType>> fPrevNodes;
+   /// The distinct upstream nodes: variations that do not affect the upstream Filters share the nominal node.
+   std::vector<PrevNodeType *> fDistinctPrevNodes;
+   /// Index in fDistinctPrevNodes of the upstream node of each variation.
+   std::vector<unsigned int> fPrevNodeIdxs;
+   /// Per slot, whether the current entry passes each of the distinct upstream nodes.
+   std::vector<std::vector<char>> fPassed;
 
    /// Column readers per slot (outer dimension), per variation and per input column (inner dimension, std::array).
    std::vector<std::vector<std::array<std::shared_ptr<RColumnReaderBase>, ColumnTypes_t::list_size>>> fInputValues;
@@ -75,6 +81,17 @@ class R__CLING_PTRCHECK(off) RVariedAction final : public RActionBase {
       return prevFilters;
    }
 
+   void SetDistinctPrevNodes()
+   {
+      for (const auto &prevNode : fPrevNodes) {
+         auto it = std::find(fDistinctPrevNodes.begin(), fDistinctPrevNodes.end(), prevNode.get());
+         if (it == fDistinctPrevNodes.end())
+            it = fDistinctPrevNodes.insert(fDistinctPrevNodes.end(), prevNode.get());
+         fPrevNodeIdxs.push_back(std::distance(fDistinctPrevNodes.begin(), it));
+      }
+      fPassed.resize(GetNSlots(), std::vector<char>(fDistinctPrevNodes.size()));
+   }
+
 public:
    RVariedAction(std::vector<Helper> &&helpers, const ColumnNames_t &columns, std::shared_ptr<PrevNode> prevNode,
                  const RColumnRegister &colRegister)
@@ -82,6 +99,7 @@ public:
         fHelpers(std::move(helpers)), fPrevNodes(MakePrevFilters(prevNode)), fInputValues(GetNSlots())
    {
       fLoopManager->Register(this);
+      SetDistinctPrevNodes();
 
       for (auto i = 0u; i < columns.size(); ++i) {
          auto *define = colRegister.GetDefine(columns[i]);
@@ -120,14 +138,34 @@ public:
       (void)entry;
    }
 
+   /// Check each distinct upstream node once, then run the helpers of the variations whose upstream node passed.
+   /// With many variations that only affect the action's inputs, the entries rejected by the nominal Filters cost a
+   /// single check rather than one per variation.
    void Run(unsigned int slot, Long64_t entry) final
    {
-      for (auto varIdx = 0u; varIdx < GetVariations().size(); ++varIdx) {
-         if (fPrevNodes[varIdx]->CheckFilters(slot, entry))
+      auto &passed = fPassed[slot];
+      bool anyPassed = false;
+      for (std::size_t i = 0; i < fDistinctPrevNodes.size(); ++i) {
+         passed[i] = fDistinctPrevNodes[i]->CheckFilters(slot, entry);
+         anyPassed |= bool(passed[i]);
+      }
+      if (!anyPassed)
+         return;
+
+      const auto nVariations = fPrevNodeIdxs.size();
+      for (std::size_t varIdx = 0u; varIdx < nVariations; ++varIdx) {
+         if (passed[fPrevNodeIdxs[varIdx]])
             CallExec(slot, varIdx, entry, ColumnTypes_t{}, TypeInd_t{});
       }
    }
 
+   /// Varied actions are never run in bulk mode (see RLoopManager::CanRunBulk), process one entry at a time.
+   void RunBulk(unsigned int slot, Long64_t firstEntry, std::size_t bulkSize) final
+   {
+      for (std::size_t i = 0; i < bulkSize; ++i)
+         Run(slot, firstEntry + i);
+   }
+
    void TriggerChildrenCount() final
    {
       std::for_each(fPrevNodes.begin(), fPrevNodes.end(), [](auto &f) { f->IncrChildrenCount(); });
@@ -154,6 +192,8 @@ public:
    /// Return the per-sample callback connected to the nominal result.
    ROOT::RDF::SampleCallback_t GetSampleCallback() final { return fHelpers[0].GetSampleCallback(); }
 
+   std::string GetActionName() final { return "Varied " + fHelpers[0].GetActionName(); }
+
    std::shared_ptr<RDFGraphDrawing::GraphNode>
    GetGraph(std::unordered_map<void *, std::shared_ptr<RDFGraphDrawing::GraphNode>> &visitedMap) final
    {
@@ -162,8 +202,7 @@ public:
 
       // Action nodes do not need to go through CreateFilterNode: they are never common nodes between multiple branches
       const auto nodeType = HasRun() ? RDFGraphDrawing::ENodeType::kUsedAction : RDFGraphDrawing::ENodeType::kAction;
-      auto thisNode = std::make_shared<RDFGraphDrawing::GraphNode>("Varied " + fHelpers[0].GetActionName(),
-                                                                   visitedMap.size(), nodeType);
+      auto thisNode = std::make_shared<RDFGraphDrawing::GraphNode>(GetActionName(), visitedMap.size(), nodeType);
       visitedMap[(void *)this] = thisNode;
 
       auto upmostNode = AddDefinesToGraph(thisNode, GetColRegister(), prevColumns, visitedMap);
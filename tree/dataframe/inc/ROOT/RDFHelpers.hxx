@@ -184,6 +184,55 @@ void RunGraphs(std::vector<RResultHandle> handles);
 
 namespace Experimental {
 
+/// \brief Set the directory in which the compiled expressions of jitted Filters and Defines are cached.
+/// \param[in] dir The cache directory, created if needed. An empty string disables the cache.
+///
+/// With a cache directory set, each string expression passed to Filter, Define etc. is compiled with ACLiC into a
+/// library stored in `dir` and named after a hash of the generated code, instead of being compiled by the interpreter.
+/// Later sessions that use the same expression load the library instead of compiling it again. Compiling the
+/// library is slower than jitting, so this pays off for expressions that are used by many short jobs.
+/// Expressions that cannot be compiled outside of the interpreter (e.g. because they use functions or types that were
+/// only declared to the interpreter) are remembered as such and jitted as usual.
+///
+/// The initial value is taken from the `RDataFrame.JitCacheDir` entry of the ROOT configuration (`.rootrc`).
+void SetJitCacheDir(std::string_view dir);
+
+/// \brief Return the directory in which compiled expressions are cached, empty if the cache is disabled.
+/// See SetJitCacheDir().
+const std::string &GetJitCacheDir();
+
+// clang-format off
+/// \brief Export the computation graph as C++ code that books its nodes with concrete types.
+/// \param[in] node any node of the graph. The entire graph the node belongs to is exported.
+/// \param[in] functionName name of the function in the exported code.
+/// \return The code of a translation unit that defines `std::vector<RNode> functionName(RNode df)`.
+///
+/// The exported function books on `df` the Defines, DefinePerSamples, Filters and Ranges that lead to the actions of
+/// the graph, with the string expressions replaced by lambdas that take the column types that were inferred when the
+/// expressions were jitted. It returns the nodes on which the actions were booked, and a comment names each action.
+/// A program compiled together with the exported code can then create the RDataFrame and book the actions with
+/// explicit template arguments, e.g. `nodes[0].Histo1D<float>("x")`, so that nothing is compiled by the interpreter.
+///
+/// ~~~{.cpp}
+/// ROOT::RDataFrame df("t", "f.root");
+/// auto h = df.Define("y", "x * 2").Filter("y > 1").Histo1D("y");
+/// std::ofstream("graph.cxx") << ROOT::RDF::Experimental::ExportCode(df);
+/// ~~~
+///
+/// Only Defines and Filters booked with string expressions can be exported: an exception is thrown if the graph
+/// contains nodes booked with C++ callables (whose types are already known at compile time) or results with
+/// systematic variations. Aliases are replaced by the columns they refer to, and Filters and Ranges without actions
+/// downstream are not exported.
+///
+/// Note that ExportCode is not thread-safe and must not be called concurrently from different threads.
+// clang-format on
+template <typename NodeType>
+std::string ExportCode(NodeType node, const std::string &functionName = "BuildGraph")
+{
+   ROOT::Internal::RDF::GraphDrawing::GraphCreatorHelper helper;
+   return helper.ExportCode(node, functionName);
+}
+
 /// \brief Produce all required systematic variations for the given result.
 /// \param[in] resPtr The result for which variations should be produced.
 /// \return A \ref ROOT::RDF::Experimental::RResultMap "RResultMap" object with full variation names as strings
@@ -198,6 +198,12 @@ public:
    // clang-format on
    virtual bool SetEntry(unsigned int slot, ULong64_t entry) = 0;
 
+   /// \brief Return true if the data source supports bulk processing.
+   /// In bulk processing mode (see RLoopManager::SetBulkSize), SetEntry() is not called: the column readers returned
+   /// by GetColumnReaders() must be able to read any entry of the range being processed by a slot, in any order,
+   /// and all entries of the range must be processed.
+   virtual bool SupportsBulkProcessing() const { return false; }
+
    // clang-format off
    /// \brief Convenience method called before starting an event-loop.
    /// This method might be called multiple times over the lifetime of a RDataSource, since
@@ -58,6 +58,14 @@ class RNTupleDS final : public ROOT::RDF::RDataSource {
    unsigned fNSlots = 0;
    bool fHasSeenAllRanges = false;
 
+   /// A cluster-level selection on the values of a field, see AddValueRangeFilter()
+   struct RValueRangeFilter {
+      DescriptorId_t fFieldId;
+      double fMin;
+      double fMax;
+   };
+   std::vector<RValueRangeFilter> fValueRangeFilters;
+
    /// Provides the RDF column "colName" given the field identified by fieldID. For records and collections,
    /// AddField recurses into the sub fields. The skeinIDs is the list of field IDs of the outer collections
    /// of fieldId. For instance, if fieldId refers to an `std::vector<Jet>`, with
@@ -82,6 +90,14 @@ public:
    std::string GetLabel() final { return "RNTupleDS"; }
 
    bool SetEntry(unsigned int slot, ULong64_t entry) final;
+   bool SupportsBulkProcessing() const final { return true; }
+
+   /// Only read the clusters that, according to the column statistics, may contain entries where the value of the
+   /// given field is in [min, max].  This is an I/O optimization; the entries of the remaining clusters still need
+   /// to be selected by a Filter().  Requires that the ntuple has been written with column statistics (see
+   /// RNTupleWriteOptions::SetUseColumnStatistics()), otherwise no cluster is skipped.  Throws if the field does
+   /// not exist.  Several filters select the clusters that pass all of them.
+   void AddValueRangeFilter(std::string_view fieldName, double min, double max);
 
    void Initialize() final;
    void Finalize() final;
@@ -48,6 +48,9 @@ is used:
   - For expressions ("SELECT 1+1 FROM table"), the type of the first row of the result set determines the column type.
     That can result in a column to be of thought of type NULL where subsequent rows actually have meaningful values.
     The provided SELECT query can be used to avoid such ambiguities.
+
+The SQlite query is stepped by a single thread. In multi-threaded mode, the rows are read in batches whose entries are
+distributed over the processing slots, so that the rest of the computation graph runs in parallel.
 */
 class RSqliteDS final : public ROOT::RDF::RDataSource {
 private:
@@ -77,14 +80,25 @@ private:
    };
 
    void SqliteError(int errcode);
+   void ReadRow(Value_t *row);
+
+   /// Number of rows read per slot in each call to GetEntryRanges() in multi-threaded mode.
+   static constexpr unsigned int fgRowsPerSlot = 1024;
 
    std::unique_ptr<Internal::RSqliteDSDataSet> fDataSet;
    unsigned int fNSlots;
    ULong64_t fNRow;
    std::vector<std::string> fColumnNames;
    std::vector<ETypes> fColumnTypes;
-   /// The data source is inherently single-threaded and returns only one row at a time. This vector holds the results.
+   /// The values of the columns of the current row.
+   /// In multi-threaded mode, this only tells which columns are active and the values are stored in fSlotValues.
    std::vector<Value_t> fValues;
+   /// The values of the current entry of every slot, only used in multi-threaded mode.
+   std::vector<std::vector<Value_t>> fSlotValues;
+   /// The rows of the current batch, one after the other, only used in multi-threaded mode.
+   std::vector<Value_t> fBatch;
+   /// The entry number of the first row in fBatch.
+   ULong64_t fBatchFirstRow;
 
    // clang-format off
    /// Corresponds to the types defined in ETypes.
@@ -104,8 +104,9 @@ private:
       auto offset = array.value_offset(entry);
       // Here the cast to void* is a worksround while we figure out the
       // issues we have with long long types, signed and unsigned.
-      RVec<T> tmp(reinterpret_cast<T *>((void *)values->raw_values()) + offset, array.value_length(entry));
-      std::swap(cache, tmp);
+      // The RVec does not own its elements: it is a view on the values of the Arrow array.
+      RVec<T> view(reinterpret_cast<T *>((void *)values->raw_values()) + offset, array.value_length(entry));
+      std::swap(cache, view);
       return (void *)(&cache);
    }
 
@@ -161,7 +162,9 @@ public:
 
    virtual arrow::Status Visit(arrow::StringArray const &array) final
    {
-      fCachedString = array.GetString(fCurrentEntry);
+      // reuse the memory of the cached string rather than allocating a new one for each entry
+      const auto view = array.GetView(fCurrentEntry);
+      fCachedString.assign(view.data(), view.size());
       *fResult = reinterpret_cast<void *>(&fCachedString);
       return arrow::Status::OK();
    }
@@ -200,6 +203,21 @@ public:
    using ::arrow::ArrayVisitor::Visit;
 };
 
+/// Return the size in bytes of the values of an array of the given type if they can be read in place
+/// from the Arrow buffer, 0 otherwise.
+static size_t GetFixedWidthValueSize(arrow::Type::type typeId)
+{
+   switch (typeId) {
+   case arrow::Type::INT32: return sizeof(int32_t);
+   case arrow::Type::INT64: return sizeof(int64_t);
+   case arrow::Type::UINT32: return sizeof(uint32_t);
+   case arrow::Type::UINT64: return sizeof(uint64_t);
+   case arrow::Type::FLOAT: return sizeof(float);
+   case arrow::Type::DOUBLE: return sizeof(double);
+   default: return 0;
+   }
+}
+
 /// Helper class which keeps track for each slot where to get the entry.
 class TValueGetter {
 private:
@@ -208,6 +226,10 @@ private:
    std::vector<ULong64_t> fLastChunkPerSlot;
    std::vector<ULong64_t> fFirstEntryPerChunk;
    std::vector<ArrayPtrVisitor> fArrayVisitorPerSlot;
+   /// For fixed-width values, the address of the first value of the current chunk of each slot.
+   /// Entries in the same chunk are then read in place, without visiting the array.
+   std::vector<const char *> fChunkValuesPerSlot;
+   size_t fValueSize = 0; ///< Size of the values if they are read in place, 0 otherwise
    /// Since data can be chunked in different arrays we need to construct an
    /// index which contains the first element of each chunk, so that we can
    /// quickly move to the correct chunk.
@@ -216,8 +238,11 @@ private:
 
 public:
    TValueGetter(size_t slots, arrow::ArrayVector chunks)
-      : fValuesPtrPerSlot(slots, nullptr), fLastEntryPerSlot(slots, 0), fLastChunkPerSlot(slots, 0), fChunks{chunks}
+      : fValuesPtrPerSlot(slots, nullptr), fLastEntryPerSlot(slots, 0), fLastChunkPerSlot(slots, 0),
+        fChunkValuesPerSlot(slots, nullptr), fChunks{chunks}
    {
+      if (!fChunks.empty())
+         fValueSize = GetFixedWidthValueSize(fChunks.front()->type_id());
       fChunkIndex.reserve(fChunks.size());
       size_t next = 0;
       for (auto &chunk : chunks) {
@@ -265,7 +290,8 @@ public:
       // Notice that we need to find the entry
       auto chunk = fChunks.at(fLastChunkPerSlot[slot]);
       assert(slot < fArrayVisitorPerSlot.size());
-      fArrayVisitorPerSlot[slot].SetEntry(entry - fFirstEntryPerChunk[fLastChunkPerSlot[slot]]);
+      const auto entryInChunk = entry - fFirstEntryPerChunk[fLastChunkPerSlot[slot]];
+      fArrayVisitorPerSlot[slot].SetEntry(entryInChunk);
       fLastEntryPerSlot[slot] = entry;
       auto status = chunk->Accept(fArrayVisitorPerSlot.data() + slot);
       if (!status.ok()) {
@@ -273,6 +299,8 @@ public:
          msg += std::to_string(slot) + " looking at entry " + std::to_string(entry);
          throw std::runtime_error(msg);
       }
+      if (fValueSize > 0)
+         fChunkValuesPerSlot[slot] = static_cast<const char *>(fValuesPtrPerSlot[slot]) - entryInChunk * fValueSize;
    }
 
    /// Set the current entry to be retrieved
@@ -282,6 +310,15 @@ public:
       if (fLastEntryPerSlot[slot] == entry) {
          return;
       }
+      // Fixed-width value in the same chunk as the previous entry: point directly into the Arrow buffer
+      const auto chunkIdx = fLastChunkPerSlot[slot];
+      if (fValueSize > 0 && fChunkValuesPerSlot[slot] && entry >= fFirstEntryPerChunk[chunkIdx] &&
+          entry < fChunkIndex[chunkIdx]) {
+         fValuesPtrPerSlot[slot] =
+            (void *)(fChunkValuesPerSlot[slot] + (entry - fFirstEntryPerChunk[chunkIdx]) * fValueSize);
+         fLastEntryPerSlot[slot] = entry;
+         return;
+      }
       UncachedSlotLookup(slot, entry);
    }
 };
@@ -71,6 +71,8 @@ double-quote characters must be represented by a pair of double-quote characters
 The current implementation of RCsvDS reads the entire CSV file content into memory before
 RDataFrame starts processing it. Therefore, before creating a CSV RDataFrame, it is
 important to check both how much memory is available and the size of the CSV file.
+If implicit multi-threading is enabled, the lines are read sequentially but parsed in parallel
+by the tasks of the ROOT thread pool.
 
 RCsvDS can handle empty cells and also allows the usage of the special keywords "NaN" and "nan" to
 indicate `nan` values. If the column is of type double, these cells are stored internally as `nan`.
@@ -83,11 +85,14 @@ Empty cells and explicit `nan`-s inside columns of type Long64_t/bool are stored
 #include <ROOT/RCsvDS.hxx>
 #include <ROOT/RRawFile.hxx>
 #include <TError.h>
+#include <TROOT.h>
+#ifdef R__USE_IMT
+#include <ROOT/TThreadExecutor.hxx>
+#endif
 
 #include <algorithm>
 #include <iostream>
 #include <memory>
-#include <sstream>
 #include <string>
 
 namespace ROOT {
@@ -119,14 +124,16 @@ void RCsvDS::FillHeaders(const std::string &line)
    }
 }
 
-void RCsvDS::FillRecord(const std::string &line, Record_t &record)
+/// Parse a line into a record, adding to colContainingEmpty the names of the columns of type Long64_t or bool
+/// with an empty cell. This method can be called concurrently for different lines.
+void RCsvDS::FillRecord(const std::string &line, Record_t &record, std::set<std::string> &colContainingEmpty)
 {
    auto i = 0U;
 
    auto columns = ParseColumns(line);
 
    for (auto &col : columns) {
-      auto colType = fColTypes[fHeaders[i]];
+      auto colType = fColTypes.at(fHeaders[i]);
 
       switch (colType) {
       case 'D': {
@@ -137,7 +144,7 @@ void RCsvDS::FillRecord(const std::string &line, Record_t &record)
          if (col != "nan") {
             record.emplace_back(new Long64_t(std::stoll(col)));
          } else {
-            fColContainingEmpty.insert(fHeaders[i]);
+            colContainingEmpty.insert(fHeaders[i]);
             record.emplace_back(new Long64_t(0));
          }
          break;
@@ -146,9 +153,9 @@ void RCsvDS::FillRecord(const std::string &line, Record_t &record)
          auto b = new bool();
          record.emplace_back(b);
          if (col != "nan") {
-            std::istringstream(col) >> std::boolalpha >> *b;
+            *b = col == "true";
          } else {
-            fColContainingEmpty.insert(fHeaders[i]);
+            colContainingEmpty.insert(fHeaders[i]);
             *b = false;
          }
          break;
@@ -162,6 +169,36 @@ void RCsvDS::FillRecord(const std::string &line, Record_t &record)
    }
 }
 
+/// Parse the lines into new records, appended to fRecords.
+/// If implicit multi-threading is enabled, the lines are split into ranges that are parsed concurrently.
+void RCsvDS::FillRecords(const std::vector<std::string> &lines)
+{
+   const auto nLines = lines.size();
+   const auto firstRecord = fRecords.size();
+   fRecords.resize(firstRecord + nLines);
+   auto fillRange = [&](std::size_t begin, std::size_t end, std::set<std::string> &colContainingEmpty) {
+      for (auto i = begin; i < end; ++i)
+         FillRecord(lines[i], fRecords[firstRecord + i], colContainingEmpty);
+   };
+
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled() && nLines > 1) {
+      // a few ranges per worker, so that the load is balanced even if lines have different lengths
+      const auto nRanges = std::min<std::size_t>(4 * ROOT::GetThreadPoolSize(), nLines);
+      std::vector<std::set<std::string>> colsContainingEmpty(nRanges);
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(
+         [&](unsigned int r) { fillRange(nLines * r / nRanges, nLines * (r + 1) / nRanges, colsContainingEmpty[r]); },
+         ROOT::TSeqU(nRanges));
+      for (const auto &cols : colsContainingEmpty)
+         fColContainingEmpty.insert(cols.begin(), cols.end());
+      return;
+   }
+#endif
+
+   fillRange(0, nLines, fColContainingEmpty);
+}
+
 void RCsvDS::GenerateHeaders(size_t size)
 {
    fHeaders.reserve(size);
@@ -301,7 +338,11 @@ size_t RCsvDS::ParseValue(const std::string &line, std::vector<std::string> &col
             val += line[++i];
          }
       } else {
-         val += line[i];
+         // copy at once all characters up to the next delimiter or quote
+         const char specialChars[] = {fDelimiter, '"'};
+         const auto next = std::min(line.find_first_of(specialChars, i + 1, 2), line.size());
+         val.append(line, i, next - i);
+         i = next - 1;
       }
    }
 
@@ -429,13 +470,20 @@ std::vector<std::pair<ULong64_t, ULong64_t>> RCsvDS::GetEntryRanges()
    auto linesToRead = fLinesChunkSize;
    FreeRecords();
 
+   // Lines are read sequentially and parsed in batches, in parallel if implicit multi-threading is enabled
+   constexpr std::size_t batchSize = 65536;
+   std::vector<std::string> lines;
    std::string line;
    while ((-1LL == fLinesChunkSize || 0 != linesToRead) && fCsvFile->Readln(line)) {
       if (line.empty()) continue; // skip empty lines
-      fRecords.emplace_back();
-      FillRecord(line, fRecords.back());
+      lines.emplace_back(std::move(line));
+      if (lines.size() == batchSize) {
+         FillRecords(lines);
+         lines.clear();
+      }
       --linesToRead;
    }
+   FillRecords(lines);
 
    if (!fColContainingEmpty.empty()) {
       std::string msg = "";
@@ -10,6 +10,14 @@
 
 #include "ROOT/RDF/ActionHelpers.hxx"
 
+#ifdef R__ENABLE_RNTUPLE
+#include "ROOT/RNTuple.hxx"
+#include "ROOT/RNTupleDS.hxx"
+#include "ROOT/RNTupleModel.hxx"
+#include "ROOT/RNTupleOptions.hxx"
+#include "ROOT/RField.hxx"
+#endif
+
 namespace ROOT {
 namespace Internal {
 namespace RDF {
@@ -265,6 +273,111 @@ void ValidateSnapshotOutput(const RSnapshotOptions &opts, const std::string &tre
    }
 }
 
+#ifdef R__ENABLE_RNTUPLE
+namespace {
+
+/// Writes the output of SnapshotRNTupleHelper through an RNTupleParallelWriter: every slot has its own fill context
+/// and entry, so that slots fill (and compress) their clusters concurrently and only the commit of the clusters to
+/// the common page sink is serialized.
+class RSnapshotNTupleWriterImpl final : public RSnapshotNTupleWriter {
+   std::string fFileName;
+   std::string fNTupleName;
+   std::shared_ptr<ROOT::RDF::RInterface<RLoopManager, void>> fOutputDF;
+   std::unique_ptr<TFile> fOutputFile; // only set in "UPDATE" mode, must outlive fWriter
+   std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter> fWriter;
+   std::vector<std::shared_ptr<ROOT::Experimental::RNTupleFillContext>> fFillContexts;
+   std::vector<std::unique_ptr<ROOT::Experimental::REntry>> fEntries;
+
+public:
+   RSnapshotNTupleWriterImpl(const std::string &fileName, const std::string &ntupleName, const ColumnNames_t &fieldNames,
+                             const std::vector<std::string> &typeNames, const RSnapshotOptions &options,
+                             unsigned int nSlots, const std::shared_ptr<ROOT::RDF::RInterface<RLoopManager, void>> &df)
+      : fFileName(fileName), fNTupleName(ntupleName), fOutputDF(df), fFillContexts(nSlots), fEntries(nSlots)
+   {
+      using ROOT::Experimental::RNTupleParallelWriter;
+
+      auto model = ROOT::Experimental::RNTupleModel::CreateBare();
+      for (std::size_t i = 0; i < fieldNames.size(); ++i)
+         model->AddField(ROOT::Experimental::Detail::RFieldBase::Create(fieldNames[i], typeNames[i]).Unwrap());
+
+      ROOT::Experimental::RNTupleWriteOptions writeOptions;
+      writeOptions.SetCompression(ROOT::CompressionSettings(options.fCompressionAlgorithm, options.fCompressionLevel));
+
+      TString fileMode = options.fMode;
+      fileMode.ToLower();
+      if (fileMode == "recreate") {
+         fWriter = RNTupleParallelWriter::Recreate(std::move(model), fNTupleName, fFileName, writeOptions);
+      } else if (fileMode == "update") {
+         ::TDirectory::TContext ctxt;
+         fOutputFile.reset(TFile::Open(fFileName.c_str(), "UPDATE"));
+         if (!fOutputFile || fOutputFile->IsZombie())
+            throw std::runtime_error("Snapshot: could not open file \"" + fFileName + "\" in update mode");
+         fWriter = RNTupleParallelWriter::Append(std::move(model), fNTupleName, *fOutputFile, writeOptions);
+      } else {
+         throw std::runtime_error("Snapshot: RNTuple output only supports the \"RECREATE\" and \"UPDATE\" modes, "
+                                  "got \"" + options.fMode + "\"");
+      }
+   }
+
+   void InitSlot(unsigned int slot) final
+   {
+      if (fFillContexts[slot])
+         return;
+      fFillContexts[slot] = fWriter->CreateFillContext();
+      fEntries[slot] = fFillContexts[slot]->GetModel()->CreateBareEntry();
+   }
+
+   void Fill(unsigned int slot, void *const *values) final
+   {
+      auto &entry = *fEntries[slot];
+      std::size_t i = 0;
+      for (auto &value : entry)
+         value = value.GetField()->CaptureValue(values[i++]);
+      fFillContexts[slot]->Fill(entry);
+   }
+
+   void Finalize() final
+   {
+      for (auto &context : fFillContexts) {
+         if (context)
+            context->CommitCluster();
+      }
+      // entries and fill contexts must be destructed before the writer, the writer before the file
+      fEntries.clear();
+      fFillContexts.clear();
+      fWriter.reset();
+      if (fOutputFile)
+         fOutputFile->Close();
+      fOutputFile.reset();
+
+      *fOutputDF = ROOT::Experimental::MakeNTupleDataFrame(fNTupleName, fFileName);
+   }
+};
+
+} // anonymous namespace
+
+std::unique_ptr<RSnapshotNTupleWriter>
+MakeSnapshotNTupleWriter(const std::string &fileName, const std::string &dirName, const std::string &ntupleName,
+                         const ColumnNames_t &fieldNames, const std::vector<std::string> &typeNames,
+                         const RSnapshotOptions &options, unsigned int nSlots,
+                         const std::shared_ptr<ROOT::RDF::RInterface<RLoopManager, void>> &outputDF)
+{
+   if (!dirName.empty())
+      throw std::runtime_error("Snapshot: RNTuple output cannot be written to the sub-directory \"" + dirName +
+                               "\", only to the top-level directory of the file");
+   return std::make_unique<RSnapshotNTupleWriterImpl>(fileName, ntupleName, fieldNames, typeNames, options, nSlots,
+                                                      outputDF);
+}
+#else
+std::unique_ptr<RSnapshotNTupleWriter>
+MakeSnapshotNTupleWriter(const std::string &, const std::string &, const std::string &, const ColumnNames_t &,
+                         const std::vector<std::string> &, const RSnapshotOptions &, unsigned int,
+                         const std::shared_ptr<ROOT::RDF::RInterface<RLoopManager, void>> &)
+{
+   throw std::runtime_error("Snapshot: RNTuple output requires ROOT to be built with root7=ON");
+}
+#endif
+
 } // end NS RDF
 } // end NS Internal
 } // end NS ROOT
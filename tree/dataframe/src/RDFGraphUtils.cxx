@@ -10,8 +10,11 @@
 
 #include "ROOT/RDF/RColumnRegister.hxx"
 #include "ROOT/RDF/GraphUtils.hxx"
+#include "ROOT/RDF/RJittedDefine.hxx"
 
 #include <algorithm> // std::find
+#include <sstream>
+#include <stdexcept>
 
 namespace ROOT {
 namespace Internal {
@@ -28,6 +31,8 @@ GraphDrawing::CreateDefineNode(const std::string &columnName, const ROOT::Detail
       return duplicateDefineIt->second;
 
    auto node = std::make_shared<GraphNode>("Define<BR/>" + columnName, visitedMap.size(), ENodeType::kDefine);
+   if (const auto *jittedDefine = dynamic_cast<const ROOT::Detail::RDF::RJittedDefine *>(columnPtr))
+      node->SetCode(jittedDefine->GetExportCode());
    visitedMap[(void *)columnPtr] = node;
    return node;
 }
@@ -138,6 +143,18 @@ std::string GraphCreatorHelper::FromGraphActionsToDot(std::vector<std::shared_pt
    return "digraph {\n" + dotStringLabels.str() + dotStringGraph.str() + "}";
 }
 
+void GraphCreatorHelper::AddProfiles(const RLoopManager &loopManager)
+{
+   const auto *profiler = loopManager.GetProfiler();
+   if (!profiler)
+      return;
+   for (auto &visited : fVisitedMap) {
+      const auto profile = profiler->GetProfile(visited.first);
+      if (profile.fSamples > 0)
+         visited.second->AddProfile(profile.fTime);
+   }
+}
+
 std::string GraphCreatorHelper::RepresentGraph(ROOT::RDataFrame &rDataFrame)
 {
    auto loopManager = rDataFrame.GetLoopManager();
@@ -159,10 +176,88 @@ std::string GraphCreatorHelper::RepresentGraph(RLoopManager *loopManager)
       nodes.emplace_back(action->GetGraph(fVisitedMap));
    for (auto *edge : edges)
       nodes.emplace_back(edge->GetGraph(fVisitedMap));
+   AddProfiles(*loopManager);
 
    return FromGraphActionsToDot(std::move(nodes));
 }
 
+/// Describe a node that cannot be exported in the error messages of ExportCode().
+static std::string DescribeNode(const GraphNode &node)
+{
+   switch (node.GetType()) {
+   case ENodeType::kDefine: return "the Define of column \"" + node.GetName().substr(sizeof("Define<BR/>") - 1) + '"';
+   case ENodeType::kFilter: return node.GetName() == "Filter" ? "an unnamed Filter" : "Filter \"" + node.GetName() + '"';
+   default: return "action " + node.GetName();
+   }
+}
+
+std::string GraphCreatorHelper::ExportCode(RLoopManager *loopManager, const std::string &functionName)
+{
+   // Jitting is triggered because nodes must not be empty at the time of the calling in order to export the graph.
+   loopManager->Jit();
+
+   // Variables holding the Filters and Ranges that were already booked, which later branches may share. Defines are
+   // booked again for each branch that uses them, as their nodes may be shared by branches that are exported later.
+   std::unordered_map<const GraphNode *, std::string> nodeVariables{{loopManager->GetGraph(fVisitedMap).get(), "df"}};
+
+   std::stringstream body;
+   for (auto *action : loopManager->GetAllActions()) {
+      // The branch of each action is exported right away: visiting later branches may link shared Defines elsewhere.
+      const auto leaf = action->GetGraph(fVisitedMap);
+      if (leaf->GetCode().empty())
+         throw std::runtime_error("ExportCode: results with systematic variations cannot be exported.");
+
+      std::vector<const GraphNode *> branch; // the nodes that were not booked yet, bottom-up
+      for (const GraphNode *node = leaf->GetPrevNode(); nodeVariables.find(node) == nodeVariables.end();
+           node = node->GetPrevNode())
+         branch.push_back(node);
+
+      std::string expr = nodeVariables[branch.empty() ? leaf->GetPrevNode() : branch.back()->GetPrevNode()];
+      for (auto it = branch.rbegin(); it != branch.rend(); ++it) {
+         const auto &node = **it;
+         if (node.GetCode().empty())
+            throw std::runtime_error("ExportCode: " + DescribeNode(node) +
+                                     " was not booked from a string expression and cannot be exported.");
+         expr += "\n      " + node.GetCode();
+         if (node.GetType() != ENodeType::kDefine) {
+            const auto variable = "node" + std::to_string(node.GetID());
+            body << "   auto " << variable << " = " << expr << ";\n";
+            nodeVariables[&node] = variable;
+            expr = variable;
+         }
+      }
+      body << "   // " << leaf->GetCode() << "\n   nodes.emplace_back(" << expr << ");\n";
+   }
+
+   std::stringstream code;
+   code << "// Computation graph exported by ROOT::RDF::Experimental::ExportCode()\n\n"
+        << "#include <ROOT/RDataFrame.hxx>\n#include <ROOT/RVec.hxx>\n\n"
+        << "#include <cmath>\n#include <string>\n#include <vector>\n\n"
+        << "using namespace std;\nusing namespace ROOT::VecOps;\n\n"
+        << "/// Book the Defines, Filters and Ranges of the exported graph on `df`. Return the nodes on which the actions\n"
+        << "/// of the graph were booked, one per action as noted in the comments.\n"
+        << "std::vector<ROOT::RDF::RNode> " << functionName << "(ROOT::RDF::RNode df)\n{\n"
+        << "   std::vector<ROOT::RDF::RNode> nodes;\n"
+        << body.str() << "   return nodes;\n}\n";
+   return code.str();
+}
+
+std::string GraphCreatorHelper::RepresentGraph(ROOT::Detail::RDF::RNodeBase &node, const RColumnRegister &colRegister,
+                                              const std::string &actionName)
+{
+   // Jitting is triggered because nodes must not be empty at the time of the calling in order to draw the graph.
+   node.GetLoopManagerUnchecked()->Jit();
+
+   auto prevNode = node.GetGraph(fVisitedMap);
+   const auto &prevColumns = prevNode->GetDefinedColumns();
+   auto thisNode = std::make_shared<GraphNode>(actionName, fVisitedMap.size(), ENodeType::kAction);
+   auto upmostNode = AddDefinesToGraph(thisNode, colRegister, prevColumns, fVisitedMap);
+   upmostNode->SetPrevNode(prevNode);
+   AddProfiles(*node.GetLoopManagerUnchecked());
+
+   return FromGraphLeafToDot(*thisNode);
+}
+
 } // namespace GraphDrawing
 } // namespace RDF
 } // namespace Internal
@@ -10,6 +10,7 @@
 
 #include "ROOT/RDFHelpers.hxx"
 #include "TROOT.h"      // IsImplicitMTEnabled
+#include "TEnv.h"       // gEnv
 #include "TError.h"     // Warning
 #include "RConfigure.h" // R__USE_IMT
 #ifdef R__USE_IMT
@@ -57,3 +58,19 @@ void ROOT::RDF::RunGraphs(std::vector<RResultHandle> handles)
    for (auto &h : uniqueLoops)
       run(h);
 }
+
+static std::string &JitCacheDir()
+{
+   static std::string dir = gEnv->GetValue("RDataFrame.JitCacheDir", "");
+   return dir;
+}
+
+void ROOT::RDF::Experimental::SetJitCacheDir(std::string_view dir)
+{
+   JitCacheDir() = std::string(dir);
+}
+
+const std::string &ROOT::RDF::Experimental::GetJitCacheDir()
+{
+   return JitCacheDir();
+}
@@ -8,20 +8,30 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <ROOT/RDF/GraphUtils.hxx>
 #include <ROOT/RDF/InterfaceUtils.hxx>
 #include <ROOT/RDataFrame.hxx>
+#include <ROOT/RDFHelpers.hxx> // GetJitCacheDir
+#include <ROOT/InternalTreeUtils.hxx> // GetFileNamesFromTree
+#ifdef R__ENABLE_RNTUPLE
+#include <ROOT/RNTupleDS.hxx>
+#endif
 #include <ROOT/RStringView.hxx>
 #include <ROOT/TSeq.hxx>
 #include <RtypesCore.h>
 #include <TDirectory.h>
+#include <TBranch.h>
 #include <TChain.h>
 #include <TClass.h>
 #include <TClassEdit.h>
 #include <TFriendElement.h>
+#include <TDataType.h>
 #include <TInterpreter.h>
 #include <TObject.h>
 #include <TPRegexp.h>
+#include <TROOT.h>
 #include <TString.h>
+#include <TSystem.h>
 #include <TTree.h>
 
 // pragma to disable warnings on Rcpp which have
@@ -38,6 +48,10 @@
 
 #include <algorithm>
 #include <cassert>
+#include <fstream>
+#include <functional> // std::hash
+#include <iomanip>
+#include <limits>
 #include <unordered_set>
 #include <stdexcept>
 #include <string>
@@ -265,8 +279,57 @@ BuildFunctionString(const std::string &expr, const ColumnNames_t &vars, const Co
    return ss.str();
 }
 
+/// Return the C++ code of an initializer list with the given column names, e.g. `{"x", "y"}`.
+static std::string ColumnListCode(const ColumnNames_t &cols)
+{
+   std::string code = "{";
+   for (const auto &col : cols)
+      code += (code.size() > 1 ? ", \"" : "\"") + col + '"';
+   return code + "}";
+}
+
+/// Compile the declaration of a jitted function with ACLiC into a library in the jit cache directory, or load that
+/// library if a previous session already compiled it. Return false if the code cannot be compiled outside of the
+/// interpreter, in which case the caller must declare it to the interpreter as usual.
+static bool DeclareCachedFunction(const std::string &toDeclare, const std::string &funcBaseName,
+                                  const std::string &cacheDir)
+{
+   const auto macroName = cacheDir + "/rdf_" + funcBaseName + ".C";
+   const auto failedMarkerName = macroName + ".failed";
+   if (!gSystem->AccessPathName(failedMarkerName.c_str()))
+      return false; // a previous session could not compile this code, do not try again
+
+   if (gSystem->AccessPathName(macroName.c_str())) {
+      if (gSystem->AccessPathName(cacheDir.c_str()) && gSystem->mkdir(cacheDir.c_str(), /*recursive=*/true) != 0) {
+         Warning("RDataFrame::Jit", "cannot create the jit cache directory %s", cacheDir.c_str());
+         return false;
+      }
+      // write to a temporary file and rename it, so that concurrent sessions never compile a partial macro
+      const auto tmpName = macroName + "." + std::to_string(gSystem->GetPid()) + ".tmp";
+      {
+         std::ofstream out(tmpName);
+         out << "#include <ROOT/RVec.hxx>\n#include <ROOT/TypeTraits.hxx>\n#include <cmath>\n#include <string>\n"
+             << "#include <vector>\nusing namespace std;\nusing namespace ROOT::VecOps;\n\n"
+             << toDeclare << '\n';
+      }
+      if (gSystem->Rename(tmpName.c_str(), macroName.c_str()) != 0) {
+         gSystem->Unlink(tmpName.c_str());
+         return false;
+      }
+   }
+
+   // ACLiC only compiles the macro if its library is missing or outdated, otherwise it just loads the library
+   if (!gSystem->CompileMacro(macroName.c_str(), "kOs")) {
+      std::ofstream marker(failedMarkerName);
+      return false;
+   }
+   return true;
+}
+
 /// Declare a function to the interpreter in namespace R_rdf, return the name of the jitted function.
 /// If the function is already in GetJittedExprs, return the name for the function that has already been jitted.
+/// If a jit cache directory is set (see ROOT::RDF::Experimental::SetJitCacheDir()), the function is named after a
+/// hash of its code and compiled into a library of the cache, which later sessions load instead of jitting the code.
 static std::string DeclareFunction(const std::string &expr, const ColumnNames_t &vars, const ColumnNames_t &varTypes)
 {
    R__LOCKGUARD(gROOTMutex);
@@ -281,13 +344,23 @@ static std::string DeclareFunction(const std::string &expr, const ColumnNames_t
    }
 
    // new expression
-   const auto funcBaseName = "func" + std::to_string(exprMap.size());
+   const auto &cacheDir = ROOT::RDF::Experimental::GetJitCacheDir();
+   std::string funcBaseName;
+   if (cacheDir.empty()) {
+      funcBaseName = "func" + std::to_string(exprMap.size());
+   } else {
+      // the name must be the same in all sessions that declare this function
+      std::stringstream hashedName;
+      hashedName << "func_" << std::hex << std::setw(16) << std::setfill('0') << std::hash<std::string>{}(funcCode);
+      funcBaseName = hashedName.str();
+   }
    const auto funcFullName = "R_rdf::" + funcBaseName;
 
    const auto toDeclare = "namespace R_rdf {\nauto " + funcBaseName + funcCode + "\nusing " + funcBaseName +
                           "_ret_t = typename ROOT::TypeTraits::CallableTraits<decltype(" + funcBaseName +
                           ")>::ret_type;\n}";
-   ROOT::Internal::RDF::InterpreterDeclare(toDeclare.c_str());
+   if (cacheDir.empty() || !DeclareCachedFunction(toDeclare, funcBaseName, cacheDir))
+      ROOT::Internal::RDF::InterpreterDeclare(toDeclare.c_str());
 
    // InterpreterDeclare could throw. If it doesn't, mark the function as already jitted
    exprMap.insert({funcCode, funcFullName});
@@ -652,6 +725,22 @@ std::string PrettyPrintAddr(const void *const addr)
    return s.str();
 }
 
+/// Return a key that identifies the values computed by a jitted Define or Filter: its name, the jitted function and,
+/// for each input column, the Define, dataset column and Variations that provide its values.
+static std::string MakeJittedNodeKey(std::string_view name, const std::string &funcName, const ColumnNames_t &usedCols,
+                                     const RColumnRegister &customCols)
+{
+   std::stringstream key;
+   key << name << '\n' << funcName;
+   for (const auto &col : usedCols) {
+      const auto resolvedCol = customCols.ResolveAlias(col);
+      key << '\n' << resolvedCol << ' ' << customCols.GetDefine(resolvedCol);
+      for (const auto &variation : customCols.GetVariationsFor(resolvedCol))
+         key << ' ' << &customCols.FindVariation(resolvedCol, variation);
+   }
+   return key.str();
+}
+
 /// Book the jitting of a Filter call
 std::shared_ptr<RDFDetail::RJittedFilter>
 BookFilterJit(std::shared_ptr<RDFDetail::RNodeBase> *prevNodeOnHeap, std::string_view name, std::string_view expression,
@@ -667,6 +756,19 @@ BookFilterJit(std::shared_ptr<RDFDetail::RNodeBase> *prevNodeOnHeap, std::string
    if (type != "bool")
       std::runtime_error("Filter: the following expression does not evaluate to bool:\n" + std::string(expression));
 
+   // an unnamed Filter identical to one already booked on the same node is shared (named Filters are not, as each of
+   // them has its own entry in the cut-flow report)
+   auto *lm = (*prevNodeOnHeap)->GetLoopManagerUnchecked();
+   std::string sharingKey;
+   if (name.empty()) {
+      sharingKey = PrettyPrintAddr(prevNodeOnHeap->get()) + '\n' +
+                   MakeJittedNodeKey(name, funcName, parsedExpr.fUsedCols, customCols);
+      if (auto sharedFilter = lm->FindSharedJittedFilter(sharingKey)) {
+         delete prevNodeOnHeap;
+         return sharedFilter;
+      }
+   }
+
    // definesOnHeap is deleted by the jitted call to JitFilterHelper
    ROOT::Internal::RDF::RColumnRegister *definesOnHeap = new ROOT::Internal::RDF::RColumnRegister(customCols);
    const auto definesOnHeapAddr = PrettyPrintAddr(definesOnHeap);
@@ -675,6 +777,11 @@ BookFilterJit(std::shared_ptr<RDFDetail::RNodeBase> *prevNodeOnHeap, std::string
    const auto jittedFilter = std::make_shared<RDFDetail::RJittedFilter>(
       (*prevNodeOnHeap)->GetLoopManagerUnchecked(), name,
       Union(customCols.GetVariationDeps(parsedExpr.fUsedCols), (*prevNodeOnHeap)->GetVariations()));
+   std::string exportCode = ".Filter([]" + BuildFunctionString(parsedExpr.fExpr, parsedExpr.fVarNames, exprVarTypes) +
+                            ", " + ColumnListCode(parsedExpr.fUsedCols);
+   if (!name.empty())
+      exportCode += ", \"" + std::string(name) + '"';
+   jittedFilter->SetExportCode(exportCode + ")");
 
    // Produce code snippet that creates the filter and registers it with the corresponding RJittedFilter
    // Windows requires std::hex << std::showbase << (size_t)pointer to produce notation "0x1234"
@@ -696,8 +803,9 @@ BookFilterJit(std::shared_ptr<RDFDetail::RNodeBase> *prevNodeOnHeap, std::string
                     << "reinterpret_cast<ROOT::Internal::RDF::RColumnRegister*>(" << definesOnHeapAddr << ")"
                     << ");\n";
 
-   auto lm = jittedFilter->GetLoopManagerUnchecked();
    lm->ToJitExec(filterInvocation.str());
+   if (!sharingKey.empty())
+      lm->AddSharedJittedFilter(sharingKey, jittedFilter);
 
    return jittedFilter;
 }
@@ -717,9 +825,20 @@ std::shared_ptr<RJittedDefine> BookDefineJit(std::string_view name, std::string_
    const auto funcName = DeclareFunction(parsedExpr.fExpr, parsedExpr.fVarNames, exprVarTypes);
    const auto type = RetTypeOfFunc(funcName);
 
+   // a Define with the same name, expression and inputs as one booked in another branch of the graph computes the same
+   // values: share it rather than evaluating the expression once per branch
+   const auto sharingKey = MakeJittedNodeKey(name, funcName, parsedExpr.fUsedCols, customCols);
+   if (auto sharedDefine = lm.FindSharedJittedDefine(sharingKey)) {
+      delete upcastNodeOnHeap;
+      return sharedDefine;
+   }
+
    auto definesCopy = new RColumnRegister(customCols);
    auto definesAddr = PrettyPrintAddr(definesCopy);
    auto jittedDefine = std::make_shared<RDFDetail::RJittedDefine>(name, type, lm, customCols, parsedExpr.fUsedCols);
+   jittedDefine->SetExportCode(".Define(\"" + std::string(name) + "\", []" +
+                               BuildFunctionString(parsedExpr.fExpr, parsedExpr.fVarNames, exprVarTypes) + ", " +
+                               ColumnListCode(parsedExpr.fUsedCols) + ")");
 
    std::stringstream defineInvocation;
    defineInvocation << "ROOT::Internal::RDF::JitDefineHelper<ROOT::Internal::RDF::DefineTypes::RDefineTag>(" << funcName
@@ -742,6 +861,7 @@ std::shared_ptr<RJittedDefine> BookDefineJit(std::string_view name, std::string_
                     << PrettyPrintAddr(upcastNodeOnHeap) << "));\n";
 
    lm.ToJitExec(defineInvocation.str());
+   lm.AddSharedJittedDefine(sharingKey, jittedDefine);
    return jittedDefine;
 }
 
@@ -750,13 +870,16 @@ std::shared_ptr<RJittedDefine> BookDefinePerSampleJit(std::string_view name, std
                                                       RLoopManager &lm, const RColumnRegister &customCols,
                                                       std::shared_ptr<RNodeBase> *upcastNodeOnHeap)
 {
-   const auto funcName = DeclareFunction(std::string(expression), {"rdfslot_", "rdfsampleinfo_"},
-                                         {"unsigned int", "const ROOT::RDF::RSampleInfo"});
+   const ColumnNames_t vars{"rdfslot_", "rdfsampleinfo_"};
+   const ColumnNames_t varTypes{"unsigned int", "const ROOT::RDF::RSampleInfo"};
+   const auto funcName = DeclareFunction(std::string(expression), vars, varTypes);
    const auto retType = RetTypeOfFunc(funcName);
 
    auto definesCopy = new RColumnRegister(customCols);
    auto definesAddr = PrettyPrintAddr(definesCopy);
    auto jittedDefine = std::make_shared<RDFDetail::RJittedDefine>(name, retType, lm, customCols, ColumnNames_t{});
+   jittedDefine->SetExportCode(".DefinePerSample(\"" + std::string(name) + "\", []" +
+                               BuildFunctionString(std::string(expression), vars, varTypes) + ")");
 
    std::stringstream defineInvocation;
    defineInvocation << "ROOT::Internal::RDF::JitDefineHelper<ROOT::Internal::RDF::DefineTypes::RDefinePerSampleTag>("
@@ -1031,6 +1154,113 @@ AddSizeBranches(const std::vector<std::string> &branches, TTree *tree, std::vect
    return {std::move(colsWithoutAliases), std::move(colsWithAliases)};
 }
 
+////////////////////////////////////////////////////////////////////////////
+/// Return the name of the file of the persistent cache of the given columns, in directory `cacheDir`.
+/// The name contains a hash of the description of the input dataset (including size and modification time of the
+/// local input files), of the branch of the computation graph that leads to the cached columns and of the names and
+/// types of the columns.
+std::string GetPersistentCacheFileName(RNodeBase &node, const RColumnRegister &colRegister,
+                                       const std::string &datasetDescription, TTree *tree,
+                                       const ColumnNames_t &columns, const std::vector<std::string> &columnTypes,
+                                       std::string_view cacheDir)
+{
+   std::stringstream key;
+   key << datasetDescription << '\n';
+   if (tree) {
+      for (const auto &inputFileName : ROOT::Internal::TreeUtils::GetFileNamesFromTree(*tree)) {
+         FileStat_t stat;
+         // remote files cannot be stat'ed, they are only identified by their name
+         if (gSystem->GetPathInfo(inputFileName.c_str(), stat) == 0)
+            key << inputFileName << ' ' << stat.fSize << ' ' << stat.fMtime << '\n';
+      }
+   }
+   GraphDrawing::GraphCreatorHelper helper;
+   key << helper.RepresentGraph(node, colRegister, "PersistentCache") << '\n';
+   for (std::size_t i = 0u; i < columns.size(); ++i)
+      key << columns[i] << ' ' << columnTypes[i] << '\n';
+
+   std::stringstream fileName;
+   fileName << (cacheDir.empty() ? std::string(".") : std::string(cacheDir)) << "/rdfcache_" << std::hex
+            << std::setw(16) << std::setfill('0') << std::hash<std::string>{}(key.str()) << ".root";
+   return fileName.str();
+}
+
+////////////////////////////////////////////////////////////////////////////
+/// Return an upper bound of the number of bytes needed to cache the given columns in memory, or the largest
+/// ULong64_t if the number of entries of the input is not known.
+/// Columns read from the tree are estimated with the uncompressed size of their branches, the others with the size
+/// of their type.
+ULong64_t EstimateCacheSize(TTree *tree, bool hasDataSource, ULong64_t nEmptyEntries, const ColumnNames_t &columns,
+                            const std::vector<std::string> &columnTypes)
+{
+   ULong64_t nEntries = nEmptyEntries;
+   if (tree)
+      nEntries = tree->GetEntries();
+   else if (hasDataSource)
+      return std::numeric_limits<ULong64_t>::max();
+
+   double size = 0.;
+   for (std::size_t i = 0u; i < columns.size(); ++i) {
+      auto *branch = tree ? tree->GetBranch(columns[i].c_str()) : nullptr;
+      if (branch && branch->GetEntries() > 0) {
+         size += double(branch->GetTotBytes("*")) / branch->GetEntries() * nEntries;
+         continue;
+      }
+      std::size_t typeSize = sizeof(double);
+      if (auto *cl = TClass::GetClass(columnTypes[i].c_str()))
+         typeSize = cl->Size();
+      else if (auto *dt = gROOT->GetType(columnTypes[i].c_str()))
+         typeSize = dt->Size();
+      size += double(typeSize) * nEntries;
+   }
+   return size < double(std::numeric_limits<ULong64_t>::max()) ? ULong64_t(size)
+                                                                : std::numeric_limits<ULong64_t>::max();
+}
+
+////////////////////////////////////////////////////////////////////////////
+/// Return an RDataFrame that reads the persistent cache stored in `fileName`. If the file does not exist (or cannot
+/// be read), it is first produced by `write`, which must write an RNTuple with the given name in the given file.
+/// `write` writes a temporary file that is then renamed, so that concurrent processes never see incomplete caches.
+ROOT::RDF::RInterface<RLoopManager, void>
+GetOrMakePersistentCache(const std::string &fileName,
+                         const std::function<void(const std::string &ntupleName, const std::string &fileName)> &write)
+{
+#ifdef R__ENABLE_RNTUPLE
+   static const std::string ntupleName = "rdfcache";
+
+   if (!gSystem->AccessPathName(fileName.c_str())) {
+      try {
+         return ROOT::Experimental::MakeNTupleDataFrame(ntupleName, fileName);
+      } catch (const std::exception &e) {
+         Warning("PersistentCache", "cannot read cache file %s, it will be written again: %s", fileName.c_str(),
+                 e.what());
+      }
+   }
+
+   const TString dirName = gSystem->GetDirName(fileName.c_str());
+   if (gSystem->AccessPathName(dirName) && gSystem->mkdir(dirName, /*recursive=*/true) != 0)
+      throw std::runtime_error("PersistentCache: cannot create cache directory \"" + std::string(dirName.Data()) +
+                               "\"");
+
+   const auto tmpFileName = fileName + "." + std::to_string(gSystem->GetPid()) + ".tmp";
+   try {
+      write(ntupleName, tmpFileName);
+   } catch (...) {
+      gSystem->Unlink(tmpFileName.c_str());
+      throw;
+   }
+   if (gSystem->Rename(tmpFileName.c_str(), fileName.c_str()) != 0) {
+      gSystem->Unlink(tmpFileName.c_str());
+      throw std::runtime_error("PersistentCache: cannot move the cache to \"" + fileName + "\"");
+   }
+   return ROOT::Experimental::MakeNTupleDataFrame(ntupleName, fileName);
+#else
+   (void)fileName;
+   (void)write;
+   throw std::runtime_error("PersistentCache: RNTuple output requires ROOT to be built with root7=ON");
+#endif
+}
+
 } // namespace RDF
 } // namespace Internal
 } // namespace ROOT
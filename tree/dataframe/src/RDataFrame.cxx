@@ -146,6 +146,7 @@ These operations do not modify the dataframe or book computations but simply ret
 | GetDefinedColumnNames() | Get the names of all the defined columns. |
 | GetFilterNames() | Return the names of all filters in the computation graph. |
 | GetNRuns() | Return the number of event loops run by this RDataFrame instance so far. |
+| GetProfile() | Return the time spent in each Define, Filter and action during the last event loop run after SetProfiling(). |
 | GetNSlots() | Return the number of processing slots that RDataFrame will use during the event loop (i.e. the concurrency level). |
 | SaveGraph() | Store the computation graph of an RDataFrame in [DOT format (graphviz)](https://en.wikipedia.org/wiki/DOT_(graph_description_language)) for easy inspection. See the [relevant section](\ref representgraph) for details. |
 
@@ -714,6 +715,11 @@ if __name__ == "__main__":
 Note that when processing a TTree or TChain dataset, the `npartitions` value should not exceed the number of clusters in
 the dataset. The number of clusters in a TTree can be retrieved by typing `rootls -lt myfile.root` at a command line.
 
+The partial results of the tasks are merged on the workers with a tree-shaped reduction, so that only the final result
+is sent back to the client. By default each merging task combines two partial results. With many partitions, merging
+more results per task reduces the depth of the reduction. The number of results merged per task can be set, for any
+backend, with `ROOT.RDF.Experimental.Distributed.reduction_fanin = N`.
+
 ### Distributed Snapshot
 
 The Snapshot operation behaves slightly differently when executed distributedly. First off, it requires the path
@@ -847,6 +853,10 @@ before the first event loop is triggered: just-in-time compilation will happen o
 
 Also make sure not to count the just-in-time compilation time (which happens once before the event loop and does not depend on the size of the dataset) as part of the event loop runtime (which scales with the size of the dataset). RDataFrame has an experimental logging feature that simplifies measuring the time spent in just-in-time compilation and in the event loop (as well as providing some more interesting information). See [Activating RDataFrame execution logs](\ref rdf-logging).
 
+Defines that return collections (RVecs) with more elements than fit in their inline storage allocate and free a heap buffer for every entry, which in multi-thread event loops can make the memory allocator a bottleneck. ROOT::VecOps::SetBufferPoolSize() lets each thread recycle the buffers of the RVecs it destroys, e.g. `ROOT::VecOps::SetBufferPoolSize(64 * 1024 * 1024)` before starting the event loop.
+
+Multi-thread event loops over many remote TTree files can spend a visible fraction of their time waiting for files to be opened. With `ROOT::TTreeProcessorMT::SetFilesToPrefetch(n)`, the next `n` files are opened in background tasks while the current ones are processed. For datasets of very many files with an entry range, RDatasetSpec::SetEntriesPerFile() avoids opening all of them before the event loop starts.
+
 ### Memory usage
 
 There are two reasons why RDataFrame may consume more memory than expected. Firstly, each result is duplicated for each worker thread, which e.g. in case of many (possibly multi-dimensional) histograms with fine binning can result in visible memory consumption during the event loop. The thread-local copies of the results are destroyed when the final result is produced. Reducing the number of threads or using coarser binning will reduce the memory usage.
@@ -10,6 +10,7 @@
 
 #include "ROOT/RDF/RDatasetSpec.hxx"
 #include <stdexcept> // std::logic_error
+#include <string>
 
 namespace ROOT {
 
@@ -127,6 +128,24 @@ void RDatasetSpec::AddFriend(const std::vector<std::pair<std::string, std::strin
    fFriendInfo.AddFriend(treeAndFileNameGlobs, alias);
 }
 
+////////////////////////////////////////////////////////////////////////////
+/// \brief Set the number of entries of each file of the dataset, so that they are not opened to find it out.
+/// \param[in] entriesPerFile The number of entries of the tree in each file, in the same order as the file names
+///
+/// The numbers of entries are typically read from an index of the dataset that was built once, e.g. when the files
+/// were produced. With them, the files are only opened when their entries are processed, also when an entry range
+/// is set: in multi-thread runs, files outside of the range are never opened, and the cluster boundaries of the
+/// others are retrieved in the task that processes them. The startup time of the event loop then does not grow with
+/// the number of files. The file names must not contain globbing characters.
+void RDatasetSpec::SetEntriesPerFile(const std::vector<Long64_t> &entriesPerFile)
+{
+   if (entriesPerFile.size() != fFileNameGlobs.size())
+      throw std::logic_error("The number of entries must be given for each of the " +
+                             std::to_string(fFileNameGlobs.size()) + " files of the dataset specification, but " +
+                             std::to_string(entriesPerFile.size()) + " values were passed.");
+   fEntriesPerFile = entriesPerFile;
+}
+
 } // namespace Experimental
 } // namespace RDF
 } // namespace ROOT
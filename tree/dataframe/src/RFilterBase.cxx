@@ -11,8 +11,12 @@
 #include "ROOT/RDF/RCutFlowReport.hxx"
 #include "ROOT/RDF/RDefineBase.hxx"
 #include "ROOT/RDF/RFilterBase.hxx"
+#include "ROOT/RDF/RLoopManager.hxx"
 #include "ROOT/RDF/Utils.hxx"
-#include <numeric> // std::accumulate
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <numeric> // std::accumulate, std::iota
 
 using namespace ROOT::Detail::RDF;
 
@@ -23,7 +27,7 @@ RFilterBase::RFilterBase(RLoopManager *implPtr, std::string_view name, const uns
      fLastCheckedEntry(std::vector<Long64_t>(nSlots * RDFInternal::CacheLineStep<Long64_t>(), -1)),
      fLastResult(nSlots * RDFInternal::CacheLineStep<int>()),
      fAccepted(nSlots * RDFInternal::CacheLineStep<ULong64_t>()),
-     fRejected(nSlots * RDFInternal::CacheLineStep<ULong64_t>()), fName(name), fColumnNames(columns),
+     fRejected(nSlots * RDFInternal::CacheLineStep<ULong64_t>()), fBulkMasks(nSlots), fName(name), fColumnNames(columns),
      fColRegister(colRegister), fIsDefine(columns.size()), fVariation(variation)
 {
    const auto nColumns = fColumnNames.size();
@@ -60,4 +64,73 @@ void RFilterBase::InitNode()
 {
    if (!fName.empty()) // if this is a named filter we care about its report count
       ResetReportCount();
+   InitFilterChain();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// If filter reordering is enabled, collect the chain of unnamed filters that ends with this filter.
+/// The chain stops at the first upstream node that is not an unnamed filter or that has other children than the next
+/// filter of the chain: no other node checks the upstream filters of the chain, so they can be evaluated in any order.
+void RFilterBase::InitFilterChain()
+{
+   fChain.clear();
+   fChainStates.clear();
+   if (fLoopManager->GetFilterReorderingEntries() == 0 || HasName())
+      return;
+
+   std::vector<RFilterBase *> chain{this};
+   for (auto *prev = GetPrevFilter(); prev && !prev->HasName() && prev->GetNChildren() == 1;
+        prev = prev->GetPrevFilter())
+      chain.push_back(prev);
+   if (chain.size() < 2)
+      return;
+
+   std::reverse(chain.begin(), chain.end());
+   fChain = std::move(chain);
+   fChainStates.resize(fLoopManager->GetNSlots());
+   for (auto &state : fChainStates) {
+      state.fOrder.resize(fChain.size());
+      std::iota(state.fOrder.begin(), state.fOrder.end(), 0u);
+      state.fCost.assign(fChain.size(), 0.);
+      state.fNPassed.assign(fChain.size(), 0u);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Evaluate the filters of fChain, and the filters upstream of it.
+/// For the first entries of each slot, all the filters of the chain are evaluated in declaration order to measure their
+/// pass rate and cost. Then they are evaluated, stopping at the first that fails, in increasing order of
+/// cost / (1 - pass rate), which minimizes the expected cost per entry for independent filters.
+bool RFilterBase::CheckFilterChain(unsigned int slot, Long64_t entry)
+{
+   if (!fChain.front()->CheckPrevFilters(slot, entry))
+      return false;
+
+   auto &state = fChainStates[slot];
+   const auto nSampleEntries = fLoopManager->GetFilterReorderingEntries();
+   if (state.fNSampled < nSampleEntries) {
+      bool passed = true;
+      for (std::size_t i = 0; i < fChain.size(); ++i) {
+         const auto start = std::chrono::steady_clock::now();
+         const bool p = fChain[i]->EvalFilter(slot, entry);
+         state.fCost[i] += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+         state.fNPassed[i] += p;
+         passed = passed && p;
+      }
+      if (++state.fNSampled == nSampleEntries) {
+         auto rank = [&state](std::size_t i) {
+            const double rejectRate = 1. - double(state.fNPassed[i]) / state.fNSampled;
+            return rejectRate > 0. ? state.fCost[i] / rejectRate : std::numeric_limits<double>::infinity();
+         };
+         std::stable_sort(state.fOrder.begin(), state.fOrder.end(),
+                          [&rank](std::size_t a, std::size_t b) { return rank(a) < rank(b); });
+      }
+      return passed;
+   }
+
+   for (auto i : state.fOrder) {
+      if (!fChain[i]->EvalFilter(slot, entry))
+         return false;
+   }
+   return true;
 }
@@ -36,6 +36,12 @@ void RJittedAction::Run(unsigned int slot, Long64_t entry)
    fConcreteAction->Run(slot, entry);
 }
 
+void RJittedAction::RunBulk(unsigned int slot, Long64_t firstEntry, std::size_t bulkSize)
+{
+   assert(fConcreteAction != nullptr);
+   fConcreteAction->RunBulk(slot, firstEntry, bulkSize);
+}
+
 void RJittedAction::Initialize()
 {
    assert(fConcreteAction != nullptr);
@@ -88,6 +94,12 @@ void RJittedAction::SetHasRun()
    return fConcreteAction->SetHasRun();
 }
 
+std::string RJittedAction::GetActionName()
+{
+   assert(fConcreteAction != nullptr);
+   return fConcreteAction->GetActionName();
+}
+
 std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode> RJittedAction::GetGraph(
    std::unordered_map<void *, std::shared_ptr<ROOT::Internal::RDF::GraphDrawing::GraphNode>> &visitedMap)
 {
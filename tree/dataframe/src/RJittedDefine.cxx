@@ -46,6 +46,12 @@ void RJittedDefine::Update(unsigned int slot, Long64_t entry)
    fConcreteDefine->Update(slot, entry);
 }
 
+void *RJittedDefine::GetEntryValuePtr(unsigned int slot, Long64_t entry)
+{
+   assert(fConcreteDefine != nullptr);
+   return fConcreteDefine->GetEntryValuePtr(slot, entry);
+}
+
 void RJittedDefine::Update(unsigned int slot, const ROOT::RDF::RSampleInfo &id)
 {
    assert(fConcreteDefine != nullptr);
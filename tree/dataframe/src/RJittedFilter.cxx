@@ -59,6 +59,13 @@ bool RJittedFilter::CheckFilters(unsigned int slot, Long64_t entry)
    return fConcreteFilter->CheckFilters(slot, entry);
 }
 
+const ROOT::Internal::RDF::RMaskedEntryRange &
+RJittedFilter::CheckFiltersBulk(unsigned int slot, Long64_t firstEntry, std::size_t bulkSize)
+{
+   assert(fConcreteFilter != nullptr);
+   return fConcreteFilter->CheckFiltersBulk(slot, firstEntry, bulkSize);
+}
+
 void RJittedFilter::Report(ROOT::RDF::RCutFlowReport &cr) const
 {
    assert(fConcreteFilter != nullptr);
@@ -113,6 +120,30 @@ void RJittedFilter::FinalizeSlot(unsigned int slot)
    fConcreteFilter->FinalizeSlot(slot);
 }
 
+bool RJittedFilter::EvalFilter(unsigned int slot, Long64_t entry)
+{
+   assert(fConcreteFilter != nullptr);
+   return fConcreteFilter->EvalFilter(slot, entry);
+}
+
+bool RJittedFilter::CheckPrevFilters(unsigned int slot, Long64_t entry)
+{
+   assert(fConcreteFilter != nullptr);
+   return fConcreteFilter->CheckPrevFilters(slot, entry);
+}
+
+RFilterBase *RJittedFilter::GetPrevFilter()
+{
+   assert(fConcreteFilter != nullptr);
+   return fConcreteFilter->GetPrevFilter();
+}
+
+unsigned int RJittedFilter::GetNChildren() const
+{
+   assert(fConcreteFilter != nullptr);
+   return fConcreteFilter->GetNChildren();
+}
+
 void RJittedFilter::InitNode()
 {
    assert(fConcreteFilter != nullptr);
@@ -133,7 +164,9 @@ RJittedFilter::GetGraph(std::unordered_map<void *, std::shared_ptr<RDFGraphDrawi
 {
    if (fConcreteFilter != nullptr) {
       // Here the filter exists, so it can be served
-      return fConcreteFilter->GetGraph(visitedMap);
+      auto node = fConcreteFilter->GetGraph(visitedMap);
+      node->SetCode(fExportCode);
+      return node;
    }
    throw std::runtime_error("The Jitting should have been invoked before this method.");
 }
@@ -13,6 +13,8 @@
 #include "ROOT/RDF/RActionBase.hxx"
 #include "ROOT/RDF/RDefineBase.hxx"
 #include "ROOT/RDF/RFilterBase.hxx"
+#include "ROOT/RDF/RJittedDefine.hxx"
+#include "ROOT/RDF/RJittedFilter.hxx"
 #include "ROOT/RDF/RLoopManager.hxx"
 #include "ROOT/RDF/RRangeBase.hxx"
 #include "ROOT/RDF/RSlotStack.hxx"
@@ -348,21 +350,24 @@ RLoopManager::RLoopManager(TTree *tree, const ColumnNames_t &defaultBranches)
    : fTree(std::shared_ptr<TTree>(tree, [](TTree *) {})), fDefaultColumns(defaultBranches),
      fNSlots(RDFInternal::GetNSlots()),
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kROOTFilesMT : ELoopType::kROOTFiles),
-     fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots)
+     fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots),
+     fBulkMasks(fNSlots)
 {
 }
 
 RLoopManager::RLoopManager(ULong64_t nEmptyEntries)
    : fNEmptyEntries(nEmptyEntries), fNSlots(RDFInternal::GetNSlots()),
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kNoFilesMT : ELoopType::kNoFiles), fNewSampleNotifier(fNSlots),
-     fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots)
+     fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots),
+     fBulkMasks(fNSlots)
 {
 }
 
 RLoopManager::RLoopManager(std::unique_ptr<RDataSource> ds, const ColumnNames_t &defaultBranches)
    : fDefaultColumns(defaultBranches), fNSlots(RDFInternal::GetNSlots()),
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kDataSourceMT : ELoopType::kDataSource),
-     fDataSource(std::move(ds)), fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots)
+     fDataSource(std::move(ds)), fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots),
+     fBulkMasks(fNSlots)
 {
    fDataSource->SetNSlots(fNSlots);
 }
@@ -370,21 +375,27 @@ RLoopManager::RLoopManager(std::unique_ptr<RDataSource> ds, const ColumnNames_t
 RLoopManager::RLoopManager(ROOT::RDF::Experimental::RDatasetSpec &&spec)
    : fBeginEntry(spec.fEntryRange.fBegin), fEndEntry(spec.fEntryRange.fEnd), fNSlots(RDFInternal::GetNSlots()),
      fLoopType(ROOT::IsImplicitMTEnabled() ? ELoopType::kROOTFilesMT : ELoopType::kROOTFiles),
-     fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots)
+     fNewSampleNotifier(fNSlots), fSampleInfos(fNSlots), fDatasetColumnReaders(fNSlots),
+     fBulkMasks(fNSlots)
 {
    auto chain = std::make_shared<TChain>(spec.fTreeNames.size() == 1 ? spec.fTreeNames[0].c_str() : "");
+   // With known numbers of entries, TChain::Add does not open the files
+   const auto &entriesPerFile = spec.fEntriesPerFile;
+   auto entriesOfFile = [&entriesPerFile](std::size_t i) {
+      return entriesPerFile.empty() ? TTree::kMaxEntries : entriesPerFile[i];
+   };
    if (spec.fTreeNames.size() == 1) {
       // A TChain has a global name, that is the name of single tree
       // The global name of the chain is also the name of each tree in the list
       // of files that make the chain.
-      for (const auto &f : spec.fFileNameGlobs)
-         chain->Add(f.c_str());
+      for (auto i = 0u; i < spec.fFileNameGlobs.size(); i++)
+         chain->Add(spec.fFileNameGlobs[i].c_str(), entriesOfFile(i));
    } else {
       // Some other times, each different file has its own tree name, we need to
       // reconstruct the full path to the tree in each file and pass that to
       for (auto i = 0u; i < spec.fFileNameGlobs.size(); i++) {
          const auto fullpath = spec.fFileNameGlobs[i] + "?#" + spec.fTreeNames[i];
-         chain->Add(fullpath.c_str());
+         chain->Add(fullpath.c_str(), entriesOfFile(i));
       }
    }
    SetTree(std::move(chain));
@@ -453,8 +464,10 @@ void RLoopManager::RunEmptySourceMT()
       start = end;
    }
 
+   const ULong64_t bulkSize = CanRunBulk() ? fBulkSize : 1u;
+
    // Each task will generate a subrange of entries
-   auto genFunction = [this, &slotStack](const std::pair<ULong64_t, ULong64_t> &range) {
+   auto genFunction = [this, &slotStack, bulkSize](const std::pair<ULong64_t, ULong64_t> &range) {
       RSlotRAII slotRAII(slotStack);
       auto slot = slotRAII.fSlot;
       RCallCleanUpTask cleanup(*this, slot);
@@ -462,8 +475,13 @@ void RLoopManager::RunEmptySourceMT()
       R__LOG_INFO(RDFLogChannel()) << LogRangeProcessing({"an empty source", range.first, range.second, slot});
       try {
          UpdateSampleInfo(slot, range);
-         for (auto currEntry = range.first; currEntry < range.second; ++currEntry) {
-            RunAndCheckFilters(slot, currEntry);
+         if (bulkSize > 1) {
+            for (auto first = range.first; first < range.second; first += bulkSize)
+               RunAndCheckFiltersBulk(slot, first, std::min(bulkSize, range.second - first));
+         } else {
+            for (auto currEntry = range.first; currEntry < range.second; ++currEntry) {
+               RunAndCheckFilters(slot, currEntry);
+            }
          }
       } catch (...) {
          // Error might throw in experiment frameworks like CMSSW
@@ -486,8 +504,14 @@ void RLoopManager::RunEmptySource()
    RCallCleanUpTask cleanup(*this);
    try {
       UpdateSampleInfo(/*slot*/0, {0, fNEmptyEntries});
-      for (ULong64_t currEntry = 0; currEntry < fNEmptyEntries && fNStopsReceived < fNChildren; ++currEntry) {
-         RunAndCheckFilters(0, currEntry);
+      if (CanRunBulk()) {
+         const ULong64_t bulkSize = fBulkSize;
+         for (ULong64_t first = 0; first < fNEmptyEntries && fNStopsReceived < fNChildren; first += bulkSize)
+            RunAndCheckFiltersBulk(0, first, std::min(bulkSize, fNEmptyEntries - first));
+      } else {
+         for (ULong64_t currEntry = 0; currEntry < fNEmptyEntries && fNStopsReceived < fNChildren; ++currEntry) {
+            RunAndCheckFilters(0, currEntry);
+         }
       }
    } catch (...) {
       std::cerr << "RDataFrame::Run: event loop was interrupted\n";
@@ -583,6 +607,7 @@ void RLoopManager::RunDataSource()
 {
    assert(fDataSource != nullptr);
    fDataSource->CallInitialize();
+   const ULong64_t bulkSize = CanRunBulk() ? fBulkSize : 1u;
    auto ranges = fDataSource->GetEntryRanges();
    while (!ranges.empty() && fNStopsReceived < fNChildren) {
       InitNodeSlots(nullptr, 0u);
@@ -593,9 +618,14 @@ void RLoopManager::RunDataSource()
             const auto start = range.first;
             const auto end = range.second;
             R__LOG_INFO(RDFLogChannel()) << LogRangeProcessing({fDataSource->GetLabel(), start, end, 0u});
-            for (auto entry = start; entry < end && fNStopsReceived < fNChildren; ++entry) {
-               if (fDataSource->SetEntry(0u, entry)) {
-                  RunAndCheckFilters(0u, entry);
+            if (bulkSize > 1) {
+               for (auto first = start; first < end && fNStopsReceived < fNChildren; first += bulkSize)
+                  RunAndCheckFiltersBulk(0u, first, std::min(bulkSize, end - first));
+            } else {
+               for (auto entry = start; entry < end && fNStopsReceived < fNChildren; ++entry) {
+                  if (fDataSource->SetEntry(0u, entry)) {
+                     RunAndCheckFilters(0u, entry);
+                  }
                }
             }
          }
@@ -616,9 +646,10 @@ void RLoopManager::RunDataSourceMT()
    assert(fDataSource != nullptr);
    RSlotStack slotStack(fNSlots);
    ROOT::TThreadExecutor pool;
+   const ULong64_t bulkSize = CanRunBulk() ? fBulkSize : 1u;
 
    // Each task works on a subrange of entries
-   auto runOnRange = [this, &slotStack](const std::pair<ULong64_t, ULong64_t> &range) {
+   auto runOnRange = [this, &slotStack, bulkSize](const std::pair<ULong64_t, ULong64_t> &range) {
       RSlotRAII slotRAII(slotStack);
       const auto slot = slotRAII.fSlot;
       InitNodeSlots(nullptr, slot);
@@ -628,9 +659,14 @@ void RLoopManager::RunDataSourceMT()
       const auto end = range.second;
       R__LOG_INFO(RDFLogChannel()) << LogRangeProcessing({fDataSource->GetLabel(), start, end, slot});
       try {
-         for (auto entry = start; entry < end; ++entry) {
-            if (fDataSource->SetEntry(slot, entry)) {
-               RunAndCheckFilters(slot, entry);
+         if (bulkSize > 1) {
+            for (auto first = start; first < end; first += bulkSize)
+               RunAndCheckFiltersBulk(slot, first, std::min(bulkSize, end - first));
+         } else {
+            for (auto entry = start; entry < end; ++entry) {
+               if (fDataSource->SetEntry(slot, entry)) {
+                  RunAndCheckFilters(slot, entry);
+               }
             }
          }
       } catch (...) {
@@ -670,6 +706,48 @@ void RLoopManager::RunAndCheckFilters(unsigned int slot, Long64_t entry)
       callback(slot);
 }
 
+/// Execute actions and named filters on the `bulkSize` entries starting at `firstEntry`.
+/// Each node processes the whole bulk before the next one runs: filters compute a selection mask once per bulk
+/// and actions only process the selected entries, which saves a chain of calls through the graph per entry.
+void RLoopManager::RunAndCheckFiltersBulk(unsigned int slot, Long64_t firstEntry, std::size_t bulkSize)
+{
+   // data-block callbacks run before the rest of the graph
+   if (fNewSampleNotifier.CheckFlag(slot)) {
+      for (auto &callback : fSampleCallbacks) {
+         callback(slot, fSampleInfos[slot]);
+      }
+      fNewSampleNotifier.UnsetFlag(slot);
+   }
+
+   // defined values must be evaluated once per entry even if several nodes read them at different times
+   for (auto &definePtr : fBookedDefines)
+      definePtr->InitBulk(slot, firstEntry, bulkSize);
+   for (auto &actionPtr : fBookedActions)
+      actionPtr->RunBulk(slot, firstEntry, bulkSize);
+   for (auto &namedFilterPtr : fBookedNamedFilters)
+      namedFilterPtr->CheckFiltersBulk(slot, firstEntry, bulkSize);
+   for (auto &callback : fCallbacks) {
+      for (std::size_t i = 0; i < bulkSize; ++i)
+         callback(slot);
+   }
+}
+
+/// Bulk processing requires that the values of all the entries of a bulk can be read in any order.
+/// This is the case for empty sources and for data sources that support it, but not for TTrees, which
+/// TTreeReader reads one entry after the other. Systematic variations are not supported in bulk mode either.
+bool RLoopManager::CanRunBulk() const
+{
+   if (fBulkSize < 2 || !fBookedVariations.empty())
+      return false;
+   switch (fLoopType) {
+   case ELoopType::kNoFiles:
+   case ELoopType::kNoFilesMT: return true;
+   case ELoopType::kDataSource:
+   case ELoopType::kDataSourceMT: return fDataSource->SupportsBulkProcessing();
+   default: return false;
+   }
+}
+
 /// Build TTreeReaderValues for all nodes
 /// This method loops over all filters, actions and other booked objects and
 /// calls their `InitSlot` method, to get them ready for running a task.
@@ -741,6 +819,24 @@ void RLoopManager::InitNodes()
       ptr->Initialize();
 }
 
+/// Register the booked Defines, Filters and actions with a new profiler if profiling is enabled, otherwise drop the
+/// timings of the previous event loop. Jitted nodes are registered through the concrete nodes they wrap.
+void RLoopManager::InitProfiler()
+{
+   if (fProfilingEvery == 0) {
+      fProfiler.reset();
+      return;
+   }
+
+   fProfiler = std::make_unique<RDFInternal::RNodeProfiler>(fProfilingEvery, fNSlots);
+   for (auto *define : fBookedDefines)
+      fProfiler->AddNode(define->GetProfilingKey(), "Define", define->GetName());
+   for (auto *filter : fBookedFilters)
+      fProfiler->AddNode(filter, "Filter", filter->HasName() ? filter->GetName() : "Filter");
+   for (auto *action : fBookedActions)
+      fProfiler->AddNode(action, "Action", action->GetActionName());
+}
+
 /// Perform clean-up operations. To be called at the end of each event loop.
 void RLoopManager::CleanUpNodes()
 {
@@ -834,6 +930,8 @@ void RLoopManager::Run()
 
    Jit();
 
+   InitProfiler();
+
    InitNodes();
 
    TStopwatch s;
@@ -874,6 +972,8 @@ void RLoopManager::Register(RDFInternal::RActionBase *actionPtr)
 
 void RLoopManager::Deregister(RDFInternal::RActionBase *actionPtr)
 {
+   if (fProfiler)
+      fProfiler->RemoveNode(actionPtr);
    RDFInternal::Erase(actionPtr, fRunActions);
    RDFInternal::Erase(actionPtr, fBookedActions);
 }
@@ -889,6 +989,8 @@ void RLoopManager::Register(RFilterBase *filterPtr)
 
 void RLoopManager::Deregister(RFilterBase *filterPtr)
 {
+   if (fProfiler)
+      fProfiler->RemoveNode(filterPtr);
    RDFInternal::Erase(filterPtr, fBookedFilters);
    RDFInternal::Erase(filterPtr, fBookedNamedFilters);
 }
@@ -910,6 +1012,8 @@ void RLoopManager::Register(RDefineBase *ptr)
 
 void RLoopManager::Deregister(RDefineBase *ptr)
 {
+   if (fProfiler)
+      fProfiler->RemoveNode(ptr->GetProfilingKey());
    RDFInternal::Erase(ptr, fBookedDefines);
 }
 
@@ -929,6 +1033,16 @@ bool RLoopManager::CheckFilters(unsigned int, Long64_t)
    return true;
 }
 
+/// All entries pass the (non-existent) filters of the head node.
+const RDFInternal::RMaskedEntryRange &
+RLoopManager::CheckFiltersBulk(unsigned int slot, Long64_t firstEntry, std::size_t bulkSize)
+{
+   auto &mask = fBulkMasks[slot];
+   if (mask.FirstEntry() != firstEntry || mask.Size() != bulkSize)
+      mask.Reset(firstEntry, bulkSize, true);
+   return mask;
+}
+
 /// Call `FillReport` on all booked filters
 void RLoopManager::Report(ROOT::RDF::RCutFlowReport &rep) const
 {
@@ -951,6 +1065,32 @@ void RLoopManager::ToJitExec(const std::string &code) const
    GetCodeToJit().append(code);
 }
 
+/// Return the jitted Define registered with the given key, if it is still alive, nullptr otherwise.
+std::shared_ptr<RJittedDefine> RLoopManager::FindSharedJittedDefine(const std::string &key) const
+{
+   auto it = fSharedJittedDefines.find(key);
+   return it == fSharedJittedDefines.end() ? nullptr : it->second.lock();
+}
+
+/// Register a jitted Define with the given key, so that later identical Defines can share it.
+void RLoopManager::AddSharedJittedDefine(const std::string &key, const std::shared_ptr<RJittedDefine> &define)
+{
+   fSharedJittedDefines[key] = define;
+}
+
+/// Return the jitted Filter registered with the given key, if it is still alive, nullptr otherwise.
+std::shared_ptr<RJittedFilter> RLoopManager::FindSharedJittedFilter(const std::string &key) const
+{
+   auto it = fSharedJittedFilters.find(key);
+   return it == fSharedJittedFilters.end() ? nullptr : it->second.lock();
+}
+
+/// Register a jitted Filter with the given key, so that later identical Filters can share it.
+void RLoopManager::AddSharedJittedFilter(const std::string &key, const std::shared_ptr<RJittedFilter> &filter)
+{
+   fSharedJittedFilters[key] = filter;
+}
+
 void RLoopManager::RegisterCallback(ULong64_t everyNEvents, std::function<void(unsigned int)> &&f)
 {
    if (everyNEvents == 0ull)
@@ -26,7 +26,9 @@
 
 #include <TError.h>
 
+#include <algorithm>
 #include <string>
+#include <unordered_set>
 #include <vector>
 #include <typeinfo>
 #include <utility>
@@ -74,11 +76,10 @@ public:
    // Field is only used for reading
    void GenerateColumnsImpl() final { assert(false && "Cardinality fields must only be used for reading"); }
 
-   void GenerateColumnsImpl(const RNTupleDescriptor &) final
+   void GenerateColumnsImpl(const RNTupleDescriptor &desc) final
    {
-      RColumnModel model(EColumnType::kIndex, true /* isSorted*/);
-      fColumns.emplace_back(std::unique_ptr<ROOT::Experimental::Detail::RColumn>(
-         ROOT::Experimental::Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(model, 0)));
+      EnsureSplittableColumnType(EColumnType::kIndex, EColumnType::kSplitIndex32, 0, desc);
+      GenerateSplittableColumn<ClusterSize_t, EColumnType::kIndex, EColumnType::kSplitIndex32>(0, true /* isSorted*/);
       fPrincipalColumn = fColumns[0].get();
    }
 
@@ -122,10 +123,13 @@ class RNTupleColumnReader : public ROOT::Detail::RDF::RColumnReaderBase {
    std::unique_ptr<RFieldBase> fField; ///< The field backing the RDF column
    RFieldValue fValue;                 ///< The memory location used to read from fField
    Long64_t fLastEntry;                ///< Last entry number that was read
+   /// Set if fField is an RVec field, whose items are adopted from the pages when possible instead of being copied
+   ROOT::Experimental::RRVecField *fRVecField;
 
 public:
    RNTupleColumnReader(std::unique_ptr<RFieldBase> f)
-      : fField(std::move(f)), fValue(fField->GenerateValue()), fLastEntry(-1)
+      : fField(std::move(f)), fValue(fField->GenerateValue()), fLastEntry(-1),
+        fRVecField(dynamic_cast<ROOT::Experimental::RRVecField *>(fField.get()))
    {
    }
    virtual ~RNTupleColumnReader() { fField->DestroyValue(fValue); }
@@ -147,7 +151,9 @@ public:
    void *GetImpl(Long64_t entry) final
    {
       if (entry != fLastEntry) {
-         fField->Read(entry, &fValue);
+         // The RVec returned to RDataFrame is only used until the next entry is read, so it can point into the page
+         if (!fRVecField || !fRVecField->ReadMapped(entry, &fValue))
+            fField->Read(entry, &fValue);
          fLastEntry = entry;
       }
       return fValue.GetRawPtr();
@@ -300,6 +306,14 @@ bool RNTupleDS::SetEntry(unsigned int, ULong64_t)
    return true;
 }
 
+void RNTupleDS::AddValueRangeFilter(std::string_view fieldName, double min, double max)
+{
+   const auto fieldId = fSources[0]->GetSharedDescriptorGuard()->FindFieldId(fieldName);
+   if (fieldId == kInvalidDescriptorId)
+      throw RException(R__FAIL("no such field: " + std::string(fieldName)));
+   fValueRangeFilters.push_back({fieldId, min, max});
+}
+
 std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
 {
    // TODO(jblomer): use cluster boundaries for the entry ranges
@@ -307,6 +321,32 @@ std::vector<std::pair<ULong64_t, ULong64_t>> RNTupleDS::GetEntryRanges()
    if (fHasSeenAllRanges)
       return ranges;
 
+   if (!fValueRangeFilters.empty()) {
+      // One range per run of consecutive clusters that pass all the filters
+      auto descriptorGuard = fSources[0]->GetSharedDescriptorGuard();
+      auto clusterIds = descriptorGuard->FindClustersInValueRange(
+         fValueRangeFilters[0].fFieldId, fValueRangeFilters[0].fMin, fValueRangeFilters[0].fMax);
+      for (std::size_t i = 1; i < fValueRangeFilters.size(); ++i) {
+         const auto &filter = fValueRangeFilters[i];
+         const auto passed = descriptorGuard->FindClustersInValueRange(filter.fFieldId, filter.fMin, filter.fMax);
+         const std::unordered_set<DescriptorId_t> passedSet(passed.begin(), passed.end());
+         clusterIds.erase(std::remove_if(clusterIds.begin(), clusterIds.end(),
+                                         [&passedSet](DescriptorId_t id) { return passedSet.count(id) == 0; }),
+                          clusterIds.end());
+      }
+      for (auto clusterId : clusterIds) {
+         const auto &clusterDesc = descriptorGuard->GetClusterDescriptor(clusterId);
+         const ULong64_t start = clusterDesc.GetFirstEntryIndex();
+         const ULong64_t end = start + clusterDesc.GetNEntries();
+         if (!ranges.empty() && ranges.back().second == start)
+            ranges.back().second = end;
+         else
+            ranges.emplace_back(start, end);
+      }
+      fHasSeenAllRanges = true;
+      return ranges;
+   }
+
    auto nEntries = fSources[0]->GetNEntries();
    const auto chunkSize = nEntries / fNSlots;
    const auto reminder = 1U == fNSlots ? 0 : nEntries % fNSlots;
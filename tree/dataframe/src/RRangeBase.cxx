@@ -24,6 +24,7 @@ void RRangeBase::ResetCounters()
    fLastCheckedEntry = -1;
    fNProcessedEntries = 0;
    fHasStopped = false;
+   fBulkMask.Invalidate();
 }
 
 // outlined to pin virtual table
@@ -358,7 +358,7 @@ constexpr char const *RSqliteDS::fgTypeNames[];
 ///
 /// The constructor opens the sqlite file, prepares the query engine and determines the column names and types.
 RSqliteDS::RSqliteDS(const std::string &fileName, const std::string &query)
-   : fDataSet(std::make_unique<Internal::RSqliteDSDataSet>()), fNSlots(0), fNRow(0)
+   : fDataSet(std::make_unique<Internal::RSqliteDSDataSet>()), fNSlots(0), fNRow(0), fBatchFirstRow(0)
 {
    static bool hasSqliteVfs = RegisterSqliteVfs();
    if (!hasSqliteVfs)
@@ -480,27 +480,61 @@ RDataSource::Record_t RSqliteDS::GetColumnReadersImpl(std::string_view name, con
    }
 
    fValues[index].fIsActive = true;
-   return std::vector<void *>{fNSlots, &fValues[index].fPtr};
+   if (fNSlots < 2)
+      return std::vector<void *>{fNSlots, &fValues[index].fPtr};
+
+   std::vector<void *> ptrs;
+   ptrs.reserve(fNSlots);
+   for (auto &slotValues : fSlotValues)
+      ptrs.emplace_back(&slotValues[index].fPtr);
+   return ptrs;
 }
 
 ////////////////////////////////////////////////////////////////////////////
-/// Returns a range of size 1 as long as more rows are available in the SQL result set.
-/// This inherently serialized the RDF independent of the number of slots.
+/// In single-threaded mode, returns a range of size 1 as long as more rows are available in the SQL result set.
+/// In multi-threaded mode, reads up to fgRowsPerSlot rows per slot into the batch buffer and returns one range
+/// per slot over these rows. Stepping the SQL query itself remains serialized.
 std::vector<std::pair<ULong64_t, ULong64_t>> RSqliteDS::GetEntryRanges()
 {
    std::vector<std::pair<ULong64_t, ULong64_t>> entryRanges;
-   int retval = sqlite3_step(fDataSet->fQuery);
-   switch (retval) {
-   case SQLITE_DONE: return entryRanges;
-   case SQLITE_ROW:
-      entryRanges.emplace_back(fNRow, fNRow + 1);
-      fNRow++;
+   const bool isBatched = fNSlots > 1;
+   const ULong64_t maxRows = isBatched ? ULong64_t(fNSlots) * fgRowsPerSlot : 1;
+   const auto nColumns = fValues.size();
+   if (isBatched && fBatch.empty()) {
+      fBatch.reserve(maxRows * nColumns);
+      for (ULong64_t r = 0; r < maxRows; ++r) {
+         for (const auto &value : fValues)
+            fBatch.emplace_back(value.fType);
+      }
+   }
+
+   fBatchFirstRow = fNRow;
+   ULong64_t nRows = 0;
+   while (nRows < maxRows) {
+      int retval = sqlite3_step(fDataSet->fQuery);
+      if (retval == SQLITE_DONE)
+         break;
+      if (retval != SQLITE_ROW)
+         SqliteError(retval);
+      // In single-threaded mode, SetEntry() reads the values directly from the current row of the query
+      if (isBatched)
+         ReadRow(&fBatch[nRows * nColumns]);
+      nRows++;
+   }
+   fNRow += nRows;
+   if (nRows == 0)
       return entryRanges;
-   default:
-      SqliteError(retval);
-      // Never here
-      abort();
+
+   const ULong64_t nRanges = std::min<ULong64_t>(nRows, fNSlots);
+   const ULong64_t rangeSize = nRows / nRanges;
+   const ULong64_t remainder = nRows % nRanges;
+   ULong64_t start = fBatchFirstRow;
+   for (ULong64_t i = 0; i < nRanges; ++i) {
+      const ULong64_t end = start + rangeSize + (i < remainder ? 1 : 0);
+      entryRanges.emplace_back(start, end);
+      start = end;
    }
+   return entryRanges;
 }
 
 ////////////////////////////////////////////////////////////////////////////
@@ -550,51 +584,87 @@ RDataFrame MakeSqliteDataFrame(std::string_view fileName, std::string_view query
 }
 
 ////////////////////////////////////////////////////////////////////////////
-/// Stores the result of the current active sqlite query row as a C++ value.
-bool RSqliteDS::SetEntry(unsigned int /* slot */, ULong64_t entry)
+/// Stores the active columns of the current sqlite query row as C++ values in `row`, which has one value per column.
+void RSqliteDS::ReadRow(Value_t *row)
 {
-   assert(entry + 1 == fNRow);
-   (void)entry;
    unsigned N = fValues.size();
    for (unsigned i = 0; i < N; ++i) {
       if (!fValues[i].fIsActive)
          continue;
 
       int nbytes;
-      switch (fValues[i].fType) {
-      case ETypes::kInteger: fValues[i].fInteger = sqlite3_column_int64(fDataSet->fQuery, i); break;
-      case ETypes::kReal: fValues[i].fReal = sqlite3_column_double(fDataSet->fQuery, i); break;
+      switch (row[i].fType) {
+      case ETypes::kInteger: row[i].fInteger = sqlite3_column_int64(fDataSet->fQuery, i); break;
+      case ETypes::kReal: row[i].fReal = sqlite3_column_double(fDataSet->fQuery, i); break;
       case ETypes::kText:
          nbytes = sqlite3_column_bytes(fDataSet->fQuery, i);
          if (nbytes == 0) {
-            fValues[i].fText = "";
+            row[i].fText = "";
          } else {
-            fValues[i].fText = reinterpret_cast<const char *>(sqlite3_column_text(fDataSet->fQuery, i));
+            row[i].fText = reinterpret_cast<const char *>(sqlite3_column_text(fDataSet->fQuery, i));
          }
          break;
       case ETypes::kBlob:
          nbytes = sqlite3_column_bytes(fDataSet->fQuery, i);
-         fValues[i].fBlob.resize(nbytes);
+         row[i].fBlob.resize(nbytes);
          if (nbytes > 0) {
-            std::memcpy(fValues[i].fBlob.data(), sqlite3_column_blob(fDataSet->fQuery, i), nbytes);
+            std::memcpy(row[i].fBlob.data(), sqlite3_column_blob(fDataSet->fQuery, i), nbytes);
          }
          break;
       case ETypes::kNull: break;
       default: throw std::runtime_error("Unhandled column type");
       }
    }
+}
+
+////////////////////////////////////////////////////////////////////////////
+/// Stores the result of the current active sqlite query row as a C++ value. In multi-threaded mode, moves the
+/// values of the given entry from the batch buffer to the values of the slot. Every entry is set exactly once.
+bool RSqliteDS::SetEntry(unsigned int slot, ULong64_t entry)
+{
+   if (fNSlots < 2) {
+      assert(entry + 1 == fNRow);
+      (void)entry;
+      ReadRow(fValues.data());
+      return true;
+   }
+
+   assert(entry >= fBatchFirstRow && entry < fNRow);
+   const auto nColumns = fValues.size();
+   Value_t *row = &fBatch[(entry - fBatchFirstRow) * nColumns];
+   auto &slotValues = fSlotValues[slot];
+   for (unsigned i = 0; i < nColumns; ++i) {
+      if (!fValues[i].fIsActive)
+         continue;
+
+      switch (row[i].fType) {
+      case ETypes::kInteger: slotValues[i].fInteger = row[i].fInteger; break;
+      case ETypes::kReal: slotValues[i].fReal = row[i].fReal; break;
+      case ETypes::kText: std::swap(slotValues[i].fText, row[i].fText); break;
+      case ETypes::kBlob: std::swap(slotValues[i].fBlob, row[i].fBlob); break;
+      case ETypes::kNull: break;
+      default: throw std::runtime_error("Unhandled column type");
+      }
+   }
    return true;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////
-/// Almost a no-op, many slots can in fact reduce the performance due to thread synchronization.
+/// In multi-threaded mode, prepares the values of every slot. The rows are then read in batches by GetEntryRanges().
 void RSqliteDS::SetNSlots(unsigned int nSlots)
 {
-   if (nSlots > 1) {
-      ::Warning("SetNSlots", "Currently the SQlite data source faces performance degradation in multi-threaded mode. "
-                             "Consider turning off IMT.");
-   }
    fNSlots = nSlots;
+   fSlotValues.clear();
+   fBatch.clear();
+   if (nSlots < 2)
+      return;
+
+   fSlotValues.resize(nSlots);
+   for (auto &slotValues : fSlotValues) {
+      slotValues.reserve(fValues.size());
+      for (const auto &value : fValues)
+         slotValues.emplace_back(value.fType);
+   }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////
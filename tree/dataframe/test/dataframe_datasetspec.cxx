@@ -283,6 +283,20 @@ TEST_P(RDatasetSpecTest, Friends)
    }
 }
 
+// with known numbers of entries, the files outside of the range need not exist
+TEST_P(RDatasetSpecTest, EntriesPerFile)
+{
+   RDatasetSpec spec("subTree",
+                     {"specTestFile1.root"s, "specTestFile2.root"s, "specTestFile3.root"s, "doesNotExist.root"s},
+                     {1, 4});
+   spec.SetEntriesPerFile({2, 2, 1, 10});
+   auto res = *(RDataFrame(spec).Take<ULong64_t>("z"));
+   std::sort(res.begin(), res.end());
+   EXPECT_VEC_EQ(res, {101u, 102u, 103u});
+
+   EXPECT_THROW(spec.SetEntriesPerFile({2, 2}), std::logic_error);
+}
+
 TEST_P(RDatasetSpecTest, Histo1D)
 {
    RDatasetSpec spec(
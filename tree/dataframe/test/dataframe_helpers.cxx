@@ -4,6 +4,7 @@
 #include <ROOT/RVec.hxx>
 #include <ROOT/RDFHelpers.hxx>
 #include <ROOT/RResultHandle.hxx>
+#include <TInterpreter.h>
 #include <TSystem.h>
 #include <RConfigure.h>
 
@@ -683,3 +684,68 @@ TEST(RunGraphs, AlreadyRun)
    ROOT_EXPECT_WARNING(ROOT::RDF::RunGraphs({r1, r2, r3, r4}), "RunGraphs",
                        "Got 4 handles from which 2 link to results which are already ready.");
 }
+
+TEST(RDFHelpers, JitCache)
+{
+   const std::string cacheDir = "dataframe_helpers_jitcache";
+   ROOT::RDF::Experimental::SetJitCacheDir(cacheDir);
+   EXPECT_EQ(cacheDir, ROOT::RDF::Experimental::GetJitCacheDir());
+
+   // a function that is only known to the interpreter: the expression using it cannot be compiled by ACLiC
+   gInterpreter->Declare("int JitCacheTestTriple(int x) { return 3 * x; }");
+
+   ROOT::RDataFrame df(10);
+   auto withX = df.Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"});
+   auto sumY = withX.Define("y", "x * 2").Filter("y > 4").Sum<int>("y");
+   auto sumZ = withX.Define("z", "JitCacheTestTriple(x)").Sum<int>("z");
+   EXPECT_EQ(84, *sumY);
+   EXPECT_EQ(135, *sumZ);
+
+   ROOT::RDF::Experimental::SetJitCacheDir("");
+   EXPECT_TRUE(ROOT::RDF::Experimental::GetJitCacheDir().empty());
+
+   void *dir = gSystem->OpenDirectory(cacheDir.c_str());
+   ASSERT_NE(nullptr, dir);
+   int nMacros = 0;
+   int nFailed = 0;
+   while (const char *entry = gSystem->GetDirEntry(dir)) {
+      const std::string name = entry;
+      if (name.size() > 2 && name.compare(name.size() - 2, 2, ".C") == 0)
+         ++nMacros;
+      if (name.size() > 7 && name.compare(name.size() - 7, 7, ".failed") == 0)
+         ++nFailed;
+   }
+   gSystem->FreeDirectory(dir);
+   EXPECT_EQ(3, nMacros);
+   EXPECT_EQ(1, nFailed);
+
+   gSystem->Exec(("rm -rf " + cacheDir).c_str());
+}
+
+TEST(RDFHelpers, ExportCode)
+{
+   ROOT::RDataFrame df(10);
+   auto withX = df.Define("x", "int(rdfentry_)");
+   auto sum = withX.Define("y", "x * 2").Filter("y > 4", "cut").Sum<int>("y");
+   auto count = withX.Filter("x % 2 == 0").Count();
+
+   const auto code = ROOT::RDF::Experimental::ExportCode(df, "ExportCodeTestGraph");
+   EXPECT_NE(std::string::npos, code.find(", {\"y\"}, \"cut\")")) << code;
+
+   // the exported graph gives the same results as the original one
+   ASSERT_TRUE(gInterpreter->Declare(code.c_str())) << code;
+   using Build_t = std::vector<RNode> (*)(RNode);
+   auto build = reinterpret_cast<Build_t>(gInterpreter->ProcessLine("&ExportCodeTestGraph;"));
+   ASSERT_NE(nullptr, build);
+   auto nodes = build(ROOT::RDataFrame(10));
+   ASSERT_EQ(2u, nodes.size());
+   EXPECT_EQ(*sum, *nodes[0].Sum<int>("y"));
+   EXPECT_EQ(*count, *nodes[1].Count());
+   EXPECT_EQ(84, *sum);
+   EXPECT_EQ(5ull, *count);
+
+   // nodes booked with C++ callables cannot be exported
+   ROOT::RDataFrame df2(1);
+   auto count2 = df2.Define("x", [] { return 1; }).Filter("x > 0").Count();
+   EXPECT_THROW(ROOT::RDF::Experimental::ExportCode(df2), std::runtime_error);
+}
@@ -346,3 +346,48 @@ TEST(RDataFrameHisto, FillVecBool)
     EXPECT_EQ(h->GetBinContent(2), n);
     EXPECT_EQ(h->GetBinContent(3), 0u);
 }
+
+// TH1Ds are filled in bulk from per-slot buffers: check that the result does not depend on that
+TEST(RDataFrameHisto, BufferedFill)
+{
+   const auto n = 5000u;
+   ROOT::RDataFrame df(n);
+   auto d = df.Define("x", [](ULong64_t e) { return double(e % 100); }, {"rdfentry_"})
+               .Define("w", [](ULong64_t e) { return 0.5 * (e % 3); }, {"rdfentry_"})
+               .Define("v", [](ULong64_t e) { return ROOT::RVecD{double(e % 10), double(e % 7)}; }, {"rdfentry_"});
+   auto h = d.Histo1D<double>({"h", "h", 50, 0, 100}, "x");
+   auto hw = d.Histo1D<double, double>({"hw", "hw", 50, 0, 100}, "x", "w");
+   auto hv = d.Histo1D<ROOT::RVecD>({"hv", "hv", 10, 0, 10}, "v");
+   unsigned int nPartial = 0;
+   h.OnPartialResult(1000, [&nPartial](TH1D &partial) {
+      ++nPartial;
+      EXPECT_EQ(1000. * nPartial, partial.GetEntries());
+   });
+
+   TH1D ref("ref", "ref", 50, 0, 100);
+   TH1D refw("refw", "refw", 50, 0, 100);
+   TH1D refv("refv", "refv", 10, 0, 10);
+   ref.SetDirectory(nullptr);
+   refw.SetDirectory(nullptr);
+   refv.SetDirectory(nullptr);
+   for (auto e : ROOT::TSeqU(n)) {
+      ref.Fill(e % 100);
+      refw.Fill(e % 100, 0.5 * (e % 3));
+      refv.Fill(e % 10);
+      refv.Fill(e % 7);
+   }
+
+   auto checkEqual = [](const TH1D &hist, const TH1D &expected) {
+      EXPECT_EQ(expected.GetEntries(), hist.GetEntries());
+      EXPECT_DOUBLE_EQ(expected.GetMean(), hist.GetMean());
+      EXPECT_DOUBLE_EQ(expected.GetStdDev(), hist.GetStdDev());
+      for (auto i : ROOT::TSeqI(expected.GetNbinsX() + 2)) {
+         EXPECT_DOUBLE_EQ(expected.GetBinContent(i), hist.GetBinContent(i));
+         EXPECT_DOUBLE_EQ(expected.GetBinError(i), hist.GetBinError(i));
+      }
+   };
+   checkEqual(*h, ref);
+   checkEqual(*hw, refw);
+   checkEqual(*hv, refv);
+   EXPECT_EQ(5u, nPartial);
+}
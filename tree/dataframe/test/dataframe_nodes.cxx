@@ -1,10 +1,13 @@
 #include "ROOT/TestSupport.hxx"
 
 #include <ROOT/RDataFrame.hxx>
+#include <ROOT/RDFHelpers.hxx>
 #include <ROOT/RDF/RSlotStack.hxx>
 #include <TStatistic.h> // To check reading of columns with types which are mothers of the column type
+#include <TInterpreter.h>
 #include <TSystem.h>
 
+#include <map>
 #include <mutex>
 #include <thread>
 #include <stdexcept> // std::runtime_error
@@ -104,3 +107,144 @@ TEST(RDataFrameNodes, InheritanceOfDefines)
    ROOT::RDataFrame(1).Define("x", createStat).Snapshot<TStatistic>("t", ofileName, {"x"})->Foreach(checkStat, {"x"});
    gSystem->Unlink(ofileName);
 }
+
+TEST(RDataFrameNodes, BulkProcessing)
+{
+   auto runGraph = [](unsigned int bulkSize) {
+      ROOT::RDataFrame df(1000);
+      df.SetBulkSize(bulkSize);
+      unsigned int nEvaluations = 0;
+      auto d = df.Define("x", [&nEvaluations](ULong64_t e) { ++nEvaluations; return int(e); }, {"rdfentry_"});
+      auto f = d.Filter([](int x) { return x % 3 == 0; }, {"x"}, "multipleOf3");
+      auto sum = f.Sum<int>("x");
+      auto count = f.Count();
+      auto max = d.Max<int>("x");
+      auto ranged = f.Range(10, 20).Sum<int>("x");
+      auto report = df.Report();
+      std::vector<double> results{double(*sum), double(*count), double(*max), double(*ranged),
+                                  double(report->At("multipleOf3").GetPass())};
+      EXPECT_EQ(1u, df.GetNRuns());
+      // the defined value is evaluated once per entry even if it is read by several nodes
+      EXPECT_EQ(1000u, nEvaluations);
+      return results;
+   };
+
+   const auto expected = runGraph(0);
+   EXPECT_EQ((std::vector<double>{3. * 333. * 334. / 2., 334., 999., 3. * (10. + 19.) * 10. / 2., 334.}), expected);
+   EXPECT_EQ(expected, runGraph(64));
+   EXPECT_EQ(expected, runGraph(1000));
+   EXPECT_EQ(expected, runGraph(4096));
+}
+
+TEST(RDataFrameNodes, FilterReordering)
+{
+   auto runGraph = [](ULong64_t nSampleEntries) {
+      ROOT::RDataFrame df(100);
+      df.SetFilterReordering(nSampleEntries);
+      unsigned int nPermissive = 0;
+      unsigned int nSelective = 0;
+      auto d = df.Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"});
+      // the filter that rejects most entries comes last
+      auto f = d.Filter([&nPermissive](int) { return ++nPermissive > 0; }, {"x"})
+                  .Filter([&nSelective](int x) { return ++nSelective, x % 10 == 0; }, {"x"});
+      auto count = f.Count();
+      auto sum = f.Sum<int>("x");
+      return std::vector<unsigned int>{static_cast<unsigned int>(*count), static_cast<unsigned int>(*sum),
+                                       nPermissive, nSelective};
+   };
+
+   EXPECT_EQ((std::vector<unsigned int>{10u, 450u, 100u, 100u}), runGraph(0));
+   // after the first 10 entries, the selective filter runs first and the permissive one only sees the 9 entries it
+   // does not reject
+   EXPECT_EQ((std::vector<unsigned int>{10u, 450u, 19u, 100u}), runGraph(10));
+}
+
+TEST(RDataFrameNodes, SharedJittedNodes)
+{
+   gInterpreter->Declare("int gSharedJittedNodesCount = 0;"
+                         "int SharedJittedNodesCount(ULong64_t e) { ++gSharedJittedNodesCount; return int(e); }");
+   auto getCount = [] { return *reinterpret_cast<int *>(gInterpreter->Calc("&gSharedJittedNodesCount")); };
+
+   ROOT::RDataFrame df(10);
+   // the same Define in two branches: evaluated once per entry
+   auto sum = df.Define("y", "SharedJittedNodesCount(rdfentry_)").Sum<int>("y");
+   auto max = df.Define("y", "SharedJittedNodesCount(rdfentry_)").Max<int>("y");
+   EXPECT_EQ(45, *sum);
+   EXPECT_EQ(9, *max);
+   EXPECT_EQ(10, getCount());
+
+   // the same unnamed Filter booked twice on the same node: evaluated once per entry
+   auto count1 = df.Filter("SharedJittedNodesCount(rdfentry_) > 4").Count();
+   auto count2 = df.Filter("SharedJittedNodesCount(rdfentry_) > 4").Count();
+   EXPECT_EQ(5u, *count1);
+   EXPECT_EQ(5u, *count2);
+   EXPECT_EQ(20, getCount());
+
+   // Defines with different inputs are not shared
+   auto d = df.Define("x", [](ULong64_t e) { return e + 1; }, {"rdfentry_"});
+   auto sumX = d.Define("y", "SharedJittedNodesCount(x)").Sum<int>("y");
+   auto sumE = df.Define("y", "SharedJittedNodesCount(rdfentry_)").Sum<int>("y");
+   EXPECT_EQ(55, *sumX);
+   EXPECT_EQ(45, *sumE);
+   EXPECT_EQ(40, getCount());
+}
+
+TEST(RDataFrameNodes, Profiling)
+{
+   ROOT::RDataFrame df(100);
+   df.SetProfiling(10);
+   auto d = df.Define("x", [](ULong64_t e) { return e * 0.5; }, {"rdfentry_"}).Define("y", "x * 2");
+   auto sum = d.Filter([](double x) { return x > 10; }, {"x"}, "xcut").Sum<double>("y");
+   EXPECT_TRUE(df.GetProfile().empty());
+   EXPECT_DOUBLE_EQ(4740., *sum); // sum of the entry numbers from 21 to 99
+
+   std::map<std::string, ROOT::RDF::RNodeProfile> nodes;
+   for (const auto &node : df.GetProfile()) {
+      EXPECT_GE(node.fTime, 0.);
+      nodes[node.fKind + " " + node.fName] = node;
+   }
+   ASSERT_EQ(4u, nodes.size());
+   // entries 0, 10, ..., 90 are timed, only 30, 40, ..., 90 pass the filter
+   EXPECT_EQ(10u, nodes["Define x"].fSamples);
+   EXPECT_EQ(10u, nodes["Filter xcut"].fSamples);
+   EXPECT_EQ(7u, nodes["Define y"].fSamples);
+   EXPECT_EQ(7u, nodes["Action Sum"].fSamples);
+   EXPECT_NE(std::string::npos, ROOT::RDF::SaveGraph(df).find(" ms</FONT>"));
+
+   df.SetProfiling(0);
+   df.Count().GetValue();
+   EXPECT_TRUE(df.GetProfile().empty());
+}
+
+TEST(RDataFrameNodes, DefineBulk)
+{
+   auto runGraph = [](unsigned int bulkSize) {
+      ROOT::RDataFrame df(1000);
+      df.SetBulkSize(bulkSize);
+      unsigned int nCalls = 0;
+      auto kernel = [&nCalls](const ROOT::RVec<ULong64_t> &e) {
+         ++nCalls;
+         return ROOT::RVecI(e) * 2;
+      };
+      auto d = df.DefineBulk("x", kernel, {"rdfentry_"});
+      auto f = d.Filter([](int x) { return x % 3 == 0; }, {"x"});
+      auto sum = f.Sum<int>("x");
+      auto max = d.Max<int>("x");
+      std::vector<double> results{double(*sum), double(*max)};
+      return std::make_pair(results, nCalls);
+   };
+
+   const auto expected = runGraph(0);
+   EXPECT_EQ((std::vector<double>{2. * 3. * 333. * 334. / 2., 1998.}), expected.first);
+   // one call per entry outside of bulk processing mode, one per bulk otherwise
+   EXPECT_EQ(1000u, expected.second);
+   const auto bulk = runGraph(100);
+   EXPECT_EQ(expected.first, bulk.first);
+   EXPECT_EQ(10u, bulk.second);
+
+   ROOT::RDataFrame df(10);
+   df.SetBulkSize(5);
+   auto wrongSize = df.DefineBulk("x", [](const ROOT::RVec<ULong64_t> &e) { return ROOT::RVecD(e.size() + 1); },
+                                  {"rdfentry_"});
+   EXPECT_THROW(wrongSize.Sum<double>("x").GetValue(), std::runtime_error);
+}
@@ -701,6 +701,27 @@ TEST_P(RDFVary, FilterChainDependingOnVariations)
    EXPECT_EQ(sums["y:1"], 30);
 }
 
+TEST_P(RDFVary, ManyVariationsSharingFilters)
+{
+   // the Filter on "e" is shared by all variations of "x", only the variations of "e" get their own Filter
+   auto sum = ROOT::RDataFrame(10)
+                 .Define("e", [](ULong64_t e) { return int(e); }, {"rdfentry_"})
+                 .Define("x", [] { return 1; })
+                 .Vary("x", [] { return ROOT::RVecI(200, 2); }, {}, 200)
+                 .Vary("e", [](int e) { return ROOT::RVecI{e, e + 1}; }, {"e"}, 2)
+                 .Filter([](int e) { return e % 2 == 0; }, {"e"})
+                 .Sum<int>("x");
+   EXPECT_EQ(*sum, 5);
+
+   auto sums = VariationsFor(sum);
+   EXPECT_EQ(sums.GetKeys().size(), 203u);
+   EXPECT_EQ(sums["nominal"], 5);
+   EXPECT_EQ(sums["x:0"], 10);
+   EXPECT_EQ(sums["x:199"], 10);
+   EXPECT_EQ(sums["e:0"], 5);
+   EXPECT_EQ(sums["e:1"], 5);
+}
+
 TEST_P(RDFVary, JittedAction)
 {
    auto df = ROOT::RDataFrame(10).Define("x", [] { return 1; });
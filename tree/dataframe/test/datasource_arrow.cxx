@@ -164,6 +164,32 @@ TEST(RArrowDS, ColumnReadersString)
    }
 }
 
+TEST(RArrowDS, ColumnReadersChunked)
+{
+   std::shared_ptr<Array> chunk0, chunk1;
+   arrow::ArrayFromVector<Int64Type, int64_t>({1, 2, 3}, &chunk0);
+   arrow::ArrayFromVector<Int64Type, int64_t>({4, 5}, &chunk1);
+   auto chunked = std::make_shared<arrow::ChunkedArray>(arrow::ArrayVector{chunk0, chunk1});
+   auto table =
+      Table::Make(schema({field("x", arrow::int64())}), std::vector<std::shared_ptr<ChunkedArray>>{chunked});
+
+   RArrowDS tds(table, {});
+   tds.SetNSlots(1);
+   auto vals = tds.GetColumnReaders<Long64_t>("x");
+   tds.Initialize();
+   auto ranges = tds.GetEntryRanges();
+   ASSERT_EQ(1U, ranges.size());
+   // values are read in place within a chunk and across the chunk boundary
+   tds.InitSlot(0, 0);
+   for (auto i : ROOT::TSeqU(5)) {
+      tds.SetEntry(0, i);
+      EXPECT_EQ(Long64_t(i + 1), **vals[0]);
+   }
+   // going back to the first chunk
+   tds.SetEntry(0, 1);
+   EXPECT_EQ(2, **vals[0]);
+}
+
 #ifndef NDEBUG
 
 TEST(RArrowDS, SetNSlotsTwice)
@@ -3,9 +3,11 @@
 #include <ROOT/TSeq.hxx>
 #include <ROOT/TestSupport.hxx>
 #include <TROOT.h>
+#include <TSystem.h>
 
 #include <gtest/gtest.h>
 
+#include <fstream>
 #include <iostream>
 
 using namespace ROOT::RDF;
@@ -418,4 +420,39 @@ TEST(RCsvDS, NanWarningChecks)
    EXPECT_EQ(d->AsString(), AsString);
 }
 
+TEST(RCsvDS, ParallelParsing)
+{
+   // more lines than are parsed in one batch
+   const auto fileName = "RCsvDS_test_parallelparsing.csv";
+   const auto nLines = 100000LL;
+   {
+      std::ofstream f(fileName);
+      f << "i,x,b,s\n";
+      for (auto i = 0LL; i < nLines; ++i)
+         f << i << ',' << 0.5 * i << ',' << (i % 3 == 0 ? "true" : "false") << ",\"a,\"\"" << i % 10 << "\"\n";
+   }
+
+   auto check = [&] {
+      auto df = ROOT::RDF::MakeCsvDataFrame(fileName);
+      auto sumI = df.Sum<Long64_t>("i");
+      auto sumX = df.Sum<double>("x");
+      auto nTrue = df.Filter([](bool b) { return b; }, {"b"}).Count();
+      auto s = df.Take<std::string>("s");
+      auto i = df.Take<Long64_t>("i");
+      EXPECT_EQ(nLines * (nLines - 1) / 2, *sumI);
+      EXPECT_DOUBLE_EQ(0.25 * nLines * (nLines - 1), *sumX);
+      EXPECT_EQ((nLines + 2) / 3, Long64_t(*nTrue));
+      ASSERT_EQ(std::size_t(nLines), s->size());
+      for (auto e = 0u; e < s->size(); ++e)
+         EXPECT_EQ("a,\"" + std::to_string((*i)[e] % 10), (*s)[e]);
+   };
+
+   check();
+   ROOT::EnableImplicitMT(4);
+   check();
+   ROOT::DisableImplicitMT();
+
+   gSystem->Unlink(fileName);
+}
+
 #endif // R__USE_IMT
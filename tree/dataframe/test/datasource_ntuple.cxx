@@ -6,6 +6,8 @@
 #include <ROOT/RNTupleModel.hxx>
 #include <ROOT/RPageStorage.hxx>
 
+#include <TSystem.h>
+
 #include <gtest/gtest.h>
 
 using ROOT::Experimental::RNTupleDS;
@@ -135,3 +137,132 @@ TEST_F(RNTupleDSTest, ReadMT)
 
    ReadTest(fNtplName, fFileName);
 }
+
+static void ReadCollectionsTest(bool useSplitEncoding)
+{
+   const std::string fileName = "RNTupleDS_collections.root";
+   {
+      auto model = RNTupleModel::Create();
+      auto v = model->MakeField<std::vector<float>>("v");
+      ROOT::Experimental::RNTupleWriteOptions options;
+      // small pages, so that some collections span two pages
+      options.SetApproxUnzippedPageSize(64);
+      options.SetUseSplitEncoding(useSplitEncoding);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileName, options);
+      for (int i = 0; i < 1000; ++i) {
+         v->assign(i % 7, float(i));
+         ntuple->Fill();
+      }
+   }
+
+   auto df = ROOT::Experimental::MakeNTupleDataFrame("ntuple", fileName);
+   std::size_t nAdopting = 0;
+   auto check = [&nAdopting](const ROOT::RVecF &v, ULong64_t entry) {
+      if (ROOT::Detail::VecOps::IsAdopting(v))
+         ++nAdopting;
+      return v.size() == entry % 7 && All(v == float(entry));
+   };
+   EXPECT_EQ(1000u, *df.Filter(check, {"v", "rdfentry_"}).Count());
+   // without split encoding, the collections within a page are not copied
+   if (useSplitEncoding)
+      EXPECT_EQ(0u, nAdopting);
+   else
+      EXPECT_GT(nAdopting, 0u);
+
+   std::remove(fileName.c_str());
+}
+
+TEST(RNTupleDS, ReadCollections)
+{
+   ReadCollectionsTest(false /* useSplitEncoding */);
+   ReadCollectionsTest(true /* useSplitEncoding */);
+}
+
+static void SnapshotToRNTupleTest(const std::string &fileName)
+{
+   ROOT::RDF::RSnapshotOptions opts;
+   opts.fOutputFormat = ROOT::RDF::ESnapshotOutputFormat::kRNTuple;
+
+   auto df = ROOT::RDataFrame(100)
+                .Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"})
+                .Define("v", [](int x) { return ROOT::RVecF(x % 3, 1.f); }, {"x"});
+   auto snap = df.Snapshot<int, ROOT::RVecF>("ntuple", fileName, {"x", "v"}, opts);
+
+   auto sumX = snap->Sum<int>("x");
+   auto sumV = snap->Define("nv", [](const ROOT::RVecF &v) { return v.size(); }, {"v"}).Sum<std::size_t>("nv");
+   EXPECT_EQ(4950, *sumX);
+   EXPECT_EQ(99u, *sumV);
+
+   // jitted Snapshot
+   auto snapJit = df.Snapshot("ntuple", fileName, {"x"}, opts);
+   EXPECT_EQ(std::vector<std::string>{"x"}, snapJit->GetColumnNames());
+   EXPECT_EQ(100u, *snapJit->Count());
+
+   std::remove(fileName.c_str());
+}
+
+TEST(RNTupleDSSnapshot, Snapshot)
+{
+   SnapshotToRNTupleTest("RNTupleDS_snapshot.root");
+}
+
+TEST(RNTupleDSSnapshot, SnapshotMT)
+{
+   IMTRAII _;
+
+   SnapshotToRNTupleTest("RNTupleDS_snapshotMT.root");
+}
+
+TEST(RNTupleDSSnapshot, PersistentCache)
+{
+   const std::string cacheDir = "RNTupleDS_persistentcache";
+   auto makeDF = [](const std::string &filterName) {
+      return ROOT::RDataFrame(10)
+         .Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"})
+         .Filter([](int x) { return x % 2 == 0; }, {"x"}, filterName);
+   };
+
+   int nLoops = 0;
+   auto countLoops = [&nLoops](int x) {
+      ++nLoops;
+      return x;
+   };
+   auto cached = makeDF("even").Define("y", countLoops, {"x"}).PersistentCache({"x", "y"}, cacheDir);
+   EXPECT_EQ(5, nLoops);
+   EXPECT_EQ(20, *cached.Sum<int>("y"));
+
+   // an identical graph reads the cache written above
+   auto cachedAgain = makeDF("even").Define("y", countLoops, {"x"}).PersistentCache({"x", "y"}, cacheDir);
+   EXPECT_EQ(5, nLoops);
+   EXPECT_EQ(20, *cachedAgain.Sum<int>("y"));
+
+   // a different graph does not
+   auto other = makeDF("other").Define("y", countLoops, {"x"}).PersistentCache({"y"}, cacheDir);
+   EXPECT_EQ(10, nLoops);
+   EXPECT_EQ(5u, *other.Count());
+
+   gSystem->Exec(("rm -rf " + cacheDir).c_str());
+}
+
+TEST(RNTupleDSSnapshot, CacheMemoryBudget)
+{
+   const std::string cacheDir = "RNTupleDS_cachebudget";
+   auto df = ROOT::RDataFrame(10).Define("x", [](ULong64_t e) { return int(e); }, {"rdfentry_"});
+
+   ROOT::RDF::RCacheOptions opts;
+   opts.fSpillDirectory = cacheDir;
+
+   // 10 ints fit in the budget: in memory
+   opts.fMemoryBudget = 1024;
+   auto inMemory = df.Cache({"x"}, opts);
+   EXPECT_EQ(45, *inMemory.Sum<int>("x"));
+   EXPECT_TRUE(gSystem->AccessPathName(cacheDir.c_str()));
+
+   // they do not fit: on disk
+   opts.fMemoryBudget = 16;
+   auto onDisk = df.Cache({"x"}, opts);
+   EXPECT_EQ(45, *onDisk.Sum<int>("x"));
+   EXPECT_FALSE(gSystem->AccessPathName(cacheDir.c_str()));
+
+   gSystem->Exec(("rm -rf " + cacheDir).c_str());
+}
@@ -124,18 +124,24 @@ TEST(RSqliteDS, ColumnReaders)
 {
    RSqliteDS rds(fileName0, query0);
    const auto nSlots = 2U;
-   ROOT_EXPECT_WARNING(rds.SetNSlots(nSlots), "SetNSlots",
-                       "Currently the SQlite data source faces performance degradation in multi-threaded mode. "
-                       "Consider turning off IMT.");
+   rds.SetNSlots(nSlots);
    auto vals = rds.GetColumnReaders<Long64_t>("fint");
+   auto vtext = rds.GetColumnReaders<std::string>("ftext");
    rds.Initialize();
+   // Both rows are read in one batch and distributed over the slots
    auto ranges = rds.GetEntryRanges();
-   EXPECT_EQ(1U, ranges.size());
+   ASSERT_EQ(2U, ranges.size());
    for (auto i : ROOT::TSeq<unsigned>(0, nSlots)) {
-      EXPECT_TRUE(rds.SetEntry(i, ranges[0].first));
-      auto val = **vals[i];
-      EXPECT_EQ(1, val);
+      EXPECT_EQ(i, ranges[i].first);
+      EXPECT_EQ(i + 1, ranges[i].second);
    }
+   EXPECT_TRUE(rds.SetEntry(1, ranges[1].first));
+   EXPECT_TRUE(rds.SetEntry(0, ranges[0].first));
+   EXPECT_EQ(1, **vals[0]);
+   EXPECT_EQ(2, **vals[1]);
+   EXPECT_EQ("1", **vtext[0]);
+   EXPECT_EQ("2", **vtext[1]);
+   EXPECT_EQ(0U, rds.GetEntryRanges().size());
 
    EXPECT_THROW(rds.GetColumnReaders<double>("fint"), std::runtime_error);
 }
@@ -202,7 +208,6 @@ TEST(RSqliteDS, IMT)
    const auto nSlots = 4U;
    ROOT::EnableImplicitMT(nSlots);
 
-   ROOT::TestSupport::CheckDiagsRAII diagRAII{kWarning, "SetNSlots", "Currently the SQlite data source faces performance degradation in multi-threaded mode. Consider turning off IMT."};
    auto rdf = MakeSqliteDataFrame(fileName0, query0);
    EXPECT_EQ(3, *rdf.Sum("fint"));
    EXPECT_NEAR(3.0, *rdf.Sum("freal"), epsilon);
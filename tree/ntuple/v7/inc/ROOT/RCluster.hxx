@@ -142,6 +142,30 @@ public:
    ~ROnDiskPageMapHeap();
 };
 
+class RCluster;
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::ROnDiskPageMapShared
+\ingroup NTuple
+\brief An ROnDiskPageMap that references the pages of another, immutable cluster
+
+Used to hand out clusters from the shared cluster cache. The page map keeps the referenced cluster alive.
+*/
+// clang-format on
+class ROnDiskPageMapShared : public ROnDiskPageMap {
+private:
+   /// The cluster owning the memory of the registered on-disk pages
+   std::shared_ptr<const RCluster> fCluster;
+public:
+   explicit ROnDiskPageMapShared(std::shared_ptr<const RCluster> cluster) : fCluster(std::move(cluster)) {}
+   ROnDiskPageMapShared(const ROnDiskPageMapShared &other) = delete;
+   ROnDiskPageMapShared(ROnDiskPageMapShared &&other) = default;
+   ROnDiskPageMapShared &operator =(const ROnDiskPageMapShared &other) = delete;
+   ROnDiskPageMapShared &operator =(ROnDiskPageMapShared &&other) = default;
+   ~ROnDiskPageMapShared();
+};
+
 // clang-format off
 /**
 \class ROOT::Experimental::Detail::RCluster
@@ -198,6 +222,9 @@ public:
    const ColumnSet_t &GetAvailColumns() const { return fAvailColumns; }
    bool ContainsColumn(DescriptorId_t columnId) const { return fAvailColumns.count(columnId) > 0; }
    size_t GetNOnDiskPages() const { return fOnDiskPages.size(); }
+   /// The sum of the compressed sizes of all the on-disk pages
+   std::size_t GetNBytesOnDisk() const;
+   const std::unordered_map<ROnDiskPage::Key, ROnDiskPage> &GetOnDiskPages() const { return fOnDiskPages; }
 };
 
 } // namespace Detail
@@ -0,0 +1,105 @@
+/// \file ROOT/RClusterCache.hxx
+/// \ingroup NTuple ROOT7
+/// \date 2023-06-12
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT7_RClusterCache
+#define ROOT7_RClusterCache
+
+#include <ROOT/RCluster.hxx>
+#include <ROOT/RNTupleUtil.hxx>
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace ROOT {
+namespace Experimental {
+namespace Detail {
+
+// clang-format off
+/**
+\class ROOT::Experimental::Detail::RClusterCache
+\ingroup NTuple
+\brief A process-wide, memory-bounded cache of clusters shared by all the page sources
+
+Cluster pools of different page sources that read the same ntuple consult the cache before they schedule I/O
+for a cluster. Clusters are identified by the storage identifier of the page source (e.g., the file URL and the
+ntuple name), the cluster id, and the set of columns. A cached cluster serves every request for a subset of
+its columns. The cache stores the packed and compressed pages; the cached clusters are immutable and handed out
+as views that keep the underlying memory alive. If the cache runs over its memory budget, the least recently
+used clusters are evicted.
+
+The cache assumes that the contents of a storage container does not change during the life time of the process.
+*/
+// clang-format on
+class RClusterCache {
+private:
+   struct REntry {
+      std::string fStorageId;
+      DescriptorId_t fClusterId = kInvalidDescriptorId;
+      std::shared_ptr<const RCluster> fCluster;
+      std::size_t fNBytes = 0;
+   };
+
+   /// Protects all the members below
+   mutable std::mutex fLock;
+   /// The cached clusters, the most recently used one first. The number of cached clusters is limited by the
+   /// memory budget and thus small enough for a linear search.
+   std::list<REntry> fEntries;
+   std::size_t fMaxBytes;
+   std::size_t fNBytes = 0;
+   std::uint64_t fNHits = 0;
+   std::uint64_t fNMisses = 0;
+
+   /// Creates a new cluster that references the pages of the given cached cluster
+   static std::unique_ptr<RCluster> MakeView(std::shared_ptr<const RCluster> cluster);
+   /// Removes least recently used clusters until the cache size is at most maxBytes. Expects fLock to be held.
+   void EvictUntil(std::size_t maxBytes);
+
+public:
+   static constexpr std::size_t kDefaultMaxBytes = 512 * 1024 * 1024;
+
+   explicit RClusterCache(std::size_t maxBytes = kDefaultMaxBytes) : fMaxBytes(maxBytes) {}
+   RClusterCache(const RClusterCache &other) = delete;
+   RClusterCache &operator =(const RClusterCache &other) = delete;
+   ~RClusterCache() = default;
+
+   /// The cache used by the cluster pools if RNTupleReadOptions::GetUseSharedClusterCache() is set
+   static RClusterCache &GetGlobal();
+
+   /// Returns a view on a cached cluster that contains at least the given columns or nullptr if there is
+   /// no such cluster in the cache. Marks the cluster as most recently used.
+   std::unique_ptr<RCluster>
+   Get(const std::string &storageId, DescriptorId_t clusterId, const RCluster::ColumnSet_t &columns);
+   /// Moves the given cluster into the cache and returns a view on it. Cached clusters with a subset of the columns
+   /// of the given cluster are replaced. Clusters larger than the memory budget are returned as is.
+   std::unique_ptr<RCluster> Put(const std::string &storageId, std::unique_ptr<RCluster> cluster);
+
+   /// Removes all the clusters from the cache. Views that were handed out remain valid.
+   void Clear();
+   void SetMaxBytes(std::size_t maxBytes);
+   std::size_t GetMaxBytes() const;
+   std::size_t GetNBytes() const;
+   std::size_t GetNClusters() const;
+   std::uint64_t GetNHits() const;
+   std::uint64_t GetNMisses() const;
+}; // class RClusterCache
+
+} // namespace Detail
+} // namespace Experimental
+} // namespace ROOT
+
+#endif
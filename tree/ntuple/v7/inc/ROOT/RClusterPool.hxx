@@ -26,12 +26,14 @@
 #include <queue>
 #include <thread>
 #include <set>
+#include <string>
 #include <vector>
 
 namespace ROOT {
 namespace Experimental {
 namespace Detail {
 
+class RClusterCache;
 class RPageSource;
 
 // clang-format off
@@ -50,6 +52,9 @@ the unzip thread is supposed to submit multi-threaded, CPU heavy work to the app
 The unzipping step of the pipeline therefore behaves differently depending on whether or not implicit multi-threadin
 is turned on. If it is turned off, i.e. in a single-threaded environment, the cluster pool will only read the
 compressed pages and the page source has to uncompresses pages at a later point when data from the page is requested.
+
+If the page source's read options enable the shared cluster cache, clusters found in the process-wide RClusterCache
+skip the I/O step and are directly handed over to the unzip thread; freshly loaded clusters are added to the cache.
 */
 // clang-format on
 class RClusterPool {
@@ -95,10 +100,18 @@ private:
    unsigned int fWindowPre = 0;
    /// The number of clusters that are being read in a single vector read.
    unsigned int fClusterBunchSize;
+   /// The number of cluster bunches that are requested ahead of time, including the one of the active cluster
+   unsigned int fClusterBunchesInFlight;
    /// Used as an ever-growing counter in GetCluster() to separate bunches of clusters from each other
    std::int64_t fBunchId = 0;
    /// The cache of clusters around the currently active cluster
    std::vector<std::unique_ptr<RCluster>> fPool;
+   /// The process-wide cluster cache, if enabled in the read options of the page source. Reset to nullptr if the
+   /// page source cannot be identified by a storage identifier.
+   RClusterCache *fSharedCache = nullptr;
+   /// The key of the page source in the shared cluster cache. Determined on the first call to GetCluster(), when
+   /// the page source is attached. Protected by fLockWorkQueue, just as fSharedCache.
+   std::string fStorageId;
 
    /// Protects the shared state between the main thread and the pipeline threads, namely the read and unzip
    /// work queues and the in-flight clusters vector
@@ -142,7 +155,9 @@ private:
 
 public:
    static constexpr unsigned int kDefaultClusterBunchSize = 1;
-   RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize);
+   static constexpr unsigned int kDefaultClusterBunchesInFlight = 2;
+   RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize,
+                unsigned int clusterBunchesInFlight = kDefaultClusterBunchesInFlight);
    explicit RClusterPool(RPageSource &pageSource) : RClusterPool(pageSource, kDefaultClusterBunchSize) {}
    RClusterPool(const RClusterPool &other) = delete;
    RClusterPool &operator =(const RClusterPool &other) = delete;
@@ -150,7 +165,7 @@ public:
 
    /// Returns the requested cluster either from the pool or, in case of a cache miss, lets the I/O thread load
    /// the cluster in the pool, blocks until done, and then returns it.  Triggers along the way the background loading
-   /// of the following fWindowPost number of clusters.  The returned cluster has at least all the pages of `columns`
+   /// of the clusters of the following fClusterBunchesInFlight - 1 bunches.  The returned cluster has at least all the pages of `columns`
    /// and possibly pages of other columns, too.  If implicit multi-threading is turned on, the uncompressed pages
    /// of the returned cluster are already pushed into the page pool associated with the page source upon return.
    /// The cluster remains valid until the next call to GetCluster().
@@ -112,6 +112,11 @@ public:
    ~RColumn();
 
    void Connect(DescriptorId_t fieldId, RPageStorage *pageStorage);
+   /// For writing, resizes the write pages such that the compressed pages approximate the target size given by
+   /// RNTupleWriteOptions::GetApproxZippedPageSize(), using the compression ratio of the column in the last committed
+   /// cluster.  Must only be called after Flush(), i.e. when both write pages are empty.  No-op if the write options
+   /// do not enable adaptive page sizes.
+   void AdaptPageSize();
 
    void Append(const RColumnElementBase &element) {
       void *dst = fWritePage[fWritePageIdx].GrowUnchecked(1);
@@ -245,6 +250,17 @@ public:
          (clusterIndex.GetIndex() - fReadPage.GetClusterRangeFirst()) * RColumnElement<CppT>::kSize);
    }
 
+   /// Like MapV() for columns whose C++ type is only known at run time. Only meaningful for mappable column elements.
+   void *MapRawV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems)
+   {
+      if (!fReadPage.Contains(clusterIndex)) {
+         MapPage(clusterIndex);
+      }
+      nItems = fReadPage.GetClusterRangeLast() - clusterIndex.GetIndex() + 1;
+      return static_cast<unsigned char *>(fReadPage.GetBuffer()) +
+             (clusterIndex.GetIndex() - fReadPage.GetClusterRangeFirst()) * fElement->GetSize();
+   }
+
    NTupleSize_t GetGlobalIndex(const RClusterIndex &clusterIndex) {
       if (!fReadPage.Contains(clusterIndex)) {
          MapPage(clusterIndex);
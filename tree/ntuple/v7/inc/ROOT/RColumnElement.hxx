@@ -23,8 +23,10 @@
 #include <Byteswap.h>
 #include <TError.h>
 
+#include <cmath>
 #include <cstring> // for memcpy
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -52,6 +54,144 @@ static void CopyElementsBswap(void *destination, const void *source, std::size_t
       dst[i] = RByteSwap<N>::bswap(src[i]);
    }
 }
+
+/// \brief Write `count` elements of size `N` as byte planes: first the least significant byte of all elements, then
+/// the second byte of all elements etc.
+///
+/// `getValue(i)` returns the i-th (possibly transformed) element as an unsigned integer of size `N`. The on-disk
+/// layout is little-endian on all architectures.  The loops are written such that the compiler can vectorize them.
+template <std::size_t N, typename GetValueT>
+static void CopySplitPack(void *destination, std::size_t count, GetValueT getValue)
+{
+   auto splitArray = reinterpret_cast<unsigned char *>(destination);
+   for (std::size_t b = 0; b < N; ++b) {
+      for (std::size_t i = 0; i < count; ++i) {
+         splitArray[b * count + i] = static_cast<unsigned char>(getValue(i) >> (8 * b));
+      }
+   }
+}
+
+/// \brief Reverse operation of CopySplitPack(): reassemble `count` elements of size `N` from their byte planes.
+template <std::size_t N>
+static void CopySplitUnpack(void *destination, const void *source, std::size_t count)
+{
+   using UIntT = typename RByteSwap<N>::value_type;
+   auto dst = reinterpret_cast<UIntT *>(destination);
+   auto splitArray = reinterpret_cast<const unsigned char *>(source);
+   for (std::size_t i = 0; i < count; ++i) {
+      dst[i] = splitArray[i];
+   }
+   for (std::size_t b = 1; b < N; ++b) {
+      for (std::size_t i = 0; i < count; ++i) {
+         dst[i] |= static_cast<UIntT>(splitArray[b * count + i]) << (8 * b);
+      }
+   }
+}
+
+/// \brief Map signed integers (given by their two's complement representation) to unsigned integers such that
+/// small absolute values result in small unsigned values: 0, -1, 1, -2, ... become 0, 1, 2, 3, ...
+template <typename UIntT>
+static UIntT EncodeZigzag(UIntT value)
+{
+   using SIntT = std::make_signed_t<UIntT>;
+   return (value << 1) ^ static_cast<UIntT>(static_cast<SIntT>(value) >> (8 * sizeof(UIntT) - 1));
+}
+
+template <typename UIntT>
+static UIntT DecodeZigzag(UIntT value)
+{
+   return (value >> 1) ^ (~(value & 1) + 1);
+}
+
+/// \brief Find the smallest and the largest of count in-memory values of type CppT.
+/// NaN values are ignored. Values that are not exactly representable as double are rounded outwards, so that the
+/// returned range always contains all the values. Returns false if there is no (non-NaN) value.
+template <typename CppT>
+static bool FindValueRange(const void *source, std::size_t count, double &min, double &max)
+{
+   auto values = reinterpret_cast<const CppT *>(source);
+   std::size_t i = 0;
+   if constexpr (std::is_floating_point<CppT>::value) {
+      // NaN values compare false with everything and thus only need to be skipped for the initial value
+      while ((i < count) && std::isnan(values[i]))
+         ++i;
+   }
+   if (i == count)
+      return false;
+
+   CppT lo = values[i];
+   CppT hi = values[i];
+   for (; i < count; ++i) {
+      lo = (values[i] < lo) ? values[i] : lo;
+      hi = (values[i] > hi) ? values[i] : hi;
+   }
+   min = static_cast<double>(lo);
+   max = static_cast<double>(hi);
+   if constexpr (std::numeric_limits<CppT>::digits > std::numeric_limits<double>::digits) {
+      min = std::nextafter(min, -std::numeric_limits<double>::infinity());
+      max = std::nextafter(max, std::numeric_limits<double>::infinity());
+   }
+   return true;
+}
+
+/// \brief Convert an IEEE-754 single precision float to the bit pattern of the nearest half precision float.
+///
+/// Rounds to nearest, ties to even. Values beyond the half precision range become +/- infinity, values below the
+/// smallest half precision subnormal become +/- zero. NaN remains NaN.
+static std::uint16_t FloatToHalf(float value)
+{
+   std::uint32_t f;
+   std::memcpy(&f, &value, sizeof(f));
+   const std::uint16_t sign = (f >> 16) & 0x8000;
+   f &= 0x7fffffff;
+
+   if (f >= 0x7f800000) // infinity or NaN; keep NaN a quiet NaN
+      return sign | 0x7c00 | ((f > 0x7f800000) ? 0x0200 : 0);
+   if (f >= 0x477ff000) // rounds to 65520 or beyond
+      return sign | 0x7c00;
+   if (f < 0x38800000) {
+      // Below the smallest normal half precision value (2^-14): result is a subnormal or zero
+      if (f < 0x33000000) // less than or equal to half the smallest subnormal (2^-25)
+         return sign;
+      const std::uint32_t exponent = f >> 23;
+      const std::uint32_t mantissa = (f & 0x7fffff) | 0x800000;
+      const std::uint32_t shift = 126 - exponent;
+      std::uint32_t result = mantissa >> shift;
+      const std::uint32_t remainder = mantissa & ((1u << shift) - 1);
+      const std::uint32_t halfway = 1u << (shift - 1);
+      if ((remainder > halfway) || ((remainder == halfway) && (result & 1)))
+         ++result; // a carry into the exponent correctly yields the smallest normal value
+      return sign | static_cast<std::uint16_t>(result);
+   }
+
+   // Normal range: rebias the exponent from 127 to 15 and round the mantissa from 23 to 10 bits
+   f -= 0x38000000;
+   f += 0x0fff + ((f >> 13) & 1);
+   return sign | static_cast<std::uint16_t>(f >> 13);
+}
+
+/// \brief Convert the bit pattern of an IEEE-754 half precision float to single precision. The conversion is exact.
+static float HalfToFloat(std::uint16_t half)
+{
+   const std::uint32_t sign = static_cast<std::uint32_t>(half & 0x8000) << 16;
+   const std::uint32_t exponent = (half >> 10) & 0x1f;
+   const std::uint32_t mantissa = half & 0x3ff;
+
+   std::uint32_t f;
+   if (exponent == 0x1f) {
+      f = sign | 0x7f800000 | (mantissa << 13);
+   } else if (exponent != 0) {
+      f = sign | ((exponent + 112) << 23) | (mantissa << 13);
+   } else {
+      // Zero or subnormal: the value is mantissa * 2^-24, which is exactly representable in single precision
+      const float magnitude = static_cast<float>(mantissa) * 5.9604644775390625e-8f;
+      std::memcpy(&f, &magnitude, sizeof(f));
+      f |= sign;
+   }
+   float value;
+   std::memcpy(&value, &f, sizeof(value));
+   return value;
+}
 } // anonymous namespace
 
 namespace ROOT {
@@ -127,6 +267,15 @@ public:
       std::memcpy(destination, source, count);
    }
 
+   /// For columns of arithmetic type, find the smallest and the largest of count in-memory elements (see
+   /// RClusterDescriptor::RValueRange).  Returns false if the column type has no value statistics or if there is
+   /// no value to compare.
+   virtual bool GetValueRange(const void * /* source */, std::size_t /* count */, double & /* min */,
+                              double & /* max */) const
+   {
+      return false;
+   }
+
    void *GetRawContent() const { return fRawContent; }
    std::size_t GetSize() const { return fSize; }
    std::size_t GetPackedSize(std::size_t nElements) const { return (nElements * GetBitsOnStorage() + 7) / 8; }
@@ -158,6 +307,95 @@ public:
       CopyElementsBswap<sizeof(CppT)>(dst, src, count);
 #endif
    }
+   bool GetValueRange(const void *src, std::size_t count, double &min, double &max) const override
+   {
+      return FindValueRange<CppT>(src, count, min, max);
+   }
+};
+
+/**
+ * Base class for columns with a byte-split on-storage representation, see EColumnType::kSplitReal32 etc.
+ * Byte splitting groups the bytes of equal significance of all elements of a page, which results in long runs
+ * of similar bytes for most physics data and thus in better compression.
+ */
+template <typename CppT>
+class RColumnElementSplitLE : public RColumnElementBase {
+protected:
+   using UIntT = typename RByteSwap<sizeof(CppT)>::value_type;
+
+public:
+   static constexpr bool kIsMappable = false;
+   RColumnElementSplitLE(void *rawContent, std::size_t size) : RColumnElementBase(rawContent, size) {}
+
+   void Pack(void *dst, void *src, std::size_t count) const override
+   {
+      auto srcArray = reinterpret_cast<const UIntT *>(src);
+      CopySplitPack<sizeof(CppT)>(dst, count, [srcArray](std::size_t i) { return srcArray[i]; });
+   }
+   void Unpack(void *dst, void *src, std::size_t count) const override
+   {
+      CopySplitUnpack<sizeof(CppT)>(dst, src, count);
+   }
+   bool GetValueRange(const void *src, std::size_t count, double &min, double &max) const override
+   {
+      return FindValueRange<CppT>(src, count, min, max);
+   }
+};
+
+/**
+ * Byte-split columns of signed integers; the values are zigzag encoded before splitting so that small negative
+ * numbers do not result in 0xff high bytes.
+ */
+template <typename CppT>
+class RColumnElementZigzagSplitLE : public RColumnElementSplitLE<CppT> {
+protected:
+   using typename RColumnElementSplitLE<CppT>::UIntT;
+
+public:
+   RColumnElementZigzagSplitLE(void *rawContent, std::size_t size) : RColumnElementSplitLE<CppT>(rawContent, size) {}
+
+   void Pack(void *dst, void *src, std::size_t count) const final
+   {
+      auto srcArray = reinterpret_cast<const UIntT *>(src);
+      CopySplitPack<sizeof(CppT)>(dst, count, [srcArray](std::size_t i) { return EncodeZigzag(srcArray[i]); });
+   }
+   void Unpack(void *dst, void *src, std::size_t count) const final
+   {
+      CopySplitUnpack<sizeof(CppT)>(dst, src, count);
+      auto dstArray = reinterpret_cast<UIntT *>(dst);
+      for (std::size_t i = 0; i < count; ++i)
+         dstArray[i] = DecodeZigzag(dstArray[i]);
+   }
+};
+
+/**
+ * Byte-split columns of sorted offsets; the values are delta encoded within the page before splitting. Since the
+ * delta encoding starts from zero on every page, pages can be unpacked independently.
+ */
+template <typename CppT>
+class RColumnElementDeltaSplitLE : public RColumnElementSplitLE<CppT> {
+protected:
+   using typename RColumnElementSplitLE<CppT>::UIntT;
+
+public:
+   RColumnElementDeltaSplitLE(void *rawContent, std::size_t size) : RColumnElementSplitLE<CppT>(rawContent, size) {}
+
+   void Pack(void *dst, void *src, std::size_t count) const final
+   {
+      auto srcArray = reinterpret_cast<const UIntT *>(src);
+      CopySplitPack<sizeof(CppT)>(dst, count, [srcArray](std::size_t i) -> UIntT {
+         return (i == 0) ? srcArray[0] : srcArray[i] - srcArray[i - 1];
+      });
+   }
+   void Unpack(void *dst, void *src, std::size_t count) const final
+   {
+      CopySplitUnpack<sizeof(CppT)>(dst, src, count);
+      auto dstArray = reinterpret_cast<UIntT *>(dst);
+      for (std::size_t i = 1; i < count; ++i)
+         dstArray[i] += dstArray[i - 1];
+   }
+   /// Offsets are no values of interest
+   bool GetValueRange(const void *, std::size_t, double &, double &) const final { return false; }
 };
 
 /**
@@ -301,6 +539,10 @@ public:
    explicit RColumnElement(std::int8_t *value) : RColumnElementBase(value, kSize) {}
    bool IsMappable() const final { return kIsMappable; }
    std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool GetValueRange(const void *src, std::size_t count, double &min, double &max) const final
+   {
+      return FindValueRange<std::int8_t>(src, count, min, max);
+   }
 };
 
 template <>
@@ -312,6 +554,10 @@ public:
    explicit RColumnElement(std::uint8_t *value) : RColumnElementBase(value, kSize) {}
    bool IsMappable() const final { return kIsMappable; }
    std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool GetValueRange(const void *src, std::size_t count, double &min, double &max) const final
+   {
+      return FindValueRange<std::uint8_t>(src, count, min, max);
+   }
 };
 
 template <>
@@ -404,6 +650,137 @@ public:
    explicit RColumnElement(ClusterSize_t *value) : RColumnElementLE(value, kSize) {}
    bool IsMappable() const final { return kIsMappable; }
    std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   /// Offsets are no values of interest
+   bool GetValueRange(const void *, std::size_t, double &, double &) const final { return false; }
+};
+
+template <>
+class RColumnElement<float, EColumnType::kSplitReal32> : public RColumnElementSplitLE<float> {
+public:
+   static constexpr std::size_t kSize = sizeof(float);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(float *value) : RColumnElementSplitLE(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+};
+
+template <>
+class RColumnElement<double, EColumnType::kSplitReal64> : public RColumnElementSplitLE<double> {
+public:
+   static constexpr std::size_t kSize = sizeof(double);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(double *value) : RColumnElementSplitLE(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+};
+
+/**
+ * Lossy storage of floats as IEEE-754 half precision values (1 sign bit, 5 exponent bits, 10 mantissa bits), which
+ * covers magnitudes between about 6e-8 and 65504 with 3 to 4 significant decimal digits.  Values are rounded to the
+ * nearest half precision value on packing.  The on-disk layout is little-endian on all architectures.
+ */
+template <>
+class RColumnElement<float, EColumnType::kReal16> : public RColumnElementBase {
+public:
+   static constexpr bool kIsMappable = false;
+   static constexpr std::size_t kSize = sizeof(float);
+   static constexpr std::size_t kBitsOnStorage = 16;
+   explicit RColumnElement(float *value) : RColumnElementBase(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+
+   void Pack(void *dst, void *src, std::size_t count) const final
+   {
+      auto floatArray = reinterpret_cast<const float *>(src);
+      auto byteArray = reinterpret_cast<unsigned char *>(dst);
+      for (std::size_t i = 0; i < count; ++i) {
+         const std::uint16_t half = FloatToHalf(floatArray[i]);
+         byteArray[2 * i] = static_cast<unsigned char>(half);
+         byteArray[2 * i + 1] = static_cast<unsigned char>(half >> 8);
+      }
+   }
+   void Unpack(void *dst, void *src, std::size_t count) const final
+   {
+      auto floatArray = reinterpret_cast<float *>(dst);
+      auto byteArray = reinterpret_cast<const unsigned char *>(src);
+      for (std::size_t i = 0; i < count; ++i) {
+         floatArray[i] = HalfToFloat(static_cast<std::uint16_t>(byteArray[2 * i] | (byteArray[2 * i + 1] << 8)));
+      }
+   }
+   bool GetValueRange(const void *src, std::size_t count, double &min, double &max) const final
+   {
+      return FindValueRange<float>(src, count, min, max);
+   }
+};
+
+template <>
+class RColumnElement<std::int16_t, EColumnType::kSplitInt16> : public RColumnElementZigzagSplitLE<std::int16_t> {
+public:
+   static constexpr std::size_t kSize = sizeof(std::int16_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::int16_t *value) : RColumnElementZigzagSplitLE(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+};
+
+template <>
+class RColumnElement<std::uint16_t, EColumnType::kSplitInt16> : public RColumnElementZigzagSplitLE<std::uint16_t> {
+public:
+   static constexpr std::size_t kSize = sizeof(std::uint16_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::uint16_t *value) : RColumnElementZigzagSplitLE(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+};
+
+template <>
+class RColumnElement<std::int32_t, EColumnType::kSplitInt32> : public RColumnElementZigzagSplitLE<std::int32_t> {
+public:
+   static constexpr std::size_t kSize = sizeof(std::int32_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::int32_t *value) : RColumnElementZigzagSplitLE(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+};
+
+template <>
+class RColumnElement<std::uint32_t, EColumnType::kSplitInt32> : public RColumnElementZigzagSplitLE<std::uint32_t> {
+public:
+   static constexpr std::size_t kSize = sizeof(std::uint32_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::uint32_t *value) : RColumnElementZigzagSplitLE(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+};
+
+template <>
+class RColumnElement<std::int64_t, EColumnType::kSplitInt64> : public RColumnElementZigzagSplitLE<std::int64_t> {
+public:
+   static constexpr std::size_t kSize = sizeof(std::int64_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::int64_t *value) : RColumnElementZigzagSplitLE(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+};
+
+template <>
+class RColumnElement<std::uint64_t, EColumnType::kSplitInt64> : public RColumnElementZigzagSplitLE<std::uint64_t> {
+public:
+   static constexpr std::size_t kSize = sizeof(std::uint64_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(std::uint64_t *value) : RColumnElementZigzagSplitLE(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+};
+
+template <>
+class RColumnElement<ClusterSize_t, EColumnType::kSplitIndex32> : public RColumnElementDeltaSplitLE<ClusterSize_t::ValueType> {
+public:
+   static constexpr std::size_t kSize = sizeof(ROOT::Experimental::ClusterSize_t);
+   static constexpr std::size_t kBitsOnStorage = kSize * 8;
+   explicit RColumnElement(ClusterSize_t *value) : RColumnElementDeltaSplitLE(value, kSize) {}
+   bool IsMappable() const final { return kIsMappable; }
+   std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
 };
 
 template <>
@@ -465,6 +842,10 @@ public:
    explicit RColumnElement(std::int64_t *value) : RColumnElementBase(value, kSize) {}
    bool IsMappable() const final { return kIsMappable; }
    std::size_t GetBitsOnStorage() const final { return kBitsOnStorage; }
+   bool GetValueRange(const void *src, std::size_t count, double &min, double &max) const final
+   {
+      return FindValueRange<std::int64_t>(src, count, min, max);
+   }
 
    void Pack(void *dst, void *src, std::size_t count) const final;
    void Unpack(void *dst, void *src, std::size_t count) const final;
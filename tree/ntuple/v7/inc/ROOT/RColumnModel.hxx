@@ -50,6 +50,15 @@ enum class EColumnType {
    kInt32,
    kInt16,
    kInt8,
+   // Byte-split (shuffled) variants of the above types: the on-disk page first stores the least significant bytes of
+   // all elements, then the next bytes and so on.  Integers are additionally zigzag encoded, index columns are delta
+   // encoded page by page.  These encodings do not change the column size but typically improve the compression ratio.
+   kSplitIndex32,
+   kSplitReal64,
+   kSplitReal32,
+   kSplitInt64,
+   kSplitInt32,
+   kSplitInt16,
    kMax,
 };
 
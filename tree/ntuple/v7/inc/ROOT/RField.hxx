@@ -37,6 +37,7 @@
 #include <string>
 #include <type_traits>
 #include <typeinfo>
+#include <unordered_map>
 #include <variant>
 #include <vector>
 #include <utility>
@@ -47,6 +48,7 @@ namespace ROOT {
 namespace Experimental {
 
 class RCollectionField;
+class RRVecField;
 class RCollectionNTupleWriter;
 class REntry;
 class RNTupleModel;
@@ -70,6 +72,7 @@ The field knows based on its type and the field name the type(s) and name(s) of
 // clang-format on
 class RFieldBase {
    friend class ROOT::Experimental::RCollectionField; // to move the fields from the collection model
+   friend class ROOT::Experimental::RRVecField;       // to map the items of the collection from the pages
 
 private:
    /// The field name relative to its parent field
@@ -100,6 +103,9 @@ protected:
    RColumn* fPrincipalColumn;
    /// The columns are connected either to a sink or to a source (not to both); they are owned by the field.
    std::vector<std::unique_ptr<RColumn>> fColumns;
+   /// Whether floating point, integer, and index columns use their byte-split on-disk representation.  Set from the
+   /// write options when connecting to a page sink and from the on-disk column types when connecting to a page source.
+   bool fUseSplitEncoding = false;
 
    /// Creates the backing columns corresponsing to the field type for writing
    virtual void GenerateColumnsImpl() = 0;
@@ -123,6 +129,26 @@ protected:
    /// is not of one of the requested types.
    ROOT::Experimental::EColumnType EnsureColumnType(const std::vector<EColumnType> &requestedTypes,
                                                     unsigned int columnIndex, const RNTupleDescriptor &desc);
+   /// Like EnsureColumnType() for columns that can be stored either as `plainType` or as `splitType`; sets
+   /// fUseSplitEncoding according to the on-disk type.
+   void EnsureSplittableColumnType(EColumnType plainType, EColumnType splitType, unsigned int columnIndex,
+                                   const RNTupleDescriptor &desc);
+   /// Fields whose append or read path depends on per-field settings (e.g., lossy float storage) need to switch off
+   /// the direct column access of simple fields
+   void SetIsSimple(bool isSimple) { fIsSimple = isSimple; }
+
+   /// Appends a column of type `PlainT`, or of its byte-split counterpart `SplitT` if fUseSplitEncoding is set
+   template <typename CppT, EColumnType PlainT, EColumnType SplitT>
+   void GenerateSplittableColumn(std::uint32_t index, bool isSorted)
+   {
+      if (fUseSplitEncoding) {
+         fColumns.emplace_back(
+            std::unique_ptr<RColumn>(RColumn::Create<CppT, SplitT>(RColumnModel(SplitT, isSorted), index)));
+      } else {
+         fColumns.emplace_back(
+            std::unique_ptr<RColumn>(RColumn::Create<CppT, PlainT>(RColumnModel(PlainT, isSorted), index)));
+      }
+   }
 
 public:
    /// Iterates over the sub tree of fields in depth-first search order
@@ -225,6 +251,9 @@ public:
 
    /// Ensure that all received items are written from page buffers to the storage.
    void Flush() const;
+   /// After the cluster has been committed, lets the columns adapt their page size to their compression ratio
+   /// (see RNTupleWriteOptions::SetApproxZippedPageSize())
+   void AdaptPageSizes() const;
    /// Perform housekeeping tasks for global to cluster-local index translation
    virtual void CommitCluster() {}
 
@@ -461,6 +490,11 @@ public:
    {
       fPrincipalColumn->GetCollectionInfo(clusterIndex, collectionStart, size);
    }
+   /// Let the RVec value adopt the items of the collection at globalIndex where they are in the page buffer, instead
+   /// of copying them. This works if the item field is simple, its column has the same layout on disk and in memory,
+   /// and all the items are in the same page; otherwise false is returned and the value is left unchanged.
+   /// The adopted memory is valid until the next read from this field, which may map another page.
+   bool ReadMapped(NTupleSize_t globalIndex, Detail::RFieldValue *value);
 };
 
 /// The generic field for fixed size arrays, which do not need an offset column
@@ -743,12 +777,21 @@ public:
 
 template <>
 class RField<float> : public Detail::RFieldBase {
+private:
+   /// Number of explicitly stored mantissa bits; values are rounded to this precision before they are written
+   std::uint8_t fMantissaBits = kMaxMantissaBits;
+   /// Whether the values are stored as IEEE-754 half precision floats (EColumnType::kReal16)
+   bool fUseHalfPrecision = false;
+
 protected:
-   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
-      return std::make_unique<RField>(newName);
-   }
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final;
+   std::size_t AppendImpl(const Detail::RFieldValue &value) final;
+   void ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value) final;
 
 public:
+   /// The number of mantissa bits of the IEEE-754 single precision format, excluding the implicit leading bit
+   static constexpr std::uint8_t kMaxMantissaBits = 23;
+
    static std::string TypeName() { return "float"; }
    explicit RField(std::string_view name)
      : Detail::RFieldBase(name, TypeName(), ENTupleStructure::kLeaf, true /* isSimple */) {}
@@ -787,17 +830,35 @@ public:
    }
    size_t GetValueSize() const final { return sizeof(float); }
    void AcceptVisitor(Detail::RFieldVisitor &visitor) const final;
+
+   /// Values are rounded to `nBits` explicitly stored mantissa bits (0 to 23) before they are written to a Real32
+   /// column, similar to TTree's Float16_t.  The zeroed low mantissa bits compress well; readers are unaffected.
+   /// Must be called before the field is connected to a page sink.
+   void SetMantissaBits(std::uint8_t nBits);
+   std::uint8_t GetMantissaBits() const { return fMantissaBits; }
+   /// Stores the values as half precision floats, i.e. with 10 mantissa bits and 5 exponent bits in 2 bytes.
+   /// Takes precedence over the split encoding.  Must be called before the field is connected to a page sink;
+   /// when reading, the setting reflects the on-disk column type.
+   void SetHalfPrecision(bool val) { fUseHalfPrecision = val; }
+   bool GetHalfPrecision() const { return fUseHalfPrecision; }
 };
 
 
 template <>
 class RField<double> : public Detail::RFieldBase {
+private:
+   /// Number of explicitly stored mantissa bits; values are rounded to this precision before they are written
+   std::uint8_t fMantissaBits = kMaxMantissaBits;
+
 protected:
-   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
-      return std::make_unique<RField>(newName);
-   }
+   std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final;
+   std::size_t AppendImpl(const Detail::RFieldValue &value) final;
+   void ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value) final;
 
 public:
+   /// The number of mantissa bits of the IEEE-754 double precision format, excluding the implicit leading bit
+   static constexpr std::uint8_t kMaxMantissaBits = 52;
+
    static std::string TypeName() { return "double"; }
    explicit RField(std::string_view name)
      : Detail::RFieldBase(name, TypeName(), ENTupleStructure::kLeaf, true /* isSimple */) {}
@@ -836,6 +897,12 @@ public:
    }
    size_t GetValueSize() const final { return sizeof(double); }
    void AcceptVisitor(Detail::RFieldVisitor &visitor) const final;
+
+   /// Values are rounded to `nBits` explicitly stored mantissa bits (0 to 52) before they are written, similar to
+   /// TTree's Double32_t.  The zeroed low mantissa bits compress well; readers are unaffected.
+   /// Must be called before the field is connected to a page sink.
+   void SetMantissaBits(std::uint8_t nBits);
+   std::uint8_t GetMantissaBits() const { return fMantissaBits; }
 };
 
 template <>
@@ -1270,14 +1337,25 @@ public:
    void AcceptVisitor(Detail::RFieldVisitor &visitor) const final;
 };
 
+/// Strings are stored as an index column and a character column.  Alternatively, for strings with few distinct
+/// values, the field may use a dictionary encoding with a per-cluster dictionary: column #0 then stores for every
+/// entry a cluster-local integer code, i.e. the position of the string in the dictionary of the cluster, and
+/// columns #1 and #2 store the dictionary as an index and a character column.
 template <>
 class RField<std::string> : public Detail::RFieldBase {
 private:
    ClusterSize_t fIndex;
    Detail::RColumnElement<ClusterSize_t, EColumnType::kIndex> fElemIndex;
+   /// Whether the field uses the dictionary encoding; set by the user for writing and from the on-disk
+   /// column types for reading
+   bool fUseDictionaryEncoding = false;
+   /// The dictionary of the currently written cluster, maps strings to their codes
+   std::unordered_map<std::string, std::int32_t> fDictionary;
 
    std::unique_ptr<Detail::RFieldBase> CloneImpl(std::string_view newName) const final {
-      return std::make_unique<RField>(newName);
+      auto clone = std::make_unique<RField>(newName);
+      clone->fUseDictionaryEncoding = fUseDictionaryEncoding;
+      return clone;
    }
    std::size_t AppendImpl(const ROOT::Experimental::Detail::RFieldValue& value) final;
    void ReadGlobalImpl(ROOT::Experimental::NTupleSize_t globalIndex,
@@ -1315,6 +1393,21 @@ public:
    size_t GetAlignment() const final { return std::alignment_of<std::string>(); }
    void CommitCluster() final;
    void AcceptVisitor(Detail::RFieldVisitor &visitor) const final;
+
+   /// Selects the dictionary encoding for writing.  Must be called before the field is connected to a page sink.
+   void SetUseDictionaryEncoding(bool val) { fUseDictionaryEncoding = val; }
+   bool GetUseDictionaryEncoding() const { return fUseDictionaryEncoding; }
+   /// For dictionary encoded fields, returns the code of the string at the given index.  Codes are only comparable
+   /// within the same cluster.
+   std::int32_t GetDictionaryCode(const RClusterIndex &clusterIndex) const;
+   std::int32_t GetDictionaryCode(NTupleSize_t globalIndex) const
+   {
+      return GetDictionaryCode(fPrincipalColumn->GetClusterIndex(globalIndex));
+   }
+   /// For dictionary encoded fields, returns the code of `value` in the dictionary of the given cluster or -1 if
+   /// the cluster does not contain the value.  Together with GetDictionaryCode(), filters can compare codes instead
+   /// of materializing strings.
+   std::int32_t FindDictionaryCode(DescriptorId_t clusterId, std::string_view value) const;
 };
 
 
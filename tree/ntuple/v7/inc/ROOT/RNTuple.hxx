@@ -32,8 +32,10 @@
 
 #include <iterator>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 class TFile;
 
@@ -60,6 +62,8 @@ enum class ENTupleInfo {
    kSummary,  // The ntuple name, description, number of entries
    kStorageDetails, // size on storage, page sizes, compression factor, etc.
    kMetrics, // internals performance counters, requires that EnableMetrics() was called
+   kMetricsJSON, // like kMetrics plus per-column and per-cluster I/O statistics in JSON format
+   kMetricsPrometheus, // like kMetricsJSON but in the Prometheus text exposition format
 };
 
 /**
@@ -128,9 +132,21 @@ private:
    std::unique_ptr<RNTupleDescriptor> fCachedDescriptor;
    Detail::RNTupleMetrics fMetrics;
 
+   /// Per-column or per-cluster I/O statistics, as printed by PrintInfo()
+   struct RIOStatsEntry {
+      DescriptorId_t fId;
+      /// For columns, the qualified name of the field the column belongs to
+      std::string fFieldName;
+      Detail::RPageSource::RIOStats fStats;
+   };
+
    void ConnectModel(const RNTupleModel &model);
    RNTupleReader *GetDisplayReader();
    void InitPageSource();
+   /// Returns the I/O statistics of the page source per column or per cluster, sorted by id
+   std::vector<RIOStatsEntry> GetIOStats(bool perColumn);
+   void PrintMetricsJSON(std::ostream &output);
+   void PrintMetricsPrometheus(std::ostream &output);
 
 public:
    // Browse through the entries
@@ -349,25 +365,33 @@ public:
    /// }
    /// ntuple->PrintInfo(ENTupleInfo::kMetrics);
    /// ~~~
+   ///
+   /// ENTupleInfo::kMetricsJSON and ENTupleInfo::kMetricsPrometheus provide the same counters in a machine-readable
+   /// form, together with the bytes read, the bytes unzipped, and the decompression time per column and per cluster.
+   /// The output can be served, e.g., by a THttpServer command or a scrape endpoint of a monitoring system.
    void EnableMetrics() { fMetrics.Enable(); }
    const Detail::RNTupleMetrics &GetMetrics() const { return fMetrics; }
 };
 
 // clang-format off
 /**
-\class ROOT::Experimental::RNTupleWriter
+\class ROOT::Experimental::RNTupleFillContext
 \ingroup NTuple
-\brief An RNTuple that gets filled with entries (data) and writes them to storage
+\brief A context for filling entries (data) into clusters of an RNTuple
 
-An output ntuple can be filled with entries. The caller has to make sure that the data that gets filled into an ntuple
-is not modified for the time of the Fill() call. The fill call serializes the C++ object into the column format and
-writes data into the corresponding column page buffers.  Writing of the buffers to storage is deferred and can be
-triggered by Flush() or by destructing the ntuple.  On I/O errors, an exception is thrown.
+A fill context owns a frozen model and a page sink. It serializes the filled entries into the column page buffers and
+commits a cluster to the page sink whenever the cluster reaches its target size. The RNTupleWriter uses a single fill
+context; the RNTupleParallelWriter hands out one fill context per thread. A fill context itself is not thread-safe,
+i.e. a given fill context must only be used by one thread at a time.
+On destruction, the not yet committed entries are committed as a final cluster.
 */
 // clang-format on
-class RNTupleWriter {
+class RNTupleFillContext {
+   friend class RNTupleWriter;
+   friend class RNTupleParallelWriter;
+
 private:
-   /// The page sink's parallel page compression scheduler if IMT is on.
+   /// The page sink's page compression scheduler, if any.
    /// Needs to be destructed after the page sink is destructed and so declared before.
    std::unique_ptr<Detail::RPageStorage::RTaskScheduler> fZipTasks;
    std::unique_ptr<Detail::RPageSink> fSink;
@@ -375,7 +399,6 @@ private:
    std::unique_ptr<RNTupleModel> fModel;
    Detail::RNTupleMetrics fMetrics;
    NTupleSize_t fLastCommitted = 0;
-   NTupleSize_t fLastCommittedClusterGroup = 0;
    NTupleSize_t fNEntries = 0;
    /// Keeps track of the number of bytes written into the current cluster
    std::size_t fUnzippedClusterSize = 0;
@@ -389,6 +412,63 @@ private:
    /// Estimator of uncompressed cluster size, taking into account the estimated compression ratio
    NTupleSize_t fUnzippedClusterSizeEst;
 
+   /// Throws an exception if the model or the sink is null.  If given, zipTasks is set as the sink's task scheduler.
+   RNTupleFillContext(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSink> sink,
+                      std::unique_ptr<Detail::RPageStorage::RTaskScheduler> zipTasks);
+
+public:
+   RNTupleFillContext(const RNTupleFillContext &) = delete;
+   RNTupleFillContext &operator=(const RNTupleFillContext &) = delete;
+   ~RNTupleFillContext();
+
+   /// The simplest user interface if the default entry that comes with the model is used
+   void Fill() { Fill(*fModel->GetDefaultEntry()); }
+   /// Multiple entries can have been instantiated from the model.  This method will perform
+   /// a light check whether the entry comes from the context's own model
+   void Fill(REntry &entry)
+   {
+      if (R__unlikely(entry.GetModelId() != fModel->GetModelId()))
+         throw RException(R__FAIL("mismatch between entry and model"));
+
+      for (auto &value : entry) {
+         fUnzippedClusterSize += value.GetField()->Append(value);
+      }
+      fNEntries++;
+      if ((fUnzippedClusterSize >= fMaxUnzippedClusterSize) || (fUnzippedClusterSize >= fUnzippedClusterSizeEst))
+         CommitCluster();
+   }
+   /// Ensure that the data from the so far seen Fill calls has been written to storage
+   void CommitCluster();
+
+   std::unique_ptr<REntry> CreateEntry() { return fModel->CreateEntry(); }
+
+   /// Return the number of entries filled into this context so far
+   NTupleSize_t GetNEntries() const { return fNEntries; }
+
+   void EnableMetrics() { fMetrics.Enable(); }
+   const Detail::RNTupleMetrics &GetMetrics() const { return fMetrics; }
+
+   const RNTupleModel *GetModel() const { return fModel.get(); }
+};
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleWriter
+\ingroup NTuple
+\brief An RNTuple that gets filled with entries (data) and writes them to storage
+
+An output ntuple can be filled with entries. The caller has to make sure that the data that gets filled into an ntuple
+is not modified for the time of the Fill() call. The fill call serializes the C++ object into the column format and
+writes data into the corresponding column page buffers.  Writing of the buffers to storage is deferred and can be
+triggered by Flush() or by destructing the ntuple.  On I/O errors, an exception is thrown.
+*/
+// clang-format on
+class RNTupleWriter {
+private:
+   RNTupleFillContext fFillContext;
+   Detail::RNTupleMetrics fMetrics;
+   NTupleSize_t fLastCommittedClusterGroup = 0;
+
    // Helper function that is called from CommitCluster() when necessary
    void CommitClusterGroup();
 
@@ -410,24 +490,80 @@ public:
    ~RNTupleWriter();
 
    /// The simplest user interface if the default entry that comes with the ntuple model is used
-   void Fill() { Fill(*fModel->GetDefaultEntry()); }
+   void Fill() { fFillContext.Fill(); }
    /// Multiple entries can have been instantiated from the ntuple model.  This method will perform
    /// a light check whether the entry comes from the ntuple's own model
-   void Fill(REntry &entry) {
-      if (R__unlikely(entry.GetModelId() != fModel->GetModelId()))
-         throw RException(R__FAIL("mismatch between entry and model"));
-
-      for (auto& value : entry) {
-         fUnzippedClusterSize += value.GetField()->Append(value);
-      }
-      fNEntries++;
-      if ((fUnzippedClusterSize >= fMaxUnzippedClusterSize) || (fUnzippedClusterSize >= fUnzippedClusterSizeEst))
-         CommitCluster();
-   }
+   void Fill(REntry &entry) { fFillContext.Fill(entry); }
    /// Ensure that the data from the so far seen Fill calls has been written to storage
    void CommitCluster(bool commitClusterGroup = false);
 
-   std::unique_ptr<REntry> CreateEntry() { return fModel->CreateEntry(); }
+   std::unique_ptr<REntry> CreateEntry() { return fFillContext.CreateEntry(); }
+
+   void EnableMetrics() { fMetrics.Enable(); }
+   const Detail::RNTupleMetrics &GetMetrics() const { return fMetrics; }
+
+   const RNTupleModel *GetModel() const { return fFillContext.GetModel(); }
+};
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleParallelWriter
+\ingroup NTuple
+\brief An RNTuple that is filled concurrently by several threads
+
+The parallel writer hands out fill contexts, typically one per thread. Every fill context serializes its entries
+into its own clusters; full clusters are committed to the single page sink of the parallel writer under a lock.
+Page compression happens in the filling thread (or in the IMT thread pool if IMT is on) before the lock is taken,
+so that the lock only serializes the actual write of the cluster.  The order of the clusters on storage, and
+thus the order of the entries, depends on the order in which the fill contexts commit their clusters.
+
+~~~ {.cpp}
+auto writer = RNTupleParallelWriter::Recreate(std::move(model), "myNTuple", "some/file.root");
+// In every thread:
+auto fillContext = writer->CreateFillContext();
+auto entry = fillContext->CreateEntry();
+entry->Get<float>("pt") = 42.0;
+fillContext->Fill(*entry);
+~~~
+
+The model passed to the parallel writer must not be frozen; every fill context fills a frozen clone of it, such that
+entries created from one fill context cannot be filled into another one.  All fill contexts must be destructed before
+the parallel writer.  If a fill context is still alive when the parallel writer is destructed, its remaining entries
+are committed but the fill context must not be used afterwards.
+*/
+// clang-format on
+class RNTupleParallelWriter {
+private:
+   /// Serializes the cluster commits of the fill contexts to fSink and protects fFillContexts
+   std::mutex fMutex;
+   std::unique_ptr<Detail::RPageSink> fSink;
+   /// The (unfrozen) model that is cloned into the fill contexts. Needs to be destructed before fSink
+   std::unique_ptr<RNTupleModel> fModel;
+   Detail::RNTupleMetrics fMetrics;
+   /// The number of entries committed to fSink so far, across all fill contexts. Protected by fMutex.
+   NTupleSize_t fNEntries = 0;
+   /// The fill contexts handed out so far; only used to commit the left-overs of contexts that are alive
+   /// when the parallel writer is destructed.
+   std::vector<std::weak_ptr<RNTupleFillContext>> fFillContexts;
+
+public:
+   /// Throws an exception if the model is null or frozen.
+   static std::unique_ptr<RNTupleParallelWriter>
+   Recreate(std::unique_ptr<RNTupleModel> model, std::string_view ntupleName, std::string_view storage,
+            const RNTupleWriteOptions &options = RNTupleWriteOptions());
+   /// Throws an exception if the model is null or frozen.
+   static std::unique_ptr<RNTupleParallelWriter> Append(std::unique_ptr<RNTupleModel> model,
+                                                        std::string_view ntupleName, TFile &file,
+                                                        const RNTupleWriteOptions &options = RNTupleWriteOptions());
+   /// Throws an exception if the model or the sink is null or if the model is frozen.  The fill contexts buffer
+   /// their clusters themselves, so the sink should not be a buffered sink.
+   RNTupleParallelWriter(std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSink> sink);
+   RNTupleParallelWriter(const RNTupleParallelWriter &) = delete;
+   RNTupleParallelWriter &operator=(const RNTupleParallelWriter &) = delete;
+   ~RNTupleParallelWriter();
+
+   /// Create a new fill context that writes into this ntuple. Thread-safe.
+   std::shared_ptr<RNTupleFillContext> CreateFillContext();
 
    void EnableMetrics() { fMetrics.Enable(); }
    const Detail::RNTupleMetrics &GetMetrics() const { return fMetrics; }
@@ -29,6 +29,7 @@
 #include <iterator>
 #include <map>
 #include <memory>
+#include <optional>
 #include <ostream>
 #include <vector>
 #include <string>
@@ -194,6 +195,24 @@ class RClusterDescriptor {
    friend class RClusterDescriptorBuilder;
 
 public:
+   /// The smallest and the largest value of the elements of a particular column in a particular cluster.
+   /// Only available for columns of arithmetic type and only if the ntuple was written with column statistics
+   /// (see RNTupleWriteOptions::SetUseColumnStatistics()).  The range is conservative: 64bit integers that are not
+   /// exactly representable as double are rounded outwards; NaN values are ignored.
+   struct RValueRange {
+      double fMin = 0.0;
+      double fMax = 0.0;
+
+      bool operator==(const RValueRange &other) const { return fMin == other.fMin && fMax == other.fMax; }
+      /// Returns false if no value in the range can be in [min, max]
+      bool Overlaps(double min, double max) const { return fMin <= max && fMax >= min; }
+      void Merge(const RValueRange &other)
+      {
+         fMin = std::min(fMin, other.fMin);
+         fMax = std::max(fMax, other.fMax);
+      }
+   };
+
    /// The window of element indexes of a particular column in a particular cluster
    struct RColumnRange {
       DescriptorId_t fColumnId = kInvalidDescriptorId;
@@ -204,13 +223,13 @@ public:
       /// The usual format for ROOT compression settings (see Compression.h).
       /// The pages of a particular column in a particular cluster are all compressed with the same settings.
       std::int64_t fCompressionSettings = 0;
-
-      // TODO(jblomer): we perhaps want to store summary information, such as average, min/max, etc.
-      // Should this be done on the field level?
+      /// Optional value statistics of the column elements in the cluster
+      std::optional<RValueRange> fValueRange;
 
       bool operator==(const RColumnRange &other) const {
          return fColumnId == other.fColumnId && fFirstElementIndex == other.fFirstElementIndex &&
-                fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings;
+                fNElements == other.fNElements && fCompressionSettings == other.fCompressionSettings &&
+                fValueRange == other.fValueRange;
       }
 
       bool Contains(NTupleSize_t index) const {
@@ -706,6 +725,10 @@ public:
    DescriptorId_t FindClusterId(DescriptorId_t columnId, NTupleSize_t index) const;
    DescriptorId_t FindNextClusterId(DescriptorId_t clusterId) const;
    DescriptorId_t FindPrevClusterId(DescriptorId_t clusterId) const;
+   /// Returns the IDs, ordered by entry number, of the clusters that may contain entries where the value of the
+   /// given field is in [min, max].  Clusters are excluded only if the value statistics of the field's principal
+   /// column prove that they do not contain such a value; clusters without statistics are always returned.
+   std::vector<DescriptorId_t> FindClustersInValueRange(DescriptorId_t fieldId, double min, double max) const;
 
    /// Walks up the parents of the field ID and returns a field name of the form a.b.c.d
    /// In case of invalid field ID, an empty string is returned.
@@ -864,6 +887,8 @@ public:
 
    RResult<void> CommitColumnRange(DescriptorId_t columnId, std::uint64_t firstElementIndex,
                                    std::uint32_t compressionSettings, const RClusterDescriptor::RPageRange &pageRange);
+   /// Attach value statistics to an already committed column range
+   RResult<void> SetColumnValueRange(DescriptorId_t columnId, const RClusterDescriptor::RValueRange &valueRange);
 
    /// Move out the full cluster descriptor including page locations
    RResult<RClusterDescriptor> MoveDescriptor();
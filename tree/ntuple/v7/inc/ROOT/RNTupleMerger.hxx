@@ -19,6 +19,10 @@
 #include <ROOT/RError.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RSpan.hxx>
+
+#include <cstdint>
+#include <memory>
 
 namespace ROOT {
 namespace Experimental {
@@ -38,6 +42,73 @@ public:
    static RResult<RFieldMerger> Merge(const RFieldDescriptor &lhs, const RFieldDescriptor &rhs);
 };
 
+namespace Detail {
+class RPageSink;
+class RPageSource;
+} // namespace Detail
+
+class RNTupleModel;
+
+// clang-format off
+/**
+\class ROOT::Experimental::RNTupleMerger
+\ingroup NTuple
+\brief Concatenates a set of ntuples with the same schema into a page sink
+
+The merger copies the sealed pages of the sources cluster by cluster into the destination and only rewrites the
+meta-data (descriptors and page lists).  Pages of columns whose compression settings match the destination's write
+options are copied byte-for-byte.  Otherwise, the pages are decompressed and recompressed; they are never unpacked.
+All sources need to have the same fields with the same column types as the first source; the destination gets its
+schema from the first source.  Every source becomes one cluster group in the destination.
+
+Sources can also be merged incrementally, as soon as they are available: for online data taking, the writers can
+close a file every few minutes and the merger appends it to the growing destination with Append(), such that only
+Finalize() remains to be done at the end of the run.  Readers see the destination once it is finalized.
+*/
+// clang-format on
+class RNTupleMerger {
+public:
+   /// Statistics of a merge run
+   struct RMergeInfo {
+      std::uint64_t fNEntries = 0;
+      std::uint64_t fNClusters = 0;
+      /// Number of pages copied verbatim
+      std::uint64_t fNPagesCopied = 0;
+      /// Number of pages that needed to be recompressed
+      std::uint64_t fNPagesRecompressed = 0;
+   };
+
+private:
+   /// The destination of the incremental merge, set by the first call to Append()
+   Detail::RPageSink *fDestination = nullptr;
+   /// The model needs to stay alive until the destination is finalized because the sink's column handles
+   /// refer to the model's columns
+   std::unique_ptr<RNTupleModel> fModel;
+   RMergeInfo fMergeInfo;
+
+public:
+   RNTupleMerger();
+   RNTupleMerger(const RNTupleMerger &other) = delete;
+   RNTupleMerger &operator=(const RNTupleMerger &other) = delete;
+   ~RNTupleMerger();
+
+   /// Merge the sources, in the given order, into the destination, which must not have been created yet.  The
+   /// sources get attached if necessary.  Throws an RException if the sources are incompatible.
+   /// Finalizes the destination by committing the data set.
+   RMergeInfo Merge(std::span<Detail::RPageSource *> sources, Detail::RPageSink &destination);
+
+   /// Append the clusters of the source to the destination as a new cluster group.  The first call creates the
+   /// destination, which must not have been created yet, with the schema of the source; all calls must use the same
+   /// destination.  The source gets attached if necessary and can be closed once Append() returns.  Throws an
+   /// RException if the source is incompatible.
+   void Append(Detail::RPageSource &source, Detail::RPageSink &destination);
+   /// Commit the data set of the destination of the previous Append() calls and return the statistics of the merge.
+   /// Afterwards, the merger can be used for another destination.
+   RMergeInfo Finalize();
+   /// The statistics of the sources appended so far
+   const RMergeInfo &GetMergeInfo() const { return fMergeInfo; }
+};
+
 } // namespace Experimental
 } // namespace ROOT
 
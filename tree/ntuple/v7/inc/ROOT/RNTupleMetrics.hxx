@@ -293,6 +293,9 @@ private:
    bool fIsEnabled = false;
 
    bool Contains(const std::string &name) const;
+   /// Appends this object's counters and the counters of the observed sub metrics with their qualified names
+   void CollectCounters(const std::string &prefix,
+                        std::vector<std::pair<std::string, const RNTuplePerfCounter *>> &counters) const;
 
 public:
    explicit RNTupleMetrics(const std::string &name) : fName(name) {}
@@ -322,6 +325,12 @@ public:
    void ObserveMetrics(RNTupleMetrics &observee);
 
    void Print(std::ostream &output, const std::string &prefix = "") const;
+   /// Writes the counters of this object and of all observed sub metrics as a JSON array of objects with the
+   /// members "name", "unit", "description", and "value".  Values that are not a finite number are written as null.
+   void PrintJSON(std::ostream &output) const;
+   /// Writes the counters in the Prometheus text exposition format, one gauge per counter.  The metric name is the
+   /// fully qualified counter name with '.' replaced by '_', prepended by `prefix`.
+   void PrintPrometheus(std::ostream &output, const std::string &prefix = "") const;
    void Enable();
    bool IsEnabled() const { return fIsEnabled; }
 };
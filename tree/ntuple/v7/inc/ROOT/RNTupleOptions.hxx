@@ -19,6 +19,7 @@
 #include <Compression.h>
 #include <ROOT/RNTupleUtil.hxx>
 
+#include <cstdint>
 #include <memory>
 
 namespace ROOT {
@@ -59,7 +60,24 @@ class RNTupleWriteOptions {
    /// fApproxUnzippedPageSize in size and tail pages (the last page in a cluster) is between
    /// fApproxUnzippedPageSize/2 and fApproxUnzippedPageSize * 1.5 in size.
    std::size_t fApproxUnzippedPageSize = 64 * 1024;
+   /// If set, the page size is adapted per column after every cluster such that the compressed pages approximate this
+   /// size, based on the compression ratio observed for the column in the previous cluster.  Zero means that all
+   /// columns use fApproxUnzippedPageSize.
+   std::size_t fApproxZippedPageSize = 0;
+   /// Upper limit for the uncompressed page size if the page size is adapted (see fApproxZippedPageSize).  Bounds the
+   /// memory of the write buffers of well-compressible columns.
+   std::size_t fMaxUnzippedPageSize = 1024 * 1024;
    bool fUseBufferedWrite = true;
+   /// With buffered writing and implicit multi-threading, pages are sealed and compressed by concurrent tasks as soon
+   /// as they are committed. This limits the number of uncompressed bytes of pages handed over to such tasks and not
+   /// yet sealed; when the limit is exceeded, the writing thread waits for the outstanding tasks.  Zero means no limit.
+   std::size_t fMaxUnsealedPageBytes = 128 * 1024 * 1024;
+   /// Store floating point, integer, and index columns in byte-split encoding (see EColumnType::kSplitReal32 etc.),
+   /// which usually improves the compression ratio at a small cost in packing and unpacking time.
+   bool fUseSplitEncoding = false;
+   /// Compute and store the smallest and the largest value of every column of arithmetic type in every cluster.
+   /// Readers can use these statistics to skip clusters (see RNTupleDescriptor::FindClustersInValueRange()).
+   bool fUseColumnStatistics = false;
 
 public:
    virtual ~RNTupleWriteOptions() = default;
@@ -83,8 +101,23 @@ public:
    std::size_t GetApproxUnzippedPageSize() const { return fApproxUnzippedPageSize; }
    void SetApproxUnzippedPageSize(std::size_t val);
 
+   std::size_t GetApproxZippedPageSize() const { return fApproxZippedPageSize; }
+   void SetApproxZippedPageSize(std::size_t val) { fApproxZippedPageSize = val; }
+
+   std::size_t GetMaxUnzippedPageSize() const { return fMaxUnzippedPageSize; }
+   void SetMaxUnzippedPageSize(std::size_t val);
+
    bool GetUseBufferedWrite() const { return fUseBufferedWrite; }
    void SetUseBufferedWrite(bool val) { fUseBufferedWrite = val; }
+
+   std::size_t GetMaxUnsealedPageBytes() const { return fMaxUnsealedPageBytes; }
+   void SetMaxUnsealedPageBytes(std::size_t val) { fMaxUnsealedPageBytes = val; }
+
+   bool GetUseSplitEncoding() const { return fUseSplitEncoding; }
+   void SetUseSplitEncoding(bool val) { fUseSplitEncoding = val; }
+
+   bool GetUseColumnStatistics() const { return fUseColumnStatistics; }
+   void SetUseColumnStatistics(bool val) { fUseColumnStatistics = val; }
 };
 
 // clang-format off
@@ -125,16 +158,45 @@ public:
       kOn,
       kDefault = kOn,
    };
+   /// Let the page source determine the gap between pages up to which page reads are coalesced
+   static constexpr std::uint64_t kAutoCoalesceGap = std::uint64_t(-1);
 
 private:
    EClusterCache fClusterCache = EClusterCache::kDefault;
    unsigned int fClusterBunchSize = 1;
+   /// The number of cluster bunches that the cluster pool requests ahead of time, including the bunch of the
+   /// currently active cluster. Each bunch is loaded by a single vector read. More bunches in flight help hiding
+   /// the latency of remote storage.
+   unsigned int fClusterBunchesInFlight = 2;
+   /// Page reads of a cluster that are separated by at most the given number of bytes are merged into a single
+   /// read request.  By default, the page source picks the gap such that at most 25% of extra bytes are read.
+   /// Large values reduce the number of requests on high-latency links (e.g., HTTP or XRootD).
+   std::uint64_t fMaxCoalesceGap = kAutoCoalesceGap;
+   /// For local files, use io_uring (if available) to submit the page reads of a cluster bunch in a single batch
+   bool fUseIoUring = true;
+   /// If set, the cluster pool consults the process-wide RClusterCache before loading clusters from storage and
+   /// adds the loaded clusters to it, so that readers of the same ntuple share the clusters
+   bool fUseSharedClusterCache = false;
+   /// For local files, map the entire file into memory instead of reading the pages. Uncompressed pages of
+   /// mappable columns then point directly into the mapped region; other pages are unsealed from the mapping.
+   /// As the operating system takes care of loading the data, the cluster pool is bypassed.
+   bool fUseMmap = false;
 
 public:
    EClusterCache GetClusterCache() const { return fClusterCache; }
    void SetClusterCache(EClusterCache val) { fClusterCache = val; }
    unsigned int GetClusterBunchSize() const  { return fClusterBunchSize; }
    void SetClusterBunchSize(unsigned int val) { fClusterBunchSize = val; }
+   unsigned int GetClusterBunchesInFlight() const { return fClusterBunchesInFlight; }
+   void SetClusterBunchesInFlight(unsigned int val) { fClusterBunchesInFlight = val; }
+   std::uint64_t GetMaxCoalesceGap() const { return fMaxCoalesceGap; }
+   void SetMaxCoalesceGap(std::uint64_t val) { fMaxCoalesceGap = val; }
+   bool GetUseIoUring() const { return fUseIoUring; }
+   void SetUseIoUring(bool val) { fUseIoUring = val; }
+   bool GetUseSharedClusterCache() const { return fUseSharedClusterCache; }
+   void SetUseSharedClusterCache(bool val) { fUseSharedClusterCache = val; }
+   bool GetUseMmap() const { return fUseMmap; }
+   void SetUseMmap(bool val) { fUseMmap = val; }
 };
 
 } // namespace Experimental
@@ -20,6 +20,8 @@
 #include <ROOT/RNTupleUtil.hxx>
 #include <ROOT/RStringView.hxx>
 
+#include <algorithm>
+#include <cstring>
 #include <iterator>
 #include <memory>
 #include <type_traits>
@@ -68,6 +70,8 @@ public:
    RNTupleGlobalRange(NTupleSize_t start, NTupleSize_t end) : fStart(start), fEnd(end) {}
    RIterator begin() { return RIterator(fStart); }
    RIterator end() { return RIterator(fEnd); }
+   NTupleSize_t GetFirst() const { return fStart; }
+   NTupleSize_t GetSize() const { return fEnd - fStart; }
 };
 
 
@@ -146,6 +150,8 @@ accessed by index. For top-level fields, the index refers to the entry number. F
 nested collections have global index numbers that are derived from their parent indexes.
 
 Fields of simple types with a Map() method will use that and thus expose zero-copy access.
+ReadBulk() copies a range of consecutive values into a caller-owned buffer.  For mappable fields, the copy is
+performed page by page with a single memcpy per page.
 */
 // clang-format on
 template <typename T>
@@ -182,6 +188,8 @@ public:
    ~RNTupleView() { fField.DestroyValue(fValue); }
 
    RNTupleGlobalRange GetFieldRange() const { return RNTupleGlobalRange(0, fField.GetNElements()); }
+   /// The connected field, e.g. to access the dictionary codes of dictionary encoded strings
+   const FieldT &GetField() const { return fField; }
 
    template <typename C = T>
    typename std::enable_if_t<Internal::IsMappable<FieldT>::value, const C&>
@@ -216,6 +224,34 @@ public:
    MapV(const RClusterIndex &clusterIndex, NTupleSize_t &nItems) {
       return fField.MapV(clusterIndex, nItems);
    }
+
+   /// Copies `count` consecutive values starting at `globalIndex` into `buffer`, which must be large enough to hold
+   /// `count` elements of type T.  Pages are mapped in turn and copied as a whole.
+   template <typename C = T>
+   typename std::enable_if_t<std::is_same<C, T>::value && Internal::IsMappable<FieldT>::value, void>
+   ReadBulk(NTupleSize_t globalIndex, NTupleSize_t count, C *buffer) {
+      while (count > 0) {
+         NTupleSize_t nItems = 0;
+         const C *src = fField.MapV(globalIndex, nItems);
+         nItems = std::min(nItems, count);
+         std::memcpy(buffer, src, nItems * sizeof(C));
+         buffer += nItems;
+         globalIndex += nItems;
+         count -= nItems;
+      }
+   }
+
+   /// Fields without a Map() method are read value by value into the buffer
+   template <typename C = T>
+   typename std::enable_if_t<std::is_same<C, T>::value && !Internal::IsMappable<FieldT>::value, void>
+   ReadBulk(NTupleSize_t globalIndex, NTupleSize_t count, C *buffer) {
+      for (NTupleSize_t i = 0; i < count; ++i) {
+         fField.Read(globalIndex + i, &fValue);
+         buffer[i] = *fValue.Get<T>();
+      }
+   }
+
+   void ReadBulk(const RNTupleGlobalRange &range, T *buffer) { ReadBulk(range.GetFirst(), range.GetSize(), buffer); }
 };
 
 
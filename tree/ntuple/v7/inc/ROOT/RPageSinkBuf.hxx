@@ -20,6 +20,8 @@
 #include <ROOT/RNTupleMetrics.hxx>
 #include <ROOT/RPageStorage.hxx>
 
+#include <atomic>
+#include <cstddef>
 #include <deque>
 #include <iterator>
 #include <memory>
@@ -80,6 +82,7 @@ private:
          return std::prev(fBufferedPages.end());
       }
       const RPageStorage::ColumnHandle_t &GetHandle() const { return fCol; }
+      bool IsEmpty() const { return fBufferedPages.empty(); }
       bool HasSealedPagesOnly() const { return fBufferedPages.size() && fBufferedPages.size() == fSealedPages.size(); }
       const RPageStorage::SealedPageSequence_t &GetSealedPages() const { return fSealedPages; }
 
@@ -115,6 +118,7 @@ private:
    /// I/O performance counters that get registered in fMetrics
    struct RCounters {
       RNTuplePlainCounter &fParallelZip;
+      RNTupleAtomicCounter &fNZipBackpressure;
    };
    std::unique_ptr<RCounters> fCounters;
    RNTupleMetrics fMetrics;
@@ -125,6 +129,9 @@ private:
    std::unique_ptr<RNTupleModel> fInnerModel;
    /// Vector of buffered column pages. Indexed by column id.
    std::vector<RColumnBuf> fBufferedColumns;
+   /// Uncompressed size of the pages that are handed over to sealing tasks but not yet sealed.  Bounded by
+   /// RNTupleWriteOptions::GetMaxUnsealedPageBytes().
+   std::atomic<std::size_t> fNBytesUnsealed{0};
 
 protected:
    void CreateImpl(const RNTupleModel &model, unsigned char *serializedHeader, std::uint32_t length) final;
@@ -144,6 +151,11 @@ public:
 
    RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements) final;
    void ReleasePage(RPage &page) final;
+   /// The buffered pages are sealed and written by the inner sink, which thus knows their size on storage
+   RColumnClusterSize GetLastClusterSize(DescriptorId_t columnId) const final
+   {
+      return fInnerSink->GetLastClusterSize(columnId);
+   }
 
    RNTupleMetrics &GetMetrics() final { return fMetrics; }
 };
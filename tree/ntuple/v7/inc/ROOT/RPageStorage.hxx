@@ -31,7 +31,9 @@
 #include <deque>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <shared_mutex>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -167,9 +169,18 @@ up to the given entry number are committed.
 */
 // clang-format on
 class RPageSink : public RPageStorage {
+public:
+   /// The number of elements of a column in a cluster and the size of its pages on storage
+   struct RColumnClusterSize {
+      NTupleSize_t fNElements = 0;
+      std::uint64_t fNBytesOnStorage = 0;
+   };
+
 private:
    /// Used to map the IDs of the descriptor to the physical IDs issued during header/footer serialization
    Internal::RNTupleSerializer::RContext fSerializationContext;
+   /// The column sizes of the last committed cluster. Indexed by column id.
+   std::vector<RColumnClusterSize> fLastClusterSizes;
 
 protected:
    /// Default I/O performance counters that get registered in fMetrics
@@ -213,6 +224,12 @@ protected:
    /// The default is to call `CommitSealedPageImpl` for each page; derived classes may provide an
    /// optimized implementation though.
    virtual std::vector<RNTupleLocator> CommitSealedPageVImpl(std::span<RPageStorage::RSealedPageGroup> ranges);
+   /// Called by CommitValueRange() after the value range has been merged into the statistics of the open cluster.
+   /// Wrapper sinks may forward the value range to their inner sink.
+   virtual void CommitValueRangeImpl(DescriptorId_t /* columnId */,
+                                     const RClusterDescriptor::RValueRange & /* valueRange */)
+   {
+   }
    /// Returns the number of bytes written to storage (excluding metadata)
    virtual std::uint64_t CommitClusterImpl(NTupleSize_t nEntries) = 0;
    /// Returns the locator of the page list envelope of the given buffer that contains the serialized page list.
@@ -257,6 +274,8 @@ public:
    EPageStorageType GetType() final { return EPageStorageType::kSink; }
    /// Returns the sink's write options.
    const RNTupleWriteOptions &GetWriteOptions() const { return *fOptions; }
+   /// Returns the descriptor of the data written so far, e.g. to map the columns of the sink to those of a source
+   const RNTupleDescriptor &GetDescriptor() const { return fDescriptorBuilder.GetDescriptor(); }
 
    ColumnHandle_t AddColumn(DescriptorId_t fieldId, const RColumn &column) final;
    void DropColumn(ColumnHandle_t /*columnHandle*/) final {}
@@ -271,9 +290,16 @@ public:
    void CommitSealedPage(DescriptorId_t columnId, const RPageStorage::RSealedPage &sealedPage);
    /// Write a vector of preprocessed pages to storage. The corresponding columns must have been added before.
    void CommitSealedPageV(std::span<RPageStorage::RSealedPageGroup> ranges);
+   /// Merge the value range into the statistics of the given column in the currently open cluster. Page sinks compute
+   /// the statistics of the pages given to CommitPage() themselves if column statistics are enabled in the write
+   /// options; this method is used to forward the statistics of sealed pages, e.g. by the buffered page sink.
+   void CommitValueRange(DescriptorId_t columnId, const RClusterDescriptor::RValueRange &valueRange);
    /// Finalize the current cluster and create a new one for the following data.
    /// Returns the number of bytes written to storage (excluding meta-data).
    std::uint64_t CommitCluster(NTupleSize_t nEntries);
+   /// Returns the number of elements and the size on storage of the given column in the last committed cluster.
+   /// Used by columns to adapt their page size to the observed compression ratio.
+   virtual RColumnClusterSize GetLastClusterSize(DescriptorId_t columnId) const;
    /// Write out the page locations (page list envelope) for all the committed clusters since the last call of
    /// CommitClusterGroup (or the beginning of writing).
    void CommitClusterGroup();
@@ -342,9 +368,27 @@ public:
       void MoveIn(RNTupleDescriptor &&desc) { fDescriptor = std::move(desc); }
    };
 
+   /// I/O statistics of a single column or of a single cluster, accumulated over the populated pages.
+   /// Recorded only if the metrics are enabled.
+   struct RIOStats {
+      std::uint64_t fNPages = 0;
+      /// Size of the pages on storage, i.e. the compressed size
+      std::uint64_t fSzRead = 0;
+      /// Size of the pages in memory, after decompression and unpacking
+      std::uint64_t fSzUnzip = 0;
+      /// Wall clock time spent for decompression and unpacking in nanoseconds
+      std::uint64_t fTimeWallUnzip = 0;
+   };
+   /// Maps column ids or cluster ids to their I/O statistics
+   using IOStatsMap_t = std::unordered_map<DescriptorId_t, RIOStats>;
+
 private:
    RNTupleDescriptor fDescriptor;
    mutable std::shared_mutex fDescriptorLock;
+   /// Pages can be unsealed concurrently by the unzip tasks and the thread populating pages
+   mutable std::mutex fLockIOStats;
+   IOStatsMap_t fColumnIOStats;
+   IOStatsMap_t fClusterIOStats;
 
 protected:
    /// Default I/O performance counters that get registered in fMetrics
@@ -390,6 +434,13 @@ protected:
    /// The optimization of directly mapping pages is left to the concrete page source implementations.
    /// Usage of this method requires construction of fDecompressor.
    std::unique_ptr<unsigned char []> UnsealPage(const RSealedPage &sealedPage, const RColumnElementBase &element);
+   /// Like UnsealPage() above; if the metrics are enabled, additionally times the operation and accounts the page
+   /// to the I/O statistics of the given column and cluster
+   std::unique_ptr<unsigned char[]> UnsealPage(const RSealedPage &sealedPage, const RColumnElementBase &element,
+                                               DescriptorId_t columnId, DescriptorId_t clusterId);
+   /// Adds a populated page to the per-column and per-cluster I/O statistics.  No-op if the metrics are disabled.
+   void RecordPageIOStats(DescriptorId_t columnId, DescriptorId_t clusterId, std::uint64_t szRead,
+                          std::uint64_t szUnzip, std::uint64_t timeWallUnzip);
 
    /// Enables the default set of metrics provided by RPageSource. `prefix` will be used as the prefix for
    /// the counters registered in the internal RNTupleMetrics object.
@@ -417,6 +468,9 @@ public:
 
    EPageStorageType GetType() final { return EPageStorageType::kSource; }
    const RNTupleReadOptions &GetReadOptions() const { return fOptions; }
+   /// Uniquely identifies the ntuple in its storage container, e.g. by the file URL and ntuple name.  Used as a key
+   /// for the shared cluster cache.  An empty string, the default, prevents clusters from being shared.
+   virtual std::string GetStorageIdentifier() const { return ""; }
 
    /// Takes the read lock for the descriptor. Multiple threads can take the lock concurrently.
    /// The underlying std::shared_mutex, however, is neither read nor write recursive:
@@ -469,6 +523,11 @@ public:
 
    /// Returns the default metrics object.  Subclasses might alternatively override the method and provide their own metrics object.
    virtual RNTupleMetrics &GetMetrics() override { return fMetrics; };
+
+   /// Returns a snapshot of the I/O statistics per physical column.  Empty unless the metrics are enabled.
+   IOStatsMap_t GetColumnIOStats() const;
+   /// Returns a snapshot of the I/O statistics per cluster.  Empty unless the metrics are enabled.
+   IOStatsMap_t GetClusterIOStats() const;
 };
 
 } // namespace Detail
@@ -189,6 +189,7 @@ public:
    /// The cloned page source creates a new connection to the pool/container.
    /// The meta-data (header and footer) is reread and parsed by the clone.
    std::unique_ptr<RPageSource> Clone() const final;
+   std::string GetStorageIdentifier() const final;
    virtual ~RPageSourceDaos();
 
    RPage PopulatePage(ColumnHandle_t columnHandle, NTupleSize_t globalIndex) final;
@@ -24,6 +24,7 @@
 #include <ROOT/RStringView.hxx>
 
 #include <array>
+#include <cstddef>
 #include <cstdio>
 #include <memory>
 #include <string>
@@ -141,6 +142,10 @@ private:
    RNTupleDescriptorBuilder fDescriptorBuilder;
    /// The cluster pool asynchronously preloads the next few clusters
    std::unique_ptr<RClusterPool> fClusterPool;
+   /// If RNTupleReadOptions::GetUseMmap() is set and the file supports it, the start of the memory mapped file
+   const unsigned char *fMappedFile = nullptr;
+   /// The length of the memory mapped region starting at fMappedFile
+   std::size_t fMappedFileSize = 0;
 
    /// Deserialized header and footer into a minimal descriptor held by fDescriptorBuilder
    void InitDescriptor(const Internal::RFileNTupleAnchor &anchor);
@@ -151,6 +156,11 @@ private:
                                                             std::string_view path, const RNTupleReadOptions &options);
    RPage PopulatePageFromCluster(ColumnHandle_t columnHandle, const RClusterInfo &clusterInfo,
                                  ClusterSize_t::ValueType idxInCluster);
+   /// Maps the file into memory if requested by the read options and supported by the file
+   void MapFile();
+   /// Creates a page from the memory mapped file, either pointing directly into the mapped region
+   /// or, for compressed pages or unmappable columns, by unsealing the page from the mapped region
+   RPage PopulatePageFromMappedFile(ColumnHandle_t columnHandle, const RClusterInfo &clusterInfo);
 
    /// Helper function for LoadClusters: it prepares the memory buffer (page map) and the
    /// read requests for a given cluster and columns.  The reead requests are appended to
@@ -169,6 +179,7 @@ public:
    /// The cloned page source creates a new raw file and reader and opens its own file descriptor to the data.
    /// The meta-data (header and footer) is reread and parsed by the clone.
    std::unique_ptr<RPageSource> Clone() const final;
+   std::string GetStorageIdentifier() const final;
 
    RPageSourceFile(const RPageSourceFile&) = delete;
    RPageSourceFile& operator=(const RPageSourceFile&) = delete;
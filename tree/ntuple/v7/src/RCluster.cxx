@@ -33,6 +33,12 @@ ROOT::Experimental::Detail::ROnDiskPageMapHeap::~ROnDiskPageMapHeap() = default;
 ////////////////////////////////////////////////////////////////////////////////
 
 
+ROOT::Experimental::Detail::ROnDiskPageMapShared::~ROnDiskPageMapShared() = default;
+
+
+////////////////////////////////////////////////////////////////////////////////
+
+
 const ROOT::Experimental::Detail::ROnDiskPage *
 ROOT::Experimental::Detail::RCluster::GetOnDiskPage(const ROnDiskPage::Key &key) const
 {
@@ -71,3 +77,12 @@ void ROOT::Experimental::Detail::RCluster::SetColumnAvailable(DescriptorId_t col
 {
    fAvailColumns.insert(columnId);
 }
+
+
+std::size_t ROOT::Experimental::Detail::RCluster::GetNBytesOnDisk() const
+{
+   std::size_t nbytes = 0;
+   for (const auto &kv : fOnDiskPages)
+      nbytes += kv.second.GetSize();
+   return nbytes;
+}
@@ -0,0 +1,153 @@
+/// \file RClusterCache.cxx
+/// \ingroup NTuple ROOT7
+/// \date 2023-06-12
+/// \warning This is part of the ROOT 7 prototype! It will change without notice. It might trigger earthquakes. Feedback
+/// is welcome!
+
+/*************************************************************************
+ * Copyright (C) 1995-2023, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include <ROOT/RClusterCache.hxx>
+
+#include <utility>
+
+namespace {
+
+/// Returns true if all the columns of `subset` are in `superset`
+bool IsSubset(const ROOT::Experimental::Detail::RCluster::ColumnSet_t &subset,
+              const ROOT::Experimental::Detail::RCluster::ColumnSet_t &superset)
+{
+   if (subset.size() > superset.size())
+      return false;
+   for (auto columnId : subset) {
+      if (superset.count(columnId) == 0)
+         return false;
+   }
+   return true;
+}
+
+} // anonymous namespace
+
+ROOT::Experimental::Detail::RClusterCache &ROOT::Experimental::Detail::RClusterCache::GetGlobal()
+{
+   static RClusterCache gClusterCache;
+   return gClusterCache;
+}
+
+std::unique_ptr<ROOT::Experimental::Detail::RCluster>
+ROOT::Experimental::Detail::RClusterCache::MakeView(std::shared_ptr<const RCluster> cluster)
+{
+   auto view = std::make_unique<RCluster>(cluster->GetId());
+   for (auto columnId : cluster->GetAvailColumns())
+      view->SetColumnAvailable(columnId);
+   auto pageMap = std::make_unique<ROnDiskPageMapShared>(cluster);
+   for (const auto &kv : cluster->GetOnDiskPages())
+      pageMap->Register(kv.first, kv.second);
+   view->Adopt(std::move(pageMap));
+   return view;
+}
+
+void ROOT::Experimental::Detail::RClusterCache::EvictUntil(std::size_t maxBytes)
+{
+   while ((fNBytes > maxBytes) && !fEntries.empty()) {
+      fNBytes -= fEntries.back().fNBytes;
+      fEntries.pop_back();
+   }
+}
+
+std::unique_ptr<ROOT::Experimental::Detail::RCluster>
+ROOT::Experimental::Detail::RClusterCache::Get(const std::string &storageId, DescriptorId_t clusterId,
+                                               const RCluster::ColumnSet_t &columns)
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   for (auto itr = fEntries.begin(); itr != fEntries.end(); ++itr) {
+      if ((itr->fClusterId != clusterId) || (itr->fStorageId != storageId))
+         continue;
+      if (!IsSubset(columns, itr->fCluster->GetAvailColumns()))
+         continue;
+      fEntries.splice(fEntries.begin(), fEntries, itr);
+      fNHits++;
+      return MakeView(fEntries.front().fCluster);
+   }
+   fNMisses++;
+   return nullptr;
+}
+
+std::unique_ptr<ROOT::Experimental::Detail::RCluster>
+ROOT::Experimental::Detail::RClusterCache::Put(const std::string &storageId, std::unique_ptr<RCluster> cluster)
+{
+   const auto nbytes = cluster->GetNBytesOnDisk();
+
+   std::lock_guard<std::mutex> guard(fLock);
+   if (nbytes > fMaxBytes)
+      return cluster;
+
+   for (auto itr = fEntries.begin(); itr != fEntries.end();) {
+      if ((itr->fClusterId == cluster->GetId()) && (itr->fStorageId == storageId) &&
+          IsSubset(itr->fCluster->GetAvailColumns(), cluster->GetAvailColumns())) {
+         fNBytes -= itr->fNBytes;
+         itr = fEntries.erase(itr);
+      } else {
+         ++itr;
+      }
+   }
+
+   EvictUntil(fMaxBytes - nbytes);
+   REntry entry;
+   entry.fStorageId = storageId;
+   entry.fClusterId = cluster->GetId();
+   entry.fCluster = std::shared_ptr<const RCluster>(std::move(cluster));
+   entry.fNBytes = nbytes;
+   fEntries.emplace_front(std::move(entry));
+   fNBytes += nbytes;
+   return MakeView(fEntries.front().fCluster);
+}
+
+void ROOT::Experimental::Detail::RClusterCache::Clear()
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   fEntries.clear();
+   fNBytes = 0;
+}
+
+void ROOT::Experimental::Detail::RClusterCache::SetMaxBytes(std::size_t maxBytes)
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   fMaxBytes = maxBytes;
+   EvictUntil(fMaxBytes);
+}
+
+std::size_t ROOT::Experimental::Detail::RClusterCache::GetMaxBytes() const
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   return fMaxBytes;
+}
+
+std::size_t ROOT::Experimental::Detail::RClusterCache::GetNBytes() const
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   return fNBytes;
+}
+
+std::size_t ROOT::Experimental::Detail::RClusterCache::GetNClusters() const
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   return fEntries.size();
+}
+
+std::uint64_t ROOT::Experimental::Detail::RClusterCache::GetNHits() const
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   return fNHits;
+}
+
+std::uint64_t ROOT::Experimental::Detail::RClusterCache::GetNMisses() const
+{
+   std::lock_guard<std::mutex> guard(fLock);
+   return fNMisses;
+}
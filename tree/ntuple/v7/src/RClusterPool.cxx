@@ -13,6 +13,7 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <ROOT/RClusterCache.hxx>
 #include <ROOT/RClusterPool.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RPageStorage.hxx>
@@ -28,6 +29,7 @@
 #include <memory>
 #include <mutex>
 #include <set>
+#include <string>
 #include <utility>
 
 bool ROOT::Experimental::Detail::RClusterPool::RInFlightCluster::operator <(const RInFlightCluster &other) const
@@ -49,14 +51,19 @@ bool ROOT::Experimental::Detail::RClusterPool::RInFlightCluster::operator <(cons
    return fClusterKey.fClusterId < other.fClusterKey.fClusterId;
 }
 
-ROOT::Experimental::Detail::RClusterPool::RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize)
+ROOT::Experimental::Detail::RClusterPool::RClusterPool(RPageSource &pageSource, unsigned int clusterBunchSize,
+                                                       unsigned int clusterBunchesInFlight)
    : fPageSource(pageSource)
    , fClusterBunchSize(clusterBunchSize)
-   , fPool(2 * clusterBunchSize)
+   , fClusterBunchesInFlight(clusterBunchesInFlight)
+   , fPool(clusterBunchesInFlight * clusterBunchSize)
    , fThreadIo(&RClusterPool::ExecReadClusters, this)
    , fThreadUnzip(&RClusterPool::ExecUnzipClusters, this)
 {
    R__ASSERT(clusterBunchSize > 0);
+   R__ASSERT(clusterBunchesInFlight > 0);
+   if (pageSource.GetReadOptions().GetUseSharedClusterCache())
+      fSharedCache = &RClusterCache::GetGlobal();
 }
 
 ROOT::Experimental::Detail::RClusterPool::~RClusterPool()
@@ -109,9 +116,13 @@ void ROOT::Experimental::Detail::RClusterPool::ExecReadClusters()
       std::vector<RReadItem> readItems;
       std::vector<RCluster::RKey> clusterKeys;
       std::int64_t bunchId = -1;
+      RClusterCache *sharedCache = nullptr;
+      std::string storageId;
       {
          std::unique_lock<std::mutex> lock(fLockWorkQueue);
          fCvHasReadWork.wait(lock, [&]{ return !fReadQueue.empty(); });
+         sharedCache = fSharedCache;
+         storageId = fStorageId;
          while (!fReadQueue.empty()) {
             if (fReadQueue.front().fClusterKey.fClusterId == kInvalidDescriptorId) {
                fReadQueue.pop();
@@ -146,6 +157,8 @@ void ROOT::Experimental::Detail::RClusterPool::ExecReadClusters()
             clusters[i].reset();
             readItems[i].fPromise.set_value(std::move(clusters[i]));
          } else {
+            if (sharedCache)
+               clusters[i] = sharedCache->Put(storageId, std::move(clusters[i]));
             // Hand-over the loaded cluster pages to the unzip thread
             std::unique_lock<std::mutex> lock(fLockUnzipQueue);
             fUnzipQueue.emplace(RUnzipItem{std::move(clusters[i]), std::move(readItems[i].fPromise)});
@@ -254,8 +267,8 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(
       provideInfo.fColumnSet = columns;
       provideInfo.fBunchId = fBunchId;
       provideInfo.fFlags = RProvides::kFlagRequired;
-      for (DescriptorId_t i = 0, next = clusterId; i < 2 * fClusterBunchSize; ++i) {
-         if (i == fClusterBunchSize)
+      for (DescriptorId_t i = 0, next = clusterId; i < fClusterBunchesInFlight * fClusterBunchSize; ++i) {
+         if ((i > 0) && (i % fClusterBunchSize == 0))
             provideInfo.fBunchId = ++fBunchId;
 
          auto cid = next;
@@ -291,6 +304,12 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(
       // still be reasonably small and the lock is rarely taken (usually once per cluster).
       std::lock_guard<std::mutex> lockGuard(fLockWorkQueue);
 
+      if (fSharedCache && fStorageId.empty()) {
+         fStorageId = fPageSource.GetStorageIdentifier();
+         if (fStorageId.empty())
+            fSharedCache = nullptr;
+      }
+
       for (auto itr = fInFlightClusters.begin(); itr != fInFlightClusters.end(); ) {
          R__ASSERT(itr->fFuture.valid());
          itr->fIsExpired =
@@ -349,14 +368,29 @@ ROOT::Experimental::Detail::RClusterPool::GetCluster(
          for (const auto &kv : provide) {
             R__ASSERT(!kv.second.fColumnSet.empty());
 
+            RInFlightCluster inFlightCluster;
+            inFlightCluster.fClusterKey.fClusterId = kv.first;
+            inFlightCluster.fClusterKey.fColumnSet = kv.second.fColumnSet;
+
+            // Clusters from the shared cache skip the I/O thread
+            auto cachedCluster =
+               fSharedCache ? fSharedCache->Get(fStorageId, kv.first, kv.second.fColumnSet) : nullptr;
+            if (cachedCluster) {
+               RUnzipItem unzipItem;
+               unzipItem.fCluster = std::move(cachedCluster);
+               inFlightCluster.fFuture = unzipItem.fPromise.get_future();
+               fInFlightClusters.emplace_back(std::move(inFlightCluster));
+
+               std::unique_lock<std::mutex> lockUnzipQueue(fLockUnzipQueue);
+               fUnzipQueue.emplace(std::move(unzipItem));
+               fCvHasUnzipWork.notify_one();
+               continue;
+            }
+
             RReadItem readItem;
             readItem.fClusterKey.fClusterId = kv.first;
             readItem.fBunchId = kv.second.fBunchId;
             readItem.fClusterKey.fColumnSet = kv.second.fColumnSet;
-
-            RInFlightCluster inFlightCluster;
-            inFlightCluster.fClusterKey.fClusterId = kv.first;
-            inFlightCluster.fClusterKey.fColumnSet = kv.second.fColumnSet;
             inFlightCluster.fFuture = readItem.fPromise.get_future();
             fInFlightClusters.emplace_back(std::move(inFlightCluster));
 
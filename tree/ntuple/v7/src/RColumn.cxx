@@ -19,6 +19,7 @@
 
 #include <TError.h>
 
+#include <algorithm>
 #include <iostream>
 
 ROOT::Experimental::Detail::RColumn::RColumn(const RColumnModel& model, std::uint32_t index)
@@ -64,6 +65,35 @@ void ROOT::Experimental::Detail::RColumn::Connect(DescriptorId_t fieldId, RPageS
    }
 }
 
+void ROOT::Experimental::Detail::RColumn::AdaptPageSize()
+{
+   const auto &writeOptions = fPageSink->GetWriteOptions();
+   const auto approxZippedPageSize = writeOptions.GetApproxZippedPageSize();
+   if (approxZippedPageSize == 0)
+      return;
+
+   const auto clusterSize = fPageSink->GetLastClusterSize(fHandleSink.fId);
+   if ((clusterSize.fNElements == 0) || (clusterSize.fNBytesOnStorage == 0))
+      return;
+
+   const double bytesOnStoragePerElement =
+      static_cast<double>(clusterSize.fNBytesOnStorage) / static_cast<double>(clusterSize.fNElements);
+   const double maxNElements = std::max<std::size_t>(2, writeOptions.GetMaxUnzippedPageSize() / fElement->GetSize());
+   const auto nElements = static_cast<std::uint32_t>(
+      std::clamp(static_cast<double>(approxZippedPageSize) / bytesOnStoragePerElement, 2., maxNElements));
+   // Avoid reallocating the write pages for small fluctuations of the compression ratio
+   if ((nElements > 0.8 * fApproxNElementsPerPage) && (nElements < 1.25 * fApproxNElementsPerPage))
+      return;
+
+   R__ASSERT(fWritePage[0].IsEmpty() && fWritePage[1].IsEmpty());
+   fPageSink->ReleasePage(fWritePage[0]);
+   fPageSink->ReleasePage(fWritePage[1]);
+   fApproxNElementsPerPage = nElements;
+   fWritePage[0] = fPageSink->ReservePage(fHandleSink, fApproxNElementsPerPage + fApproxNElementsPerPage / 2);
+   fWritePage[1] = fPageSink->ReservePage(fHandleSink, fApproxNElementsPerPage + fApproxNElementsPerPage / 2);
+   fWritePage[fWritePageIdx].Reset(fNElements);
+}
+
 void ROOT::Experimental::Detail::RColumn::Flush()
 {
    auto otherIdx = 1 - fWritePageIdx;
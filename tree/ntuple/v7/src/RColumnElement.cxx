@@ -18,7 +18,6 @@
 #include <TError.h>
 
 #include <algorithm>
-#include <bitset>
 #include <cstdint>
 #include <memory>
 #include <utility>
@@ -30,6 +29,8 @@ ROOT::Experimental::Detail::RColumnElementBase::Generate(EColumnType type) {
       return std::make_unique<RColumnElement<float, EColumnType::kReal32>>(nullptr);
    case EColumnType::kReal64:
       return std::make_unique<RColumnElement<double, EColumnType::kReal64>>(nullptr);
+   case EColumnType::kReal16:
+      return std::make_unique<RColumnElement<float, EColumnType::kReal16>>(nullptr);
    case EColumnType::kChar:
       return std::make_unique<RColumnElement<char, EColumnType::kChar>>(nullptr);
    case EColumnType::kByte:
@@ -48,6 +49,18 @@ ROOT::Experimental::Detail::RColumnElementBase::Generate(EColumnType type) {
       return std::make_unique<RColumnElement<ClusterSize_t, EColumnType::kIndex>>(nullptr);
    case EColumnType::kSwitch:
       return std::make_unique<RColumnElement<RColumnSwitch, EColumnType::kSwitch>>(nullptr);
+   case EColumnType::kSplitIndex32:
+      return std::make_unique<RColumnElement<ClusterSize_t, EColumnType::kSplitIndex32>>(nullptr);
+   case EColumnType::kSplitReal64:
+      return std::make_unique<RColumnElement<double, EColumnType::kSplitReal64>>(nullptr);
+   case EColumnType::kSplitReal32:
+      return std::make_unique<RColumnElement<float, EColumnType::kSplitReal32>>(nullptr);
+   case EColumnType::kSplitInt64:
+      return std::make_unique<RColumnElement<std::int64_t, EColumnType::kSplitInt64>>(nullptr);
+   case EColumnType::kSplitInt32:
+      return std::make_unique<RColumnElement<std::int32_t, EColumnType::kSplitInt32>>(nullptr);
+   case EColumnType::kSplitInt16:
+      return std::make_unique<RColumnElement<std::int16_t, EColumnType::kSplitInt16>>(nullptr);
    default:
       R__ASSERT(false);
    }
@@ -61,6 +74,8 @@ std::size_t ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(ECo
       return 32;
    case EColumnType::kReal64:
       return 64;
+   case EColumnType::kReal16:
+      return 16;
    case EColumnType::kChar:
       return 8;
    case EColumnType::kByte:
@@ -79,6 +94,18 @@ std::size_t ROOT::Experimental::Detail::RColumnElementBase::GetBitsOnStorage(ECo
       return 32;
    case EColumnType::kSwitch:
       return 64;
+   case EColumnType::kSplitIndex32:
+      return 32;
+   case EColumnType::kSplitReal64:
+      return 64;
+   case EColumnType::kSplitReal32:
+      return 32;
+   case EColumnType::kSplitInt64:
+      return 64;
+   case EColumnType::kSplitInt32:
+      return 32;
+   case EColumnType::kSplitInt16:
+      return 16;
    default:
       R__ASSERT(false);
    }
@@ -92,6 +119,8 @@ std::string ROOT::Experimental::Detail::RColumnElementBase::GetTypeName(EColumnT
       return "Real32";
    case EColumnType::kReal64:
       return "Real64";
+   case EColumnType::kReal16:
+      return "Real16";
    case EColumnType::kChar:
       return "Char";
    case EColumnType::kByte:
@@ -110,6 +139,18 @@ std::string ROOT::Experimental::Detail::RColumnElementBase::GetTypeName(EColumnT
       return "Index";
    case EColumnType::kSwitch:
       return "Switch";
+   case EColumnType::kSplitIndex32:
+      return "SplitIndex32";
+   case EColumnType::kSplitReal64:
+      return "SplitReal64";
+   case EColumnType::kSplitReal32:
+      return "SplitReal32";
+   case EColumnType::kSplitInt64:
+      return "SplitInt64";
+   case EColumnType::kSplitInt32:
+      return "SplitInt32";
+   case EColumnType::kSplitInt16:
+      return "SplitInt16";
    default:
       return "UNKNOWN";
    }
@@ -151,19 +192,26 @@ void ROOT::Experimental::Detail::RColumnElement<bool, ROOT::Experimental::EColum
   void *dst, void *src, std::size_t count) const
 {
    bool *boolArray = reinterpret_cast<bool *>(src);
-   char *charArray = reinterpret_cast<char *>(dst);
-   std::bitset<8> bitSet;
-   std::size_t i = 0;
-   for (; i < count; ++i) {
-      bitSet.set(i % 8, boolArray[i]);
-      if (i % 8 == 7) {
-         char packed = bitSet.to_ulong();
-         charArray[i / 8] = packed;
-      }
+   unsigned char *charArray = reinterpret_cast<unsigned char *>(dst);
+   const std::size_t nFullBytes = count / 8;
+   for (std::size_t i = 0; i < nFullBytes; ++i) {
+#if R__LITTLE_ENDIAN == 1
+      // Gather the lowest bit of each of the 8 bytes (bools) into the most significant byte of the product
+      std::uint64_t bools;
+      memcpy(&bools, boolArray + 8 * i, sizeof(bools));
+      charArray[i] = static_cast<unsigned char>((bools * 0x0102040810204080ULL) >> 56);
+#else
+      unsigned char packed = 0;
+      for (std::size_t j = 0; j < 8; ++j)
+         packed |= static_cast<unsigned char>(boolArray[8 * i + j]) << j;
+      charArray[i] = packed;
+#endif
    }
-   if (i % 8 != 0) {
-      char packed = bitSet.to_ulong();
-      charArray[i / 8] = packed;
+   if (count % 8 != 0) {
+      unsigned char packed = 0;
+      for (std::size_t j = 8 * nFullBytes; j < count; ++j)
+         packed |= static_cast<unsigned char>(boolArray[j]) << (j % 8);
+      charArray[nFullBytes] = packed;
    }
 }
 
@@ -171,14 +219,21 @@ void ROOT::Experimental::Detail::RColumnElement<bool, ROOT::Experimental::EColum
   void *dst, void *src, std::size_t count) const
 {
    bool *boolArray = reinterpret_cast<bool *>(dst);
-   char *charArray = reinterpret_cast<char *>(src);
-   std::bitset<8> bitSet;
-   for (std::size_t i = 0; i < count; i += 8) {
-      bitSet = charArray[i / 8];
-      for (std::size_t j = i; j < std::min(count, i + 8); ++j) {
-         boolArray[j] = bitSet[j % 8];
-      }
+   unsigned char *charArray = reinterpret_cast<unsigned char *>(src);
+   const std::size_t nFullBytes = count / 8;
+   for (std::size_t i = 0; i < nFullBytes; ++i) {
+#if R__LITTLE_ENDIAN == 1
+      // Broadcast the byte, keep bit j in byte j, and turn the non-zero bytes into 1
+      const std::uint64_t bits = (charArray[i] * 0x0101010101010101ULL) & 0x8040201008040201ULL;
+      const std::uint64_t bools = ((bits + 0x7f7f7f7f7f7f7f7fULL) >> 7) & 0x0101010101010101ULL;
+      memcpy(boolArray + 8 * i, &bools, sizeof(bools));
+#else
+      for (std::size_t j = 0; j < 8; ++j)
+         boolArray[8 * i + j] = (charArray[i] >> j) & 1;
+#endif
    }
+   for (std::size_t j = 8 * nFullBytes; j < count; ++j)
+      boolArray[j] = (charArray[nFullBytes] >> (j % 8)) & 1;
 }
 
 
@@ -187,12 +242,13 @@ void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental
 {
    std::int64_t *int64Array = reinterpret_cast<std::int64_t *>(src);
    std::int32_t *int32Array = reinterpret_cast<std::int32_t *>(dst);
-   for (std::size_t i = 0; i < count; ++i) {
-      int32Array[i] = int64Array[i];
+   // Keep the loops free of conditionals so that the compiler can vectorize the narrowing
+   for (std::size_t i = 0; i < count; ++i)
+      int32Array[i] = static_cast<std::int32_t>(int64Array[i]);
 #if R__LITTLE_ENDIAN == 0
+   for (std::size_t i = 0; i < count; ++i)
       int32Array[i] = RByteSwap<4>::bswap(int32Array[i]);
 #endif
-   }
 }
 
 void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental::EColumnType::kInt32>::Unpack(
@@ -200,10 +256,11 @@ void ROOT::Experimental::Detail::RColumnElement<std::int64_t, ROOT::Experimental
 {
    std::int32_t *int32Array = reinterpret_cast<std::int32_t *>(src);
    std::int64_t *int64Array = reinterpret_cast<std::int64_t *>(dst);
-   for (std::size_t i = 0; i < count; ++i) {
+#if R__LITTLE_ENDIAN == 1
+   for (std::size_t i = 0; i < count; ++i)
       int64Array[i] = int32Array[i];
-#if R__LITTLE_ENDIAN == 0
-      int64Array[i] = RByteSwap<8>::bswap(int64Array[i]);
+#else
+   for (std::size_t i = 0; i < count; ++i)
+      int64Array[i] = static_cast<std::int32_t>(RByteSwap<4>::bswap(int32Array[i]));
 #endif
-   }
 }
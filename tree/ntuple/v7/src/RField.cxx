@@ -35,11 +35,13 @@
 
 #include <algorithm>
 #include <cctype> // for isspace
+#include <cmath>
 #include <cstdint>
 #include <cstdlib> // for malloc, free
 #include <cstring> // for memset
 #include <exception>
 #include <iostream>
+#include <limits>
 #include <new> // hardware_destructive_interference_size
 #include <type_traits>
 #include <unordered_map>
@@ -147,6 +149,23 @@ std::tuple<void **, std::int32_t *, std::int32_t *> GetRVecDataMembers(void *rve
    return {begin, size, capacity};
 }
 
+/// Round a floating point value to `nBits` explicitly stored mantissa bits (round to nearest, ties to even).
+/// Infinite and NaN values are passed through unchanged.
+template <typename FloatT, typename UIntT>
+FloatT RoundMantissa(FloatT value, std::uint8_t nBits)
+{
+   constexpr unsigned kMantissaBits = std::numeric_limits<FloatT>::digits - 1;
+   if ((nBits >= kMantissaBits) || !std::isfinite(value))
+      return value;
+   UIntT bits;
+   std::memcpy(&bits, &value, sizeof(bits));
+   const unsigned nDropped = kMantissaBits - nBits;
+   bits += (UIntT(1) << (nDropped - 1)) - 1 + ((bits >> nDropped) & 1);
+   bits &= ~((UIntT(1) << nDropped) - 1);
+   std::memcpy(&value, &bits, sizeof(value));
+   return value;
+}
+
 } // anonymous namespace
 
 
@@ -335,6 +354,13 @@ void ROOT::Experimental::Detail::RFieldBase::Flush() const
    }
 }
 
+void ROOT::Experimental::Detail::RFieldBase::AdaptPageSizes() const
+{
+   for (auto &column : fColumns) {
+      column->AdaptPageSize();
+   }
+}
+
 
 ROOT::Experimental::EColumnType ROOT::Experimental::Detail::RFieldBase::EnsureColumnType(
    const std::vector<EColumnType> &requestedTypes, unsigned int columnIndex, const RNTupleDescriptor &desc)
@@ -369,9 +395,18 @@ ROOT::Experimental::EColumnType ROOT::Experimental::Detail::RFieldBase::EnsureCo
 }
 
 
+void ROOT::Experimental::Detail::RFieldBase::EnsureSplittableColumnType(EColumnType plainType, EColumnType splitType,
+                                                                        unsigned int columnIndex,
+                                                                        const RNTupleDescriptor &desc)
+{
+   fUseSplitEncoding = (EnsureColumnType({plainType, splitType}, columnIndex, desc) == splitType);
+}
+
+
 void ROOT::Experimental::Detail::RFieldBase::ConnectPageSink(RPageSink &pageSink)
 {
    R__ASSERT(fColumns.empty());
+   fUseSplitEncoding = pageSink.GetWriteOptions().GetUseSplitEncoding();
    GenerateColumnsImpl();
    if (!fColumns.empty())
       fPrincipalColumn = fColumns[0].get();
@@ -463,14 +498,12 @@ void ROOT::Experimental::RFieldZero::AcceptVisitor(Detail::RFieldVisitor &visito
 
 void ROOT::Experimental::RField<ROOT::Experimental::ClusterSize_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(model, 0)));
+   GenerateSplittableColumn<ClusterSize_t, EColumnType::kIndex, EColumnType::kSplitIndex32>(0, true /* isSorted*/);
 }
 
 void ROOT::Experimental::RField<ROOT::Experimental::ClusterSize_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
+   EnsureSplittableColumnType(EColumnType::kIndex, EColumnType::kSplitIndex32, 0, desc);
    GenerateColumnsImpl();
 }
 
@@ -563,16 +596,51 @@ void ROOT::Experimental::RField<bool>::AcceptVisitor(Detail::RFieldVisitor &visi
 //------------------------------------------------------------------------------
 
 
+std::unique_ptr<ROOT::Experimental::Detail::RFieldBase>
+ROOT::Experimental::RField<float>::CloneImpl(std::string_view newName) const
+{
+   auto result = std::make_unique<RField>(newName);
+   result->SetMantissaBits(fMantissaBits);
+   result->SetHalfPrecision(fUseHalfPrecision);
+   return result;
+}
+
+void ROOT::Experimental::RField<float>::SetMantissaBits(std::uint8_t nBits)
+{
+   if (nBits > kMaxMantissaBits)
+      throw RException(R__FAIL("invalid number of mantissa bits for float field " + GetName() + ": " +
+                               std::to_string(nBits)));
+   fMantissaBits = nBits;
+   SetIsSimple(fMantissaBits == kMaxMantissaBits);
+}
+
+std::size_t ROOT::Experimental::RField<float>::AppendImpl(const Detail::RFieldValue &value)
+{
+   float rounded = RoundMantissa<float, std::uint32_t>(*value.Get<float>(), fMantissaBits);
+   fPrincipalColumn->Append(Detail::RColumnElement<float>(&rounded));
+   return sizeof(float);
+}
+
+void ROOT::Experimental::RField<float>::ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value)
+{
+   *value->Get<float>() = *fPrincipalColumn->Map<float>(globalIndex);
+}
+
 void ROOT::Experimental::RField<float>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kReal32, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<float, EColumnType::kReal32>(model, 0)));
+   if (fUseHalfPrecision) {
+      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<float, EColumnType::kReal16>(
+         RColumnModel(EColumnType::kReal16, false /* isSorted*/), 0)));
+      return;
+   }
+   GenerateSplittableColumn<float, EColumnType::kReal32, EColumnType::kSplitReal32>(0, false /* isSorted*/);
 }
 
 void ROOT::Experimental::RField<float>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kReal32}, 0, desc);
+   const auto type = EnsureColumnType({EColumnType::kReal32, EColumnType::kSplitReal32, EColumnType::kReal16}, 0, desc);
+   fUseHalfPrecision = (type == EColumnType::kReal16);
+   fUseSplitEncoding = (type == EColumnType::kSplitReal32);
    GenerateColumnsImpl();
 }
 
@@ -584,16 +652,43 @@ void ROOT::Experimental::RField<float>::AcceptVisitor(Detail::RFieldVisitor &vis
 
 //------------------------------------------------------------------------------
 
+std::unique_ptr<ROOT::Experimental::Detail::RFieldBase>
+ROOT::Experimental::RField<double>::CloneImpl(std::string_view newName) const
+{
+   auto result = std::make_unique<RField>(newName);
+   result->SetMantissaBits(fMantissaBits);
+   return result;
+}
+
+void ROOT::Experimental::RField<double>::SetMantissaBits(std::uint8_t nBits)
+{
+   if (nBits > kMaxMantissaBits)
+      throw RException(R__FAIL("invalid number of mantissa bits for double field " + GetName() + ": " +
+                               std::to_string(nBits)));
+   fMantissaBits = nBits;
+   SetIsSimple(fMantissaBits == kMaxMantissaBits);
+}
+
+std::size_t ROOT::Experimental::RField<double>::AppendImpl(const Detail::RFieldValue &value)
+{
+   double rounded = RoundMantissa<double, std::uint64_t>(*value.Get<double>(), fMantissaBits);
+   fPrincipalColumn->Append(Detail::RColumnElement<double>(&rounded));
+   return sizeof(double);
+}
+
+void ROOT::Experimental::RField<double>::ReadGlobalImpl(NTupleSize_t globalIndex, Detail::RFieldValue *value)
+{
+   *value->Get<double>() = *fPrincipalColumn->Map<double>(globalIndex);
+}
+
 void ROOT::Experimental::RField<double>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kReal64, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<double, EColumnType::kReal64>(model, 0)));
+   GenerateSplittableColumn<double, EColumnType::kReal64, EColumnType::kSplitReal64>(0, false /* isSorted*/);
 }
 
 void ROOT::Experimental::RField<double>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kReal64}, 0, desc);
+   EnsureSplittableColumnType(EColumnType::kReal64, EColumnType::kSplitReal64, 0, desc);
    GenerateColumnsImpl();
 }
 
@@ -606,14 +701,12 @@ void ROOT::Experimental::RField<double>::AcceptVisitor(Detail::RFieldVisitor &vi
 
 void ROOT::Experimental::RField<std::int16_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt16, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<
-      std::int16_t, EColumnType::kInt16>(model, 0)));
+   GenerateSplittableColumn<std::int16_t, EColumnType::kInt16, EColumnType::kSplitInt16>(0, false /* isSorted*/);
 }
 
 void ROOT::Experimental::RField<std::int16_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kInt16}, 0, desc);
+   EnsureSplittableColumnType(EColumnType::kInt16, EColumnType::kSplitInt16, 0, desc);
    GenerateColumnsImpl();
 }
 
@@ -626,14 +719,12 @@ void ROOT::Experimental::RField<std::int16_t>::AcceptVisitor(Detail::RFieldVisit
 
 void ROOT::Experimental::RField<std::uint16_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt16, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<
-      std::uint16_t, EColumnType::kInt16>(model, 0)));
+   GenerateSplittableColumn<std::uint16_t, EColumnType::kInt16, EColumnType::kSplitInt16>(0, false /* isSorted*/);
 }
 
 void ROOT::Experimental::RField<std::uint16_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kInt16}, 0, desc);
+   EnsureSplittableColumnType(EColumnType::kInt16, EColumnType::kSplitInt16, 0, desc);
    GenerateColumnsImpl();
 }
 
@@ -646,14 +737,12 @@ void ROOT::Experimental::RField<std::uint16_t>::AcceptVisitor(Detail::RFieldVisi
 
 void ROOT::Experimental::RField<std::int32_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt32, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<
-      std::int32_t, EColumnType::kInt32>(model, 0)));
+   GenerateSplittableColumn<std::int32_t, EColumnType::kInt32, EColumnType::kSplitInt32>(0, false /* isSorted*/);
 }
 
 void ROOT::Experimental::RField<std::int32_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kInt32}, 0, desc);
+   EnsureSplittableColumnType(EColumnType::kInt32, EColumnType::kSplitInt32, 0, desc);
    GenerateColumnsImpl();
 }
 
@@ -666,14 +755,12 @@ void ROOT::Experimental::RField<std::int32_t>::AcceptVisitor(Detail::RFieldVisit
 
 void ROOT::Experimental::RField<std::uint32_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt32, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<std::uint32_t, EColumnType::kInt32>(model, 0)));
+   GenerateSplittableColumn<std::uint32_t, EColumnType::kInt32, EColumnType::kSplitInt32>(0, false /* isSorted*/);
 }
 
 void ROOT::Experimental::RField<std::uint32_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kInt32}, 0, desc);
+   EnsureSplittableColumnType(EColumnType::kInt32, EColumnType::kSplitInt32, 0, desc);
    GenerateColumnsImpl();
 }
 
@@ -686,14 +773,12 @@ void ROOT::Experimental::RField<std::uint32_t>::AcceptVisitor(Detail::RFieldVisi
 
 void ROOT::Experimental::RField<std::uint64_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt64, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<std::uint64_t, EColumnType::kInt64>(model, 0)));
+   GenerateSplittableColumn<std::uint64_t, EColumnType::kInt64, EColumnType::kSplitInt64>(0, false /* isSorted*/);
 }
 
 void ROOT::Experimental::RField<std::uint64_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kInt64}, 0, desc);
+   EnsureSplittableColumnType(EColumnType::kInt64, EColumnType::kSplitInt64, 0, desc);
    GenerateColumnsImpl();
 }
 
@@ -706,21 +791,19 @@ void ROOT::Experimental::RField<std::uint64_t>::AcceptVisitor(Detail::RFieldVisi
 
 void ROOT::Experimental::RField<std::int64_t>::GenerateColumnsImpl()
 {
-   RColumnModel model(EColumnType::kInt64, false /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<std::int64_t, EColumnType::kInt64>(model, 0)));
+   GenerateSplittableColumn<std::int64_t, EColumnType::kInt64, EColumnType::kSplitInt64>(0, false /* isSorted*/);
 }
 
 void ROOT::Experimental::RField<std::int64_t>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   auto type = EnsureColumnType({EColumnType::kInt64, EColumnType::kInt32}, 0, desc);
-   RColumnModel model(type, false /* isSorted*/);
-   if (type == EColumnType::kInt64) {
-      fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-         Detail::RColumn::Create<std::int64_t, EColumnType::kInt64>(model, 0)));
-   } else {
+   auto type = EnsureColumnType({EColumnType::kInt64, EColumnType::kSplitInt64, EColumnType::kInt32}, 0, desc);
+   if (type == EColumnType::kInt32) {
+      RColumnModel model(type, false /* isSorted*/);
       fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
          Detail::RColumn::Create<std::int64_t, EColumnType::kInt32>(model, 0)));
+   } else {
+      fUseSplitEncoding = (type == EColumnType::kSplitInt64);
+      GenerateColumnsImpl();
    }
 }
 
@@ -733,19 +816,32 @@ void ROOT::Experimental::RField<std::int64_t>::AcceptVisitor(Detail::RFieldVisit
 
 void ROOT::Experimental::RField<std::string>::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   if (fUseDictionaryEncoding) {
+      GenerateSplittableColumn<std::int32_t, EColumnType::kInt32, EColumnType::kSplitInt32>(0, false /* isSorted*/);
+      GenerateSplittableColumn<ClusterSize_t, EColumnType::kIndex, EColumnType::kSplitIndex32>(1, true /* isSorted*/);
+   } else {
+      GenerateSplittableColumn<ClusterSize_t, EColumnType::kIndex, EColumnType::kSplitIndex32>(0, true /* isSorted*/);
+   }
 
    RColumnModel modelChars(EColumnType::kChar, false /* isSorted*/);
    fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<char, EColumnType::kChar>(modelChars, 1)));
+      Detail::RColumn::Create<char, EColumnType::kChar>(modelChars, fColumns.size())));
 }
 
 void ROOT::Experimental::RField<std::string>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
-   EnsureColumnType({EColumnType::kChar}, 1, desc);
+   const auto type = EnsureColumnType(
+      {EColumnType::kIndex, EColumnType::kSplitIndex32, EColumnType::kInt32, EColumnType::kSplitInt32}, 0, desc);
+   fUseDictionaryEncoding = (type == EColumnType::kInt32) || (type == EColumnType::kSplitInt32);
+   if (fUseDictionaryEncoding) {
+      fUseSplitEncoding = (type == EColumnType::kSplitInt32);
+      // The code column and the dictionary index column are written with the same encoding
+      EnsureColumnType({fUseSplitEncoding ? EColumnType::kSplitIndex32 : EColumnType::kIndex}, 1, desc);
+      EnsureColumnType({EColumnType::kChar}, 2, desc);
+   } else {
+      fUseSplitEncoding = (type == EColumnType::kSplitIndex32);
+      EnsureColumnType({EColumnType::kChar}, 1, desc);
+   }
    GenerateColumnsImpl();
 }
 
@@ -753,6 +849,25 @@ std::size_t ROOT::Experimental::RField<std::string>::AppendImpl(const ROOT::Expe
 {
    auto typedValue = value.Get<std::string>();
    auto length = typedValue->length();
+
+   if (fUseDictionaryEncoding) {
+      std::size_t nbytes = sizeof(std::int32_t);
+      auto itr = fDictionary.find(*typedValue);
+      if (itr == fDictionary.end()) {
+         // New dictionary entry for this cluster
+         itr = fDictionary.emplace(*typedValue, static_cast<std::int32_t>(fDictionary.size())).first;
+         Detail::RColumnElement<char> elemChars(const_cast<char*>(typedValue->data()));
+         fColumns[2]->AppendV(elemChars, length);
+         fIndex += length;
+         fColumns[1]->Append(fElemIndex);
+         nbytes += length + sizeof(fElemIndex);
+      }
+      auto code = itr->second;
+      Detail::RColumnElement<std::int32_t> elemCode(&code);
+      fColumns[0]->Append(elemCode);
+      return nbytes;
+   }
+
    Detail::RColumnElement<char> elemChars(const_cast<char*>(typedValue->data()));
    fColumns[1]->AppendV(elemChars, length);
    fIndex += length;
@@ -766,19 +881,67 @@ void ROOT::Experimental::RField<std::string>::ReadGlobalImpl(
    auto typedValue = value->Get<std::string>();
    RClusterIndex collectionStart;
    ClusterSize_t nChars;
-   fPrincipalColumn->GetCollectionInfo(globalIndex, &collectionStart, &nChars);
+   if (fUseDictionaryEncoding) {
+      const auto clusterIndex = fPrincipalColumn->GetClusterIndex(globalIndex);
+      const auto code = GetDictionaryCode(clusterIndex);
+      fColumns[1]->GetCollectionInfo(RClusterIndex(clusterIndex.GetClusterId(), code), &collectionStart, &nChars);
+   } else {
+      fPrincipalColumn->GetCollectionInfo(globalIndex, &collectionStart, &nChars);
+   }
    if (nChars == 0) {
       typedValue->clear();
    } else {
       typedValue->resize(nChars);
       Detail::RColumnElement<char> elemChars(const_cast<char*>(typedValue->data()));
-      fColumns[1]->ReadV(collectionStart, nChars, &elemChars);
+      fColumns.back()->ReadV(collectionStart, nChars, &elemChars);
+   }
+}
+
+std::int32_t ROOT::Experimental::RField<std::string>::GetDictionaryCode(const RClusterIndex &clusterIndex) const
+{
+   R__ASSERT(fUseDictionaryEncoding);
+   std::int32_t code;
+   Detail::RColumnElement<std::int32_t> elemCode(&code);
+   fPrincipalColumn->Read(clusterIndex, &elemCode);
+   return code;
+}
+
+std::int32_t ROOT::Experimental::RField<std::string>::FindDictionaryCode(DescriptorId_t clusterId,
+                                                                        std::string_view value) const
+{
+   R__ASSERT(fUseDictionaryEncoding);
+   ClusterSize_t::ValueType nEntries;
+   {
+      auto descriptorGuard = fColumns[1]->GetPageSource()->GetSharedDescriptorGuard();
+      const auto &clusterDesc = descriptorGuard->GetClusterDescriptor(clusterId);
+      const auto columnId = fColumns[1]->GetColumnIdSource();
+      if (!clusterDesc.ContainsColumn(columnId))
+         return -1;
+      nEntries = clusterDesc.GetColumnRange(columnId).fNElements;
+   }
+
+   std::string entry;
+   for (ClusterSize_t::ValueType i = 0; i < nEntries; ++i) {
+      RClusterIndex collectionStart;
+      ClusterSize_t nChars;
+      fColumns[1]->GetCollectionInfo(RClusterIndex(clusterId, i), &collectionStart, &nChars);
+      if (nChars != value.length())
+         continue;
+      entry.resize(nChars);
+      if (nChars > 0) {
+         Detail::RColumnElement<char> elemChars(const_cast<char *>(entry.data()));
+         fColumns[2]->ReadV(collectionStart, nChars, &elemChars);
+      }
+      if (entry == value)
+         return static_cast<std::int32_t>(i);
    }
+   return -1;
 }
 
 void ROOT::Experimental::RField<std::string>::CommitCluster()
 {
    fIndex = 0;
+   fDictionary.clear();
 }
 
 void ROOT::Experimental::RField<std::string>::AcceptVisitor(Detail::RFieldVisitor &visitor) const
@@ -1096,14 +1259,12 @@ void ROOT::Experimental::RVectorField::ReadGlobalImpl(NTupleSize_t globalIndex,
 
 void ROOT::Experimental::RVectorField::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   GenerateSplittableColumn<ClusterSize_t, EColumnType::kIndex, EColumnType::kSplitIndex32>(0, true /* isSorted*/);
 }
 
 void ROOT::Experimental::RVectorField::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
+   EnsureSplittableColumnType(EColumnType::kIndex, EColumnType::kSplitIndex32, 0, desc);
    GenerateColumnsImpl();
 }
 
@@ -1220,7 +1381,9 @@ void ROOT::Experimental::RRVecField::ReadGlobalImpl(NTupleSize_t globalIndex, De
       }
 
       // TODO Increment capacity by a factor rather than just enough to fit the elements.
-      free(*beginPtr);
+      // The value does not own its buffer if it adopted the items from a page in ReadMapped()
+      if (*capacityPtr != -1)
+         free(*beginPtr);
       // We trust that malloc returns a buffer with large enough alignment.
       // This might not be the case if T in RVec<T> is over-aligned.
       *beginPtr = malloc(nItems * fItemSize);
@@ -1245,16 +1408,46 @@ void ROOT::Experimental::RRVecField::ReadGlobalImpl(NTupleSize_t globalIndex, De
    }
 }
 
+bool ROOT::Experimental::RRVecField::ReadMapped(NTupleSize_t globalIndex, Detail::RFieldValue *value)
+{
+   auto itemField = fSubFields[0].get();
+   if (!itemField->IsSimple() || !itemField->fPrincipalColumn->GetElement()->IsMappable())
+      return false;
+
+   auto [beginPtr, sizePtr, capacityPtr] = GetRVecDataMembers(value->GetRawPtr());
+
+   ClusterSize_t nItems;
+   RClusterIndex collectionStart;
+   fPrincipalColumn->GetCollectionInfo(globalIndex, &collectionStart, &nItems);
+   if (nItems == 0) {
+      // items of simple fields need no destruction
+      *sizePtr = 0;
+      return true;
+   }
+
+   NTupleSize_t nMapped;
+   void *items = itemField->fPrincipalColumn->MapRawV(collectionStart, nMapped);
+   if (nMapped < nItems)
+      return false;
+
+   // An owned buffer is released: it is only needed again after reading from the end of a page, which is rare
+   if (*capacityPtr != -1) {
+      DestroyValue(*value, true /* dtorOnly */);
+      *capacityPtr = -1;
+   }
+   *beginPtr = items;
+   *sizePtr = nItems;
+   return true;
+}
+
 void ROOT::Experimental::RRVecField::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(
-      std::unique_ptr<Detail::RColumn>(Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   GenerateSplittableColumn<ClusterSize_t, EColumnType::kIndex, EColumnType::kSplitIndex32>(0, true /* isSorted*/);
 }
 
 void ROOT::Experimental::RRVecField::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
+   EnsureSplittableColumnType(EColumnType::kIndex, EColumnType::kSplitIndex32, 0, desc);
    GenerateColumnsImpl();
 }
 
@@ -1427,14 +1620,12 @@ void ROOT::Experimental::RField<std::vector<bool>>::ReadGlobalImpl(NTupleSize_t
 
 void ROOT::Experimental::RField<std::vector<bool>>::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   GenerateSplittableColumn<ClusterSize_t, EColumnType::kIndex, EColumnType::kSplitIndex32>(0, true /* isSorted*/);
 }
 
 void ROOT::Experimental::RField<std::vector<bool>>::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
+   EnsureSplittableColumnType(EColumnType::kIndex, EColumnType::kSplitIndex32, 0, desc);
    GenerateColumnsImpl();
 }
 
@@ -1842,14 +2033,12 @@ ROOT::Experimental::RCollectionField::RCollectionField(
 
 void ROOT::Experimental::RCollectionField::GenerateColumnsImpl()
 {
-   RColumnModel modelIndex(EColumnType::kIndex, true /* isSorted*/);
-   fColumns.emplace_back(std::unique_ptr<Detail::RColumn>(
-      Detail::RColumn::Create<ClusterSize_t, EColumnType::kIndex>(modelIndex, 0)));
+   GenerateSplittableColumn<ClusterSize_t, EColumnType::kIndex, EColumnType::kSplitIndex32>(0, true /* isSorted*/);
 }
 
 void ROOT::Experimental::RCollectionField::GenerateColumnsImpl(const RNTupleDescriptor &desc)
 {
-   EnsureColumnType({EColumnType::kIndex}, 0, desc);
+   EnsureSplittableColumnType(EColumnType::kIndex, EColumnType::kSplitIndex32, 0, desc);
    GenerateColumnsImpl();
 }
 
@@ -35,10 +35,13 @@
 #include <functional>
 #include <iomanip>
 #include <iostream>
+#include <iterator>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 
 #ifdef R__USE_IMT
@@ -225,6 +228,8 @@ void ROOT::Experimental::RNTupleReader::PrintInfo(const ENTupleInfo what, std::o
    case ENTupleInfo::kMetrics:
       fMetrics.Print(output);
       break;
+   case ENTupleInfo::kMetricsJSON: PrintMetricsJSON(output); break;
+   case ENTupleInfo::kMetricsPrometheus: PrintMetricsPrometheus(output); break;
    default:
       // Unhandled case, internal error
       R__ASSERT(false);
@@ -232,6 +237,88 @@ void ROOT::Experimental::RNTupleReader::PrintInfo(const ENTupleInfo what, std::o
 }
 
 
+std::vector<ROOT::Experimental::RNTupleReader::RIOStatsEntry>
+ROOT::Experimental::RNTupleReader::GetIOStats(bool perColumn)
+{
+   const auto statsMap = perColumn ? fSource->GetColumnIOStats() : fSource->GetClusterIOStats();
+   std::vector<RIOStatsEntry> result;
+   {
+      auto descriptorGuard = fSource->GetSharedDescriptorGuard();
+      for (const auto &[id, stats] : statsMap) {
+         std::string fieldName;
+         if (perColumn)
+            fieldName = descriptorGuard->GetQualifiedFieldName(descriptorGuard->GetColumnDescriptor(id).GetFieldId());
+         result.push_back({id, fieldName, stats});
+      }
+   }
+   std::sort(result.begin(), result.end(),
+             [](const RIOStatsEntry &a, const RIOStatsEntry &b) { return a.fId < b.fId; });
+   return result;
+}
+
+void ROOT::Experimental::RNTupleReader::PrintMetricsJSON(std::ostream &output)
+{
+   auto fnEscape = [](const std::string &str) {
+      std::string result;
+      for (auto c : str) {
+         if (c == '"' || c == '\\')
+            result += '\\';
+         result += c;
+      }
+      return result;
+   };
+   auto fnPrintIOStats = [&](const std::vector<RIOStatsEntry> &entries, const std::string &idName) {
+      output << "[";
+      for (std::size_t i = 0; i < entries.size(); ++i) {
+         const auto &e = entries[i];
+         output << ((i == 0) ? "\n" : ",\n") << "    {\"" << idName << "\": " << e.fId;
+         if (!e.fFieldName.empty())
+            output << ", \"field\": \"" << fnEscape(e.fFieldName) << "\"";
+         output << ", \"nPages\": " << e.fStats.fNPages << ", \"szRead\": " << e.fStats.fSzRead
+                << ", \"szUnzip\": " << e.fStats.fSzUnzip << ", \"timeWallUnzip\": " << e.fStats.fTimeWallUnzip
+                << "}";
+      }
+      output << (entries.empty() ? "]" : "\n  ]");
+   };
+
+   output << "{\n  \"counters\": ";
+   fMetrics.PrintJSON(output);
+   output << ",\n  \"columns\": ";
+   fnPrintIOStats(GetIOStats(true /* perColumn */), "columnId");
+   output << ",\n  \"clusters\": ";
+   fnPrintIOStats(GetIOStats(false /* perColumn */), "clusterId");
+   output << "\n}" << std::endl;
+}
+
+void ROOT::Experimental::RNTupleReader::PrintMetricsPrometheus(std::ostream &output)
+{
+   if (!fMetrics.IsEnabled())
+      return;
+   fMetrics.PrintPrometheus(output);
+
+   const auto ntupleName = fSource->GetSharedDescriptorGuard()->GetName();
+   auto fnPrintIOStats = [&](const std::vector<RIOStatsEntry> &entries, const std::string &kind) {
+      const std::pair<std::string, std::uint64_t Detail::RPageSource::RIOStats::*> members[] = {
+         {"nPages", &Detail::RPageSource::RIOStats::fNPages},
+         {"szRead", &Detail::RPageSource::RIOStats::fSzRead},
+         {"szUnzip", &Detail::RPageSource::RIOStats::fSzUnzip},
+         {"timeWallUnzip", &Detail::RPageSource::RIOStats::fTimeWallUnzip}};
+      for (const auto &[memberName, member] : members) {
+         const std::string metricName = "RNTupleReader_" + kind + "_" + memberName;
+         output << "# TYPE " << metricName << " gauge\n";
+         for (const auto &e : entries) {
+            output << metricName << "{ntuple=\"" << ntupleName << "\"," << kind << "=\"" << e.fId << "\"";
+            if (!e.fFieldName.empty())
+               output << ",field=\"" << e.fFieldName << "\"";
+            output << "} " << e.fStats.*member << "\n";
+         }
+      }
+   };
+   fnPrintIOStats(GetIOStats(true /* perColumn */), "column");
+   fnPrintIOStats(GetIOStats(false /* perColumn */), "cluster");
+}
+
+
 ROOT::Experimental::RNTupleReader *ROOT::Experimental::RNTupleReader::GetDisplayReader()
 {
    if (!fDisplayReader)
@@ -292,12 +379,118 @@ const ROOT::Experimental::RNTupleDescriptor *ROOT::Experimental::RNTupleReader::
 //------------------------------------------------------------------------------
 
 
-ROOT::Experimental::RNTupleWriter::RNTupleWriter(
-   std::unique_ptr<ROOT::Experimental::RNTupleModel> model,
-   std::unique_ptr<ROOT::Experimental::Detail::RPageSink> sink)
-   : fSink(std::move(sink))
-   , fModel(std::move(model))
-   , fMetrics("RNTupleWriter")
+namespace {
+
+/// Runs the page compression tasks of a fill context immediately in the filling thread. Used by the fill contexts
+/// of the RNTupleParallelWriter if IMT is off, such that pages are sealed before the cluster commit takes the lock.
+class RNTupleInlineTaskScheduler : public ROOT::Experimental::Detail::RPageStorage::RTaskScheduler {
+public:
+   void Reset() final {}
+   void AddTask(const std::function<void(void)> &taskFunc) final { taskFunc(); }
+   void Wait() final {}
+};
+
+std::unique_ptr<ROOT::Experimental::Detail::RPageStorage::RTaskScheduler> CreateImtTaskScheduler()
+{
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled())
+      return std::make_unique<ROOT::Experimental::RNTupleImtTaskScheduler>();
+#endif
+   return nullptr;
+}
+
+/// Forwards the pages and clusters of a fill context to the shared sink of an RNTupleParallelWriter. The fill
+/// context wraps this sink in an RPageSinkBuf, which forwards all pages of a cluster in a row followed by the cluster
+/// commit.  Therefore, the lock on the shared sink is taken with the first page commit of a cluster and released
+/// after the cluster commit.  Header, cluster group and footer are written by the parallel writer.
+class RPageSynchronizingSink : public ROOT::Experimental::Detail::RPageSink {
+private:
+   using NTupleSize_t = ROOT::Experimental::NTupleSize_t;
+   using DescriptorId_t = ROOT::Experimental::DescriptorId_t;
+   using RNTupleLocator = ROOT::Experimental::RNTupleLocator;
+   using RPage = ROOT::Experimental::Detail::RPage;
+
+   RPageSink &fInnerSink;
+   std::unique_lock<std::mutex> fLock;
+   /// The total number of entries committed to the inner sink, shared by all synchronizing sinks. Protected by fLock.
+   NTupleSize_t &fNEntriesInner;
+
+   void EnsureLocked()
+   {
+      if (!fLock.owns_lock())
+         fLock.lock();
+   }
+
+protected:
+   void CreateImpl(const ROOT::Experimental::RNTupleModel & /* model */, unsigned char * /* serializedHeader */,
+                   std::uint32_t /* length */) final
+   {
+   }
+   RNTupleLocator CommitPageImpl(ColumnHandle_t columnHandle, const RPage &page) final
+   {
+      EnsureLocked();
+      fInnerSink.CommitPage(columnHandle, page);
+      return RNTupleLocator{};
+   }
+   RNTupleLocator CommitSealedPageImpl(DescriptorId_t columnId, const RSealedPage &sealedPage) final
+   {
+      EnsureLocked();
+      fInnerSink.CommitSealedPage(columnId, sealedPage);
+      return RNTupleLocator{};
+   }
+   std::vector<RNTupleLocator> CommitSealedPageVImpl(std::span<RSealedPageGroup> ranges) final
+   {
+      EnsureLocked();
+      fInnerSink.CommitSealedPageV(ranges);
+      std::size_t nPages = 0;
+      for (const auto &range : ranges)
+         nPages += std::distance(range.fFirst, range.fLast);
+      // The locators of this sink are never written out
+      return std::vector<RNTupleLocator>(nPages);
+   }
+   void CommitValueRangeImpl(DescriptorId_t columnId,
+                             const ROOT::Experimental::RClusterDescriptor::RValueRange &valueRange) final
+   {
+      EnsureLocked();
+      fInnerSink.CommitValueRange(columnId, valueRange);
+   }
+   std::uint64_t CommitClusterImpl(NTupleSize_t nEntries) final
+   {
+      EnsureLocked();
+      fNEntriesInner += nEntries - fPrevClusterNEntries;
+      auto nbytes = fInnerSink.CommitCluster(fNEntriesInner);
+      fLock.unlock();
+      return nbytes;
+   }
+   RNTupleLocator CommitClusterGroupImpl(unsigned char * /* serializedPageList */, std::uint32_t /* length */) final
+   {
+      return RNTupleLocator{};
+   }
+   void CommitDatasetImpl(unsigned char * /* serializedFooter */, std::uint32_t /* length */) final {}
+
+public:
+   RPageSynchronizingSink(RPageSink &inner, std::mutex &mutex, NTupleSize_t &nEntriesInner)
+      : RPageSink(inner.GetNTupleName(), inner.GetWriteOptions()),
+        fInnerSink(inner),
+        fLock(mutex, std::defer_lock),
+        fNEntriesInner(nEntriesInner)
+   {
+   }
+
+   RPage ReservePage(ColumnHandle_t columnHandle, std::size_t nElements) final
+   {
+      return fInnerSink.ReservePage(columnHandle, nElements);
+   }
+   void ReleasePage(RPage &page) final { fInnerSink.ReleasePage(page); }
+};
+
+} // anonymous namespace
+
+
+ROOT::Experimental::RNTupleFillContext::RNTupleFillContext(
+   std::unique_ptr<RNTupleModel> model, std::unique_ptr<Detail::RPageSink> sink,
+   std::unique_ptr<Detail::RPageStorage::RTaskScheduler> zipTasks)
+   : fZipTasks(std::move(zipTasks)), fSink(std::move(sink)), fModel(std::move(model)), fMetrics("RNTupleFillContext")
 {
    if (!fModel) {
       throw RException(R__FAIL("null model"));
@@ -306,12 +499,8 @@ ROOT::Experimental::RNTupleWriter::RNTupleWriter(
       throw RException(R__FAIL("null sink"));
    }
    fModel->Freeze();
-#ifdef R__USE_IMT
-   if (IsImplicitMTEnabled()) {
-      fZipTasks = std::make_unique<RNTupleImtTaskScheduler>();
+   if (fZipTasks)
       fSink->SetTaskScheduler(fZipTasks.get());
-   }
-#endif
    fSink->Create(*fModel.get());
    fMetrics.ObserveMetrics(fSink->GetMetrics());
 
@@ -322,10 +511,53 @@ ROOT::Experimental::RNTupleWriter::RNTupleWriter(
    fUnzippedClusterSizeEst = scale * writeOpts.GetApproxZippedClusterSize();
 }
 
+ROOT::Experimental::RNTupleFillContext::~RNTupleFillContext()
+{
+   CommitCluster();
+}
+
+void ROOT::Experimental::RNTupleFillContext::CommitCluster()
+{
+   if (fNEntries == fLastCommitted)
+      return;
+   for (auto& field : *fModel->GetFieldZero()) {
+      field.Flush();
+      field.CommitCluster();
+   }
+   fNBytesCommitted += fSink->CommitCluster(fNEntries);
+   fNBytesFilled += fUnzippedClusterSize;
+   if (fSink->GetWriteOptions().GetApproxZippedPageSize() > 0) {
+      for (auto &field : *fModel->GetFieldZero())
+         field.AdaptPageSizes();
+   }
+
+   // Cap the compression factor at 1000 to prevent overflow of fUnzippedClusterSizeEst
+   const float compressionFactor = std::min(1000.f,
+      static_cast<float>(fNBytesFilled) / static_cast<float>(fNBytesCommitted));
+   fUnzippedClusterSizeEst =
+      compressionFactor * static_cast<float>(fSink->GetWriteOptions().GetApproxZippedClusterSize());
+
+   fLastCommitted = fNEntries;
+   fUnzippedClusterSize = 0;
+}
+
+
+//------------------------------------------------------------------------------
+
+
+ROOT::Experimental::RNTupleWriter::RNTupleWriter(
+   std::unique_ptr<ROOT::Experimental::RNTupleModel> model,
+   std::unique_ptr<ROOT::Experimental::Detail::RPageSink> sink)
+   : fFillContext(std::move(model), std::move(sink), CreateImtTaskScheduler())
+   , fMetrics("RNTupleWriter")
+{
+   fMetrics.ObserveMetrics(fFillContext.fSink->GetMetrics());
+}
+
 ROOT::Experimental::RNTupleWriter::~RNTupleWriter()
 {
    CommitCluster(true /* commitClusterGroup */);
-   fSink->CommitDataset();
+   fFillContext.fSink->CommitDataset();
 }
 
 std::unique_ptr<ROOT::Experimental::RNTupleWriter> ROOT::Experimental::RNTupleWriter::Recreate(
@@ -353,37 +585,84 @@ std::unique_ptr<ROOT::Experimental::RNTupleWriter> ROOT::Experimental::RNTupleWr
 
 void ROOT::Experimental::RNTupleWriter::CommitClusterGroup()
 {
-   if (fNEntries == fLastCommittedClusterGroup)
+   const auto nEntries = fFillContext.GetNEntries();
+   if (nEntries == fLastCommittedClusterGroup)
       return;
-   fSink->CommitClusterGroup();
-   fLastCommittedClusterGroup = fNEntries;
+   fFillContext.fSink->CommitClusterGroup();
+   fLastCommittedClusterGroup = nEntries;
 }
 
 void ROOT::Experimental::RNTupleWriter::CommitCluster(bool commitClusterGroup)
 {
-   if (fNEntries == fLastCommitted) {
-      if (commitClusterGroup)
-         CommitClusterGroup();
-      return;
+   fFillContext.CommitCluster();
+   if (commitClusterGroup)
+      CommitClusterGroup();
+}
+
+
+//------------------------------------------------------------------------------
+
+
+ROOT::Experimental::RNTupleParallelWriter::RNTupleParallelWriter(std::unique_ptr<RNTupleModel> model,
+                                                                 std::unique_ptr<Detail::RPageSink> sink)
+   : fSink(std::move(sink)), fModel(std::move(model)), fMetrics("RNTupleParallelWriter")
+{
+   if (!fModel) {
+      throw RException(R__FAIL("null model"));
    }
-   for (auto& field : *fModel->GetFieldZero()) {
-      field.Flush();
-      field.CommitCluster();
+   if (!fSink) {
+      throw RException(R__FAIL("null sink"));
    }
-   fNBytesCommitted += fSink->CommitCluster(fNEntries);
-   fNBytesFilled += fUnzippedClusterSize;
+   if (fModel->IsFrozen()) {
+      throw RException(R__FAIL("the model of a parallel writer must not be frozen"));
+   }
+   fSink->Create(*fModel.get());
+   fMetrics.ObserveMetrics(fSink->GetMetrics());
+}
 
-   // Cap the compression factor at 1000 to prevent overflow of fUnzippedClusterSizeEst
-   const float compressionFactor = std::min(1000.f,
-      static_cast<float>(fNBytesFilled) / static_cast<float>(fNBytesCommitted));
-   fUnzippedClusterSizeEst =
-      compressionFactor * static_cast<float>(fSink->GetWriteOptions().GetApproxZippedClusterSize());
+ROOT::Experimental::RNTupleParallelWriter::~RNTupleParallelWriter()
+{
+   for (const auto &weakContext : fFillContexts) {
+      if (auto context = weakContext.lock())
+         context->CommitCluster();
+   }
+   fSink->CommitClusterGroup();
+   fSink->CommitDataset();
+}
 
-   fLastCommitted = fNEntries;
-   fUnzippedClusterSize = 0;
+std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter>
+ROOT::Experimental::RNTupleParallelWriter::Recreate(std::unique_ptr<RNTupleModel> model, std::string_view ntupleName,
+                                                    std::string_view storage, const RNTupleWriteOptions &options)
+{
+   // The fill contexts buffer their clusters; an additional buffered sink on top of the shared sink is not needed
+   auto unbufferedOptions = options.Clone();
+   unbufferedOptions->SetUseBufferedWrite(false);
+   return std::make_unique<RNTupleParallelWriter>(std::move(model),
+                                                  Detail::RPageSink::Create(ntupleName, storage, *unbufferedOptions));
+}
 
-   if (commitClusterGroup)
-      CommitClusterGroup();
+std::unique_ptr<ROOT::Experimental::RNTupleParallelWriter>
+ROOT::Experimental::RNTupleParallelWriter::Append(std::unique_ptr<RNTupleModel> model, std::string_view ntupleName,
+                                                  TFile &file, const RNTupleWriteOptions &options)
+{
+   auto sink = std::make_unique<Detail::RPageSinkFile>(ntupleName, file, options);
+   return std::make_unique<RNTupleParallelWriter>(std::move(model), std::move(sink));
+}
+
+std::shared_ptr<ROOT::Experimental::RNTupleFillContext> ROOT::Experimental::RNTupleParallelWriter::CreateFillContext()
+{
+   std::lock_guard<std::mutex> guard(fMutex);
+
+   auto syncSink = std::make_unique<RPageSynchronizingSink>(*fSink, fMutex, fNEntries);
+   auto sink = std::make_unique<Detail::RPageSinkBuf>(std::move(syncSink));
+   std::unique_ptr<Detail::RPageStorage::RTaskScheduler> zipTasks = CreateImtTaskScheduler();
+   if (!zipTasks)
+      zipTasks = std::make_unique<RNTupleInlineTaskScheduler>();
+   // The clone is unfrozen and gets its own model id when the fill context freezes it
+   auto context = std::shared_ptr<RNTupleFillContext>(
+      new RNTupleFillContext(fModel->Clone(), std::move(sink), std::move(zipTasks)));
+   fFillContexts.push_back(context);
+   return context;
 }
 
 
@@ -315,6 +315,28 @@ ROOT::Experimental::RNTupleDescriptor::FindPrevClusterId(DescriptorId_t clusterI
    return kInvalidDescriptorId;
 }
 
+std::vector<ROOT::Experimental::DescriptorId_t>
+ROOT::Experimental::RNTupleDescriptor::FindClustersInValueRange(DescriptorId_t fieldId, double min, double max) const
+{
+   const auto columnId = FindColumnId(fieldId, 0);
+
+   std::vector<DescriptorId_t> result;
+   for (const auto &cd : fClusterDescriptors) {
+      const auto &clusterDesc = cd.second;
+      if (columnId != kInvalidDescriptorId && clusterDesc.HasPageLocations() &&
+          clusterDesc.ContainsColumn(columnId)) {
+         const auto &valueRange = clusterDesc.GetColumnRange(columnId).fValueRange;
+         if (valueRange && !valueRange->Overlaps(min, max))
+            continue;
+      }
+      result.emplace_back(clusterDesc.GetId());
+   }
+   std::sort(result.begin(), result.end(), [this](DescriptorId_t a, DescriptorId_t b) {
+      return GetClusterDescriptor(a).GetFirstEntryIndex() < GetClusterDescriptor(b).GetFirstEntryIndex();
+   });
+   return result;
+}
+
 ROOT::Experimental::RResult<void>
 ROOT::Experimental::RNTupleDescriptor::AddClusterDetails(RClusterDescriptor &&clusterDesc)
 {
@@ -416,6 +438,18 @@ ROOT::Experimental::RClusterDescriptorBuilder::CommitColumnRange(
 }
 
 
+ROOT::Experimental::RResult<void>
+ROOT::Experimental::RClusterDescriptorBuilder::SetColumnValueRange(DescriptorId_t columnId,
+                                                               const RClusterDescriptor::RValueRange &valueRange)
+{
+   auto iter = fCluster.fColumnRanges.find(columnId);
+   if (iter == fCluster.fColumnRanges.end())
+      return R__FAIL("value range for uncommitted column range");
+   iter->second.fValueRange = valueRange;
+   return RResult<void>::Success();
+}
+
+
 ROOT::Experimental::RResult<ROOT::Experimental::RClusterDescriptor>
 ROOT::Experimental::RClusterDescriptorBuilder::MoveDescriptor()
 {
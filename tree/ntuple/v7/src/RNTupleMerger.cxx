@@ -13,11 +13,21 @@
  * For the list of contributors see $ROOTSYS/README/CREDITS.             *
  *************************************************************************/
 
+#include <ROOT/RColumnElement.hxx>
 #include <ROOT/RError.hxx>
 #include <ROOT/RNTuple.hxx>
 #include <ROOT/RNTupleDescriptor.hxx>
 #include <ROOT/RNTupleMerger.hxx>
+#include <ROOT/RNTupleModel.hxx>
+#include <ROOT/RNTupleOptions.hxx>
 #include <ROOT/RNTupleUtil.hxx>
+#include <ROOT/RNTupleZip.hxx>
+#include <ROOT/RPageStorage.hxx>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
 
 Long64_t ROOT::Experimental::RNTuple::Merge(TCollection* inputs, TFileMergeInfo* mergeInfo) {
    if (inputs == nullptr || mergeInfo == nullptr) {
@@ -36,3 +46,164 @@ ROOT::Experimental::RFieldMerger::Merge(const ROOT::Experimental::RFieldDescript
    return R__FAIL("couldn't merge field " + lhs.GetFieldName() + " with field "
       + rhs.GetFieldName() + " (unimplemented!)");
 }
+
+////////////////////////////////////////////////////////////////////////////////
+
+
+namespace {
+
+/// Maps every column of the destination to the corresponding column of a source, identified by the qualified name
+/// of its field and its column index. Throws if the source does not have the same columns.
+std::vector<ROOT::Experimental::DescriptorId_t>
+MapColumns(const ROOT::Experimental::RNTupleDescriptor &dstDesc, const ROOT::Experimental::RNTupleDescriptor &srcDesc)
+{
+   using ROOT::Experimental::DescriptorId_t;
+   using ROOT::Experimental::kInvalidDescriptorId;
+   using ROOT::Experimental::RException;
+
+   if (dstDesc.GetNColumns() != srcDesc.GetNColumns())
+      throw RException(R__FAIL("cannot merge ntuples with different number of columns"));
+
+   std::vector<DescriptorId_t> srcColumnIds;
+   for (DescriptorId_t dstColumnId = 0; dstColumnId < dstDesc.GetNColumns(); ++dstColumnId) {
+      const auto &dstColumnDesc = dstDesc.GetColumnDescriptor(dstColumnId);
+      const auto fieldName = dstDesc.GetQualifiedFieldName(dstColumnDesc.GetFieldId());
+      const auto srcFieldId = srcDesc.FindFieldId(fieldName);
+      if (srcFieldId == kInvalidDescriptorId)
+         throw RException(R__FAIL("cannot merge ntuples: missing field " + fieldName));
+      const auto &srcFieldDesc = srcDesc.GetFieldDescriptor(srcFieldId);
+      const auto &dstFieldDesc = dstDesc.GetFieldDescriptor(dstColumnDesc.GetFieldId());
+      if (srcFieldDesc.GetTypeName() != dstFieldDesc.GetTypeName())
+         throw RException(R__FAIL("cannot merge ntuples: type mismatch of field " + fieldName));
+      const auto srcColumnId = srcDesc.FindColumnId(srcFieldId, dstColumnDesc.GetIndex());
+      if (srcColumnId == kInvalidDescriptorId)
+         throw RException(R__FAIL("cannot merge ntuples: missing column of field " + fieldName));
+      if (!(srcDesc.GetColumnDescriptor(srcColumnId).GetModel() == dstColumnDesc.GetModel()))
+         throw RException(R__FAIL("cannot merge ntuples: column type mismatch in field " + fieldName));
+      srcColumnIds.emplace_back(srcColumnId);
+   }
+   return srcColumnIds;
+}
+
+} // anonymous namespace
+
+ROOT::Experimental::RNTupleMerger::RNTupleMerger() = default;
+
+ROOT::Experimental::RNTupleMerger::~RNTupleMerger() = default;
+
+ROOT::Experimental::RNTupleMerger::RMergeInfo
+ROOT::Experimental::RNTupleMerger::Merge(std::span<Detail::RPageSource *> sources, Detail::RPageSink &destination)
+{
+   if (fDestination)
+      throw RException(R__FAIL("cannot merge while an incremental merge is in progress"));
+   try {
+      for (auto source : sources)
+         Append(*source, destination);
+   } catch (const RException &) {
+      fDestination = nullptr;
+      fModel.reset();
+      fMergeInfo = RMergeInfo();
+      throw;
+   }
+   if (!fDestination)
+      throw RException(R__FAIL("no sources to merge"));
+   return Finalize();
+}
+
+void ROOT::Experimental::RNTupleMerger::Append(Detail::RPageSource &source, Detail::RPageSink &destination)
+{
+   if (fDestination && fDestination != &destination)
+      throw RException(R__FAIL("cannot append to another destination before finalizing the merge"));
+
+   const int dstCompression = destination.GetWriteOptions().GetCompression();
+   Detail::RNTupleDecompressor decompressor;
+
+   if (source.GetSharedDescriptorGuard()->GetNFields() == 0)
+      source.Attach();
+   auto srcDesc = source.GetSharedDescriptorGuard()->Clone();
+
+   if (!fDestination) {
+      auto model = srcDesc->GenerateModel();
+      destination.Create(*model);
+      fModel = std::move(model);
+      fDestination = &destination;
+   }
+   const auto &dstDesc = destination.GetDescriptor();
+   const auto srcColumnIds = MapColumns(dstDesc, *srcDesc);
+   const auto nColumns = srcColumnIds.size();
+
+   std::vector<std::unique_ptr<Detail::RColumnElementBase>> elements;
+   for (DescriptorId_t i = 0; i < nColumns; ++i)
+      elements.emplace_back(Detail::RColumnElementBase::Generate(dstDesc.GetColumnDescriptor(i).GetModel().GetType()));
+
+   // Copy the clusters in the order of their entries
+   std::vector<DescriptorId_t> clusterIds;
+   for (const auto &c : srcDesc->GetClusterIterable())
+      clusterIds.emplace_back(c.GetId());
+   std::sort(clusterIds.begin(), clusterIds.end(), [&srcDesc](DescriptorId_t a, DescriptorId_t b) {
+      return srcDesc->GetClusterDescriptor(a).GetFirstEntryIndex() <
+             srcDesc->GetClusterDescriptor(b).GetFirstEntryIndex();
+   });
+   for (auto clusterId : clusterIds) {
+      const auto &clusterDesc = srcDesc->GetClusterDescriptor(clusterId);
+
+      std::vector<Detail::RPageStorage::SealedPageSequence_t> sealedPages(nColumns);
+      std::vector<std::unique_ptr<unsigned char[]>> buffers;
+      std::vector<Detail::RPageStorage::RSealedPageGroup> groups;
+      for (DescriptorId_t dstColumnId = 0; dstColumnId < nColumns; ++dstColumnId) {
+         const auto srcColumnId = srcColumnIds[dstColumnId];
+         if (!clusterDesc.ContainsColumn(srcColumnId))
+            continue;
+         const auto &columnRange = clusterDesc.GetColumnRange(srcColumnId);
+         const bool isSameCompression = (columnRange.fCompressionSettings == dstCompression);
+
+         ClusterSize_t::ValueType firstInPage = 0;
+         for (const auto &pageInfo : clusterDesc.GetPageRange(srcColumnId).fPageInfos) {
+            Detail::RPageStorage::RSealedPage sealedPage;
+            const RClusterIndex clusterIndex(clusterId, firstInPage);
+            source.LoadSealedPage(srcColumnId, clusterIndex, sealedPage);
+            buffers.emplace_back(std::make_unique<unsigned char[]>(sealedPage.fSize));
+            sealedPage.fBuffer = buffers.back().get();
+            source.LoadSealedPage(srcColumnId, clusterIndex, sealedPage);
+
+            if (isSameCompression) {
+               fMergeInfo.fNPagesCopied++;
+            } else {
+               // Pages are recompressed in their packed (on-disk) representation
+               const auto nBytesPacked = elements[dstColumnId]->GetPackedSize(sealedPage.fNElements);
+               auto packed = std::make_unique<unsigned char[]>(nBytesPacked);
+               decompressor.Unzip(sealedPage.fBuffer, sealedPage.fSize, nBytesPacked, packed.get());
+               buffers.back() = std::make_unique<unsigned char[]>(nBytesPacked);
+               sealedPage.fSize = Detail::RNTupleCompressor::Zip(packed.get(), nBytesPacked, dstCompression,
+                                                                 buffers.back().get());
+               sealedPage.fBuffer = buffers.back().get();
+               fMergeInfo.fNPagesRecompressed++;
+            }
+            sealedPages[dstColumnId].emplace_back(std::move(sealedPage));
+            firstInPage += pageInfo.fNElements;
+         }
+         groups.emplace_back(dstColumnId, sealedPages[dstColumnId].cbegin(), sealedPages[dstColumnId].cend());
+         if (columnRange.fValueRange)
+            destination.CommitValueRange(dstColumnId, *columnRange.fValueRange);
+      }
+
+      destination.CommitSealedPageV(groups);
+      fMergeInfo.fNEntries += clusterDesc.GetNEntries();
+      destination.CommitCluster(fMergeInfo.fNEntries);
+      fMergeInfo.fNClusters++;
+   }
+   destination.CommitClusterGroup();
+}
+
+ROOT::Experimental::RNTupleMerger::RMergeInfo ROOT::Experimental::RNTupleMerger::Finalize()
+{
+   if (!fDestination)
+      throw RException(R__FAIL("no sources to merge"));
+   fDestination->CommitDataset();
+
+   auto mergeInfo = fMergeInfo;
+   fDestination = nullptr;
+   fModel.reset();
+   fMergeInfo = RMergeInfo();
+   return mergeInfo;
+}
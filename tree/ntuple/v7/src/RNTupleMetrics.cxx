@@ -15,10 +15,52 @@
 
 #include <ROOT/RNTupleMetrics.hxx>
 
+#include <cctype>
+#include <cmath>
 #include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
 
 #include <iostream>
 
+namespace {
+
+/// Escapes quotes, backslashes, and control characters for use in JSON strings and Prometheus help texts
+std::string EscapeString(const std::string &str)
+{
+   std::string result;
+   result.reserve(str.length());
+   for (auto c : str) {
+      switch (c) {
+      case '"': result += "\\\""; break;
+      case '\\': result += "\\\\"; break;
+      case '\n': result += "\\n"; break;
+      default:
+         if (std::iscntrl(static_cast<unsigned char>(c)))
+            result += ' ';
+         else
+            result += c;
+      }
+   }
+   return result;
+}
+
+/// Integral counters are printed as such, computed counters (RNTupleCalcPerf) as floating point numbers.
+/// Returns an empty string for NaN and infinity.
+std::string FormatValue(const ROOT::Experimental::Detail::RNTuplePerfCounter &counter)
+{
+   if (auto calc = dynamic_cast<const ROOT::Experimental::Detail::RNTupleCalcPerf *>(&counter)) {
+      const auto value = calc->GetValue();
+      if (!std::isfinite(value))
+         return "";
+      return std::to_string(value);
+   }
+   return std::to_string(counter.GetValueAsInt());
+}
+
+} // anonymous namespace
+
 ROOT::Experimental::Detail::RNTuplePerfCounter::~RNTuplePerfCounter()
 {
 }
@@ -91,3 +133,53 @@ void ROOT::Experimental::Detail::RNTupleMetrics::ObserveMetrics(RNTupleMetrics &
 {
    fObservedMetrics.push_back(&observee);
 }
+
+void ROOT::Experimental::Detail::RNTupleMetrics::CollectCounters(
+   const std::string &prefix, std::vector<std::pair<std::string, const RNTuplePerfCounter *>> &counters) const
+{
+   const std::string qualifiedName = prefix + fName + kNamespaceSeperator;
+   for (const auto &c : fCounters)
+      counters.emplace_back(qualifiedName + c->GetName(), c.get());
+   for (const auto m : fObservedMetrics)
+      m->CollectCounters(qualifiedName, counters);
+}
+
+void ROOT::Experimental::Detail::RNTupleMetrics::PrintJSON(std::ostream &output) const
+{
+   std::vector<std::pair<std::string, const RNTuplePerfCounter *>> counters;
+   if (fIsEnabled)
+      CollectCounters("", counters);
+
+   output << "[";
+   for (std::size_t i = 0; i < counters.size(); ++i) {
+      const auto &c = *counters[i].second;
+      const auto value = FormatValue(c);
+      output << ((i == 0) ? "\n" : ",\n");
+      output << "  {\"name\": \"" << EscapeString(counters[i].first) << "\", \"unit\": \"" << EscapeString(c.GetUnit())
+             << "\", \"description\": \"" << EscapeString(c.GetDescription())
+             << "\", \"value\": " << (value.empty() ? "null" : value) << "}";
+   }
+   output << (counters.empty() ? "]" : "\n]");
+}
+
+void ROOT::Experimental::Detail::RNTupleMetrics::PrintPrometheus(std::ostream &output, const std::string &prefix) const
+{
+   if (!fIsEnabled)
+      return;
+
+   std::vector<std::pair<std::string, const RNTuplePerfCounter *>> counters;
+   CollectCounters("", counters);
+   for (const auto &[name, counter] : counters) {
+      std::string metricName = prefix + name;
+      for (auto &c : metricName) {
+         if (!std::isalnum(static_cast<unsigned char>(c)) && c != '_' && c != ':')
+            c = '_';
+      }
+      const auto value = FormatValue(*counter);
+      output << "# HELP " << metricName << " " << EscapeString(counter->GetDescription());
+      if (!counter->GetUnit().empty())
+         output << " [" << counter->GetUnit() << "]";
+      output << "\n# TYPE " << metricName << " gauge\n";
+      output << metricName << " " << (value.empty() ? "NaN" : value) << "\n";
+   }
+}
@@ -64,3 +64,11 @@ void ROOT::Experimental::RNTupleWriteOptions::SetApproxUnzippedPageSize(std::siz
    EnsureValidTunables(fApproxZippedClusterSize, fMaxUnzippedClusterSize, val);
    fApproxUnzippedPageSize = val;
 }
+
+void ROOT::Experimental::RNTupleWriteOptions::SetMaxUnzippedPageSize(std::size_t val)
+{
+   if (val > fMaxUnzippedClusterSize) {
+      throw RException(R__FAIL("maximum page size must not be larger than maximum uncompressed cluster size"));
+   }
+   fMaxUnzippedPageSize = val;
+}
@@ -33,6 +33,21 @@ using RResult = ROOT::Experimental::RResult<T>;
 
 namespace {
 
+/// Doubles are stored as their IEEE 754 bit pattern in a little-endian 64bit unsigned integer
+std::uint64_t DoubleToBits(double val)
+{
+   std::uint64_t bits;
+   std::memcpy(&bits, &val, sizeof(bits));
+   return bits;
+}
+
+double BitsToDouble(std::uint64_t bits)
+{
+   double val;
+   std::memcpy(&val, &bits, sizeof(val));
+   return val;
+}
+
 std::uint32_t SerializeFieldV1(
    const ROOT::Experimental::RFieldDescriptor &fieldDesc, ROOT::Experimental::DescriptorId_t physParentId, void *buffer)
 {
@@ -195,7 +210,7 @@ std::uint32_t SerializeColumnListV1(
          if (c.GetModel().GetIsSorted())
             flags |= RNTupleSerializer::kFlagSortAscColumn;
          // TODO(jblomer): fix for unsigned integer types
-         if (type == ROOT::Experimental::EColumnType::kIndex)
+         if (type == ROOT::Experimental::EColumnType::kIndex || type == ROOT::Experimental::EColumnType::kSplitIndex32)
             flags |= RNTupleSerializer::kFlagNonNegativeColumn;
          pos += RNTupleSerializer::SerializeUInt32(flags, *where);
 
@@ -441,6 +456,18 @@ std::uint16_t ROOT::Experimental::Internal::RNTupleSerializer::SerializeColumnTy
          return SerializeUInt16(0x0C, buffer);
       case EColumnType::kInt8:
          return SerializeUInt16(0x0D, buffer);
+      case EColumnType::kSplitIndex32:
+         return SerializeUInt16(0x0F, buffer);
+      case EColumnType::kSplitReal64:
+         return SerializeUInt16(0x10, buffer);
+      case EColumnType::kSplitReal32:
+         return SerializeUInt16(0x11, buffer);
+      case EColumnType::kSplitInt64:
+         return SerializeUInt16(0x13, buffer);
+      case EColumnType::kSplitInt32:
+         return SerializeUInt16(0x14, buffer);
+      case EColumnType::kSplitInt16:
+         return SerializeUInt16(0x15, buffer);
       default:
          throw RException(R__FAIL("ROOT bug: unexpected column type"));
    }
@@ -490,6 +517,24 @@ RResult<std::uint16_t> ROOT::Experimental::Internal::RNTupleSerializer::Deserial
       case 0x0D:
          type = EColumnType::kInt8;
          break;
+      case 0x0F:
+         type = EColumnType::kSplitIndex32;
+         break;
+      case 0x10:
+         type = EColumnType::kSplitReal64;
+         break;
+      case 0x11:
+         type = EColumnType::kSplitReal32;
+         break;
+      case 0x13:
+         type = EColumnType::kSplitInt64;
+         break;
+      case 0x14:
+         type = EColumnType::kSplitInt32;
+         break;
+      case 0x15:
+         type = EColumnType::kSplitInt16;
+         break;
       default:
          return R__FAIL("unexpected on-disk column type");
    }
@@ -1003,6 +1048,10 @@ std::uint32_t ROOT::Experimental::Internal::RNTupleSerializer::SerializePageList
          }
          pos += SerializeUInt64(columnRange.fFirstElementIndex, *where);
          pos += SerializeUInt32(columnRange.fCompressionSettings, *where);
+         if (columnRange.fValueRange) {
+            pos += SerializeUInt64(DoubleToBits(columnRange.fValueRange->fMin), *where);
+            pos += SerializeUInt64(DoubleToBits(columnRange.fValueRange->fMax), *where);
+         }
 
          pos += SerializeFramePostscript(buffer ? innerFrame : nullptr, pos - innerFrame);
       }
@@ -1395,6 +1444,14 @@ ROOT::Experimental::RResult<void> ROOT::Experimental::Internal::RNTupleSerialize
          bytes += DeserializeUInt32(bytes, compressionSettings);
 
          clusters[i].CommitColumnRange(j, columnOffset, compressionSettings, pageRange);
+         // Optional column statistics
+         if (fnInnerFrameSizeLeft() >= static_cast<int>(2 * sizeof(std::uint64_t))) {
+            std::uint64_t minBits;
+            std::uint64_t maxBits;
+            bytes += DeserializeUInt64(bytes, minBits);
+            bytes += DeserializeUInt64(bytes, maxBits);
+            clusters[i].SetColumnValueRange(j, {BitsToDouble(minBits), BitsToDouble(maxBits)});
+         }
          bytes = innerFrame + innerFrameSize;
       }
 
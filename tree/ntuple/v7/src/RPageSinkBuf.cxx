@@ -28,7 +28,9 @@ ROOT::Experimental::Detail::RPageSinkBuf::RPageSinkBuf(std::unique_ptr<RPageSink
 {
    fCounters = std::unique_ptr<RCounters>(new RCounters{
       *fMetrics.MakeCounter<RNTuplePlainCounter*>("ParallelZip", "",
-         "compressing pages in parallel")
+         "compressing pages in parallel"),
+      *fMetrics.MakeCounter<RNTupleAtomicCounter*>("nZipBackpressure", "",
+         "number of times the writer waited for outstanding page compression tasks")
    });
    fMetrics.ObserveMetrics(fInnerSink->GetMetrics());
 }
@@ -65,12 +67,27 @@ ROOT::Experimental::Detail::RPageSinkBuf::CommitPageImpl(ColumnHandle_t columnHa
    zipItem->AllocateSealedPageBuf();
    R__ASSERT(zipItem->fBuf);
    auto sealedPage = fBufferedColumns.at(columnHandle.fId).RegisterSealedPage();
-   fTaskScheduler->AddTask([this, zipItem, sealedPage, colId = columnHandle.fId] {
+   const auto nBytes = page.GetNBytes();
+   fNBytesUnsealed += nBytes;
+   fTaskScheduler->AddTask([this, zipItem, sealedPage, nBytes, colId = columnHandle.fId] {
       *sealedPage = SealPage(zipItem->fPage, *fBufferedColumns.at(colId).GetHandle().fColumn->GetElement(),
                              GetWriteOptions().GetCompression(), zipItem->fBuf.get());
       zipItem->fSealedPage = &(*sealedPage);
+      // Unless sealing is a no-op, the uncompressed copy of the page is not needed anymore
+      if (sealedPage->fBuffer != zipItem->fPage.GetBuffer()) {
+         ReleasePage(zipItem->fPage);
+         zipItem->fPage = RPage();
+      }
+      fNBytesUnsealed -= nBytes;
    });
 
+   // Back-pressure: don't let the producer run arbitrarily far ahead of the compression tasks
+   const auto maxUnsealed = GetWriteOptions().GetMaxUnsealedPageBytes();
+   if (maxUnsealed > 0 && fNBytesUnsealed > maxUnsealed) {
+      fCounters->fNZipBackpressure.Inc();
+      fTaskScheduler->Wait();
+   }
+
    // we're feeding bad locators to fOpenPageRanges but it should not matter
    // because they never get written out
    return RNTupleLocator{};
@@ -94,20 +111,35 @@ ROOT::Experimental::Detail::RPageSinkBuf::CommitClusterImpl(ROOT::Experimental::
       fTaskScheduler->Reset();
    }
 
-   // If we have only sealed pages in all buffered columns, commit them in a single `CommitSealedPageV()` call
-   bool singleCommitCall = std::all_of(fBufferedColumns.begin(), fBufferedColumns.end(),
-                                       [](auto &bufColumn) { return bufColumn.HasSealedPagesOnly(); });
+   // The inner sink cannot compute the column statistics from sealed pages; forward the ones of the buffered pages
+   for (const auto &columnRange : fOpenColumnRanges) {
+      if (columnRange.fValueRange)
+         fInnerSink->CommitValueRange(columnRange.fColumnId, *columnRange.fValueRange);
+   }
+
+   // If we have only sealed pages in all buffered columns, commit them in a single `CommitSealedPageV()` call.
+   // Columns without any page in this cluster (e.g., the items of only empty collections) do not prevent that.
+   bool singleCommitCall = std::all_of(fBufferedColumns.begin(), fBufferedColumns.end(), [](auto &bufColumn) {
+      return bufColumn.IsEmpty() || bufColumn.HasSealedPagesOnly();
+   });
    if (singleCommitCall) {
       std::vector<RSealedPageGroup> toCommit;
       toCommit.reserve(fBufferedColumns.size());
       for (auto &bufColumn : fBufferedColumns) {
+         if (bufColumn.IsEmpty())
+            continue;
          const auto &sealedPages = bufColumn.GetSealedPages();
          toCommit.emplace_back(bufColumn.GetHandle().fId, sealedPages.cbegin(), sealedPages.cend());
       }
       fInnerSink->CommitSealedPageV(toCommit);
 
-      for (auto &bufColumn : fBufferedColumns)
-         bufColumn.DrainBufferedPages();
+      for (auto &bufColumn : fBufferedColumns) {
+         auto drained = bufColumn.DrainBufferedPages();
+         for (auto &bufPage : std::get<std::deque<RColumnBuf::RPageZipItem>>(drained)) {
+            if (!bufPage.fPage.IsNull())
+               ReleasePage(bufPage.fPage);
+         }
+      }
       return fInnerSink->CommitCluster(nEntries);
    }
 
@@ -128,7 +160,8 @@ ROOT::Experimental::Detail::RPageSinkBuf::CommitClusterImpl(ROOT::Experimental::
          } else {
             fInnerSink->CommitPage(bufColumn.GetHandle(), bufPage.fPage);
          }
-         ReleasePage(bufPage.fPage);
+         if (!bufPage.fPage.IsNull())
+            ReleasePage(bufPage.fPage);
       }
    }
    return fInnerSink->CommitCluster(nEntries);
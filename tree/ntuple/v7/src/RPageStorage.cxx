@@ -31,6 +31,7 @@
 #include <Compression.h>
 #include <TError.h>
 
+#include <chrono>
 #include <utility>
 
 
@@ -139,6 +140,52 @@ std::unique_ptr<unsigned char []> ROOT::Experimental::Detail::RPageSource::Unsea
    return pageBuffer;
 }
 
+std::unique_ptr<unsigned char[]>
+ROOT::Experimental::Detail::RPageSource::UnsealPage(const RSealedPage &sealedPage, const RColumnElementBase &element,
+                                                    DescriptorId_t columnId, DescriptorId_t clusterId)
+{
+   if (!fMetrics.IsEnabled())
+      return UnsealPage(sealedPage, element);
+
+   const auto startTime = std::chrono::steady_clock::now();
+   auto pageBuffer = UnsealPage(sealedPage, element);
+   const auto timeWallUnzip =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - startTime);
+   RecordPageIOStats(columnId, clusterId, sealedPage.fSize, element.GetSize() * sealedPage.fNElements,
+                     timeWallUnzip.count());
+   return pageBuffer;
+}
+
+void ROOT::Experimental::Detail::RPageSource::RecordPageIOStats(DescriptorId_t columnId, DescriptorId_t clusterId,
+                                                                std::uint64_t szRead, std::uint64_t szUnzip,
+                                                                std::uint64_t timeWallUnzip)
+{
+   if (!fMetrics.IsEnabled())
+      return;
+
+   std::lock_guard<std::mutex> guard(fLockIOStats);
+   for (auto stats : {&fColumnIOStats[columnId], &fClusterIOStats[clusterId]}) {
+      stats->fNPages++;
+      stats->fSzRead += szRead;
+      stats->fSzUnzip += szUnzip;
+      stats->fTimeWallUnzip += timeWallUnzip;
+   }
+}
+
+ROOT::Experimental::Detail::RPageSource::IOStatsMap_t
+ROOT::Experimental::Detail::RPageSource::GetColumnIOStats() const
+{
+   std::lock_guard<std::mutex> guard(fLockIOStats);
+   return fColumnIOStats;
+}
+
+ROOT::Experimental::Detail::RPageSource::IOStatsMap_t
+ROOT::Experimental::Detail::RPageSource::GetClusterIOStats() const
+{
+   std::lock_guard<std::mutex> guard(fLockIOStats);
+   return fClusterIOStats;
+}
+
 void ROOT::Experimental::Detail::RPageSource::EnableDefaultMetrics(const std::string &prefix)
 {
    fMetrics = RNTupleMetrics(prefix);
@@ -318,6 +365,14 @@ void ROOT::Experimental::Detail::RPageSink::CommitPage(ColumnHandle_t columnHand
 {
    fOpenColumnRanges.at(columnHandle.fId).fNElements += page.GetNElements();
 
+   if (GetWriteOptions().GetUseColumnStatistics()) {
+      RClusterDescriptor::RValueRange valueRange;
+      if (columnHandle.fColumn->GetElement()->GetValueRange(page.GetBuffer(), page.GetNElements(), valueRange.fMin,
+                                                            valueRange.fMax)) {
+         CommitValueRange(columnHandle.fId, valueRange);
+      }
+   }
+
    RClusterDescriptor::RPageRange::RPageInfo pageInfo;
    pageInfo.fNElements = page.GetNElements();
    pageInfo.fLocator = CommitPageImpl(columnHandle, page);
@@ -365,6 +420,17 @@ void ROOT::Experimental::Detail::RPageSink::CommitSealedPageV(std::span<RPageSto
    }
 }
 
+void ROOT::Experimental::Detail::RPageSink::CommitValueRange(DescriptorId_t columnId,
+                                                             const RClusterDescriptor::RValueRange &valueRange)
+{
+   auto &openValueRange = fOpenColumnRanges.at(columnId).fValueRange;
+   if (openValueRange)
+      openValueRange->Merge(valueRange);
+   else
+      openValueRange = valueRange;
+   CommitValueRangeImpl(columnId, valueRange);
+}
+
 std::uint64_t ROOT::Experimental::Detail::RPageSink::CommitCluster(ROOT::Experimental::NTupleSize_t nEntries)
 {
    auto nbytes = CommitClusterImpl(nEntries);
@@ -373,12 +439,22 @@ std::uint64_t ROOT::Experimental::Detail::RPageSink::CommitCluster(ROOT::Experim
    auto nEntriesInCluster = ClusterSize_t(nEntries - fPrevClusterNEntries);
    RClusterDescriptorBuilder clusterBuilder(fDescriptorBuilder.GetDescriptor().GetNClusters(), fPrevClusterNEntries,
                                             nEntriesInCluster);
+   fLastClusterSizes.resize(fOpenColumnRanges.size());
    for (unsigned int i = 0; i < fOpenColumnRanges.size(); ++i) {
       RClusterDescriptor::RPageRange fullRange;
       fullRange.fColumnId = i;
       std::swap(fullRange, fOpenPageRanges[i]);
+      fLastClusterSizes[i] = RColumnClusterSize();
+      for (const auto &pageInfo : fullRange.fPageInfos) {
+         fLastClusterSizes[i].fNElements += pageInfo.fNElements;
+         fLastClusterSizes[i].fNBytesOnStorage += pageInfo.fLocator.fBytesOnStorage;
+      }
       clusterBuilder.CommitColumnRange(i, fOpenColumnRanges[i].fFirstElementIndex,
                                        fOpenColumnRanges[i].fCompressionSettings, fullRange);
+      if (fOpenColumnRanges[i].fValueRange) {
+         clusterBuilder.SetColumnValueRange(i, *fOpenColumnRanges[i].fValueRange);
+         fOpenColumnRanges[i].fValueRange.reset();
+      }
       fOpenColumnRanges[i].fFirstElementIndex += fOpenColumnRanges[i].fNElements;
       fOpenColumnRanges[i].fNElements = 0;
    }
@@ -387,6 +463,14 @@ std::uint64_t ROOT::Experimental::Detail::RPageSink::CommitCluster(ROOT::Experim
    return nbytes;
 }
 
+ROOT::Experimental::Detail::RPageSink::RColumnClusterSize
+ROOT::Experimental::Detail::RPageSink::GetLastClusterSize(DescriptorId_t columnId) const
+{
+   if (columnId >= fLastClusterSizes.size())
+      return RColumnClusterSize();
+   return fLastClusterSizes[columnId];
+}
+
 void ROOT::Experimental::Detail::RPageSink::CommitClusterGroup()
 {
    const auto &descriptor = fDescriptorBuilder.GetDescriptor();
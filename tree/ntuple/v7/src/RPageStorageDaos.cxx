@@ -371,7 +371,8 @@ ROOT::Experimental::Detail::RPageSourceDaos::RPageSourceDaos(std::string_view nt
                                                              const RNTupleReadOptions &options)
    : RPageSource(ntupleName, options), fPageAllocator(std::make_unique<RPageAllocatorDaos>()),
      fPagePool(std::make_shared<RPagePool>()), fURI(uri),
-     fClusterPool(std::make_unique<RClusterPool>(*this, options.GetClusterBunchSize()))
+     fClusterPool(std::make_unique<RClusterPool>(*this, options.GetClusterBunchSize(),
+                                                 options.GetClusterBunchesInFlight()))
 {
    fDecompressor = std::make_unique<RNTupleDecompressor>();
    EnableDefaultMetrics("RPageSourceDaos");
@@ -508,7 +509,8 @@ ROOT::Experimental::Detail::RPageSourceDaos::PopulatePageFromCluster(ColumnHandl
    std::unique_ptr<unsigned char []> pageBuffer;
    {
       RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
-      pageBuffer = UnsealPage({sealedPageBuffer, bytesOnStorage, pageInfo.fNElements}, *element);
+      pageBuffer =
+         UnsealPage({sealedPageBuffer, bytesOnStorage, pageInfo.fNElements}, *element, columnId, clusterId);
       fCounters->fSzUnzip.Add(elementSize * pageInfo.fNElements);
    }
 
@@ -584,6 +586,11 @@ std::unique_ptr<ROOT::Experimental::Detail::RPageSource> ROOT::Experimental::Det
    return std::unique_ptr<RPageSourceDaos>(clone);
 }
 
+std::string ROOT::Experimental::Detail::RPageSourceDaos::GetStorageIdentifier() const
+{
+   return fURI + "#" + fNTupleName;
+}
+
 std::vector<std::unique_ptr<ROOT::Experimental::Detail::RCluster>>
 ROOT::Experimental::Detail::RPageSourceDaos::LoadClusters(std::span<RCluster::RKey> clusterKeys)
 {
@@ -712,7 +719,8 @@ void ROOT::Experimental::Detail::RPageSourceDaos::UnzipClusterImpl(RCluster *clu
              nElements = pi.fNElements,
              indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex
             ] () {
-               auto pageBuffer = UnsealPage({onDiskPage->GetAddress(), onDiskPage->GetSize(), nElements}, *element);
+               auto pageBuffer = UnsealPage({onDiskPage->GetAddress(), onDiskPage->GetSize(), nElements}, *element,
+                                             columnId, clusterId);
                fCounters->fSzUnzip.Add(element->GetSize() * nElements);
 
                auto newPage = fPageAllocator->NewPage(columnId, pageBuffer.release(), element->GetSize(), nElements);
@@ -31,9 +31,13 @@
 #include <TError.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
+#include <limits>
+#include <stdexcept>
 #include <utility>
 
 #include <atomic>
@@ -215,7 +219,8 @@ ROOT::Experimental::Detail::RPageSourceFile::RPageSourceFile(std::string_view nt
    : RPageSource(ntupleName, options)
    , fPageAllocator(std::make_unique<RPageAllocatorFile>())
    , fPagePool(std::make_shared<RPagePool>())
-   , fClusterPool(std::make_unique<RClusterPool>(*this, options.GetClusterBunchSize()))
+   , fClusterPool(
+        std::make_unique<RClusterPool>(*this, options.GetClusterBunchSize(), options.GetClusterBunchesInFlight()))
 {
    fDecompressor = std::make_unique<RNTupleDecompressor>();
    EnableDefaultMetrics("RPageSourceFile");
@@ -226,7 +231,9 @@ ROOT::Experimental::Detail::RPageSourceFile::RPageSourceFile(std::string_view nt
    const RNTupleReadOptions &options)
    : RPageSourceFile(ntupleName, options)
 {
-   fFile = ROOT::Internal::RRawFile::Create(path);
+   ROOT::Internal::RRawFile::ROptions rawFileOptions;
+   rawFileOptions.fUseIoUring = options.GetUseIoUring();
+   fFile = ROOT::Internal::RRawFile::Create(path, rawFileOptions);
    R__ASSERT(fFile);
    fReader = Internal::RMiniFileReader(fFile.get());
 }
@@ -258,7 +265,34 @@ ROOT::Experimental::Detail::RPageSourceFile::CreateFromAnchor(const Internal::RF
    return pageSource;
 }
 
-ROOT::Experimental::Detail::RPageSourceFile::~RPageSourceFile() = default;
+ROOT::Experimental::Detail::RPageSourceFile::~RPageSourceFile()
+{
+   if (fMappedFile)
+      fFile->Unmap(const_cast<unsigned char *>(fMappedFile), fMappedFileSize);
+}
+
+
+void ROOT::Experimental::Detail::RPageSourceFile::MapFile()
+{
+   if (!fOptions.GetUseMmap() || fMappedFile)
+      return;
+   if (!(fFile->GetFeatures() & ROOT::Internal::RRawFile::kFeatureHasMmap))
+      return;
+
+   // Mapping may fail, e.g. if the file does not fit into the address space. Then we fall back to reading.
+   try {
+      const auto fileSize = fFile->GetSize();
+      if (fileSize == 0 || fileSize > std::numeric_limits<std::size_t>::max())
+         return;
+      std::uint64_t mapdOffset;
+      auto region = fFile->Map(fileSize, 0, mapdOffset);
+      R__ASSERT(mapdOffset == 0);
+      fMappedFile = reinterpret_cast<const unsigned char *>(region);
+      fMappedFileSize = fileSize;
+   } catch (const std::runtime_error &err) {
+      R__LOG_WARNING(NTupleLog()) << "memory mapping failed, falling back to regular reads: " << err.what();
+   }
+}
 
 
 ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceFile::AttachImpl()
@@ -287,6 +321,7 @@ ROOT::Experimental::RNTupleDescriptor ROOT::Experimental::Detail::RPageSourceFil
       }
    }
 
+   MapFile();
    return ntplDesc;
 }
 
@@ -306,8 +341,59 @@ void ROOT::Experimental::Detail::RPageSourceFile::LoadSealedPage(
    const auto bytesOnStorage = pageInfo.fLocator.fBytesOnStorage;
    sealedPage.fSize = bytesOnStorage;
    sealedPage.fNElements = pageInfo.fNElements;
-   if (sealedPage.fBuffer)
+   if (!sealedPage.fBuffer)
+      return;
+   if (fMappedFile) {
+      memcpy(const_cast<void *>(sealedPage.fBuffer), fMappedFile + pageInfo.fLocator.fPosition, bytesOnStorage);
+   } else {
       fReader.ReadBuffer(const_cast<void *>(sealedPage.fBuffer), bytesOnStorage, pageInfo.fLocator.fPosition);
+   }
+}
+
+ROOT::Experimental::Detail::RPage
+ROOT::Experimental::Detail::RPageSourceFile::PopulatePageFromMappedFile(ColumnHandle_t columnHandle,
+                                                                        const RClusterInfo &clusterInfo)
+{
+   const auto columnId = columnHandle.fId;
+   const auto clusterId = clusterInfo.fClusterId;
+   const auto &pageInfo = clusterInfo.fPageInfo;
+
+   const auto element = columnHandle.fColumn->GetElement();
+   const auto elementSize = element->GetSize();
+   const auto bytesOnStorage = pageInfo.fLocator.fBytesOnStorage;
+   R__ASSERT(pageInfo.fLocator.fPosition + bytesOnStorage <= fMappedFileSize);
+   const unsigned char *sealedPageBuffer = fMappedFile + pageInfo.fLocator.fPosition;
+
+   // Uncompressed pages of mappable columns are used in place, provided that the elements are properly aligned
+   const bool isZeroCopy = element->IsMappable() && (bytesOnStorage == elementSize * pageInfo.fNElements) &&
+                           (reinterpret_cast<std::uintptr_t>(sealedPageBuffer) % elementSize == 0);
+
+   void *pageBuffer;
+   if (isZeroCopy) {
+      pageBuffer = const_cast<unsigned char *>(sealedPageBuffer);
+      RecordPageIOStats(columnId, clusterId, bytesOnStorage, bytesOnStorage, 0 /* timeWallUnzip */);
+   } else {
+      RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
+      pageBuffer =
+         UnsealPage({sealedPageBuffer, bytesOnStorage, pageInfo.fNElements}, *element, columnId, clusterId).release();
+      fCounters->fSzUnzip.Add(elementSize * pageInfo.fNElements);
+   }
+   fCounters->fNPageLoaded.Inc();
+   fCounters->fSzReadPayload.Add(bytesOnStorage);
+
+   auto newPage = fPageAllocator->NewPage(columnId, pageBuffer, elementSize, pageInfo.fNElements);
+   newPage.SetWindow(clusterInfo.fColumnOffset + pageInfo.fFirstInPage,
+                     RPage::RClusterInfo(clusterId, clusterInfo.fColumnOffset));
+   if (isZeroCopy) {
+      // The memory is owned by the mapping, which is released when the page source is destructed
+      fPagePool->RegisterPage(newPage, RPageDeleter([](const RPage & /*page*/, void * /*userData*/) {}, nullptr));
+   } else {
+      fPagePool->RegisterPage(newPage, RPageDeleter([](const RPage &page, void * /*userData*/) {
+                                 RPageAllocatorFile::DeletePage(page);
+                              }, nullptr));
+   }
+   fCounters->fNPagePopulated.Inc();
+   return newPage;
 }
 
 ROOT::Experimental::Detail::RPage
@@ -315,6 +401,9 @@ ROOT::Experimental::Detail::RPageSourceFile::PopulatePageFromCluster(ColumnHandl
                                                                      const RClusterInfo &clusterInfo,
                                                                      ClusterSize_t::ValueType idxInCluster)
 {
+   if (fMappedFile)
+      return PopulatePageFromMappedFile(columnHandle, clusterInfo);
+
    const auto columnId = columnHandle.fId;
    const auto clusterId = clusterInfo.fClusterId;
    const auto pageInfo = clusterInfo.fPageInfo;
@@ -351,7 +440,8 @@ ROOT::Experimental::Detail::RPageSourceFile::PopulatePageFromCluster(ColumnHandl
    std::unique_ptr<unsigned char []> pageBuffer;
    {
       RNTupleAtomicTimer timer(fCounters->fTimeWallUnzip, fCounters->fTimeCpuUnzip);
-      pageBuffer = UnsealPage({sealedPageBuffer, bytesOnStorage, pageInfo.fNElements}, *element);
+      pageBuffer =
+         UnsealPage({sealedPageBuffer, bytesOnStorage, pageInfo.fNElements}, *element, columnId, clusterId);
       fCounters->fSzUnzip.Add(elementSize * pageInfo.fNElements);
    }
 
@@ -430,6 +520,11 @@ std::unique_ptr<ROOT::Experimental::Detail::RPageSource> ROOT::Experimental::Det
    return std::unique_ptr<RPageSourceFile>(clone);
 }
 
+std::string ROOT::Experimental::Detail::RPageSourceFile::GetStorageIdentifier() const
+{
+   return fFile->GetUrl() + "#" + fNTupleName;
+}
+
 std::unique_ptr<ROOT::Experimental::Detail::RCluster>
 ROOT::Experimental::Detail::RPageSourceFile::PrepareSingleCluster(
    const RCluster::RKey &clusterKey,
@@ -474,23 +569,27 @@ ROOT::Experimental::Detail::RPageSourceFile::PrepareSingleCluster(
    // of extra bytes.
    // TODO(jblomer): Eventually we may want to select the parameter at runtime according to link latency and speed,
    // memory consumption, device block size.
-   float maxOverhead = 0.25 * float(activeSize);
-   std::vector<std::size_t> gaps;
-   for (unsigned i = 1; i < onDiskPages.size(); ++i) {
-      gaps.emplace_back(onDiskPages[i].fOffset - (onDiskPages[i-1].fSize + onDiskPages[i-1].fOffset));
-   }
-   std::sort(gaps.begin(), gaps.end());
-   std::size_t gapCut = 0;
-   std::size_t currentGap = 0;
-   float szExtra = 0.0;
-   for (auto g : gaps) {
-      if (g != currentGap) {
-         gapCut = currentGap;
-         currentGap = g;
+   // The cutoff can also be fixed by the read options, e.g. to tune for high-latency remote storage.
+   std::uint64_t gapCut = fOptions.GetMaxCoalesceGap();
+   if (gapCut == RNTupleReadOptions::kAutoCoalesceGap) {
+      float maxOverhead = 0.25 * float(activeSize);
+      std::vector<std::size_t> gaps;
+      for (unsigned i = 1; i < onDiskPages.size(); ++i) {
+         gaps.emplace_back(onDiskPages[i].fOffset - (onDiskPages[i-1].fSize + onDiskPages[i-1].fOffset));
+      }
+      std::sort(gaps.begin(), gaps.end());
+      gapCut = 0;
+      std::size_t currentGap = 0;
+      float szExtra = 0.0;
+      for (auto g : gaps) {
+         if (g != currentGap) {
+            gapCut = currentGap;
+            currentGap = g;
+         }
+         szExtra += g;
+         if (szExtra  > maxOverhead)
+            break;
       }
-      szExtra += g;
-      if (szExtra  > maxOverhead)
-         break;
    }
 
    // In a first step, we coalesce the read requests and calculate the cluster buffer size.
@@ -603,7 +702,8 @@ void ROOT::Experimental::Detail::RPageSourceFile::UnzipClusterImpl(RCluster *clu
              nElements = pi.fNElements,
              indexOffset = clusterDescriptor.GetColumnRange(columnId).fFirstElementIndex
             ] () {
-               auto pageBuffer = UnsealPage({onDiskPage->GetAddress(), onDiskPage->GetSize(), nElements}, *element);
+               auto pageBuffer = UnsealPage({onDiskPage->GetAddress(), onDiskPage->GetSize(), nElements}, *element,
+                                             columnId, clusterId);
                fCounters->fSzUnzip.Add(element->GetSize() * nElements);
 
                auto newPage = fPageAllocator->NewPage(columnId, pageBuffer.release(), element->GetSize(), nElements);
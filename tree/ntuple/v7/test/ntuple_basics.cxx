@@ -639,3 +639,96 @@ TEST(RNTuple, BareEntry)
    ntuple->LoadEntry(1);
    EXPECT_EQ(2.0, *ntuple->GetModel()->GetDefaultEntry()->Get<float>("pt"));
 }
+
+TEST(RNTuple, ColumnStatistics)
+{
+   for (bool useBufferedWrite : {true, false}) {
+      FileRaii fileGuard("test_ntuple_column_statistics.root");
+
+      auto model = RNTupleModel::Create();
+      auto wrPt = model->MakeField<float>("pt");
+      auto wrRun = model->MakeField<std::uint64_t>("run");
+      auto wrJets = model->MakeField<std::vector<float>>("jets");
+      auto wrTag = model->MakeField<std::string>("tag");
+      {
+         RNTupleWriteOptions options;
+         options.SetUseBufferedWrite(useBufferedWrite);
+         options.SetUseColumnStatistics(true);
+         auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), options);
+         for (int c = 0; c < 10; ++c) {
+            for (int i = 0; i < 10; ++i) {
+               *wrPt = 10 * c + i;
+               *wrRun = (c == 9) ? std::numeric_limits<std::uint64_t>::max() : c;
+               *wrJets = std::vector<float>(i % 2, -static_cast<float>(c));
+               *wrTag = "abc";
+               writer->Fill();
+            }
+            writer->CommitCluster();
+         }
+      }
+
+      auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+      const auto *desc = reader->GetDescriptor();
+      ASSERT_EQ(10U, desc->GetNClusters());
+      const auto ptId = desc->FindFieldId("pt");
+      const auto ptColumnId = desc->FindColumnId(ptId, 0);
+      const auto runColumnId = desc->FindColumnId(desc->FindFieldId("run"), 0);
+      const auto jetsId = desc->FindFieldId("jets");
+      const auto jetsOffsetColumnId = desc->FindColumnId(jetsId, 0);
+      const auto jetsItemId = desc->FindFieldId("_0", jetsId);
+      const auto jetsItemColumnId = desc->FindColumnId(jetsItemId, 0);
+      const auto tagCharColumnId = desc->FindColumnId(desc->FindFieldId("tag"), 1);
+      for (unsigned c = 0; c < 10; ++c) {
+         const auto &clusterDesc = desc->GetClusterDescriptor(desc->FindClusterId(ptColumnId, 10 * c));
+         const auto &ptRange = clusterDesc.GetColumnRange(ptColumnId).fValueRange;
+         ASSERT_TRUE(ptRange);
+         EXPECT_EQ(10. * c, ptRange->fMin);
+         EXPECT_EQ(10. * c + 9, ptRange->fMax);
+         const auto &runRange = clusterDesc.GetColumnRange(runColumnId).fValueRange;
+         ASSERT_TRUE(runRange);
+         if (c == 9) {
+            // Not exactly representable as double: rounded outwards
+            EXPECT_LE(static_cast<double>(std::numeric_limits<std::uint64_t>::max()), runRange->fMax);
+         } else {
+            EXPECT_EQ(c, runRange->fMin);
+            EXPECT_EQ(c, runRange->fMax);
+         }
+         const auto &jetsRange = clusterDesc.GetColumnRange(jetsItemColumnId).fValueRange;
+         ASSERT_TRUE(jetsRange);
+         EXPECT_EQ(-1. * c, jetsRange->fMin);
+         EXPECT_FALSE(clusterDesc.GetColumnRange(jetsOffsetColumnId).fValueRange);
+         EXPECT_FALSE(clusterDesc.GetColumnRange(tagCharColumnId).fValueRange);
+      }
+
+      auto clusterIds = desc->FindClustersInValueRange(ptId, 25, 34);
+      ASSERT_EQ(2U, clusterIds.size());
+      EXPECT_EQ(20U, desc->GetClusterDescriptor(clusterIds[0]).GetFirstEntryIndex());
+      EXPECT_EQ(30U, desc->GetClusterDescriptor(clusterIds[1]).GetFirstEntryIndex());
+      EXPECT_TRUE(desc->FindClustersInValueRange(ptId, -10, -1).empty());
+      EXPECT_EQ(10U, desc->FindClustersInValueRange(desc->FindFieldId("tag"), 0, 0).size());
+   }
+}
+
+TEST(RNTuple, NoColumnStatistics)
+{
+   FileRaii fileGuard("test_ntuple_no_column_statistics.root");
+
+   auto model = RNTupleModel::Create();
+   auto wrPt = model->MakeField<float>("pt");
+   {
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      for (int i = 0; i < 10; ++i) {
+         *wrPt = i;
+         writer->Fill();
+         writer->CommitCluster();
+      }
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   const auto *desc = reader->GetDescriptor();
+   const auto ptId = desc->FindFieldId("pt");
+   for (const auto &clusterDesc : desc->GetClusterIterable())
+      EXPECT_FALSE(clusterDesc.GetColumnRange(desc->FindColumnId(ptId, 0)).fValueRange);
+   // Without statistics, no cluster can be excluded
+   EXPECT_EQ(10U, desc->FindClustersInValueRange(ptId, 100, 200).size());
+}
@@ -1,6 +1,7 @@
 #include "gtest/gtest.h"
 
 #include <ROOT/RCluster.hxx>
+#include <ROOT/RClusterCache.hxx>
 #include <ROOT/RClusterPool.hxx>
 #include <ROOT/RColumn.hxx>
 #include <ROOT/RColumnModel.hxx>
@@ -21,6 +22,7 @@
 
 using ClusterSize_t = ROOT::Experimental::ClusterSize_t;
 using RCluster = ROOT::Experimental::Detail::RCluster;
+using RClusterCache = ROOT::Experimental::Detail::RClusterCache;
 using RClusterPool = ROOT::Experimental::Detail::RClusterPool;
 using RNTupleDescriptor = ROOT::Experimental::RNTupleDescriptor;
 using ROnDiskPage = ROOT::Experimental::Detail::ROnDiskPage;
@@ -56,7 +58,13 @@ public:
    std::vector<ROOT::Experimental::DescriptorId_t> fReqsClusterIds;
    std::vector<ROOT::Experimental::Detail::RCluster::ColumnSet_t> fReqsColumns;
 
-   RPageSourceMock() : RPageSource("test", ROOT::Experimental::RNTupleReadOptions()) {
+   /// The storage identifier reported to the cluster pool; empty by default and thus not using the shared cache
+   std::string fStorageId;
+
+   explicit RPageSourceMock(const ROOT::Experimental::RNTupleReadOptions &options =
+                               ROOT::Experimental::RNTupleReadOptions())
+      : RPageSource("test", options)
+   {
       ROOT::Experimental::RNTupleDescriptorBuilder descBuilder;
       for (unsigned i = 0; i <= 5; ++i) {
          descBuilder.AddClusterSummary(i, i, 1);
@@ -69,6 +77,7 @@ public:
       }
    }
    std::unique_ptr<RPageSource> Clone() const final { return nullptr; }
+   std::string GetStorageIdentifier() const final { return fStorageId; }
    RPage PopulatePage(ColumnHandle_t, ROOT::Experimental::NTupleSize_t) final { return RPage(); }
    RPage PopulatePage(ColumnHandle_t, const ROOT::Experimental::RClusterIndex &) final { return RPage(); }
    void ReleasePage(RPage &) final {}
@@ -281,6 +290,130 @@ TEST(ClusterPool, GetClusterIncrementally)
 }
 
 
+TEST(ClusterCache, Basics)
+{
+   auto memory = new unsigned char[8];
+   auto pageMap = std::make_unique<ROOT::Experimental::Detail::ROnDiskPageMapHeap>(
+      std::unique_ptr<unsigned char []>(memory));
+   pageMap->Register(ROnDiskPage::Key(5, 0), ROnDiskPage(&memory[0], 4));
+   pageMap->Register(ROnDiskPage::Key(6, 0), ROnDiskPage(&memory[4], 4));
+   auto cluster = std::make_unique<RCluster>(1);
+   cluster->Adopt(std::move(pageMap));
+   cluster->SetColumnAvailable(5);
+   cluster->SetColumnAvailable(6);
+   EXPECT_EQ(8U, cluster->GetNBytesOnDisk());
+
+   RClusterCache cache(10);
+   auto view = cache.Put("file", std::move(cluster));
+   EXPECT_EQ(1U, view->GetId());
+   EXPECT_EQ(&memory[4], view->GetOnDiskPage(ROnDiskPage::Key(6, 0))->GetAddress());
+   EXPECT_EQ(8U, cache.GetNBytes());
+   EXPECT_EQ(1U, cache.GetNClusters());
+
+   EXPECT_EQ(nullptr, cache.Get("other", 1, {5}));
+   EXPECT_EQ(nullptr, cache.Get("file", 0, {5}));
+   EXPECT_EQ(nullptr, cache.Get("file", 1, {5, 7}));
+   auto hit = cache.Get("file", 1, {5});
+   ASSERT_NE(nullptr, hit);
+   EXPECT_TRUE(hit->ContainsColumn(6));
+   EXPECT_EQ(&memory[0], hit->GetOnDiskPage(ROnDiskPage::Key(5, 0))->GetAddress());
+   EXPECT_EQ(1U, cache.GetNHits());
+   EXPECT_EQ(3U, cache.GetNMisses());
+
+   // Views remain valid after the cluster is evicted
+   memory = new unsigned char[4];
+   pageMap = std::make_unique<ROOT::Experimental::Detail::ROnDiskPageMapHeap>(
+      std::unique_ptr<unsigned char []>(memory));
+   pageMap->Register(ROnDiskPage::Key(5, 0), ROnDiskPage(&memory[0], 4));
+   cluster = std::make_unique<RCluster>(2);
+   cluster->Adopt(std::move(pageMap));
+   cluster->SetColumnAvailable(5);
+   cache.Put("file", std::move(cluster));
+   EXPECT_EQ(4U, cache.GetNBytes());
+   EXPECT_EQ(1U, cache.GetNClusters());
+   EXPECT_EQ(nullptr, cache.Get("file", 1, {5}));
+   EXPECT_EQ(4U, hit->GetOnDiskPage(ROnDiskPage::Key(5, 0))->GetSize());
+
+   // Clusters larger than the cache are not cached
+   cluster = std::make_unique<RCluster>(3);
+   pageMap = std::make_unique<ROOT::Experimental::Detail::ROnDiskPageMapHeap>(std::make_unique<unsigned char []>(16));
+   pageMap->Register(ROnDiskPage::Key(5, 0), ROnDiskPage(nullptr, 16));
+   cluster->Adopt(std::move(pageMap));
+   cluster->SetColumnAvailable(5);
+   view = cache.Put("file", std::move(cluster));
+   EXPECT_EQ(3U, view->GetId());
+   EXPECT_EQ(1U, cache.GetNClusters());
+
+   cache.Clear();
+   EXPECT_EQ(0U, cache.GetNBytes());
+   EXPECT_EQ(0U, cache.GetNClusters());
+}
+
+
+TEST(ClusterPool, GetClusterBunchesInFlight)
+{
+   RPageSourceMock p1;
+   {
+      RClusterPool c1(p1, 1, 3);
+      c1.GetCluster(0, {0});
+      c1.WaitForInFlightClusters();
+   }
+   ASSERT_EQ(3U, p1.fReqsClusterIds.size());
+   EXPECT_EQ(0U, p1.fReqsClusterIds[0]);
+   EXPECT_EQ(1U, p1.fReqsClusterIds[1]);
+   EXPECT_EQ(2U, p1.fReqsClusterIds[2]);
+
+   RPageSourceMock p2;
+   {
+      RClusterPool c2(p2, 2, 3);
+      c2.GetCluster(0, {0});
+      c2.WaitForInFlightClusters();
+   }
+   ASSERT_EQ(6U, p2.fReqsClusterIds.size());
+   for (unsigned i = 0; i < 6; ++i)
+      EXPECT_EQ(i, p2.fReqsClusterIds[i]);
+}
+
+
+TEST(ClusterPool, SharedCache)
+{
+   RClusterCache::GetGlobal().Clear();
+
+   ROOT::Experimental::RNTupleReadOptions options;
+   options.SetUseSharedClusterCache(true);
+   RPageSourceMock p1(options);
+   p1.fStorageId = "mock";
+   {
+      RClusterPool c1(p1, 1);
+      c1.GetCluster(3, {0, 1});
+      c1.WaitForInFlightClusters();
+   }
+   ASSERT_EQ(2U, p1.fReqsClusterIds.size());
+
+   // A second page source of the same storage container finds the clusters in the shared cache
+   RPageSourceMock p2(options);
+   p2.fStorageId = "mock";
+   {
+      RClusterPool c2(p2, 1);
+      auto cluster = c2.GetCluster(3, {0});
+      EXPECT_TRUE(cluster->ContainsColumn(1));
+      c2.WaitForInFlightClusters();
+   }
+   EXPECT_EQ(0U, p2.fReqsClusterIds.size());
+
+   // Without a storage identifier, the shared cache is not used
+   RPageSourceMock p3(options);
+   {
+      RClusterPool c3(p3, 1);
+      c3.GetCluster(3, {0});
+      c3.WaitForInFlightClusters();
+   }
+   EXPECT_EQ(2U, p3.fReqsClusterIds.size());
+
+   RClusterCache::GetGlobal().Clear();
+}
+
+
 TEST(PageStorageFile, LoadClusters)
 {
    FileRaii fileGuard("test_pagestoragefile_loadclusters.root");
@@ -341,3 +474,46 @@ TEST(PageStorageFile, LoadClusters)
    EXPECT_EQ(1U, clusters[1]->GetId());
    EXPECT_EQ(1U, clusters[1]->GetNOnDiskPages());
 }
+
+
+TEST(PageStorageFile, CoalesceGap)
+{
+   FileRaii fileGuard("test_pagestoragefile_coalescegap.root");
+
+   auto modelWrite = ROOT::Experimental::RNTupleModel::Create();
+   auto wrA = modelWrite->MakeField<float>("a", 1.0);
+   auto wrB = modelWrite->MakeField<float>("b", 2.0);
+   auto wrC = modelWrite->MakeField<float>("c", 3.0);
+   {
+      // Without buffering, the pages of a, b, and c are written in this order
+      ROOT::Experimental::RNTupleWriter ntuple(
+         std::move(modelWrite), std::make_unique<ROOT::Experimental::Detail::RPageSinkFile>(
+            "myNTuple", fileGuard.GetPath(), ROOT::Experimental::RNTupleWriteOptions()));
+      for (unsigned i = 0; i < 100; ++i)
+         ntuple.Fill();
+   }
+
+   // Returns the number of read requests necessary to load the pages of a and c, skipping the page of b
+   auto fnCountReadRequests = [&fileGuard](std::uint64_t maxGap) {
+      ROOT::Experimental::RNTupleReadOptions options;
+      options.SetMaxCoalesceGap(maxGap);
+      ROOT::Experimental::Detail::RPageSourceFile source("myNTuple", fileGuard.GetPath(), options);
+      source.Attach();
+      source.GetMetrics().Enable();
+
+      std::vector<ROOT::Experimental::Detail::RCluster::RKey> clusterKeys(1);
+      clusterKeys[0].fClusterId = 0;
+      {
+         auto descriptorGuard = source.GetSharedDescriptorGuard();
+         clusterKeys[0].fColumnSet.insert(descriptorGuard->FindColumnId(descriptorGuard->FindFieldId("a"), 0));
+         clusterKeys[0].fColumnSet.insert(descriptorGuard->FindColumnId(descriptorGuard->FindFieldId("c"), 0));
+      }
+      auto cluster = std::move(source.LoadClusters(clusterKeys)[0]);
+      EXPECT_EQ(2U, cluster->GetNOnDiskPages());
+      return source.GetMetrics().GetCounter("RPageSourceFile.nRead")->GetValueAsInt();
+   };
+
+   EXPECT_EQ(2, fnCountReadRequests(0));
+   EXPECT_EQ(2, fnCountReadRequests(ROOT::Experimental::RNTupleReadOptions::kAutoCoalesceGap));
+   EXPECT_EQ(1, fnCountReadRequests(1024 * 1024));
+}
@@ -80,3 +80,141 @@ TEST(RFieldMerger, Merge)
    auto mergeResult = RFieldMerger::Merge(RFieldDescriptor(), RFieldDescriptor());
    EXPECT_FALSE(mergeResult);
 }
+
+TEST(RNTupleMerger, Merge)
+{
+   FileRaii fileGuard1("test_ntuple_merge_in_1.root");
+   FileRaii fileGuard2("test_ntuple_merge_in_2.root");
+   FileRaii fileGuard3("test_ntuple_merge_out.root");
+
+   // The first input shares the compression settings of the output, the second one does not
+   RNTupleWriteOptions optionsCopy;
+   optionsCopy.SetCompression(505);
+   RNTupleWriteOptions optionsOther;
+   optionsOther.SetCompression(101);
+   {
+      auto model = RNTupleModel::Create();
+      auto fieldPt = model->MakeField<float>("pt");
+      auto fieldVec = model->MakeField<std::vector<float>>("vec");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard1.GetPath(), optionsCopy);
+      for (int i = 0; i < 10; ++i) {
+         *fieldPt = i;
+         fieldVec->assign(i, 1.0);
+         ntuple->Fill();
+         if (i == 4)
+            ntuple->CommitCluster();
+      }
+   }
+   {
+      auto model = RNTupleModel::Create();
+      auto fieldPt = model->MakeField<float>("pt");
+      auto fieldVec = model->MakeField<std::vector<float>>("vec");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard2.GetPath(), optionsOther);
+      for (int i = 10; i < 15; ++i) {
+         *fieldPt = i;
+         fieldVec->assign(i, 2.0);
+         ntuple->Fill();
+      }
+   }
+
+   {
+      auto source1 = std::make_unique<RPageSourceFile>("ntuple", fileGuard1.GetPath(), RNTupleReadOptions());
+      auto source2 = std::make_unique<RPageSourceFile>("ntuple", fileGuard2.GetPath(), RNTupleReadOptions());
+      std::vector<ROOT::Experimental::Detail::RPageSource *> sources{source1.get(), source2.get()};
+      auto destination = std::make_unique<RPageSinkFile>("ntuple", fileGuard3.GetPath(), optionsCopy);
+
+      RNTupleMerger merger;
+      auto mergeInfo = merger.Merge(sources, *destination);
+      EXPECT_EQ(15U, mergeInfo.fNEntries);
+      EXPECT_EQ(3U, mergeInfo.fNClusters);
+      EXPECT_GT(mergeInfo.fNPagesCopied, 0U);
+      EXPECT_GT(mergeInfo.fNPagesRecompressed, 0U);
+   }
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard3.GetPath());
+   EXPECT_EQ(15U, ntuple->GetNEntries());
+   EXPECT_EQ(3U, ntuple->GetDescriptor()->GetNClusters());
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewVec = ntuple->GetView<std::vector<float>>("vec");
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_FLOAT_EQ(static_cast<float>(i), viewPt(i));
+      EXPECT_EQ(i, viewVec(i).size());
+      if (i > 0)
+         EXPECT_FLOAT_EQ(i < 10 ? 1.0 : 2.0, viewVec(i)[0]);
+   }
+}
+
+TEST(RNTupleMerger, MergeSchemaMismatch)
+{
+   FileRaii fileGuard1("test_ntuple_merge_mismatch_in_1.root");
+   FileRaii fileGuard2("test_ntuple_merge_mismatch_in_2.root");
+   FileRaii fileGuard3("test_ntuple_merge_mismatch_out.root");
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<float>("pt");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard1.GetPath());
+      ntuple->Fill();
+   }
+   {
+      auto model = RNTupleModel::Create();
+      model->MakeField<int>("pt");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard2.GetPath());
+      ntuple->Fill();
+   }
+
+   auto source1 = std::make_unique<RPageSourceFile>("ntuple", fileGuard1.GetPath(), RNTupleReadOptions());
+   auto source2 = std::make_unique<RPageSourceFile>("ntuple", fileGuard2.GetPath(), RNTupleReadOptions());
+   std::vector<ROOT::Experimental::Detail::RPageSource *> sources{source1.get(), source2.get()};
+   auto destination = std::make_unique<RPageSinkFile>("ntuple", fileGuard3.GetPath(), RNTupleWriteOptions());
+
+   RNTupleMerger merger;
+   try {
+      merger.Merge(sources, *destination);
+      FAIL() << "merging ntuples with different schema should throw";
+   } catch (const RException &err) {
+      EXPECT_THAT(err.what(), testing::HasSubstr("type mismatch"));
+   }
+}
+
+TEST(RNTupleMerger, Append)
+{
+   FileRaii fileGuardIn("test_ntuple_merge_append_in.root");
+   FileRaii fileGuardOut("test_ntuple_merge_append_out.root");
+   FileRaii fileGuardOther("test_ntuple_merge_append_other.root");
+
+   RNTupleMerger merger;
+   auto destination = std::make_unique<RPageSinkFile>("ntuple", fileGuardOut.GetPath(), RNTupleWriteOptions());
+   // Every input file is appended as soon as it is written and can then be overwritten by the next one
+   for (int run = 0; run < 3; ++run) {
+      {
+         auto model = RNTupleModel::Create();
+         auto fieldPt = model->MakeField<float>("pt");
+         auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuardIn.GetPath());
+         for (int i = 0; i < 5; ++i) {
+            *fieldPt = run * 5 + i;
+            ntuple->Fill();
+         }
+      }
+      auto source = std::make_unique<RPageSourceFile>("ntuple", fileGuardIn.GetPath(), RNTupleReadOptions());
+      merger.Append(*source, *destination);
+      EXPECT_EQ(5U * (run + 1), merger.GetMergeInfo().fNEntries);
+   }
+
+   auto otherDestination = std::make_unique<RPageSinkFile>("ntuple", fileGuardOther.GetPath(), RNTupleWriteOptions());
+   auto source = std::make_unique<RPageSourceFile>("ntuple", fileGuardOut.GetPath(), RNTupleReadOptions());
+   EXPECT_THROW(merger.Append(*source, *otherDestination), RException);
+
+   auto mergeInfo = merger.Finalize();
+   EXPECT_EQ(15U, mergeInfo.fNEntries);
+   EXPECT_EQ(3U, mergeInfo.fNClusters);
+   EXPECT_EQ(0U, merger.GetMergeInfo().fNEntries);
+   EXPECT_THROW(merger.Finalize(), RException);
+   destination.reset();
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuardOut.GetPath());
+   EXPECT_EQ(15U, ntuple->GetNEntries());
+   EXPECT_EQ(3U, ntuple->GetDescriptor()->GetNClusterGroups());
+   auto viewPt = ntuple->GetView<float>("pt");
+   for (auto i : ntuple->GetEntryRange())
+      EXPECT_FLOAT_EQ(static_cast<float>(i), viewPt(i));
+}
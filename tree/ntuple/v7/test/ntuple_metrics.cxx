@@ -71,6 +71,38 @@ TEST(Metrics, Nested)
    EXPECT_EQ(std::string("42"), ctest->GetValueAsString());
 }
 
+TEST(Metrics, Export)
+{
+   RNTupleMetrics inner("inner");
+   auto ctr = inner.MakeCounter<RNTuplePlainCounter *>("plain", "B", "a \"quoted\" description");
+   inner.MakeCounter<RNTupleCalcPerf *>("calcBad", "", "just bad", inner,
+                                        [](const RNTupleMetrics &) -> std::pair<bool, double> {
+                                           return {false, 42.};
+                                        });
+   RNTupleMetrics outer("outer");
+   outer.ObserveMetrics(inner);
+
+   std::ostringstream osDisabled;
+   outer.PrintJSON(osDisabled);
+   EXPECT_EQ("[]", osDisabled.str());
+
+   outer.Enable();
+   ctr->SetValue(42);
+
+   std::ostringstream osJSON;
+   outer.PrintJSON(osJSON);
+   EXPECT_NE(std::string::npos, osJSON.str().find("{\"name\": \"outer.inner.plain\", \"unit\": \"B\", "
+                                                   "\"description\": \"a \\\"quoted\\\" description\", "
+                                                   "\"value\": 42}"));
+   EXPECT_NE(std::string::npos, osJSON.str().find("\"value\": null"));
+
+   std::ostringstream osPrometheus;
+   outer.PrintPrometheus(osPrometheus, "root_");
+   EXPECT_NE(std::string::npos, osPrometheus.str().find("# TYPE root_outer_inner_plain gauge\n"));
+   EXPECT_NE(std::string::npos, osPrometheus.str().find("\nroot_outer_inner_plain 42\n"));
+   EXPECT_NE(std::string::npos, osPrometheus.str().find("\nroot_outer_inner_calcBad NaN\n"));
+}
+
 TEST(Metrics, Timer)
 {
    RNTupleAtomicCounter ctrWallTime("wall time", "ns", "");
@@ -112,3 +144,47 @@ TEST(Metrics, RNTupleWriter)
    // one page for the int field, one for the float field
    EXPECT_EQ(2, page_counter->GetValueAsInt());
 }
+
+TEST(Metrics, RNTupleReaderIOStats)
+{
+   FileRaii fileGuard("test_ntuple_reader_iostats.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto fieldPx = model->MakeField<float>("px");
+      auto fieldTag = model->MakeField<std::string>("tag");
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      for (int i = 0; i < 100; ++i) {
+         *fieldPx = i;
+         *fieldTag = std::to_string(i);
+         ntuple->Fill();
+         if (i == 49)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   ntuple->EnableMetrics();
+   auto viewPx = ntuple->GetView<float>("px");
+   for (auto i : ntuple->GetEntryRange())
+      EXPECT_EQ(static_cast<float>(i), viewPx(i));
+
+   std::ostringstream osJSON;
+   ntuple->PrintInfo(ROOT::Experimental::ENTupleInfo::kMetricsJSON, osJSON);
+   const auto json = osJSON.str();
+   EXPECT_EQ(0U, json.find("{\n  \"counters\": [\n"));
+   EXPECT_NE(std::string::npos, json.find("\"name\": \"RNTupleReader.RPageSourceFile.szUnzip\""));
+   EXPECT_NE(std::string::npos, json.find("{\"columnId\": 0, \"field\": \"px\", \"nPages\": 2, "
+                                            "\"szRead\": "));
+   EXPECT_NE(std::string::npos, json.find("\"szUnzip\": 400, "));
+   EXPECT_NE(std::string::npos, json.find("{\"clusterId\": 0, \"nPages\": 1, "));
+   EXPECT_NE(std::string::npos, json.find("{\"clusterId\": 1, \"nPages\": 1, "));
+   // The string columns have not been read
+   EXPECT_EQ(std::string::npos, json.find("\"field\": \"tag\""));
+
+   std::ostringstream osPrometheus;
+   ntuple->PrintInfo(ROOT::Experimental::ENTupleInfo::kMetricsPrometheus, osPrometheus);
+   EXPECT_NE(std::string::npos,
+             osPrometheus.str().find("RNTupleReader_column_szUnzip{ntuple=\"ntuple\",column=\"0\",field=\"px\"} 400"));
+   EXPECT_NE(std::string::npos,
+             osPrometheus.str().find("RNTupleReader_cluster_nPages{ntuple=\"ntuple\",cluster=\"1\"} 1\n"));
+}
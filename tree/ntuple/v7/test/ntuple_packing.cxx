@@ -33,6 +33,27 @@ TEST(Packing, Bitfield)
    }
 }
 
+TEST(Packing, BitfieldLarge)
+{
+   ROOT::Experimental::Detail::RColumnElement<bool, ROOT::Experimental::EColumnType::kBit> element(nullptr);
+
+   // Exercise both the full bytes and the tail byte for a page-sized array
+   constexpr std::size_t N = 1003;
+   bool b[N];
+   for (std::size_t i = 0; i < N; ++i)
+      b[i] = ((i * 7919) % 13) < 5;
+   unsigned char packed[(N + 7) / 8];
+   element.Pack(packed, b, N);
+   for (std::size_t i = 0; i < N; ++i) {
+      EXPECT_EQ(b[i], ((packed[i / 8] >> (i % 8)) & 1) == 1);
+   }
+   bool e[N];
+   element.Unpack(e, packed, N);
+   for (std::size_t i = 0; i < N; ++i) {
+      EXPECT_EQ(b[i], e[i]);
+   }
+}
+
 TEST(Packing, RColumnSwitch)
 {
    ROOT::Experimental::Detail::RColumnElement<ROOT::Experimental::RColumnSwitch,
@@ -50,3 +71,227 @@ TEST(Packing, RColumnSwitch)
    EXPECT_EQ(0xaa, s2.GetIndex());
    EXPECT_EQ(0x55, s2.GetTag());
 }
+
+TEST(Packing, SplitReal32)
+{
+   ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kSplitReal32> element(nullptr);
+   element.Pack(nullptr, nullptr, 0);
+   element.Unpack(nullptr, nullptr, 0);
+
+   float fin[] = {1.0, 2.0, -3.5, 1e-30};
+   unsigned char packed[sizeof(fin)];
+   element.Pack(packed, fin, 4);
+   // The first byte plane contains the least significant bytes of all values
+   std::uint32_t first;
+   memcpy(&first, &fin[0], sizeof(first));
+   EXPECT_EQ(static_cast<unsigned char>(first & 0xff), packed[0]);
+   EXPECT_EQ(static_cast<unsigned char>(first >> 24), packed[12]);
+
+   float fout[4];
+   element.Unpack(fout, packed, 4);
+   for (unsigned i = 0; i < 4; ++i) {
+      EXPECT_EQ(fin[i], fout[i]);
+   }
+}
+
+TEST(Packing, Real16)
+{
+   ROOT::Experimental::Detail::RColumnElement<float, ROOT::Experimental::EColumnType::kReal16> element(nullptr);
+   EXPECT_EQ(16U, element.GetBitsOnStorage());
+   element.Pack(nullptr, nullptr, 0);
+   element.Unpack(nullptr, nullptr, 0);
+
+   const float inf = std::numeric_limits<float>::infinity();
+   float fin[] = {1.0, -2.0, 65504.0, 1e6, 6e-8, 1e-8, inf, std::numeric_limits<float>::quiet_NaN(), 0.1f};
+   const std::uint16_t expected[] = {0x3c00, 0xc000, 0x7bff, 0x7c00, 0x0001, 0x0000, 0x7c00};
+   unsigned char packed[2 * 9];
+   element.Pack(packed, fin, 9);
+   for (unsigned i = 0; i < 7; ++i) {
+      EXPECT_EQ(expected[i], packed[2 * i] | (packed[2 * i + 1] << 8));
+   }
+
+   float fout[9];
+   element.Unpack(fout, packed, 9);
+   EXPECT_EQ(1.0, fout[0]);
+   EXPECT_EQ(-2.0, fout[1]);
+   EXPECT_EQ(65504.0, fout[2]);
+   EXPECT_EQ(inf, fout[3]);
+   EXPECT_FLOAT_EQ(5.9604644775390625e-8f, fout[4]);
+   EXPECT_EQ(0.0, fout[5]);
+   EXPECT_EQ(inf, fout[6]);
+   EXPECT_TRUE(std::isnan(fout[7]));
+   EXPECT_NEAR(0.1, fout[8], 0.1 / 2048);
+}
+
+TEST(Packing, SplitInt)
+{
+   ROOT::Experimental::Detail::RColumnElement<std::int32_t, ROOT::Experimental::EColumnType::kSplitInt32> element(
+      nullptr);
+   std::int32_t iin[] = {0, -1, 1, -2, std::numeric_limits<std::int32_t>::max(),
+                         std::numeric_limits<std::int32_t>::min()};
+   unsigned char packed[sizeof(iin)];
+   element.Pack(packed, iin, 6);
+   // Zigzag encoding maps small negative values to small unsigned values
+   EXPECT_EQ(0, packed[0]);
+   EXPECT_EQ(1, packed[1]);
+   EXPECT_EQ(2, packed[2]);
+   EXPECT_EQ(3, packed[3]);
+   EXPECT_EQ(0, packed[6 + 1]);
+
+   std::int32_t iout[6];
+   element.Unpack(iout, packed, 6);
+   for (unsigned i = 0; i < 6; ++i) {
+      EXPECT_EQ(iin[i], iout[i]);
+   }
+
+   ROOT::Experimental::Detail::RColumnElement<std::uint64_t, ROOT::Experimental::EColumnType::kSplitInt64> element64(
+      nullptr);
+   std::uint64_t uin[] = {0, 1, std::numeric_limits<std::uint64_t>::max(), 0x0123456789abcdef};
+   unsigned char packed64[sizeof(uin)];
+   element64.Pack(packed64, uin, 4);
+   std::uint64_t uout[4];
+   element64.Unpack(uout, packed64, 4);
+   for (unsigned i = 0; i < 4; ++i) {
+      EXPECT_EQ(uin[i], uout[i]);
+   }
+}
+
+TEST(Packing, SplitIndex)
+{
+   ROOT::Experimental::Detail::RColumnElement<ClusterSize_t, ROOT::Experimental::EColumnType::kSplitIndex32> element(
+      nullptr);
+   ClusterSize_t in[] = {ClusterSize_t(1000), ClusterSize_t(1001), ClusterSize_t(1005), ClusterSize_t(1005),
+                         ClusterSize_t(70000)};
+   unsigned char packed[sizeof(in)];
+   element.Pack(packed, in, 5);
+   // Delta encoding: 1000 (0x03e8), 1, 4, 0, 68995
+   EXPECT_EQ(0xe8, packed[0]);
+   EXPECT_EQ(1, packed[1]);
+   EXPECT_EQ(4, packed[2]);
+   EXPECT_EQ(0, packed[3]);
+   EXPECT_EQ(0x03, packed[5]);
+   EXPECT_EQ(0, packed[6]);
+
+   ClusterSize_t out[5];
+   element.Unpack(out, packed, 5);
+   for (unsigned i = 0; i < 5; ++i) {
+      EXPECT_EQ(in[i], out[i]);
+   }
+}
+
+TEST(Packing, SplitEncodingRoundtrip)
+{
+   FileRaii fileGuard("test_ntuple_packing_split.root");
+
+   auto model = RNTupleModel::Create();
+   auto fldPx = model->MakeField<float>("px");
+   auto fldE = model->MakeField<double>("e");
+   auto fldCharge = model->MakeField<std::int32_t>("charge");
+   auto fldId = model->MakeField<std::uint64_t>("id");
+   auto fldHits = model->MakeField<std::vector<std::int16_t>>("hits");
+   auto fldTag = model->MakeField<std::string>("tag");
+   {
+      RNTupleWriteOptions options;
+      options.SetUseSplitEncoding(true);
+      options.SetApproxUnzippedPageSize(1000);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), options);
+      for (int i = 0; i < 2000; ++i) {
+         *fldPx = 0.5 * i;
+         *fldE = -1.0 * i;
+         *fldCharge = (i % 3) - 1;
+         *fldId = 0x1000000000ULL + i;
+         *fldHits = std::vector<std::int16_t>(i % 4, -i);
+         *fldTag = std::string(i % 5, 'x');
+         writer->Fill();
+      }
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   {
+      auto desc = reader->GetDescriptor();
+      auto fnGetColumnType = [&desc](const std::string &fieldName) {
+         auto columnId = desc->FindColumnId(desc->FindFieldId(fieldName), 0);
+         return desc->GetColumnDescriptor(columnId).GetModel().GetType();
+      };
+      EXPECT_EQ(EColumnType::kSplitReal32, fnGetColumnType("px"));
+      EXPECT_EQ(EColumnType::kSplitReal64, fnGetColumnType("e"));
+      EXPECT_EQ(EColumnType::kSplitInt32, fnGetColumnType("charge"));
+      EXPECT_EQ(EColumnType::kSplitInt64, fnGetColumnType("id"));
+      EXPECT_EQ(EColumnType::kSplitIndex32, fnGetColumnType("hits"));
+      EXPECT_EQ(EColumnType::kSplitIndex32, fnGetColumnType("tag"));
+   }
+
+   auto viewPx = reader->GetView<float>("px");
+   auto viewE = reader->GetView<double>("e");
+   auto viewCharge = reader->GetView<std::int32_t>("charge");
+   auto viewId = reader->GetView<std::uint64_t>("id");
+   auto viewHits = reader->GetView<std::vector<std::int16_t>>("hits");
+   auto viewTag = reader->GetView<std::string>("tag");
+   for (auto i : reader->GetEntryRange()) {
+      EXPECT_FLOAT_EQ(0.5 * i, viewPx(i));
+      EXPECT_DOUBLE_EQ(-1.0 * i, viewE(i));
+      EXPECT_EQ(static_cast<std::int32_t>(i % 3) - 1, viewCharge(i));
+      EXPECT_EQ(0x1000000000ULL + i, viewId(i));
+      EXPECT_EQ(std::vector<std::int16_t>(i % 4, -static_cast<std::int16_t>(i)), viewHits(i));
+      EXPECT_EQ(std::string(i % 5, 'x'), viewTag(i));
+   }
+}
+
+TEST(Packing, LossyFloatRoundtrip)
+{
+   FileRaii fileGuard("test_ntuple_packing_lossy.root");
+
+   auto model = RNTupleModel::Create();
+   auto fieldPt = std::make_unique<RField<float>>("pt");
+   fieldPt->SetHalfPrecision(true);
+   model->AddField(std::move(fieldPt));
+   auto fieldEta = std::make_unique<RField<float>>("eta");
+   fieldEta->SetMantissaBits(10);
+   model->AddField(std::move(fieldEta));
+   auto fieldE = std::make_unique<RField<double>>("e");
+   fieldE->SetMantissaBits(12);
+   model->AddField(std::move(fieldE));
+   EXPECT_THROW(RField<float>("f").SetMantissaBits(24), RException);
+   {
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      auto entry = writer->GetModel()->GetDefaultEntry();
+      auto pt = entry->Get<float>("pt");
+      auto eta = entry->Get<float>("eta");
+      auto e = entry->Get<double>("e");
+      for (int i = 0; i < 1000; ++i) {
+         *pt = 0.37 * i;
+         *eta = -2.5 + 0.005 * i;
+         *e = 1.1e3 * i;
+         writer->Fill();
+      }
+   }
+
+   auto reader = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   {
+      auto desc = reader->GetDescriptor();
+      auto fnGetColumnType = [&desc](const std::string &fieldName) {
+         auto columnId = desc->FindColumnId(desc->FindFieldId(fieldName), 0);
+         return desc->GetColumnDescriptor(columnId).GetModel().GetType();
+      };
+      EXPECT_EQ(EColumnType::kReal16, fnGetColumnType("pt"));
+      EXPECT_EQ(EColumnType::kReal32, fnGetColumnType("eta"));
+      EXPECT_EQ(EColumnType::kReal64, fnGetColumnType("e"));
+   }
+
+   auto viewPt = reader->GetView<float>("pt");
+   auto viewEta = reader->GetView<float>("eta");
+   auto viewE = reader->GetView<double>("e");
+   for (auto i : reader->GetEntryRange()) {
+      const float expectedPt = 0.37 * i;
+      const float expectedEta = -2.5 + 0.005 * i;
+      const double expectedE = 1.1e3 * i;
+      EXPECT_NEAR(expectedPt, viewPt(i), std::abs(expectedPt) / 2048);
+      EXPECT_NEAR(expectedEta, viewEta(i), std::abs(expectedEta) / 2048);
+      EXPECT_NEAR(expectedE, viewE(i), expectedE / 8192);
+      // The dropped mantissa bits are zero
+      float valEta = viewEta(i);
+      std::uint32_t bitsEta;
+      memcpy(&bitsEta, &valEta, sizeof(bitsEta));
+      EXPECT_EQ(0U, bitsEta & 0x1fff);
+   }
+}
@@ -0,0 +1,83 @@
+#include "ntuple_test.hxx"
+
+TEST(RNTupleParallelWriter, Basics)
+{
+   FileRaii fileGuard("test_ntuple_parallel_writer_basics.root");
+
+   auto model = RNTupleModel::Create();
+   model->MakeField<float>("pt");
+   model->MakeField<std::vector<int>>("vec");
+
+   static constexpr int kNThreads = 4;
+   static constexpr int kNEntriesPerThread = 1000;
+   {
+      RNTupleWriteOptions options;
+      options.SetApproxZippedClusterSize(1000);
+      auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), options);
+
+      std::vector<std::thread> threads;
+      for (int t = 0; t < kNThreads; ++t) {
+         threads.emplace_back([&writer, t] {
+            auto fillContext = writer->CreateFillContext();
+            auto entry = fillContext->CreateEntry();
+            auto pt = entry->Get<float>("pt");
+            auto vec = entry->Get<std::vector<int>>("vec");
+            for (int i = 0; i < kNEntriesPerThread; ++i) {
+               *pt = t;
+               vec->assign(i % 3, t);
+               fillContext->Fill(*entry);
+            }
+            EXPECT_EQ(kNEntriesPerThread, fillContext->GetNEntries());
+         });
+      }
+      for (auto &thread : threads)
+         thread.join();
+   }
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   EXPECT_EQ(kNThreads * kNEntriesPerThread, ntuple->GetNEntries());
+   EXPECT_LT(kNThreads, ntuple->GetDescriptor()->GetNClusters());
+
+   // Entries of one thread are in order within a cluster but the clusters of the threads interleave
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewVec = ntuple->GetView<std::vector<int>>("vec");
+   std::vector<int> nEntriesPerThread(kNThreads, 0);
+   for (auto i : ntuple->GetEntryRange()) {
+      const int t = viewPt(i);
+      ASSERT_GE(t, 0);
+      ASSERT_LT(t, kNThreads);
+      const auto &vec = viewVec(i);
+      EXPECT_EQ(static_cast<std::size_t>(nEntriesPerThread[t] % 3), vec.size());
+      for (auto v : vec)
+         EXPECT_EQ(t, v);
+      nEntriesPerThread[t]++;
+   }
+   for (auto n : nEntriesPerThread)
+      EXPECT_EQ(kNEntriesPerThread, n);
+}
+
+TEST(RNTupleParallelWriter, EntryOfOtherContext)
+{
+   FileRaii fileGuard("test_ntuple_parallel_writer_entry.root");
+
+   auto model = RNTupleModel::Create();
+   model->MakeField<float>("pt");
+   auto writer = RNTupleParallelWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+
+   auto context1 = writer->CreateFillContext();
+   auto context2 = writer->CreateFillContext();
+   auto entry = context1->CreateEntry();
+   EXPECT_THROW(context2->Fill(*entry), RException);
+   context1->Fill(*entry);
+   context2->Fill();
+}
+
+TEST(RNTupleParallelWriter, FrozenModel)
+{
+   FileRaii fileGuard("test_ntuple_parallel_writer_frozen.root");
+
+   auto model = RNTupleModel::Create();
+   model->MakeField<float>("pt");
+   model->Freeze();
+   EXPECT_THROW(RNTupleParallelWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath()), RException);
+}
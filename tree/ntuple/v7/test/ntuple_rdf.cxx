@@ -48,3 +48,36 @@ TEST(RNTuple, RDF)
    EXPECT_EQ(2U, *rdf.Min("R_rdf_sizeof_jets"));
    EXPECT_EQ(3U, *rdf.Min("R_rdf_sizeof_klass.v1"));
 }
+
+TEST(RNTuple, RDFValueRangeFilter)
+{
+   FileRaii fileGuard("test_ntuple_rdf_value_range_filter.root");
+
+   auto model = RNTupleModel::Create();
+   auto wrPt = model->MakeField<float>("pt");
+   auto wrRun = model->MakeField<std::int32_t>("run");
+   {
+      RNTupleWriteOptions options;
+      options.SetUseColumnStatistics(true);
+      auto writer = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), options);
+      for (int c = 0; c < 10; ++c) {
+         for (int i = 0; i < 10; ++i) {
+            *wrPt = 10 * c + i;
+            *wrRun = c / 2;
+            writer->Fill();
+         }
+         writer->CommitCluster();
+      }
+   }
+
+   auto ds = std::make_unique<ROOT::Experimental::RNTupleDS>(
+      ROOT::Experimental::Detail::RPageSource::Create("ntuple", fileGuard.GetPath()));
+   EXPECT_THROW(ds->AddValueRangeFilter("nonexistent", 0, 1), RException);
+   ds->AddValueRangeFilter("pt", 25, 54);
+   ds->AddValueRangeFilter("run", 2, 2);
+   ROOT::RDataFrame rdf(std::move(ds));
+   // Only the clusters 4 and 5 pass both filters
+   EXPECT_EQ(20U, *rdf.Count());
+   EXPECT_EQ(40.0, *rdf.Min("pt"));
+   EXPECT_EQ(15U, *rdf.Filter("pt >= 25 && pt <= 54 && run == 2").Count());
+}
@@ -211,6 +211,56 @@ TEST(RNTuple, PageFilling) {
    EXPECT_EQ(1u, pr3.fPageInfos[1].fNElements);
 }
 
+TEST(RNTuple, AdaptivePageSize)
+{
+   FileRaii fileGuard("test_ntuple_adaptive_page_size.root");
+
+   auto model = RNTupleModel::Create();
+   auto fldZeros = model->MakeField<std::int32_t>("zeros");
+   auto fldNoise = model->MakeField<std::uint64_t>("noise");
+
+   RNTupleWriteOptions options;
+   options.SetApproxUnzippedPageSize(4096);
+   options.SetApproxZippedPageSize(4096);
+   options.SetMaxUnzippedPageSize(64 * 1024);
+   EXPECT_THROW(options.SetMaxUnzippedPageSize(options.GetMaxUnzippedClusterSize() + 1), RException);
+
+   {
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntpl", fileGuard.GetPath(), options);
+      std::uint64_t rnd = 42;
+      for (int i = 0; i < 60000; ++i) {
+         rnd = rnd * 6364136223846793005ULL + 1442695040888963407ULL;
+         *fldZeros = 0;
+         *fldNoise = rnd;
+         ntuple->Fill();
+         if ((i + 1) % 20000 == 0)
+            ntuple->CommitCluster();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("ntpl", fileGuard.GetPath());
+   const auto desc = ntuple->GetDescriptor();
+   ASSERT_EQ(3u, desc->GetNClusters());
+   const auto zerosColumnId = desc->FindColumnId(desc->FindFieldId("zeros"), 0);
+   const auto noiseColumnId = desc->FindColumnId(desc->FindFieldId("noise"), 0);
+
+   // The first cluster uses the static page size
+   const auto &cd1 = desc->GetClusterDescriptor(desc->FindClusterId(0, 0));
+   EXPECT_EQ(1024u, cd1.GetPageRange(zerosColumnId).fPageInfos[0].fNElements);
+   EXPECT_EQ(512u, cd1.GetPageRange(noiseColumnId).fPageInfos[0].fNElements);
+
+   // Afterwards, the well-compressible column uses the largest allowed pages (plus the merged tail page); the
+   // incompressible column keeps its page size
+   const auto &cd2 = desc->GetClusterDescriptor(desc->FindNextClusterId(cd1.GetId()));
+   ASSERT_EQ(1u, cd2.GetPageRange(zerosColumnId).fPageInfos.size());
+   EXPECT_EQ(20000u, cd2.GetPageRange(zerosColumnId).fPageInfos[0].fNElements);
+   EXPECT_EQ(512u, cd2.GetPageRange(noiseColumnId).fPageInfos[0].fNElements);
+
+   auto viewZeros = ntuple->GetView<std::int32_t>("zeros");
+   for (auto i : ntuple->GetEntryRange())
+      EXPECT_EQ(0, viewZeros(i));
+}
+
 TEST(RNTuple, PageFillingString) {
    FileRaii fileGuard("test_ntuple_page_filling_string.root");
 
@@ -414,6 +464,41 @@ TEST(RPageSinkBuf, ParallelZip) {
    }
 }
 
+TEST(RPageSinkBuf, ParallelZipBackpressure)
+{
+   ROOT::EnableImplicitMT();
+
+   FileRaii fileGuard("test_ntuple_sinkbuf_pzip_backpressure.root");
+   {
+      auto model = RNTupleModel::Create();
+      auto floatField = model->MakeField<float>("pt");
+      RNTupleWriteOptions options;
+      options.SetApproxUnzippedPageSize(1024);
+      // Every committed page exceeds the limit and makes the writer wait for the compression tasks
+      options.SetMaxUnsealedPageBytes(1);
+      auto ntuple = std::make_unique<RNTupleWriter>(
+         std::move(model), std::make_unique<RPageSinkBuf>(
+                              std::make_unique<RPageSinkFile>("buf_pzip", fileGuard.GetPath(), options)));
+      ntuple->EnableMetrics();
+      for (int i = 0; i < 20000; i++) {
+         *floatField = static_cast<float>(i);
+         ntuple->Fill();
+         if (i && i % 15000 == 0)
+            ntuple->CommitCluster();
+      }
+      auto *nBackpressure = ntuple->GetMetrics().GetCounter("RNTupleWriter.RPageSinkBuf.nZipBackpressure");
+      ASSERT_FALSE(nBackpressure == nullptr);
+      EXPECT_GT(nBackpressure->GetValueAsInt(), 0);
+   }
+
+   auto ntuple = RNTupleReader::Open("buf_pzip", fileGuard.GetPath());
+   EXPECT_EQ(20000, ntuple->GetNEntries());
+   auto viewPt = ntuple->GetView<float>("pt");
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_EQ(static_cast<float>(i), viewPt(i));
+   }
+}
+
 TEST(RPageSinkBuf, CommitSealedPageV)
 {
    RNTupleWriteOptions options;
@@ -507,3 +592,50 @@ TEST(RPageSink, MultipleClusterGroups)
    ntuple->LoadEntry(2);
    EXPECT_EQ(12.0, *rdPt);
 }
+
+TEST(RPageSourceFile, Mmap)
+{
+   FileRaii fileGuard("test_ntuple_mmap.root");
+
+   auto model = RNTupleModel::Create();
+   auto wrPt = model->MakeField<float>("pt");
+   auto wrVec = model->MakeField<std::vector<double>>("vec");
+   auto wrStr = model->MakeField<std::string>("str");
+   {
+      RNTupleWriteOptions options;
+      options.SetCompression(0);
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath(), options);
+      for (int i = 0; i < 1000; ++i) {
+         *wrPt = i;
+         wrVec->assign(i % 5, i);
+         *wrStr = std::to_string(i);
+         ntuple->Fill();
+         if (i == 500)
+            ntuple->CommitCluster();
+      }
+   }
+
+   RNTupleReadOptions options;
+   options.SetUseMmap(true);
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath(), options);
+   ntuple->EnableMetrics();
+   auto viewPt = ntuple->GetView<float>("pt");
+   auto viewVec = ntuple->GetView<std::vector<double>>("vec");
+   auto viewStr = ntuple->GetView<std::string>("str");
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_FLOAT_EQ(static_cast<float>(i), viewPt(i));
+      ASSERT_EQ(i % 5, viewVec(i).size());
+      for (auto v : viewVec(i))
+         EXPECT_DOUBLE_EQ(static_cast<double>(i), v);
+      EXPECT_EQ(std::to_string(i), viewStr(i));
+   }
+
+   // Pages of mappable columns are used in place; only the unmappable index columns are unsealed
+   const auto &metrics = ntuple->GetMetrics();
+   auto szUnzip = metrics.GetCounter("RNTupleReader.RPageSourceFile.szUnzip");
+   auto szRead = metrics.GetCounter("RNTupleReader.RPageSourceFile.szReadPayload");
+   ASSERT_NE(nullptr, szUnzip);
+   ASSERT_NE(nullptr, szRead);
+   EXPECT_GT(szRead->GetValueAsInt(), 0);
+   EXPECT_LT(szUnzip->GetValueAsInt(), szRead->GetValueAsInt());
+}
@@ -93,6 +93,50 @@ TEST(RNTuple, BulkView)
    }
 }
 
+TEST(RNTuple, ReadBulk)
+{
+   FileRaii fileGuard("test_ntuple_read_bulk.root");
+
+   auto model = RNTupleModel::Create();
+   auto fieldPt = model->MakeField<float>("pt");
+   auto fieldTag = model->MakeField<std::string>("tag");
+   auto eltsPerPage = 1000;
+   {
+      RNTupleWriteOptions opt;
+      opt.SetApproxUnzippedPageSize(eltsPerPage * sizeof(float));
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "myNTuple", fileGuard.GetPath(), opt);
+      for (int i = 0; i < 10'000; i++) {
+         *fieldPt = i;
+         *fieldTag = std::to_string(i % 7);
+         ntuple->Fill();
+         if (i == 4321)
+            ntuple->CommitCluster();
+      }
+   }
+   auto ntuple = RNTupleReader::Open("myNTuple", fileGuard.GetPath());
+   auto viewPt = ntuple->GetView<float>("pt");
+
+   // Crosses several page and one cluster boundary
+   std::vector<float> buffer(5000);
+   viewPt.ReadBulk(eltsPerPage - 3, buffer.size(), buffer.data());
+   for (std::size_t i = 0; i < buffer.size(); ++i) {
+      ASSERT_EQ(static_cast<float>(eltsPerPage - 3 + i), buffer[i]) << i;
+   }
+
+   std::vector<float> all(ntuple->GetNEntries());
+   viewPt.ReadBulk(ntuple->GetEntryRange(), all.data());
+   for (std::size_t i = 0; i < all.size(); ++i) {
+      ASSERT_EQ(static_cast<float>(i), all[i]) << i;
+   }
+
+   auto viewTag = ntuple->GetView<std::string>("tag");
+   std::vector<std::string> tags(20);
+   viewTag.ReadBulk(100, tags.size(), tags.data());
+   for (std::size_t i = 0; i < tags.size(); ++i) {
+      EXPECT_EQ(std::to_string((100 + i) % 7), tags[i]);
+   }
+}
+
 TEST(RNTuple, BulkViewCollection)
 {
    FileRaii fileGuard("test_ntuple_bulk_view_collection.root");
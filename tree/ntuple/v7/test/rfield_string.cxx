@@ -27,3 +27,61 @@ TEST(RNTuple, ReadString)
    int nElementsPerPage = ntuple->GetDescriptor()->GetClusterDescriptor(0).GetPageRange(1).fPageInfos.at(1).fNElements;
    EXPECT_EQ(contentString, viewSt(nElementsPerPage/7));
 }
+
+TEST(RNTuple, DictionaryEncodedString)
+{
+   FileRaii fileGuard("test_ntuple_dictionary_string.root");
+   const std::vector<std::string> tags{"HLT_Mu20", "HLT_Ele32", "", "HLT_PFJet500"};
+   {
+      auto model = RNTupleModel::Create();
+      auto field = std::make_unique<RField<std::string>>("tag");
+      field->SetUseDictionaryEncoding(true);
+      model->AddField(std::move(field));
+      auto ntuple = RNTupleWriter::Recreate(std::move(model), "ntuple", fileGuard.GetPath());
+      auto tag = ntuple->GetModel()->GetDefaultEntry()->Get<std::string>("tag");
+      for (int i = 0; i < 1000; ++i) {
+         *tag = tags[i % 3];
+         ntuple->Fill();
+      }
+      ntuple->CommitCluster();
+      // The second cluster has a different dictionary
+      for (int i = 0; i < 1000; ++i) {
+         *tag = tags[3 - (i % 2)];
+         ntuple->Fill();
+      }
+   }
+
+   auto ntuple = RNTupleReader::Open("ntuple", fileGuard.GetPath());
+   const auto &desc = *ntuple->GetDescriptor();
+   EXPECT_EQ(2U, desc.GetNClusters());
+   const auto fieldId = desc.FindFieldId("tag");
+   EXPECT_EQ(EColumnType::kInt32, desc.GetColumnDescriptor(desc.FindColumnId(fieldId, 0)).GetModel().GetType());
+   const auto dictIndexId = desc.FindColumnId(fieldId, 1);
+   EXPECT_EQ(3U, desc.GetClusterDescriptor(0).GetColumnRange(dictIndexId).fNElements);
+   EXPECT_EQ(2U, desc.GetClusterDescriptor(1).GetColumnRange(dictIndexId).fNElements);
+
+   auto viewTag = ntuple->GetView<std::string>("tag");
+   for (auto i : ntuple->GetEntryRange()) {
+      EXPECT_EQ(i < 1000 ? tags[i % 3] : tags[3 - (i % 2)], viewTag(i));
+   }
+
+   // Filter by comparing codes without reading the strings
+   const auto &field = viewTag.GetField();
+   EXPECT_TRUE(field.GetUseDictionaryEncoding());
+   int nSelected = 0;
+   for (DescriptorId_t clusterId = 0; clusterId < 2; ++clusterId) {
+      const auto code = field.FindDictionaryCode(clusterId, "HLT_Ele32");
+      const auto &clusterDesc = desc.GetClusterDescriptor(clusterId);
+      if (clusterId == 0) {
+         EXPECT_EQ(1, code);
+      } else {
+         EXPECT_EQ(-1, code);
+         EXPECT_EQ(1, field.FindDictionaryCode(clusterId, ""));
+      }
+      for (std::uint64_t i = 0; i < clusterDesc.GetNEntries(); ++i) {
+         if (field.GetDictionaryCode(RClusterIndex(clusterId, i)) == code)
+            nSelected++;
+      }
+   }
+   EXPECT_EQ(333, nSelected);
+}
@@ -58,6 +58,11 @@ private:
    void   DisownBuffer();
    void   AdoptBuffer(TBuffer *user_buffer);
 
+   // The two steps of WriteBuffer: compression does not touch the file, so that it can
+   // run in the background (see TTree::SetAsyncBasketWrite); the commit writes the key.
+   Int_t  CompressBuffer(TFile *file);
+   Int_t  CommitBuffer(TFile *file, Int_t nout, Int_t cycle);
+
 protected:
    Int_t       fBufferSize{0};                    ///< fBuffer length in bytes
    Int_t       fNevBufSize{0};                    ///< Length in Int_t of fEntryOffset OR fixed length of each entry if fEntryOffset is null!
@@ -75,6 +80,7 @@ protected:
    Int_t       fLastWriteBufferSize[3] = {0,0,0}; ///<! Size of the buffer last three buffers we wrote it to disk
    Bool_t      fResetAllocation{false};           ///<! True if last reset re-allocated the memory
    UChar_t     fNextBufferSizeRecord{0};          ///<! Index into fLastWriteBufferSize of the last buffer written to disk
+   Bool_t      fPendingWrite{kFALSE};             ///<! True while the basket is compressed in the background
 #ifdef R__TRACK_BASKET_ALLOC_TIME
    ULong64_t   fResetAllocationTime{0};           ///<! Time spent reallocating baskets in microseconds during last Reset operation.
 #endif
@@ -31,6 +31,8 @@
 #include "Compression.h"
 #include "ROOT/TIOFeatures.hxx"
 
+#include <vector>
+
 class TTree;
 class TBasket;
 class TBranchElement;
@@ -50,6 +52,7 @@ class TBulkBranchRead;
 }
 namespace Internal {
 class TBranchIMTHelper; ///< A helper class for managing IMT work during TTree:Fill operations.
+class TAsyncBasketWriter;
 }
 }
 
@@ -71,9 +74,11 @@ class TBulkBranchRead {
 
 public:
    Int_t GetBulkEntries(Long64_t evt, TBuffer &user_buf);
+   Int_t GetBulkEntries(Long64_t evt, TBuffer &user_buf, std::vector<Int_t> &offsets);
    Int_t GetEntriesSerialized(Long64_t evt, TBuffer &user_buf);
    Int_t GetEntriesSerialized(Long64_t evt, TBuffer &user_buf, TBuffer *count_buf);
    Bool_t SupportsBulkRead() const;
+   Bool_t SupportsBulkArrayRead() const;
 
 private:
    TBulkBranchRead(TBranch &parent)
@@ -149,6 +154,7 @@ protected:
    BulkObj     fBulk;             ///<! Helper for performing bulk IO
 
    Bool_t      fSkipZip;          ///<! After being read, the buffer will not be unzipped.
+   Int_t       fNPendingWrites{0};///<! Number of baskets being compressed in the background (see TTree::SetAsyncBasketWrite)
 
    using CacheInfo_t = ROOT::Internal::TBranchCacheInfo;
    CacheInfo_t fCacheInfo;        ///<! Hold info about which basket are in the cache and if they have been retrieved from the cache.
@@ -178,10 +184,18 @@ private:
    Int_t    GetBasketAndFirst(TBasket*& basket, Long64_t& first, TBuffer* user_buffer);
    TBasket *GetBasketImpl(Int_t basket, TBuffer* user_buffer);
    Int_t    GetBulkEntries(Long64_t, TBuffer&);
+   Int_t    GetBulkEntries(Long64_t, TBuffer&, std::vector<Int_t>&);
+   Bool_t   GetBulkArrayLayout(Int_t &elementSize, Int_t &headerSize) const;
+   TBasket *PrepareBulkBasket(Long64_t entry, TBuffer &user_buf, Long64_t &first, const char *location);
+   void     ReleaseBulkBasket(TBasket *basket);
    Int_t    GetEntriesSerialized(Long64_t N, TBuffer& user_buf) {return GetEntriesSerialized(N, user_buf, nullptr);}
    Int_t    GetEntriesSerialized(Long64_t, TBuffer&, TBuffer*);
    Int_t    FillEntryBuffer(TBasket* basket,TBuffer* buf, Int_t& lnew);
+   Bool_t   CanFillFlat(Int_t &nbytes, Int_t &elemsize) const;
+   Int_t    FillFlat(const char *src, Int_t nbytes, Int_t elemsize, ROOT::Internal::TBranchIMTHelper *);
    Int_t    WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBranchIMTHelper *);
+   Int_t    WriteBasketAsync(TBasket* basket, TFile *file, ROOT::Internal::TAsyncBasketWriter &writer);
+   void     WaitPendingWrites();
    TBranch(const TBranch&) = delete;             // not implemented
    TBranch& operator=(const TBranch&) = delete;  // not implemented
 
@@ -283,6 +297,7 @@ public:
    virtual void      SetTree(TTree *tree) { fTree = tree; }
    virtual void      SetupAddresses();
            Bool_t    SupportsBulkRead() const;
+           Bool_t    SupportsBulkArrayRead() const;
    virtual void      UpdateAddress() {}
    virtual void      UpdateFile();
 
@@ -314,9 +329,11 @@ namespace Experimental {
 namespace Internal {
 
 inline Int_t  TBulkBranchRead::GetBulkEntries(Long64_t evt, TBuffer& user_buf) { return fParent.GetBulkEntries(evt, user_buf); }
+inline Int_t  TBulkBranchRead::GetBulkEntries(Long64_t evt, TBuffer& user_buf, std::vector<Int_t>& offsets) { return fParent.GetBulkEntries(evt, user_buf, offsets); }
 inline Int_t  TBulkBranchRead::GetEntriesSerialized(Long64_t evt, TBuffer& user_buf) { return fParent.GetEntriesSerialized(evt, user_buf); }
 inline Int_t  TBulkBranchRead::GetEntriesSerialized(Long64_t evt, TBuffer& user_buf, TBuffer* count_buf) { return fParent.GetEntriesSerialized(evt, user_buf, count_buf); }
 inline Bool_t TBulkBranchRead::SupportsBulkRead() const { return fParent.SupportsBulkRead(); }
+inline Bool_t TBulkBranchRead::SupportsBulkArrayRead() const { return fParent.SupportsBulkArrayRead(); }
 
 }  // Internal
 }  // Experimental
@@ -53,6 +53,7 @@ private:
 protected:
    void InvalidateCurrentTree();
    void ReleaseChainProof();
+   void FetchEntriesConcurrently();
 
 public:
    // TChain constants
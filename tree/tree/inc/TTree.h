@@ -76,6 +76,14 @@ class TTreeCloner;
 class TFileMergeInfo;
 class TVirtualPerfStats;
 
+namespace ROOT {
+namespace Internal {
+class TAsyncBasketWriter;
+class TBasketBufferPool;
+struct TTreeFlatFillPlan;
+}
+}
+
 class TTree : public TNamed, public TAttLine, public TAttFill, public TAttMarker {
 
    using TIOFeatures = ROOT::TIOFeatures;
@@ -133,6 +141,10 @@ protected:
    TBranchRef    *fBranchRef;             ///<  Branch supporting the TRefTable (if any)
    UInt_t         fFriendLockStatus;      ///<! Record which method is locking the friend recursion
    TBuffer       *fTransientBuffer;       ///<! Pointer to the current transient buffer.
+   ROOT::Internal::TBasketBufferPool *fBasketBufferPool{nullptr}; ///<! Pool of basket buffers shared by the branches (if any)
+   ROOT::Internal::TAsyncBasketWriter *fAsyncBasketWriter{nullptr}; ///<! Background compression of the baskets (if any)
+   ROOT::Internal::TTreeFlatFillPlan *fFlatFillPlan{nullptr}; ///<! Precomputed Fill of the flat branches (if enabled)
+   Long64_t       fAutoOptimizeBaskets{0};///<! Memory budget for re-tuning basket sizes at each flush (0 if disabled, <0 to hold one cluster)
    Bool_t         fCacheDoAutoInit;       ///<! true if cache auto creation or resize check is needed
    Bool_t         fCacheDoClusterPrefetch;///<! true if cache is prefetching whole clusters
    Bool_t         fCacheUserSet;          ///<! true if the cache setting was explicitly given by user
@@ -150,6 +162,7 @@ protected:
 
    static Int_t     fgBranchStyle;        ///<  Old/New branch style
    static Long64_t  fgMaxTreeSize;        ///<  Maximum size of a file containing a Tree
+   static Long64_t  fgBasketBufferPoolSize; ///<  Default maximum size of the basket buffer pool of new trees
 
 private:
    // For simplicity, although fIMTFlush is always disabled in non-IMT builds, we don't #ifdef it out.
@@ -161,6 +174,7 @@ private:
    void             SortBranchesByTime();
    Int_t            FlushBasketsImpl() const;
    void             MarkEventCluster();
+   void             AutoOptimizeBaskets();
    Long64_t         GetMedianClusterSize();
 
 protected:
@@ -421,6 +435,7 @@ public:
    virtual void            CopyAddresses(TTree*,Bool_t undo = kFALSE);
    virtual Long64_t        CopyEntries(TTree* tree, Long64_t nentries = -1, Option_t *option = "", Bool_t needCopyAddresses = false);
    virtual TTree          *CopyTree(const char* selection, Option_t* option = "", Long64_t nentries = kMaxEntries, Long64_t firstentry = 0);
+           TBuffer        *AcquireBasketBuffer(Int_t size);
    virtual TBasket        *CreateBasket(TBranch*);
    virtual void            DirectoryAutoAdd(TDirectory *);
            Int_t           Debug() const { return fDebug; }
@@ -437,10 +452,14 @@ public:
    virtual Int_t           FlushBaskets(Bool_t create_cluster = true) const;
    virtual const char     *GetAlias(const char* aliasName) const;
            UInt_t          GetAllocationCount() const { return fAllocationCount; }
+           Long64_t        GetBasketBufferPoolSize() const;
 #ifdef R__TRACK_BASKET_ALLOC_TIME
            ULong64_t       GetAllocationTime() const { return fAllocationTime; }
 #endif
+           Int_t           GetAsyncBasketWrite() const;
+   ROOT::Internal::TAsyncBasketWriter *GetAsyncBasketWriter() const { return fIMTFlush ? nullptr : fAsyncBasketWriter; }
    virtual Long64_t        GetAutoFlush() const {return fAutoFlush;}
+           Long64_t        GetAutoOptimizeBaskets() const {return fAutoOptimizeBaskets;}
    virtual Long64_t        GetAutoSave()  const {return fAutoSave;}
    virtual TBranch        *GetBranch(const char* name);
    virtual TBranchRef     *GetBranchRef() const { return fBranchRef; };
@@ -452,6 +471,7 @@ public:
    virtual Long64_t        GetChainOffset() const { return fChainOffset; }
    virtual Bool_t          GetClusterPrefetch() const { return fCacheDoClusterPrefetch; }
            TFile          *GetCurrentFile() const;
+   static  Long64_t        GetDefaultBasketBufferPoolSize();
            Int_t           GetDefaultEntryOffsetLen() const {return fDefaultEntryOffsetLen;}
            Long64_t        GetDebugMax()  const { return fDebugMax; }
            Long64_t        GetDebugMin()  const { return fDebugMin; }
@@ -470,6 +490,7 @@ public:
    virtual TEntryList     *GetEntryList();
    virtual Long64_t        GetEntryNumber(Long64_t entry) const;
    virtual Int_t           GetFileNumber() const { return fFileNumber; }
+           Bool_t          GetFlatFill() const { return fFlatFillPlan != nullptr; }
    virtual TTree          *GetFriend(const char*) const;
    virtual const char     *GetFriendAlias(TTree*) const;
            TH1            *GetHistogram() { return GetPlayer()->GetHistogram(); }
@@ -573,11 +594,15 @@ public:
    virtual void            ResetAfterMerge(TFileMergeInfo *);
    virtual void            ResetBranchAddress(TBranch *);
    virtual void            ResetBranchAddresses();
+           Bool_t          ReleaseBasketBuffer(TBuffer *buffer);
    virtual Long64_t        Scan(const char* varexp = "", const char* selection = "", Option_t* option = "", Long64_t nentries = kMaxEntries, Long64_t firstentry = 0); // *MENU*
    virtual Bool_t          SetAlias(const char* aliasName, const char* aliasFormula);
+           void            SetAsyncBasketWrite(Int_t maxpending = 4);
    virtual void            SetAutoSave(Long64_t autos = -300000000);
    virtual void            SetAutoFlush(Long64_t autof = -30000000);
+           void            SetAutoOptimizeBaskets(Long64_t maxMemory = -1);
    virtual void            SetBasketSize(const char* bname, Int_t buffsize = 16000);
+           void            SetBasketBufferPoolSize(Long64_t maxbytes);
    virtual Int_t           SetBranchAddress(const char *bname,void *add, TBranch **ptr = 0);
    virtual Int_t           SetBranchAddress(const char *bname,void *add, TClass *realClass, EDataType datatype, Bool_t isptr);
    virtual Int_t           SetBranchAddress(const char *bname,void *add, TBranch **ptr, TClass *realClass, EDataType datatype, Bool_t isptr);
@@ -606,12 +631,14 @@ public:
    virtual void            SetCircular(Long64_t maxEntries);
    virtual void            SetClusterPrefetch(Bool_t enabled) { fCacheDoClusterPrefetch = enabled; }
    virtual void            SetDebug(Int_t level = 1, Long64_t min = 0, Long64_t max = 9999999); // *MENU*
+   static  void            SetDefaultBasketBufferPoolSize(Long64_t maxbytes = 0);
    virtual void            SetDefaultEntryOffsetLen(Int_t newdefault, Bool_t updateExisting = kFALSE);
    virtual void            SetDirectory(TDirectory* dir);
    virtual Long64_t        SetEntries(Long64_t n = -1);
    virtual void            SetEstimate(Long64_t nentries = 1000000);
            ROOT::TIOFeatures SetIOFeatures(const ROOT::TIOFeatures &);
    virtual void            SetFileNumber(Int_t number = 0);
+           void            SetFlatFill(Bool_t enable = kTRUE);
    virtual void            SetEventList(TEventList* list);
    virtual void            SetEntryList(TEntryList* list, Option_t *opt="");
    virtual void            SetImplicitMT(Bool_t enabled) { fIMTEnabled = enabled; }
@@ -647,6 +674,7 @@ public:
    virtual Int_t           StopCacheLearningPhase();
    virtual Int_t           UnbinnedFit(const char* funcname, const char* varexp, const char* selection = "", Option_t* option = "", Long64_t nentries = kMaxEntries, Long64_t firstentry = 0);
            void            UseCurrentStyle() override;
+           void            WaitAsyncBasketWrites() const;
            Int_t           Write(const char *name=nullptr, Int_t option=0, Int_t bufsize=0) override;
            Int_t           Write(const char *name=nullptr, Int_t option=0, Int_t bufsize=0) const override;
 
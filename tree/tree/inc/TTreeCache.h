@@ -154,6 +154,7 @@ public:
    virtual Bool_t       FillBuffer();
    Int_t                LearnBranch(TBranch *b, Bool_t subgbranches = kFALSE) override;
    virtual void         LearnPrefill();
+   Int_t                LoadBranchList(const char *filename);
 
    void                 Print(Option_t *option="") const override;
    Int_t                ReadBuffer(char *buf, Long64_t pos, Int_t len) override;
@@ -161,6 +162,7 @@ public:
    virtual Int_t        ReadBufferPrefetch(char *buf, Long64_t pos, Int_t len);
    virtual void         ResetCache();
    void                 ResetMissCache(); // Reset the miss cache.
+   Int_t                SaveBranchList(const char *filename) const;
    void                 SetAutoCreated(Bool_t val) {fAutoCreated = val;}
    Int_t                SetBufferSize(Int_t buffersize) override;
    virtual void         SetEntryRange(Long64_t emin,   Long64_t emax);
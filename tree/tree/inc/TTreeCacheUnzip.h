@@ -16,7 +16,10 @@
 #include "Bytes.h"
 #include "TTreeCache.h"
 #include <atomic>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 class TBasket;
@@ -92,6 +95,19 @@ protected:
    std::unique_ptr<ROOT::Experimental::TTaskGroup> fUnzipTaskGroup;
 #endif
 
+   // Dedicated unzipping threads, used when IMT is not enabled
+   std::vector<std::thread> fUnzipThreads;          ///<! Threads unzipping the baskets of the current cache content
+   std::mutex               fUnzipThreadsMutex;     ///<! Protects the members below
+   std::condition_variable  fUnzipThreadsCondition; ///<! Signals new work, idle threads or termination
+   std::atomic<Int_t>       fUnzipNext{0};          ///<! Index of the next basket to be claimed by a thread
+   Int_t                    fUnzipEnd = 0;          ///<! Number of baskets to be claimed by the threads
+   Int_t                    fUnzipActive = 0;       ///<! Number of threads currently unzipping
+   Int_t                    fUnzipThreadsCycle = -1;///<! Value of fCycle when the threads were last started
+   Bool_t                   fUnzipHasWork = kFALSE; ///<! Whether the threads have baskets to claim
+   Bool_t                   fUnzipStop = kFALSE;    ///<! Whether the threads must terminate
+
+   static Int_t fgUnzipThreads;   ///< Number of dedicated unzipping threads per cache
+
    // Unzipping related members
    Int_t       fNseekMax;         ///<!  fNseek can change so we need to know its max size
    Int_t       fUnzipGroupSize;   ///<!  Min accumulated size of a group of baskets ready to be unzipped by a IMT task
@@ -114,6 +130,10 @@ private:
 
    // Private methods
    void  Init();
+   void  PauseUnzipThreads();
+   void  StartUnzipThreads();
+   void  StopUnzipThreads();
+   void  UnzipThreadLoop();
 
 public:
    TTreeCacheUnzip();
@@ -132,6 +152,8 @@ public:
    static EParUnzipMode GetParallelUnzip();
    static Bool_t        IsParallelUnzip();
    static Int_t         SetParallelUnzip(TTreeCacheUnzip::EParUnzipMode option = TTreeCacheUnzip::kEnable);
+   static Int_t         GetUnzipThreads();
+   static void          SetUnzipThreads(Int_t nthreads);
 
    // Unzipping related methods
 #ifdef R__USE_IMT
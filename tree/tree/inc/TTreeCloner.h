@@ -87,6 +87,9 @@ class TTreeCloner {
    void CreateCache();
    UInt_t FillCache(UInt_t from);
    void RestoreCache();
+#ifdef R__USE_IMT
+   void WriteBasketsPipelined();
+#endif
 
 private:
    TTreeCloner(const TTreeCloner&) = delete;
@@ -0,0 +1,119 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "TAsyncBasketWriter.h"
+
+#include <algorithm>
+
+////////////////////////////////////////////////////////////////////////////////
+/// Start the compression thread; at most `maxPending` jobs are queued.
+
+ROOT::Internal::TAsyncBasketWriter::TAsyncBasketWriter(Int_t maxPending)
+   : fMaxPending(std::max(maxPending, 1)), fThread(&TAsyncBasketWriter::ThreadLoop, this)
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Wait for the running compression, drop the pending jobs and stop the thread.
+
+ROOT::Internal::TAsyncBasketWriter::~TAsyncBasketWriter()
+{
+   Discard();
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      fStop = true;
+   }
+   fWorkCondition.notify_one();
+   fThread.join();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Queue a job. The jobs already compressed are committed first; if the queue
+/// is full, wait for the oldest job to be compressed and commit it.
+
+void ROOT::Internal::TAsyncBasketWriter::Submit(Compress_t compress, Commit_t commit)
+{
+   CommitJobs(0, true);
+   if (GetPending() >= fMaxPending)
+      CommitJobs(GetPending() - fMaxPending + 1, true);
+
+   auto job = std::make_unique<Job>();
+   job->fCompress = std::move(compress);
+   job->fCommit = std::move(commit);
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      fJobs.push_back(std::move(job));
+   }
+   fWorkCondition.notify_one();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Wait for all the queued jobs and commit them.
+
+void ROOT::Internal::TAsyncBasketWriter::Drain()
+{
+   CommitJobs(GetPending(), true);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Wait for all the queued jobs to be compressed, without committing them.
+
+void ROOT::Internal::TAsyncBasketWriter::Discard()
+{
+   CommitJobs(GetPending(), false);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Remove the compressed jobs from the front of the queue, committing them if
+/// `commit` is true; wait for the compression of at least `minCommits` jobs.
+/// The commits run outside of the lock: only this thread removes jobs.
+
+void ROOT::Internal::TAsyncBasketWriter::CommitJobs(std::size_t minCommits, bool commit)
+{
+   std::size_t nCommits = 0;
+   std::unique_lock<std::mutex> lock(fMutex);
+   while (!fJobs.empty()) {
+      if (!fJobs.front()->fDone) {
+         if (nCommits >= minCommits)
+            break;
+         fDoneCondition.wait(lock, [this] { return fJobs.front()->fDone; });
+      }
+      std::unique_ptr<Job> job = std::move(fJobs.front());
+      fJobs.pop_front();
+      --fNextJob;
+      ++nCommits;
+      if (commit) {
+         lock.unlock();
+         job->fCommit(job->fResult);
+         lock.lock();
+      }
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compress the queued jobs in order until asked to stop.
+
+void ROOT::Internal::TAsyncBasketWriter::ThreadLoop()
+{
+   std::unique_lock<std::mutex> lock(fMutex);
+   while (true) {
+      fWorkCondition.wait(lock, [this] { return fStop || fNextJob < fJobs.size(); });
+      if (fStop)
+         return;
+      Job *job = fJobs[fNextJob].get();
+      lock.unlock();
+      Int_t result = job->fCompress();
+      lock.lock();
+      job->fResult = result;
+      job->fDone = true;
+      ++fNextJob;
+      fDoneCondition.notify_all();
+   }
+}
@@ -0,0 +1,81 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TAsyncBasketWriter
+#define ROOT_TAsyncBasketWriter
+
+#include "RtypesCore.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+/** \class ROOT::Internal::TAsyncBasketWriter
+ Compresses the baskets of a TTree in a background thread.
+
+ A job consists of a compression step, run by the background thread, and of
+ a commit step, which receives the result of the compression and writes the
+ basket. The commit steps are run in submission order by the thread calling
+ Submit() or Drain(), so that the file is never accessed concurrently. The
+ number of pending jobs is bounded: Submit() blocks when the queue is full.
+*/
+
+namespace ROOT {
+namespace Internal {
+
+class TAsyncBasketWriter {
+public:
+   using Compress_t = std::function<Int_t()>;
+   using Commit_t = std::function<void(Int_t)>;
+
+   explicit TAsyncBasketWriter(Int_t maxPending);
+   TAsyncBasketWriter(const TAsyncBasketWriter &) = delete;
+   TAsyncBasketWriter &operator=(const TAsyncBasketWriter &) = delete;
+   ~TAsyncBasketWriter();
+
+   void Submit(Compress_t compress, Commit_t commit);
+   void Drain();
+   void Discard();
+
+   Int_t GetMaxPending() const { return fMaxPending; }
+   Int_t GetPending() const
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      return fJobs.size();
+   }
+
+private:
+   struct Job {
+      Compress_t fCompress;
+      Commit_t fCommit;
+      Int_t fResult = 0;
+      bool fDone = false;
+   };
+
+   void CommitJobs(std::size_t minCommits, bool commit);
+   void ThreadLoop();
+
+   mutable std::mutex fMutex;                ///< Protects the queue
+   std::condition_variable fWorkCondition;   ///< Signals a new job or the stop request to the thread
+   std::condition_variable fDoneCondition;   ///< Signals a compressed job to the producer
+   std::deque<std::unique_ptr<Job>> fJobs;   ///< Pending jobs, in submission order
+   std::size_t fNextJob = 0;                 ///< Index in fJobs of the first job not yet compressed
+   bool fStop = false;                       ///< Whether the thread must exit
+   Int_t fMaxPending;                        ///< Maximum number of jobs in fJobs
+   std::thread fThread;                      ///< The compression thread
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
@@ -55,6 +55,30 @@ TBasket::TBasket(TDirectory *motherDir) : TKey(motherDir)
 {
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Allocate a buffer for a basket of the branch, from the tree basket buffer pool if any.
+
+static inline TBuffer *R__NewBasketBuffer(TBranch *branch, TBuffer::EMode mode, Int_t size)
+{
+   TBuffer *buffer = branch && branch->GetTree() ? branch->GetTree()->AcquireBasketBuffer(size) : nullptr;
+   if (!buffer)
+      return new TBufferFile(mode, size);
+   if (mode == TBuffer::kWrite)
+      buffer->SetWriteMode();
+   return buffer;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Delete a buffer of a basket of the branch, or give it back to the tree basket buffer pool.
+
+static inline void R__DeleteBasketBuffer(TBranch *branch, TBuffer *buffer)
+{
+   if (!buffer)
+      return;
+   if (!branch || !branch->GetTree() || !branch->GetTree()->ReleaseBasketBuffer(buffer))
+      delete buffer;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Basket normal constructor, used during writing.
 
@@ -66,7 +90,7 @@ TBasket::TBasket(const char *name, const char *title, TBranch *branch)
    SetTitle(title);
    fClassName   = "TBasket";
    fBuffer = nullptr;
-   fBufferRef   = new TBufferFile(TBuffer::kWrite, fBufferSize);
+   fBufferRef   = R__NewBasketBuffer(branch, TBuffer::kWrite, fBufferSize);
    fVersion    += 1000;
    if (branch->GetDirectory()) {
       TFile *file = branch->GetFile();
@@ -105,13 +129,13 @@ TBasket::~TBasket()
 {
    if (fDisplacement) delete [] fDisplacement;
    ResetEntryOffset();
-   if (fBufferRef) delete fBufferRef;
+   R__DeleteBasketBuffer(fBranch, fBufferRef);
    fBufferRef = 0;
    fBuffer = 0;
    fDisplacement= 0;
    // Note we only delete the compressed buffer if we own it
    if (fCompressedBufferRef && fOwnsCompressedBuffer) {
-      delete fCompressedBufferRef;
+      R__DeleteBasketBuffer(fBranch, fCompressedBufferRef);
       fCompressedBufferRef = 0;
    }
    // TKey::~TKey will use fMotherDir to attempt to remove they key
@@ -176,8 +200,8 @@ Int_t TBasket::DropBuffers()
 
    if (fDisplacement) delete [] fDisplacement;
    ResetEntryOffset();
-   if (fBufferRef)    delete fBufferRef;
-   if (fCompressedBufferRef && fOwnsCompressedBuffer) delete fCompressedBufferRef;
+   R__DeleteBasketBuffer(fBranch, fBufferRef);
+   if (fCompressedBufferRef && fOwnsCompressedBuffer) R__DeleteBasketBuffer(fBranch, fCompressedBufferRef);
    fBufferRef   = 0;
    fCompressedBufferRef = 0;
    fBuffer      = 0;
@@ -256,7 +280,7 @@ Int_t TBasket::LoadBasketBuffers(Long64_t pos, Int_t len, TFile *file, TTree *tr
       }
       fBufferRef->SetReadMode();
    } else {
-      fBufferRef = new TBufferFile(TBuffer::kRead, len);
+      fBufferRef = R__NewBasketBuffer(fBranch, TBuffer::kRead, len);
    }
    fBufferRef->SetParent(file);
    char *buffer = fBufferRef->Buffer();
@@ -407,7 +431,7 @@ Int_t TBasket::ReadBasketBuffersUnzip(char* buffer, Int_t size, Bool_t mustFree,
 ////////////////////////////////////////////////////////////////////////////////
 /// Initialize a buffer for reading if it is not already initialized
 
-static inline TBuffer* R__InitializeReadBasketBuffer(TBuffer* bufferRef, Int_t len, TFile* file)
+static inline TBuffer* R__InitializeReadBasketBuffer(TBuffer* bufferRef, Int_t len, TFile* file, TBranch* branch)
 {
    TBuffer* result;
    if (R__likely(bufferRef)) {
@@ -420,7 +444,7 @@ static inline TBuffer* R__InitializeReadBasketBuffer(TBuffer* bufferRef, Int_t l
       bufferRef->Reset();
       result = bufferRef;
    } else {
-      result = new TBufferFile(TBuffer::kRead, len);
+      result = R__NewBasketBuffer(branch, TBuffer::kRead, len);
    }
    result->SetParent(file);
    return result;
@@ -432,7 +456,7 @@ static inline TBuffer* R__InitializeReadBasketBuffer(TBuffer* bufferRef, Int_t l
 void inline TBasket::InitializeCompressedBuffer(Int_t len, TFile* file)
 {
    Bool_t compressedBufferExists = fCompressedBufferRef != NULL;
-   fCompressedBufferRef = R__InitializeReadBasketBuffer(fCompressedBufferRef, len, file);
+   fCompressedBufferRef = R__InitializeReadBasketBuffer(fCompressedBufferRef, len, file, fBranch);
    if (R__unlikely(!compressedBufferExists)) {
       fOwnsCompressedBuffer = kTRUE;
    }
@@ -470,6 +494,8 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
    Bool_t oldCase;
    char *rawUncompressedBuffer, *rawCompressedBuffer;
    Int_t uncompressedBufferLen;
+   Bool_t fromCache = kFALSE;
+   Double_t unzipTime = 0;
 
    // See if the cache has already unzipped the buffer for us.
    TFileCacheRead *pf = nullptr;
@@ -487,6 +513,7 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
          // Note that in the kNotDecompressed case, the above function will return 0;
          // In such a case, we should stop processing
          if (len <= 0) return -len;
+         fromCache = kTRUE;
          goto AfterBuffer;
       }
    }
@@ -496,11 +523,11 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
    TBuffer* readBufferRef;
    if (R__unlikely(fBranch->GetCompressionLevel()==0)) {
       // Initialize the buffer to hold the uncompressed data.
-      fBufferRef = R__InitializeReadBasketBuffer(fBufferRef, len, file);
+      fBufferRef = R__InitializeReadBasketBuffer(fBufferRef, len, file, fBranch);
       readBufferRef = fBufferRef;
    } else {
       // Initialize the buffer to hold the compressed data.
-      fCompressedBufferRef = R__InitializeReadBasketBuffer(fCompressedBufferRef, len, file);
+      fCompressedBufferRef = R__InitializeReadBasketBuffer(fCompressedBufferRef, len, file, fBranch);
       readBufferRef = fCompressedBufferRef;
    }
 
@@ -523,7 +550,9 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
       }
       if (st < 0) {
          return 1;
-      } else if (st == 0) {
+      } else if (st > 0) {
+         fromCache = kTRUE;
+      } else {
          // Read directly from file, not from the cache
          // If we are using a TTreeCache, disable reading from the default cache
          // temporarily, to force reading directly from file
@@ -582,7 +611,7 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
    // the zip headers; this is no longer beforehand as the buffer lifetime is scoped
    // to the TBranch.
    uncompressedBufferLen = len > fObjlen+fKeylen ? len : fObjlen+fKeylen;
-   fBufferRef = R__InitializeReadBasketBuffer(fBufferRef, uncompressedBufferLen, file);
+   fBufferRef = R__InitializeReadBasketBuffer(fBufferRef, uncompressedBufferLen, file, fBranch);
    rawUncompressedBuffer = fBufferRef->Buffer();
    fBuffer = rawUncompressedBuffer;
 
@@ -595,7 +624,7 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
 
       // Optional monitor for zip time profiling.
       Double_t start = 0;
-      if (R__unlikely(gPerfStats)) {
+      if (R__unlikely(gPerfStats || fBranch->GetTree()->GetPerfStats())) {
          start = TTimeStamp();
       }
 
@@ -634,6 +663,9 @@ Int_t TBasket::ReadBasketBuffers(Long64_t pos, Int_t len, TFile *file)
          return 1;
       }
       len = fObjlen+fKeylen;
+      if (R__unlikely(start != 0)) {
+         unzipTime = TTimeStamp() - start;
+      }
       TVirtualPerfStats* temp = gPerfStats;
       if (fBranch->GetTree()->GetPerfStats() != 0) gPerfStats = fBranch->GetTree()->GetPerfStats();
       if (R__unlikely(gPerfStats)) {
@@ -649,6 +681,10 @@ AfterBuffer:
 
    fBranch->GetTree()->IncrementTotalBuffers(fBufferSize);
 
+   if (TVirtualPerfStats *perfStats = fBranch->GetTree()->GetPerfStats()) {
+      perfStats->BasketReadEvent(fBranch, fNbytes, fObjlen, fromCache, unzipTime);
+   }
+
    // Read offsets table if needed.
    // If there's no EntryOffsetLen in the branch -- or the fEntryOffset is marked to be calculated-on-demand --
    // then we skip reading out.
@@ -720,7 +756,7 @@ void TBasket::DisownBuffer()
 /// Adopt a buffer from an external entity
 void TBasket::AdoptBuffer(TBuffer *user_buffer)
 {
-   delete fBufferRef;
+   R__DeleteBasketBuffer(fBranch, fBufferRef);
    fBufferRef = user_buffer;
 }
 
@@ -1139,16 +1175,13 @@ Int_t TBasket::WriteBuffer()
    }
    fMotherDir = file; // fBranch->GetDirectory();
 
-   // This mutex prevents multiple TBasket::WriteBuffer invocations from interacting
-   // with the underlying TFile at once - TFile is assumed to *not* be thread-safe.
-   //
-   // The only parallelism we'd like to exploit (right now!) is the compression
-   // step - everything else should be serialized at the TFile level.
+   if (R__unlikely(fBufferRef->TestBit(TBufferFile::kNotDecompressed))) {
+      // This mutex prevents multiple TBasket::WriteBuffer invocations from interacting
+      // with the underlying TFile at once - TFile is assumed to *not* be thread-safe.
 #ifdef R__USE_IMT
-   std::unique_lock<std::mutex> sentry(file->fWriteMutex);
+      std::lock_guard<std::mutex> sentry(file->fWriteMutex);
 #endif  // R__USE_IMT
 
-   if (R__unlikely(fBufferRef->TestBit(TBufferFile::kNotDecompressed))) {
       // Read the basket information that was saved inside the buffer.
       Bool_t writing = fBufferRef->IsWriting();
       fBufferRef->SetReadMode();
@@ -1170,6 +1203,24 @@ Int_t TBasket::WriteBuffer()
       return nBytes>0 ? fKeylen+nout : -1;
    }
 
+   // The only parallelism we'd like to exploit (right now!) is the compression
+   // step - everything else is serialized at the TFile level by CommitBuffer.
+   Int_t nout = CompressBuffer(file);
+   if (nout < 0)
+      return -1;
+   return CommitBuffer(file, nout, fBranch->GetWriteBasket());
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Prepare the buffer of this basket to be written on `file`: transfer the
+/// entry offsets at the end of the buffer and compress it.
+///
+/// The file is only queried for its compression settings, so that several
+/// baskets can be compressed at once. On return fBuffer points to the data to
+/// be written, whose size (without the key) is returned; -1 signals an error.
+
+Int_t TBasket::CompressBuffer(TFile *file)
+{
    // Transfer fEntryOffset table at the end of fBuffer.
    fLast = fBufferRef->Length();
    Int_t *entryOffset = GetEntryOffset();
@@ -1208,84 +1259,87 @@ Int_t TBasket::WriteBuffer()
 
    fObjlen = fBufferRef->Length() - fKeylen;
 
-   fHeaderOnly = kTRUE;
-   fCycle = fBranch->GetWriteBasket();
    Int_t cxlevel = fBranch->GetCompressionLevel();
    if (cxlevel == ROOT::RCompressionSetting::ELevel::kInherit)
       cxlevel = file->GetCompressionLevel();
    ROOT::RCompressionSetting::EAlgorithm::EValues cxAlgorithm = static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(fBranch->GetCompressionAlgorithm());
    if (cxAlgorithm == ROOT::RCompressionSetting::EAlgorithm::kInherit)
       cxAlgorithm = static_cast<ROOT::RCompressionSetting::EAlgorithm::EValues>(file->GetCompressionAlgorithm());
-   if (cxlevel > 0) {
-      Int_t nbuffers = 1 + (fObjlen - 1) / kMAXZIPBUF;
-      Int_t buflen = fKeylen + fObjlen + 9 * nbuffers + 28; //add 28 bytes in case object is placed in a deleted gap
-      InitializeCompressedBuffer(buflen, file);
-      if (!fCompressedBufferRef) {
-         Warning("WriteBuffer", "Unable to allocate the compressed buffer");
-         return -1;
+   if (cxlevel <= 0) {
+      fBuffer = fBufferRef->Buffer();
+      return fObjlen;
+   }
+   UInt_t zstdDictId = file->GetZstdDictionaryId();
+
+   Int_t nbuffers = 1 + (fObjlen - 1) / kMAXZIPBUF;
+   Int_t buflen = fKeylen + fObjlen + 9 * nbuffers + 28; //add 28 bytes in case object is placed in a deleted gap
+   InitializeCompressedBuffer(buflen, file);
+   if (!fCompressedBufferRef) {
+      Warning("WriteBuffer", "Unable to allocate the compressed buffer");
+      return -1;
+   }
+   fCompressedBufferRef->SetWriteMode();
+   fBuffer = fCompressedBufferRef->Buffer();
+   char *objbuf = fBufferRef->Buffer() + fKeylen;
+   char *bufcur = &fBuffer[fKeylen];
+   noutot = 0;
+   nzip   = 0;
+   for (Int_t i = 0; i < nbuffers; ++i) {
+      if (i == nbuffers - 1) bufmax = fObjlen - nzip;
+      else bufmax = kMAXZIPBUF;
+      // Compress the buffer.  Note that we allow multiple TBasket compressions to occur at once
+      // for a given TFile: that's because the compression buffer when we use IMT is no longer
+      // shared amongst several threads.
+      // NOTE this is declared with C linkage, so it shouldn't except.  Also, when
+      // USE_IMT is defined, we are guaranteed that the compression buffer is unique per-branch.
+      // (see fCompressedBufferRef in constructor).
+      R__zipMultipleAlgorithmDict(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm, zstdDictId);
+
+      // test if buffer has really been compressed. In case of small buffers
+      // when the buffer contains random data, it may happen that the compressed
+      // buffer is larger than the input. In this case, we write the original uncompressed buffer
+      if (nout == 0 || nout >= fObjlen) {
+         // We used to delete fBuffer here, we no longer want to since
+         // the buffer (held by fCompressedBufferRef) might be re-used later.
+         fBuffer = fBufferRef->Buffer();
+         if ((fObjlen+fKeylen)>buflen) {
+            Warning("WriteBuffer","Possible memory corruption due to compression algorithm, wrote %d bytes past the end of a block of %d bytes. fObjLen=%d, fKeylen=%d",
+               (fObjlen+fKeylen-buflen),buflen,fObjlen,fKeylen);
+         }
+         return fObjlen;
       }
-      fCompressedBufferRef->SetWriteMode();
-      fBuffer = fCompressedBufferRef->Buffer();
-      char *objbuf = fBufferRef->Buffer() + fKeylen;
-      char *bufcur = &fBuffer[fKeylen];
-      noutot = 0;
-      nzip   = 0;
-      for (Int_t i = 0; i < nbuffers; ++i) {
-         if (i == nbuffers - 1) bufmax = fObjlen - nzip;
-         else bufmax = kMAXZIPBUF;
-         // Compress the buffer.  Note that we allow multiple TBasket compressions to occur at once
-         // for a given TFile: that's because the compression buffer when we use IMT is no longer
-         // shared amongst several threads.
-#ifdef R__USE_IMT
-         sentry.unlock();
-#endif  // R__USE_IMT
-         // NOTE this is declared with C linkage, so it shouldn't except.  Also, when
-         // USE_IMT is defined, we are guaranteed that the compression buffer is unique per-branch.
-         // (see fCompressedBufferRef in constructor).
-         R__zipMultipleAlgorithm(cxlevel, &bufmax, objbuf, &bufmax, bufcur, &nout, cxAlgorithm);
+      bufcur += nout;
+      noutot += nout;
+      objbuf += kMAXZIPBUF;
+      nzip   += kMAXZIPBUF;
+   }
+   return noutot;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Write the buffer prepared by CompressBuffer, of `nout` bytes, on `file`
+/// with the given key cycle.
+///
+/// The function returns the number of bytes committed to the memory.
+/// If a write error occurs, the number of bytes returned is -1.
+
+Int_t TBasket::CommitBuffer(TFile *file, Int_t nout, Int_t cycle)
+{
+   // This mutex prevents multiple TBasket::WriteBuffer invocations from interacting
+   // with the underlying TFile at once - TFile is assumed to *not* be thread-safe.
 #ifdef R__USE_IMT
-         sentry.lock();
+   std::lock_guard<std::mutex> sentry(file->fWriteMutex);
 #endif  // R__USE_IMT
 
-         // test if buffer has really been compressed. In case of small buffers
-         // when the buffer contains random data, it may happen that the compressed
-         // buffer is larger than the input. In this case, we write the original uncompressed buffer
-         if (nout == 0 || nout >= fObjlen) {
-            nout = fObjlen;
-            // We used to delete fBuffer here, we no longer want to since
-            // the buffer (held by fCompressedBufferRef) might be re-used later.
-            fBuffer = fBufferRef->Buffer();
-            Create(fObjlen,file);
-            fBufferRef->SetBufferOffset(0);
-
-            Streamer(*fBufferRef);         //write key itself again
-            if ((nout+fKeylen)>buflen) {
-               Warning("WriteBuffer","Possible memory corruption due to compression algorithm, wrote %d bytes past the end of a block of %d bytes. fNbytes=%d, fObjLen=%d, fKeylen=%d",
-                  (nout+fKeylen-buflen),buflen,fNbytes,fObjlen,fKeylen);
-            }
-            goto WriteFile;
-         }
-         bufcur += nout;
-         noutot += nout;
-         objbuf += kMAXZIPBUF;
-         nzip   += kMAXZIPBUF;
-      }
-      nout = noutot;
-      Create(noutot,file);
-      fBufferRef->SetBufferOffset(0);
+   fHeaderOnly = kTRUE;
+   fCycle = cycle;
+   Create(nout,file);
+   fBufferRef->SetBufferOffset(0);
 
-      Streamer(*fBufferRef);         //write key itself again
+   Streamer(*fBufferRef);         //write key itself again
+   if (fBuffer != fBufferRef->Buffer())
       memcpy(fBuffer,fBufferRef->Buffer(),fKeylen);
-   } else {
-      fBuffer = fBufferRef->Buffer();
-      Create(fObjlen,file);
-      fBufferRef->SetBufferOffset(0);
-
-      Streamer(*fBufferRef);         //write key itself again
-      nout = fObjlen;
-   }
 
-WriteFile:
    Int_t nBytes = WriteFileKeepBuffer();
    fHeaderOnly = kFALSE;
    return nBytes>0 ? fKeylen+nout : -1;
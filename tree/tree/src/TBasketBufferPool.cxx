@@ -0,0 +1,117 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#include "TBasketBufferPool.h"
+#include "TBufferFile.h"
+
+#include <algorithm>
+
+namespace {
+
+/// Smallest n such that 2^n >= size.
+Int_t CeilLog2(Long64_t size)
+{
+   Int_t n = 0;
+   while ((Long64_t(1) << n) < size)
+      ++n;
+   return n;
+}
+
+/// Largest n such that 2^n <= size.
+Int_t FloorLog2(Long64_t size)
+{
+   Int_t n = 0;
+   while ((Long64_t(1) << (n + 1)) <= size)
+      ++n;
+   return n;
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Delete all the pooled buffers.
+
+ROOT::Internal::TBasketBufferPool::~TBasketBufferPool()
+{
+   for (auto &buffers : fFreeBuffers) {
+      for (auto buffer : buffers)
+         delete buffer;
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return a buffer in read mode of at least `size` bytes.
+/// The caller owns the buffer and hands it back with Release() or deletes it.
+
+TBuffer *ROOT::Internal::TBasketBufferPool::Acquire(Int_t size)
+{
+   Int_t sizeClass = std::max(CeilLog2(size), kMinSizeClass);
+   if (sizeClass - kMinSizeClass >= kNSizeClasses)
+      return new TBufferFile(TBuffer::kRead, size);
+
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      auto take = [this](std::vector<TBuffer *> &buffers, std::size_t i) {
+         TBuffer *buffer = buffers[i];
+         buffers[i] = buffers.back();
+         buffers.pop_back();
+         fPooledBytes -= buffer->BufferSize();
+         return buffer;
+      };
+      // All buffers of the size class are large enough.
+      auto &buffers = fFreeBuffers[sizeClass - kMinSizeClass];
+      if (!buffers.empty())
+         return take(buffers, buffers.size() - 1);
+      // Buffers of the class below might be large enough, e.g. a buffer of 33000 bytes for 32800 bytes.
+      if (sizeClass > kMinSizeClass) {
+         auto &smaller = fFreeBuffers[sizeClass - kMinSizeClass - 1];
+         for (std::size_t i = 0; i < smaller.size(); ++i) {
+            if (smaller[i]->BufferSize() >= size)
+               return take(smaller, i);
+         }
+      }
+      // Rather than allocating, accept a buffer of the class above.
+      if (sizeClass - kMinSizeClass + 1 < kNSizeClasses) {
+         auto &larger = fFreeBuffers[sizeClass - kMinSizeClass + 1];
+         if (!larger.empty())
+            return take(larger, larger.size() - 1);
+      }
+   }
+   return new TBufferFile(TBuffer::kRead, size);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Take ownership of a buffer no longer used by a basket.
+/// Return false, leaving the buffer to the caller, if the buffer cannot be pooled:
+/// it does not own its memory, it is of an unexpected type or the pool is full.
+
+Bool_t ROOT::Internal::TBasketBufferPool::Release(TBuffer *buffer)
+{
+   if (!buffer || buffer->IsA() != TBufferFile::Class() || !buffer->TestBit(TBuffer::kIsOwner))
+      return kFALSE;
+   const Int_t size = buffer->BufferSize();
+   const Int_t sizeClass = FloorLog2(size);
+   if (sizeClass < kMinSizeClass || sizeClass - kMinSizeClass >= kNSizeClasses)
+      return kFALSE;
+
+   buffer->SetParent(nullptr);
+   buffer->ResetMap();
+   buffer->SetPidOffset(0);
+   buffer->ResetBit(TBufferFile::kNotDecompressed);
+   buffer->SetReadMode();
+   buffer->Reset();
+
+   std::lock_guard<std::mutex> lock(fMutex);
+   if (fPooledBytes + size > fMaxBytes)
+      return kFALSE;
+   fFreeBuffers[sizeClass - kMinSizeClass].push_back(buffer);
+   fPooledBytes += size;
+   return kTRUE;
+}
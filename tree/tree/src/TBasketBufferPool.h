@@ -0,0 +1,65 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TBasketBufferPool
+#define ROOT_TBasketBufferPool
+
+#include "RtypesCore.h"
+
+#include <array>
+#include <mutex>
+#include <vector>
+
+class TBuffer;
+
+/** \class ROOT::Internal::TBasketBufferPool
+ A pool of basket buffers shared by the branches of a TTree.
+
+ Instead of being deleted when a basket drops its buffers, the buffers are kept
+ in the pool, bucketed by power-of-two size classes, and handed out again when
+ a basket needs a new one. The total size of the pooled buffers is bounded; a
+ buffer that would exceed the bound is deleted. The pool can be used
+ concurrently by several threads.
+*/
+
+namespace ROOT {
+namespace Internal {
+
+class TBasketBufferPool {
+public:
+   explicit TBasketBufferPool(Long64_t maxBytes) : fMaxBytes(maxBytes) {}
+   TBasketBufferPool(const TBasketBufferPool &) = delete;
+   TBasketBufferPool &operator=(const TBasketBufferPool &) = delete;
+   ~TBasketBufferPool();
+
+   TBuffer *Acquire(Int_t size);
+   Bool_t Release(TBuffer *buffer);
+
+   Long64_t GetMaxBytes() const { return fMaxBytes; }
+   Long64_t GetPooledBytes() const
+   {
+      std::lock_guard<std::mutex> lock(fMutex);
+      return fPooledBytes;
+   }
+
+private:
+   static constexpr Int_t kMinSizeClass = 9;  ///< Smallest pooled buffers have 2^9 bytes
+   static constexpr Int_t kNSizeClasses = 22; ///< Largest pooled buffers have 2^30 bytes
+
+   mutable std::mutex fMutex;                                     ///< Protects the free lists
+   std::array<std::vector<TBuffer *>, kNSizeClasses> fFreeBuffers; ///< Free buffers, by size class
+   Long64_t fMaxBytes;                                            ///< Upper bound of fPooledBytes
+   Long64_t fPooledBytes = 0;                                     ///< Total size of the free buffers
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
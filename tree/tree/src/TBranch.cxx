@@ -40,15 +40,18 @@
 #include "TROOT.h"
 #include "TSystem.h"
 #include "TMath.h"
+#include "TTimeStamp.h"
 #include "TTree.h"
 #include "TTreeCache.h"
 #include "TTreeCacheUnzip.h"
+#include "TVirtualCollectionProxy.h"
 #include "TVirtualMutex.h"
 #include "TVirtualPad.h"
 #include "TVirtualPerfStats.h"
 #include "strlcpy.h"
 #include "snprintf.h"
 
+#include "TAsyncBasketWriter.h"
 #include "TBranchIMTHelper.h"
 
 #include "ROOT/TIOFeatures.hxx"
@@ -61,6 +64,11 @@
 
 Int_t TBranch::fgCount = 0;
 
+namespace {
+// Flag set in the byte count preceding a streamed object or collection, see TBufferFile.
+const UInt_t kBulkByteCountMask = 0x40000000;
+}
+
 /** \class TBranch
 \ingroup tree
 
@@ -449,6 +457,8 @@ void TBranch::Init(const char* name, const char* leaflist, Int_t compress)
 
 TBranch::~TBranch()
 {
+   WaitPendingWrites();
+
    delete fBrowsables;
    fBrowsables = 0;
 
@@ -927,6 +937,106 @@ Int_t TBranch::FillImpl(ROOT::Internal::TBranchIMTHelper *imtHelper)
    return nbytes;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Copy `nbytes` bytes of elements of size `elemsize` from `src` to `dst`, in
+/// the big-endian order used in the baskets.
+
+template <unsigned N>
+static void CopyBigEndian(char *dst, const char *src, Int_t n)
+{
+   using value_type = typename RByteSwap<N>::value_type;
+   for (Int_t i = 0; i < n; ++i) {
+      value_type x;
+      memcpy(&x, src + i * N, N);
+#ifdef R__BYTESWAP
+      x = RByteSwap<N>::bswap(x);
+#endif
+      memcpy(dst + i * N, &x, N);
+   }
+}
+
+static void CopyBigEndian(char *dst, const char *src, Int_t nbytes, Int_t elemsize)
+{
+   switch (elemsize) {
+   case 2: CopyBigEndian<2>(dst, src, nbytes / 2); break;
+   case 4: CopyBigEndian<4>(dst, src, nbytes / 4); break;
+   case 8: CopyBigEndian<8>(dst, src, nbytes / 8); break;
+   default: memcpy(dst, src, nbytes);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return whether this branch can be filled by FillFlat, i.e. whether it is a
+/// plain TBranch with a single leaf holding a fixed number of values of a basic
+/// type at the branch address, written without entry offsets. If so, set the
+/// number of bytes written per entry and the size of one element.
+
+Bool_t TBranch::CanFillFlat(Int_t &nbytes, Int_t &elemsize) const
+{
+   if (IsA() != TBranch::Class() || fEntryBuffer || fEntryOffsetLen || !fAddress)
+      return kFALSE;
+   if (fBranches.GetEntriesFast() || fLeaves.GetEntriesFast() != 1)
+      return kFALSE;
+   auto leaf = static_cast<TLeaf *>(fLeaves.UncheckedAt(0));
+   // Leaves which are counters of other leaves record their maximum in FillBasket.
+   if (leaf->GetLeafCount() || leaf->IsRange())
+      return kFALSE;
+   TClass *cl = leaf->IsA();
+   if (cl != TLeafB::Class() && cl != TLeafS::Class() && cl != TLeafI::Class() && cl != TLeafL::Class() &&
+       cl != TLeafF::Class() && cl != TLeafD::Class() && cl != TLeafO::Class())
+      return kFALSE;
+   if (leaf->GetValuePointer() != fAddress + leaf->GetOffset())
+      return kFALSE;
+   elemsize = leaf->GetLenType();
+   nbytes = leaf->GetLen() * elemsize;
+   return nbytes > 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the current entry of a branch accepted by CanFillFlat, copying the
+/// `nbytes` bytes at `src` into the basket buffer. This is the equivalent of
+/// FillImpl without the dispatch to the leaves and the buffer map handling.
+
+Int_t TBranch::FillFlat(const char *src, Int_t nbytes, Int_t elemsize, ROOT::Internal::TBranchIMTHelper *imtHelper)
+{
+   TBasket *basket = (TBasket *)fBaskets.UncheckedAt(fWriteBasket);
+   if (!basket) {
+      basket = fTree->CreateBasket(this); //  create a new basket
+      if (!basket) return 0;
+      ++fNBaskets;
+      fBaskets.AddAtAndExpand(basket, fWriteBasket);
+   }
+   TBuffer *buf = basket->GetBufferRef();
+   if (buf->IsReading()) {
+      basket->SetWriteMode();
+   }
+
+   Int_t lold = buf->Length();
+   basket->Update(lold);
+   ++fEntries;
+   ++fEntryNumber;
+   if (lold + nbytes > buf->BufferSize())
+      buf->AutoExpand(lold + nbytes);
+   CopyBigEndian(buf->Buffer() + lold, src, nbytes, elemsize);
+   buf->SetBufferOffset(lold + nbytes);
+   Int_t lnew = lold + nbytes;
+
+   if (!basket->GetNevBufSize()) {
+      basket->SetNevBufSize(nbytes);
+   }
+
+   // Same condition as in FillImpl, there are no entry offsets.
+   bool noFlushAtCluster = !fTree->TestBit(TTree::kOnlyFlushAtCluster) || (fTree->GetAutoFlush() < 0);
+   if (noFlushAtCluster && !fTree->TestBit(TTree::kCircular) &&
+       ((fSkipZip && (lnew >= TBuffer::kMinimalSize)) || (buf->TestBit(TBufferFile::kNotDecompressed)) ||
+        ((lnew + nbytes) >= fBasketSize))) {
+      Int_t nout = WriteBasketImpl(basket, fWriteBasket, imtHelper);
+      if (nout < 0) Error("TBranch::Fill", "Failed to write out basket.\n");
+      return (nout >= 0) ? nbytes : -1;
+   }
+   return nbytes;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Copy the data from fEntryBuffer into the current basket.
 
@@ -1183,7 +1293,9 @@ Int_t TBranch::FlushOneBasket(UInt_t ibasket)
    if (fDirectory && fBaskets.GetEntriesFast()) {
       TBasket *basket = (TBasket*)fBaskets.UncheckedAt(ibasket);
 
-      if (basket) {
+      if (basket && basket->fPendingWrite) {
+         // Already handed to the background compression; TTree::WaitAsyncBasketWrites writes it.
+      } else if (basket) {
          if (basket->GetNevBuf()
              && fBasketSeek[ibasket]==0) {
             // If the basket already contains entry we need to close it out.
@@ -1232,6 +1344,11 @@ TBasket* TBranch::GetBasketImpl(Int_t basketnumber, TBuffer *user_buffer)
       // reference to an existing basket in memory ?
    if (basketnumber <0 || basketnumber > fWriteBasket) return 0;
    TBasket *basket = (TBasket*)fBaskets.UncheckedAt(basketnumber);
+   if (basket && basket->fPendingWrite) {
+      // The basket is being compressed in the background; read it back once written.
+      WaitPendingWrites();
+      basket = (TBasket*)fBaskets.UncheckedAt(basketnumber);
+   }
    if (basket) return basket;
    if (basketnumber == fWriteBasket) return 0;
 
@@ -1460,19 +1577,203 @@ Int_t TBranch::GetBulkEntries(Long64_t entry, TBuffer &user_buf)
       return -1;
    }
 
+   Long64_t first;
+   TBasket *basket = PrepareBulkBasket(entry, user_buf, first, "GetBulkEntries");
+   if (R__unlikely(!basket)) return -1;
+
+   Int_t bufbegin = basket->GetKeylen();
+   user_buf.SetBufferOffset(bufbegin);
+
+   Int_t N = ((fNextBasketEntry < 0) ? fEntryNumber : fNextBasketEntry) - first;
+   //printf("Requesting %d events; fNextBasketEntry=%lld; first=%lld.\n", N, fNextBasketEntry, first);
+   if (R__unlikely(!leaf->ReadBasketFast(user_buf, N))) {
+      Error("GetBulkEntries", "Leaf failed to read.\n");
+      return -1;
+   }
+   user_buf.SetBufferOffset(bufbegin);
+
+   ReleaseBulkBasket(basket);
+
+   return N;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Returns true if this branch supports bulk IO of arrays with offsets, false otherwise.
+///
+/// In addition to the branches supported by SupportsBulkRead(), this covers
+/// variable-size arrays of primitives (`f[n]/F`) and unsplittable
+/// `std::vector` of primitives (e.g. `std::vector<float>` or a split
+/// member of such type).  See GetBulkEntries(Long64_t, TBuffer&, std::vector<Int_t>&).
+Bool_t TBranch::SupportsBulkArrayRead() const
+{
+   Int_t elementSize, headerSize;
+   return GetBulkArrayLayout(elementSize, headerSize);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Determine the on-disk layout of an array-valued entry in this branch.
+///
+/// On success, `elementSize` is the size of one array element and `headerSize`
+/// is the number of bytes preceding the elements of each entry (0 for leaf
+/// arrays, the collection header for `std::vector`). Returns false if the
+/// branch cannot be read in bulk as an array.
+Bool_t TBranch::GetBulkArrayLayout(Int_t &elementSize, Int_t &headerSize) const
+{
+   if (fNleaves != 1)
+      return kFALSE;
+   TLeaf *leaf = static_cast<TLeaf*>(fLeaves.UncheckedAt(0));
+   auto deserializeType = leaf->GetDeserializeType();
+   if ((deserializeType == TLeaf::DeserializeType::kInPlace) ||
+       (deserializeType == TLeaf::DeserializeType::kZeroCopy)) {
+      elementSize = leaf->GetLenType();
+      headerSize = 0;
+      return elementSize > 0;
+   }
+   if (deserializeType != TLeaf::DeserializeType::kExternal)
+      return kFALSE;
+
+   // Check for a std::vector of primitives, streamed as a collection header followed by the elements.
+   TClass *clptr = nullptr;
+   EDataType type = EDataType::kOther_t;
+   if (const_cast<TBranch*>(this)->GetExpectedType(clptr, type) || !clptr)
+      return kFALSE;
+   TVirtualCollectionProxy *proxy = clptr->GetCollectionProxy();
+   if (!proxy || proxy->GetCollectionType() != ROOT::kSTLvector || proxy->GetValueClass() || proxy->HasPointers())
+      return kFALSE;
+   switch (proxy->GetType()) {
+   case kChar_t: case kUChar_t: case kBool_t:
+   case kShort_t: case kUShort_t:
+   case kInt_t: case kUInt_t: case kFloat_t:
+   case kLong64_t: case kULong64_t: case kDouble_t:
+      break;
+   default:
+      return kFALSE;
+   }
+   elementSize = TDataType::GetDataType(proxy->GetType())->Size();
+   // Byte count (4 bytes), class version (2 bytes) and number of elements (4 bytes).
+   headerSize = 10;
+   return kTRUE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Read as many array-valued events as possible into the given buffer.
+///
+/// This is the counterpart of GetBulkEntries(Long64_t, TBuffer&) for fixed-size
+/// array leaves, variable-size array leaves and `std::vector` of primitives.
+/// Returns -1 in case of a failure.  On success, returns the (non-zero) number of
+/// events N in the buffer and fills `offsets` with N+1 element indices; the
+/// elements of event `i` are
+///
+/// static_cast<T*>(buf.GetCurrent())[offsets[i]] ... [offsets[i+1] - 1]
+///
+/// where T is the element type stored on this branch. The collection headers of
+/// `std::vector` entries are stripped in-place, so the elements of all events are
+/// contiguous in memory and in host byte order.
+///
+/// NOTES:
+/// - This interface is meant to be used by higher-level, type-safe wrappers, not
+///   by end-users.
+/// - Like GetBulkEntries(), this only reads from the start of a basket.
+
+Int_t TBranch::GetBulkEntries(Long64_t entry, TBuffer &user_buf, std::vector<Int_t> &offsets)
+{
+   Int_t elementSize, headerSize;
+   if (R__unlikely(!GetBulkArrayLayout(elementSize, headerSize))) return -1;
+   TLeaf *leaf = static_cast<TLeaf*>(fLeaves.UncheckedAt(0));
+
+   Long64_t first;
+   TBasket *basket = PrepareBulkBasket(entry, user_buf, first, "GetBulkEntries");
+   if (R__unlikely(!basket)) return -1;
+
+   Int_t bufbegin = basket->GetKeylen();
+   Int_t N = ((fNextBasketEntry < 0) ? fEntryNumber : fNextBasketEntry) - first;
+   offsets.resize(N + 1);
+   offsets[0] = 0;
+
+   Int_t *entryOffset = basket->GetEntryOffset();
+   if (!entryOffset) {
+      // Fixed-size entries; only valid for leaves without a collection header.
+      if (R__unlikely(headerSize != 0)) {
+         Error("GetBulkEntries", "Branch %s has no entry offsets.\n", GetName());
+         return -1;
+      }
+      Int_t nElements = leaf->GetLen();
+      for (Int_t i = 0; i < N; ++i)
+         offsets[i + 1] = offsets[i] + nElements;
+   } else {
+      // Without a count leaf, entries must be of fixed size; variable-size arrays in split classes carry extra
+      // markers that we do not support.
+      Int_t fixedBytes = (headerSize == 0 && !leaf->GetLeafCount()) ? leaf->GetLen() * elementSize : -1;
+      char *base = user_buf.Buffer();
+      Int_t last = basket->GetLast();
+      Int_t dst = bufbegin;
+      for (Int_t i = 0; i < N; ++i) {
+         Int_t begin = entryOffset[i];
+         Int_t end = (i + 1 < N) ? entryOffset[i + 1] : last;
+         Int_t nBytes = end - begin - headerSize;
+         if (R__unlikely(nBytes < 0 || (nBytes % elementSize) != 0 || (fixedBytes >= 0 && nBytes != fixedBytes))) {
+            Error("GetBulkEntries", "Unexpected size of entry %lld in branch %s.\n", first + i, GetName());
+            return -1;
+         }
+         if (headerSize) {
+            char *header = base + begin;
+            UInt_t byteCount;
+            Version_t version;
+            Int_t nElements;
+            frombuf(header, &byteCount);
+            frombuf(header, &version);
+            frombuf(header, &nElements);
+            if (R__unlikely(!(byteCount & kBulkByteCountMask) ||
+                            (byteCount & ~kBulkByteCountMask) != UInt_t(end - begin - sizeof(UInt_t)) ||
+                            (version & TBufferFile::kStreamedMemberWise) || nElements * elementSize != nBytes)) {
+               Error("GetBulkEntries", "Unexpected collection header in entry %lld of branch %s.\n", first + i,
+                     GetName());
+               return -1;
+            }
+            // Compact the elements in-place; the destination never overtakes the source.
+            memmove(base + dst, base + begin + headerSize, nBytes);
+         }
+         dst += nBytes;
+         offsets[i + 1] = offsets[i] + nBytes / elementSize;
+      }
+   }
+
+   user_buf.SetBufferOffset(bufbegin);
+   if (elementSize > 1) {
+      EDataType swapType = (elementSize == 2) ? kShort_t : ((elementSize == 4) ? kInt_t : kLong64_t);
+      if (R__unlikely((elementSize != 2 && elementSize != 4 && elementSize != 8) ||
+                      !user_buf.ByteSwapBuffer(offsets[N], swapType))) {
+         Error("GetBulkEntries", "Leaf failed to read.\n");
+         return -1;
+      }
+   }
+
+   ReleaseBulkBasket(basket);
+
+   return N;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Load the basket starting at `entry` for bulk IO, backed by `user_buf`.
+///
+/// On success, `user_buf` holds the basket's data and `first` is the first entry
+/// of the basket.  Returns nullptr on failure, e.g. if `entry` is not the first
+/// entry of a basket.
+
+TBasket *TBranch::PrepareBulkBasket(Long64_t entry, TBuffer &user_buf, Long64_t &first, const char *location)
+{
    // Remember which entry we are reading.
    fReadEntry = entry;
 
    Bool_t enabled = !TestBit(kDoNotProcess);
-   if (R__unlikely(!enabled)) return -1;
+   if (R__unlikely(!enabled)) return nullptr;
    TBasket *basket = nullptr;
-   Long64_t first;
    Int_t result = GetBasketAndFirst(basket, first, &user_buf);
-   if (R__unlikely(result < 0)) return -1;
+   if (R__unlikely(result < 0)) return nullptr;
    // Only support reading from full clusters.
    if (R__unlikely(entry != first)) {
        //printf("Failed to read from full cluster; first entry is %ld; requested entry is %ld.\n", first, entry);
-       return -1;
+       return nullptr;
    }
 
    basket->PrepareBasket(entry);
@@ -1480,13 +1781,13 @@ Int_t TBranch::GetBulkEntries(Long64_t entry, TBuffer &user_buf)
 
    // Test for very old ROOT files.
    if (R__unlikely(!buf)) {
-      Error("GetBulkEntries", "Failed to get a new buffer.\n");
-      return -1;
+      Error(location, "Failed to get a new buffer.\n");
+      return nullptr;
    }
    // Test for displacements, which aren't supported in fast mode.
    if (R__unlikely(basket->GetDisplacement())) {
-      Error("GetBulkEntries", "Basket has displacement.\n");
-      return -1;
+      Error(location, "Basket has displacement.\n");
+      return nullptr;
    }
 
    if (&user_buf != buf) {
@@ -1508,24 +1809,19 @@ Int_t TBranch::GetBulkEntries(Long64_t entry, TBuffer &user_buf)
       }
    }
 
-   Int_t bufbegin = basket->GetKeylen();
-   user_buf.SetBufferOffset(bufbegin);
+   return basket;
+}
 
-   Int_t N = ((fNextBasketEntry < 0) ? fEntryNumber : fNextBasketEntry) - first;
-   //printf("Requesting %d events; fNextBasketEntry=%lld; first=%lld.\n", N, fNextBasketEntry, first);
-   if (R__unlikely(!leaf->ReadBasketFast(user_buf, N))) {
-      Error("GetBulkEntries", "Leaf failed to read.\n");
-      return -1;
-   }
-   user_buf.SetBufferOffset(bufbegin);
+////////////////////////////////////////////////////////////////////////////////
+/// Once a bulk read is done, recycle a basket that no longer owns the user's buffer.
 
+void TBranch::ReleaseBulkBasket(TBasket *basket)
+{
    if (fCurrentBasket == nullptr) {
       R__ASSERT(fExtraBasket == nullptr && "fExtraBasket should have been set to nullptr by GetFreshBasket");
       fExtraBasket = basket;
       basket->DisownBuffer();
    }
-
-   return N;
 }
 
 // TODO: Template this and the call above; only difference is the TLeaf function (ReadBasketFast vs
@@ -1688,6 +1984,13 @@ Int_t TBranch::GetEntry(Long64_t entry, Int_t getall)
    }
 
    // Int_t bufbegin = buf->Length();
+   TVirtualPerfStats *perfStats = fTree->GetPerfStats();
+   if (R__unlikely(perfStats)) {
+      Double_t start = TTimeStamp();
+      (this->*fReadLeaves)(*buf);
+      perfStats->DeserializeEvent(this, buf->Length() - bufbegin, start);
+      return buf->Length() - bufbegin;
+   }
    (this->*fReadLeaves)(*buf);
    return buf->Length() - bufbegin;
 }
@@ -2473,6 +2776,8 @@ void TBranch::Refresh(TBranch* b)
 
 void TBranch::Reset(Option_t*)
 {
+   WaitPendingWrites();
+
    fReadBasket = 0;
    fReadEntry = -1;
    fFirstBasketEntry = -1;
@@ -2514,6 +2819,8 @@ void TBranch::Reset(Option_t*)
 
 void TBranch::ResetAfterMerge(TFileMergeInfo *)
 {
+   WaitPendingWrites();
+
    fReadBasket       = 0;
    fReadEntry        = -1;
    fFirstBasketEntry = -1;
@@ -3127,6 +3434,14 @@ Int_t TBranch::WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBr
       fEntryOffsetLen = 2*nevbuf; // assume some fluctuations.
    }
 
+   ROOT::Internal::TAsyncBasketWriter *asyncWriter = imtHelper ? nullptr : fTree->GetAsyncBasketWriter();
+   if (asyncWriter && where == fWriteBasket && !basket->GetBufferRef()->TestBit(TBufferFile::kNotDecompressed)) {
+      constexpr Int_t kWrite = 1;
+      TFile *file = GetFile(kWrite);
+      if (file && file->IsWritable())
+         return WriteBasketAsync(basket, file, *asyncWriter);
+   }
+
    // Note: captures `basket`, `where`, and `this` by value; modifies the TBranch and basket,
    // as we make a copy of the pointer.  We cannot capture `basket` by reference as the pointer
    // itself might be modified after `WriteBasketImpl` exits.
@@ -3190,6 +3505,79 @@ Int_t TBranch::WriteBasketImpl(TBasket* basket, Int_t where, ROOT::Internal::TBr
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Hand the current write basket to the background compression of the tree
+/// and move to the next write basket; FillImpl creates a new one.
+///
+/// The basket stays in fBaskets until the writer commits it, on this thread:
+/// the key is then written to `file`, the branch updated and the basket deleted.
+/// Returns 0, as the number of bytes written is not known yet.
+
+Int_t TBranch::WriteBasketAsync(TBasket *basket, TFile *file, ROOT::Internal::TAsyncBasketWriter &writer)
+{
+   // The basket is compressed concurrently with the next ones: it needs its own compression buffer.
+   if (!basket->fOwnsCompressedBuffer)
+      basket->fCompressedBufferRef = nullptr;
+   basket->fMotherDir = file;
+   basket->fPendingWrite = kTRUE;
+   ++fNPendingWrites;
+
+   const Int_t where = fWriteBasket;
+   ++fWriteBasket;
+   if (fWriteBasket >= fMaxBaskets) {
+      ExpandBasketArrays();
+   }
+   if (basket == fCurrentBasket) {
+      fCurrentBasket    = 0;
+      fFirstBasketEntry = -1;
+      fNextBasketEntry  = -1;
+   }
+   fBaskets.AddAtAndExpand(nullptr, fWriteBasket);
+   fBasketEntry[fWriteBasket] = fEntryNumber;
+
+   auto compress = [basket, file]() { return basket->CompressBuffer(file); };
+   auto commit = [this, basket, file, where](Int_t nout) {
+      basket->fPendingWrite = kFALSE;
+      --fNPendingWrites;
+      if (nout >= 0)
+         nout = basket->CommitBuffer(file, nout, where);
+      if (nout < 0)
+         Error("WriteBasketImpl", "basket's WriteBuffer failed.");
+      fBasketBytes[where]  = basket->GetNbytes();
+      fBasketSeek[where]   = basket->GetSeekKey();
+      if (nout > 0) {
+         Int_t addbytes = basket->GetObjlen() + basket->GetKeylen();
+         fZipBytes += nout;
+         fTotBytes += addbytes;
+         fTree->AddTotBytes(addbytes);
+         fTree->AddZipBytes(nout);
+
+         // The basket is on file; the next baskets are already being filled.
+         --fNBaskets;
+         fBaskets[where] = 0;
+         if (basket == fCurrentBasket) {
+            fCurrentBasket    = 0;
+            fFirstBasketEntry = -1;
+            fNextBasketEntry  = -1;
+         }
+         delete basket;
+      }
+   };
+   writer.Submit(compress, commit);
+   return 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Wait for the baskets of this branch being compressed in the background to
+/// be written. As the tree writes its baskets in order, this also writes the
+/// pending baskets of the other branches.
+
+void TBranch::WaitPendingWrites()
+{
+   if (fNPendingWrites && fTree)
+      fTree->WaitAsyncBasketWrites();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 ///set the first entry number (case of TBranchSTL)
 
@@ -63,6 +63,13 @@ the trees in the chain.
 #include "strlcpy.h"
 #include "snprintf.h"
 
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
+#include <memory>
+#include <vector>
+
 ClassImp(TChain);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -964,12 +971,65 @@ Long64_t TChain::GetEntries() const
                                " run TChain::SetProof(kTRUE, kTRUE) first");
       return fProofChain->GetEntries();
    }
+   if (fEntries == TTree::kMaxEntries) {
+      const_cast<TChain*>(this)->FetchEntriesConcurrently();
+   }
    if (fEntries == TTree::kMaxEntries) {
       const_cast<TChain*>(this)->LoadTree(TTree::kMaxEntries-1);
    }
    return fEntries;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Retrieve the number of entries of the trees not yet opened.
+///
+/// When implicit multi-threading is enabled, the files whose number of entries
+/// is still unknown are opened concurrently on the thread pool, only to read
+/// the tree header. The result is stored in the chain elements and the tree
+/// offsets, so that the files are not opened one after the other by LoadTree.
+/// Files that cannot be opened or do not contain the tree are left to
+/// LoadTree that reports the problem.
+
+void TChain::FetchEntriesConcurrently()
+{
+#ifdef R__USE_IMT
+   if (!ROOT::IsImplicitMTEnabled() || !fIMTEnabled || fNtrees < 2)
+      return;
+
+   std::vector<Long64_t> entries(fNtrees, TTree::kMaxEntries);
+   auto fetchEntries = [&](Int_t i) {
+      auto element = static_cast<TChainElement *>(fFiles->UncheckedAt(i));
+      if (element->GetEntries() != TTree::kMaxEntries) {
+         entries[i] = element->GetEntries();
+         return;
+      }
+      TDirectory::TContext ctxt;
+      std::unique_ptr<TFile> file(TFile::Open(element->GetTitle(), "READ_WITHOUT_GLOBALREGISTRATION"));
+      if (!file || file->IsZombie())
+         return;
+      // The tree is owned, and deleted, by the file.
+      auto tree = file->Get<TTree>(element->GetName());
+      if (tree) {
+         tree->ResetBit(kMustCleanup);
+         entries[i] = tree->GetEntries();
+      }
+   };
+   std::vector<Int_t> indices(fNtrees);
+   for (Int_t i = 0; i < fNtrees; ++i)
+      indices[i] = i;
+   ROOT::TThreadExecutor pool;
+   pool.Foreach(fetchEntries, indices);
+
+   // Fill the offsets up to the first tree LoadTree still needs to look at.
+   for (Int_t i = 0; i < fNtrees && entries[i] != TTree::kMaxEntries; ++i) {
+      static_cast<TChainElement *>(fFiles->UncheckedAt(i))->SetNumberEntries(entries[i]);
+      fTreeOffset[i + 1] = fTreeOffset[i] + entries[i];
+      if (i == fNtrees - 1)
+         fEntries = fTreeOffset[fNtrees];
+   }
+#endif
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Get entry from the file to memory.
 ///
@@ -46,8 +46,36 @@ End_Macro
 #include "TEntryListBlock.h"
 #include "TString.h"
 
+#include <algorithm>
+
 ClassImp(TEntryListBlock);
 
+namespace {
+
+/// Number of bits set in a 16-bit word of the bits representation.
+inline Int_t CountBits(UShort_t word)
+{
+   UInt_t x = word;
+   x = x - ((x >> 1) & 0x5555);
+   x = (x & 0x3333) + ((x >> 2) & 0x3333);
+   x = (x + (x >> 4)) & 0x0F0F;
+   return (x + (x >> 8)) & 0x1F;
+}
+
+/// Position of the lowest bit set in a non-zero 16-bit word.
+inline Int_t LowestBit(UShort_t word)
+{
+   Int_t pos = 0;
+   while (!(word & 1)) {
+      word >>= 1;
+      ++pos;
+   }
+   return pos;
+}
+
+} // anonymous namespace
+
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Default c-tor
 
@@ -207,13 +235,14 @@ Int_t TEntryListBlock::Contains(Int_t entry)
       return result;
    }
    //list
-   if (entry < fCurrent) fCurrent = 0;
    if (fPassing && fIndices){
-      for (Int_t i = fCurrent; i<fNPassed; i++){
-         if (fIndices[i]==entry){
-            fCurrent = i;
-            return kTRUE;
-         }
+      // The list is sorted: search from the last match, which is fast when
+      // iterating in order, or from the start if the entry is before it.
+      if (fCurrent >= fNPassed || fIndices[fCurrent] > entry) fCurrent = 0;
+      UShort_t *found = std::lower_bound(fIndices + fCurrent, fIndices + fNPassed, entry);
+      if (found != fIndices + fNPassed && *found == entry) {
+         fCurrent = found - fIndices;
+         return kTRUE;
       }
    } else {
       if (!fIndices || fNPassed==0){
@@ -222,16 +251,11 @@ Int_t TEntryListBlock::Contains(Int_t entry)
       }
       if (entry > fIndices[fNPassed-1])
          return kTRUE;
-      for (Int_t i= fCurrent; i<fNPassed; i++){
-         if (fIndices[i]==entry){
-            fCurrent = i;
-            return kFALSE;
-         }
-         if (fIndices[i]>entry){
-            fCurrent = i;
-            return kTRUE;
-         }
-      }
+      //the list holds the entries that don't pass
+      if (fCurrent >= fNPassed || fIndices[fCurrent] > entry) fCurrent = 0;
+      UShort_t *found = std::lower_bound(fIndices + fCurrent, fIndices + fNPassed, entry);
+      fCurrent = found - fIndices;
+      return *found != entry;
    }
    return 0;
 }
@@ -260,34 +284,18 @@ Int_t TEntryListBlock::Merge(TEntryListBlock *block)
    }
    if (fType==0){
       //stored as bits
-      if (block->fType == 0){
-         for (i=0; i<kBlockSize*16; i++){
-            if (block->Contains(i))
-               Enter(i);
-         }
-      } else {
-         if (block->fPassing){
-            //the other block stores entries that pass
-            for (i=0; i<block->fNPassed; i++){
-               Enter(block->fIndices[i]);
-            }
-         } else {
-            //the other block stores entries that don't pass
-            if (block->fNPassed==0){
-               for (i=0; i<kBlockSize*16; i++){
-                  Enter(i);
-               }
-            }
-            for (j=0; j<block->fIndices[0]; j++)
-               Enter(j);
-            for (i=0; i<block->fNPassed-1; i++){
-               for (j=block->fIndices[i]+1; j<block->fIndices[i+1]; j++){
-                  Enter(j);
-               }
-            }
-            for (j=block->fIndices[block->fNPassed-1]+1; j<kBlockSize*16; j++)
-               Enter(j);
-         }
+      const UShort_t *other = block->fIndices;
+      TEntryListBlock otherBits;
+      if (block->fType != 0) {
+         //bring the other block to the bits representation as well
+         otherBits = *block;
+         otherBits.Transform(1, new UShort_t[kBlockSize]);
+         other = otherBits.fIndices;
+      }
+      fNPassed = 0;
+      for (i=0; i<kBlockSize; i++){
+         fIndices[i] |= other[i];
+         fNPassed += CountBits(fIndices[i]);
       }
    } else {
       //stored as a list
@@ -313,7 +321,7 @@ Int_t TEntryListBlock::Merge(TEntryListBlock *block)
                   newpos++;
                   elpos++;
                }
-               if (fIndices[i] == elst[elpos]) elpos++;
+               if (elpos < en && fIndices[i] == elst[elpos]) elpos++;
                newlist[newpos] = fIndices[i];
                newpos++;
             }
@@ -334,16 +342,18 @@ Int_t TEntryListBlock::Merge(TEntryListBlock *block)
             UShort_t *newlist = new UShort_t[newsize];
             Int_t newpos, current;
             newpos = current = 0;
-            for (i=0; i<kBlockSize*16; i++){
-               if (!block->Contains(i)) continue;
-               while(current < fNPassed && fIndices[current]<i){
-                  newlist[newpos] = fIndices[current];
-                  current++;
+            for (j=0; j<kBlockSize; j++){
+               for (UShort_t word = block->fIndices[j]; word; word &= word - 1){
+                  i = j*16 + LowestBit(word);
+                  while(current < fNPassed && fIndices[current]<i){
+                     newlist[newpos] = fIndices[current];
+                     current++;
+                     newpos++;
+                  }
+                  if (current < fNPassed && fIndices[current]==i) current++;
+                  newlist[newpos] = i;
                   newpos++;
                }
-               if (fIndices[current]==i) current++;
-               newlist[newpos] = i;
-               newpos++;
             }
             while(current<fNPassed){
                newlist[newpos] = fIndices[current];
@@ -382,21 +392,23 @@ Int_t TEntryListBlock::GetNPassed()
 Int_t TEntryListBlock::GetEntry(Int_t entry)
 {
    if (entry > kBlockSize*16) return -1;
-   if (entry > GetNPassed()) return -1;
+   if (entry >= GetNPassed()) return -1;
    if (entry == fLastIndexQueried+1) return Next();
    else {
       Int_t i=0; Int_t j=0; Int_t entries_found=0;
       if (fType==0){
-         if ((fIndices[i] & (1<<j))!=0)
-            entries_found++;
-         while (entries_found<entry+1){
-            if (j==15){i++; j=0;}
-            else j++;
-            if ((fIndices[i] & (1<<j))!=0)
-               entries_found++;
+         //skip whole words, then the lower bits of the word holding the entry
+         Int_t remaining = entry;
+         Int_t nbits;
+         while ((nbits = CountBits(fIndices[i])) <= remaining) {
+            remaining -= nbits;
+            i++;
          }
+         UShort_t word = fIndices[i];
+         for (j=0; j<remaining; j++)
+            word &= word - 1;
          fLastIndexQueried = entry;
-         fLastIndexReturned = i*16+j;
+         fLastIndexReturned = i*16+LowestBit(word);
          return fLastIndexReturned;
       }
       if (fType==1){
@@ -454,18 +466,13 @@ Int_t TEntryListBlock::Next()
 
    if (fType==0) {
       //bits
-      Int_t i=0;
-      Int_t j=0;
       fLastIndexReturned++;
-      i = fLastIndexReturned>>4;
-      j = fLastIndexReturned & 15;
-      Bool_t result=(fIndices[i] & (1<<j))!=0;
-      while (!result) {
-         if (j==15) {j=0; i++;}
-         else j++;
-         result = (fIndices[i] & (1<<j)) != 0;
-      }
-      fLastIndexReturned = i*16+j;
+      Int_t i = fLastIndexReturned>>4;
+      //ignore the bits before the current position, then skip empty words
+      UShort_t word = fIndices[i] & (0xFFFF << (fLastIndexReturned & 15));
+      while (!word)
+         word = fIndices[++i];
+      fLastIndexReturned = i*16+LowestBit(word);
       fLastIndexQueried++;
       return fLastIndexReturned;
 
@@ -567,18 +574,11 @@ void TEntryListBlock::Transform(Bool_t dir, UShort_t *indexnew)
    Int_t ilist = 0;
    Int_t ibite, ibit;
    if (!dir) {
-         for (i=0; i<kBlockSize*16; i++){
-            ibite = i >> 4;
-            ibit = i & 15;
-            Bool_t result = (fIndices[ibite] & (1<<ibit))!=0;
-            if (result && fPassing){
-               //fill with the entries that pass
-               indexnew[ilist] = i;
-               ilist++;
-            }
-            else if (!result && !fPassing){
-               //fill with the entries that don't pass
-               indexnew[ilist] = i;
+         for (ibite=0; ibite<kBlockSize; ibite++){
+            //fill with the entries that pass, or with those that don't pass
+            UShort_t word = fPassing ? fIndices[ibite] : UShort_t(~fIndices[ibite]);
+            for (; word; word &= word - 1){
+               indexnew[ilist] = ibite*16 + LowestBit(word);
                ilist++;
             }
          }
@@ -428,8 +428,11 @@ End_Macro
 #include "strlcpy.h"
 #include "snprintf.h"
 
+#include "TAsyncBasketWriter.h"
+#include "TBasketBufferPool.h"
 #include "TBranchIMTHelper.h"
 #include "TNotifyLink.h"
+#include "TTreeFlatFillPlan.h"
 
 #include <chrono>
 #include <cstddef>
@@ -440,6 +443,7 @@ End_Macro
 #include <cstdio>
 #include <climits>
 #include <algorithm>
+#include <cstdlib>
 #include <set>
 
 #ifdef R__USE_IMT
@@ -452,6 +456,7 @@ constexpr Float_t kNEntriesResortInv = 1.f/kNEntriesResort;
 
 Int_t    TTree::fgBranchStyle = 1;  // Use new TBranch style with TBranchElement.
 Long64_t TTree::fgMaxTreeSize = 100000000000LL;
+Long64_t TTree::fgBasketBufferPoolSize = 0;
 
 ClassImp(TTree);
 
@@ -801,6 +806,8 @@ TTree::TTree()
    fMaxEntryLoop = 1000000000;
    fMaxEntryLoop *= 1000;
 
+   if (fgBasketBufferPoolSize > 0) SetBasketBufferPoolSize(fgBasketBufferPoolSize);
+
    fBranches.SetOwner(kTRUE);
 }
 
@@ -896,6 +903,8 @@ TTree::TTree(const char* name, const char* title, Int_t splitlevel /* = 99 */,
    fMaxEntryLoop = 1000000000;
    fMaxEntryLoop *= 1000;
 
+   if (fgBasketBufferPoolSize > 0) SetBasketBufferPoolSize(fgBasketBufferPoolSize);
+
    // Insert ourself into the current directory.
    // FIXME: This is very annoying behaviour, we should
    //        be able to choose to not do this like we
@@ -919,6 +928,12 @@ TTree::TTree(const char* name, const char* title, Int_t splitlevel /* = 99 */,
 
 TTree::~TTree()
 {
+   // The baskets still being compressed are dropped, like the other baskets not yet written.
+   delete fAsyncBasketWriter;
+   fAsyncBasketWriter = nullptr;
+   delete fFlatFillPlan;
+   fFlatFillPlan = nullptr;
+
    if (auto link = dynamic_cast<TNotifyLinkBase*>(fNotify)) {
       link->Clear();
    }
@@ -1029,6 +1044,9 @@ TTree::~TTree()
       delete fTransientBuffer;
       fTransientBuffer = 0;
    }
+   // The baskets, deleted with the branches, have already returned their buffers.
+   delete fBasketBufferPool;
+   fBasketBufferPool = nullptr;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1046,6 +1064,119 @@ TBuffer* TTree::GetTransientBuffer(Int_t size)
    return fTransientBuffer;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Return a buffer of at least `size` bytes for a basket of this tree, taken
+/// from the basket buffer pool, or nullptr if the tree has no pool.
+/// The buffer is in read mode; the caller owns it and gives it back with
+/// ReleaseBasketBuffer().
+
+TBuffer *TTree::AcquireBasketBuffer(Int_t size)
+{
+   return fBasketBufferPool ? fBasketBufferPool->Acquire(size) : nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Give back a buffer no longer used by a basket of this tree to the basket
+/// buffer pool. Returns kFALSE if the buffer was not taken by the pool, in which
+/// case the caller still owns it.
+
+Bool_t TTree::ReleaseBasketBuffer(TBuffer *buffer)
+{
+   return fBasketBufferPool ? fBasketBufferPool->Release(buffer) : kFALSE;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the maximum size in bytes of the buffers kept in the basket buffer
+/// pool of this tree, 0 if the tree has no pool.
+
+Long64_t TTree::GetBasketBufferPoolSize() const
+{
+   return fBasketBufferPool ? fBasketBufferPool->GetMaxBytes() : 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Keep the buffers dropped by the baskets of this tree in a pool, up to a
+/// total of `maxbytes` bytes, and reuse them for the next baskets.
+///
+/// By default, the buffers of a basket are deleted when the basket is dropped,
+/// e.g. when moving to the next basket while reading, and allocated again for
+/// the next basket. For trees with many branches, this allocation churn can be
+/// significant. With a pool, the buffers are bucketed by power-of-two size
+/// classes and reading reaches a steady state without allocations.
+/// The pool is shared by all the branches of the tree and is thread safe.
+///
+/// A value of 0 deletes the pool. The default for new trees is set with
+/// TTree::SetDefaultBasketBufferPoolSize.
+
+void TTree::SetBasketBufferPoolSize(Long64_t maxbytes)
+{
+   delete fBasketBufferPool;
+   fBasketBufferPool = maxbytes > 0 ? new ROOT::Internal::TBasketBufferPool(maxbytes) : nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the default maximum size of the basket buffer pool of new trees.
+
+Long64_t TTree::GetDefaultBasketBufferPoolSize()
+{
+   return fgBasketBufferPoolSize;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Set the default maximum size in bytes of the basket buffer pool of the
+/// trees created, or read from a file, from now on. A value of 0 (the default)
+/// disables the pool. See TTree::SetBasketBufferPoolSize.
+
+void TTree::SetDefaultBasketBufferPoolSize(Long64_t maxbytes)
+{
+   fgBasketBufferPoolSize = maxbytes;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the maximum number of baskets compressed in the background, 0 if
+/// the baskets are compressed when written. See TTree::SetAsyncBasketWrite.
+
+Int_t TTree::GetAsyncBasketWrite() const
+{
+   return fAsyncBasketWriter ? fAsyncBasketWriter->GetMaxPending() : 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compress the baskets of this tree in a background thread while Fill goes on.
+///
+/// By default, a full basket is compressed and written by the Fill call that
+/// fills it, so that the latency of Fill depends on whether baskets are full,
+/// and Fill calls at a cluster boundary compress all the baskets. With this
+/// option, the baskets are queued to a compression thread and written to the
+/// file, in order, by later Fill calls once compressed; the file is only ever
+/// accessed by the filling thread. At most `maxpending` baskets are queued:
+/// when the queue is full, Fill waits for the oldest one.
+///
+/// All the queued baskets are written by FlushBaskets, Write, AutoSave and
+/// Reset; baskets still queued when the tree is deleted are dropped, as the
+/// other baskets not yet written. The option has no effect on the parallel
+/// flush done when implicit multi-threading is enabled, which already
+/// compresses the baskets in parallel.
+///
+/// A value of 0 stops the compression thread, after writing the queued baskets.
+
+void TTree::SetAsyncBasketWrite(Int_t maxpending)
+{
+   WaitAsyncBasketWrites();
+   delete fAsyncBasketWriter;
+   fAsyncBasketWriter = maxpending > 0 ? new ROOT::Internal::TAsyncBasketWriter(maxpending) : nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Wait for the baskets compressed in the background to be written.
+/// See TTree::SetAsyncBasketWrite.
+
+void TTree::WaitAsyncBasketWrites() const
+{
+   if (fAsyncBasketWriter)
+      fAsyncBasketWriter->Drain();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Add branch with name bname to the Tree cache.
 /// If bname="*" all branches are added to the cache.
@@ -1509,6 +1640,8 @@ Long64_t TTree::AutoSave(Option_t* option)
       if (gDebug > 0) Info("AutoSave", "calling FlushBaskets \n");
       FlushBasketsImpl();
    }
+   // The tree header must refer to the baskets it counts.
+   WaitAsyncBasketWrites();
 
    fSavedBytes = GetZipBytes();
 
@@ -4464,6 +4597,15 @@ Long64_t TTree::Draw(const char* varexp, const TCut& selection, Option_t* option
 /// You can use the option "goff" to turn off the graphics output
 /// of TTree::Draw in the above example.
 ///
+/// ### Compiling the expressions
+///
+/// With the option "jit", the variable and selection expressions are compiled
+/// to native code through the interpreter (see TTreeFormula::JitCompile) instead
+/// of being interpreted for each entry. Only expressions of scalar leaves,
+/// arithmetic and the usual mathematical functions are compiled; others are
+/// interpreted as usual. TTreeFormula::SetJitCompilation() enables this for all
+/// newly created formulas, including those of TTree::Scan.
+///
 /// ### Automatic interface to TTree::Draw via the TTreeViewer
 ///
 /// A complete graphical interface to this function is implemented
@@ -4594,6 +4736,26 @@ Int_t TTree::Fill()
    }
 #endif
 
+   ROOT::Internal::TTreeFlatFillPlan::Slot *flatSlots = nullptr;
+   if (fFlatFillPlan) {
+      if (fFlatFillPlan->fStale || fFlatFillPlan->fSlots.size() != (std::size_t)nbranches) {
+         fFlatFillPlan->fSlots.clear();
+         fFlatFillPlan->fSlots.resize(nbranches);
+         for (Int_t i = 0; i < nbranches; ++i) {
+            auto &slot = fFlatFillPlan->fSlots[i];
+            slot.fBranch = (TBranch *)fBranches.UncheckedAt(i);
+            if (slot.fBranch->CanFillFlat(slot.fNbytes, slot.fElemSize)) {
+               auto leaf = static_cast<TLeaf *>(slot.fBranch->GetListOfLeaves()->UncheckedAt(0));
+               slot.fOffset = leaf->GetOffset();
+            } else {
+               slot.fNbytes = 0;
+            }
+         }
+         fFlatFillPlan->fStale = false;
+      }
+      flatSlots = fFlatFillPlan->fSlots.data();
+   }
+
    for (Int_t i = 0; i < nbranches; ++i) {
       // Loop over all branches, filling and accumulating bytes written and error counts.
       TBranch *branch = (TBranch *)fBranches.UncheckedAt(i);
@@ -4602,10 +4764,21 @@ Int_t TTree::Fill()
          continue;
 
 #ifndef R__USE_IMT
-      nwrite = branch->FillImpl(nullptr);
+      ROOT::Internal::TBranchIMTHelper *helper = nullptr;
 #else
-      nwrite = branch->FillImpl(useIMT ? &imtHelper : nullptr);
+      ROOT::Internal::TBranchIMTHelper *helper = useIMT ? &imtHelper : nullptr;
 #endif
+      // The address of a flat branch is read at each Fill (it can be changed by SetBranchAddress),
+      // without virtual call since the branch is known to be a plain TBranch.
+      char *flatAddress = flatSlots && flatSlots[i].fNbytes ? branch->TBranch::GetAddress() : nullptr;
+      if (flatAddress && flatSlots[i].fBranch == branch) {
+         nwrite = branch->FillFlat(flatAddress + flatSlots[i].fOffset, flatSlots[i].fNbytes, flatSlots[i].fElemSize,
+                                   helper);
+      } else {
+         if (flatSlots && flatSlots[i].fBranch != branch)
+            fFlatFillPlan->fStale = true;
+         nwrite = branch->FillImpl(helper);
+      }
       if (nwrite < 0) {
          if (nerror < 2) {
             Error("Fill", "Failed filling branch:%s.%s, nbytes=%d, entry=%lld\n"
@@ -4672,12 +4845,15 @@ Int_t TTree::Fill()
          if (autoFlush || autoSave) {
             // First call FlushBasket to make sure that fTotBytes is up to date.
             FlushBasketsImpl();
+            WaitAsyncBasketWrites();
             autoFlush = false; // avoid auto flushing again later
 
             // When we are in one-basket-per-cluster mode, there is no need to optimize basket:
             // they will automatically grow to the size needed for an event cluster (with the basket
             // shrinking preventing them from growing too much larger than the actually-used space).
-            if (!TestBit(TTree::kOnlyFlushAtCluster)) {
+            if (!TestBit(TTree::kOnlyFlushAtCluster) && fAutoOptimizeBaskets != 0) {
+               AutoOptimizeBaskets();
+            } else if (!TestBit(TTree::kOnlyFlushAtCluster)) {
                OptimizeBaskets(GetTotBytes(), 1, "");
                if (gDebug > 0)
                   Info("TTree::Fill", "OptimizeBaskets called at entry %lld, fZipBytes=%lld, fFlushedBytes=%lld\n",
@@ -4731,6 +4907,8 @@ Int_t TTree::Fill()
       if (gDebug > 0)
          Info("TTree::Fill", "FlushBaskets() called at entry %lld, fZipBytes=%lld, fFlushedBytes=%lld\n", fEntries,
               GetZipBytes(), fFlushedBytes);
+      if (fAutoOptimizeBaskets != 0 && !TestBit(TTree::kOnlyFlushAtCluster))
+         AutoOptimizeBaskets();
       fFlushedBytes = GetZipBytes();
    }
 
@@ -5098,6 +5276,7 @@ struct BoolRAIIToggle {
 Int_t TTree::FlushBaskets(Bool_t create_cluster) const
 {
     Int_t retval = FlushBasketsImpl();
+    WaitAsyncBasketWrites();
     if (retval == -1) return retval;
 
     if (create_cluster) const_cast<TTree *>(this)->MarkEventCluster();
@@ -5231,6 +5410,21 @@ const char* TTree::GetAlias(const char* aliasName) const
 }
 
 namespace {
+/// Return true if `name` is the full name of the branch, see TBranch::GetFullName().
+/// The full name is either the branch name or the name of the mother branch, a dot
+/// and the branch name, hence the full name, which is a newly allocated TString, is
+/// only built if `name` ends with a dot followed by the branch name.
+bool R__MatchesFullName(const TBranch &branch, const char *name)
+{
+   const char *branchName = branch.GetName();
+   const size_t nameLen = strlen(name);
+   const size_t branchNameLen = strlen(branchName);
+   if (nameLen <= branchNameLen || name[nameLen - branchNameLen - 1] != '.' ||
+       strcmp(name + nameLen - branchNameLen, branchName) != 0)
+      return !strcmp(branchName, name);
+   return !strcmp(branch.GetFullName(), name);
+}
+
 /// Do a breadth first search through the implied hierarchy
 /// of branches.
 /// To avoid scanning through the list multiple time
@@ -5246,7 +5440,7 @@ TBranch *R__GetBranch(const TObjArray &branches, const char *name)
       if (!strcmp(b->GetName(), name)) {
          return b;
       }
-      if (!strcmp(b->GetFullName(), name)) {
+      if (R__MatchesFullName(*b, name)) {
          return b;
       }
       if (!result)
@@ -5291,7 +5485,7 @@ TBranch* TTree::GetBranch(const char* name)
       if (!strcmp(branch->GetName(), name)) {
          return branch;
       }
-      if (!strcmp(branch->GetFullName(), name)) {
+      if (R__MatchesFullName(*branch, name)) {
          return branch;
       }
    }
@@ -6090,7 +6284,7 @@ TLeaf* TTree::GetLeafImpl(const char* branchname, const char *leafname)
          // check the branchname is also a match
          TBranch *br = leaf->GetBranch();
          // if a quick comparison with the branch full name is a match, we are done
-         if (!strcmp(br->GetFullName(), branchname))
+         if (R__MatchesFullName(*br, branchname))
             return leaf;
          UInt_t nbch = strlen(branchname);
          const char* brname = br->GetName();
@@ -6907,6 +7101,7 @@ Long64_t TTree::Merge(TCollection* li, TFileMergeInfo *info)
          // In memory TTree, all we need to do is ... write it.
          SetDirectory(info->fOutputDirectory);
          FlushBasketsImpl();
+         WaitAsyncBasketWrites();
          fDirectory->WriteTObject(this);
       } else if (info->fOptions.Contains("fast")) {
          InPlaceClone(info->fOutputDirectory);
@@ -7033,6 +7228,7 @@ void TTree::OptimizeBaskets(ULong64_t maxMemory, Float_t minComp, Option_t *opti
 {
    //Flush existing baskets if the file is writable
    if (this->GetDirectory()->IsWritable()) this->FlushBasketsImpl();
+   WaitAsyncBasketWrites();
 
    TString opt( option );
    opt.ToLower();
@@ -7145,6 +7341,61 @@ void TTree::OptimizeBaskets(ULong64_t maxMemory, Float_t minComp, Option_t *opti
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Re-tune the basket sizes of all branches, called at each flush when
+/// SetAutoOptimizeBaskets is used.
+///
+/// Each branch is given a basket large enough to hold one cluster, based on
+/// the average uncompressed size of its entries written so far, so that the
+/// basket boundaries are aligned with the cluster boundaries. If the sum of the
+/// basket sizes exceeds the memory budget, all sizes are scaled down in
+/// proportion. Sizes changing by less than 10% are left alone to avoid churn.
+
+void TTree::AutoOptimizeBaskets()
+{
+   const Long64_t clusterSize = (fAutoFlush > 0) ? fAutoFlush : fEntries;
+   if (clusterSize <= 0)
+      return;
+
+   std::vector<std::pair<TBranch *, Double_t>> idealSizes;
+   Double_t totalSize = 0;
+   TIter next(GetListOfLeaves());
+   while (auto leaf = static_cast<TLeaf *>(next())) {
+      TBranch *branch = leaf->GetBranch();
+      // Visit each branch once, and only the branches holding data.
+      if (branch->GetListOfLeaves()->At(0) != leaf || branch->GetListOfBranches()->GetEntries() > 0)
+         continue;
+      if (branch->GetEntries() == 0)
+         continue;
+      Double_t size = Double_t(branch->GetTotBytes()) / branch->GetEntries() * clusterSize;
+      // The entry offsets are stored in the same buffer as the data, as is the basket key.
+      if (branch->GetEntryOffsetLen())
+         size += clusterSize * sizeof(Int_t) * 2;
+      size += 100 + strlen(branch->GetName()) + strlen(GetName());
+      idealSizes.emplace_back(branch, size);
+      totalSize += size;
+   }
+   if (totalSize == 0)
+      return;
+
+   const Double_t memFactor =
+      (fAutoOptimizeBaskets > 0 && totalSize > fAutoOptimizeBaskets) ? fAutoOptimizeBaskets / totalSize : 1;
+   static const Double_t hardmax = 1 * 1024 * 1024 * 1024; // Never give more than 1Gb to a single buffer.
+   for (auto &branchAndSize : idealSizes) {
+      TBranch *branch = branchAndSize.first;
+      Double_t size = TMath::Min(branchAndSize.second * memFactor, hardmax);
+      // Round up to a multiple of 512 bytes, which is also the minimum size.
+      Int_t newBsize = Int_t(size) - Int_t(size) % 512 + 512;
+      Int_t oldBsize = branch->GetBasketSize();
+      if (std::abs(newBsize - oldBsize) * 10 < oldBsize)
+         continue;
+      if (gDebug > 0)
+         Info("AutoOptimizeBaskets", "Changing buffer size from %6d to %6d bytes for %s", oldBsize, newBsize,
+              branch->GetName());
+      branch->SetBasketSize(newBsize);
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Interface to the Principal Components Analysis class.
 ///
@@ -7977,6 +8228,8 @@ void TTree::RemoveFriend(TTree* oldFriend)
 
 void TTree::Reset(Option_t* option)
 {
+   WaitAsyncBasketWrites();
+
    fNotify        = 0;
    fEntries       = 0;
    fNClusterRange = 0;
@@ -8008,6 +8261,8 @@ void TTree::Reset(Option_t* option)
 
 void TTree::ResetAfterMerge(TFileMergeInfo *info)
 {
+   WaitAsyncBasketWrites();
+
    fEntries       = 0;
    fNClusterRange = 0;
    fTotBytes      = 0;
@@ -8220,6 +8475,27 @@ void TTree::SetAutoFlush(Long64_t autof /* = -30000000 */ )
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Re-tune the basket sizes of all branches at each flush while writing.
+///
+/// By default, the basket sizes are optimized only once, at the first
+/// AutoFlush (see TTree::OptimizeBaskets). With this mode, the basket size of
+/// every branch is re-computed at each flush from the average uncompressed size
+/// of its entries, such that the basket of each branch holds a full cluster:
+/// - maxMemory < 0 (the default): no limit other than the size of a cluster.
+/// - maxMemory > 0: the total size of the baskets of all branches is kept below
+///   maxMemory bytes; the basket sizes are then scaled down in proportion and
+///   some branches need several baskets per cluster.
+/// - maxMemory == 0: disable the re-tuning.
+///
+/// This has no effect when the tree is in the mode TTree::kOnlyFlushAtCluster,
+/// where the baskets already grow to the size of a cluster.
+
+void TTree::SetAutoOptimizeBaskets(Long64_t maxMemory /* = -1 */)
+{
+   fAutoOptimizeBaskets = maxMemory;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Mark the previous event as being at the end of the event cluster.
 ///
@@ -9125,6 +9401,28 @@ void TTree::SetFileNumber(Int_t number)
    fFileNumber = number;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Fill the flat branches of this tree with a precomputed plan.
+///
+/// A branch is flat if it is a plain TBranch with a single leaf holding a
+/// scalar or a fixed-size array of Bool_t, Char_t, Short_t, Int_t, Long64_t,
+/// Float_t or Double_t (or their unsigned variants) at the branch address, as
+/// created by `tree->Branch("x", &x, "x/F")`. When enabled, Fill copies the
+/// values of the flat branches directly into their basket buffers, byte
+/// swapping whole arrays at once, instead of going through TBranch::FillImpl
+/// and TLeaf::FillBasket. The other branches (leaf counts, variable-size
+/// arrays, objects...) are filled as usual. The resulting baskets are identical.
+///
+/// The plan is built by the first Fill and rebuilt when branches are added or
+/// replaced; the branch addresses are read at each Fill, so SetBranchAddress
+/// can still be used.
+
+void TTree::SetFlatFill(Bool_t enable)
+{
+   delete fFlatFillPlan;
+   fFlatFillPlan = enable ? new ROOT::Internal::TTreeFlatFillPlan : nullptr;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Set all the branches in this TTree to be in decomposed object mode
 /// (also known as MakeClass mode).
@@ -9701,6 +9999,7 @@ void TTree::UseCurrentStyle()
 Int_t TTree::Write(const char *name, Int_t option, Int_t bufsize) const
 {
    FlushBasketsImpl();
+   WaitAsyncBasketWrites();
    if (R__unlikely(option & kOnlyPrepStep))
       return 0;
    return TObject::Write(name, option, bufsize);
@@ -266,6 +266,24 @@ rely on the system to cache the right branches.
     }
 ~~~
 
+#### Reusing the branches learnt by a previous job
+
+Jobs that repeatedly run the same selection can skip the learning phase by
+saving the branches learnt (or added) by one job into a small sidecar file and
+loading it in the next ones:
+~~~ {.cpp}
+    T->SetCacheSize(cachesize);
+    auto cache = T->GetReadCache(T->GetCurrentFile());
+    if (cache->LoadBranchList("mytree.cachebranches") < 0) {
+       // First job: learn as usual and save the result at the end.
+       ... event loop ...
+       cache->SaveBranchList("mytree.cachebranches");
+    } else {
+       // Subsequent jobs: the cache knows the branches from the first entry.
+       ... event loop ...
+    }
+~~~
+
 \anchor checkPerf
 ## How can the usage and performance of TTreeCache be verified?
 
@@ -301,6 +319,9 @@ myTreeOrChain.GetTree()->PrintCacheStats();
 #include "TVirtualPerfStats.h"
 #include <limits.h>
 
+#include <fstream>
+#include <string>
+
 Int_t TTreeCache::fgLearnEntries = 100;
 
 ClassImp(TTreeCache);
@@ -1863,6 +1884,61 @@ Int_t TTreeCache::GetLearnEntries()
    return fgLearnEntries;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Load a list of branches saved by SaveBranchList() and add them to the cache.
+///
+/// The learning phase is stopped, so that the cache is filled with the loaded
+/// branches from the first entry on; the saved prefill type and cluster prefetch
+/// setting are restored as well. Branches that do not exist in the current tree
+/// are ignored.
+/// Returns:
+///  - the number of branches added to the cache
+///  - -1 if the file cannot be read or is not a valid branch list
+
+Int_t TTreeCache::LoadBranchList(const char *filename)
+{
+   std::ifstream in(filename);
+   if (!in)
+      return -1;
+
+   std::string line;
+   if (!std::getline(in, line) || line != "# TTreeCache branch list v1")
+      return -1;
+
+   Int_t nbranches = 0;
+   while (std::getline(in, line)) {
+      if (line.empty() || line[0] == '#')
+         continue;
+      auto sep = line.find(' ');
+      if (sep == std::string::npos) {
+         Error("LoadBranchList", "Malformed line in %s: %s", filename, line.c_str());
+         return -1;
+      }
+      const std::string key = line.substr(0, sep);
+      const std::string value = line.substr(sep + 1);
+      if (key == "branch") {
+         TBranch *b = fTree->GetBranch(value.c_str());
+         if (!b) {
+            if (gDebug > 0)
+               Info("LoadBranchList", "Branch %s not found in tree %s", value.c_str(), fTree->GetName());
+            continue;
+         }
+         if (AddBranch(b, kFALSE) == 0)
+            nbranches++;
+      } else if (key == "prefill") {
+         SetLearnPrefill(value == "1" ? kAllBranches : kNoPrefill);
+      } else if (key == "clusterprefetch") {
+         fTree->SetClusterPrefetch(value == "1");
+      } else {
+         Error("LoadBranchList", "Unknown key in %s: %s", filename, key.c_str());
+         return -1;
+      }
+   }
+
+   StopLearningPhase();
+   return nbranches;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Print cache statistics. Like:
 ///
@@ -2047,6 +2123,41 @@ void TTreeCache::ResetCache()
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Save the list of branches currently in the cache (learnt or added by hand),
+/// together with the prefill type and the cluster prefetch setting of the tree,
+/// to a small text file. A later job can restore them with LoadBranchList() and
+/// thus skip the learning phase.
+/// Returns:
+///  - the number of branches saved
+///  - -1 if the file cannot be written
+
+Int_t TTreeCache::SaveBranchList(const char *filename) const
+{
+   std::ofstream out(filename);
+   if (!out) {
+      Error("SaveBranchList", "Cannot open %s for writing", filename);
+      return -1;
+   }
+
+   out << "# TTreeCache branch list v1\n";
+   out << "# tree " << (fTree ? fTree->GetName() : "") << "\n";
+   out << "prefill " << (fPrefillType == kAllBranches ? 1 : 0) << "\n";
+   out << "clusterprefetch " << ((fTree && fTree->GetClusterPrefetch()) ? 1 : 0) << "\n";
+   Int_t nbranches = 0;
+   TIter next(fBrNames);
+   while (auto os = static_cast<TObjString *>(next())) {
+      out << "branch " << os->GetName() << "\n";
+      nbranches++;
+   }
+   out.close();
+   if (!out) {
+      Error("SaveBranchList", "Failed to write %s", filename);
+      return -1;
+   }
+   return nbranches;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Change the underlying buffer size of the cache.
 /// If the change of size means some cache content is lost, or if the buffer
@@ -16,6 +16,12 @@
 
 A TTreeCache which exploits parallelized decompression of its own content.
 
+The baskets of the current cache content are decompressed ahead of their use.
+With implicit multi-threading enabled, this is done by IMT tasks. Otherwise a
+few threads dedicated to each cache (see SetUnzipThreads()) claim the baskets
+one after the other, so that even a single-threaded event loop overlaps the
+decompression of the next baskets with the processing of the current entries.
+
 */
 
 #include "TTreeCacheUnzip.h"
@@ -35,6 +41,11 @@ A TTreeCache which exploits parallelized decompression of its own content.
 
 #include <memory>
 
+namespace {
+/// Whether the calling thread is one of the dedicated unzipping threads.
+thread_local bool gIsUnzipThread = false;
+}
+
 extern "C" void R__unzip(Int_t *nin, UChar_t *bufin, Int_t *lout, char *bufout, Int_t *nout);
 extern "C" int R__unzip_header(Int_t *nin, UChar_t *bufin, Int_t *lout);
 
@@ -45,6 +56,8 @@ TTreeCacheUnzip::EParUnzipMode TTreeCacheUnzip::fgParallel = TTreeCacheUnzip::kD
 // Hence there is no good reason to limit it too much
 Double_t TTreeCacheUnzip::fgRelBuffSize = .5;
 
+Int_t TTreeCacheUnzip::fgUnzipThreads = 2;
+
 ClassImp(TTreeCacheUnzip);
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -234,6 +247,7 @@ void TTreeCacheUnzip::Init()
 
 TTreeCacheUnzip::~TTreeCacheUnzip()
 {
+   StopUnzipThreads();
    ResetCache();
    fUnzipState.Clear(fNseekMax);
 }
@@ -270,6 +284,7 @@ Bool_t TTreeCacheUnzip::FillBuffer()
    if (fNbranches <= 0) return kFALSE;
 
    // Fill the cache buffer with the branches in the cache.
+   PauseUnzipThreads();
    fIsTransferred = kFALSE;
 
    TTree *tree = ((TBranch*)fBranches->UncheckedAt(0))->GetTree();
@@ -358,6 +373,7 @@ Bool_t TTreeCacheUnzip::FillBuffer()
 
 Int_t TTreeCacheUnzip::SetBufferSize(Int_t buffersize)
 {
+   PauseUnzipThreads();
    Int_t res = TTreeCache::SetBufferSize(buffersize);
    if (res < 0) {
       return res;
@@ -391,6 +407,7 @@ void TTreeCacheUnzip::StopLearningPhase()
 
 void TTreeCacheUnzip::UpdateBranches(TTree *tree)
 {
+   PauseUnzipThreads();
    TTreeCache::UpdateBranches(tree);
 }
 
@@ -442,6 +459,120 @@ Int_t TTreeCacheUnzip::SetParallelUnzip(TTreeCacheUnzip::EParUnzipMode option)
    return 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Static function returning the number of threads dedicated to unzipping
+/// in each TTreeCacheUnzip when implicit multi-threading is not enabled.
+
+Int_t TTreeCacheUnzip::GetUnzipThreads()
+{
+   return fgUnzipThreads;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static function setting the number of threads dedicated to unzipping in
+/// each TTreeCacheUnzip created afterwards, when implicit multi-threading is
+/// not enabled. With 0, the baskets are unzipped by the reading thread as
+/// they are needed. The default is 2.
+
+void TTreeCacheUnzip::SetUnzipThreads(Int_t nthreads)
+{
+   fgUnzipThreads = nthreads > 0 ? nthreads : 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Hand the baskets of the current cache content to the dedicated unzipping
+/// threads, starting them if needed. Nothing is done with implicit
+/// multi-threading enabled, if the content was already handed over or if
+/// the unzipping threads are disabled.
+
+void TTreeCacheUnzip::StartUnzipThreads()
+{
+   if (!fParallel || fIsLearning || !fIsTransferred || fUnzipThreadsCycle == fCycle || fNseek <= 0)
+      return;
+#ifdef R__USE_IMT
+   if (ROOT::IsImplicitMTEnabled())
+      return;
+#endif
+   if (fUnzipThreads.empty()) {
+      if (fgUnzipThreads <= 0 || (fgParallel != kForce && std::thread::hardware_concurrency() < 2))
+         return;
+      for (Int_t i = 0; i < fgUnzipThreads; ++i)
+         fUnzipThreads.emplace_back(&TTreeCacheUnzip::UnzipThreadLoop, this);
+   }
+
+   PauseUnzipThreads();
+   std::lock_guard<std::mutex> lock(fUnzipThreadsMutex);
+   fUnzipThreadsCycle = fCycle;
+   fUnzipEnd = fNseek;
+   fUnzipNext = 0;
+   fUnzipHasWork = kTRUE;
+   fUnzipThreadsCondition.notify_all();
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Prevent the dedicated unzipping threads from claiming more baskets and wait
+/// until none of them accesses the cache content anymore.
+
+void TTreeCacheUnzip::PauseUnzipThreads()
+{
+   if (fUnzipThreads.empty() || gIsUnzipThread)
+      return;
+   std::unique_lock<std::mutex> lock(fUnzipThreadsMutex);
+   fUnzipHasWork = kFALSE;
+   fUnzipNext = fUnzipEnd;
+   fUnzipThreadsCondition.wait(lock, [this] { return fUnzipActive == 0; });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Terminate the dedicated unzipping threads.
+
+void TTreeCacheUnzip::StopUnzipThreads()
+{
+   if (fUnzipThreads.empty())
+      return;
+   PauseUnzipThreads();
+   {
+      std::lock_guard<std::mutex> lock(fUnzipThreadsMutex);
+      fUnzipStop = kTRUE;
+      fUnzipThreadsCondition.notify_all();
+   }
+   for (auto &thread : fUnzipThreads)
+      thread.join();
+   fUnzipThreads.clear();
+   fUnzipStop = kFALSE;
+   fUnzipThreadsCycle = -1;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Body of the dedicated unzipping threads: wait for baskets to be handed
+/// over, then claim and unzip them one by one until none is left.
+
+void TTreeCacheUnzip::UnzipThreadLoop()
+{
+   gIsUnzipThread = true;
+   std::unique_lock<std::mutex> lock(fUnzipThreadsMutex);
+   while (true) {
+      fUnzipThreadsCondition.wait(lock, [this] { return fUnzipStop || fUnzipHasWork; });
+      if (fUnzipStop)
+         return;
+      ++fUnzipActive;
+      const Int_t end = fUnzipEnd;
+      lock.unlock();
+
+      for (Int_t index = fUnzipNext++; index < end; index = fUnzipNext++) {
+         if (fUnzipState.TryUnzipping(index)) {
+            if (UnzipCache(index) && gDebug > 0)
+               Info("UnzipCache", "Unzipping failed or cache is in learning state");
+         }
+      }
+
+      lock.lock();
+      --fUnzipActive;
+      fUnzipHasWork = kFALSE;
+      fUnzipThreadsCondition.notify_all();
+   }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //                                                                            //
 // From now on we have the methods concerning the unzipping part of the cache //
@@ -500,6 +631,7 @@ Int_t TTreeCacheUnzip::GetRecordHeader(char *buf, Int_t maxbytes, Int_t &nbytes,
 
 void TTreeCacheUnzip::ResetCache()
 {
+   PauseUnzipThreads();
    // Reset all the lists and wipe all the chunks
    fCycle++;
    fUnzipState.Clear(fNseekMax);
@@ -687,10 +819,13 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
          if (gDebug > 0)
             Info("GetUnzipBuffer", "Changing fNseekMax from:%d to:%d", fNseekMax, fNseek);
 
+         PauseUnzipThreads();
          fUnzipState.Reset(fNseekMax, fNseek);
          fNseekMax = fNseek;
       }
 
+      StartUnzipThreads();
+
       loc = (Int_t)TMath::BinarySearch(fNseek, fSeekSort, pos);
       if ((fCycle == myCycle) && (loc >= 0) && (loc < fNseek) && (pos == fSeekSort[loc])) {
 
@@ -817,6 +952,9 @@ Int_t TTreeCacheUnzip::GetUnzipBuffer(char **buf, Long64_t pos, Int_t len, Bool_
       *free = kTRUE;
    }
 
+   // The cache may have been refilled by ReadBufferExt.
+   StartUnzipThreads();
+
    if (!fIsLearning) {
       fNMissed++;
    }
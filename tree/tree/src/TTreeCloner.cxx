@@ -35,8 +35,16 @@ Class implementing or helping  the various TTree cloning method
 #include "TFileCacheRead.h"
 #include "TTreeCache.h"
 #include "snprintf.h"
+#include "RZip.h"
+
+#ifdef R__USE_IMT
+#include "ROOT/TTaskGroup.hxx"
+#include "TROOT.h"
+#endif
 
 #include <algorithm>
+#include <memory>
+#include <vector>
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -209,6 +217,25 @@ TTreeCloner::TTreeCloner(TTree *from, TTree *to, TDirectory *newdirectory, Optio
       fIsValid = kFALSE;
    }
 
+   if (fIsValid) {
+      // The baskets are copied as is: if they may be compressed with a ZSTD
+      // dictionary, the output file must use the same one.
+      TFile *fromFile = fFromTree->GetCurrentFile();
+      UInt_t dictId = fromFile ? fromFile->GetZstdDictionaryId() : 0;
+      if (dictId && dictId != fToFile->GetZstdDictionaryId()) {
+         Int_t dictSize = 0;
+         const char *dict = R__ZSTDGetDictionary(dictId, &dictSize);
+         if (fToFile->GetZstdDictionaryId() || !dict || !fToFile->SetZstdDictionary(dict, dictSize)) {
+            fWarningMsg.Form("The input TTree (%s) and the output TTree (%s) are in files with different ZSTD dictionaries.",
+                             fFromTree->GetName(), fToTree->GetName());
+            if (!(fOptions & kNoWarnings)) {
+               Warning("TTreeCloner::TTreeCloner", "%s", fWarningMsg.Data());
+            }
+            fIsValid = kFALSE;
+         }
+      }
+   }
+
    if (fIsValid && (!(fOptions & kNoFileCache))) {
       fCacheSize = fFromTree->GetCacheAutoSize();
    }
@@ -724,6 +751,13 @@ UInt_t TTreeCloner::FillCache(UInt_t from)
 
 void TTreeCloner::WriteBaskets()
 {
+#ifdef R__USE_IMT
+   if (!IsInPlace() && fMaxBaskets > 1 && ROOT::IsImplicitMTEnabled()) {
+      WriteBasketsPipelined();
+      return;
+   }
+#endif
+
    TBasket *basket = new TBasket();
    for(UInt_t j = 0, notCached = 0; j<fMaxBaskets; ++j) {
       TBranch *from = (TBranch*)fFromBranches.UncheckedAt( fBasketBranchNum[ fBasketIndex[j] ] );
@@ -776,3 +810,88 @@ void TTreeCloner::WriteBaskets()
    }
    delete basket;
 }
+
+#ifdef R__USE_IMT
+////////////////////////////////////////////////////////////////////////////////
+/// Transfer the baskets from the input file to the output file, reading the
+/// next group of baskets from the input file while the current group is being
+/// written to the output file.
+///
+/// A group holds the baskets fitting in the file cache, or a fixed number of
+/// baskets when the cache is disabled. Only the reading task touches the input
+/// file and only the writing loop touches the output file; the baskets are
+/// still written in the order given by SortBaskets.
+
+void TTreeCloner::WriteBasketsPipelined()
+{
+   static constexpr UInt_t kBasketsPerGroup = 256; // Group size when there is no file cache.
+
+   struct BasketGroup {
+      UInt_t fBegin = 0;
+      UInt_t fEnd = 0;
+      std::vector<std::unique_ptr<TBasket>> fBaskets; ///< Loaded baskets, null for the ones not on file.
+   };
+
+   auto load = [this](BasketGroup &group, UInt_t begin) {
+      group.fBegin = begin;
+      group.fEnd = fFileCache ? FillCache(begin) : std::min(fMaxBaskets, begin + kBasketsPerGroup);
+      if (group.fEnd == begin) {
+         // This basket alone does not fit in the cache, it is read directly.
+         group.fEnd = begin + 1;
+      }
+      group.fBaskets.resize(group.fEnd - group.fBegin);
+      for (UInt_t j = group.fBegin; j < group.fEnd; ++j) {
+         TBranch *from = (TBranch *)fFromBranches.UncheckedAt(fBasketBranchNum[fBasketIndex[j]]);
+         TFile *fromfile = from->GetFile(0);
+         Int_t index = fBasketNum[fBasketIndex[j]];
+         auto &basket = group.fBaskets[j - group.fBegin];
+         Long64_t pos = from->GetBasketSeek(index);
+         if (pos == 0) {
+            basket.reset();
+            continue;
+         }
+         if (!basket)
+            basket.reset(new TBasket());
+         if (from->GetBasketBytes()[index] == 0) {
+            from->GetBasketBytes()[index] = basket->ReadBasketBytes(pos, fromfile);
+         }
+         basket->LoadBasketBuffers(pos, from->GetBasketBytes()[index], fromfile, fFromTree);
+      }
+   };
+
+   auto write = [this](BasketGroup &group) {
+      for (UInt_t j = group.fBegin; j < group.fEnd; ++j) {
+         TBranch *from = (TBranch *)fFromBranches.UncheckedAt(fBasketBranchNum[fBasketIndex[j]]);
+         TBranch *to = (TBranch *)fToBranches.UncheckedAt(fBasketBranchNum[fBasketIndex[j]]);
+         Int_t index = fBasketNum[fBasketIndex[j]];
+         if (TBasket *basket = group.fBaskets[j - group.fBegin].get()) {
+            basket->IncrementPidOffset(fPidOffset);
+            basket->CopyTo(fToFile);
+            to->AddBasket(*basket, kTRUE, fToStartEntries + from->GetBasketEntry()[index]);
+         } else {
+            TBasket *frombasket = from->GetBasket(index);
+            if (frombasket && frombasket->GetNevBuf() > 0) {
+               TBasket *tobasket = (TBasket *)frombasket->Clone();
+               tobasket->SetBranch(to);
+               to->AddBasket(*tobasket, kFALSE, fToStartEntries + from->GetBasketEntry()[index]);
+               to->FlushOneBasket(to->GetWriteBasket());
+            }
+         }
+      }
+   };
+
+   BasketGroup groups[2];
+   ROOT::Experimental::TTaskGroup reader;
+   load(groups[0], 0);
+   for (Int_t current = 0;; current = 1 - current) {
+      BasketGroup &group = groups[current];
+      const Bool_t hasNext = group.fEnd < fMaxBaskets;
+      if (hasNext)
+         reader.Run([&load, &groups, current] { load(groups[1 - current], groups[current].fEnd); });
+      write(group);
+      reader.Wait();
+      if (!hasNext)
+         break;
+   }
+}
+#endif
@@ -0,0 +1,47 @@
+// @(#)root/tree:$Id$
+
+/*************************************************************************
+ * Copyright (C) 1995-2020, Rene Brun and Fons Rademakers.               *
+ * All rights reserved.                                                  *
+ *                                                                       *
+ * For the licensing terms see $ROOTSYS/LICENSE.                         *
+ * For the list of contributors see $ROOTSYS/README/CREDITS.             *
+ *************************************************************************/
+
+#ifndef ROOT_TTreeFlatFillPlan
+#define ROOT_TTreeFlatFillPlan
+
+#include "RtypesCore.h"
+
+#include <vector>
+
+class TBranch;
+
+/** \class ROOT::Internal::TTreeFlatFillPlan
+ Fill plan of a TTree whose branches hold fixed-size arrays of basic types.
+
+ There is one slot per top-level branch, in the order of TTree::GetListOfBranches().
+ A slot with a non-zero number of bytes is filled by TBranch::FillFlat, which copies
+ the value at the branch address into the basket buffer; the other slots go through
+ TBranch::FillImpl. See TTree::SetFlatFill.
+*/
+
+namespace ROOT {
+namespace Internal {
+
+struct TTreeFlatFillPlan {
+   struct Slot {
+      TBranch *fBranch = nullptr; ///< The branch filled through this slot
+      Int_t fOffset = 0;          ///< Offset of the leaf value from the branch address
+      Int_t fNbytes = 0;          ///< Bytes written per entry, 0 if filled through TBranch::FillImpl
+      Int_t fElemSize = 0;        ///< Size of one element, used for the byte swap
+   };
+
+   std::vector<Slot> fSlots; ///< One slot per top-level branch
+   bool fStale = true;       ///< Whether the plan must be rebuilt before the next Fill
+};
+
+} // namespace Internal
+} // namespace ROOT
+
+#endif
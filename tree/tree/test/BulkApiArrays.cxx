@@ -0,0 +1,111 @@
+#include "TBranch.h"
+#include "TBufferFile.h"
+#include "TFile.h"
+#include "TSystem.h"
+#include "TTree.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+class BulkApiArraysTest : public ::testing::Test {
+public:
+   static constexpr Long64_t fClusterSize = 1000;
+   static constexpr Long64_t fEventCount = 10000;
+   const std::string fFileName = "BulkApiTestArrays.root";
+
+protected:
+   void SetUp() override
+   {
+      auto hfile = new TFile(fFileName.c_str(), "RECREATE");
+      auto tree = new TTree("T", "A ROOT tree of array-valued branches.");
+      tree->SetBit(TTree::kOnlyFlushAtCluster);
+      tree->SetAutoFlush(fClusterSize);
+
+      int len = 0;
+      float fixed[3];
+      float var[10];
+      std::vector<float> vecF;
+      std::vector<int> vecI;
+      tree->Branch("len", &len, "len/I");
+      tree->Branch("fixed", &fixed, "fixed[3]/F");
+      tree->Branch("var", &var, "var[len]/F");
+      tree->Branch("vecF", &vecF);
+      tree->Branch("vecI", &vecI);
+      for (Long64_t ev = 0; ev < fEventCount; ev++) {
+         len = ev % 10;
+         vecF.clear();
+         vecI.clear();
+         for (int idx = 0; idx < 3; idx++)
+            fixed[idx] = ev + idx;
+         for (int idx = 0; idx < len; idx++) {
+            var[idx] = ev * 10 + idx;
+            vecF.push_back(-var[idx]);
+            vecI.push_back(ev * 10 + idx);
+         }
+         tree->Fill();
+      }
+      hfile->Write();
+      delete hfile;
+   }
+
+   void TearDown() override { gSystem->Unlink(fFileName.c_str()); }
+};
+
+constexpr Long64_t BulkApiArraysTest::fClusterSize;
+constexpr Long64_t BulkApiArraysTest::fEventCount;
+
+TEST_F(BulkApiArraysTest, bulkRead)
+{
+   auto hfile = TFile::Open(fFileName.c_str());
+   auto tree = hfile->Get<TTree>("T");
+   ASSERT_TRUE(tree);
+   auto branchFixed = tree->GetBranch("fixed");
+   auto branchVar = tree->GetBranch("var");
+   auto branchVecF = tree->GetBranch("vecF");
+   auto branchVecI = tree->GetBranch("vecI");
+   ASSERT_TRUE(branchFixed && branchVar && branchVecF && branchVecI);
+   EXPECT_TRUE(branchFixed->GetBulkRead().SupportsBulkArrayRead());
+   EXPECT_TRUE(branchVar->GetBulkRead().SupportsBulkArrayRead());
+   EXPECT_TRUE(branchVecF->GetBulkRead().SupportsBulkArrayRead());
+   EXPECT_TRUE(branchVecI->GetBulkRead().SupportsBulkArrayRead());
+
+   TBufferFile fixedBuf(TBuffer::kWrite, 32 * 1024);
+   TBufferFile varBuf(TBuffer::kWrite, 32 * 1024);
+   TBufferFile vecFBuf(TBuffer::kWrite, 32 * 1024);
+   TBufferFile vecIBuf(TBuffer::kWrite, 32 * 1024);
+   std::vector<Int_t> fixedOffsets, varOffsets, vecFOffsets, vecIOffsets;
+
+   Long64_t evt_idx = 0;
+   while (evt_idx < fEventCount) {
+      auto count = branchFixed->GetBulkRead().GetBulkEntries(evt_idx, fixedBuf, fixedOffsets);
+      ASSERT_GT(count, 0);
+      ASSERT_EQ(count, branchVar->GetBulkRead().GetBulkEntries(evt_idx, varBuf, varOffsets));
+      ASSERT_EQ(count, branchVecF->GetBulkRead().GetBulkEntries(evt_idx, vecFBuf, vecFOffsets));
+      ASSERT_EQ(count, branchVecI->GetBulkRead().GetBulkEntries(evt_idx, vecIBuf, vecIOffsets));
+      ASSERT_EQ(static_cast<size_t>(count + 1), varOffsets.size());
+
+      auto fixedData = reinterpret_cast<float *>(fixedBuf.GetCurrent());
+      auto varData = reinterpret_cast<float *>(varBuf.GetCurrent());
+      auto vecFData = reinterpret_cast<float *>(vecFBuf.GetCurrent());
+      auto vecIData = reinterpret_cast<int *>(vecIBuf.GetCurrent());
+      for (Int_t idx = 0; idx < count; idx++) {
+         Long64_t ev = evt_idx + idx;
+         ASSERT_EQ(3, fixedOffsets[idx + 1] - fixedOffsets[idx]);
+         for (int i = 0; i < 3; i++)
+            EXPECT_FLOAT_EQ(ev + i, fixedData[fixedOffsets[idx] + i]);
+
+         ASSERT_EQ(ev % 10, varOffsets[idx + 1] - varOffsets[idx]);
+         ASSERT_EQ(ev % 10, vecFOffsets[idx + 1] - vecFOffsets[idx]);
+         ASSERT_EQ(ev % 10, vecIOffsets[idx + 1] - vecIOffsets[idx]);
+         for (int i = 0; i < ev % 10; i++) {
+            EXPECT_FLOAT_EQ(ev * 10 + i, varData[varOffsets[idx] + i]);
+            EXPECT_FLOAT_EQ(-(ev * 10 + i), vecFData[vecFOffsets[idx] + i]);
+            EXPECT_EQ(ev * 10 + i, vecIData[vecIOffsets[idx] + i]);
+         }
+      }
+      evt_idx += count;
+   }
+   EXPECT_EQ(fEventCount, evt_idx);
+   delete hfile;
+}
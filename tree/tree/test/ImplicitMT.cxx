@@ -28,4 +28,50 @@ TEST(TTreeImplicitMT, flushBaskets)
    gSystem->Unlink(ofileName);
 }
 
+TEST(TTreeImplicitMT, fastCloneBaskets)
+{
+   ROOT::EnableImplicitMT();
+   const auto ifileName = "fastCloneBasketsMTIn.root";
+   const auto ofileName = "fastCloneBasketsMTOut.root";
+   {
+      TFile f(ifileName, "RECREATE");
+      TTree t("t", "t");
+      int i = 0;
+      double x = 0.;
+      t.Branch("i", &i, 1000);
+      t.Branch("x", &x, 1000);
+      for (i = 0; i < 10000; ++i) {
+         x = 0.5 * i;
+         t.Fill();
+      }
+      t.Write();
+   }
+   {
+      TFile fin(ifileName);
+      auto tin = fin.Get<TTree>("t");
+      ASSERT_NE(nullptr, tin);
+      TFile fout(ofileName, "RECREATE");
+      auto tout = tin->CloneTree(-1, "fast");
+      ASSERT_NE(nullptr, tout);
+      fout.Write();
+   }
+   {
+      TFile f(ofileName);
+      auto t = f.Get<TTree>("t");
+      ASSERT_NE(nullptr, t);
+      ASSERT_EQ(10000, t->GetEntries());
+      int i = -1;
+      double x = -1.;
+      t->SetBranchAddress("i", &i);
+      t->SetBranchAddress("x", &x);
+      for (Long64_t e = 0; e < t->GetEntries(); ++e) {
+         t->GetEntry(e);
+         EXPECT_EQ(e, i);
+         EXPECT_DOUBLE_EQ(0.5 * e, x);
+      }
+   }
+   gSystem->Unlink(ifileName);
+   gSystem->Unlink(ofileName);
+}
+
 #endif // R__USE_IMT
@@ -0,0 +1,63 @@
+#include "SillyStruct.h"
+#include "TClonesArray.h"
+#include "TFile.h"
+#include "TSystem.h"
+#include "TTree.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+// Split collections of objects read their basic members in bulk.
+TEST(MemberWiseRead, SplitCollections)
+{
+   const auto fileName = "memberwiseread.root";
+   {
+      TFile f(fileName, "RECREATE");
+      TTree t("t", "t");
+      TClonesArray clones("SillyStruct");
+      std::vector<SillyStruct> vec;
+      t.Branch("clones", &clones, 32000, 99);
+      t.Branch("vec", &vec, 32000, 99);
+      for (int e = 0; e < 100; ++e) {
+         clones.Clear();
+         vec.clear();
+         for (int j = 0; j < e % 17; ++j) {
+            auto ss = new (clones[j]) SillyStruct();
+            ss->f = 0.5f * e + j;
+            ss->i = -e * j;
+            ss->d = 1e10 * e + j;
+            vec.push_back(*ss);
+         }
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   TFile f(fileName);
+   auto t = f.Get<TTree>("t");
+   ASSERT_NE(nullptr, t);
+   TClonesArray *clones = nullptr;
+   std::vector<SillyStruct> *vec = nullptr;
+   t->SetBranchAddress("clones", &clones);
+   t->SetBranchAddress("vec", &vec);
+   for (int e = 0; e < 100; ++e) {
+      ASSERT_GT(t->GetEntry(e), 0);
+      ASSERT_EQ(e % 17, clones->GetEntriesFast());
+      ASSERT_EQ(e % 17, (int)vec->size());
+      for (int j = 0; j < e % 17; ++j) {
+         auto ss = static_cast<SillyStruct *>(clones->At(j));
+         EXPECT_FLOAT_EQ(0.5f * e + j, ss->f);
+         EXPECT_EQ(-e * j, ss->i);
+         EXPECT_DOUBLE_EQ(1e10 * e + j, ss->d);
+         EXPECT_FLOAT_EQ(ss->f, (*vec)[j].f);
+         EXPECT_EQ(ss->i, (*vec)[j].i);
+         EXPECT_DOUBLE_EQ(ss->d, (*vec)[j].d);
+      }
+   }
+   t->ResetBranchAddresses();
+   delete clones;
+   delete vec;
+   f.Close();
+   gSystem->Unlink(fileName);
+}
@@ -411,3 +411,38 @@ TEST(TBasket, TestSettingIOBits)
    readEntryOffset = reinterpret_cast<Bool_t *>(reinterpret_cast<char *>(basket2) + offset);
    EXPECT_EQ(*readEntryOffset, kTRUE);
 }
+
+TEST(TBasket, AutoOptimizeBaskets)
+{
+   TMemFile f("tbasket_autooptimize.root", "CREATE");
+   for (Long64_t maxMemory : {-1ll, 100000ll}) {
+      TTree t("t", "t");
+      Int_t small = 0;
+      Double_t large[50] = {0};
+      t.Branch("small", &small, "small/I");
+      t.Branch("large", large, "large[50]/D");
+      t.SetAutoFlush(1000);
+      t.SetAutoOptimizeBaskets(maxMemory);
+      EXPECT_EQ(maxMemory, t.GetAutoOptimizeBaskets());
+      for (Int_t i = 0; i < 5000; ++i) {
+         small = i;
+         large[i % 50] = i;
+         t.Fill();
+      }
+
+      TBranch *branches[] = {t.GetBranch("small"), t.GetBranch("large")};
+      if (maxMemory < 0) {
+         // After the first cluster, every basket holds exactly one cluster.
+         for (auto branch : branches) {
+            for (Int_t ib = 0; ib < branch->GetWriteBasket(); ++ib) {
+               if (branch->GetBasketEntry()[ib] >= 1000)
+                  EXPECT_EQ(0, branch->GetBasketEntry()[ib] % 1000) << branch->GetName() << " basket " << ib;
+            }
+            EXPECT_GE(branch->GetBasketSize(), branch->GetTotBytes() / 5);
+         }
+      } else {
+         EXPECT_LE(branches[0]->GetBasketSize() + branches[1]->GetBasketSize(), maxMemory + 2 * 512);
+         EXPECT_LT(branches[1]->GetBasketSize(), branches[1]->GetTotBytes() / 5);
+      }
+   }
+}
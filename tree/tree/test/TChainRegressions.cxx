@@ -1,10 +1,14 @@
 #include <TChain.h>
 #include <TFile.h>
+#include <TROOT.h>
 #include <TSystem.h>
 #include <TTree.h>
  
 #include "gtest/gtest.h"
 
+#include <string>
+#include <vector>
+
 class TTreeCache;
 
 // ROOT-10672
@@ -30,3 +34,46 @@ TEST(TChain, GetReadCacheBug)
 
    gSystem->Unlink(filename);
 }
+
+#ifdef R__USE_IMT
+TEST(TChain, GetEntriesConcurrently)
+{
+   const auto treename = "tree";
+   const std::vector<Long64_t> entries{10, 0, 25, 3};
+   std::vector<std::string> filenames;
+   for (std::size_t i = 0; i < entries.size(); ++i) {
+      filenames.emplace_back("tchain_getentriesconcurrently_" + std::to_string(i) + ".root");
+      TFile f(filenames.back().c_str(), "recreate");
+      TTree t(treename, treename);
+      int x = 0;
+      t.Branch("x", &x);
+      for (x = 0; x < entries[i]; ++x)
+         t.Fill();
+      t.Write();
+   }
+
+   ROOT::EnableImplicitMT(2);
+   TChain chain(treename);
+   for (const auto &f : filenames)
+      chain.Add(f.c_str());
+   // The files are opened concurrently; the tree offsets must be the ones LoadTree would compute.
+   EXPECT_EQ(chain.GetEntries(), 38);
+   ROOT::DisableImplicitMT();
+
+   Long64_t offset = 0;
+   for (std::size_t i = 0; i < entries.size(); ++i) {
+      EXPECT_EQ(chain.GetTreeOffset()[i], offset);
+      offset += entries[i];
+   }
+   int x = -1;
+   chain.SetBranchAddress("x", &x);
+   chain.GetEntry(12);
+   EXPECT_EQ(x, 2);
+   EXPECT_EQ(chain.GetTreeNumber(), 2);
+   chain.GetEntry(36);
+   EXPECT_EQ(x, 1);
+
+   for (const auto &f : filenames)
+      gSystem->Unlink(f.c_str());
+}
+#endif
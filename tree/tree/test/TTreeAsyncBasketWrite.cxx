@@ -0,0 +1,76 @@
+#include "TBranch.h"
+#include "TFile.h"
+#include "TSystem.h"
+#include "TTree.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <vector>
+
+TEST(TTree, AsyncBasketWrite)
+{
+   const char *fileName = "TTreeAsyncBasketWrite.root";
+   Long64_t zipBytes = 0;
+   {
+      TFile f(fileName, "RECREATE");
+      TTree t("t", "t");
+      EXPECT_EQ(0, t.GetAsyncBasketWrite());
+      t.SetAsyncBasketWrite(3);
+      EXPECT_EQ(3, t.GetAsyncBasketWrite());
+      int a = 0;
+      double b = 0;
+      std::vector<float> v;
+      // Small baskets and clusters, so that many baskets are queued.
+      t.SetAutoFlush(5000);
+      t.Branch("a", &a, 1000);
+      t.Branch("b", &b, 2000);
+      t.Branch("v", &v, 4000);
+      for (int i = 0; i < 20000; ++i) {
+         a = i;
+         b = 0.5 * i;
+         v.assign(i % 7, i);
+         t.Fill();
+         // Reading back a basket handed to the compression thread.
+         if (i == 12345) {
+            t.GetBranch("a")->GetEntry(100);
+            EXPECT_EQ(100, a);
+            a = i;
+         }
+      }
+      t.Write();
+      zipBytes = t.GetZipBytes();
+      EXPECT_GT(zipBytes, 0);
+      // All the queued baskets are on file.
+      for (auto br : TRangeDynCast<TBranch>(t.GetListOfBranches())) {
+         EXPECT_GT(br->GetWriteBasket(), 3);
+         for (Int_t j = 0; j < br->GetWriteBasket(); ++j)
+            EXPECT_NE(0, br->GetBasketSeek(j));
+      }
+      t.SetAsyncBasketWrite(0);
+      EXPECT_EQ(0, t.GetAsyncBasketWrite());
+   }
+
+   std::unique_ptr<TFile> f(TFile::Open(fileName));
+   auto t = f->Get<TTree>("t");
+   ASSERT_NE(nullptr, t);
+   EXPECT_EQ(20000, t->GetEntries());
+   EXPECT_EQ(zipBytes, t->GetZipBytes());
+   int a = -1;
+   double b = -1;
+   std::vector<float> vec;
+   auto v = &vec;
+   t->SetBranchAddress("a", &a);
+   t->SetBranchAddress("b", &b);
+   t->SetBranchAddress("v", &v);
+   for (Long64_t i = 0; i < t->GetEntries(); ++i) {
+      ASSERT_GT(t->GetEntry(i), 0);
+      EXPECT_EQ(i, a);
+      EXPECT_DOUBLE_EQ(0.5 * i, b);
+      ASSERT_EQ(static_cast<std::size_t>(i % 7), v->size());
+      for (auto x : *v)
+         EXPECT_FLOAT_EQ(i, x);
+   }
+   f.reset();
+   gSystem->Unlink(fileName);
+}
@@ -0,0 +1,67 @@
+#include "TFile.h"
+#include "TSystem.h"
+#include "TTree.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+#include <vector>
+
+TEST(TTree, BasketBufferPool)
+{
+   const char *fileName = "TTreeBasketBufferPool.root";
+   {
+      TFile f(fileName, "RECREATE");
+      TTree t("t", "t");
+      int a = 0;
+      double b = 0;
+      std::vector<float> v;
+      // Small baskets, so that reading switches baskets often.
+      t.Branch("a", &a, 1000);
+      t.Branch("b", &b, 2000);
+      t.Branch("v", &v, 4000);
+      for (int i = 0; i < 20000; ++i) {
+         a = i;
+         b = 0.5 * i;
+         v.assign(i % 7, i);
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   EXPECT_EQ(0, TTree::GetDefaultBasketBufferPoolSize());
+   TTree::SetDefaultBasketBufferPoolSize(1024 * 1024);
+   std::unique_ptr<TFile> f(TFile::Open(fileName));
+   auto t = f->Get<TTree>("t");
+   TTree::SetDefaultBasketBufferPoolSize(0);
+   ASSERT_NE(nullptr, t);
+   EXPECT_EQ(1024 * 1024, t->GetBasketBufferPoolSize());
+
+   int a = -1;
+   double b = -1;
+   std::vector<float> vec;
+   auto v = &vec;
+   t->SetBranchAddress("a", &a);
+   t->SetBranchAddress("b", &b);
+   t->SetBranchAddress("v", &v);
+   // Read twice, the second time with a pool too small to keep any buffer.
+   for (Long64_t poolSize : {1024 * 1024, 1}) {
+      t->SetBasketBufferPoolSize(poolSize);
+      EXPECT_EQ(poolSize, t->GetBasketBufferPoolSize());
+      for (Long64_t i = 0; i < t->GetEntries(); ++i) {
+         ASSERT_GT(t->GetEntry(i), 0);
+         EXPECT_EQ(i, a);
+         EXPECT_DOUBLE_EQ(0.5 * i, b);
+         ASSERT_EQ(static_cast<std::size_t>(i % 7), v->size());
+         for (auto x : *v)
+            EXPECT_FLOAT_EQ(i, x);
+      }
+      t->DropBaskets();
+   }
+   t->SetBasketBufferPoolSize(0);
+   EXPECT_EQ(0, t->GetBasketBufferPoolSize());
+   t->ResetBranchAddresses();
+
+   f.reset();
+   gSystem->Unlink(fileName);
+}
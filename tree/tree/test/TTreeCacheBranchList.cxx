@@ -0,0 +1,61 @@
+#include "TBranch.h"
+#include "TFile.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "TTreeCache.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+
+TEST(TTreeCache, SaveLoadBranchList)
+{
+   const char *fileName = "TTreeCacheBranchList.root";
+   const char *listName = "TTreeCacheBranchList.txt";
+   {
+      TFile f(fileName, "RECREATE");
+      TTree t("t", "t");
+      int a = 0, b = 0, c = 0;
+      t.Branch("a", &a);
+      t.Branch("b", &b);
+      t.Branch("c", &c);
+      for (int i = 0; i < 100; ++i) {
+         a = b = c = i;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   {
+      std::unique_ptr<TFile> f(TFile::Open(fileName));
+      auto t = f->Get<TTree>("t");
+      t->SetCacheSize(1024 * 1024);
+      t->SetClusterPrefetch(true);
+      auto cache = t->GetReadCache(f.get());
+      ASSERT_NE(nullptr, cache);
+      EXPECT_EQ(-1, cache->LoadBranchList("does_not_exist.txt"));
+      t->AddBranchToCache("a");
+      t->AddBranchToCache("c");
+      t->StopCacheLearningPhase();
+      EXPECT_EQ(2, cache->SaveBranchList(listName));
+   }
+
+   {
+      std::unique_ptr<TFile> f(TFile::Open(fileName));
+      auto t = f->Get<TTree>("t");
+      t->SetCacheSize(1024 * 1024);
+      auto cache = t->GetReadCache(f.get());
+      ASSERT_NE(nullptr, cache);
+      EXPECT_TRUE(cache->IsLearning());
+      EXPECT_EQ(2, cache->LoadBranchList(listName));
+      EXPECT_FALSE(cache->IsLearning());
+      EXPECT_TRUE(t->GetClusterPrefetch());
+      auto branches = cache->GetCachedBranches();
+      ASSERT_EQ(2, branches->GetEntriesFast());
+      EXPECT_EQ(t->GetBranch("a"), branches->UncheckedAt(0));
+      EXPECT_EQ(t->GetBranch("c"), branches->UncheckedAt(1));
+   }
+
+   gSystem->Unlink(fileName);
+   gSystem->Unlink(listName);
+}
@@ -0,0 +1,53 @@
+#include "TFile.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "TTreeCacheUnzip.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+
+TEST(TTreeCacheUnzip, UnzipThreads)
+{
+   const char *fileName = "TTreeCacheUnzipThreads.root";
+   {
+      TFile f(fileName, "RECREATE");
+      TTree t("t", "t");
+      t.SetAutoFlush(1000);
+      int i = 0;
+      double x = 0;
+      t.Branch("i", &i, 2000);
+      t.Branch("x", &x, 2000);
+      for (i = 0; i < 20000; ++i) {
+         x = i * 0.25;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   const auto parallel = TTreeCacheUnzip::GetParallelUnzip();
+   const auto nthreads = TTreeCacheUnzip::GetUnzipThreads();
+   TTreeCacheUnzip::SetParallelUnzip(TTreeCacheUnzip::kForce);
+   TTreeCacheUnzip::SetUnzipThreads(2);
+   {
+      std::unique_ptr<TFile> f(TFile::Open(fileName));
+      auto t = f->Get<TTree>("t");
+      ASSERT_NE(nullptr, t);
+      t->SetCacheSize(1000000);
+      auto cache = dynamic_cast<TTreeCacheUnzip *>(f->GetCacheRead(t));
+      ASSERT_NE(nullptr, cache);
+      int i = -1;
+      double x = -1;
+      t->SetBranchAddress("i", &i);
+      t->SetBranchAddress("x", &x);
+      for (Long64_t e = 0; e < t->GetEntries(); ++e) {
+         ASSERT_GT(t->GetEntry(e), 0);
+         EXPECT_EQ(e, i);
+         EXPECT_DOUBLE_EQ(e * 0.25, x);
+      }
+      EXPECT_GT(cache->GetNUnzip() + cache->GetNFound() + cache->GetNMissed(), 0);
+   }
+   TTreeCacheUnzip::SetUnzipThreads(nthreads);
+   TTreeCacheUnzip::SetParallelUnzip(parallel);
+   gSystem->Unlink(fileName);
+}
@@ -0,0 +1,100 @@
+#include "TBranch.h"
+#include "TFile.h"
+#include "TSystem.h"
+#include "TTree.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+
+namespace {
+void WriteTree(const char *fileName, bool flat)
+{
+   TFile f(fileName, "RECREATE");
+   TTree t("t", "t");
+   t.SetFlatFill(flat);
+   EXPECT_EQ(flat, t.GetFlatFill());
+   bool o = false;
+   short s = 0;
+   int n = 0;
+   Long64_t l = 0;
+   float x[3] = {0, 0, 0};
+   double d = 0;
+   float v[10];
+   t.SetAutoFlush(1000);
+   t.Branch("o", &o, "o/O");
+   t.Branch("s", &s, "s/S", 1000);
+   t.Branch("n", &n, "n/I");
+   t.Branch("l", &l, "l/L");
+   t.Branch("d", &d, "d/D");
+   t.Branch("x", x, "x[3]/F");
+   // A leaf count and a variable-size array are filled through TBranch::FillImpl.
+   t.Branch("v", v, "v[n]/F");
+   for (int i = 0; i < 5000; ++i) {
+      o = i % 2;
+      s = -i;
+      n = i % 10;
+      l = 1000000000000LL * i;
+      for (int j = 0; j < 3; ++j)
+         x[j] = 0.5f * i + j;
+      for (int j = 0; j < n; ++j)
+         v[j] = i * j;
+      d = 0.25 * i;
+      t.Fill();
+   }
+   t.Write();
+}
+} // anonymous namespace
+
+TEST(TTree, FlatFill)
+{
+   const char *flatName = "TTreeFlatFill_flat.root";
+   const char *refName = "TTreeFlatFill_ref.root";
+   WriteTree(flatName, true);
+   WriteTree(refName, false);
+
+   std::unique_ptr<TFile> flatFile(TFile::Open(flatName));
+   std::unique_ptr<TFile> refFile(TFile::Open(refName));
+   auto flat = flatFile->Get<TTree>("t");
+   auto ref = refFile->Get<TTree>("t");
+   ASSERT_NE(nullptr, flat);
+   ASSERT_NE(nullptr, ref);
+   EXPECT_EQ(ref->GetEntries(), flat->GetEntries());
+   EXPECT_EQ(ref->GetTotBytes(), flat->GetTotBytes());
+   for (auto name : {"o", "s", "n", "l", "d", "x", "v"}) {
+      EXPECT_EQ(ref->GetBranch(name)->GetWriteBasket(), flat->GetBranch(name)->GetWriteBasket()) << name;
+      EXPECT_EQ(ref->GetBranch(name)->GetTotBytes(), flat->GetBranch(name)->GetTotBytes()) << name;
+   }
+
+   bool o;
+   short s;
+   int n;
+   Long64_t l;
+   double d;
+   float x[3];
+   float v[10];
+   flat->SetBranchAddress("o", &o);
+   flat->SetBranchAddress("s", &s);
+   flat->SetBranchAddress("n", &n);
+   flat->SetBranchAddress("l", &l);
+   flat->SetBranchAddress("d", &d);
+   flat->SetBranchAddress("x", x);
+   flat->SetBranchAddress("v", v);
+   for (Long64_t i = 0; i < flat->GetEntries(); ++i) {
+      ASSERT_GT(flat->GetEntry(i), 0);
+      EXPECT_EQ(i % 2 == 1, o);
+      EXPECT_EQ(-i, s);
+      EXPECT_EQ(i % 10, n);
+      EXPECT_EQ(1000000000000LL * i, l);
+      EXPECT_DOUBLE_EQ(0.25 * i, d);
+      for (int j = 0; j < 3; ++j)
+         EXPECT_FLOAT_EQ(0.5f * i + j, x[j]);
+      for (int j = 0; j < n; ++j)
+         EXPECT_FLOAT_EQ(i * j, v[j]);
+   }
+
+   flatFile.reset();
+   refFile.reset();
+   gSystem->Unlink(flatName);
+   gSystem->Unlink(refName);
+}
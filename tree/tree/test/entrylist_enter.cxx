@@ -4,6 +4,10 @@
 
 #include "gtest/gtest.h"
 
+#include <random>
+#include <set>
+#include <vector>
+
 TEST(TEntryList, SimpleEnter) {
    TEntryList e;
    e.Enter(0);
@@ -93,3 +97,38 @@ TEST(TEntryList, EnterByTreeName) {
    for (int i = 0; i < 3; ++i)
       EXPECT_EQ(t2e->GetEntry(i), i * 2 + 6);
 }
+
+TEST(TEntryList, MergeBlocksOfDifferentDensity) {
+   // One block holds 64000 entries; fill a few blocks with entry densities covering
+   // the sparse list, bits and dense inverted list representations.
+   const Long64_t nEntries = 4 * 64000;
+   const double densities[] = {0.01, 0.5, 0.999, 0.05};
+   std::mt19937 gen(42);
+   std::uniform_real_distribution<> uniform;
+   auto fill = [&](TEntryList &e, std::set<Long64_t> &s, bool shift) {
+      for (Long64_t i = 0; i < nEntries; ++i) {
+         if (uniform(gen) < densities[(i / 64000 + shift) % 4]) {
+            e.Enter(i);
+            s.insert(i);
+         }
+      }
+      e.OptimizeStorage();
+   };
+
+   TEntryList e1, e2;
+   std::set<Long64_t> s1, s2;
+   fill(e1, s1, false);
+   fill(e2, s2, true);
+   e1.Add(&e2);
+   s1.insert(s2.begin(), s2.end());
+
+   ASSERT_EQ(e1.GetN(), static_cast<Long64_t>(s1.size()));
+   std::vector<Long64_t> expected(s1.begin(), s1.end());
+   EXPECT_EQ(e1.GetEntry(0), expected[0]);
+   for (std::size_t i = 1; i < expected.size(); ++i)
+      EXPECT_EQ(e1.Next(), expected[i]);
+   for (Long64_t i = expected.size() - 1; i >= 0; i -= 101)
+      EXPECT_EQ(e1.GetEntry(i), expected[i]);
+   for (Long64_t i = nEntries - 1; i >= 0; i -= 7)
+      EXPECT_EQ(e1.Contains(i), static_cast<Int_t>(s1.count(i)));
+}
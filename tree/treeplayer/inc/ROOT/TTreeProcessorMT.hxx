@@ -92,8 +92,13 @@ private:
 
    std::vector<std::string> FindTreeNames();
    static unsigned int fgTasksPerWorkerHint;
+   static Long64_t fgMinEntriesPerTask;
+   static unsigned int fgFilesToPrefetch;
 
    std::pair<Long64_t, Long64_t> fGlobalRange{0, std::numeric_limits<Long64_t>::max()};
+   /// Number of entries of each file if all of them are known without opening the files, e.g. because they were
+   /// passed to TChain::Add(), empty otherwise
+   const std::vector<Long64_t> fEntriesPerFile;
 
 public:
    TTreeProcessorMT(std::string_view filename, std::string_view treename = "", UInt_t nThreads = 0u,
@@ -109,6 +114,10 @@ public:
 
    static void SetTasksPerWorkerHint(unsigned int m);
    static unsigned int GetTasksPerWorkerHint();
+   static void SetMinEntriesPerTask(Long64_t n);
+   static Long64_t GetMinEntriesPerTask();
+   static void SetFilesToPrefetch(unsigned int n);
+   static unsigned int GetFilesToPrefetch();
 };
 
 } // End of namespace ROOT
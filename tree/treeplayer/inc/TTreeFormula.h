@@ -131,6 +131,13 @@ protected:
 
    RealInstanceCache fRealInstanceCache;              ///<! Cache accelerating the GetRealInstance function
 
+public:
+   using JitFunction_t = Double_t (*)(const Double_t *);
+
+protected:
+   JitFunction_t        fJitFunction = nullptr;       ///<! Compiled expression, see JitCompile()
+   static Bool_t        fgJitCompilation;             ///<  If true, new formulas are compiled, see SetJitCompilation()
+
    TTreeFormula(const char *name, const char *formula, TTree *tree, const std::vector<std::string>& aliases);
    void Init(const char *name, const char *formula);
    Bool_t      BranchHasMethod(TLeaf* leaf, TBranch* branch, const char* method,const char* params, Long64_t readentry) const;
@@ -192,18 +199,22 @@ public:
    virtual TLeaf      *GetLeaf(Int_t n) const;
    virtual Int_t       GetNcodes() const {return fNcodes;}
    virtual Int_t       GetNdata();
+   static  Bool_t      GetJitCompilation();
    //GetNdata should probably be const.  However it need to cache some information about the actual dimension
    //of arrays, so if GetNdata is const, the variables fUsedSizes and fCumulUsedSizes need to be declared
    //mutable.  We will be able to do that only when all the compilers supported for ROOT actually implemented
    //the mutable keyword.
    //NOTE: Also modify the code in PrintValue which current goes around this limitation :(
    virtual Bool_t      IsInteger(Bool_t fast=kTRUE) const;
+           Bool_t      IsJitCompiled() const { return fJitFunction != nullptr; }
            Bool_t      IsQuickLoad() const { return fQuickLoad; }
    virtual Bool_t      IsString() const;
+           Bool_t      JitCompile();
    virtual Bool_t      Notify() { UpdateFormulaLeaves(); return kTRUE; }
    virtual char       *PrintValue(Int_t mode=0) const;
    virtual char       *PrintValue(Int_t mode, Int_t instance, const char *decform = "9.9") const;
    virtual void        SetAxis(TAxis *axis=0);
+   static  void        SetJitCompilation(Bool_t enable = kTRUE);
            void        SetQuickLoad(Bool_t quick) { fQuickLoad = quick; }
    virtual void        SetTree(TTree *tree) {fTree = tree;}
    virtual void        ResetLoading();
@@ -39,9 +39,12 @@ protected:
    TTreeFormula  *fMinorFormula;        ///<! Pointer to minor TreeFormula
    TTreeFormula  *fMajorFormulaParent;  ///<! Pointer to major TreeFormula in Parent tree (if any)
    TTreeFormula  *fMinorFormulaParent;  ///<! Pointer to minor TreeFormula in Parent tree (if any)
+   Long64_t       fFriendPos{0};        ///<! Position in the sorted tables of the last GetEntryNumberFriend() lookup
 
    TTreeFormula  *GetMajorFormulaParent(const TTree *parent);
    TTreeFormula  *GetMinorFormulaParent(const TTree *parent);
+   Long64_t       FindValues(Long64_t major, Long64_t minor, Long64_t pos, Long64_t count) const;
+   Long64_t       FindValuesFrom(Long64_t major, Long64_t minor, Long64_t hint) const;
 
 private:
    TTreeIndex(const TTreeIndex&) = delete;            // Not implemented.
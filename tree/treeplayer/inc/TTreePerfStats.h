@@ -23,6 +23,8 @@
 
 #include "TVirtualPerfStats.h"
 #include "TString.h"
+#include <mutex>
+#include <thread>
 #include <vector>
 #include <unordered_map>
 
@@ -45,6 +47,26 @@ public:
       UInt_t fMissed = {0};      ///<  Number of times the basket was read directly from the file.
    };
 
+   struct BranchStats {
+      TString  fName;                   ///<  Full name of the branch
+      Long64_t fEntries = {0};          ///<  Number of entries deserialized
+      Long64_t fBytesDeserialized = {0}; ///<  Number of bytes deserialized
+      Double_t fDeserializeTime = {0};  ///<  Time spent deserializing the entries
+      Long64_t fBaskets = {0};          ///<  Number of baskets read
+      Long64_t fBytesRead = {0};        ///<  Size on file of the baskets read
+      Long64_t fBytesUnzipped = {0};    ///<  Uncompressed size of the baskets read
+      Double_t fUnzipTime = {0};        ///<  Time spent uncompressing the baskets
+      Long64_t fCacheHits = {0};        ///<  Number of baskets found in the read cache
+      Long64_t fCacheMisses = {0};      ///<  Number of baskets read directly from the file
+   };
+
+   struct ThreadStats {
+      Int_t    fReadCalls = {0};        ///<  Number of read calls
+      Double_t fReadTime = {0};         ///<  Time spent waiting for the read calls
+      Double_t fUnzipTime = {0};        ///<  Time spent uncompressing baskets
+      Double_t fDeserializeTime = {0};  ///<  Time spent deserializing entries
+   };
+
    using BasketList_t = std::vector<std::pair<TBranch*, std::vector<size_t>>>;
 
 protected:
@@ -76,12 +98,17 @@ protected:
    std::unordered_map<TBranch*, size_t>  fBranchIndexCache; // Cache the index of the branch in the cache's array.
    std::vector<std::vector<BasketInfo> > fBasketsInfo;      // Details on which baskets was used, cached, 'miss-cached' or read uncached.Browse
 
+   mutable std::mutex fMutex;                                 ///<! Protects the statistics filled concurrently under IMT
+   std::vector<BranchStats> fBranchStats;                     ///<! Statistics of each branch read
+   std::unordered_map<TBranch*, size_t> fBranchStatsIndex;    ///<! Index in fBranchStats of the branches of the current tree
+   std::vector<std::pair<std::thread::id, ThreadStats>> fThreadStats; ///<! Statistics of each thread, in order of first use
+
    BasketInfo &GetBasketInfo(TBranch *b, size_t basketNumber);
    BasketInfo &GetBasketInfo(size_t bi, size_t basketNumber);
+   BranchStats &FindBranchStats(TBranch *b);
+   ThreadStats &FindThreadStats();
 
-   virtual void SetFile(TFile *newfile) {
-      fFile = newfile;
-   }
+   virtual void SetFile(TFile *newfile);
 
 public:
    TTreePerfStats();
@@ -92,6 +119,8 @@ public:
    virtual void     Draw(Option_t *option="");
    virtual void     ExecuteEvent(Int_t event, Int_t px, Int_t py);
    virtual void     Finish();
+   std::vector<BranchStats> GetBranchStats() const;
+   std::vector<ThreadStats> GetThreadStats() const;
    virtual Long64_t GetBytesRead() const {return fBytesRead;}
    virtual Long64_t GetBytesReadExtra() const {return fBytesReadExtra;}
    virtual Double_t GetCpuTime()   const {return fCpuTime;}
@@ -109,6 +138,8 @@ public:
    TStopwatch      *GetStopwatch() const {return fWatch;}
    virtual Int_t    GetTreeCacheSize() const {return fTreeCacheSize;}
    virtual Double_t GetUnzipTime() const {return fUnzipTime; }
+   TString          GetReportJSON() const;
+   TTree           *MakeBranchStatsTree() const;
    virtual void     Paint(Option_t *chopt="");
    virtual void     Print(Option_t *option="") const;
 
@@ -120,6 +151,8 @@ public:
    virtual void     FileReadEvent(TFile *file, Int_t len, Double_t start);
    virtual void     UnzipEvent(TObject *tree, Long64_t pos, Double_t start, Int_t complen, Int_t objlen);
    virtual void     RateEvent(Double_t , Double_t , Long64_t , Long64_t) {}
+   virtual void     BasketReadEvent(TBranch *branch, Int_t nbytes, Int_t objlen, Bool_t fromCache, Double_t unzipTime);
+   virtual void     DeserializeEvent(TBranch *branch, Int_t nbytes, Double_t start);
 
    virtual void     SaveAs(const char *filename="",Option_t *option="") const;
    virtual void     SavePrimitive(std::ostream &out, Option_t *option = "");
@@ -142,14 +175,15 @@ public:
    virtual void     SetUnzipTime(Double_t uztime) {fUnzipTime = uztime;}
 
    virtual void     PrintBasketInfo(Option_t *option = "") const;
-   virtual void     SetLoaded(TBranch *b, size_t basketNumber) { ++GetBasketInfo(b, basketNumber).fLoaded; }
-   virtual void     SetLoaded(size_t bi, size_t basketNumber) { ++GetBasketInfo(bi, basketNumber).fLoaded; }
-   virtual void     SetLoadedMiss(TBranch *b, size_t basketNumber) { ++GetBasketInfo(b, basketNumber).fLoadedMiss; }
-   virtual void     SetLoadedMiss(size_t bi, size_t basketNumber) { ++GetBasketInfo(bi, basketNumber).fLoadedMiss; }
-   virtual void     SetMissed(TBranch *b, size_t basketNumber) { ++GetBasketInfo(b, basketNumber).fMissed; }
-   virtual void     SetMissed(size_t bi, size_t basketNumber) { ++GetBasketInfo(bi, basketNumber).fMissed; }
-   virtual void     SetUsed(TBranch *b, size_t basketNumber) { ++GetBasketInfo(b, basketNumber).fUsed; }
-   virtual void     SetUsed(size_t bi, size_t basketNumber) { ++GetBasketInfo(bi, basketNumber).fUsed; }
+   virtual void     PrintBranchStats(Option_t *option = "") const;
+   virtual void     SetLoaded(TBranch *b, size_t basketNumber) { std::lock_guard<std::mutex> lock(fMutex); ++GetBasketInfo(b, basketNumber).fLoaded; }
+   virtual void     SetLoaded(size_t bi, size_t basketNumber) { std::lock_guard<std::mutex> lock(fMutex); ++GetBasketInfo(bi, basketNumber).fLoaded; }
+   virtual void     SetLoadedMiss(TBranch *b, size_t basketNumber) { std::lock_guard<std::mutex> lock(fMutex); ++GetBasketInfo(b, basketNumber).fLoadedMiss; }
+   virtual void     SetLoadedMiss(size_t bi, size_t basketNumber) { std::lock_guard<std::mutex> lock(fMutex); ++GetBasketInfo(bi, basketNumber).fLoadedMiss; }
+   virtual void     SetMissed(TBranch *b, size_t basketNumber) { std::lock_guard<std::mutex> lock(fMutex); ++GetBasketInfo(b, basketNumber).fMissed; }
+   virtual void     SetMissed(size_t bi, size_t basketNumber) { std::lock_guard<std::mutex> lock(fMutex); ++GetBasketInfo(bi, basketNumber).fMissed; }
+   virtual void     SetUsed(TBranch *b, size_t basketNumber) { std::lock_guard<std::mutex> lock(fMutex); ++GetBasketInfo(b, basketNumber).fUsed; }
+   virtual void     SetUsed(size_t bi, size_t basketNumber) { std::lock_guard<std::mutex> lock(fMutex); ++GetBasketInfo(bi, basketNumber).fUsed; }
    virtual void     UpdateBranchIndices(TObjArray *branchNames);
 
    BasketList_t     GetDuplicateBasketCache() const;
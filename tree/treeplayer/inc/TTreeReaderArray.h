@@ -39,6 +39,11 @@ Base class of TTreeReaderArray.
 
    protected:
       void *UntypedAt(std::size_t idx) const { return fImpl->At(GetProxy(), idx); }
+      /// Return whether the elements are stored in one block of memory, at a distance of `valueSize` from each other.
+      bool IsContiguousImpl(std::size_t valueSize) const
+      {
+         return fImpl && fImpl->GetContiguousStride(GetProxy()) == valueSize;
+      }
       virtual void CreateProxy();
       bool GetBranchAndLeaf(TBranch* &branch, TLeaf* &myLeaf,
                             TDictionary* &branchActualType);
@@ -207,6 +212,14 @@ public:
    T &operator[](std::size_t idx) { return At(idx); }
    const T &operator[](std::size_t idx) const { return At(idx); }
 
+   /// Return whether the elements of the current entry are stored in one block of memory, as in a
+   /// `std::vector<T>` or a C array of `T`, so that they can be accessed through GetData().
+   bool IsContiguous() const { return IsContiguousImpl(sizeof(T)); }
+   /// Return the address of the first element, through which all the GetSize() elements can be accessed
+   /// without going through At(). Return nullptr if the array is empty or not contiguous.
+   T *GetData() { return IsContiguous() && GetSize() ? &At(0) : nullptr; }
+   const T *GetData() const { return IsContiguous() && GetSize() ? &At(0) : nullptr; }
+
    iterator begin() { return iterator(0u, this); }
    iterator end() { return iterator(GetSize(), this); }
    const_iterator begin() const { return cbegin(); }
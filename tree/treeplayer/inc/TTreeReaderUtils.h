@@ -76,6 +76,9 @@ namespace Internal {
       virtual ~TVirtualCollectionReader();
       virtual size_t GetSize(Detail::TBranchProxy*) = 0;
       virtual void* At(Detail::TBranchProxy*, size_t /*idx*/) = 0;
+      /// Return the distance in bytes between consecutive elements if they are all stored
+      /// in one block of memory starting at At(0), 0 otherwise.
+      virtual size_t GetContiguousStride(Detail::TBranchProxy*) { return 0; }
    };
 
 }
@@ -135,10 +135,15 @@ void TSelectorDraw::Begin(TTree *tree)
    Bool_t optpara = kFALSE;
    Bool_t optcandle = kFALSE;
    Bool_t opt5d = kFALSE;
+   Bool_t optJit = kFALSE;
    if (opt.Contains("same")) {
       optSame = kTRUE;
       opt.ReplaceAll("same", "");
    }
+   if (opt.Contains("jit")) {
+      optJit = kTRUE;
+      opt.ReplaceAll("jit", "");
+   }
    if (opt.Contains("entrylist")) {
       optEnlist = kTRUE;
       if (opt.Contains("entrylistarray")) {
@@ -483,6 +488,10 @@ void TSelectorDraw::Begin(TTree *tree)
       delete[] varexp;
       return;
    }
+   if (optJit) {
+      if (fSelect) fSelect->JitCompile();
+      for (i = 0; i < fDimension; ++i) fVar[i]->JitCompile();
+   }
    if (fDimension > 4 && !(optpara || optcandle || opt5d || opt.Contains("goff"))) {
       Abort("Too many variables. Use the option \"para\", \"gl5d\" or \"candle\" to display more than 4 variables.");
       delete[] varexp;
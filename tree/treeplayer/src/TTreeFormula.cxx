@@ -51,6 +51,11 @@
 #include <cstdlib>
 #include <typeinfo>
 #include <algorithm>
+#include <map>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 const Int_t kMaxLen     = 1024;
 
@@ -94,6 +99,8 @@ The following method are available from the TFormLeafInfo interface:
 
 ClassImp(TTreeFormula);
 
+Bool_t TTreeFormula::fgJitCompilation = kFALSE;
+
 ////////////////////////////////////////////////////////////////////////////////
 
 inline static void R__LoadBranch(TBranch* br, Long64_t entry, Bool_t quickLoad)
@@ -315,6 +322,8 @@ void TTreeFormula::Init(const char*name, const char* expression)
 
    }
 
+   if (fgJitCompilation) JitCompile();
+
    if(savedir) savedir->cd();
 }
 
@@ -4006,6 +4015,19 @@ T TTreeFormula::EvalInstance(Int_t instance, const char *stringStackArg[])
       }
    }
 
+   if (std::is_same<T, Double_t>::value && fJitFunction && instance == 0) {
+      // The compiled expression only needs the value of each (scalar) leaf.
+      const Bool_t willLoad = kTRUE;
+      fNeedLoading = kFALSE;
+      fDidBooleanOptimization = kFALSE;
+      Double_t values[kMAXCODES];
+      for (Int_t code = 0; code < fNcodes; ++code) {
+         TT_EVAL_INIT_LOOP;
+         values[code] = leaf->GetTypedValue<Double_t>(real_instance);
+      }
+      return fJitFunction(values);
+   }
+
    T tab[kMAXFOUND];
    const Int_t kMAXSTRINGFOUND = 10;
    const char *stringStackLocal[kMAXSTRINGFOUND];
@@ -5742,3 +5764,185 @@ Bool_t TTreeFormula::SwitchToFormLeafInfo(Int_t code)
    }
    return kTRUE;
 }
+
+namespace {
+
+// Helpers mirroring the special cases of TTreeFormula::EvalInstance() for the compiled expressions.
+const char *kJitHelpers = R"CODE(
+#include "TMath.h"
+#include <cmath>
+namespace TTreeFormulaJit {
+inline double Div(double a, double b) { return b == 0 ? 0 : a / b; }
+inline double Mod(double a, double b) { return double((long long)a % (long long)b); }
+inline double Tan(double a) { return TMath::Cos(a) == 0 ? 0 : TMath::Tan(a); }
+inline double ACos(double a) { return TMath::Abs(a) > 1 ? 0 : TMath::ACos(a); }
+inline double ASin(double a) { return TMath::Abs(a) > 1 ? 0 : TMath::ASin(a); }
+inline double TanH(double a) { return TMath::CosH(a) == 0 ? 0 : TMath::TanH(a); }
+inline double ACosH(double a) { return a < 1 ? 0 : TMath::ACosH(a); }
+inline double ATanH(double a) { return TMath::Abs(a) > 1 ? 0 : TMath::ATanH(a); }
+inline double Sq(double a) { return a * a; }
+inline double Sqrt(double a) { return TMath::Sqrt(TMath::Abs(a)); }
+inline double Log(double a) { return a > 0 ? TMath::Log(a) : 0; }
+inline double Log10(double a) { return a > 0 ? TMath::Log10(a) : 0; }
+inline double Exp(double a) { return a < -700 ? 0 : TMath::Exp(a > 700 ? 700 : a); }
+inline double Sign(double a) { return a < 0 ? -1 : 1; }
+inline double Int(double a) { return double((long long)a); }
+inline double Bool(bool b) { return b ? 1 : 0; }
+inline double BitAnd(double a, double b) { return double((unsigned long long)a & (unsigned long long)b); }
+inline double BitOr(double a, double b) { return double((unsigned long long)a | (unsigned long long)b); }
+inline double LeftShift(double a, double b) { return double((unsigned long long)a << (unsigned long long)b); }
+inline double RightShift(double a, double b) { return double((unsigned long long)a >> (unsigned long long)b); }
+}
+)CODE";
+
+std::mutex gJitMutex;
+std::map<std::string, TTreeFormula::JitFunction_t> gJitCache;
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+/// Compile the expression to native code through the interpreter.
+///
+/// Once compiled, EvalInstance() (in double precision) reads the leaves of the
+/// formula and calls the compiled function instead of interpreting the
+/// expression. Only expressions made of scalar leaves that are accessed
+/// directly, numerical constants, arithmetic, comparison and logical operators
+/// and the usual mathematical functions are supported; any other formula (arrays,
+/// strings, aliases, methods, external functions, ...) keeps being interpreted.
+/// Identical expressions are compiled only once per process.
+///
+/// Returns true if the formula is now compiled.
+
+Bool_t TTreeFormula::JitCompile()
+{
+   if (fJitFunction)
+      return kTRUE;
+   if (fNoper < 2 || fNcodes == 0 || fMultiplicity != 0 || TestBit(kIsCharacter) || fAxis || !gInterpreter)
+      return kFALSE;
+   for (Int_t code = 0; code < fNcodes; ++code) {
+      if (fLookupType[code] != kDirect || !fLeaves.UncheckedAt(code))
+         return kFALSE;
+   }
+
+   // Translate the reverse polish notation of the formula into a C++ expression.
+   std::vector<std::string> stack;
+   Bool_t ok = kTRUE;
+   auto unary = [&](const std::string &prefix, const std::string &suffix) {
+      if (stack.empty()) {
+         ok = kFALSE;
+         return;
+      }
+      stack.back() = prefix + stack.back() + suffix;
+   };
+   auto binary = [&](const std::string &prefix, const std::string &infix, const std::string &suffix) {
+      if (stack.size() < 2) {
+         ok = kFALSE;
+         return;
+      }
+      std::string rhs = std::move(stack.back());
+      stack.pop_back();
+      stack.back() = prefix + stack.back() + infix + rhs + suffix;
+   };
+   auto function = [&](const char *name) { unary(std::string(name) + "(", ")"); };
+   auto function2 = [&](const char *name) { binary(std::string(name) + "(", ", ", ")"); };
+   auto operation = [&](const char *op) { binary("(", std::string(" ") + op + " ", ")"); };
+   auto comparison = [&](const char *op) { binary("TTreeFormulaJit::Bool(", std::string(" ") + op + " ", ")"); };
+
+   for (Int_t i = 0; ok && i < fNoper; ++i) {
+      switch (GetAction(i)) {
+         case kEnd: i = fNoper; break;
+         case kConstant: stack.emplace_back(TString::Format("%.17g", GetConstant<Double_t>(GetActionParam(i))).Data()); break;
+         case kDefinedVariable: stack.emplace_back(TString::Format("v[%d]", GetActionParam(i)).Data()); break;
+         case kBoolOptimize: break; // All leaves are read beforehand, there is nothing to skip.
+         case kAdd:       operation("+"); break;
+         case kSubstract: operation("-"); break;
+         case kMultiply:  operation("*"); break;
+         case kDivide:    function2("TTreeFormulaJit::Div"); break;
+         case kModulo:    function2("TTreeFormulaJit::Mod"); break;
+         case kcos:   function("TMath::Cos"); break;
+         case ksin:   function("TMath::Sin"); break;
+         case ktan:   function("TTreeFormulaJit::Tan"); break;
+         case kacos:  function("TTreeFormulaJit::ACos"); break;
+         case kasin:  function("TTreeFormulaJit::ASin"); break;
+         case katan:  function("TMath::ATan"); break;
+         case kcosh:  function("TMath::CosH"); break;
+         case ksinh:  function("TMath::SinH"); break;
+         case ktanh:  function("TTreeFormulaJit::TanH"); break;
+         case kacosh: function("TTreeFormulaJit::ACosH"); break;
+         case kasinh: function("TMath::ASinH"); break;
+         case katanh: function("TTreeFormulaJit::ATanH"); break;
+         case katan2: function2("TMath::ATan2"); break;
+         case kfmod:  function2("fmod"); break;
+         case kpow:   function2("TMath::Power"); break;
+         case ksq:    function("TTreeFormulaJit::Sq"); break;
+         case ksqrt:  function("TTreeFormulaJit::Sqrt"); break;
+         case kmin:   function2("std::min<double>"); break;
+         case kmax:   function2("std::max<double>"); break;
+         case klog:   function("TTreeFormulaJit::Log"); break;
+         case kexp:   function("TTreeFormulaJit::Exp"); break;
+         case klog10: function("TTreeFormulaJit::Log10"); break;
+         case kpi:    stack.emplace_back("TMath::Pi()"); break;
+         case kabs:   function("TMath::Abs"); break;
+         case ksign:  function("TTreeFormulaJit::Sign"); break;
+         case kint:   function("TTreeFormulaJit::Int"); break;
+         case kSignInv: unary("(-", ")"); break;
+         case kAnd:         binary("TTreeFormulaJit::Bool(", " != 0 && ", " != 0)"); break;
+         case kOr:          binary("TTreeFormulaJit::Bool(", " != 0 || ", " != 0)"); break;
+         case kEqual:       comparison("=="); break;
+         case kNotEqual:    comparison("!="); break;
+         case kLess:        comparison("<"); break;
+         case kGreater:     comparison(">"); break;
+         case kLessThan:    comparison("<="); break;
+         case kGreaterThan: comparison(">="); break;
+         case kNot:         unary("TTreeFormulaJit::Bool(", " == 0)"); break;
+         case kBitAnd:     function2("TTreeFormulaJit::BitAnd"); break;
+         case kBitOr:      function2("TTreeFormulaJit::BitOr"); break;
+         case kLeftShift:  function2("TTreeFormulaJit::LeftShift"); break;
+         case kRightShift: function2("TTreeFormulaJit::RightShift"); break;
+         default: ok = kFALSE; break;
+      }
+   }
+   if (!ok || stack.size() != 1)
+      return kFALSE;
+   const std::string &expression = stack.back();
+
+   std::lock_guard<std::mutex> lock(gJitMutex);
+   auto cached = gJitCache.find(expression);
+   if (cached != gJitCache.end()) {
+      fJitFunction = cached->second;
+      return fJitFunction != nullptr;
+   }
+
+   static bool helpersDeclared = gInterpreter->Declare(kJitHelpers);
+   JitFunction_t compiled = nullptr;
+   if (helpersDeclared) {
+      const std::string name = "TTreeFormulaJit::F" + std::to_string(gJitCache.size());
+      const std::string code = "namespace TTreeFormulaJit { double F" + std::to_string(gJitCache.size()) +
+                               "(const double *v) { return " + expression + "; } }";
+      if (gInterpreter->Declare(code.c_str())) {
+         compiled = reinterpret_cast<JitFunction_t>(gInterpreter->Calc(("(long)&" + name).c_str()));
+      }
+   }
+   if (!compiled)
+      Warning("JitCompile", "Failed to compile %s, it will be interpreted", GetTitle());
+   gJitCache[expression] = compiled;
+   fJitFunction = compiled;
+   return fJitFunction != nullptr;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Enable or disable the compilation (see JitCompile()) of all TTreeFormula
+/// created from now on, e.g. by TTree::Draw or TTree::Scan.
+
+void TTreeFormula::SetJitCompilation(Bool_t enable)
+{
+   fgJitCompilation = enable;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return whether newly created TTreeFormula are compiled, see SetJitCompilation().
+
+Bool_t TTreeFormula::GetJitCompilation()
+{
+   return fgJitCompilation;
+}
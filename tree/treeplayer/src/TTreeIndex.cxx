@@ -19,29 +19,116 @@ A Tree Index with majorname and minorname.
 #include "TTree.h"
 #include "TBuffer.h"
 #include "TMath.h"
+#include "TROOT.h"
+#include "ROOT/TSeq.hxx"
+
+#ifdef R__USE_IMT
+#include "ROOT/TThreadExecutor.hxx"
+#endif
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <memory>
+#include <vector>
 
 ClassImp(TTreeIndex);
 
 
-struct IndexSortComparator {
+namespace {
+
+/// An entry of the index while it is being sorted. Major and minor values are mapped to unsigned integers
+/// with the same ordering, see ToSortKey().
+struct IndexSortItem {
+   ULong64_t fMajor;
+   ULong64_t fMinor;
+   Long64_t  fEntry;
+};
+
+ULong64_t ToSortKey(Long64_t value) { return static_cast<ULong64_t>(value) ^ (1ULL << 63); }
+Long64_t FromSortKey(ULong64_t key) { return static_cast<Long64_t>(key ^ (1ULL << 63)); }
+
+/// Minimum number of items for which the sort is spread over the implicit MT pool.
+constexpr std::size_t kMinParallelSortItems = 1 << 20;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Stable LSD radix sort of the items by (major, minor), one byte per pass.
+/// Passes over bytes that are the same in all items (e.g. the high bytes of run
+/// numbers) are skipped. With implicit MT enabled, large inputs are split in
+/// chunks that are histogrammed and scattered concurrently.
+
+void RadixSortIndex(std::vector<IndexSortItem> &items)
+{
+   const std::size_t n = items.size();
+   if (n < 2)
+      return;
 
-  IndexSortComparator(Long64_t *major, Long64_t *minor)
-        : fValMajor(major), fValMinor(minor)
-  {}
+   ULong64_t diffMajor = 0;
+   ULong64_t diffMinor = 0;
+   for (const auto &item : items) {
+      diffMajor |= item.fMajor ^ items[0].fMajor;
+      diffMinor |= item.fMinor ^ items[0].fMinor;
+   }
 
-   template<typename Index>
-   bool operator()(Index i1, Index i2) {
-      if( *(fValMajor + i1) == *(fValMajor + i2) )
-         return *(fValMinor + i1) < *(fValMinor + i2);
-      else
-         return *(fValMajor + i1) < *(fValMajor + i2);
+   unsigned int nChunks = 1;
+#ifdef R__USE_IMT
+   std::unique_ptr<ROOT::TThreadExecutor> pool;
+   if (ROOT::IsImplicitMTEnabled() && n >= kMinParallelSortItems) {
+      pool = std::make_unique<ROOT::TThreadExecutor>();
+      nChunks = pool->GetPoolSize();
    }
+#endif
+   const std::size_t chunkSize = (n + nChunks - 1) / nChunks;
+   auto forEachChunk = [&](const std::function<void(unsigned int)> &func) {
+#ifdef R__USE_IMT
+      if (pool) {
+         pool->Foreach(func, ROOT::TSeqU(nChunks));
+         return;
+      }
+#endif
+      for (unsigned int c = 0; c < nChunks; ++c)
+         func(c);
+   };
+
+   std::vector<IndexSortItem> buffer(n);
+   std::vector<std::array<std::size_t, 256>> offsets(nChunks);
+   IndexSortItem *src = items.data();
+   IndexSortItem *dst = buffer.data();
+   for (int pass = 0; pass < 16; ++pass) {
+      const bool isMajor = pass >= 8;
+      const int shift = 8 * (pass % 8);
+      if ((((isMajor ? diffMajor : diffMinor) >> shift) & 0xff) == 0)
+         continue;
+      auto digit = [isMajor, shift](const IndexSortItem &item) {
+         return ((isMajor ? item.fMajor : item.fMinor) >> shift) & 0xff;
+      };
 
-  // pointers to the start of index values tables keeping upper 64bit and lower 64bit
-  // of combined indexed 128bit value
-  Long64_t *fValMajor, *fValMinor;
-};
+      forEachChunk([&](unsigned int c) {
+         auto &histogram = offsets[c];
+         histogram.fill(0);
+         for (std::size_t i = c * chunkSize, end = std::min(n, (c + 1) * chunkSize); i < end; ++i)
+            ++histogram[digit(src[i])];
+      });
+      std::size_t sum = 0;
+      for (int b = 0; b < 256; ++b) {
+         for (unsigned int c = 0; c < nChunks; ++c) {
+            const auto count = offsets[c][b];
+            offsets[c][b] = sum;
+            sum += count;
+         }
+      }
+      forEachChunk([&](unsigned int c) {
+         auto &offset = offsets[c];
+         for (std::size_t i = c * chunkSize, end = std::min(n, (c + 1) * chunkSize); i < end; ++i)
+            dst[offset[digit(src[i])]++] = src[i];
+      });
+      std::swap(src, dst);
+   }
+   if (src != items.data())
+      items.swap(buffer);
+}
 
+} // anonymous namespace
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Default constructor for TTreeIndex
@@ -164,8 +251,7 @@ TTreeIndex::TTreeIndex(const TTree *T, const char *majorname, const char *minorn
    //   return;
    //}
 
-   Long64_t *tmp_major = new Long64_t[fN];
-   Long64_t *tmp_minor = new Long64_t[fN];
+   std::vector<IndexSortItem> items(fN);
    Long64_t i;
    Long64_t oldEntry = fTree->GetReadEntry();
    Int_t current = -1;
@@ -196,22 +282,20 @@ TTreeIndex::TTreeIndex(const TTree *T, const char *majorname, const char *minorn
          }
          return ret;
       };
-      tmp_major[i] = GetAndRangeCheck(true, i);
-      tmp_minor[i] = GetAndRangeCheck(false, i);
+      items[i].fMajor = ToSortKey(GetAndRangeCheck(true, i));
+      items[i].fMinor = ToSortKey(GetAndRangeCheck(false, i));
+      items[i].fEntry = i;
    }
+   RadixSortIndex(items);
    fIndex = new Long64_t[fN];
-   for(i = 0; i < fN; i++) { fIndex[i] = i; }
-   std::sort(fIndex, fIndex + fN, IndexSortComparator(tmp_major, tmp_minor) );
-   //TMath::Sort(fN,w,fIndex,0);
    fIndexValues = new Long64_t[fN];
    fIndexValuesMinor = new Long64_t[fN];
    for (i=0;i<fN;i++) {
-      fIndexValues[i] = tmp_major[fIndex[i]];
-      fIndexValuesMinor[i] = tmp_minor[fIndex[i]];
+      fIndex[i] = items[i].fEntry;
+      fIndexValues[i] = FromSortKey(items[i].fMajor);
+      fIndexValuesMinor[i] = FromSortKey(items[i].fMinor);
    }
 
-   delete [] tmp_major;
-   delete [] tmp_minor;
    fTree->LoadTree(oldEntry);
 }
 
@@ -284,29 +368,18 @@ void TTreeIndex::Append(const TVirtualIndex *add, Bool_t delaySort )
 
    // Sort.
    if (!delaySort) {
-      Long64_t *addValues = GetIndexValues();
-      Long64_t *addValues2 = GetIndexValuesMinor();
-      Long64_t *ind = fIndex;
-      Long64_t *conv = new Long64_t[fN];
-
-      for(Long64_t i = 0; i < fN; i++) { conv[i] = i; }
-      std::sort(conv, conv+fN, IndexSortComparator(addValues, addValues2) );
-      //Long64_t *w = fIndexValues;
-      //TMath::Sort(fN,w,conv,0);
-
-      fIndex = new Long64_t[fN];
-      fIndexValues = new Long64_t[fN];
-      fIndexValuesMinor = new Long64_t[fN];
-
-      for (Int_t i=0;i<fN;i++) {
-         fIndex[i] = ind[conv[i]];
-         fIndexValues[i] = addValues[conv[i]];
-         fIndexValuesMinor[i] = addValues2[conv[i]];
+      std::vector<IndexSortItem> items(fN);
+      for (Long64_t i = 0; i < fN; i++) {
+         items[i].fMajor = ToSortKey(fIndexValues[i]);
+         items[i].fMinor = ToSortKey(fIndexValuesMinor[i]);
+         items[i].fEntry = fIndex[i];
+      }
+      RadixSortIndex(items);
+      for (Long64_t i = 0; i < fN; i++) {
+         fIndex[i] = items[i].fEntry;
+         fIndexValues[i] = FromSortKey(items[i].fMajor);
+         fIndexValuesMinor[i] = FromSortKey(items[i].fMinor);
       }
-      delete [] addValues;
-      delete [] addValues2;
-      delete [] ind;
-      delete [] conv;
    }
 }
 
@@ -367,7 +440,14 @@ Long64_t TTreeIndex::GetEntryNumberFriend(const TTree *parent)
    // we check if this pair exist in the index.
    // if yes, we return the corresponding entry number
    // if not the function returns -1
-   return fTree->GetEntryNumberWithIndex(majorv,minorv);
+   // When the parent is sorted like the index (the usual case for friends
+   // aligned on run/event) the pair is found at or just after the previous
+   // one, so we merge-join from there instead of bisecting the whole table.
+   if (fN == 0) return -1;
+   fFriendPos = FindValuesFrom(majorv, minorv, fFriendPos);
+   if (fFriendPos < fN && fIndexValues[fFriendPos] == majorv && fIndexValuesMinor[fFriendPos] == minorv)
+      return fIndex[fFriendPos];
+   return -1;
 }
 
 
@@ -378,7 +458,16 @@ Long64_t TTreeIndex::GetEntryNumberFriend(const TTree *parent)
 
 Long64_t TTreeIndex::FindValues(Long64_t major, Long64_t minor) const
 {
-   Long64_t mid, step, pos = 0, count = fN;
+   return FindValues(major, minor, 0, fN);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// find position where major|minor values are in the IndexValues tables,
+/// only looking at the count positions starting at pos.
+
+Long64_t TTreeIndex::FindValues(Long64_t major, Long64_t minor, Long64_t pos, Long64_t count) const
+{
+   Long64_t mid, step;
    // find lower bound using bisection
    while( count > 0 ) {
       step = count / 2;
@@ -394,6 +483,32 @@ Long64_t TTreeIndex::FindValues(Long64_t major, Long64_t minor) const
    return pos;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// find position where major|minor values are in the IndexValues tables,
+/// starting the search at position hint and galloping forward.
+/// Same result as FindValues(major, minor), but close to constant time when
+/// the requested pairs are increasing from one call to the next.
+
+Long64_t TTreeIndex::FindValuesFrom(Long64_t major, Long64_t minor, Long64_t hint) const
+{
+   auto isLower = [this, major, minor](Long64_t i) {
+      return fIndexValues[i] < major || (fIndexValues[i] == major && fIndexValuesMinor[i] < minor);
+   };
+   // The lower bound is after hint only if everything before hint is lower.
+   if (hint < 0 || hint > fN || (hint > 0 && !isLower(hint - 1)))
+      return FindValues(major, minor);
+
+   Long64_t pos = hint, step = 1;
+   while (pos < fN && isLower(pos)) {
+      Long64_t next = pos + step;
+      if (next >= fN || !isLower(next))
+         return FindValues(major, minor, pos + 1, std::min(next, fN) - pos - 1);
+      pos = next + 1;
+      step *= 2;
+   }
+   return pos;
+}
+
 
 ////////////////////////////////////////////////////////////////////////////////
 /// Return entry number corresponding to major and minor number.
@@ -77,6 +77,22 @@ ReadTotal +ReadTotal*Readextra/100. Same for ReadSize.
 A consequence of NOTE1, the Disk I/O speed corresponds to the effective
 number of bytes returned to the application per second.
 The Physical disk speed is DiskIO + DiskIO*ReadExtra/100.
+
+ ### Per-branch and per-thread statistics
+For each branch read, the number of entries and bytes deserialized, the
+time spent deserializing them, the number and size of the baskets read, the
+time spent uncompressing them and the number of baskets found in (cache hits)
+or missing from (cache misses) the read cache are recorded. With implicit
+multi-threading, the time spent waiting for reads, uncompressing and
+deserializing is also recorded per thread. These statistics are returned by
+GetBranchStats() and GetThreadStats(), printed by PrintBranchStats(), and
+exported by GetReportJSON(), by SaveAs() when the file name ends with ".json"
+and by MakeBranchStatsTree().
+~~~{.cpp}
+   ps->SaveAs("ioperf.json");
+   TTree *stats = ps->MakeBranchStatsTree();
+   stats->Scan("name:unzipTime:deserializeTime");
+~~~
 */
 
 #include "TTreePerfStats.h"
@@ -97,10 +113,32 @@ The Physical disk speed is DiskIO + DiskIO*ReadExtra/100.
 #include "TDatime.h"
 #include "TMath.h"
 
+#include <fstream>
 #include <iostream>
+#include <string>
 
 ClassImp(TTreePerfStats);
 
+namespace {
+
+/// Return `str` as a quoted JSON string.
+TString JSONString(const char *str)
+{
+   TString result("\"");
+   for (const char *c = str; *c; ++c) {
+      if (*c == '"' || *c == '\\')
+         result += '\\';
+      if ((unsigned char)*c < 0x20)
+         result += TString::Format("\\u%04x", (unsigned char)*c);
+      else
+         result += *c;
+   }
+   result += '"';
+   return result;
+}
+
+} // anonymous namespace
+
 ////////////////////////////////////////////////////////////////////////////////
 /// default constructor (used when reading an object only)
 
@@ -286,6 +324,7 @@ void TTreePerfStats::ExecuteEvent(Int_t /*event*/, Int_t /*px*/, Int_t /*py*/)
 void TTreePerfStats::FileReadEvent(TFile *file, Int_t len, Double_t start)
 {
    if (file == this->fFile) {
+      std::lock_guard<std::mutex> lock(fMutex);
       Long64_t offset = file->GetRelOffset();
       Int_t np = fGraphIO->GetN();
       Int_t entry = fTree->GetReadEntry();
@@ -298,6 +337,9 @@ void TTreePerfStats::FileReadEvent(TFile *file, Int_t len, Double_t start)
       fGraphTime->SetPointError(np,0.001,dtime);
       fReadCalls++;
       fBytesRead += len;
+      ThreadStats &thread = FindThreadStats();
+      ++thread.fReadCalls;
+      thread.fReadTime += dtime;
    }
 }
 
@@ -312,6 +354,7 @@ void TTreePerfStats::FileReadEvent(TFile *file, Int_t len, Double_t start)
 void TTreePerfStats::UnzipEvent(TObject * tree, Long64_t /* pos */, Double_t start, Int_t complen, Int_t objlen)
 {
    if (tree == this->fTree || tree == this->fTree->GetTree()){
+      std::lock_guard<std::mutex> lock(fMutex);
       Double_t tnow = TTimeStamp();
       Double_t dtime = tnow-start;
       fUnzipTime += dtime;
@@ -320,6 +363,116 @@ void TTreePerfStats::UnzipEvent(TObject * tree, Long64_t /* pos */, Double_t sta
    }
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Record the read of a basket of `branch`.
+/// -  nbytes is the size of the basket on file
+/// -  objlen is the uncompressed size of the basket
+/// -  fromCache tells whether the basket was found in the read cache
+/// -  unzipTime is the time spent uncompressing the basket, 0 if it was not
+///    compressed or was uncompressed ahead of time by the cache
+
+void TTreePerfStats::BasketReadEvent(TBranch *branch, Int_t nbytes, Int_t objlen, Bool_t fromCache, Double_t unzipTime)
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   BranchStats &stats = FindBranchStats(branch);
+   ++stats.fBaskets;
+   stats.fBytesRead += nbytes;
+   stats.fBytesUnzipped += objlen;
+   stats.fUnzipTime += unzipTime;
+   if (fromCache)
+      ++stats.fCacheHits;
+   else
+      ++stats.fCacheMisses;
+   FindThreadStats().fUnzipTime += unzipTime;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Record the deserialization of an entry of `branch`.
+/// -  nbytes is the number of bytes deserialized
+/// -  start is the TimeStamp before deserializing
+
+void TTreePerfStats::DeserializeEvent(TBranch *branch, Int_t nbytes, Double_t start)
+{
+   Double_t dtime = TTimeStamp() - start;
+   std::lock_guard<std::mutex> lock(fMutex);
+   BranchStats &stats = FindBranchStats(branch);
+   ++stats.fEntries;
+   stats.fBytesDeserialized += nbytes;
+   stats.fDeserializeTime += dtime;
+   FindThreadStats().fDeserializeTime += dtime;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the statistics of the given branch, creating them if needed.
+/// The branches of successive trees of a TChain share statistics by name.
+/// fMutex must be held.
+
+TTreePerfStats::BranchStats &TTreePerfStats::FindBranchStats(TBranch *br)
+{
+   auto iter = fBranchStatsIndex.find(br);
+   if (iter != fBranchStatsIndex.end())
+      return fBranchStats[iter->second];
+
+   TString name = br->GetFullName();
+   size_t index = 0;
+   while (index < fBranchStats.size() && fBranchStats[index].fName != name)
+      ++index;
+   if (index == fBranchStats.size()) {
+      fBranchStats.emplace_back();
+      fBranchStats.back().fName = name;
+   }
+   fBranchStatsIndex.emplace(br, index);
+   return fBranchStats[index];
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the statistics of the calling thread, creating them if needed.
+/// fMutex must be held.
+
+TTreePerfStats::ThreadStats &TTreePerfStats::FindThreadStats()
+{
+   const auto id = std::this_thread::get_id();
+   for (auto &thread : fThreadStats) {
+      if (thread.first == id)
+         return thread.second;
+   }
+   fThreadStats.emplace_back(id, ThreadStats());
+   return fThreadStats.back().second;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return a copy of the statistics of each branch read, in order of first read.
+
+std::vector<TTreePerfStats::BranchStats> TTreePerfStats::GetBranchStats() const
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   return fBranchStats;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return a copy of the statistics of each thread which read from the tree,
+/// in order of first read.
+
+std::vector<TTreePerfStats::ThreadStats> TTreePerfStats::GetThreadStats() const
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   std::vector<ThreadStats> result;
+   result.reserve(fThreadStats.size());
+   for (auto &thread : fThreadStats)
+      result.push_back(thread.second);
+   return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Set the file being read; the branches of the previous file are forgotten.
+
+void TTreePerfStats::SetFile(TFile *newfile)
+{
+   std::lock_guard<std::mutex> lock(fMutex);
+   fFile = newfile;
+   fBranchStatsIndex.clear();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// When the run is finished this function must be called
 /// to save the current parameters in the file and Tree in this object
@@ -359,6 +512,7 @@ void TTreePerfStats::Finish()
 
 void TTreePerfStats::UpdateBranchIndices(TObjArray *branches)
 {
+   std::lock_guard<std::mutex> lock(fMutex);
    fBranchIndexCache.clear();
 
    for (int i = 0; i < branches->GetEntries(); ++i) {
@@ -642,12 +796,119 @@ void TTreePerfStats::PrintBasketInfo(Option_t *option) const
 }
 
 ////////////////////////////////////////////////////////////////////////////////
-/// Save this object to filename
+/// Print the statistics of each branch read and of each thread.
+
+void TTreePerfStats::PrintBranchStats(Option_t * /*option*/) const
+{
+   auto branches = GetBranchStats();
+   printf("%-30s %10s %8s %12s %12s %10s %10s %8s %8s\n", "Branch", "Entries", "Baskets", "ReadBytes",
+          "UnzipBytes", "UnzipTime", "DeserTime", "Hits", "Misses");
+   for (auto &br : branches) {
+      printf("%-30s %10lld %8lld %12lld %12lld %10.6f %10.6f %8lld %8lld\n", br.fName.Data(), br.fEntries,
+             br.fBaskets, br.fBytesRead, br.fBytesUnzipped, br.fUnzipTime, br.fDeserializeTime, br.fCacheHits,
+             br.fCacheMisses);
+   }
+   auto threads = GetThreadStats();
+   printf("%-6s %10s %10s %10s %10s\n", "Thread", "ReadCalls", "ReadTime", "UnzipTime", "DeserTime");
+   for (size_t i = 0; i < threads.size(); ++i) {
+      printf("%-6zu %10d %10.6f %10.6f %10.6f\n", i, threads[i].fReadCalls, threads[i].fReadTime,
+             threads[i].fUnzipTime, threads[i].fDeserializeTime);
+   }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return the aggregate, per-branch and per-thread statistics as a JSON document.
+/// Times are in seconds and sizes in bytes.
+
+TString TTreePerfStats::GetReportJSON() const
+{
+   TTreePerfStats *ps = (TTreePerfStats*)this;
+   ps->Finish();
+
+   TString json("{\n");
+   json += TString::Format("  \"name\": %s,\n", JSONString(GetName()).Data());
+   json += TString::Format("  \"tree\": %s,\n", JSONString(fTree ? fTree->GetName() : "").Data());
+   json += TString::Format("  \"realTime\": %g,\n  \"cpuTime\": %g,\n  \"diskTime\": %g,\n  \"unzipTime\": %g,\n",
+                           fRealTime, fCpuTime, fDiskTime, fUnzipTime);
+   json += TString::Format("  \"bytesRead\": %lld,\n  \"bytesReadExtra\": %lld,\n  \"readCalls\": %d,\n",
+                           fBytesRead, fBytesReadExtra, fReadCalls);
+   json += TString::Format("  \"treeCacheSize\": %d,\n", fTreeCacheSize);
+
+   auto branches = GetBranchStats();
+   json += "  \"branches\": [";
+   for (size_t i = 0; i < branches.size(); ++i) {
+      const BranchStats &br = branches[i];
+      json += i ? ",\n    " : "\n    ";
+      json += TString::Format("{\"name\": %s, \"entries\": %lld, \"bytesDeserialized\": %lld, "
+                              "\"deserializeTime\": %g, \"baskets\": %lld, \"bytesRead\": %lld, "
+                              "\"bytesUnzipped\": %lld, \"unzipTime\": %g, \"cacheHits\": %lld, "
+                              "\"cacheMisses\": %lld}",
+                              JSONString(br.fName).Data(), br.fEntries, br.fBytesDeserialized, br.fDeserializeTime,
+                              br.fBaskets, br.fBytesRead, br.fBytesUnzipped, br.fUnzipTime, br.fCacheHits,
+                              br.fCacheMisses);
+   }
+   json += branches.empty() ? "],\n" : "\n  ],\n";
+
+   auto threads = GetThreadStats();
+   json += "  \"threads\": [";
+   for (size_t i = 0; i < threads.size(); ++i) {
+      const ThreadStats &th = threads[i];
+      json += i ? ",\n    " : "\n    ";
+      json += TString::Format("{\"thread\": %zu, \"readCalls\": %d, \"readTime\": %g, \"unzipTime\": %g, "
+                              "\"deserializeTime\": %g}",
+                              i, th.fReadCalls, th.fReadTime, th.fUnzipTime, th.fDeserializeTime);
+   }
+   json += threads.empty() ? "]\n" : "\n  ]\n";
+   json += "}\n";
+   return json;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Return a new TTree, created in the current directory and owned by the
+/// caller, with one entry per branch read holding its statistics.
+
+TTree *TTreePerfStats::MakeBranchStatsTree() const
+{
+   auto branches = GetBranchStats();
+   BranchStats br;
+   std::string name;
+   TTree *tree = new TTree("branchstats", TString::Format("Branch statistics of %s", GetName()));
+   tree->Branch("name", &name);
+   tree->Branch("entries", &br.fEntries);
+   tree->Branch("bytesDeserialized", &br.fBytesDeserialized);
+   tree->Branch("deserializeTime", &br.fDeserializeTime);
+   tree->Branch("baskets", &br.fBaskets);
+   tree->Branch("bytesRead", &br.fBytesRead);
+   tree->Branch("bytesUnzipped", &br.fBytesUnzipped);
+   tree->Branch("unzipTime", &br.fUnzipTime);
+   tree->Branch("cacheHits", &br.fCacheHits);
+   tree->Branch("cacheMisses", &br.fCacheMisses);
+   for (auto &stats : branches) {
+      br = stats;
+      name = stats.fName.Data();
+      tree->Fill();
+   }
+   tree->ResetBranchAddresses();
+   return tree;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Save this object to filename.
+/// If filename ends with ".json", save the report returned by GetReportJSON().
 
 void TTreePerfStats::SaveAs(const char *filename, Option_t * /*option*/) const
 {
    TTreePerfStats *ps = (TTreePerfStats*)this;
    ps->Finish();
+   if (TString(filename).EndsWith(".json")) {
+      std::ofstream out(filename);
+      if (!out) {
+         Error("SaveAs", "Cannot open %s", filename);
+         return;
+      }
+      out << GetReportJSON();
+      return;
+   }
    ps->TObject::SaveAs(filename);
 }
 
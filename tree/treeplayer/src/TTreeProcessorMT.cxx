@@ -22,11 +22,22 @@ The implementation of ROOT::TTreeProcessorMT parallelizes the processing of the
 each corresponding to a cluster in the TTree. This is possible thanks to the use
 of a ROOT::TThreadedObject, so that each thread works with its own TFile and TTree
 objects.
+
+Small clusters are fused together and clusters that are much larger than the average
+task of their file are split in several subranges, see SetTasksPerWorkerHint() and
+SetMinEntriesPerTask(). Idle workers steal the pending subranges of busy ones, so that
+few large clusters at the end of the processing do not leave most workers idle.
+With remote files, the next files can be opened in background tasks while the current
+ones are processed, see SetFilesToPrefetch().
 */
 
+#include "TChainElement.h"
 #include "TROOT.h"
+#include "ROOT/TTaskGroup.hxx"
 #include "ROOT/TTreeProcessorMT.hxx"
 
+#include <mutex> // std::once_flag
+
 using namespace ROOT;
 
 namespace {
@@ -122,49 +133,112 @@ ConvertToElistClusters(std::vector<std::vector<EntryRange>> &&clusters, TEntryLi
 // EntryRanges and number of entries per file
 using ClustersAndEntries = std::pair<std::vector<std::vector<EntryRange>>, std::vector<Long64_t>>;
 
+////////////////////////////////////////////////////////////////////////
+/// Return the cluster boundaries of the given tree, with local entry numbers.
+/// The first boundary is 0 and the last one is the number of entries of the tree.
+static std::vector<Long64_t> GetClusterBoundaries(const std::string &treeName, const std::string &fileName)
+{
+   TDirectory::TContext c;
+   std::unique_ptr<TFile> f(TFile::Open(
+      fileName.c_str(), "READ_WITHOUT_GLOBALREGISTRATION")); // need TFile::Open to load plugins if need be
+   if (!f || f->IsZombie()) {
+      const auto msg = "TTreeProcessorMT::Process: an error occurred while opening file \"" + fileName + "\"";
+      throw std::runtime_error(msg);
+   }
+   auto *t = f->Get<TTree>(treeName.c_str()); // t will be deleted by f
+
+   if (!t) {
+      const auto msg = "TTreeProcessorMT::Process: an error occurred while getting tree \"" + treeName +
+                       "\" from file \"" + fileName + "\"";
+      throw std::runtime_error(msg);
+   }
+
+   // Avoid calling TROOT::RecursiveRemove for this tree, it takes the read lock and we don't need it.
+   t->ResetBit(kMustCleanup);
+   ROOT::Internal::TreeUtils::ClearMustCleanupBits(*t->GetListOfBranches());
+   auto clusterIter = t->GetClusterIterator(0);
+   Long64_t clusterStart = 0ll;
+   const Long64_t entries = t->GetEntries();
+   std::vector<Long64_t> boundaries;
+   while ((clusterStart = clusterIter()) < entries)
+      boundaries.emplace_back(clusterStart);
+   boundaries.emplace_back(entries);
+   return boundaries;
+}
+
+////////////////////////////////////////////////////////////////////////
+/// Split the clusters of a file that are much larger than its average task in several subranges,
+/// each with at least TTreeProcessorMT::GetMinEntriesPerTask() entries.
+/// A value of 0 for the minimum number of entries per task disables the splitting.
+static std::vector<EntryRange> SplitLargeClusters(std::vector<EntryRange> &&clusters, unsigned int maxTasks)
+{
+   const Long64_t minEntries = TTreeProcessorMT::GetMinEntriesPerTask();
+   if (clusters.empty() || minEntries <= 0)
+      return std::move(clusters);
+
+   Long64_t nEntries = 0ll;
+   for (const auto &c : clusters)
+      nEntries += c.second - c.first;
+   const Long64_t taskEntries = std::max(nEntries / Long64_t(maxTasks), minEntries);
+
+   std::vector<EntryRange> ranges;
+   ranges.reserve(clusters.size());
+   for (const auto &c : clusters) {
+      const Long64_t clusterEntries = c.second - c.first;
+      const Long64_t nSplits = clusterEntries / taskEntries;
+      if (nSplits < 2) {
+         ranges.emplace_back(c);
+         continue;
+      }
+      // distribute the reminder evenly onto the subranges
+      for (Long64_t i = 0ll; i < nSplits; ++i)
+         ranges.emplace_back(c.first + clusterEntries * i / nSplits, c.first + clusterEntries * (i + 1) / nSplits);
+   }
+   return ranges;
+}
+
 ////////////////////////////////////////////////////////////////////////
 /// Return a vector of cluster boundaries for the given tree and files.
+/// The boundaries of the files that were already retrieved, e.g. by a prefetch, can be passed in boundariesPerFile.
 static ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames,
                                        const std::vector<std::string> &fileNames, const unsigned int maxTasksPerFile,
-                                       const EntryRange &range = {0, std::numeric_limits<Long64_t>::max()})
+                                       const EntryRange &range = {0, std::numeric_limits<Long64_t>::max()},
+                                       std::vector<std::vector<Long64_t>> boundariesPerFile = {})
 {
    // Note that as a side-effect of opening all files that are going to be used in the
    // analysis once, all necessary streamers will be loaded into memory.
-   TDirectory::TContext c;
    const auto nFileNames = fileNames.size();
+
+   // Opening the files is dominated by latency for remote files: if all files are needed,
+   // i.e. the range does not end before the last one, open them concurrently.
+   boundariesPerFile.resize(nFileNames);
+   if (nFileNames > 1 && range.second == std::numeric_limits<Long64_t>::max() && ROOT::IsImplicitMTEnabled()) {
+      std::vector<std::size_t> fileIdxs(nFileNames);
+      std::iota(fileIdxs.begin(), fileIdxs.end(), 0u);
+      ROOT::TThreadExecutor pool;
+      pool.Foreach(
+         [&](std::size_t i) {
+            if (boundariesPerFile[i].empty())
+               boundariesPerFile[i] = GetClusterBoundaries(treeNames[i], fileNames[i]);
+         },
+         fileIdxs);
+   }
+
    std::vector<std::vector<EntryRange>> clustersPerFile;
    std::vector<Long64_t> entriesPerFile;
    entriesPerFile.reserve(nFileNames);
    Long64_t offset = 0ll;
    bool rangeEndReached = false; // flag to break the outer loop
    for (auto i = 0u; i < nFileNames && !rangeEndReached; ++i) {
-      const auto &fileName = fileNames[i];
-      const auto &treeName = treeNames[i];
-
-      std::unique_ptr<TFile> f(TFile::Open(
-         fileName.c_str(), "READ_WITHOUT_GLOBALREGISTRATION")); // need TFile::Open to load plugins if need be
-      if (!f || f->IsZombie()) {
-         const auto msg = "TTreeProcessorMT::Process: an error occurred while opening file \"" + fileName + "\"";
-         throw std::runtime_error(msg);
-      }
-      auto *t = f->Get<TTree>(treeName.c_str()); // t will be deleted by f
-
-      if (!t) {
-         const auto msg = "TTreeProcessorMT::Process: an error occurred while getting tree \"" + treeName +
-                          "\" from file \"" + fileName + "\"";
-         throw std::runtime_error(msg);
-      }
-
-      // Avoid calling TROOT::RecursiveRemove for this tree, it takes the read lock and we don't need it.
-      t->ResetBit(kMustCleanup);
-      ROOT::Internal::TreeUtils::ClearMustCleanupBits(*t->GetListOfBranches());
-      auto clusterIter = t->GetClusterIterator(0);
-      Long64_t clusterStart = 0ll, clusterEnd = 0ll;
-      const Long64_t entries = t->GetEntries();
+      if (boundariesPerFile[i].empty())
+         boundariesPerFile[i] = GetClusterBoundaries(treeNames[i], fileNames[i]);
+      const auto &boundaries = boundariesPerFile[i];
+      const Long64_t entries = boundaries.back();
       // Iterate over the clusters in the current file
       std::vector<EntryRange> entryRanges;
-      while ((clusterStart = clusterIter()) < entries && !rangeEndReached) {
-         clusterEnd = clusterIter.GetNextEntry();
+      for (auto b = 0u; b + 1 < boundaries.size() && !rangeEndReached; ++b) {
+         const auto clusterStart = boundaries[b];
+         const auto clusterEnd = boundaries[b + 1];
          // Currently, if a user specified a range, the clusters will be only globally obtained
          // Assume that there are 3 files with entries: [0, 100], [0, 150], [0, 200] (in this order)
          // Since the cluster boundaries are obtained sequentially, applying the offsets, the boundaries
@@ -215,9 +289,9 @@ static ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames
       const auto clustersInThisFileSize = clustersPerFileIt->size();
       const auto nFolds = clustersInThisFileSize / maxTasksPerFile;
       // If the number of clusters is less than maxTasksPerFile
-      // we take the clusters as they are
+      // we take the clusters as they are, only splitting the largest ones
       if (nFolds == 0) {
-         *eventRangesPerFileIt = std::move(*clustersPerFileIt);
+         *eventRangesPerFileIt = SplitLargeClusters(std::move(*clustersPerFileIt), maxTasksPerFile);
          continue;
       }
       // Otherwise, we have to merge clusters, distributing the reminder evenly
@@ -242,6 +316,24 @@ static ClustersAndEntries MakeClusters(const std::vector<std::string> &treeNames
    return std::make_pair(std::move(eventRangesPerFile), std::move(entriesPerFile));
 }
 
+////////////////////////////////////////////////////////////////////////
+/// Return the number of entries of each file of a TChain, if they are all known without opening the files (i.e. they
+/// were passed to TChain::Add()), or an empty vector.
+static std::vector<Long64_t> GetKnownEntriesPerFile(const TTree &tree)
+{
+   auto chain = dynamic_cast<const TChain *>(&tree);
+   if (!chain || !chain->GetListOfFiles())
+      return {};
+   std::vector<Long64_t> entries;
+   for (const auto *f : *chain->GetListOfFiles()) {
+      const auto nEntries = static_cast<const TChainElement *>(f)->GetEntries();
+      if (nEntries == TTree::kMaxEntries)
+         return {};
+      entries.emplace_back(nEntries);
+   }
+   return entries;
+}
+
 ////////////////////////////////////////////////////////////////////////
 /// Return a vector containing the number of entries of each file of each friend TChain
 static std::vector<std::vector<Long64_t>> GetFriendEntries(const Internal::TreeUtils::RFriendInfo &friendInfo)
@@ -306,6 +398,8 @@ static std::vector<std::vector<Long64_t>> GetFriendEntries(const Internal::TreeU
 namespace ROOT {
 
 unsigned int TTreeProcessorMT::fgTasksPerWorkerHint = 10U;
+Long64_t TTreeProcessorMT::fgMinEntriesPerTask = 10000LL;
+unsigned int TTreeProcessorMT::fgFilesToPrefetch = 0U;
 
 namespace Internal {
 
@@ -515,7 +609,7 @@ TTreeProcessorMT::TTreeProcessorMT(TTree &tree, const TEntryList &entries, UInt_
 TTreeProcessorMT::TTreeProcessorMT(TTree &tree, UInt_t nThreads, const EntryRange &globalRange)
    : fFileNames(Internal::TreeUtils::GetFileNamesFromTree(tree)),
      fTreeNames(Internal::TreeUtils::GetTreeFullPaths(tree)), fFriendInfo(Internal::TreeUtils::GetFriendInfo(tree)),
-     fPool(nThreads), fGlobalRange(globalRange)
+     fPool(nThreads), fGlobalRange(globalRange), fEntriesPerFile(GetKnownEntriesPerFile(tree))
 {
 }
 
@@ -549,8 +643,11 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
    // sub-entrylists.
    const bool hasFriends = !fFriendInfo.fFriendNames.empty();
    const bool hasEntryList = fEntryList.GetN() > 0;
-   const bool shouldRetrieveAllClusters = hasFriends || hasEntryList || fGlobalRange.first > 0 ||
-                                          fGlobalRange.second != std::numeric_limits<Long64_t>::max();
+   const bool hasGlobalRange = fGlobalRange.first > 0 || fGlobalRange.second != std::numeric_limits<Long64_t>::max();
+   // If the number of entries of each file is known, a global range can be converted into local ranges of the files
+   // it overlaps with: the other files are never opened, and the clusters are retrieved concurrently for each file.
+   const bool useLocalRanges = hasGlobalRange && !hasFriends && !hasEntryList && !fEntriesPerFile.empty();
+   const bool shouldRetrieveAllClusters = hasFriends || hasEntryList || (hasGlobalRange && !useLocalRanges);
    ClustersAndEntries allClusterAndEntries{};
    auto &allClusters = allClusterAndEntries.first;
    const auto &allEntries = allClusterAndEntries.second;
@@ -560,22 +657,88 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
          allClusters = ConvertToElistClusters(std::move(allClusters), fEntryList, fTreeNames, fFileNames, allEntries);
    }
 
+   std::vector<EntryRange> localRanges;
+   if (useLocalRanges) {
+      Long64_t offset = 0ll;
+      for (const auto entries : fEntriesPerFile) {
+         localRanges.emplace_back(std::max(fGlobalRange.first - offset, 0ll),
+                                  std::min(fGlobalRange.second - offset, entries));
+         offset += entries;
+      }
+      if (fGlobalRange.first >= offset && offset > 0) // same check as in MakeClusters
+         throw std::logic_error(std::string("A range of entries was passed in the creation of the TTreeProcessorMT, ") +
+                                "but the starting entry (" + fGlobalRange.first + ") is larger than the total number " +
+                                "of entries (" + offset + ") in the dataset.");
+   }
+
+   // The number of entries of the friends is the same for all tasks: retrieve it once.
+   const auto friendEntries = hasFriends ? GetFriendEntries(fFriendInfo) : std::vector<std::vector<Long64_t>>{};
+
+   const auto firstNonEmpty =
+      fGlobalRange.first > 0u ? std::distance(allClusters.begin(), std::find_if(allClusters.begin(), allClusters.end(),
+                                                                                [](auto &c) { return !c.empty(); }))
+                              : 0u;
+
+   std::vector<std::size_t> fileIdxs(allEntries.empty() ? fFileNames.size() : allEntries.size() - firstNonEmpty);
+   std::iota(fileIdxs.begin(), fileIdxs.end(), firstNonEmpty);
+   if (useLocalRanges)
+      fileIdxs.erase(std::remove_if(fileIdxs.begin(), fileIdxs.end(),
+                                    [&](std::size_t i) { return localRanges[i].first >= localRanges[i].second; }),
+                     fileIdxs.end());
+
    // Per-file processing in case we retrieved all cluster info upfront
    auto processFileUsingGlobalClusters = [&](std::size_t fileIdx) {
       auto processCluster = [&](const EntryRange &c) {
          auto r = fTreeView->GetTreeReader(c.first, c.second, fTreeNames, fFileNames, fFriendInfo, fEntryList,
-                                           allEntries, GetFriendEntries(fFriendInfo));
+                                           allEntries, friendEntries);
          func(*r);
       };
       fPool.Foreach(processCluster, allClusters[fileIdx]);
    };
 
+   // Lookahead for the per-file processing: when a file starts being processed, the cluster boundaries of the next
+   // files to process are retrieved in background tasks, which opens them ahead of time. Whoever comes first, the
+   // background task or the one processing the file, retrieves them; the other one waits for or reuses the result.
+   // A background task only claims a file when it starts running, so waiting cannot deadlock on queued tasks.
+   const unsigned int nFilesToPrefetch =
+      !shouldRetrieveAllClusters && ROOT::IsImplicitMTEnabled() ? GetFilesToPrefetch() : 0u;
+   std::vector<std::once_flag> boundariesRetrieved(nFilesToPrefetch > 0 ? fFileNames.size() : 0u);
+   std::vector<std::vector<Long64_t>> prefetchedBoundaries(boundariesRetrieved.size());
+   auto retrieveBoundaries = [&](std::size_t fileIdx) -> const std::vector<Long64_t> & {
+      std::call_once(boundariesRetrieved[fileIdx], [&] {
+         prefetchedBoundaries[fileIdx] = GetClusterBoundaries(fTreeNames[fileIdx], fFileNames[fileIdx]);
+      });
+      return prefetchedBoundaries[fileIdx];
+   };
+   // Declared after the data used by its tasks, so that its destructor waits for them before they are destroyed
+   std::unique_ptr<ROOT::Experimental::TTaskGroup> prefetchTasks;
+   if (nFilesToPrefetch > 0)
+      prefetchTasks = std::make_unique<ROOT::Experimental::TTaskGroup>();
+
    // Per-file processing that also retrieves cluster info for a file
    auto processFileRetrievingClusters = [&](std::size_t fileIdx) {
+      std::vector<std::vector<Long64_t>> knownBoundaries;
+      if (nFilesToPrefetch > 0) {
+         // The files of consecutive indices are likely processed one after the other by the same worker
+         const auto pos = std::lower_bound(fileIdxs.begin(), fileIdxs.end(), fileIdx);
+         for (auto next = pos + 1; next != fileIdxs.end() && next <= pos + nFilesToPrefetch; ++next) {
+            prefetchTasks->Run([&retrieveBoundaries, nextIdx = *next] {
+               try {
+                  retrieveBoundaries(nextIdx);
+               } catch (...) {
+                  // the error is reported when the file is processed
+               }
+            });
+         }
+         knownBoundaries.emplace_back(retrieveBoundaries(fileIdx));
+      }
       // Evaluate clusters (with local entry numbers) and number of entries for this file
       const auto &treeNames = std::vector<std::string>({fTreeNames[fileIdx]});
       const auto &fileNames = std::vector<std::string>({fFileNames[fileIdx]});
-      const auto clustersAndEntries = MakeClusters(treeNames, fileNames, maxTasksPerFile);
+      const EntryRange localRange =
+         useLocalRanges ? localRanges[fileIdx] : EntryRange{0, std::numeric_limits<Long64_t>::max()};
+      const auto clustersAndEntries =
+         MakeClusters(treeNames, fileNames, maxTasksPerFile, localRange, std::move(knownBoundaries));
       const auto &clusters = clustersAndEntries.first[0];
       const auto &entries = clustersAndEntries.second[0];
       auto processCluster = [&](const EntryRange &c) {
@@ -586,18 +749,12 @@ void TTreeProcessorMT::Process(std::function<void(TTreeReader &)> func)
       fPool.Foreach(processCluster, clusters);
    };
 
-   const auto firstNonEmpty =
-      fGlobalRange.first > 0u ? std::distance(allClusters.begin(), std::find_if(allClusters.begin(), allClusters.end(),
-                                                                                [](auto &c) { return !c.empty(); }))
-                              : 0u;
-
-   std::vector<std::size_t> fileIdxs(allEntries.empty() ? fFileNames.size() : allEntries.size() - firstNonEmpty);
-   std::iota(fileIdxs.begin(), fileIdxs.end(), firstNonEmpty);
-
    if (shouldRetrieveAllClusters)
       fPool.Foreach(processFileUsingGlobalClusters, fileIdxs);
    else
       fPool.Foreach(processFileRetrievingClusters, fileIdxs);
+   if (prefetchTasks)
+      prefetchTasks->Wait();
 
    // make sure TChains and TFiles are cleaned up since they are not globally tracked
    for (unsigned int islot = 0; islot < fTreeView.GetNSlots(); ++islot) {
@@ -628,3 +785,47 @@ void TTreeProcessorMT::SetTasksPerWorkerHint(unsigned int tasksPerWorkerHint)
 {
    fgTasksPerWorkerHint = tasksPerWorkerHint;
 }
+
+////////////////////////////////////////////////////////////////////////
+/// \brief Set the minimum number of entries of the subranges in which large clusters are split.
+/// \param[in] n Minimum number of entries per task. A value of 0 disables the splitting of clusters.
+///
+/// Clusters that are much larger than the average task of their file, e.g. the single cluster of a
+/// small file processed by many workers, are split in subranges so that they can be processed
+/// concurrently. Splitting a cluster has a cost, since the baskets
+/// that span the boundary of two subranges are read and decompressed by both tasks.
+void TTreeProcessorMT::SetMinEntriesPerTask(Long64_t n)
+{
+   fgMinEntriesPerTask = n;
+}
+
+////////////////////////////////////////////////////////////////////////
+/// \brief Retrieve the minimum number of entries of the subranges in which large clusters are split.
+/// \return The minimum number of entries per task, 0 if clusters are never split.
+Long64_t TTreeProcessorMT::GetMinEntriesPerTask()
+{
+   return fgMinEntriesPerTask;
+}
+
+////////////////////////////////////////////////////////////////////////
+/// \brief Set the number of files that are opened ahead of time while the current ones are processed.
+/// \param[in] n Number of files to prefetch. A value of 0, the default, disables the prefetching.
+///
+/// When the processing of a file starts, the next `n` files to process are opened in background tasks,
+/// to read their TTree and cluster boundaries and to load their streamers. Workers then move on to a new
+/// file without waiting for that. This hides the latency of opening remote files, e.g. with XRootD; for
+/// local files it brings little. The prefetching is only done if implicit multi-threading is enabled and
+/// the clusters are retrieved per file, i.e. when there are no friends nor TEntryList and either no
+/// entry range or the number of entries of each file is known upfront.
+void TTreeProcessorMT::SetFilesToPrefetch(unsigned int n)
+{
+   fgFilesToPrefetch = n;
+}
+
+////////////////////////////////////////////////////////////////////////
+/// \brief Retrieve the number of files that are opened ahead of time while the current ones are processed.
+/// \return The number of files to prefetch, 0 if prefetching is disabled.
+unsigned int TTreeProcessorMT::GetFilesToPrefetch()
+{
+   return fgFilesToPrefetch;
+}
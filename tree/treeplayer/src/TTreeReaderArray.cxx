@@ -100,6 +100,18 @@ namespace {
             return myCollectionProxy->At(idx);
          }
       }
+
+      size_t GetContiguousStride(ROOT::Detail::TBranchProxy* proxy) override {
+         return VectorStride(GetCP(proxy));
+      }
+
+      /// The elements of a std::vector (but std::vector<bool>) of values are contiguous.
+      static size_t VectorStride(TVirtualCollectionProxy *myCollectionProxy) {
+         if (!myCollectionProxy || myCollectionProxy->GetCollectionType() != ROOT::kSTLvector ||
+             myCollectionProxy->HasPointers() || myCollectionProxy->GetType() == kBool_t)
+            return 0;
+         return myCollectionProxy->GetIncrement();
+      }
    };
 
    class TCollectionLessSTLReader final: public TVirtualCollectionReader {
@@ -146,6 +158,10 @@ namespace {
             return myCollectionProxy->At(idx);
          }
       }
+
+      size_t GetContiguousStride(ROOT::Detail::TBranchProxy* proxy) override {
+         return TSTLReader::VectorStride(GetCP(proxy));
+      }
    };
 
 
@@ -191,6 +207,13 @@ namespace {
          return (void*)((Byte_t*)array + (objectSize * idx));
       }
 
+      size_t GetContiguousStride(ROOT::Detail::TBranchProxy* proxy) override {
+         if (fBasicTypeSize != -1)
+            return fBasicTypeSize;
+         TClass *myClass = proxy->GetClass();
+         return myClass ? myClass->GetClassSize() : 0;
+      }
+
       void SetBasicTypeSize(Int_t size){
          fBasicTypeSize = size;
       }
@@ -330,6 +353,11 @@ namespace {
          if (!myCollectionProxy) return 0;
          return (Byte_t*)myCollectionProxy->At(idx) + proxy->GetOffset();
       }
+
+      // The data members of the objects of a std::vector are at the distance of the object size.
+      size_t GetContiguousStride(ROOT::Detail::TBranchProxy* proxy) override {
+         return TSTLReader::VectorStride(GetCP(proxy));
+      }
    };
 
    class TBasicTypeClonesReader final: public TClonesReader {
@@ -368,6 +396,15 @@ namespace {
          return (Byte_t*)address + (fElementSize * idx);
       }
 
+      size_t GetContiguousStride(ROOT::Detail::TBranchProxy* /*proxy*/) override {
+         if (fElementSize == -1){
+            TLeaf *myLeaf = fValueReader->GetLeaf();
+            if (!myLeaf) return 0;
+            fElementSize = myLeaf->GetLenType();
+         }
+         return fElementSize;
+      }
+
    protected:
       void ProxyRead(){
          fValueReader->ProxyRead();
@@ -29,6 +29,41 @@ TEST(TTreeReaderArray, Vector)
    EXPECT_FLOAT_EQ(17.f, vec[0]);
 }
 
+TEST(TTreeReaderArray, ContiguousData)
+{
+   TTree tree("TTreeReaderArrayTree", "In-memory test tree");
+   std::vector<float> vecf{17.f, 18.f, 19.f};
+   std::vector<bool> vecb{true, false, true};
+   int n = 4;
+   double arr[4] = {1., 2., 3., 4.};
+   tree.Branch("vec", &vecf);
+   tree.Branch("vecb", &vecb);
+   tree.Branch("n", &n);
+   tree.Branch("arr", arr, "arr[n]/D");
+   tree.Fill();
+   tree.ResetBranchAddresses();
+
+   TTreeReader tr(&tree);
+   TTreeReaderArray<float> vec(tr, "vec");
+   TTreeReaderArray<bool> vb(tr, "vecb");
+   TTreeReaderArray<double> a(tr, "arr");
+   tr.SetEntry(0);
+
+   EXPECT_TRUE(vec.IsContiguous());
+   ASSERT_NE(nullptr, vec.GetData());
+   EXPECT_EQ(&vec[0], vec.GetData());
+   EXPECT_FLOAT_EQ(19.f, vec.GetData()[2]);
+
+   EXPECT_TRUE(a.IsContiguous());
+   ASSERT_NE(nullptr, a.GetData());
+   EXPECT_DOUBLE_EQ(4., a.GetData()[3]);
+
+   // The elements of a std::vector<bool> cannot be addressed.
+   EXPECT_FALSE(vb.IsContiguous());
+   EXPECT_EQ(nullptr, vb.GetData());
+   EXPECT_TRUE(vb[2]);
+}
+
 TEST(TTreeReaderArray, MultiReaders)
 {
    // See https://root.cern.ch/phpBB3/viewtopic.php?f=3&t=22790
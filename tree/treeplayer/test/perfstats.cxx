@@ -0,0 +1,69 @@
+#include "TFile.h"
+#include "TSystem.h"
+#include "TTree.h"
+#include "TTreePerfStats.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+
+TEST(TTreePerfStats, BranchStats)
+{
+   const auto fileName = "perfstats_branchstats.root";
+   {
+      TFile f(fileName, "RECREATE");
+      TTree t("t", "t");
+      int i = 0;
+      double x = 0;
+      t.Branch("i", &i, 1000);
+      t.Branch("x", &x, 1000);
+      for (i = 0; i < 1000; ++i) {
+         x = 0.5 * i;
+         t.Fill();
+      }
+      t.Write();
+   }
+
+   TFile f(fileName);
+   auto t = f.Get<TTree>("t");
+   ASSERT_NE(nullptr, t);
+   TTreePerfStats ps("ioperf", t);
+   double x = 0;
+   t->SetBranchStatus("*", false);
+   t->SetBranchStatus("x", true);
+   t->SetBranchAddress("x", &x);
+   for (Long64_t e = 0; e < t->GetEntries(); ++e)
+      t->GetEntry(e);
+
+   auto branches = ps.GetBranchStats();
+   ASSERT_EQ(1u, branches.size());
+   const auto &br = branches[0];
+   EXPECT_EQ(TString("x"), br.fName);
+   EXPECT_EQ(1000, br.fEntries);
+   EXPECT_EQ(1000 * (Long64_t)sizeof(double), br.fBytesDeserialized);
+   auto branch = t->GetBranch("x");
+   EXPECT_EQ(branch->GetWriteBasket(), br.fBaskets);
+   EXPECT_EQ(br.fBaskets, br.fCacheHits + br.fCacheMisses);
+   EXPECT_GT(br.fBytesRead, 0);
+   EXPECT_GE(br.fBytesUnzipped, 1000 * (Long64_t)sizeof(double));
+
+   auto threads = ps.GetThreadStats();
+   ASSERT_EQ(1u, threads.size());
+   EXPECT_GT(threads[0].fReadCalls, 0);
+
+   auto json = ps.GetReportJSON();
+   EXPECT_TRUE(json.Contains("\"branches\": [\n    {\"name\": \"x\", \"entries\": 1000,")) << json;
+   EXPECT_TRUE(json.Contains("\"threads\": [\n    {\"thread\": 0,")) << json;
+
+   std::unique_ptr<TTree> stats(ps.MakeBranchStatsTree());
+   stats->SetDirectory(nullptr);
+   ASSERT_EQ(1, stats->GetEntries());
+   Long64_t entries = 0;
+   stats->SetBranchAddress("entries", &entries);
+   stats->GetEntry(0);
+   EXPECT_EQ(1000, entries);
+
+   t->SetPerfStats(nullptr);
+   f.Close();
+   gSystem->Unlink(fileName);
+}
@@ -0,0 +1,50 @@
+#include "TTree.h"
+#include "TTreeFormula.h"
+
+#include "gtest/gtest.h"
+
+#include <memory>
+
+TEST(TTreeFormula, JitCompile)
+{
+   TTree t("t", "t");
+   t.SetDirectory(nullptr);
+   float a = 0;
+   int b = 0;
+   double c[3] = {0, 0, 0};
+   t.Branch("a", &a);
+   t.Branch("b", &b);
+   t.Branch("c", c, "c[3]/D");
+   for (int i = 0; i < 20; ++i) {
+      a = 0.5f * i - 4;
+      b = i % 4;
+      c[0] = c[1] = c[2] = i;
+      t.Fill();
+   }
+
+   const char *expressions[] = {"a*b+sqrt(a)", "a/b", "b%3 + (a>0 && b!=2) + !(a<1)", "log(a)+exp(-a)*atan2(a,b)",
+                                "pow(a,2)-sq(b)+abs(a)+sign(a)*pi", "(b<<2)|1", "b==1 || a>=2"};
+   for (auto expr : expressions) {
+      TTreeFormula interpreted("interpreted", expr, &t);
+      TTreeFormula jitted("jitted", expr, &t);
+      ASSERT_FALSE(interpreted.IsJitCompiled());
+      ASSERT_TRUE(jitted.JitCompile()) << expr;
+      EXPECT_TRUE(jitted.IsJitCompiled());
+      for (Long64_t i = 0; i < t.GetEntries(); ++i) {
+         t.LoadTree(i);
+         EXPECT_DOUBLE_EQ(interpreted.EvalInstance(), jitted.EvalInstance()) << expr << " entry " << i;
+      }
+   }
+
+   // Arrays are not supported and keep being interpreted.
+   TTreeFormula array("array", "c*a", &t);
+   EXPECT_FALSE(array.JitCompile());
+
+   EXPECT_FALSE(TTreeFormula::GetJitCompilation());
+   TTreeFormula::SetJitCompilation(true);
+   auto automatic = std::make_unique<TTreeFormula>("automatic", "a+b", &t);
+   TTreeFormula::SetJitCompilation(false);
+   EXPECT_TRUE(automatic->IsJitCompiled());
+
+   EXPECT_EQ(t.Draw("a*b", "a>0", "goff"), t.Draw("a*b", "a>0", "goff jit"));
+}
@@ -0,0 +1,85 @@
+#include "TTree.h"
+#include "TTreeIndex.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
+TEST(TTreeIndex, SortOrder)
+{
+   TTree t("t", "t");
+   t.SetDirectory(nullptr);
+   Long64_t run = 0, event = 0;
+   t.Branch("run", &run);
+   t.Branch("event", &event);
+
+   // Negative values, duplicate majors and both small and large minors.
+   std::vector<std::tuple<Long64_t, Long64_t, Long64_t>> expected;
+   for (Long64_t i = 0; i < 1000; ++i) {
+      run = (i * 7) % 5 - 2;
+      event = ((i * 7919) % 1000) * (i % 2 ? 1 : -1) * 1000003;
+      t.Fill();
+      expected.emplace_back(run, event, i);
+   }
+   std::stable_sort(expected.begin(), expected.end(), [](const auto &a, const auto &b) {
+      return std::make_pair(std::get<0>(a), std::get<1>(a)) < std::make_pair(std::get<0>(b), std::get<1>(b));
+   });
+
+   ASSERT_EQ(1000, t.BuildIndex("run", "event"));
+   auto index = dynamic_cast<TTreeIndex *>(t.GetTreeIndex());
+   ASSERT_NE(nullptr, index);
+   for (Long64_t i = 0; i < 1000; ++i) {
+      EXPECT_EQ(std::get<0>(expected[i]), index->GetIndexValues()[i]);
+      EXPECT_EQ(std::get<1>(expected[i]), index->GetIndexValuesMinor()[i]);
+      EXPECT_EQ(std::get<2>(expected[i]), index->GetIndex()[i]);
+   }
+   EXPECT_EQ(3, t.GetEntryNumberWithIndex(-1, 757 * 1000003));
+}
+
+TEST(TTreeIndex, FriendLookup)
+{
+   // The friend is written in a different order than the main tree, only the
+   // index aligns the two.
+   TTree f("f", "f");
+   f.SetDirectory(nullptr);
+   Long64_t run = 0, event = 0, value = 0;
+   f.Branch("run", &run);
+   f.Branch("event", &event);
+   f.Branch("value", &value);
+   for (Long64_t i = 0; i < 1000; ++i) {
+      run = (999 - i) / 100;
+      event = (999 - i) % 100;
+      value = run * 1000 + event;
+      f.Fill();
+   }
+   ASSERT_EQ(1000, f.BuildIndex("run", "event"));
+
+   // Sorted like the index, then going backwards, with holes.
+   std::vector<std::pair<Long64_t, Long64_t>> keys;
+   for (Long64_t i = 0; i < 1000; i += 3)
+      keys.emplace_back(i / 100, i % 100);
+   for (Long64_t i = 999; i >= 0; i -= 7)
+      keys.emplace_back(i / 100, i % 100);
+   keys.emplace_back(10, 0);
+   keys.emplace_back(0, 5);
+
+   TTree t("t", "t");
+   t.SetDirectory(nullptr);
+   t.Branch("run", &run);
+   t.Branch("event", &event);
+   for (auto &k : keys) {
+      std::tie(run, event) = k;
+      t.Fill();
+   }
+   t.AddFriend(&f);
+
+   Long64_t friendValue = -1;
+   t.SetBranchAddress("value", &friendValue);
+   for (Long64_t i = 0; i < t.GetEntries(); ++i) {
+      t.GetEntry(i);
+      if (keys[i].first != 10) // not in the friend
+         EXPECT_EQ(keys[i].first * 1000 + keys[i].second, friendValue) << "entry " << i;
+   }
+}
@@ -12,6 +12,7 @@
 #include <TTreeReader.h>
 #include <TTreeReaderValue.h>
 #include <ROOT/TTreeProcessorMT.hxx>
+#include <ROOT/TestSupport.hxx>
 
 #include "gtest/gtest.h"
 
@@ -106,6 +107,50 @@ TEST(TreeProcessorMT, ManyFiles)
    DeleteFiles(filenames);
 }
 
+TEST(TreeProcessorMT, PrefetchFiles)
+{
+   const auto nFiles = 20u;
+   const std::string treename = "t";
+   std::vector<std::string> filenames;
+   for (auto i = 0u; i < nFiles; ++i)
+      filenames.emplace_back("treeprocmt_prefetch" + std::to_string(i) + ".root");
+   WriteFiles(std::vector<std::string>(nFiles, treename), filenames);
+
+   ROOT::EnableImplicitMT(4);
+   const auto oldFilesToPrefetch = ROOT::TTreeProcessorMT::GetFilesToPrefetch();
+   ROOT::TTreeProcessorMT::SetFilesToPrefetch(3);
+
+   std::atomic_int sum(0);
+   std::atomic_int count(0);
+   auto sumValues = [&sum, &count](TTreeReader &r) {
+      TTreeReaderValue<int> v(r, "v");
+      while (r.Next()) {
+         sum += *v;
+         ++count;
+      }
+   };
+   std::vector<std::string_view> fnames(filenames.begin(), filenames.end());
+   {
+      ROOT::TTreeProcessorMT proc(fnames, treename);
+      proc.Process(sumValues);
+   }
+   EXPECT_EQ(count.load(), int(nFiles * 10));
+   EXPECT_EQ(sum.load(), 20100); // sum of [1..nFiles*nEntriesPerFile] inclusive
+
+   // a file that cannot be opened by a background task is reported when it is processed
+   fnames.emplace_back("treeprocmt_prefetch_doesnotexist.root");
+   {
+      ROOT::TestSupport::CheckDiagsRAII diags;
+      diags.optionalDiag(kError, "TFile::TFile", "does not exist", false);
+      ROOT::TTreeProcessorMT proc(fnames, treename);
+      EXPECT_THROW(proc.Process(sumValues), std::runtime_error);
+   }
+
+   ROOT::TTreeProcessorMT::SetFilesToPrefetch(oldFilesToPrefetch);
+   ROOT::DisableImplicitMT();
+   DeleteFiles(filenames);
+}
+
 TEST(TreeProcessorMT, TreesWithDifferentNamesChainCtor)
 {
    const std::vector<std::string> treenames{"t0","t1","t2"};
@@ -362,6 +407,66 @@ TEST(TreeProcessorMT, LimitNTasks_CheckClusters)
    gSystem->Unlink(filename);
 }
 
+TEST(TreeProcessorMT, SplitLargeClusters)
+{
+   const auto nEvents = 100000;
+   const auto filename = "TreeProcessorMT_SplitLargeClusters.root";
+   const auto treename = "t";
+   {
+      TFile file(filename, "recreate");
+      TTree t(treename, treename);
+      int v = 0;
+      t.Branch("v", &v);
+      for (v = 0; v < nEvents; ++v)
+         t.Fill();
+      t.Write();
+   }
+
+   std::mutex m;
+   std::vector<std::pair<Long64_t, Long64_t>> clusters;
+   auto get_clusters = [&m, &clusters](TTreeReader &t) {
+      std::lock_guard<std::mutex> l(m);
+      clusters.emplace_back(t.GetEntriesRange());
+   };
+
+   const unsigned int nslots = std::min(4U, std::thread::hardware_concurrency());
+   ROOT::EnableImplicitMT(nslots);
+   const auto oldMinEntries = ROOT::TTreeProcessorMT::GetMinEntriesPerTask();
+
+   // the single cluster of the file is split in GetTasksPerWorkerHint() tasks per worker
+   ROOT::TTreeProcessorMT::SetMinEntriesPerTask(1000);
+   {
+      ROOT::TTreeProcessorMT p(filename, treename);
+      p.Process(get_clusters);
+   }
+   EXPECT_EQ(ROOT::TTreeProcessorMT::GetTasksPerWorkerHint() * nslots, clusters.size());
+   CheckClusters(clusters, nEvents);
+   clusters.clear();
+
+   // subranges have at least GetMinEntriesPerTask() entries
+   ROOT::TTreeProcessorMT::SetMinEntriesPerTask(40000);
+   {
+      ROOT::TTreeProcessorMT p(filename, treename);
+      p.Process(get_clusters);
+   }
+   EXPECT_EQ(2u, clusters.size());
+   CheckClusters(clusters, nEvents);
+   clusters.clear();
+
+   // no splitting
+   ROOT::TTreeProcessorMT::SetMinEntriesPerTask(0);
+   {
+      ROOT::TTreeProcessorMT p(filename, treename);
+      p.Process(get_clusters);
+   }
+   EXPECT_EQ(1u, clusters.size());
+   CheckClusters(clusters, nEvents);
+
+   ROOT::TTreeProcessorMT::SetMinEntriesPerTask(oldMinEntries);
+   ROOT::DisableImplicitMT();
+   gSystem->Unlink(filename);
+}
+
 TEST(TreeProcessorMT, TreeWithFriendTree)
 {
    std::vector<std::string> fileNames = {"TreeWithFriendTree_Tree.root", "TreeWithFriendTree_Friend.root"};